@@ -591,11 +591,11 @@ namespace blaze {}
    #include <blaze/math/CompressedVector.h>
    \endcode
 
-// The type of the elements and the transpose flag of the vector can be specified via the two
-// template parameters:
+// The type of the elements, the transpose flag of the vector, and the type of the stored indices
+// can be specified via the three template parameters:
 
    \code
-   template< typename Type, bool TF >
+   template< typename Type, bool TF, typename IT >
    class CompressedVector;
    \endcode
 
@@ -603,6 +603,8 @@ namespace blaze {}
 //             non-cv-qualified, non-reference, non-pointer element type.
 //  - \c TF  : specifies whether the vector is a row vector (\c blaze::rowVector) or a column
 //             vector (\c blaze::columnVector). The default value is \c blaze::columnVector.
+//  - \c IT  : specifies the unsigned integral type of the stored indices. The default value is
+//             \c size_t. A narrower type (e.g. \c unsigned \c int) reduces the memory footprint.
 //
 //
 // \n <center> Previous: \ref getting_started &nbsp; &nbsp; Next: \ref vector_operations </center>
@@ -1410,11 +1412,11 @@ namespace blaze {}
    #include <blaze/math/CompressedMatrix.h>
    \endcode
 
-// The type of the elements and the storage order of the matrix can be specified via the two
-// template parameters:
+// The type of the elements, the storage order of the matrix, and the type of the stored indices
+// can be specified via the three template parameters:
 
    \code
-   template< typename Type, bool SO >
+   template< typename Type, bool SO, typename IT >
    class CompressedMatrix;
    \endcode
 
@@ -1422,6 +1424,9 @@ namespace blaze {}
 //             any non-cv-qualified, non-reference, non-pointer element type.
 //  - \c SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
 //             The default value is blaze::rowMajor.
+//  - \c IT  : specifies the unsigned integral type of the stored row or column indices. The
+//             default value is \c size_t. A narrower type (e.g. \c unsigned \c int) reduces
+//             the memory footprint and the memory traffic of all sparse kernels.
 //
 //
 // \n <center> Previous: \ref vector_operations &nbsp; &nbsp; Next: \ref matrix_operations </center>
@@ -5648,6 +5653,25 @@ namespace blaze {}
 // the C++11 thread parallelization.
 //
 //
+// \n \section cpp_threads_work_stealing Work-Stealing Scheduler
+// <hr>
+//
+// By default, all tasks of the C++11 thread parallelization are scheduled via a single task
+// queue. Alternatively, \b Blaze provides a work-stealing scheduler, which can be selected via
+// the \c BLAZE_USE_WORK_STEALING command line argument:
+
+   \code
+   ... -std=c++11 -DBLAZE_USE_CPP_THREADS -DBLAZE_USE_WORK_STEALING ...
+   \endcode
+
+// In this mode every thread owns a lock-free deque of tasks. Idle threads steal tasks from
+// the deques of other threads and the thread waiting for the completion of an operation takes
+// part in its execution. Tasks are stored in preallocated, recycled task slots and therefore
+// don't require any dynamic memory allocation. Additionally, SMP assignments may be nested,
+// i.e. an SMP assignment executed within a task is executed in parallel as well instead of
+// resulting in a \a std::runtime_error exception.
+//
+//
 // \n \section cpp_threads_known_issues Known Issues
 // <hr>
 //
@@ -5748,6 +5772,11 @@ namespace blaze {}
 // have been determined using the OpenMP parallelization and require individual adaption for
 // the Boost thread parallelization.
 //
+// As in case of the C++11 thread parallelization, the work-stealing scheduler can be selected
+// via the \c BLAZE_USE_WORK_STEALING command line argument (see \ref cpp_threads_parallelization).
+// Note that in this case the Boost.Atomic library is required in addition to the Boost.Thread
+// library.
+//
 // \n <center> Previous: \ref cpp_threads_parallelization &nbsp; &nbsp; Next: \ref serial_execution </center>
 */
 //*************************************************************************************************
@@ -6220,6 +6249,28 @@ namespace blaze {}
 // the OpenMP-based parallelization, are contained within the configuration file
 // <em>./blaze/config/Thresholds.h</em>.
 //
+// The settings in this file only provide the defaults for the thresholds. The values that are
+// actually used can be adapted at runtime without recompiling the application, either directly
+// via the setThreshold() function:
+
+   \code
+   blaze::setThreshold( blaze::smpDVecAssignThreshold, 100000UL );
+   \endcode
+
+// or via the environment. In case the \c BLAZE_THRESHOLD_FILE environment variable names a
+// threshold file, this file is loaded on first use. Additionally, every single threshold can be
+// overridden by an environment variable with the name of the according setting and the prefix
+// \c BLAZE_:
+
+   \code
+   export BLAZE_THRESHOLD_FILE=/path/to/thresholds.cfg
+   export BLAZE_SMP_DVECASSIGN_THRESHOLD=100000
+   \endcode
+
+// A threshold file contains one setting of the form <tt>NAME=VALUE</tt> per line. The \c calibrate
+// executable of the \b Blaze benchmark suite (blazemark) determines suitable thresholds for the
+// current machine and writes them in this format.
+//
 //
 // \n \section streaming Streaming (Non-Temporal Stores)
 //
@@ -46,8 +46,12 @@
 #include <blaze/math/CompressedVector.h>
 #include <blaze/math/Constants.h>
 #include <blaze/math/Constraints.h>
+#include <blaze/math/CustomMatrix.h>
+#include <blaze/math/CustomVector.h>
 #include <blaze/math/DiagonalMatrix.h>
+#include <blaze/math/Dispatch.h>
 #include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicSparseMatrix.h>
 #include <blaze/math/DynamicVector.h>
 #include <blaze/math/Epsilon.h>
 #include <blaze/math/Functions.h>
@@ -55,7 +59,11 @@
 #include <blaze/math/HybridMatrix.h>
 #include <blaze/math/HybridVector.h>
 #include <blaze/math/LowerMatrix.h>
+#include <blaze/math/MappedCompressedMatrix.h>
+#include <blaze/math/MappedMatrix.h>
+#include <blaze/math/PackedMatrix.h>
 #include <blaze/math/Quaternion.h>
+#include <blaze/math/SellMatrix.h>
 #include <blaze/math/RotationMatrix.h>
 #include <blaze/math/Serialization.h>
 #include <blaze/math/Shims.h>
@@ -69,6 +77,7 @@
 #include <blaze/math/SymmetricMatrix.h>
 #include <blaze/math/Traits.h>
 #include <blaze/math/TransposeFlag.h>
+#include <blaze/math/TripletBuilder.h>
 #include <blaze/math/TypeTraits.h>
 #include <blaze/math/UniLowerMatrix.h>
 #include <blaze/math/UniUpperMatrix.h>
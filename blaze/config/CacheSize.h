@@ -48,4 +48,34 @@ namespace blaze {
 const size_t cacheSize = 3145728UL;
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Size of the first level data cache of the target architecture.
+// \ingroup config
+//
+// This setting specifies the size in Byte of the first level data cache of a single core of the
+// used target architecture. It is used to determine the block sizes of cache-blocked kernels
+// (as for instance the dense matrix/dense matrix multiplication kernel for large matrices).
+//
+// The size of the cache is specified in Byte. For instance, a cache of 32 KiByte must therefore
+// be specified as 32768.
+*/
+const size_t l1CacheSize = 32768UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Size of the second level cache of the target architecture.
+// \ingroup config
+//
+// This setting specifies the size in Byte of the second level cache of a single core of the
+// used target architecture. It is used to determine the block sizes of cache-blocked kernels
+// (as for instance the dense matrix/dense matrix multiplication kernel for large matrices).
+//
+// The size of the cache is specified in Byte. For instance, a cache of 256 KiByte must therefore
+// be specified as 262144.
+*/
+const size_t l2CacheSize = 262144UL;
+//*************************************************************************************************
+
 } // namespace blaze
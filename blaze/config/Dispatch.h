@@ -0,0 +1,78 @@
+//=================================================================================================
+/*!
+//  \file blaze/config/Dispatch.h
+//  \brief Configuration of the runtime instruction set dispatch
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for (de-)activation of the runtime instruction set dispatch.
+// \ingroup config
+//
+// This compilation switch enables/disables the runtime dispatch of a small set of performance
+// critical kernels of the Blaze library. In case the switch is set to 1 (i.e. in case the
+// dispatch is enabled), these kernels are additionally compiled for the AVX, AVX2/FMA, and
+// AVX-512 instruction sets. On first use the instruction set of the executing CPU is determined
+// and in case it is more powerful than the instruction set selected at compile time, the kernels
+// are relayed to the best matching variant. This enables a single executable built for instance
+// for SSE2 to make use of more recent CPUs in its most expensive operations. In case the switch
+// is set to 0 (i.e. the dispatch is disabled), all operations exclusively use the instruction
+// set selected at compile time.
+//
+// The dispatch is restricted to the following operations on single or double precision dense
+// vectors and matrices that provide direct access to their data (i.e. no expressions and no
+// diagonal matrices):
+//  - dense matrix/dense vector and dense vector/dense matrix multiplications
+//    (\f$ \vec{y}=A*\vec{x} \f$ and \f$ \vec{y}^T=\vec{x}^T*A \f$ including the according
+//    addition and subtraction assignments),
+//  - multiplications of two dense matrices with the same storage order (\f$ C=A*B \f$ including
+//    the according addition and subtraction assignments),
+//  - inner products of two dense vectors (\f$ s=\vec{x}^T*\vec{y} \f$),
+//  - the scaled vector addition and subtraction \f$ \vec{y}+=s*\vec{x} \f$ and
+//    \f$ \vec{y}-=s*\vec{x} \f$, and
+//  - the sum of the elements of a dense vector.
+//
+// All other operations, in particular all other element-wise vector and matrix operations
+// (as for instance \f$ \vec{z}=\vec{x}+\vec{y} \f$ or \f$ \vec{y}=s*\vec{x} \f$) and all
+// sparse operations, are not dispatched and always use the instruction set selected at compile
+// time. In order to use a more recent instruction set for these operations, Blaze has to be
+// compiled for this instruction set (for instance via -mavx2 -mfma).
+//
+// Possible settings for the dispatch switch:
+//  - Deactivated: \b 0
+//  - Activated  : \b 1 (default)
+//
+// Note that the runtime dispatch is only available for x86 CPUs and the GNU and Clang compilers.
+// Also note that the dispatch is disabled in case the vectorization of Blaze is disabled (see
+// the BLAZE_USE_VECTORIZATION switch).
+*/
+#define BLAZE_USE_DISPATCH 1
+//*************************************************************************************************
@@ -1180,6 +1180,29 @@ const size_t SMP_TSMATTSMATMULT_THRESHOLD = 150UL;
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief SMP row-major sparse matrix/row-major sparse matrix addition threshold.
+// \ingroup config
+//
+// This threshold specifies when a row-major sparse matrix/row-major sparse matrix addition can
+// be executed in parallel. This threshold affects both additions between two row-major matrices
+// or two column-major sparse matrices. In case the number of rows/columns of the target matrix
+// is larger or equal to this threshold, the operation is executed in parallel. If the number of
+// rows/columns is below this threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Since the addition of two sparse matrices is a
+// memory bound operation, the parallel execution only pays off for rather large matrices.
+//
+// The default setting for this threshold is 1000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+*/
+const size_t SMP_SMATSMATADD_THRESHOLD = 1000UL;
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief SMP dense vector/dense vector outer product threshold.
 // \ingroup config
@@ -1202,4 +1225,118 @@ const size_t SMP_TSMATTSMATMULT_THRESHOLD = 150UL;
 const size_t SMP_DVECTDVECMULT_THRESHOLD = 290UL;
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief SMP dense vector reduction threshold.
+// \ingroup config
+//
+// This threshold specifies when a reduction of a dense vector (as for instance the sum(), min(),
+// max(), or length() function) can be executed in parallel. In case the number of elements of
+// the dense vector is larger or equal to this threshold, the operation is executed in parallel.
+// If the number of elements is below this threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Since a reduction is a memory bound operation,
+// the parallel execution only pays off for rather large vectors.
+//
+// The default setting for this threshold is 38000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+*/
+const size_t SMP_DVECREDUCTION_THRESHOLD = 38000UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense matrix reduction threshold.
+// \ingroup config
+//
+// This threshold specifies when a reduction of a dense matrix (as for instance the sum(), min(),
+// or max() function) can be executed in parallel. This threshold affects both row-major and
+// column-major matrices. In case the number of rows of a row-major matrix or the number of
+// columns of a column-major matrix is larger or equal to this threshold, the operation is
+// executed in parallel. If the number of rows/columns is below this threshold the operation is
+// executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Since a reduction is a memory bound operation,
+// the parallel execution only pays off for rather large matrices.
+//
+// The default setting for this threshold is 220. In case the threshold is set to 0, the operation
+// is unconditionally executed in parallel.
+*/
+const size_t SMP_DMATREDUCTION_THRESHOLD = 220UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP triplet assembly threshold.
+// \ingroup config
+//
+// This threshold specifies when the assembly of a compressed matrix from triplets via the
+// TripletBuilder class template can be executed in parallel. In case the total number of
+// triplets is larger or equal to this threshold, the sorting and merging of the triplets and
+// the construction of the compressed matrix are executed in parallel. If the number of triplets
+// is below this threshold the assembly is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 20000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+*/
+const size_t SMP_TRIPLETASSIGN_THRESHOLD = 20000UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dynamic sparse matrix freeze threshold.
+// \ingroup config
+//
+// This threshold specifies when the conversion of a DynamicSparseMatrix into a compressed matrix
+// via the \a freeze() function can be executed in parallel. In case the number of rows/columns
+// of the dynamic sparse matrix is larger or equal to this threshold, the rows/columns are copied
+// in parallel. If the number of rows/columns is below this threshold the conversion is executed
+// single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Since the conversion is a memory bound operation,
+// the parallel execution only pays off for rather large matrices.
+//
+// The default setting for this threshold is 1000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+*/
+const size_t SMP_SMATFREEZE_THRESHOLD = 1000UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP projected Gauss-Seidel threshold.
+// \ingroup config
+//
+// This threshold specifies when a sweep of the parallel modes of the projected Gauss-Seidel
+// solver (see the PGS class) can be executed in parallel. In case the number of independently
+// updated blocks of unknowns (the contacts of a single color in the colored mode or the contacts
+// of all partitions in the block-Jacobi mode) is larger or equal to this threshold, the blocks
+// are updated in parallel. If the number of blocks is below this threshold the sweep is
+// executed single-threaded. Note that the result of a sweep does not depend on this threshold.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 1000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+*/
+const size_t SMP_PGS_THRESHOLD = 1000UL;
+//*************************************************************************************************
+
 } // namespace blaze
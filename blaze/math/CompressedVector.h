@@ -64,35 +64,36 @@ namespace blaze {
 // This specialization of the Rand class creates random instances of CompressedVector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-class Rand< CompressedVector<Type,TF> >
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+class Rand< CompressedVector<Type,TF,IT> >
 {
  public:
    //**Generate functions**************************************************************************
    /*!\name Generate functions */
    //@{
-   inline const CompressedVector<Type,TF> generate( size_t size ) const;
-   inline const CompressedVector<Type,TF> generate( size_t size, size_t nonzeros ) const;
+   inline const CompressedVector<Type,TF,IT> generate( size_t size ) const;
+   inline const CompressedVector<Type,TF,IT> generate( size_t size, size_t nonzeros ) const;
 
    template< typename Arg >
-   inline const CompressedVector<Type,TF> generate( size_t size, const Arg& min, const Arg& max ) const;
+   inline const CompressedVector<Type,TF,IT> generate( size_t size, const Arg& min, const Arg& max ) const;
 
    template< typename Arg >
-   inline const CompressedVector<Type,TF> generate( size_t size, size_t nonzeros, const Arg& min, const Arg& max ) const;
+   inline const CompressedVector<Type,TF,IT> generate( size_t size, size_t nonzeros, const Arg& min, const Arg& max ) const;
    //@}
    //**********************************************************************************************
 
    //**Randomize functions*************************************************************************
    /*!\name Randomize functions */
    //@{
-   inline void randomize( CompressedVector<Type,TF>& vector ) const;
-   inline void randomize( CompressedVector<Type,TF>& vector, size_t nonzeros ) const;
+   inline void randomize( CompressedVector<Type,TF,IT>& vector ) const;
+   inline void randomize( CompressedVector<Type,TF,IT>& vector, size_t nonzeros ) const;
 
    template< typename Arg >
-   inline void randomize( CompressedVector<Type,TF>& vector, const Arg& min, const Arg& max ) const;
+   inline void randomize( CompressedVector<Type,TF,IT>& vector, const Arg& min, const Arg& max ) const;
 
    template< typename Arg >
-   inline void randomize( CompressedVector<Type,TF>& vector, size_t nonzeros, const Arg& min, const Arg& max ) const;
+   inline void randomize( CompressedVector<Type,TF,IT>& vector, size_t nonzeros, const Arg& min, const Arg& max ) const;
    //@}
    //**********************************************************************************************
 };
@@ -108,11 +109,12 @@ class Rand< CompressedVector<Type,TF> >
 // \return The generated random vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline const CompressedVector<Type,TF>
-   Rand< CompressedVector<Type,TF> >::generate( size_t size ) const
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline const CompressedVector<Type,TF,IT>
+   Rand< CompressedVector<Type,TF,IT> >::generate( size_t size ) const
 {
-   CompressedVector<Type,TF> vector( size );
+   CompressedVector<Type,TF,IT> vector( size );
    randomize( vector );
 
    return vector;
@@ -131,14 +133,15 @@ inline const CompressedVector<Type,TF>
 // \exception std::invalid_argument Invalid number of non-zero elements.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline const CompressedVector<Type,TF>
-   Rand< CompressedVector<Type,TF> >::generate( size_t size, size_t nonzeros ) const
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline const CompressedVector<Type,TF,IT>
+   Rand< CompressedVector<Type,TF,IT> >::generate( size_t size, size_t nonzeros ) const
 {
    if( nonzeros > size )
       throw std::invalid_argument( "Invalid number of non-zero elements" );
 
-   CompressedVector<Type,TF> vector( size, nonzeros );
+   CompressedVector<Type,TF,IT> vector( size, nonzeros );
    randomize( vector, nonzeros );
 
    return vector;
@@ -157,12 +160,13 @@ inline const CompressedVector<Type,TF>
 // \return The generated random vector.
 */
 template< typename Type   // Data type of the vector
-        , bool TF >       // Transpose flag
+        , bool TF         // Transpose flag
+        , typename IT >   // Index type
 template< typename Arg >  // Min/max argument type
-inline const CompressedVector<Type,TF>
-   Rand< CompressedVector<Type,TF> >::generate( size_t size, const Arg& min, const Arg& max ) const
+inline const CompressedVector<Type,TF,IT>
+   Rand< CompressedVector<Type,TF,IT> >::generate( size_t size, const Arg& min, const Arg& max ) const
 {
-   CompressedVector<Type,TF> vector( size );
+   CompressedVector<Type,TF,IT> vector( size );
    randomize( vector, min, max );
 
    return vector;
@@ -183,15 +187,16 @@ inline const CompressedVector<Type,TF>
 // \exception std::invalid_argument Invalid number of non-zero elements.
 */
 template< typename Type   // Data type of the vector
-        , bool TF >       // Transpose flag
+        , bool TF         // Transpose flag
+        , typename IT >   // Index type
 template< typename Arg >  // Min/max argument type
-inline const CompressedVector<Type,TF>
-   Rand< CompressedVector<Type,TF> >::generate( size_t size, size_t nonzeros, const Arg& min, const Arg& max ) const
+inline const CompressedVector<Type,TF,IT>
+   Rand< CompressedVector<Type,TF,IT> >::generate( size_t size, size_t nonzeros, const Arg& min, const Arg& max ) const
 {
    if( nonzeros > size )
       throw std::invalid_argument( "Invalid number of non-zero elements" );
 
-   CompressedVector<Type,TF> vector( size, nonzeros );
+   CompressedVector<Type,TF,IT> vector( size, nonzeros );
    randomize( vector, nonzeros, min, max );
 
    return vector;
@@ -208,8 +213,9 @@ inline const CompressedVector<Type,TF>
 // \return void
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void Rand< CompressedVector<Type,TF> >::randomize( CompressedVector<Type,TF>& vector ) const
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void Rand< CompressedVector<Type,TF,IT> >::randomize( CompressedVector<Type,TF,IT>& vector ) const
 {
    const size_t size( vector.size() );
 
@@ -238,8 +244,9 @@ inline void Rand< CompressedVector<Type,TF> >::randomize( CompressedVector<Type,
 // \exception std::invalid_argument Invalid number of non-zero elements.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void Rand< CompressedVector<Type,TF> >::randomize( CompressedVector<Type,TF>& vector, size_t nonzeros ) const
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void Rand< CompressedVector<Type,TF,IT> >::randomize( CompressedVector<Type,TF,IT>& vector, size_t nonzeros ) const
 {
    const size_t size( vector.size() );
 
@@ -269,9 +276,10 @@ inline void Rand< CompressedVector<Type,TF> >::randomize( CompressedVector<Type,
 // \return void
 */
 template< typename Type   // Data type of the vector
-        , bool TF >       // Transpose flag
+        , bool TF         // Transpose flag
+        , typename IT >   // Index type
 template< typename Arg >  // Min/max argument type
-inline void Rand< CompressedVector<Type,TF> >::randomize( CompressedVector<Type,TF>& vector,
+inline void Rand< CompressedVector<Type,TF,IT> >::randomize( CompressedVector<Type,TF,IT>& vector,
                                                           const Arg& min, const Arg& max ) const
 {
    const size_t size( vector.size() );
@@ -303,9 +311,10 @@ inline void Rand< CompressedVector<Type,TF> >::randomize( CompressedVector<Type,
 // \exception std::invalid_argument Invalid number of non-zero elements.
 */
 template< typename Type   // Data type of the vector
-        , bool TF >       // Transpose flag
+        , bool TF         // Transpose flag
+        , typename IT >   // Index type
 template< typename Arg >  // Min/max argument type
-inline void Rand< CompressedVector<Type,TF> >::randomize( CompressedVector<Type,TF>& vector,
+inline void Rand< CompressedVector<Type,TF,IT> >::randomize( CompressedVector<Type,TF,IT>& vector,
                                                           size_t nonzeros, const Arg& min, const Arg& max ) const
 {
    const size_t size( vector.size() );
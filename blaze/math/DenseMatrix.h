@@ -41,6 +41,8 @@
 //*************************************************************************************************
 
 #include <blaze/math/dense/DenseMatrix.h>
+#include <blaze/math/dense/Determinant.h>
+#include <blaze/math/dense/Inversion.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/DMatAbsExpr.h>
 #include <blaze/math/expressions/DMatDMatAddExpr.h>
@@ -41,6 +41,8 @@
 //*************************************************************************************************
 
 #include <blaze/math/dense/DenseVector.h>
+#include <blaze/math/dense/FusedKernels.h>
+#include <blaze/math/dense/Fusion.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/DVecAbsExpr.h>
 #include <blaze/math/expressions/DVecDVecAddExpr.h>
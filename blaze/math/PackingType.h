@@ -0,0 +1,76 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/PackingType.h
+//  \brief Header file for the packing types of packed matrices
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_PACKINGTYPE_H_
+#define _BLAZE_MATH_PACKINGTYPE_H_
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PACKING TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Packing types of packed matrices.
+// \ingroup packed_matrix
+//
+// The packing type of a PackedMatrix specifies which elements of a square matrix are physically
+// stored. All elements outside of the stored part are either zero (lower, upper and diagonal
+// packing) or given by the mirrored element of the stored part (symmetric packing):
+
+   \code
+   using blaze::PackedMatrix;
+   using blaze::rowMajor;
+
+   PackedMatrix<double,blaze::packedLower,rowMajor>      A;  // Stores n*(n+1)/2 elements
+   PackedMatrix<double,blaze::packedUpper,rowMajor>      B;  // Stores n*(n+1)/2 elements
+   PackedMatrix<double,blaze::packedSymmetric,rowMajor>  C;  // Stores n*(n+1)/2 elements
+   PackedMatrix<double,blaze::packedDiagonal,rowMajor>   D;  // Stores n elements
+   \endcode
+*/
+enum PackingType
+{
+   packedLower     = 0,  //!< Packed storage of the lower part of a matrix.
+   packedUpper     = 1,  //!< Packed storage of the upper part of a matrix.
+   packedSymmetric = 2,  //!< Packed storage of one triangular part of a symmetric matrix.
+   packedDiagonal  = 3   //!< Packed storage of the diagonal of a matrix.
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -43,8 +43,13 @@
 #include <blaze/math/smp/DenseMatrix.h>
 #include <blaze/math/smp/DenseVector.h>
 #include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/FusedKernel.h>
+#include <blaze/math/smp/RangeKernel.h>
+#include <blaze/math/smp/Reduction.h>
+#include <blaze/math/smp/SellMatrix.h>
 #include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/smp/SparseMatrix.h>
 #include <blaze/math/smp/SparseVector.h>
+#include <blaze/math/smp/TripletBuilder.h>
 
 #endif
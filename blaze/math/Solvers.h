@@ -40,10 +40,23 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/solvers/BiCGSTAB.h>
 #include <blaze/math/solvers/CG.h>
+#include <blaze/math/solvers/CholeskyDecomposition.h>
 #include <blaze/math/solvers/CPG.h>
 #include <blaze/math/solvers/GaussianElimination.h>
+#include <blaze/math/solvers/GMRES.h>
+#include <blaze/math/solvers/IdentityPreconditioner.h>
+#include <blaze/math/solvers/IncompleteCholesky.h>
+#include <blaze/math/solvers/IncompleteLU.h>
+#include <blaze/math/solvers/JacobiPreconditioner.h>
 #include <blaze/math/solvers/Lemke.h>
+#include <blaze/math/solvers/LUDecomposition.h>
+#include <blaze/math/solvers/PCG.h>
 #include <blaze/math/solvers/PGS.h>
+#include <blaze/math/solvers/PipelinedCG.h>
+#include <blaze/math/solvers/QRDecomposition.h>
+#include <blaze/math/solvers/SSORPreconditioner.h>
+#include <blaze/math/solvers/WarmStart.h>
 
 #endif
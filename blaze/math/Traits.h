@@ -87,6 +87,7 @@
 #include <blaze/math/traits/DVecTransExprTrait.h>
 #include <blaze/math/traits/DVecTSVecMultExprTrait.h>
 #include <blaze/math/traits/EvalExprTrait.h>
+#include <blaze/math/traits/IndexTrait.h>
 #include <blaze/math/traits/MathTrait.h>
 #include <blaze/math/traits/MultExprTrait.h>
 #include <blaze/math/traits/MultTrait.h>
@@ -63,6 +63,9 @@
 #include <blaze/math/typetraits/RemoveAdaptor.h>
 #include <blaze/math/typetraits/Rows.h>
 #include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/FalseType.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/TrueType.h>
 
 
 namespace blaze {
@@ -348,10 +351,11 @@ struct IsRestricted< LowerMatrix<MT,SO,DF> > : public TrueType
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename MT, bool SO >
-struct HasConstDataAccess< LowerMatrix<MT,SO,true> > : public TrueType
+struct HasConstDataAccess< LowerMatrix<MT,SO,true> >
+   : public If< HasConstDataAccess<MT>, TrueType, FalseType >::Type
 {
-   enum { value = 1 };
-   typedef TrueType  Type;
+   enum { value = HasConstDataAccess<MT>::value };
+   typedef typename If< HasConstDataAccess<MT>, TrueType, FalseType >::Type  Type;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -461,16 +465,16 @@ struct AddTrait< DynamicMatrix<T,SO1>, LowerMatrix<MT,SO2,DF> >
    typedef typename AddTrait< DynamicMatrix<T,SO1>, MT >::Type  Type;
 };
 
-template< typename MT, bool SO1, bool DF, typename T, bool SO2 >
-struct AddTrait< LowerMatrix<MT,SO1,DF>, CompressedMatrix<T,SO2> >
+template< typename MT, bool SO1, bool DF, typename T, bool SO2, typename IT >
+struct AddTrait< LowerMatrix<MT,SO1,DF>, CompressedMatrix<T,SO2,IT> >
 {
-   typedef typename AddTrait< MT, CompressedMatrix<T,SO2> >::Type  Type;
+   typedef typename AddTrait< MT, CompressedMatrix<T,SO2,IT> >::Type  Type;
 };
 
-template< typename T, bool SO1, typename MT, bool SO2, bool DF >
-struct AddTrait< CompressedMatrix<T,SO1>, LowerMatrix<MT,SO2,DF> >
+template< typename T, bool SO1, typename MT, bool SO2, bool DF, typename IT >
+struct AddTrait< CompressedMatrix<T,SO1,IT>, LowerMatrix<MT,SO2,DF> >
 {
-   typedef typename AddTrait< CompressedMatrix<T,SO1>, MT >::Type  Type;
+   typedef typename AddTrait< CompressedMatrix<T,SO1,IT>, MT >::Type  Type;
 };
 
 template< typename MT1, bool SO1, bool DF1, typename MT2, bool SO2, bool DF2, bool NF >
@@ -540,16 +544,16 @@ struct SubTrait< DynamicMatrix<T,SO1>, LowerMatrix<MT,SO2,DF> >
    typedef typename SubTrait< DynamicMatrix<T,SO1>, MT >::Type  Type;
 };
 
-template< typename MT, bool SO1, bool DF, typename T, bool SO2 >
-struct SubTrait< LowerMatrix<MT,SO1,DF>, CompressedMatrix<T,SO2> >
+template< typename MT, bool SO1, bool DF, typename T, bool SO2, typename IT >
+struct SubTrait< LowerMatrix<MT,SO1,DF>, CompressedMatrix<T,SO2,IT> >
 {
-   typedef typename SubTrait< MT, CompressedMatrix<T,SO2> >::Type  Type;
+   typedef typename SubTrait< MT, CompressedMatrix<T,SO2,IT> >::Type  Type;
 };
 
-template< typename T, bool SO1, typename MT, bool SO2, bool DF >
-struct SubTrait< CompressedMatrix<T,SO1>, LowerMatrix<MT,SO2,DF> >
+template< typename T, bool SO1, typename MT, bool SO2, bool DF, typename IT >
+struct SubTrait< CompressedMatrix<T,SO1,IT>, LowerMatrix<MT,SO2,DF> >
 {
-   typedef typename SubTrait< CompressedMatrix<T,SO1>, MT >::Type  Type;
+   typedef typename SubTrait< CompressedMatrix<T,SO1,IT>, MT >::Type  Type;
 };
 
 template< typename MT1, bool SO1, bool DF1, typename MT2, bool SO2, bool DF2, bool NF >
@@ -633,16 +637,16 @@ struct MultTrait< DynamicVector<T,true>, LowerMatrix<MT,SO,DF> >
    typedef typename MultTrait< DynamicVector<T,true>, MT >::Type  Type;
 };
 
-template< typename MT, bool SO, bool DF, typename T >
-struct MultTrait< LowerMatrix<MT,SO,DF>, CompressedVector<T,false> >
+template< typename MT, bool SO, bool DF, typename T, typename IT >
+struct MultTrait< LowerMatrix<MT,SO,DF>, CompressedVector<T,false,IT> >
 {
-   typedef typename MultTrait< MT, CompressedVector<T,false> >::Type  Type;
+   typedef typename MultTrait< MT, CompressedVector<T,false,IT> >::Type  Type;
 };
 
-template< typename T, typename MT, bool SO, bool DF >
-struct MultTrait< CompressedVector<T,true>, LowerMatrix<MT,SO,DF> >
+template< typename T, typename MT, bool SO, bool DF, typename IT >
+struct MultTrait< CompressedVector<T,true,IT>, LowerMatrix<MT,SO,DF> >
 {
-   typedef typename MultTrait< CompressedVector<T,true>, MT >::Type  Type;
+   typedef typename MultTrait< CompressedVector<T,true,IT>, MT >::Type  Type;
 };
 
 template< typename MT, bool SO1, bool DF, typename T, size_t M, size_t N, bool SO2 >
@@ -681,16 +685,16 @@ struct MultTrait< DynamicMatrix<T,SO1>, LowerMatrix<MT,SO2,DF> >
    typedef typename MultTrait< DynamicMatrix<T,SO1>, MT >::Type  Type;
 };
 
-template< typename MT, bool SO1, bool DF, typename T, bool SO2 >
-struct MultTrait< LowerMatrix<MT,SO1,DF>, CompressedMatrix<T,SO2> >
+template< typename MT, bool SO1, bool DF, typename T, bool SO2, typename IT >
+struct MultTrait< LowerMatrix<MT,SO1,DF>, CompressedMatrix<T,SO2,IT> >
 {
-   typedef typename MultTrait< MT, CompressedMatrix<T,SO2> >::Type  Type;
+   typedef typename MultTrait< MT, CompressedMatrix<T,SO2,IT> >::Type  Type;
 };
 
-template< typename T, bool SO1, typename MT, bool SO2, bool DF >
-struct MultTrait< CompressedMatrix<T,SO1>, LowerMatrix<MT,SO2,DF> >
+template< typename T, bool SO1, typename MT, bool SO2, bool DF, typename IT >
+struct MultTrait< CompressedMatrix<T,SO1,IT>, LowerMatrix<MT,SO2,DF> >
 {
-   typedef typename MultTrait< CompressedMatrix<T,SO1>, MT >::Type  Type;
+   typedef typename MultTrait< CompressedMatrix<T,SO1,IT>, MT >::Type  Type;
 };
 
 template< typename MT1, bool SO1, bool DF1, typename MT2, bool SO2, bool DF2, bool NF >
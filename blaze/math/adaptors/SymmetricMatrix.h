@@ -63,6 +63,9 @@
 #include <blaze/math/typetraits/RemoveAdaptor.h>
 #include <blaze/math/typetraits/Rows.h>
 #include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/FalseType.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/TrueType.h>
 
 
 namespace blaze {
@@ -288,10 +291,11 @@ struct IsSymmetric< SymmetricMatrix<MT,SO,DF,NF> > : public TrueType
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename MT, bool SO, bool NF >
-struct HasConstDataAccess< SymmetricMatrix<MT,SO,true,NF> > : public TrueType
+struct HasConstDataAccess< SymmetricMatrix<MT,SO,true,NF> >
+   : public If< HasConstDataAccess<MT>, TrueType, FalseType >::Type
 {
-   enum { value = 1 };
-   typedef TrueType  Type;
+   enum { value = HasConstDataAccess<MT>::value };
+   typedef typename If< HasConstDataAccess<MT>, TrueType, FalseType >::Type  Type;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -402,16 +406,16 @@ struct AddTrait< DynamicMatrix<T,SO1>, SymmetricMatrix<MT,SO2,DF,NF> >
    typedef typename AddTrait< DynamicMatrix<T,SO1>, MT >::Type  Type;
 };
 
-template< typename MT, bool SO1, bool DF, bool NF, typename T, bool SO2 >
-struct AddTrait< SymmetricMatrix<MT,SO1,DF,NF>, CompressedMatrix<T,SO2> >
+template< typename MT, bool SO1, bool DF, bool NF, typename T, bool SO2, typename IT >
+struct AddTrait< SymmetricMatrix<MT,SO1,DF,NF>, CompressedMatrix<T,SO2,IT> >
 {
-   typedef typename AddTrait< MT, CompressedMatrix<T,SO2> >::Type  Type;
+   typedef typename AddTrait< MT, CompressedMatrix<T,SO2,IT> >::Type  Type;
 };
 
-template< typename T, bool SO1, typename MT, bool SO2, bool DF, bool NF >
-struct AddTrait< CompressedMatrix<T,SO1>, SymmetricMatrix<MT,SO2,DF,NF> >
+template< typename T, bool SO1, typename MT, bool SO2, bool DF, bool NF, typename IT >
+struct AddTrait< CompressedMatrix<T,SO1,IT>, SymmetricMatrix<MT,SO2,DF,NF> >
 {
-   typedef typename AddTrait< CompressedMatrix<T,SO1>, MT >::Type  Type;
+   typedef typename AddTrait< CompressedMatrix<T,SO1,IT>, MT >::Type  Type;
 };
 
 template< typename MT1, bool SO1, bool DF1, bool NF1, typename MT2, bool SO2, bool DF2, bool NF2 >
@@ -469,16 +473,16 @@ struct SubTrait< DynamicMatrix<T,SO1>, SymmetricMatrix<MT,SO2,DF,NF> >
    typedef typename SubTrait< DynamicMatrix<T,SO1>, MT >::Type  Type;
 };
 
-template< typename MT, bool SO1, bool DF, bool NF, typename T, bool SO2 >
-struct SubTrait< SymmetricMatrix<MT,SO1,DF,NF>, CompressedMatrix<T,SO2> >
+template< typename MT, bool SO1, bool DF, bool NF, typename T, bool SO2, typename IT >
+struct SubTrait< SymmetricMatrix<MT,SO1,DF,NF>, CompressedMatrix<T,SO2,IT> >
 {
-   typedef typename SubTrait< MT, CompressedMatrix<T,SO2> >::Type  Type;
+   typedef typename SubTrait< MT, CompressedMatrix<T,SO2,IT> >::Type  Type;
 };
 
-template< typename T, bool SO1, typename MT, bool SO2, bool DF, bool NF >
-struct SubTrait< CompressedMatrix<T,SO1>, SymmetricMatrix<MT,SO2,DF,NF> >
+template< typename T, bool SO1, typename MT, bool SO2, bool DF, bool NF, typename IT >
+struct SubTrait< CompressedMatrix<T,SO1,IT>, SymmetricMatrix<MT,SO2,DF,NF> >
 {
-   typedef typename SubTrait< CompressedMatrix<T,SO1>, MT >::Type  Type;
+   typedef typename SubTrait< CompressedMatrix<T,SO1,IT>, MT >::Type  Type;
 };
 
 template< typename MT1, bool SO1, bool DF1, bool NF1, typename MT2, bool SO2, bool DF2, bool NF2 >
@@ -550,16 +554,16 @@ struct MultTrait< DynamicVector<T,true>, SymmetricMatrix<MT,SO,DF,NF> >
    typedef typename MultTrait< DynamicVector<T,true>, MT >::Type  Type;
 };
 
-template< typename MT, bool SO, bool DF, bool NF, typename T >
-struct MultTrait< SymmetricMatrix<MT,SO,DF,NF>, CompressedVector<T,false> >
+template< typename MT, bool SO, bool DF, bool NF, typename T, typename IT >
+struct MultTrait< SymmetricMatrix<MT,SO,DF,NF>, CompressedVector<T,false,IT> >
 {
-   typedef typename MultTrait< MT, CompressedVector<T,false> >::Type  Type;
+   typedef typename MultTrait< MT, CompressedVector<T,false,IT> >::Type  Type;
 };
 
-template< typename T, typename MT, bool SO, bool DF, bool NF >
-struct MultTrait< CompressedVector<T,true>, SymmetricMatrix<MT,SO,DF,NF> >
+template< typename T, typename MT, bool SO, bool DF, bool NF, typename IT >
+struct MultTrait< CompressedVector<T,true,IT>, SymmetricMatrix<MT,SO,DF,NF> >
 {
-   typedef typename MultTrait< CompressedVector<T,true>, MT >::Type  Type;
+   typedef typename MultTrait< CompressedVector<T,true,IT>, MT >::Type  Type;
 };
 
 template< typename MT, bool SO1, bool DF, bool NF, typename T, size_t M, size_t N, bool SO2 >
@@ -598,16 +602,16 @@ struct MultTrait< DynamicMatrix<T,SO1>, SymmetricMatrix<MT,SO2,DF,NF> >
    typedef typename MultTrait< DynamicMatrix<T,SO1>, MT >::Type  Type;
 };
 
-template< typename MT, bool SO1, bool DF, bool NF, typename T, bool SO2 >
-struct MultTrait< SymmetricMatrix<MT,SO1,DF,NF>, CompressedMatrix<T,SO2> >
+template< typename MT, bool SO1, bool DF, bool NF, typename T, bool SO2, typename IT >
+struct MultTrait< SymmetricMatrix<MT,SO1,DF,NF>, CompressedMatrix<T,SO2,IT> >
 {
-   typedef typename MultTrait< MT, CompressedMatrix<T,SO2> >::Type  Type;
+   typedef typename MultTrait< MT, CompressedMatrix<T,SO2,IT> >::Type  Type;
 };
 
-template< typename T, bool SO1, typename MT, bool SO2, bool DF, bool NF >
-struct MultTrait< CompressedMatrix<T,SO1>, SymmetricMatrix<MT,SO2,DF,NF> >
+template< typename T, bool SO1, typename MT, bool SO2, bool DF, bool NF, typename IT >
+struct MultTrait< CompressedMatrix<T,SO1,IT>, SymmetricMatrix<MT,SO2,DF,NF> >
 {
-   typedef typename MultTrait< CompressedMatrix<T,SO1>, MT >::Type  Type;
+   typedef typename MultTrait< CompressedMatrix<T,SO1,IT>, MT >::Type  Type;
 };
 
 template< typename MT1, bool SO1, bool DF1, bool NF1, typename MT2, bool SO2, bool DF2, bool NF2 >
@@ -42,6 +42,7 @@
 
 #include <blaze/math/constraints/RequiresEvaluation.h>
 #include <blaze/math/constraints/Triangular.h>
+#include <blaze/math/dense/Reduction.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/Functions.h>
@@ -49,6 +50,7 @@
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/IsNaN.h>
 #include <blaze/math/shims/IsOne.h>
+#include <blaze/math/smp/Reduction.h>
 #include <blaze/math/StorageOrder.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsDiagonal.h>
@@ -611,6 +613,12 @@ const typename MT::ElementType min( const DenseMatrix<MT,SO>& dm );
 
 template< typename MT, bool SO >
 const typename MT::ElementType max( const DenseMatrix<MT,SO>& dm );
+
+template< typename MT, bool SO >
+const typename MT::ElementType sum( const DenseMatrix<MT,SO>& dm );
+
+template< typename MT, bool SO >
+const typename MT::ElementType prod( const DenseMatrix<MT,SO>& dm );
 //@}
 //*************************************************************************************************
 
@@ -639,24 +647,14 @@ template< typename MT  // Type of the dense matrix
         , bool SO >    // Storage order
 bool isnan( const DenseMatrix<MT,SO>& dm )
 {
+   typedef typename MT::ElementType    ET;
    typedef typename MT::CompositeType  CT;
 
    CT A( ~dm );  // Evaluation of the dense matrix operand
 
-   if( SO == rowMajor ) {
-      for( size_t i=0UL; i<A.rows(); ++i ) {
-         for( size_t j=0UL; j<A.columns(); ++j )
-            if( isnan( A(i,j) ) ) return true;
-      }
-   }
-   else {
-      for( size_t j=0UL; j<A.columns(); ++j ) {
-         for( size_t i=0UL; i<A.rows(); ++i )
-            if( isnan( A(i,j) ) ) return true;
-      }
-   }
+   if( A.rows() == 0UL || A.columns() == 0UL ) return false;
 
-   return false;
+   return smpReduce( A, NaNReduction<ET>() ) > 0UL;
 }
 //*************************************************************************************************
 
@@ -1601,8 +1599,6 @@ template< typename MT  // Type of the dense matrix
         , bool SO >    // Storage order
 const typename MT::ElementType min( const DenseMatrix<MT,SO>& dm )
 {
-   using blaze::min;
-
    typedef typename MT::ElementType    ET;
    typedef typename MT::CompositeType  CT;
 
@@ -1610,24 +1606,7 @@ const typename MT::ElementType min( const DenseMatrix<MT,SO>& dm )
 
    if( A.rows() == 0UL || A.columns() == 0UL ) return ET();
 
-   ET minimum( A(0,0) );
-
-   if( SO == rowMajor ) {
-      for( size_t j=1UL; j<A.columns(); ++j )
-         minimum = min( minimum, A(0UL,j) );
-      for( size_t i=1UL; i<A.rows(); ++i )
-         for( size_t j=0UL; j<A.columns(); ++j )
-            minimum = min( minimum, A(i,j) );
-   }
-   else {
-      for( size_t i=1UL; i<A.rows(); ++i )
-         minimum = min( minimum, A(i,0UL) );
-      for( size_t j=1UL; j<A.columns(); ++j )
-         for( size_t i=0UL; i<A.rows(); ++i )
-            minimum = min( minimum, A(i,j) );
-   }
-
-   return minimum;
+   return smpReduce( A, MinReduction<ET>() );
 }
 //*************************************************************************************************
 
@@ -1648,8 +1627,45 @@ template< typename MT  // Type of the dense matrix
         , bool SO >    // Transpose flag
 const typename MT::ElementType max( const DenseMatrix<MT,SO>& dm )
 {
-   using blaze::max;
+   typedef typename MT::ElementType    ET;
+   typedef typename MT::CompositeType  CT;
+
+   CT A( ~dm );  // Evaluation of the dense matrix operand
+
+   if( A.rows() == 0UL || A.columns() == 0UL ) return ET();
+
+   return smpReduce( A, MaxReduction<ET>() );
+}
+//*************************************************************************************************
 
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given dense matrix by means of addition.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \return The sum of all elements of the dense matrix.
+//
+// This function computes the sum of all elements of the given dense matrix. It can be used for
+// both dense matrices and dense matrix expressions:
+
+   \code
+   blaze::DynamicMatrix<double> A, B;
+   // ... Resizing and initialization
+   const double s1 = sum( A );
+   const double s2 = sum( A + B );
+   \endcode
+
+// In case the matrix currently has either 0 rows or 0 columns, the returned value is the default
+// value (e.g. 0 in case of fundamental data types). Note that due to the vectorized and parallel
+// evaluation the order of the additions differs from a sequential summation and that therefore
+// the result for floating point elements can slightly differ from a sequential sum.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+const typename MT::ElementType sum( const DenseMatrix<MT,SO>& dm )
+{
    typedef typename MT::ElementType    ET;
    typedef typename MT::CompositeType  CT;
 
@@ -1657,24 +1673,34 @@ const typename MT::ElementType max( const DenseMatrix<MT,SO>& dm )
 
    if( A.rows() == 0UL || A.columns() == 0UL ) return ET();
 
-   ET maximum( A(0,0) );
+   return smpReduce( A, SumReduction<ET>() );
+}
+//*************************************************************************************************
 
-   if( SO == rowMajor ) {
-      for( size_t j=1UL; j<A.columns(); ++j )
-         maximum = max( maximum, A(0UL,j) );
-      for( size_t i=1UL; i<A.rows(); ++i )
-         for( size_t j=0UL; j<A.columns(); ++j )
-            maximum = max( maximum, A(i,j) );
-   }
-   else {
-      for( size_t i=1UL; i<A.rows(); ++i )
-         maximum = max( maximum, A(i,0UL) );
-      for( size_t j=1UL; j<A.columns(); ++j )
-         for( size_t i=0UL; i<A.rows(); ++i )
-            maximum = max( maximum, A(i,j) );
-   }
 
-   return maximum;
+//*************************************************************************************************
+/*!\brief Reduces the given dense matrix by means of multiplication.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \return The product of all elements of the dense matrix.
+//
+// This function computes the product of all elements of the given dense matrix. It can be used
+// for both dense matrices and dense matrix expressions. In case the matrix currently has either
+// 0 rows or 0 columns, the returned value is 1.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+const typename MT::ElementType prod( const DenseMatrix<MT,SO>& dm )
+{
+   typedef typename MT::ElementType    ET;
+   typedef typename MT::CompositeType  CT;
+
+   CT A( ~dm );  // Evaluation of the dense matrix operand
+
+   if( A.rows() == 0UL || A.columns() == 0UL ) return ET( 1 );
+
+   return smpReduce( A, ProdReduction<ET>() );
 }
 //*************************************************************************************************
 
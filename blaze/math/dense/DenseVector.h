@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <cmath>
+#include <blaze/math/dense/Reduction.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/SparseVector.h>
 #include <blaze/math/Functions.h>
@@ -48,6 +49,7 @@
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/IsNaN.h>
 #include <blaze/math/shims/Square.h>
+#include <blaze/math/smp/Reduction.h>
 #include <blaze/math/traits/CMathTrait.h>
 #include <blaze/math/TransposeFlag.h>
 #include <blaze/util/Assert.h>
@@ -388,6 +390,12 @@ const typename VT::ElementType min( const DenseVector<VT,TF>& dv );
 
 template< typename VT, bool TF >
 const typename VT::ElementType max( const DenseVector<VT,TF>& dv );
+
+template< typename VT, bool TF >
+const typename VT::ElementType sum( const DenseVector<VT,TF>& dv );
+
+template< typename VT, bool TF >
+const typename VT::ElementType prod( const DenseVector<VT,TF>& dv );
 //@}
 //*************************************************************************************************
 
@@ -416,14 +424,14 @@ template< typename VT  // Type of the dense vector
         , bool TF >    // Transpose flag
 bool isnan( const DenseVector<VT,TF>& dv )
 {
+   typedef typename VT::ElementType    ET;
    typedef typename VT::CompositeType  CT;
 
    CT a( ~dv );  // Evaluation of the dense vector operand
 
-   for( size_t i=0UL; i<a.size(); ++i ) {
-      if( isnan( a[i] ) ) return true;
-   }
-   return false;
+   if( a.size() == 0UL ) return false;
+
+   return smpReduce( a, NaNReduction<ET>() ) > 0UL;
 }
 //*************************************************************************************************
 
@@ -458,18 +466,18 @@ template< typename VT  // Type of the dense vector
         , bool TF >    // Transpose flag
 bool isUniform( const DenseVector<VT,TF>& dv )
 {
+   typedef typename VT::ElementType    ET;
    typedef typename VT::CompositeType  CT;
-   typedef typename RemoveReference<CT>::Type::ConstReference  ConstReference;
 
    if( (~dv).size() < 2UL )
       return true;
 
    CT a( ~dv );  // Evaluation of the dense vector operand
 
-   ConstReference cmp( (~dv)[0UL] );
+   const ET cmp( a[0UL] );
 
-   for( size_t i=1UL; i<(~dv).size(); ++i ) {
-      if( (~dv)[i] != cmp )
+   for( size_t i=1UL; i<a.size(); ++i ) {
+      if( a[i] != cmp )
          return false;
    }
 
@@ -516,14 +524,16 @@ template< typename VT  // Type of the dense vector
 typename CMathTrait<typename VT::ElementType>::Type length( const DenseVector<VT,TF>& dv )
 {
    typedef typename VT::ElementType                ElementType;
+   typedef typename VT::CompositeType              CT;
    typedef typename CMathTrait<ElementType>::Type  LengthType;
 
    BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ElementType );
 
-   LengthType sum( 0 );
-   for( size_t i=0UL; i<(~dv).size(); ++i )
-      sum += sq( (~dv)[i] );
-   return std::sqrt( sum );
+   CT a( ~dv );  // Evaluation of the dense vector operand
+
+   if( a.size() == 0UL ) return LengthType( 0 );
+
+   return std::sqrt( smpReduce( a, SqrSumReduction<ElementType,LengthType>() ) );
 }
 //*************************************************************************************************
 
@@ -545,14 +555,16 @@ template< typename VT  // Type of the dense vector
         , bool TF >    // Transpose flag
 const typename VT::ElementType sqrLength( const DenseVector<VT,TF>& dv )
 {
-   typedef typename VT::ElementType  ElementType;
+   typedef typename VT::ElementType    ElementType;
+   typedef typename VT::CompositeType  CT;
 
    BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ElementType );
 
-   ElementType sum( 0 );
-   for( size_t i=0UL; i<(~dv).size(); ++i )
-      sum += sq( (~dv)[i] );
-   return sum;
+   CT a( ~dv );  // Evaluation of the dense vector operand
+
+   if( a.size() == 0UL ) return ElementType( 0 );
+
+   return smpReduce( a, SqrSumReduction<ElementType>() );
 }
 //*************************************************************************************************
 
@@ -573,8 +585,6 @@ template< typename VT  // Type of the dense vector
         , bool TF >    // Transpose flag
 const typename VT::ElementType min( const DenseVector<VT,TF>& dv )
 {
-   using blaze::min;
-
    typedef typename VT::ElementType    ET;
    typedef typename VT::CompositeType  CT;
 
@@ -582,10 +592,7 @@ const typename VT::ElementType min( const DenseVector<VT,TF>& dv )
 
    if( a.size() == 0UL ) return ET();
 
-   ET minimum( a[0] );
-   for( size_t i=1UL; i<a.size(); ++i )
-      minimum = min( minimum, a[i] );
-   return minimum;
+   return smpReduce( a, MinReduction<ET>() );
 }
 //*************************************************************************************************
 
@@ -606,8 +613,46 @@ template< typename VT  // Type of the dense vector
         , bool TF >    // Transpose flag
 const typename VT::ElementType max( const DenseVector<VT,TF>& dv )
 {
-   using blaze::max;
+   typedef typename VT::ElementType    ET;
+   typedef typename VT::CompositeType  CT;
+
+   CT a( ~dv );  // Evaluation of the dense vector operand
+
+   if( a.size() == 0UL ) return ET();
+
+   return smpReduce( a, MaxReduction<ET>() );
+}
+//*************************************************************************************************
+
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given dense vector by means of addition.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \return The sum of all elements of the dense vector.
+//
+// This function computes the sum of all elements of the given dense vector. It can be used for
+// both dense vectors and dense vector expressions, in which case the elements of the expression
+// are computed on the fly if possible:
 
+   \code
+   blaze::DynamicVector<double> a, b;
+   // ... Resizing and initialization
+   const double s1 = sum( a );
+   const double s2 = sum( a * 2.0 + b );
+   \endcode
+
+// In case the vector currently has a size of 0, the returned value is the default value (e.g. 0
+// in case of fundamental data types). Note that due to the vectorized and parallel evaluation
+// the order of the additions differs from a sequential summation and that therefore the result
+// for floating point elements can slightly differ from a sequential sum.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+const typename VT::ElementType sum( const DenseVector<VT,TF>& dv )
+{
    typedef typename VT::ElementType    ET;
    typedef typename VT::CompositeType  CT;
 
@@ -615,10 +660,42 @@ const typename VT::ElementType max( const DenseVector<VT,TF>& dv )
 
    if( a.size() == 0UL ) return ET();
 
-   ET maximum( a[0] );
-   for( size_t i=1UL; i<a.size(); ++i )
-      maximum = max( maximum, a[i] );
-   return maximum;
+   return smpReduce( a, SumReduction<ET>() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given dense vector by means of multiplication.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \return The product of all elements of the dense vector.
+//
+// This function computes the product of all elements of the given dense vector. It can be used
+// for both dense vectors and dense vector expressions:
+
+   \code
+   blaze::DynamicVector<double> a, b;
+   // ... Resizing and initialization
+   const double p1 = prod( a );
+   const double p2 = prod( a + b );
+   \endcode
+
+// In case the vector currently has a size of 0, the returned value is 1.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+const typename VT::ElementType prod( const DenseVector<VT,TF>& dv )
+{
+   typedef typename VT::ElementType    ET;
+   typedef typename VT::CompositeType  CT;
+
+   CT a( ~dv );  // Evaluation of the dense vector operand
+
+   if( a.size() == 0UL ) return ET( 1 );
+
+   return smpReduce( a, ProdReduction<ET>() );
 }
 //*************************************************************************************************
 
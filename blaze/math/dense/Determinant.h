@@ -0,0 +1,288 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Determinant.h
+//  \brief Header file for the dense matrix determinant
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_DETERMINANT_H_
+#define _BLAZE_MATH_DENSE_DETERMINANT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <stdexcept>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/solvers/LUDecomposition.h>
+#include <blaze/math/typetraits/IsStrictlyTriangular.h>
+#include <blaze/math/typetraits/IsTriangular.h>
+#include <blaze/math/typetraits/IsUniTriangular.h>
+#include <blaze/util/constraints/FloatingPoint.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name DenseMatrix determinant functions */
+//@{
+template< typename MT, bool SO >
+inline typename MT::ElementType det( const DenseMatrix<MT,SO>& dm );
+//@}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DETERMINANT KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the determinant of the given general \f$ 2 \times 2 \f$ dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The \f$ 2 \times 2 \f$ dense matrix.
+// \return The determinant of the given matrix.
+*/
+template< typename MT >  // Type of the dense matrix
+typename MT::ElementType det2x2( const MT& A )
+{
+   return A(0,0)*A(1,1) - A(0,1)*A(1,0);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the determinant of the given general \f$ 3 \times 3 \f$ dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The \f$ 3 \times 3 \f$ dense matrix.
+// \return The determinant of the given matrix.
+*/
+template< typename MT >  // Type of the dense matrix
+typename MT::ElementType det3x3( const MT& A )
+{
+   return A(0,0) * ( A(1,1)*A(2,2) - A(1,2)*A(2,1) )
+        + A(0,1) * ( A(1,2)*A(2,0) - A(1,0)*A(2,2) )
+        + A(0,2) * ( A(1,0)*A(2,1) - A(1,1)*A(2,0) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the determinant of the given general \f$ N \times N \f$ dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The \f$ N \times N \f$ dense matrix.
+// \return The determinant of the given matrix.
+//
+// This function computes the determinant of small matrices of compile time size \a N by means
+// of a Gaussian elimination with partial pivoting on a local array. Since all loop bounds are
+// compile time constants the loops are completely unrolled by the compiler.
+*/
+template< size_t N       // Number of rows and columns of the matrix
+        , typename MT >  // Type of the dense matrix
+typename MT::ElementType detNxN( const MT& A )
+{
+   using std::abs;
+   using std::swap;
+
+   typedef typename MT::ElementType  ET;
+
+   ET a[N][N];
+
+   for( size_t i=0UL; i<N; ++i )
+      for( size_t j=0UL; j<N; ++j )
+         a[i][j] = A(i,j);
+
+   ET det( 1 );
+
+   for( size_t k=0UL; k<N; ++k )
+   {
+      size_t pivot( k );
+      for( size_t i=k+1UL; i<N; ++i ) {
+         if( abs( a[i][k] ) > abs( a[pivot][k] ) )
+            pivot = i;
+      }
+
+      if( isDefault( a[pivot][k] ) )
+         return ET(0);
+
+      if( pivot != k ) {
+         for( size_t j=k; j<N; ++j )
+            swap( a[k][j], a[pivot][j] );
+         det = -det;
+      }
+
+      det *= a[k][k];
+
+      const ET inv( ET(1) / a[k][k] );
+
+      for( size_t i=k+1UL; i<N; ++i ) {
+         const ET factor( a[i][k] * inv );
+         for( size_t j=k+1UL; j<N; ++j )
+            a[i][j] -= factor * a[k][j];
+      }
+   }
+
+   return det;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the determinant of the given general dense matrix by means of an LU
+//        decomposition.
+// \ingroup dense_matrix
+//
+// \param A The dense matrix.
+// \return The determinant of the given matrix.
+*/
+template< typename MT >  // Type of the dense matrix
+typename MT::ElementType detByLU( const MT& A )
+{
+   typedef typename MT::ElementType  ET;
+
+   LUDecomposition<ET> lu;
+
+   try {
+      lu.factorize( A );
+   }
+   catch( std::invalid_argument& ) {
+      return ET(0);
+   }
+
+   return lu.determinant();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computation of the determinant of the given dense square matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \return The determinant of the given matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This function computes the determinant of the given dense square matrix:
+
+   \code
+   blaze::StaticMatrix<double,3UL,3UL> A;
+   blaze::DynamicMatrix<double> B;
+   // ... Resizing and initialization
+
+   const double d1 = det( A );  // Closed form for 3x3 matrices
+   const double d2 = det( B );  // LU decomposition for large matrices
+   \endcode
+
+// The determinant of triangular and diagonal matrices (LowerMatrix, UpperMatrix, DiagonalMatrix,
+// ...) is computed as the product of the diagonal elements. The determinant of general matrices
+// up to a size of \f$ 6 \times 6 \f$ is computed by closed form and unrolled kernels, the
+// determinant of larger matrices by means of a blocked LU decomposition. In case the given
+// matrix is not a square matrix, a \a std::invalid_argument exception is thrown. Note that the
+// element type of the matrix must be a built-in floating point data type.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline typename MT::ElementType det( const DenseMatrix<MT,SO>& dm )
+{
+   typedef typename MT::ElementType    ET;
+   typedef typename MT::CompositeType  CT;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( ET );
+
+   if( !isSquare( ~dm ) )
+      throw std::invalid_argument( "Invalid non-square matrix provided" );
+
+   const size_t n( (~dm).rows() );
+
+   if( n == 0UL )
+      return ET(1);
+
+   if( IsStrictlyTriangular<MT>::value )
+      return ET(0);
+
+   if( IsUniTriangular<MT>::value )
+      return ET(1);
+
+   CT A( ~dm );  // Evaluation of the dense matrix operand
+
+   if( IsTriangular<MT>::value ) {
+      ET product( A(0,0) );
+      for( size_t i=1UL; i<n; ++i )
+         product *= A(i,i);
+      return product;
+   }
+
+   switch( n ) {
+      case 1UL: return A(0,0);
+      case 2UL: return det2x2( A );
+      case 3UL: return det3x3( A );
+      case 4UL: return detNxN<4UL>( A );
+      case 5UL: return detNxN<5UL>( A );
+      case 6UL: return detNxN<6UL>( A );
+      default : return detByLU( A );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -73,6 +73,7 @@
 #include <blaze/system/CacheSize.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/Restrict.h>
+#include <blaze/system/Standard.h>
 #include <blaze/system/StorageOrder.h>
 #include <blaze/system/Streaming.h>
 #include <blaze/system/Thresholds.h>
@@ -246,6 +247,10 @@ class DynamicMatrix : public DenseMatrix< DynamicMatrix<Type,SO>, SO >
 
                                      inline DynamicMatrix( const DynamicMatrix& m );
    template< typename MT, bool SO2 > inline DynamicMatrix( const Matrix<MT,SO2>& m );
+
+#if BLAZE_CPP11_MODE
+   inline DynamicMatrix( DynamicMatrix&& m ) noexcept;
+#endif
    //@}
    //**********************************************************************************************
 
@@ -294,6 +299,10 @@ class DynamicMatrix : public DenseMatrix< DynamicMatrix<Type,SO>, SO >
    template< typename Other >
    inline typename EnableIf< IsNumeric<Other>, DynamicMatrix >::Type&
       operator/=( Other rhs );
+
+#if BLAZE_CPP11_MODE
+   inline DynamicMatrix& operator=( DynamicMatrix&& rhs ) noexcept;
+#endif
    //@}
    //**********************************************************************************************
 
@@ -679,6 +688,34 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( const Matrix<MT,SO2>& m )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+#if BLAZE_CPP11_MODE
+/*!\brief The move constructor for DynamicMatrix.
+//
+// \param m The matrix to be moved into this instance.
+//
+// The new matrix takes over the dynamically allocated elements of the given matrix, which is
+// left empty. No element is copied. This constructor is only available in C++11 mode.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline DynamicMatrix<Type,SO>::DynamicMatrix( DynamicMatrix&& m ) noexcept
+   : m_       ( m.m_ )         // The current number of rows of the matrix
+   , n_       ( m.n_ )         // The current number of columns of the matrix
+   , nn_      ( m.nn_ )        // The alignment adjusted number of columns
+   , capacity_( m.capacity_ )  // The maximum capacity of the matrix
+   , v_       ( m.v_ )         // The matrix elements
+{
+   m.m_        = 0UL;
+   m.n_        = 0UL;
+   m.nn_       = 0UL;
+   m.capacity_ = 0UL;
+   m.v_        = NULL;
+}
+#endif
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -1044,6 +1081,43 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator=( const DynamicM
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+#if BLAZE_CPP11_MODE
+/*!\brief Move assignment operator for DynamicMatrix.
+//
+// \param rhs The matrix to be moved into this instance.
+// \return Reference to the assigned matrix.
+//
+// The matrix releases its current elements and takes over the dynamically allocated elements
+// of the given matrix, which is left empty. No element is copied. This operator is only
+// available in C++11 mode.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator=( DynamicMatrix&& rhs ) noexcept
+{
+   if( &rhs == this ) return *this;
+
+   deallocate( v_ );
+
+   m_        = rhs.m_;
+   n_        = rhs.n_;
+   nn_       = rhs.nn_;
+   capacity_ = rhs.capacity_;
+   v_        = rhs.v_;
+
+   rhs.m_        = 0UL;
+   rhs.n_        = 0UL;
+   rhs.nn_       = 0UL;
+   rhs.capacity_ = 0UL;
+   rhs.v_        = NULL;
+
+   return *this;
+}
+#endif
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Assignment operator for different matrices.
 //
@@ -1694,7 +1768,7 @@ template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline bool DynamicMatrix<Type,SO>::canSMPAssign() const
 {
-   return ( rows() > SMP_DMATASSIGN_THRESHOLD );
+   return ( rows() > getThreshold( smpDMatAssignThreshold ) );
 }
 //*************************************************************************************************
 
@@ -2550,6 +2624,10 @@ class DynamicMatrix<Type,true> : public DenseMatrix< DynamicMatrix<Type,true>, t
 
                                     inline DynamicMatrix( const DynamicMatrix& m );
    template< typename MT, bool SO > inline DynamicMatrix( const Matrix<MT,SO>& m );
+
+#if BLAZE_CPP11_MODE
+   inline DynamicMatrix( DynamicMatrix&& m ) noexcept;
+#endif
    //@}
    //**********************************************************************************************
 
@@ -2598,6 +2676,10 @@ class DynamicMatrix<Type,true> : public DenseMatrix< DynamicMatrix<Type,true>, t
    template< typename Other >
    inline typename EnableIf< IsNumeric<Other>, DynamicMatrix >::Type&
       operator/=( Other rhs );
+
+#if BLAZE_CPP11_MODE
+   inline DynamicMatrix& operator=( DynamicMatrix&& rhs ) noexcept;
+#endif
    //@}
    //**********************************************************************************************
 
@@ -2983,6 +3065,35 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( const Matrix<MT,SO>& m )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+#if BLAZE_CPP11_MODE
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The move constructor for DynamicMatrix.
+//
+// \param m The matrix to be moved into this instance.
+//
+// The new matrix takes over the dynamically allocated elements of the given matrix, which is
+// left empty. No element is copied. This constructor is only available in C++11 mode.
+*/
+template< typename Type >  // Data type of the matrix
+inline DynamicMatrix<Type,true>::DynamicMatrix( DynamicMatrix&& m ) noexcept
+   : m_       ( m.m_ )         // The current number of rows of the matrix
+   , mm_      ( m.mm_ )        // The alignment adjusted number of rows
+   , n_       ( m.n_ )         // The current number of columns of the matrix
+   , capacity_( m.capacity_ )  // The maximum capacity of the matrix
+   , v_       ( m.v_ )         // The matrix elements
+{
+   m.m_        = 0UL;
+   m.mm_       = 0UL;
+   m.n_        = 0UL;
+   m.capacity_ = 0UL;
+   m.v_        = NULL;
+}
+/*! \endcond */
+#endif
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -3332,6 +3443,44 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator=( const Dyna
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+#if BLAZE_CPP11_MODE
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Move assignment operator for DynamicMatrix.
+//
+// \param rhs The matrix to be moved into this instance.
+// \return Reference to the assigned matrix.
+//
+// The matrix releases its current elements and takes over the dynamically allocated elements
+// of the given matrix, which is left empty. No element is copied. This operator is only
+// available in C++11 mode.
+*/
+template< typename Type >  // Data type of the matrix
+inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator=( DynamicMatrix&& rhs ) noexcept
+{
+   if( &rhs == this ) return *this;
+
+   deallocate( v_ );
+
+   m_        = rhs.m_;
+   mm_       = rhs.mm_;
+   n_        = rhs.n_;
+   capacity_ = rhs.capacity_;
+   v_        = rhs.v_;
+
+   rhs.m_        = 0UL;
+   rhs.mm_       = 0UL;
+   rhs.n_        = 0UL;
+   rhs.capacity_ = 0UL;
+   rhs.v_        = NULL;
+
+   return *this;
+}
+/*! \endcond */
+#endif
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Assignment operator for different matrices.
@@ -3994,7 +4143,7 @@ inline bool DynamicMatrix<Type,true>::isAligned() const
 template< typename Type >  // Data type of the matrix
 inline bool DynamicMatrix<Type,true>::canSMPAssign() const
 {
-   return ( columns() > SMP_DMATASSIGN_THRESHOLD );
+   return ( columns() > getThreshold( smpDMatAssignThreshold ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -5204,14 +5353,14 @@ struct MultTrait< DynamicVector<T1,true>, DynamicMatrix<T2,SO> >
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct MultTrait< DynamicMatrix<T1,SO>, CompressedVector<T2,false> >
+template< typename T1, bool SO, typename T2, typename IT >
+struct MultTrait< DynamicMatrix<T1,SO>, CompressedVector<T2,false,IT> >
 {
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
 };
 
-template< typename T1, typename T2, bool SO >
-struct MultTrait< CompressedVector<T1,true>, DynamicMatrix<T2,SO> >
+template< typename T1, typename T2, bool SO, typename IT >
+struct MultTrait< CompressedVector<T1,true,IT>, DynamicMatrix<T2,SO> >
 {
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
 };
@@ -65,6 +65,7 @@
 #include <blaze/system/CacheSize.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/Restrict.h>
+#include <blaze/system/Standard.h>
 #include <blaze/system/Streaming.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/system/TransposeFlag.h>
@@ -221,6 +222,10 @@ class DynamicVector : public DenseVector< DynamicVector<Type,TF>, TF >
 
                            inline DynamicVector( const DynamicVector& v );
    template< typename VT > inline DynamicVector( const Vector<VT,TF>& v );
+
+#if BLAZE_CPP11_MODE
+   inline DynamicVector( DynamicVector&& v ) noexcept;
+#endif
    //@}
    //**********************************************************************************************
 
@@ -267,6 +272,10 @@ class DynamicVector : public DenseVector< DynamicVector<Type,TF>, TF >
    template< typename Other >
    inline typename EnableIf< IsNumeric<Other>, DynamicVector >::Type&
       operator/=( Other rhs );
+
+#if BLAZE_CPP11_MODE
+   inline DynamicVector& operator=( DynamicVector&& rhs ) noexcept;
+#endif
    //@}
    //**********************************************************************************************
 
@@ -619,6 +628,30 @@ inline DynamicVector<Type,TF>::DynamicVector( const Vector<VT,TF>& v )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+#if BLAZE_CPP11_MODE
+/*!\brief The move constructor for DynamicVector.
+//
+// \param v The vector to be moved into this instance.
+//
+// The new vector takes over the dynamically allocated elements of the given vector, which is
+// left empty. No element is copied. This constructor is only available in C++11 mode.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline DynamicVector<Type,TF>::DynamicVector( DynamicVector&& v ) noexcept
+   : size_    ( v.size_ )      // The current size/dimension of the vector
+   , capacity_( v.capacity_ )  // The maximum capacity of the vector
+   , v_       ( v.v_ )         // The vector elements
+{
+   v.size_     = 0UL;
+   v.capacity_ = 0UL;
+   v.v_        = NULL;
+}
+#endif
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -879,6 +912,39 @@ inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator=( const DynamicV
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+#if BLAZE_CPP11_MODE
+/*!\brief Move assignment operator for DynamicVector.
+//
+// \param rhs The vector to be moved into this instance.
+// \return Reference to the assigned vector.
+//
+// The vector releases its current elements and takes over the dynamically allocated elements
+// of the given vector, which is left empty. No element is copied. This operator is only
+// available in C++11 mode.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator=( DynamicVector&& rhs ) noexcept
+{
+   if( &rhs == this ) return *this;
+
+   deallocate( v_ );
+
+   size_     = rhs.size_;
+   capacity_ = rhs.capacity_;
+   v_        = rhs.v_;
+
+   rhs.size_     = 0UL;
+   rhs.capacity_ = 0UL;
+   rhs.v_        = NULL;
+
+   return *this;
+}
+#endif
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Assignment operator for different vectors.
 //
@@ -1392,7 +1458,7 @@ template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
 inline bool DynamicVector<Type,TF>::canSMPAssign() const
 {
-   return ( size() > SMP_DVECASSIGN_THRESHOLD );
+   return ( size() > getThreshold( smpDVecAssignThreshold ) );
 }
 //*************************************************************************************************
 
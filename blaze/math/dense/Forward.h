@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/PackingType.h>
 #include <blaze/util/Types.h>
 
 
@@ -51,10 +52,14 @@ namespace blaze {
 //
 //=================================================================================================
 
+template< typename, bool, bool, bool > class CustomMatrix;
+template< typename, bool, bool, bool > class CustomVector;
 template< typename, bool > class DynamicVector;
 template< typename, bool > class DynamicMatrix;
 template< typename, size_t, size_t, bool > class HybridMatrix;
 template< typename, size_t, bool > class HybridVector;
+template< typename, bool > class MappedMatrix;
+template< typename, PackingType, bool > class PackedMatrix;
 template< typename, size_t, size_t, bool > class StaticMatrix;
 template< typename, size_t, bool > class StaticVector;
 
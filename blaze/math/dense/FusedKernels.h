@@ -0,0 +1,840 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/FusedKernels.h
+//  \brief Header file for the fused dense vector kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_FUSEDKERNELS_H_
+#define _BLAZE_MATH_DENSE_FUSEDKERNELS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <stdexcept>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/smp/FusedKernel.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY CLASS DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the selection of the vectorized fused vector kernels.
+// \ingroup dense
+//
+// In case all given dense vector types are vectorizable, have the same floating point element
+// type and the required intrinsic operations are available, \a value is set to 1 and the
+// vectorized fused kernel is selected. Otherwise \a value is set to 0 and the default kernel
+// is chosen.
+*/
+template< typename T1       // Type of the first dense vector
+        , typename T2       // Type of the second dense vector
+        , typename T3       // Type of the third dense vector
+        , typename T4       // Type of the fourth dense vector
+        , typename T5=T4 >  // Type of the fifth dense vector
+struct UseVectorizedFusedKernel
+{
+   typedef typename T1::ElementType  ET;
+   typedef IntrinsicTrait<ET>        IT;
+
+   enum { value = T1::vectorizable && T2::vectorizable && T3::vectorizable &&
+                  T4::vectorizable && T5::vectorizable &&
+                  IsSame<ET,typename T2::ElementType>::value &&
+                  IsSame<ET,typename T3::ElementType>::value &&
+                  IsSame<ET,typename T4::ElementType>::value &&
+                  IsSame<ET,typename T5::ElementType>::value &&
+                  IsFloatingPoint<ET>::value &&
+                  IT::addition && IT::subtraction && IT::multiplication && IT::maximum };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partial result of a fused kernel computing the squared Euclidean and the maximum norm.
+// \ingroup dense
+*/
+template< typename T >  // Type of the norms
+struct FusedNorms
+{
+   T sqrNorm;  //!< The squared Euclidean norm.
+   T maxNorm;  //!< The maximum norm.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  RANGE KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused sparse matrix/dense vector multiplication and scalar product for a range of rows.
+// \ingroup dense
+//
+// \param y The target vector of the multiplication.
+// \param A The row-major sparse matrix.
+// \param x The dense vector operand.
+// \param begin The index of the first row of the range.
+// \param end The index one past the last row of the range.
+// \return The partial scalar product of \a x and \a y for the range of rows.
+//
+// This function computes \f$ y = A \cdot x \f$ for the range of rows [\a begin, \a end) and
+// accumulates the scalar product \f$ x^T \cdot y \f$ while the computed element of \a y is
+// still held in a register.
+*/
+template< typename VT1    // Type of the target vector
+        , typename MT     // Type of the row-major sparse matrix
+        , typename VT2 >  // Type of the dense vector operand
+inline typename VT1::ElementType
+   multDotRange( VT1& y, const MT& A, const VT2& x, size_t begin, size_t end )
+{
+   typedef typename VT1::ElementType  ET;
+   typedef typename MT::ConstIterator  ConstIterator;
+
+   ET result = ET();
+
+   for( size_t i=begin; i<end; ++i )
+   {
+      ET tmp = ET();
+      const ConstIterator last( A.end(i) );
+      for( ConstIterator element=A.begin(i); element!=last; ++element ) {
+         tmp += element->value() * x[element->index()];
+      }
+      y[i] = tmp;
+      result += x[i] * tmp;
+   }
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default fused double AXPY update and norm computation for a range of elements.
+// \ingroup dense
+//
+// \param x The first target vector.
+// \param alpha The scalar factor of the first update.
+// \param p The dense vector operand of the first update.
+// \param r The second target vector.
+// \param beta The scalar factor of the second update.
+// \param q The dense vector operand of the second update.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
+// \return The partial squared Euclidean and maximum norms of the updated vector \a r.
+//
+// This function performs the updates \f$ x += \alpha \cdot p \f$ and \f$ r += \beta \cdot q \f$
+// for the range of elements [\a begin, \a end) and computes the norms of the updated elements
+// of \a r in the same sweep.
+*/
+template< typename VT1    // Type of the first target vector
+        , typename VT2    // Type of the first operand
+        , typename VT3    // Type of the second target vector
+        , typename VT4 >  // Type of the second operand
+inline typename DisableIf< UseVectorizedFusedKernel<VT1,VT2,VT3,VT4>
+                         , FusedNorms<typename VT3::ElementType> >::Type
+   axpyAxpyRange( VT1& x, typename VT3::ElementType alpha, const VT2& p,
+                  VT3& r, typename VT3::ElementType beta, const VT4& q, size_t begin, size_t end )
+{
+   using std::abs;
+
+   typedef typename VT3::ElementType  ET;
+
+   FusedNorms<ET> result = { ET(), ET() };
+
+   for( size_t i=begin; i<end; ++i ) {
+      x[i] += alpha * p[i];
+      const ET tmp( r[i] + beta * q[i] );
+      r[i] = tmp;
+      result.sqrNorm += tmp * tmp;
+      result.maxNorm  = max( result.maxNorm, abs( tmp ) );
+   }
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized fused double AXPY update and norm computation for a range of elements.
+// \ingroup dense
+//
+// \param x The first target vector.
+// \param alpha The scalar factor of the first update.
+// \param p The dense vector operand of the first update.
+// \param r The second target vector.
+// \param beta The scalar factor of the second update.
+// \param q The dense vector operand of the second update.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
+// \return The partial squared Euclidean and maximum norms of the updated vector \a r.
+//
+// This function performs the updates \f$ x += \alpha \cdot p \f$ and \f$ r += \beta \cdot q \f$
+// for the range of elements [\a begin, \a end) and computes the norms of the updated elements
+// of \a r in the same sweep. Note that the first index of the range is required to be a
+// multiple of the intrinsic vector size.
+*/
+template< typename VT1    // Type of the first target vector
+        , typename VT2    // Type of the first operand
+        , typename VT3    // Type of the second target vector
+        , typename VT4 >  // Type of the second operand
+inline typename EnableIf< UseVectorizedFusedKernel<VT1,VT2,VT3,VT4>
+                        , FusedNorms<typename VT3::ElementType> >::Type
+   axpyAxpyRange( VT1& x, typename VT3::ElementType alpha, const VT2& p,
+                  VT3& r, typename VT3::ElementType beta, const VT4& q, size_t begin, size_t end )
+{
+   using std::abs;
+
+   typedef typename VT3::ElementType  ET;
+   typedef IntrinsicTrait<ET>         IT;
+   typedef typename IT::Type          IntrinsicType;
+
+   BLAZE_INTERNAL_ASSERT( begin % IT::size == 0UL, "Invalid range detected" );
+
+   const IntrinsicType a   ( set( alpha ) );
+   const IntrinsicType b   ( set( beta  ) );
+   const IntrinsicType zero( set( ET()  ) );
+
+   IntrinsicType sqr1( zero ), sqr2( zero ), max1( zero ), max2( zero );
+
+   size_t i( begin );
+
+   for( ; (i+IT::size*2UL) <= end; i+=IT::size*2UL ) {
+      const IntrinsicType r1( fmadd( b, q.load(i         ), r.load(i         ) ) );
+      const IntrinsicType r2( fmadd( b, q.load(i+IT::size), r.load(i+IT::size) ) );
+      x.store( i         , fmadd( a, p.load(i         ), x.load(i         ) ) );
+      x.store( i+IT::size, fmadd( a, p.load(i+IT::size), x.load(i+IT::size) ) );
+      r.store( i         , r1 );
+      r.store( i+IT::size, r2 );
+      sqr1 = fmadd( r1, r1, sqr1 );
+      sqr2 = fmadd( r2, r2, sqr2 );
+      max1 = max( max1, max( r1, zero - r1 ) );
+      max2 = max( max2, max( r2, zero - r2 ) );
+   }
+   for( ; (i+IT::size) <= end; i+=IT::size ) {
+      const IntrinsicType r1( fmadd( b, q.load(i), r.load(i) ) );
+      x.store( i, fmadd( a, p.load(i), x.load(i) ) );
+      r.store( i, r1 );
+      sqr1 = fmadd( r1, r1, sqr1 );
+      max1 = max( max1, max( r1, zero - r1 ) );
+   }
+
+   FusedNorms<ET> result = { sum( sqr1 + sqr2 ), ET() };
+
+   ET tmp[IT::size];
+   storeu( tmp, max( max1, max2 ) );
+   for( size_t k=0UL; k<IT::size; ++k )
+      result.maxNorm = max( result.maxNorm, tmp[k] );
+
+   for( ; i<end; ++i ) {
+      x[i] += alpha * p[i];
+      const ET value( r[i] + beta * q[i] );
+      r[i] = value;
+      result.sqrNorm += value * value;
+      result.maxNorm  = max( result.maxNorm, abs( value ) );
+   }
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default fused update of the pipelined conjugate gradient method for a range of elements.
+// \ingroup dense
+//
+// \param x The vector of unknowns.
+// \param r The residual vector.
+// \param p The search direction.
+// \param s The product of the system matrix and the search direction.
+// \param w The product of the system matrix and the residual vector.
+// \param alpha The step length.
+// \param beta The scaling factor of the previous search direction.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
+// \return The partial squared Euclidean norm of the updated residual vector.
+//
+// This function performs the four vector updates of a pipelined conjugate gradient iteration
+// \f$ p = r + \beta \cdot p \f$, \f$ s = w + \beta \cdot s \f$, \f$ x += \alpha \cdot p \f$ and
+// \f$ r -= \alpha \cdot s \f$ for the range of elements [\a begin, \a end) and computes the
+// squared norm of the updated residual in the same sweep.
+*/
+template< typename VT1    // Type of the vector of unknowns
+        , typename VT2    // Type of the residual vector
+        , typename VT3    // Type of the search direction
+        , typename VT4    // Type of the product of the system matrix and the search direction
+        , typename VT5 >  // Type of the product of the system matrix and the residual vector
+inline typename DisableIf< UseVectorizedFusedKernel<VT1,VT2,VT3,VT4,VT5>
+                         , typename VT2::ElementType >::Type
+   cgUpdateRange( VT1& x, VT2& r, VT3& p, VT4& s, const VT5& w,
+                  typename VT2::ElementType alpha, typename VT2::ElementType beta,
+                  size_t begin, size_t end )
+{
+   typedef typename VT2::ElementType  ET;
+
+   ET result = ET();
+
+   for( size_t i=begin; i<end; ++i ) {
+      const ET pi( r[i] + beta * p[i] );
+      const ET si( w[i] + beta * s[i] );
+      const ET ri( r[i] - alpha * si );
+      p[i]  = pi;
+      s[i]  = si;
+      x[i] += alpha * pi;
+      r[i]  = ri;
+      result += ri * ri;
+   }
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized fused update of the pipelined CG method for a range of elements.
+// \ingroup dense
+//
+// \param x The vector of unknowns.
+// \param r The residual vector.
+// \param p The search direction.
+// \param s The product of the system matrix and the search direction.
+// \param w The product of the system matrix and the residual vector.
+// \param alpha The step length.
+// \param beta The scaling factor of the previous search direction.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
+// \return The partial squared Euclidean norm of the updated residual vector.
+//
+// This function performs the four vector updates of a pipelined conjugate gradient iteration
+// for the range of elements [\a begin, \a end) and computes the squared norm of the updated
+// residual in the same sweep. Note that the first index of the range is required to be a
+// multiple of the intrinsic vector size.
+*/
+template< typename VT1    // Type of the vector of unknowns
+        , typename VT2    // Type of the residual vector
+        , typename VT3    // Type of the search direction
+        , typename VT4    // Type of the product of the system matrix and the search direction
+        , typename VT5 >  // Type of the product of the system matrix and the residual vector
+inline typename EnableIf< UseVectorizedFusedKernel<VT1,VT2,VT3,VT4,VT5>
+                        , typename VT2::ElementType >::Type
+   cgUpdateRange( VT1& x, VT2& r, VT3& p, VT4& s, const VT5& w,
+                  typename VT2::ElementType alpha, typename VT2::ElementType beta,
+                  size_t begin, size_t end )
+{
+   typedef typename VT2::ElementType  ET;
+   typedef IntrinsicTrait<ET>         IT;
+   typedef typename IT::Type          IntrinsicType;
+
+   BLAZE_INTERNAL_ASSERT( begin % IT::size == 0UL, "Invalid range detected" );
+
+   const IntrinsicType a ( set(  alpha ) );
+   const IntrinsicType na( set( -alpha ) );
+   const IntrinsicType b ( set(  beta  ) );
+
+   IntrinsicType sqr1( set( ET() ) ), sqr2( sqr1 );
+
+   size_t i( begin );
+
+   for( ; (i+IT::size*2UL) <= end; i+=IT::size*2UL ) {
+      const size_t j( i+IT::size );
+      const IntrinsicType r1( r.load(i) ), r2( r.load(j) );
+      const IntrinsicType p1( fmadd( b, p.load(i), r1 ) ), p2( fmadd( b, p.load(j), r2 ) );
+      const IntrinsicType s1( fmadd( b, s.load(i), w.load(i) ) );
+      const IntrinsicType s2( fmadd( b, s.load(j), w.load(j) ) );
+      const IntrinsicType n1( fmadd( na, s1, r1 ) ), n2( fmadd( na, s2, r2 ) );
+      p.store( i, p1 );
+      p.store( j, p2 );
+      s.store( i, s1 );
+      s.store( j, s2 );
+      x.store( i, fmadd( a, p1, x.load(i) ) );
+      x.store( j, fmadd( a, p2, x.load(j) ) );
+      r.store( i, n1 );
+      r.store( j, n2 );
+      sqr1 = fmadd( n1, n1, sqr1 );
+      sqr2 = fmadd( n2, n2, sqr2 );
+   }
+   for( ; (i+IT::size) <= end; i+=IT::size ) {
+      const IntrinsicType r1( r.load(i) );
+      const IntrinsicType p1( fmadd( b, p.load(i), r1 ) );
+      const IntrinsicType s1( fmadd( b, s.load(i), w.load(i) ) );
+      const IntrinsicType n1( fmadd( na, s1, r1 ) );
+      p.store( i, p1 );
+      s.store( i, s1 );
+      x.store( i, fmadd( a, p1, x.load(i) ) );
+      r.store( i, n1 );
+      sqr1 = fmadd( n1, n1, sqr1 );
+   }
+
+   ET result( sum( sqr1 + sqr2 ) );
+
+   for( ; i<end; ++i ) {
+      const ET pi( r[i] + beta * p[i] );
+      const ET si( w[i] + beta * s[i] );
+      const ET ri( r[i] - alpha * si );
+      p[i]  = pi;
+      s[i]  = si;
+      x[i] += alpha * pi;
+      r[i]  = ri;
+      result += ri * ri;
+   }
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  KERNEL CLASS DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused kernel for the sparse matrix/dense vector multiplication and scalar product.
+// \ingroup dense
+*/
+template< typename VT1    // Type of the target vector
+        , typename MT     // Type of the row-major sparse matrix
+        , typename VT2 >  // Type of the dense vector operand
+struct MultDotKernel
+{
+   //**Type definitions****************************************************************************
+   typedef typename VT1::ElementType  ElementType;  //!< Element type of the kernel.
+   typedef ElementType                ResultType;   //!< Result type of the kernel.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   explicit inline MultDotKernel( VT1& y, const MT& A, const VT2& x )
+      : y_( y )  // The target vector
+      , A_( A )  // The row-major sparse matrix
+      , x_( x )  // The dense vector operand
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   inline ResultType operator()( size_t begin, size_t end ) const {
+      return multDotRange( y_, A_, x_, begin, end );
+   }
+   //**********************************************************************************************
+
+   //**Combine function****************************************************************************
+   static inline ResultType combine( const ResultType& a, const ResultType& b ) {
+      return a + b;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   VT1&       y_;  //!< The target vector.
+   const MT&  A_;  //!< The row-major sparse matrix.
+   const VT2& x_;  //!< The dense vector operand.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused kernel for the double AXPY update and the norm computation.
+// \ingroup dense
+*/
+template< typename VT1    // Type of the first target vector
+        , typename VT2    // Type of the first operand
+        , typename VT3    // Type of the second target vector
+        , typename VT4 >  // Type of the second operand
+struct AxpyAxpyKernel
+{
+   //**Type definitions****************************************************************************
+   typedef typename VT3::ElementType  ElementType;  //!< Element type of the kernel.
+   typedef FusedNorms<ElementType>    ResultType;   //!< Result type of the kernel.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   explicit inline AxpyAxpyKernel( VT1& x, ElementType alpha, const VT2& p,
+                                   VT3& r, ElementType beta, const VT4& q )
+      : x_    ( x     )  // The first target vector
+      , alpha_( alpha )  // The scalar factor of the first update
+      , p_    ( p     )  // The dense vector operand of the first update
+      , r_    ( r     )  // The second target vector
+      , beta_ ( beta  )  // The scalar factor of the second update
+      , q_    ( q     )  // The dense vector operand of the second update
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   inline ResultType operator()( size_t begin, size_t end ) const {
+      return axpyAxpyRange( x_, alpha_, p_, r_, beta_, q_, begin, end );
+   }
+   //**********************************************************************************************
+
+   //**Combine function****************************************************************************
+   static inline ResultType combine( const ResultType& a, const ResultType& b ) {
+      const ResultType result = { a.sqrNorm + b.sqrNorm, max( a.maxNorm, b.maxNorm ) };
+      return result;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   VT1&        x_;      //!< The first target vector.
+   ElementType alpha_;  //!< The scalar factor of the first update.
+   const VT2&  p_;      //!< The dense vector operand of the first update.
+   VT3&        r_;      //!< The second target vector.
+   ElementType beta_;   //!< The scalar factor of the second update.
+   const VT4&  q_;      //!< The dense vector operand of the second update.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused kernel for the vector updates of the pipelined conjugate gradient method.
+// \ingroup dense
+*/
+template< typename VT1    // Type of the vector of unknowns
+        , typename VT2    // Type of the residual vector
+        , typename VT3    // Type of the search direction
+        , typename VT4    // Type of the product of the system matrix and the search direction
+        , typename VT5 >  // Type of the product of the system matrix and the residual vector
+struct CGUpdateKernel
+{
+   //**Type definitions****************************************************************************
+   typedef typename VT2::ElementType  ElementType;  //!< Element type of the kernel.
+   typedef ElementType                ResultType;   //!< Result type of the kernel.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   explicit inline CGUpdateKernel( VT1& x, VT2& r, VT3& p, VT4& s, const VT5& w,
+                                   ElementType alpha, ElementType beta )
+      : x_    ( x     )  // The vector of unknowns
+      , r_    ( r     )  // The residual vector
+      , p_    ( p     )  // The search direction
+      , s_    ( s     )  // The product of the system matrix and the search direction
+      , w_    ( w     )  // The product of the system matrix and the residual vector
+      , alpha_( alpha )  // The step length
+      , beta_ ( beta  )  // The scaling factor of the previous search direction
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   inline ResultType operator()( size_t begin, size_t end ) const {
+      return cgUpdateRange( x_, r_, p_, s_, w_, alpha_, beta_, begin, end );
+   }
+   //**********************************************************************************************
+
+   //**Combine function****************************************************************************
+   static inline ResultType combine( const ResultType& a, const ResultType& b ) {
+      return a + b;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   VT1&        x_;      //!< The vector of unknowns.
+   VT2&        r_;      //!< The residual vector.
+   VT3&        p_;      //!< The search direction.
+   VT4&        s_;      //!< The product of the system matrix and the search direction.
+   const VT5&  w_;      //!< The product of the system matrix and the residual vector.
+   ElementType alpha_;  //!< The step length.
+   ElementType beta_;   //!< The scaling factor of the previous search direction.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Fused kernel functions */
+//@{
+template< typename VT1, typename MT, typename VT2 >
+inline typename VT1::ElementType
+   fusedMultDot( DenseVector<VT1,columnVector>& y, const SparseMatrix<MT,rowMajor>& A,
+                 const DenseVector<VT2,columnVector>& x );
+
+template< typename VT1, typename MT, bool SO, typename VT2 >
+inline typename VT1::ElementType
+   fusedMultDot( DenseVector<VT1,columnVector>& y, const Matrix<MT,SO>& A,
+                 const DenseVector<VT2,columnVector>& x );
+
+template< typename VT1, typename VT2, typename VT3, typename VT4, bool TF >
+inline void fusedAxpyAxpy( DenseVector<VT1,TF>& x, typename VT3::ElementType alpha,
+                           const DenseVector<VT2,TF>& p, DenseVector<VT3,TF>& r,
+                           typename VT3::ElementType beta, const DenseVector<VT4,TF>& q,
+                           typename VT3::ElementType& sqrNorm, typename VT3::ElementType& maxNorm );
+
+template< typename VT1, typename VT2, typename VT3, typename VT4, typename VT5, bool TF >
+inline typename VT2::ElementType
+   fusedCGUpdate( DenseVector<VT1,TF>& x, DenseVector<VT2,TF>& r, DenseVector<VT3,TF>& p,
+                  DenseVector<VT4,TF>& s, const DenseVector<VT5,TF>& w,
+                  typename VT2::ElementType alpha, typename VT2::ElementType beta );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Fused sparse matrix/dense vector multiplication and scalar product.
+// \ingroup dense_vector
+//
+// \param y The target vector of the multiplication.
+// \param A The row-major sparse matrix.
+// \param x The dense vector operand.
+// \return The scalar product \f$ x^T \cdot y \f$.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function computes \f$ y = A \cdot x \f$ and the scalar product \f$ x^T \cdot y \f$ in a
+// single sweep over the rows of \a A. In contrast to the evaluation by two separate expressions
+// the target vector \a y is not read again after the multiplication:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, y;
+   // ... Resizing and initialization
+
+   const double xAx = fusedMultDot( y, A, x );  // Equivalent to y = A * x; xAx = trans(x) * y;
+   \endcode
+
+// The rows are distributed among the threads of the active SMP backend. Note that \a x and \a y
+// must not be the same vector.
+*/
+template< typename VT1    // Type of the target vector
+        , typename MT     // Type of the row-major sparse matrix
+        , typename VT2 >  // Type of the dense vector operand
+inline typename VT1::ElementType
+   fusedMultDot( DenseVector<VT1,columnVector>& y, const SparseMatrix<MT,rowMajor>& A,
+                 const DenseVector<VT2,columnVector>& x )
+{
+   typedef typename MT::CompositeType           MCT;
+   typedef typename RemoveReference<MCT>::Type  MT1;
+   typedef typename VT2::CompositeType          VCT;
+   typedef typename RemoveReference<VCT>::Type  VT3;
+
+   if( (~A).columns() != (~x).size() || (~A).rows() != (~y).size() )
+      throw std::invalid_argument( "Matrix and vector sizes do not match" );
+
+   MCT a( ~A );  // Evaluation of the sparse matrix operand
+   VCT b( ~x );  // Evaluation of the dense vector operand
+
+   BLAZE_INTERNAL_ASSERT( static_cast<const void*>( &b ) != static_cast<const void*>( &~y ),
+                          "Aliasing of the target and the operand detected" );
+
+   return smpFusedKernel( (~y).size(), MultDotKernel<VT1,MT1,VT3>( ~y, a, b ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Matrix/vector multiplication and scalar product for all other matrix types.
+// \ingroup dense_vector
+//
+// \param y The target vector of the multiplication.
+// \param A The matrix.
+// \param x The dense vector operand.
+// \return The scalar product \f$ x^T \cdot y \f$.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This overload of the fusedMultDot() function handles all matrices except for row-major
+// sparse matrices. It computes \f$ y = A \cdot x \f$ and \f$ x^T \cdot y \f$ by means of the
+// regular (vectorized and parallelized) multiplication and reduction kernels.
+*/
+template< typename VT1    // Type of the target vector
+        , typename MT     // Type of the matrix
+        , bool SO         // Storage order of the matrix
+        , typename VT2 >  // Type of the dense vector operand
+inline typename VT1::ElementType
+   fusedMultDot( DenseVector<VT1,columnVector>& y, const Matrix<MT,SO>& A,
+                 const DenseVector<VT2,columnVector>& x )
+{
+   if( (~A).columns() != (~x).size() || (~A).rows() != (~y).size() )
+      throw std::invalid_argument( "Matrix and vector sizes do not match" );
+
+   ~y = (~A) * (~x);
+
+   return sum( (~x) * (~y) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Fused double AXPY update with the computation of the norms of the second target.
+// \ingroup dense_vector
+//
+// \param x The first target vector.
+// \param alpha The scalar factor of the first update.
+// \param p The dense vector operand of the first update.
+// \param r The second target vector.
+// \param beta The scalar factor of the second update.
+// \param q The dense vector operand of the second update.
+// \param sqrNorm The squared Euclidean norm of the updated vector \a r.
+// \param maxNorm The maximum norm of the updated vector \a r.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function performs the updates \f$ x += \alpha \cdot p \f$ and \f$ r += \beta \cdot q \f$
+// and computes both \f$ \|r\|_2^2 \f$ and \f$ \|r\|_{\infty} \f$ of the updated vector \a r in
+// a single vectorized sweep, which is distributed among the threads of the active SMP backend:
+
+   \code
+   blaze::DynamicVector<double> x, p, r, q;
+   // ... Resizing and initialization
+
+   double sqrNorm, maxNorm;
+
+   // Equivalent to x += 0.5*p; r += 2.0*q; sqrNorm = sqrLength( r ); maxNorm = max( abs( r ) );
+   fusedAxpyAxpy( x, 0.5, p, r, 2.0, q, sqrNorm, maxNorm );
+   \endcode
+
+// All vectors must have the same size. The targets \a x and \a r must be distinct vectors,
+// the operands \a p and \a q may be identical to any of the vectors.
+*/
+template< typename VT1  // Type of the first target vector
+        , typename VT2  // Type of the first operand
+        , typename VT3  // Type of the second target vector
+        , typename VT4  // Type of the second operand
+        , bool TF >     // Transpose flag
+inline void fusedAxpyAxpy( DenseVector<VT1,TF>& x, typename VT3::ElementType alpha,
+                           const DenseVector<VT2,TF>& p, DenseVector<VT3,TF>& r,
+                           typename VT3::ElementType beta, const DenseVector<VT4,TF>& q,
+                           typename VT3::ElementType& sqrNorm, typename VT3::ElementType& maxNorm )
+{
+   typedef typename VT3::ElementType  ET;
+
+   const size_t n( (~r).size() );
+
+   if( (~x).size() != n || (~p).size() != n || (~q).size() != n )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   const FusedNorms<ET> result(
+      smpFusedKernel( n, AxpyAxpyKernel<VT1,VT2,VT3,VT4>( ~x, alpha, ~p, ~r, beta, ~q ) ) );
+
+   sqrNorm = result.sqrNorm;
+   maxNorm = result.maxNorm;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Fused vector update of the pipelined conjugate gradient method.
+// \ingroup dense_vector
+//
+// \param x The vector of unknowns.
+// \param r The residual vector.
+// \param p The search direction.
+// \param s The product of the system matrix and the search direction.
+// \param w The product of the system matrix and the residual vector.
+// \param alpha The step length.
+// \param beta The scaling factor of the previous search direction.
+// \return The squared Euclidean norm of the updated residual vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function performs the four vector updates of an iteration of the pipelined conjugate
+// gradient method (see the PipelinedCG class)
+
+      \f[ p = r + \beta p, \quad s = w + \beta s, \quad x = x + \alpha p, \quad
+          r = r - \alpha s \f]
+
+// and computes \f$ \|r\|_2^2 \f$ of the updated residual in a single vectorized sweep, which is
+// distributed among the threads of the active SMP backend. All vectors must be distinct and have
+// the same size.
+*/
+template< typename VT1  // Type of the vector of unknowns
+        , typename VT2  // Type of the residual vector
+        , typename VT3  // Type of the search direction
+        , typename VT4  // Type of the product of the system matrix and the search direction
+        , typename VT5  // Type of the product of the system matrix and the residual vector
+        , bool TF >     // Transpose flag
+inline typename VT2::ElementType
+   fusedCGUpdate( DenseVector<VT1,TF>& x, DenseVector<VT2,TF>& r, DenseVector<VT3,TF>& p,
+                  DenseVector<VT4,TF>& s, const DenseVector<VT5,TF>& w,
+                  typename VT2::ElementType alpha, typename VT2::ElementType beta )
+{
+   const size_t n( (~r).size() );
+
+   if( (~x).size() != n || (~p).size() != n || (~s).size() != n || (~w).size() != n )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   typedef CGUpdateKernel<VT1,VT2,VT3,VT4,VT5>  KernelType;
+
+   return smpFusedKernel( n, KernelType( ~x, ~r, ~p, ~s, ~w, alpha, beta ) );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
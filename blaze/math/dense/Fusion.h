@@ -0,0 +1,1138 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Fusion.h
+//  \brief Header file for the fused evaluation of several dense vector statements
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_FUSION_H_
+#define _BLAZE_MATH_DENSE_FUSION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <utility>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/smp/FusedKernel.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/system/CacheSize.h>
+#include <blaze/system/Inline.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/SelectType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS FUSEDSTATEMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Base class for all statements of a fused evaluation.
+// \ingroup dense_vector
+//
+// The FusedStatement class template is the base class of all statements that can be combined
+// into a single fused evaluation via the fuse() function. Statements are created by means of
+// the fusedAssign(), fusedAddAssign(), fusedSubAssign(), fusedMultAssign() and fusedSum()
+// functions. Each statement provides the following interface:
+//
+//  - an \a ElementType and a \a ResultType nested type (the partial result of a range),
+//  - a \a size() function returning the number of elements processed by the statement,
+//  - a \a run() function executing the statement for a range of elements,
+//  - a static \a combine() function merging the partial results of two ranges, and
+//  - a \a finalize() function storing the final result of the statement.
+*/
+template< typename ST >  // Type of the statement
+struct FusedStatement
+{
+   //**Non-const conversion operator***************************************************************
+   /*!\brief Conversion operator for non-constant statements.
+   //
+   // \return Reference of the actual type of the statement.
+   */
+   BLAZE_ALWAYS_INLINE ST& operator~() {
+      return *static_cast<ST*>( this );
+   }
+   //**********************************************************************************************
+
+   //**Const conversion operators******************************************************************
+   /*!\brief Conversion operator for constant statements.
+   //
+   // \return Const reference of the actual type of the statement.
+   */
+   BLAZE_ALWAYS_INLINE const ST& operator~() const {
+      return *static_cast<const ST*>( this );
+   }
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  AUXILIARY CLASS DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Empty partial result of the fused assignment statements.
+// \ingroup dense_vector
+*/
+struct FusedNoResult
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Operand type of a fused statement.
+// \ingroup dense_vector
+//
+// Expressions are stored by value, plain vectors by reference. Expressions requiring an
+// intermediate evaluation (as for instance matrix/vector multiplications) are evaluated into
+// a temporary vector on construction of the statement.
+*/
+template< typename VT >  // Type of the dense vector operand
+struct FusedOperand
+{
+   typedef typename SelectType< RequiresEvaluation<VT>::value
+                              , typename VT::ResultType, VT >::Type  Type;
+
+   typedef typename SelectType< IsExpression<VT>::value || RequiresEvaluation<VT>::value
+                              , const Type, const Type& >::Type  Operand;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Operation policy of the fused assignment.
+// \ingroup dense_vector
+*/
+struct FusedAssignOp
+{
+   template< typename ET >
+   struct Vectorizable { enum { value = 1 }; };
+
+   template< typename T1, typename T2 >
+   static inline void apply( T1& a, const T2& b ) { a = b; }
+
+   template< typename T1, typename T2 >
+   static inline T1 eval( const T1& /*a*/, const T2& b ) { return b; }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Operation policy of the fused addition assignment.
+// \ingroup dense_vector
+*/
+struct FusedAddAssignOp
+{
+   template< typename ET >
+   struct Vectorizable { enum { value = IntrinsicTrait<ET>::addition }; };
+
+   template< typename T1, typename T2 >
+   static inline void apply( T1& a, const T2& b ) { a += b; }
+
+   template< typename T1, typename T2 >
+   static inline T1 eval( const T1& a, const T2& b ) { return a + b; }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Operation policy of the fused subtraction assignment.
+// \ingroup dense_vector
+*/
+struct FusedSubAssignOp
+{
+   template< typename ET >
+   struct Vectorizable { enum { value = IntrinsicTrait<ET>::subtraction }; };
+
+   template< typename T1, typename T2 >
+   static inline void apply( T1& a, const T2& b ) { a -= b; }
+
+   template< typename T1, typename T2 >
+   static inline T1 eval( const T1& a, const T2& b ) { return a - b; }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Operation policy of the fused multiplication assignment.
+// \ingroup dense_vector
+*/
+struct FusedMultAssignOp
+{
+   template< typename ET >
+   struct Vectorizable { enum { value = IntrinsicTrait<ET>::multiplication }; };
+
+   template< typename T1, typename T2 >
+   static inline void apply( T1& a, const T2& b ) { a *= b; }
+
+   template< typename T1, typename T2 >
+   static inline T1 eval( const T1& a, const T2& b ) { return a * b; }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the selection of the vectorized fused assignment kernel.
+// \ingroup dense_vector
+*/
+template< typename OP     // Type of the operation policy
+        , typename VT1    // Type of the target dense vector
+        , typename VT2 >  // Type of the dense vector operand
+struct UseVectorizedFusedAssignment
+{
+   typedef typename VT1::ElementType  ET;
+
+   enum { value = VT1::vectorizable && VT2::vectorizable &&
+                  IsSame<ET,typename VT2::ElementType>::value &&
+                  OP::template Vectorizable<ET>::value };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the selection of the vectorized fused sum kernel.
+// \ingroup dense_vector
+*/
+template< typename VT >  // Type of the dense vector operand
+struct UseVectorizedFusedSum
+{
+   enum { value = VT::vectorizable && IntrinsicTrait<typename VT::ElementType>::addition };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  RANGE KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default fused assignment for a range of elements.
+// \ingroup dense_vector
+//
+// \param lhs The target dense vector.
+// \param rhs The dense vector operand.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
+// \return void
+*/
+template< typename OP     // Type of the operation policy
+        , typename VT1    // Type of the target dense vector
+        , typename VT2 >  // Type of the dense vector operand
+inline typename DisableIf< UseVectorizedFusedAssignment<OP,VT1,VT2> >::Type
+   fusedAssignRange( VT1& lhs, const VT2& rhs, size_t begin, size_t end )
+{
+   for( size_t i=begin; i<end; ++i ) {
+      OP::apply( lhs[i], rhs[i] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized fused assignment for a range of elements.
+// \ingroup dense_vector
+//
+// \param lhs The target dense vector.
+// \param rhs The dense vector operand.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
+// \return void
+//
+// The elements in front of the first multiple of the intrinsic vector size and the elements
+// behind the last complete intrinsic vector are handled by scalar operations.
+*/
+template< typename OP     // Type of the operation policy
+        , typename VT1    // Type of the target dense vector
+        , typename VT2 >  // Type of the dense vector operand
+inline typename EnableIf< UseVectorizedFusedAssignment<OP,VT1,VT2> >::Type
+   fusedAssignRange( VT1& lhs, const VT2& rhs, size_t begin, size_t end )
+{
+   typedef IntrinsicTrait<typename VT1::ElementType>  IT;
+
+   size_t i( begin );
+
+   for( ; i<end && ( i & ( IT::size - 1UL ) ) != 0UL; ++i ) {
+      OP::apply( lhs[i], rhs[i] );
+   }
+   for( ; (i+IT::size) <= end; i+=IT::size ) {
+      lhs.store( i, OP::eval( lhs.load(i), rhs.load(i) ) );
+   }
+   for( ; i<end; ++i ) {
+      OP::apply( lhs[i], rhs[i] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default fused sum for a range of elements.
+// \ingroup dense_vector
+//
+// \param dv The dense vector operand.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
+// \return The sum of the elements in the range.
+*/
+template< typename VT >  // Type of the dense vector operand
+inline typename DisableIf< UseVectorizedFusedSum<VT>, typename VT::ElementType >::Type
+   fusedSumRange( const VT& dv, size_t begin, size_t end )
+{
+   typedef typename VT::ElementType  ET;
+
+   ET result = ET();
+
+   for( size_t i=begin; i<end; ++i ) {
+      result += dv[i];
+   }
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized fused sum for a range of elements.
+// \ingroup dense_vector
+//
+// \param dv The dense vector operand.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
+// \return The sum of the elements in the range.
+*/
+template< typename VT >  // Type of the dense vector operand
+inline typename EnableIf< UseVectorizedFusedSum<VT>, typename VT::ElementType >::Type
+   fusedSumRange( const VT& dv, size_t begin, size_t end )
+{
+   typedef typename VT::ElementType  ET;
+   typedef IntrinsicTrait<ET>        IT;
+   typedef typename IT::Type         IntrinsicType;
+
+   ET result = ET();
+   size_t i( begin );
+
+   for( ; i<end && ( i & ( IT::size - 1UL ) ) != 0UL; ++i ) {
+      result += dv[i];
+   }
+
+   IntrinsicType xmm1( set( ET() ) ), xmm2( xmm1 );
+
+   for( ; (i+IT::size*2UL) <= end; i+=IT::size*2UL ) {
+      xmm1 = xmm1 + dv.load(i         );
+      xmm2 = xmm2 + dv.load(i+IT::size);
+   }
+   for( ; (i+IT::size) <= end; i+=IT::size ) {
+      xmm1 = xmm1 + dv.load(i);
+   }
+
+   result += sum( xmm1 + xmm2 );
+
+   for( ; i<end; ++i ) {
+      result += dv[i];
+   }
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  STATEMENT CLASS DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused assignment statement of a dense vector operand to a dense vector.
+// \ingroup dense_vector
+*/
+template< typename VT1    // Type of the target dense vector
+        , typename VT2    // Type of the dense vector operand
+        , typename OP >   // Type of the operation policy
+class DVecFusedAssignment : public FusedStatement< DVecFusedAssignment<VT1,VT2,OP> >
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef typename FusedOperand<VT2>::Type     RT;       //!< Type of the stored operand.
+   typedef typename FusedOperand<VT2>::Operand  Operand;  //!< Storage type of the operand.
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef typename VT1::ElementType  ElementType;  //!< Element type of the statement.
+   typedef FusedNoResult              ResultType;   //!< Partial result of the statement.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DVecFusedAssignment class.
+   //
+   // \param lhs The target dense vector.
+   // \param rhs The dense vector operand.
+   // \exception std::invalid_argument Vector sizes do not match.
+   */
+   explicit inline DVecFusedAssignment( VT1& lhs, const VT2& rhs )
+      : lhs_( lhs )  // The target dense vector
+      , rhs_( rhs )  // The dense vector operand
+   {
+      if( lhs_.size() != rhs_.size() )
+         throw std::invalid_argument( "Vector sizes do not match" );
+   }
+   //**********************************************************************************************
+
+   //**Size function*******************************************************************************
+   /*!\brief Returns the number of elements processed by the statement.
+   //
+   // \return The size of the target vector.
+   */
+   inline size_t size() const {
+      return lhs_.size();
+   }
+   //**********************************************************************************************
+
+   //**Run function********************************************************************************
+   /*!\brief Executes the statement for the given range of elements.
+   //
+   // \param begin The index of the first element of the range.
+   // \param end The index one past the last element of the range.
+   // \return void
+   */
+   inline void run( size_t begin, size_t end, ResultType& ) const {
+      fusedAssignRange<OP>( lhs_, rhs_, begin, end );
+   }
+   //**********************************************************************************************
+
+   //**Combine function****************************************************************************
+   /*!\brief Combines the partial results of two ranges.
+   //
+   // \return The combined (empty) result.
+   */
+   static inline ResultType combine( const ResultType& a, const ResultType& ) {
+      return a;
+   }
+   //**********************************************************************************************
+
+   //**Finalize function***************************************************************************
+   /*!\brief Stores the final result of the statement.
+   //
+   // \return void
+   */
+   inline void finalize( const ResultType& ) const
+   {}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   VT1&    lhs_;  //!< The target dense vector.
+   Operand rhs_;  //!< The dense vector operand.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused reduction statement computing the sum of the elements of a dense vector.
+// \ingroup dense_vector
+*/
+template< typename T      // Type of the result
+        , typename VT >   // Type of the dense vector operand
+class DVecFusedSum : public FusedStatement< DVecFusedSum<T,VT> >
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef typename FusedOperand<VT>::Type     RT;       //!< Type of the stored operand.
+   typedef typename FusedOperand<VT>::Operand  Operand;  //!< Storage type of the operand.
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef typename RT::ElementType  ElementType;  //!< Element type of the statement.
+   typedef ElementType               ResultType;   //!< Partial result of the statement.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DVecFusedSum class.
+   //
+   // \param result The target of the sum.
+   // \param dv The dense vector operand.
+   */
+   explicit inline DVecFusedSum( T& result, const VT& dv )
+      : result_( result )  // The target of the sum
+      , dv_    ( dv     )  // The dense vector operand
+   {}
+   //**********************************************************************************************
+
+   //**Size function*******************************************************************************
+   /*!\brief Returns the number of elements processed by the statement.
+   //
+   // \return The size of the dense vector operand.
+   */
+   inline size_t size() const {
+      return dv_.size();
+   }
+   //**********************************************************************************************
+
+   //**Run function********************************************************************************
+   /*!\brief Executes the statement for the given range of elements.
+   //
+   // \param begin The index of the first element of the range.
+   // \param end The index one past the last element of the range.
+   // \param result The partial sum of the current range.
+   // \return void
+   */
+   inline void run( size_t begin, size_t end, ResultType& result ) const {
+      result += fusedSumRange( dv_, begin, end );
+   }
+   //**********************************************************************************************
+
+   //**Combine function****************************************************************************
+   /*!\brief Combines the partial sums of two ranges.
+   //
+   // \param a The partial sum of the first range.
+   // \param b The partial sum of the second range.
+   // \return The combined sum.
+   */
+   static inline ResultType combine( const ResultType& a, const ResultType& b ) {
+      return a + b;
+   }
+   //**********************************************************************************************
+
+   //**Finalize function***************************************************************************
+   /*!\brief Stores the final sum in the target of the statement.
+   //
+   // \param result The sum of all elements.
+   // \return void
+   */
+   inline void finalize( const ResultType& result ) const {
+      result_ = result;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   T&      result_;  //!< The target of the sum.
+   Operand dv_;      //!< The dense vector operand.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sequence of two fused statements.
+// \ingroup dense_vector
+//
+// The FusedStatementPair class template executes two statements block by block: for every
+// range of elements the first statement is executed before the second statement. Longer
+// sequences of statements are represented by nested pairs.
+*/
+template< typename S1    // Type of the first statement
+        , typename S2 >  // Type of the second statement
+class FusedStatementPair : public FusedStatement< FusedStatementPair<S1,S2> >
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef typename S1::ElementType  ElementType;  //!< Element type of the statement.
+
+   //! Partial result of the statement.
+   typedef std::pair<typename S1::ResultType,typename S2::ResultType>  ResultType;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the FusedStatementPair class.
+   //
+   // \param s1 The first statement.
+   // \param s2 The second statement.
+   // \exception std::invalid_argument Vector sizes do not match.
+   */
+   explicit inline FusedStatementPair( const S1& s1, const S2& s2 )
+      : s1_( s1 )  // The first statement
+      , s2_( s2 )  // The second statement
+   {
+      if( s1_.size() != s2_.size() )
+         throw std::invalid_argument( "Vector sizes do not match" );
+   }
+   //**********************************************************************************************
+
+   //**Size function*******************************************************************************
+   /*!\brief Returns the number of elements processed by the statement.
+   //
+   // \return The common size of both statements.
+   */
+   inline size_t size() const {
+      return s1_.size();
+   }
+   //**********************************************************************************************
+
+   //**Run function********************************************************************************
+   /*!\brief Executes both statements for the given range of elements.
+   //
+   // \param begin The index of the first element of the range.
+   // \param end The index one past the last element of the range.
+   // \param result The partial results of the current range.
+   // \return void
+   */
+   inline void run( size_t begin, size_t end, ResultType& result ) const {
+      s1_.run( begin, end, result.first  );
+      s2_.run( begin, end, result.second );
+   }
+   //**********************************************************************************************
+
+   //**Combine function****************************************************************************
+   /*!\brief Combines the partial results of two ranges.
+   //
+   // \param a The partial results of the first range.
+   // \param b The partial results of the second range.
+   // \return The combined results.
+   */
+   static inline ResultType combine( const ResultType& a, const ResultType& b ) {
+      return ResultType( S1::combine( a.first , b.first  ),
+                         S2::combine( a.second, b.second ) );
+   }
+   //**********************************************************************************************
+
+   //**Finalize function***************************************************************************
+   /*!\brief Stores the final results of both statements.
+   //
+   // \param result The final results.
+   // \return void
+   */
+   inline void finalize( const ResultType& result ) const {
+      s1_.finalize( result.first  );
+      s2_.finalize( result.second );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   const S1& s1_;  //!< The first statement.
+   const S2& s2_;  //!< The second statement.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused kernel for the SMP execution of a sequence of fused statements.
+// \ingroup dense_vector
+//
+// The kernel splits the given range into blocks that fit into the first level cache and
+// executes all statements for one block before proceeding to the next block. Thus operands
+// shared between several statements are loaded from main memory only once.
+*/
+template< typename ST >  // Type of the statement
+struct FusionKernel
+{
+   //**Type definitions****************************************************************************
+   typedef typename ST::ElementType  ElementType;  //!< Element type of the kernel.
+   typedef typename ST::ResultType   ResultType;   //!< Result type of the kernel.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   explicit inline FusionKernel( const ST& st )
+      : st_( st )  // The fused statement
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   inline ResultType operator()( size_t begin, size_t end ) const
+   {
+      const size_t blockSize( max( ( l1CacheSize / ( sizeof(ElementType) * 4UL ) ) & size_t(~63UL)
+                                 , size_t(64UL) ) );
+
+      ResultType result = ResultType();
+
+      for( size_t i=begin; i<end; i+=blockSize ) {
+         st_.run( i, min( i+blockSize, end ), result );
+      }
+
+      return result;
+   }
+   //**********************************************************************************************
+
+   //**Combine function****************************************************************************
+   static inline ResultType combine( const ResultType& a, const ResultType& b ) {
+      return ST::combine( a, b );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   const ST& st_;  //!< The fused statement.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Fused evaluation functions */
+//@{
+template< typename VT1, typename VT2, bool TF >
+inline const DVecFusedAssignment<VT1,VT2,FusedAssignOp>
+   fusedAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs );
+
+template< typename VT1, typename VT2, bool TF >
+inline const DVecFusedAssignment<VT1,VT2,FusedAddAssignOp>
+   fusedAddAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs );
+
+template< typename VT1, typename VT2, bool TF >
+inline const DVecFusedAssignment<VT1,VT2,FusedSubAssignOp>
+   fusedSubAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs );
+
+template< typename VT1, typename VT2, bool TF >
+inline const DVecFusedAssignment<VT1,VT2,FusedMultAssignOp>
+   fusedMultAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs );
+
+template< typename T, typename VT, bool TF >
+inline const DVecFusedSum<T,VT> fusedSum( T& result, const DenseVector<VT,TF>& dv );
+
+template< typename S1 >
+inline void fuse( const FusedStatement<S1>& s1 );
+
+template< typename S1, typename S2 >
+inline void fuse( const FusedStatement<S1>& s1, const FusedStatement<S2>& s2 );
+
+template< typename S1, typename S2, typename S3 >
+inline void fuse( const FusedStatement<S1>& s1, const FusedStatement<S2>& s2,
+                  const FusedStatement<S3>& s3 );
+
+template< typename S1, typename S2, typename S3, typename S4 >
+inline void fuse( const FusedStatement<S1>& s1, const FusedStatement<S2>& s2,
+                  const FusedStatement<S3>& s3, const FusedStatement<S4>& s4 );
+
+template< typename S1, typename S2, typename S3, typename S4, typename S5 >
+inline void fuse( const FusedStatement<S1>& s1, const FusedStatement<S2>& s2,
+                  const FusedStatement<S3>& s3, const FusedStatement<S4>& s4,
+                  const FusedStatement<S5>& s5 );
+
+template< typename S1, typename S2, typename S3, typename S4, typename S5, typename S6 >
+inline void fuse( const FusedStatement<S1>& s1, const FusedStatement<S2>& s2,
+                  const FusedStatement<S3>& s3, const FusedStatement<S4>& s4,
+                  const FusedStatement<S5>& s5, const FusedStatement<S6>& s6 );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a fused assignment statement \f$ lhs = rhs \f$.
+// \ingroup dense_vector
+//
+// \param lhs The target dense vector.
+// \param rhs The dense vector operand.
+// \return The fused assignment statement.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// The statement is not executed until it is passed to the fuse() function. See the fuse()
+// function for details.
+*/
+template< typename VT1  // Type of the target dense vector
+        , typename VT2  // Type of the dense vector operand
+        , bool TF >     // Transpose flag
+inline const DVecFusedAssignment<VT1,VT2,FusedAssignOp>
+   fusedAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs )
+{
+   return DVecFusedAssignment<VT1,VT2,FusedAssignOp>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a fused addition assignment statement \f$ lhs += rhs \f$.
+// \ingroup dense_vector
+//
+// \param lhs The target dense vector.
+// \param rhs The dense vector operand.
+// \return The fused addition assignment statement.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// The statement is not executed until it is passed to the fuse() function. See the fuse()
+// function for details.
+*/
+template< typename VT1  // Type of the target dense vector
+        , typename VT2  // Type of the dense vector operand
+        , bool TF >     // Transpose flag
+inline const DVecFusedAssignment<VT1,VT2,FusedAddAssignOp>
+   fusedAddAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs )
+{
+   return DVecFusedAssignment<VT1,VT2,FusedAddAssignOp>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a fused subtraction assignment statement \f$ lhs -= rhs \f$.
+// \ingroup dense_vector
+//
+// \param lhs The target dense vector.
+// \param rhs The dense vector operand.
+// \return The fused subtraction assignment statement.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// The statement is not executed until it is passed to the fuse() function. See the fuse()
+// function for details.
+*/
+template< typename VT1  // Type of the target dense vector
+        , typename VT2  // Type of the dense vector operand
+        , bool TF >     // Transpose flag
+inline const DVecFusedAssignment<VT1,VT2,FusedSubAssignOp>
+   fusedSubAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs )
+{
+   return DVecFusedAssignment<VT1,VT2,FusedSubAssignOp>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a fused componentwise multiplication assignment statement \f$ lhs *= rhs \f$.
+// \ingroup dense_vector
+//
+// \param lhs The target dense vector.
+// \param rhs The dense vector operand.
+// \return The fused multiplication assignment statement.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// The statement is not executed until it is passed to the fuse() function. See the fuse()
+// function for details.
+*/
+template< typename VT1  // Type of the target dense vector
+        , typename VT2  // Type of the dense vector operand
+        , bool TF >     // Transpose flag
+inline const DVecFusedAssignment<VT1,VT2,FusedMultAssignOp>
+   fusedMultAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs )
+{
+   return DVecFusedAssignment<VT1,VT2,FusedMultAssignOp>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a fused reduction statement \f$ result = sum(dv) \f$.
+// \ingroup dense_vector
+//
+// \param result The target of the sum.
+// \param dv The dense vector operand.
+// \return The fused sum statement.
+//
+// The statement is not executed until it is passed to the fuse() function. Scalar products
+// and squared norms are expressed as the sum of a componentwise product, as for instance
+// \c fusedSum( s, r * r ) for \f$ s = r^T \cdot r \f$. See the fuse() function for details.
+*/
+template< typename T     // Type of the result
+        , typename VT    // Type of the dense vector operand
+        , bool TF >      // Transpose flag
+inline const DVecFusedSum<T,VT> fusedSum( T& result, const DenseVector<VT,TF>& dv )
+{
+   return DVecFusedSum<T,VT>( result, ~dv );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executes the given (compound) fused statement.
+// \ingroup dense_vector
+//
+// \param st The fused statement.
+// \return void
+*/
+template< typename ST >  // Type of the statement
+inline void fuseStatement( const ST& st )
+{
+   const typename ST::ResultType result( smpFusedKernel( st.size(), FusionKernel<ST>( st ) ) );
+   st.finalize( result );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executes a single fused statement.
+// \ingroup dense_vector
+//
+// \param s1 The statement.
+// \return void
+//
+// This function executes a single statement by the same blocked and parallel kernel as a
+// sequence of statements. See the multi-statement overloads of the fuse() function for details.
+*/
+template< typename S1 >  // Type of the statement
+inline void fuse( const FusedStatement<S1>& s1 )
+{
+   fuseStatement( ~s1 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executes two statements in a single fused traversal.
+// \ingroup dense_vector
+//
+// \param s1 The first statement.
+// \param s2 The second statement.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// Each assignment to a dense vector is usually evaluated in its own loop. Therefore a sequence
+// of assignments such as
+
+   \code
+   x += alpha * d;
+   r += alpha * h;
+   s = trans( r ) * r;
+   \endcode
+
+// streams the vector \a r three times from main memory. The fuse() function evaluates up to
+// six statements within a single traversal of the vectors and with a single dispatch to the
+// active SMP backend:
+
+   \code
+   blaze::DynamicVector<double> x, d, r, h;
+   double alpha, s;
+   // ... Resizing and initialization
+
+   fuse( fusedAddAssign( x, alpha * d ),
+         fusedAddAssign( r, alpha * h ),
+         fusedSum( s, r * r ) );
+   \endcode
+
+// The statements are executed block by block, where each block is small enough to fit into
+// the first level cache. Within a block the statements are executed in the given order. Thus
+// the result is identical to the sequential execution of the statements as long as all
+// statements only access the elements of the same index, i.e. the operands consist of
+// componentwise operations only. Operands requiring an intermediate evaluation (as for instance
+// matrix/vector multiplications) are evaluated when the statement is created, i.e. before any
+// statement is executed. All statements must refer to vectors of the same size, the targets of
+// the sums are assigned after the traversal. Note that the statements must be created within
+// the call of the fuse() function, since they refer to their (temporary) operands.
+*/
+template< typename S1    // Type of the first statement
+        , typename S2 >  // Type of the second statement
+inline void fuse( const FusedStatement<S1>& s1, const FusedStatement<S2>& s2 )
+{
+   fuseStatement( FusedStatementPair<S1,S2>( ~s1, ~s2 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executes three statements in a single fused traversal.
+// \ingroup dense_vector
+//
+// \param s1 The first statement.
+// \param s2 The second statement.
+// \param s3 The third statement.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// See the two-statement overload of the fuse() function for details.
+*/
+template< typename S1    // Type of the first statement
+        , typename S2    // Type of the second statement
+        , typename S3 >  // Type of the third statement
+inline void fuse( const FusedStatement<S1>& s1, const FusedStatement<S2>& s2,
+                  const FusedStatement<S3>& s3 )
+{
+   typedef FusedStatementPair<S1,S2>  P1;
+
+   const P1 p1( ~s1, ~s2 );
+
+   fuseStatement( FusedStatementPair<P1,S3>( p1, ~s3 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executes four statements in a single fused traversal.
+// \ingroup dense_vector
+//
+// \param s1 The first statement.
+// \param s2 The second statement.
+// \param s3 The third statement.
+// \param s4 The fourth statement.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// See the two-statement overload of the fuse() function for details.
+*/
+template< typename S1    // Type of the first statement
+        , typename S2    // Type of the second statement
+        , typename S3    // Type of the third statement
+        , typename S4 >  // Type of the fourth statement
+inline void fuse( const FusedStatement<S1>& s1, const FusedStatement<S2>& s2,
+                  const FusedStatement<S3>& s3, const FusedStatement<S4>& s4 )
+{
+   typedef FusedStatementPair<S1,S2>  P1;
+   typedef FusedStatementPair<P1,S3>  P2;
+
+   const P1 p1( ~s1, ~s2 );
+   const P2 p2( p1, ~s3 );
+
+   fuseStatement( FusedStatementPair<P2,S4>( p2, ~s4 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executes five statements in a single fused traversal.
+// \ingroup dense_vector
+//
+// \param s1 The first statement.
+// \param s2 The second statement.
+// \param s3 The third statement.
+// \param s4 The fourth statement.
+// \param s5 The fifth statement.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// See the two-statement overload of the fuse() function for details.
+*/
+template< typename S1    // Type of the first statement
+        , typename S2    // Type of the second statement
+        , typename S3    // Type of the third statement
+        , typename S4    // Type of the fourth statement
+        , typename S5 >  // Type of the fifth statement
+inline void fuse( const FusedStatement<S1>& s1, const FusedStatement<S2>& s2,
+                  const FusedStatement<S3>& s3, const FusedStatement<S4>& s4,
+                  const FusedStatement<S5>& s5 )
+{
+   typedef FusedStatementPair<S1,S2>  P1;
+   typedef FusedStatementPair<P1,S3>  P2;
+   typedef FusedStatementPair<P2,S4>  P3;
+
+   const P1 p1( ~s1, ~s2 );
+   const P2 p2( p1, ~s3 );
+   const P3 p3( p2, ~s4 );
+
+   fuseStatement( FusedStatementPair<P3,S5>( p3, ~s5 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executes six statements in a single fused traversal.
+// \ingroup dense_vector
+//
+// \param s1 The first statement.
+// \param s2 The second statement.
+// \param s3 The third statement.
+// \param s4 The fourth statement.
+// \param s5 The fifth statement.
+// \param s6 The sixth statement.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// See the two-statement overload of the fuse() function for details.
+*/
+template< typename S1    // Type of the first statement
+        , typename S2    // Type of the second statement
+        , typename S3    // Type of the third statement
+        , typename S4    // Type of the fourth statement
+        , typename S5    // Type of the fifth statement
+        , typename S6 >  // Type of the sixth statement
+inline void fuse( const FusedStatement<S1>& s1, const FusedStatement<S2>& s2,
+                  const FusedStatement<S3>& s3, const FusedStatement<S4>& s4,
+                  const FusedStatement<S5>& s5, const FusedStatement<S6>& s6 )
+{
+   typedef FusedStatementPair<S1,S2>  P1;
+   typedef FusedStatementPair<P1,S3>  P2;
+   typedef FusedStatementPair<P2,S4>  P3;
+   typedef FusedStatementPair<P3,S5>  P4;
+
+   const P1 p1( ~s1, ~s2 );
+   const P2 p2( p1, ~s3 );
+   const P3 p3( p2, ~s4 );
+   const P4 p4( p3, ~s5 );
+
+   fuseStatement( FusedStatementPair<P4,S6>( p4, ~s6 ) );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,627 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Inversion.h
+//  \brief Header file for the dense matrix in-place and out-of-place inversion
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_INVERSION_H_
+#define _BLAZE_MATH_DENSE_INVERSION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <stdexcept>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/LowerMatrix.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/solvers/CholeskyDecomposition.h>
+#include <blaze/math/solvers/LUDecomposition.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/IsDiagonal.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsStrictlyTriangular.h>
+#include <blaze/math/typetraits/IsSymmetric.h>
+#include <blaze/math/typetraits/IsUniLower.h>
+#include <blaze/math/typetraits/IsUniUpper.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/math/UniLowerMatrix.h>
+#include <blaze/math/UpperMatrix.h>
+#include <blaze/util/constraints/FloatingPoint.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name DenseMatrix inversion functions */
+//@{
+template< typename MT, bool SO >
+inline void invert( DenseMatrix<MT,SO>& dm );
+
+template< typename MT, bool SO >
+inline const typename MT::ResultType inv( const DenseMatrix<MT,SO>& dm );
+//@}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INVERSION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place inversion of the given diagonal dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The diagonal dense matrix to be inverted.
+// \return void
+// \exception std::invalid_argument Inversion of singular matrix failed.
+*/
+template< typename MT >  // Type of the dense matrix
+void invertDiagonal( MT& A )
+{
+   typedef typename MT::ElementType  ET;
+
+   const MT& cA( A );
+
+   for( size_t i=0UL; i<cA.rows(); ++i ) {
+      if( isDefault( cA(i,i) ) )
+         throw std::invalid_argument( "Inversion of singular matrix failed" );
+      A(i,i) = ET(1) / cA(i,i);
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place inversion of the given lower triangular dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The lower triangular dense matrix to be inverted.
+// \param unit \a true in case the diagonal elements are known to be 1, \a false if not.
+// \return void
+// \exception std::invalid_argument Inversion of singular matrix failed.
+//
+// This function only accesses the lower part of the given matrix. The columns of the inverse
+// are computed from right to left; each column is multiplied with the already inverted trailing
+// diagonal block.
+*/
+template< typename MT >  // Type of the dense matrix
+void invertLower( MT& A, bool unit )
+{
+   typedef typename MT::ElementType  ET;
+
+   const MT& cA( A );
+   const size_t n( cA.rows() );
+
+   for( size_t j=n; j-->0UL; )
+   {
+      ET ajj( -1 );
+
+      if( !unit ) {
+         if( isDefault( cA(j,j) ) )
+            throw std::invalid_argument( "Inversion of singular matrix failed" );
+         A(j,j) = ET(1) / cA(j,j);
+         ajj = -cA(j,j);
+      }
+
+      for( size_t i=n; i-->j+1UL; ) {
+         ET sum( unit ? cA(i,j) : cA(i,i)*cA(i,j) );
+         for( size_t l=j+1UL; l<i; ++l )
+            sum += cA(i,l) * cA(l,j);
+         A(i,j) = sum * ajj;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place inversion of the given upper triangular dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The upper triangular dense matrix to be inverted.
+// \param unit \a true in case the diagonal elements are known to be 1, \a false if not.
+// \return void
+// \exception std::invalid_argument Inversion of singular matrix failed.
+//
+// This function only accesses the upper part of the given matrix. The columns of the inverse
+// are computed from left to right; each column is multiplied with the already inverted leading
+// diagonal block.
+*/
+template< typename MT >  // Type of the dense matrix
+void invertUpper( MT& A, bool unit )
+{
+   typedef typename MT::ElementType  ET;
+
+   const MT& cA( A );
+   const size_t n( cA.rows() );
+
+   for( size_t j=0UL; j<n; ++j )
+   {
+      ET ajj( -1 );
+
+      if( !unit ) {
+         if( isDefault( cA(j,j) ) )
+            throw std::invalid_argument( "Inversion of singular matrix failed" );
+         A(j,j) = ET(1) / cA(j,j);
+         ajj = -cA(j,j);
+      }
+
+      for( size_t i=0UL; i<j; ++i ) {
+         ET sum( unit ? cA(i,j) : cA(i,i)*cA(i,j) );
+         for( size_t l=i+1UL; l<j; ++l )
+            sum += cA(i,l) * cA(l,j);
+         A(i,j) = sum * ajj;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place inversion of the given general \f$ 2 \times 2 \f$ dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The \f$ 2 \times 2 \f$ dense matrix to be inverted.
+// \return void
+// \exception std::invalid_argument Inversion of singular matrix failed.
+*/
+template< typename MT >  // Type of the dense matrix
+void invert2x2( MT& A )
+{
+   typedef typename MT::ElementType  ET;
+
+   const MT& cA( A );
+
+   const ET a00( cA(0,0) ), a01( cA(0,1) );
+   const ET a10( cA(1,0) ), a11( cA(1,1) );
+
+   const ET det( a00*a11 - a01*a10 );
+
+   if( isDefault( det ) )
+      throw std::invalid_argument( "Inversion of singular matrix failed" );
+
+   const ET idet( ET(1) / det );
+
+   A(0,0) =  a11*idet;
+   A(0,1) = -a01*idet;
+   A(1,0) = -a10*idet;
+   A(1,1) =  a00*idet;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place inversion of the given general \f$ 3 \times 3 \f$ dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The \f$ 3 \times 3 \f$ dense matrix to be inverted.
+// \return void
+// \exception std::invalid_argument Inversion of singular matrix failed.
+//
+// The inverse is computed as the adjugate matrix divided by the determinant.
+*/
+template< typename MT >  // Type of the dense matrix
+void invert3x3( MT& A )
+{
+   typedef typename MT::ElementType  ET;
+
+   const MT& cA( A );
+
+   const ET a00( cA(0,0) ), a01( cA(0,1) ), a02( cA(0,2) );
+   const ET a10( cA(1,0) ), a11( cA(1,1) ), a12( cA(1,2) );
+   const ET a20( cA(2,0) ), a21( cA(2,1) ), a22( cA(2,2) );
+
+   const ET c00( a11*a22 - a12*a21 );
+   const ET c01( a12*a20 - a10*a22 );
+   const ET c02( a10*a21 - a11*a20 );
+
+   const ET det( a00*c00 + a01*c01 + a02*c02 );
+
+   if( isDefault( det ) )
+      throw std::invalid_argument( "Inversion of singular matrix failed" );
+
+   const ET idet( ET(1) / det );
+
+   A(0,0) = c00*idet;
+   A(0,1) = ( a02*a21 - a01*a22 )*idet;
+   A(0,2) = ( a01*a12 - a02*a11 )*idet;
+   A(1,0) = c01*idet;
+   A(1,1) = ( a00*a22 - a02*a20 )*idet;
+   A(1,2) = ( a02*a10 - a00*a12 )*idet;
+   A(2,0) = c02*idet;
+   A(2,1) = ( a01*a20 - a00*a21 )*idet;
+   A(2,2) = ( a00*a11 - a01*a10 )*idet;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place inversion of the given general \f$ N \times N \f$ dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The \f$ N \times N \f$ dense matrix to be inverted.
+// \return void
+// \exception std::invalid_argument Inversion of singular matrix failed.
+//
+// This function inverts small matrices of compile time size \a N by means of an in-place
+// Gauss-Jordan elimination with partial pivoting on a local array. Since all loop bounds are
+// compile time constants the loops are completely unrolled by the compiler.
+*/
+template< size_t N       // Number of rows and columns of the matrix
+        , typename MT >  // Type of the dense matrix
+void invertNxN( MT& A )
+{
+   using std::abs;
+   using std::swap;
+
+   typedef typename MT::ElementType  ET;
+
+   const MT& cA( A );
+
+   ET a[N][N];
+   size_t pivots[N];
+
+   for( size_t i=0UL; i<N; ++i )
+      for( size_t j=0UL; j<N; ++j )
+         a[i][j] = cA(i,j);
+
+   for( size_t k=0UL; k<N; ++k )
+   {
+      size_t pivot( k );
+      for( size_t i=k+1UL; i<N; ++i ) {
+         if( abs( a[i][k] ) > abs( a[pivot][k] ) )
+            pivot = i;
+      }
+
+      if( isDefault( a[pivot][k] ) )
+         throw std::invalid_argument( "Inversion of singular matrix failed" );
+
+      pivots[k] = pivot;
+
+      if( pivot != k ) {
+         for( size_t j=0UL; j<N; ++j )
+            swap( a[k][j], a[pivot][j] );
+      }
+
+      const ET inv( ET(1) / a[k][k] );
+      a[k][k] = ET(1);
+      for( size_t j=0UL; j<N; ++j )
+         a[k][j] *= inv;
+
+      for( size_t i=0UL; i<N; ++i ) {
+         if( i == k ) continue;
+         const ET factor( a[i][k] );
+         a[i][k] = ET(0);
+         for( size_t j=0UL; j<N; ++j )
+            a[i][j] -= factor * a[k][j];
+      }
+   }
+
+   for( size_t k=N; k-->0UL; ) {
+      if( pivots[k] != k ) {
+         for( size_t i=0UL; i<N; ++i )
+            swap( a[i][k], a[i][pivots[k]] );
+      }
+   }
+
+   for( size_t i=0UL; i<N; ++i )
+      for( size_t j=0UL; j<N; ++j )
+         A(i,j) = a[i][j];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place inversion of the given general dense matrix by means of an LU decomposition.
+// \ingroup dense_matrix
+//
+// \param A The dense matrix to be inverted.
+// \return void
+// \exception std::invalid_argument Inversion of singular matrix failed.
+//
+// This function computes the inverse \f$ A^{-1} = U^{-1} \cdot L^{-1} \cdot P \f$ based on the
+// blocked LU decomposition \f$ P \cdot A = L \cdot U \f$. The product of the two inverted
+// triangular factors is computed by the triangular UpperMatrix/UniLowerMatrix multiplication
+// kernel.
+*/
+template< typename MT >  // Type of the dense matrix
+void invertByLU( MT& A )
+{
+   using std::swap;
+
+   typedef typename MT::ElementType                   ET;
+   typedef DynamicMatrix<ET,columnMajor>              MatrixType;
+   typedef typename LUDecomposition<ET>::PivotVector  PivotVector;
+
+   const size_t n( A.rows() );
+
+   LUDecomposition<ET> lu;
+
+   try {
+      lu.factorize( A );
+   }
+   catch( std::invalid_argument& ) {
+      throw std::invalid_argument( "Inversion of singular matrix failed" );
+   }
+
+   const MatrixType& LU( lu.factors() );
+   MatrixType L( n, n, ET(0) ), U( n, n, ET(0) );
+
+   for( size_t j=0UL; j<n; ++j ) {
+      for( size_t i=0UL; i<=j; ++i )
+         U(i,j) = LU(i,j);
+      L(j,j) = ET(1);
+      for( size_t i=j+1UL; i<n; ++i )
+         L(i,j) = LU(i,j);
+   }
+
+   invertUpper( U, false );
+   invertLower( L, true  );
+
+   const UpperMatrix<MatrixType>    Uinv( U );
+   const UniLowerMatrix<MatrixType> Linv( L );
+
+   MatrixType R( Uinv * Linv );
+
+   const PivotVector& pivots( lu.pivots() );
+
+   for( size_t j=n; j-->0UL; ) {
+      if( pivots[j] != j ) {
+         for( size_t i=0UL; i<n; ++i )
+            swap( R(i,j), R(i,pivots[j]) );
+      }
+   }
+
+   A = R;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place inversion of the given general dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The dense matrix to be inverted.
+// \return void
+// \exception std::invalid_argument Inversion of singular matrix failed.
+//
+// Matrices up to a size of \f$ 6 \times 6 \f$ are inverted by the closed form and unrolled
+// kernels, all larger matrices by means of an LU decomposition. For matrices with compile time
+// size (as for instance StaticMatrix) the selection is resolved at compile time.
+*/
+template< typename MT >  // Type of the dense matrix
+void invertGeneral( MT& A )
+{
+   const MT& cA( A );
+
+   switch( cA.rows() ) {
+      case 0UL:                       break;
+      case 1UL: invertDiagonal ( A ); break;
+      case 2UL: invert2x2      ( A ); break;
+      case 3UL: invert3x3      ( A ); break;
+      case 4UL: invertNxN<4UL> ( A ); break;
+      case 5UL: invertNxN<5UL> ( A ); break;
+      case 6UL: invertNxN<6UL> ( A ); break;
+      default : invertByLU     ( A ); break;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place inversion of the given symmetric dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The symmetric dense matrix to be inverted.
+// \return void
+// \exception std::invalid_argument Inversion of singular matrix failed.
+//
+// Symmetric positive definite matrices larger than \f$ 6 \times 6 \f$ are inverted by means
+// of a Cholesky decomposition (\f$ A^{-1} = L^{-T} \cdot L^{-1} \f$), all other symmetric
+// matrices as general matrices. Only the lower part of the inverse is written to the given
+// matrix.
+*/
+template< typename MT >  // Type of the dense matrix
+void invertSymmetric( MT& A )
+{
+   typedef typename MT::ElementType       ET;
+   typedef DynamicMatrix<ET,columnMajor>  MatrixType;
+
+   const size_t n( A.rows() );
+
+   MatrixType R( A );
+   bool inverted( false );
+
+   if( n > 6UL )
+   {
+      CholeskyDecomposition<ET> llt;
+
+      try {
+         llt.factorize( R );
+      }
+      catch( std::invalid_argument& ) {}
+
+      if( llt.size() == n ) {
+         MatrixType L( llt.factor() );
+         invertLower( L, false );
+         const LowerMatrix<MatrixType> Linv( L );
+         R = trans( Linv ) * Linv;
+         inverted = true;
+      }
+   }
+
+   if( !inverted )
+      invertGeneral( R );
+
+   for( size_t j=0UL; j<n; ++j )
+      for( size_t i=j; i<n; ++i )
+         A(i,j) = R(i,j);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief In-place inversion of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The dense matrix to be inverted.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Inversion of singular matrix failed.
+//
+// This function inverts the given dense square matrix in-place:
+
+   \code
+   blaze::StaticMatrix<double,3UL,3UL> A;
+   blaze::DynamicMatrix<double> B;
+   // ... Resizing and initialization
+
+   invert( A );  // Inversion of a 3x3 matrix by the closed form kernel
+   invert( B );  // Inversion of a general matrix
+   \endcode
+
+// The inversion algorithm is selected depending on the type of the matrix:
+//  - diagonal matrices (DiagonalMatrix) are inverted element-wise
+//  - lower and upper triangular matrices (LowerMatrix, UniLowerMatrix, UpperMatrix and
+//    UniUpperMatrix) are inverted in-place by triangular substitution
+//  - symmetric matrices (SymmetricMatrix) are inverted by means of a Cholesky decomposition
+//    (if positive definite) and retain their symmetry
+//  - general matrices up to a size of \f$ 6 \times 6 \f$ are inverted by closed form and
+//    unrolled kernels, larger matrices by means of a blocked LU decomposition
+//
+// In case the given matrix is not a square matrix or in case it is singular, a
+// \a std::invalid_argument exception is thrown. Note that the element type of the matrix
+// must be a built-in floating point data type.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline void invert( DenseMatrix<MT,SO>& dm )
+{
+   typedef typename MT::ElementType  ET;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( ET );
+
+   if( !isSquare( ~dm ) )
+      throw std::invalid_argument( "Invalid non-square matrix provided" );
+
+   if( IsStrictlyTriangular<MT>::value && (~dm).rows() > 0UL )
+      throw std::invalid_argument( "Inversion of singular matrix failed" );
+
+   if( IsDiagonal<MT>::value )
+      invertDiagonal( ~dm );
+   else if( IsLower<MT>::value )
+      invertLower( ~dm, IsUniLower<MT>::value );
+   else if( IsUpper<MT>::value )
+      invertUpper( ~dm, IsUniUpper<MT>::value );
+   else if( IsSymmetric<MT>::value )
+      invertSymmetric( ~dm );
+   else
+      invertGeneral( ~dm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculation of the inverse of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The dense matrix to be inverted.
+// \return The inverse of the matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Inversion of singular matrix failed.
+//
+// This function returns the inverse of the given dense square matrix. The inverse is of the
+// same kind as the given matrix (for instance the inverse of a LowerMatrix is a LowerMatrix):
+
+   \code
+   blaze::StaticMatrix<double,6UL,6UL> A, B;
+   // ... Initialization
+
+   B = inv( A );
+   \endcode
+
+// In case the given matrix is not a square matrix or in case it is singular, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline const typename MT::ResultType inv( const DenseMatrix<MT,SO>& dm )
+{
+   typename MT::ResultType tmp( ~dm );
+   invert( tmp );
+   return tmp;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,554 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/MMM.h
+//  \brief Header file for the cache-blocked dense matrix/dense matrix multiplication kernel
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_MMM_H_
+#define _BLAZE_MATH_DENSE_MMM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/constraints/DenseMatrix.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/IsOne.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/system/CacheSize.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/policies/Deallocate.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/UniqueArray.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS MMMBLOCKING
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Block sizes of the cache-blocked dense matrix/dense matrix multiplication kernel.
+// \ingroup dense_matrix
+//
+// The MMMBlocking class template determines the sizes of the register tiles and of the packed
+// panels used by the mmm() kernel for the given element type \a T. The register tile consists
+// of \a mr rows and \a nr columns (two intrinsic vectors). The depth \a kc of the packed panels
+// is chosen such that a single \a nr wide sliver of the right-hand side panel fits into half of
+// the L1 cache. The \a mc rows of the packed left-hand side block occupy half of the L2 cache
+// and the \a nc columns of the packed right-hand side panel occupy half of the outermost cache
+// level (see the blaze/config/CacheSize.h configuration file).
+*/
+template< typename T >  // Type of the matrix elements
+struct MMMBlocking
+{
+   //**Type definitions****************************************************************************
+   typedef IntrinsicTrait<T>  IT;  //!< Intrinsic trait for the matrix element type.
+   //**********************************************************************************************
+
+   //**Block sizes*********************************************************************************
+   static const size_t mr = 4UL;                //!< Number of rows of a register tile.
+   static const size_t nr = 2UL * IT::size;     //!< Number of columns of a register tile.
+
+   //! Depth of the packed panels.
+   static const size_t kc = ( l1CacheSize / ( 2UL*nr*sizeof(T) ) > 16UL )
+                            ?( l1CacheSize / ( 2UL*nr*sizeof(T) ) )
+                            :( 16UL );
+
+   //! Number of rows of the packed left-hand side block.
+   static const size_t mc = ( l2CacheSize / ( 2UL*kc*sizeof(T) ) > mr )
+                            ?( l2CacheSize / ( 2UL*kc*sizeof(T) ) / mr * mr )
+                            :( mr );
+
+   //! Number of columns of the packed right-hand side panel.
+   static const size_t nc = ( cacheSize / ( 2UL*kc*sizeof(T) ) > nr )
+                            ?( cacheSize / ( 2UL*kc*sizeof(T) ) / nr * nr )
+                            :( nr );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T > const size_t MMMBlocking<T>::mr;
+template< typename T > const size_t MMMBlocking<T>::nr;
+template< typename T > const size_t MMMBlocking<T>::kc;
+template< typename T > const size_t MMMBlocking<T>::mc;
+template< typename T > const size_t MMMBlocking<T>::nc;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS MMMOPERANDS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Operand access of the cache-blocked dense matrix/dense matrix multiplication kernel.
+// \ingroup dense_matrix
+//
+// The mmm() kernel always vectorizes along the contiguous dimension of the target matrix. This
+// class template maps the row-major formulation \f$ C=A*B \f$ of the kernel to the operands of
+// the multiplication. For row-major target matrices the operands are used as given.
+*/
+template< typename MT1  // Type of the left-hand side matrix operand
+        , typename MT2  // Type of the right-hand side matrix operand
+        , bool SO >     // Storage order of the target matrix
+struct MMMOperands
+{
+   //**Type definitions****************************************************************************
+   typedef typename MT1::ElementType  ElementType;  //!< Element type of the matrix operands.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   enum { lowerLhs = IsLower<MT1>::value };  //!< Lower structure of the packed left-hand side.
+   enum { upperLhs = IsUpper<MT1>::value };  //!< Upper structure of the packed left-hand side.
+   enum { lowerRhs = IsLower<MT2>::value };  //!< Lower structure of the packed right-hand side.
+   enum { upperRhs = IsUpper<MT2>::value };  //!< Upper structure of the packed right-hand side.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   static inline size_t rows   ( const MT1& A, const MT2&   ) { return A.rows();    }
+   static inline size_t columns( const MT1&  , const MT2& B ) { return B.columns(); }
+   static inline size_t depth  ( const MT1& A, const MT2&   ) { return A.columns(); }
+
+   static inline ElementType lhs( const MT1& A, const MT2&, size_t i, size_t k ) { return A(i,k); }
+   static inline ElementType rhs( const MT1&, const MT2& B, size_t k, size_t j ) { return B(k,j); }
+
+   template< typename MT3 >
+   static BLAZE_ALWAYS_INLINE typename MT3::IntrinsicType load( const MT3& C, size_t i, size_t j ) {
+      return C.load( i, j );
+   }
+
+   template< typename MT3 >
+   static BLAZE_ALWAYS_INLINE void store( MT3& C, size_t i, size_t j, const typename MT3::IntrinsicType& value ) {
+      C.store( i, j, value );
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the MMMOperands class template for column-major target matrices.
+// \ingroup dense_matrix
+//
+// For column-major target matrices the kernel computes the row-major product \f$ C^T=B^T*A^T \f$,
+// i.e. the roles of the operands are swapped and both operands are accessed transposed.
+*/
+template< typename MT1  // Type of the left-hand side matrix operand
+        , typename MT2 >  // Type of the right-hand side matrix operand
+struct MMMOperands<MT1,MT2,true>
+{
+   //**Type definitions****************************************************************************
+   typedef typename MT1::ElementType  ElementType;  //!< Element type of the matrix operands.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   enum { lowerLhs = IsUpper<MT2>::value };  //!< Lower structure of the packed left-hand side.
+   enum { upperLhs = IsLower<MT2>::value };  //!< Upper structure of the packed left-hand side.
+   enum { lowerRhs = IsUpper<MT1>::value };  //!< Lower structure of the packed right-hand side.
+   enum { upperRhs = IsLower<MT1>::value };  //!< Upper structure of the packed right-hand side.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   static inline size_t rows   ( const MT1&  , const MT2& B ) { return B.columns(); }
+   static inline size_t columns( const MT1& A, const MT2&   ) { return A.rows();    }
+   static inline size_t depth  ( const MT1& A, const MT2&   ) { return A.columns(); }
+
+   static inline ElementType lhs( const MT1&, const MT2& B, size_t i, size_t k ) { return B(k,i); }
+   static inline ElementType rhs( const MT1& A, const MT2&, size_t k, size_t j ) { return A(j,k); }
+
+   template< typename MT3 >
+   static BLAZE_ALWAYS_INLINE typename MT3::IntrinsicType load( const MT3& C, size_t i, size_t j ) {
+      return C.load( j, i );
+   }
+
+   template< typename MT3 >
+   static BLAZE_ALWAYS_INLINE void store( MT3& C, size_t i, size_t j, const typename MT3::IntrinsicType& value ) {
+      C.store( j, i, value );
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MMM KERNEL
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packing of a block of the left-hand side operand of the mmm() kernel.
+// \ingroup dense_matrix
+//
+// \param Ap The target buffer for the packed block.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param ibegin The first row of the block.
+// \param iend The end of the row range of the block.
+// \param kbegin The first column of the block.
+// \param kend The end of the column range of the block.
+// \return void
+//
+// This function packs the given block into slivers of \a mr rows. Within a sliver the \a mr
+// values of each column are stored contiguously. Incomplete slivers are padded with zeros.
+*/
+template< typename OP     // Type of the operand access
+        , typename MT1    // Type of the left-hand side matrix operand
+        , typename MT2 >  // Type of the right-hand side matrix operand
+void mmmPackLhs( typename OP::ElementType* Ap, const MT1& A, const MT2& B,
+                 size_t ibegin, size_t iend, size_t kbegin, size_t kend )
+{
+   typedef typename OP::ElementType  ET;
+
+   const size_t mr( MMMBlocking<ET>::mr );
+
+   for( size_t i=ibegin; i<iend; i+=mr ) {
+      const size_t ilast( min( i+mr, iend ) );
+      for( size_t k=kbegin; k<kend; ++k ) {
+         size_t ii( i );
+         for( ; ii<ilast; ++ii )
+            *Ap++ = OP::lhs( A, B, ii, k );
+         for( ; ii<i+mr; ++ii )
+            *Ap++ = ET();
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packing of a panel of the right-hand side operand of the mmm() kernel.
+// \ingroup dense_matrix
+//
+// \param Bp The target buffer for the packed panel.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param kbegin The first row of the panel.
+// \param kend The end of the row range of the panel.
+// \param jbegin The first column of the panel.
+// \param jend The end of the column range of the panel.
+// \return void
+//
+// This function packs the given panel into slivers of \a nr columns. Within a sliver the \a nr
+// values of each row are stored contiguously, which enables aligned loads of the values in the
+// micro kernel. Incomplete slivers are padded with zeros.
+*/
+template< typename OP     // Type of the operand access
+        , typename MT1    // Type of the left-hand side matrix operand
+        , typename MT2 >  // Type of the right-hand side matrix operand
+void mmmPackRhs( typename OP::ElementType* Bp, const MT1& A, const MT2& B,
+                 size_t kbegin, size_t kend, size_t jbegin, size_t jend )
+{
+   typedef typename OP::ElementType  ET;
+
+   const size_t nr( MMMBlocking<ET>::nr );
+
+   for( size_t j=jbegin; j<jend; j+=nr ) {
+      const size_t jlast( min( j+nr, jend ) );
+      for( size_t k=kbegin; k<kend; ++k ) {
+         size_t jj( j );
+         for( ; jj<jlast; ++jj )
+            *Bp++ = OP::rhs( A, B, k, jj );
+         for( ; jj<j+nr; ++jj )
+            *Bp++ = ET();
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Micro kernel of the mmm() kernel.
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param ap The packed \a mr row sliver of the left-hand side operand.
+// \param bp The packed \a nr column sliver of the right-hand side operand.
+// \param kc The number of rank-1 updates.
+// \param i The first row of the register tile.
+// \param j The first column of the register tile.
+// \param m The number of valid rows of the register tile.
+// \param n The number of valid columns of the register tile.
+// \param alpha The scaling factor for the product.
+// \param beta The scaling factor for the target matrix.
+// \param overwrite \a true in case the values of the target matrix are to be discarded.
+// \param scale \a true in case the values of the target matrix are to be scaled by \a beta.
+// \return void
+//
+// This function computes the product of a packed sliver of \a mr rows and a packed sliver of
+// \a nr columns in intrinsic registers and updates the according register tile of the target
+// matrix.
+*/
+template< typename OP   // Type of the operand access
+        , typename MT >  // Type of the target dense matrix
+BLAZE_ALWAYS_INLINE void mmmMicroKernel( MT& C, const typename OP::ElementType* ap,
+                                         const typename OP::ElementType* bp, size_t kc,
+                                         size_t i, size_t j, size_t m, size_t n,
+                                         const typename MT::IntrinsicType& alpha,
+                                         const typename MT::IntrinsicType& beta,
+                                         bool overwrite, bool scale )
+{
+   typedef typename OP::ElementType    ET;
+   typedef typename MT::IntrinsicType  IntrinsicType;
+   typedef IntrinsicTrait<ET>          IT;
+
+   IntrinsicType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
+
+   for( size_t k=0UL; k<kc; ++k ) {
+      const IntrinsicType b1( load( bp          ) );
+      const IntrinsicType b2( load( bp+IT::size ) );
+      IntrinsicType a1( set( ap[0] ) );
+      xmm1 = xmm1 + a1 * b1;
+      xmm2 = xmm2 + a1 * b2;
+      a1 = set( ap[1] );
+      xmm3 = xmm3 + a1 * b1;
+      xmm4 = xmm4 + a1 * b2;
+      a1 = set( ap[2] );
+      xmm5 = xmm5 + a1 * b1;
+      xmm6 = xmm6 + a1 * b2;
+      a1 = set( ap[3] );
+      xmm7 = xmm7 + a1 * b1;
+      xmm8 = xmm8 + a1 * b2;
+      ap += MMMBlocking<ET>::mr;
+      bp += MMMBlocking<ET>::nr;
+   }
+
+   const IntrinsicType xmm[4][2] = { { xmm1, xmm2 }, { xmm3, xmm4 }, { xmm5, xmm6 }, { xmm7, xmm8 } };
+
+   for( size_t ii=0UL; ii<m; ++ii ) {
+      for( size_t jj=0UL; jj<2UL && jj*IT::size<n; ++jj )
+      {
+         const size_t jt( j+jj*IT::size );
+
+         if( overwrite )
+            OP::store( C, i+ii, jt, xmm[ii][jj] * alpha );
+         else if( scale )
+            OP::store( C, i+ii, jt, OP::load( C, i+ii, jt ) * beta + xmm[ii][jj] * alpha );
+         else
+            OP::store( C, i+ii, jt, OP::load( C, i+ii, jt ) + xmm[ii][jj] * alpha );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scaling of a block of the target matrix of the mmm() kernel.
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param ibegin The first row of the block.
+// \param iend The end of the row range of the block.
+// \param jbegin The first column of the block.
+// \param jend The end of the column range of the block.
+// \param beta The scaling factor for the target matrix.
+// \param overwrite \a true in case the block is to be reset.
+// \return void
+//
+// This function handles blocks of the target matrix that do not receive any contribution from
+// the product due to the triangular structure of the operands.
+*/
+template< typename OP   // Type of the operand access
+        , typename MT >  // Type of the target dense matrix
+void mmmScaleBlock( MT& C, size_t ibegin, size_t iend, size_t jbegin, size_t jend,
+                    const typename MT::IntrinsicType& beta, bool overwrite )
+{
+   typedef typename MT::IntrinsicType                IntrinsicType;
+   typedef IntrinsicTrait<typename OP::ElementType>  IT;
+
+   for( size_t i=ibegin; i<iend; ++i ) {
+      for( size_t j=jbegin; j<jend; j+=IT::size ) {
+         if( overwrite )
+            OP::store( C, i, j, IntrinsicType() );
+         else
+            OP::store( C, i, j, OP::load( C, i, j ) * beta );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Cache-blocked dense matrix/dense matrix multiplication (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for the product \f$ A*B \f$.
+// \param beta The scaling factor for the target matrix \f$ C \f$.
+// \return void
+//
+// This function implements a cache-blocked, vectorized kernel for the multiplication of two
+// large dense matrices. The operands are copied block by block into contiguous, aligned buffers
+// (with the block sizes determined by the MMMBlocking class template) and the product of the
+// packed blocks is computed by an intrinsic micro kernel on register tiles. In case \a beta is
+// zero the initial values of the target matrix are not read. Blocks that do not contribute to
+// the product due to the lower or upper triangular structure of an operand are skipped.
+//
+// The function expects that all three matrices are vectorizable, have the same element type
+// and provide the vectorized addition and multiplication of their elements. The target matrix
+// is accessed via aligned intrinsic loads and stores along its contiguous dimension (i.e.
+// including the padding elements). Note that the target matrix must not be aliased with any of
+// the two operands.
+*/
+template< typename MT1  // Type of the target dense matrix
+        , bool SO       // Storage order of the target dense matrix
+        , typename MT2  // Type of the left-hand side matrix operand
+        , typename MT3  // Type of the right-hand side matrix operand
+        , typename ST >  // Type of the scaling factors
+void mmm( DenseMatrix<MT1,SO>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+{
+   typedef typename MT1::ElementType    ET;
+   typedef typename MT1::IntrinsicType  IntrinsicType;
+   typedef MMMOperands<MT2,MT3,SO>      OP;
+   typedef MMMBlocking<ET>              BS;
+
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ET, typename MT2::ElementType );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ET, typename MT3::ElementType );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ET, ST );
+
+   BLAZE_INTERNAL_ASSERT( A.rows()    == (~C).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( B.columns() == (~C).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( A.columns() == B.rows()      , "Invalid matrix sizes"      );
+
+   const size_t M( OP::rows   ( A, B ) );
+   const size_t N( OP::columns( A, B ) );
+   const size_t K( OP::depth  ( A, B ) );
+
+   const bool reset( isDefault( beta ) );
+   const bool scale( !reset && !isOne( beta ) );
+
+   const IntrinsicType factor1( set( alpha ) );
+   const IntrinsicType factor2( set( beta  ) );
+
+   const size_t mc( min( BS::mc, M ) );
+   const size_t nc( min( BS::nc, N ) );
+   const size_t kc( min( BS::kc, K ) );
+
+   UniqueArray<ET,Deallocate> Ap( allocate<ET>( ( ( mc + BS::mr - 1UL ) / BS::mr ) * BS::mr * kc ) );
+   UniqueArray<ET,Deallocate> Bp( allocate<ET>( ( ( nc + BS::nr - 1UL ) / BS::nr ) * BS::nr * kc ) );
+
+   for( size_t jj=0UL; jj<N; jj+=BS::nc )
+   {
+      const size_t jend( min( jj+BS::nc, N ) );
+
+      const size_t kbeginB( ( OP::lowerRhs )?( jj ):( 0UL ) );
+      const size_t kendB  ( ( OP::upperRhs )?( min( jend, K ) ):( K ) );
+
+      for( size_t kk=0UL; kk<K; kk+=BS::kc )
+      {
+         const size_t kbegin( max( kk, kbeginB ) );
+         const size_t kend  ( min( kk+BS::kc, kendB ) );
+
+         if( kbegin < kend ) {
+            mmmPackRhs<OP>( Bp.get(), A, B, kbegin, kend, jj, jend );
+         }
+
+         for( size_t ii=0UL; ii<M; ii+=BS::mc )
+         {
+            const size_t iend( min( ii+BS::mc, M ) );
+
+            const size_t kfirst( max( ( OP::upperLhs )?( ii ):( 0UL ), kbeginB ) );
+            const size_t klast ( min( ( OP::lowerLhs )?( min( iend, K ) ):( K ), kendB ) );
+
+            if( kfirst >= klast ) {
+               if( kk == 0UL && ( reset || scale ) )
+                  mmmScaleBlock<OP>( ~C, ii, iend, jj, jend, factor2, reset );
+               continue;
+            }
+
+            const size_t kb( max( kbegin, kfirst ) );
+            const size_t ke( min( kend  , klast  ) );
+
+            if( kb >= ke ) continue;
+
+            const bool first( kb == kfirst );
+
+            mmmPackLhs<OP>( Ap.get(), A, B, ii, iend, kb, ke );
+
+            for( size_t j=jj; j<jend; j+=BS::nr )
+            {
+               const ET* const bp( Bp.get() + ( j-jj )*( kend-kbegin ) + ( kb-kbegin )*BS::nr );
+
+               for( size_t i=ii; i<iend; i+=BS::mr )
+               {
+                  const ET* const ap( Ap.get() + ( i-ii )*( ke-kb ) );
+
+                  mmmMicroKernel<OP>( ~C, ap, bp, ke-kb, i, j, min( BS::mr, iend-i ), jend-j,
+                                      factor1, factor2, first && reset, first && scale );
+               }
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,3095 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/PackedMatrix.h
+//  \brief Header file for the implementation of a dense matrix with packed storage
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_PACKEDMATRIX_H_
+#define _BLAZE_MATH_DENSE_PACKEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <blaze/math/dense/DenseMatrix.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/PackingType.h>
+#include <blaze/math/shims/Clear.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/traits/AddTrait.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/DivTrait.h>
+#include <blaze/math/traits/MathTrait.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsDiagonal.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsSparseMatrix.h>
+#include <blaze/math/typetraits/IsSymmetric.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Restrict.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/SelectType.h>
+#include <blaze/util/Template.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsConst.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup packed_matrix PackedMatrix
+// \ingroup dense_matrix
+*/
+/*!\brief Efficient implementation of a square \f$ N \times N \f$ matrix with packed storage.
+// \ingroup packed_matrix
+//
+// The PackedMatrix class template is the representation of a square dense matrix that only
+// stores the structurally non-zero part of a triangular, symmetric or diagonal matrix. In
+// comparison to a DynamicMatrix, a triangular or symmetric packed matrix requires only
+// \f$ N \cdot (N+1) / 2 \f$ elements and a diagonal packed matrix requires only \f$ N \f$
+// elements. The type of the elements, the packing type and the storage order of the matrix
+// can be specified via the three template parameters:
+
+   \code
+   template< typename Type, PackingType PT, bool SO >
+   class PackedMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. PackedMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - PT  : specifies the stored part of the matrix (\a blaze::packedLower, \a blaze::packedUpper,
+//          \a blaze::packedSymmetric, or \a blaze::packedDiagonal).
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::rowMajor.
+//
+// Depending on the storage order, the stored elements of each row or column are stored
+// contiguously. In case of a row-major packed lower matrix, for instance, the elements are
+// stored in the following order:
+
+                          \f[\left(\begin{array}{*{4}{c}}
+                          0 &   &   &   \\
+                          1 & 2 &   &   \\
+                          3 & 4 & 5 &   \\
+                          6 & 7 & 8 & 9 \\
+                          \end{array}\right)\f]
+
+// A symmetric packed matrix stores the lower part in case of row-major matrices and the
+// upper part in case of column-major matrices, i.e. the first \f$ i+1 \f$ elements of each
+// row/column \a i are stored contiguously.
+//
+// PackedMatrix is primarily intended as the underlying storage of the LowerMatrix, UpperMatrix,
+// SymmetricMatrix and DiagonalMatrix adaptors, which guard the according matrix invariant and
+// provide the structural information that is exploited by the matrix operations:
+
+   \code
+   using blaze::PackedMatrix;
+   using blaze::LowerMatrix;
+   using blaze::SymmetricMatrix;
+   using blaze::DiagonalMatrix;
+
+   // Packed lower and symmetric 20000x20000 matrices, each requiring approx. 1.6 GByte
+   LowerMatrix< PackedMatrix<double,blaze::packedLower> >          L( 20000UL );
+   SymmetricMatrix< PackedMatrix<double,blaze::packedSymmetric> >  S( 20000UL );
+
+   // Packed 20000x20000 diagonal matrix, requiring 160 kByte
+   DiagonalMatrix< PackedMatrix<double,blaze::packedDiagonal> >    D( 20000UL );
+
+   blaze::DynamicVector<double> x, y;
+   // ... Initialization
+
+   y = L * x;      // Lower matrix/vector multiplication
+   y = S * x;      // Symmetric matrix/vector multiplication
+   L = L * L;      // Multiplication of two lower matrices, evaluated in packed storage
+   S = D * S * D;  // Symmetric result, explicitly checked
+   \endcode
+
+// A PackedMatrix can also be used on its own. In this case all assignments are checked to
+// comply with the packing type; an assignment of a matrix that cannot be represented results
+// in a \a std::invalid_argument exception. Since the non-stored elements of a lower, upper or
+// diagonal packed matrix are not represented in memory, write access to any of these elements
+// via the function call operator has no effect. Use the according adaptor to detect invalid
+// element assignments:
+
+   \code
+   PackedMatrix<int,blaze::packedLower> A( 3UL, 3UL, 1 );
+
+   A(2,0) = 2;  // Assignment to the lower part of the matrix
+   A(0,2) = 2;  // No effect, A(0,2) remains 0
+
+   LowerMatrix< PackedMatrix<int,blaze::packedLower> > L( 3UL );
+
+   L(0,2) = 2;  // Invalid assignment to upper matrix element; results in an exception!
+   \endcode
+
+// Note that in contrast to the other dense matrix types PackedMatrix does not provide low-level
+// access to rows and columns and is therefore never considered by the BLAS-based kernels. All
+// operations access the elements via the function call operator and benefit from the structural
+// information of the enclosing adaptor. The (unaligned) assignment from dense matrices with
+// direct data access and matching storage order is vectorized along the stored part of each
+// row/column.
+*/
+template< typename Type                    // Data type of the matrix
+        , PackingType PT                   // Packing type
+        , bool SO = defaultStorageOrder >  // Storage order
+class PackedMatrix : public DenseMatrix< PackedMatrix<Type,PT,SO>, SO >
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef IntrinsicTrait<Type>  IT;  //!< Intrinsic trait for the matrix element type.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Compilation switch for the storage layout of the packed rows/columns.
+   /*! The \a prefix compilation switch indicates whether the first \f$ i+1 \f$ elements of each
+       row/column \a i are stored (\a prefix), or whether all elements from the diagonal to the
+       end of each row/column are stored. */
+   enum { prefix = ( PT == packedSymmetric ) ||
+                   ( PT == packedLower && !SO ) ||
+                   ( PT == packedUpper &&  SO ) };
+
+   //! Compilation switch for diagonal packing.
+   enum { diagonal = ( PT == packedDiagonal ) };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef PackedMatrix<Type,PT,SO>   This;            //!< Type of this PackedMatrix instance.
+   typedef This                       ResultType;      //!< Result type for expression template evaluations.
+   typedef PackedMatrix<Type,PT,!SO>  OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef Type                       ElementType;     //!< Type of the matrix elements.
+   typedef typename IT::Type          IntrinsicType;   //!< Intrinsic type of the matrix elements.
+   typedef const Type&                ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                CompositeType;   //!< Data type for composite expression templates.
+   typedef Type&                      Reference;       //!< Reference to a non-constant matrix value.
+   typedef const Type&                ConstReference;  //!< Reference to a constant matrix value.
+   typedef Type*                      Pointer;         //!< Pointer to a non-constant matrix value.
+   typedef const Type*                ConstPointer;    //!< Pointer to a constant matrix value.
+
+   //! Transpose type for expression template evaluations.
+   typedef PackedMatrix< Type
+                       , ( PT == packedLower )?( packedUpper )
+                                              :( ( PT == packedUpper )?( packedLower ):( PT ) )
+                       , !SO >  TransposeType;
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a PackedMatrix with different data/element type.
+   */
+   template< typename ET >  // Data type of the other matrix
+   struct Rebind {
+      typedef PackedMatrix<ET,PT,SO>  Other;  //!< The type of the other PackedMatrix.
+   };
+   //**********************************************************************************************
+
+   //**PackedIterator class definition*************************************************************
+   /*!\brief Iterator over the elements of a row/column of the packed matrix.
+   //
+   // The PackedIterator traverses all elements of a row/column, including the elements that
+   // are not stored explicitly.
+   */
+   template< typename MatrixType >  // Type of the packed matrix
+   class PackedIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      //! Return type for the access to the value of a matrix element.
+      typedef typename IfTrue< IsConst<MatrixType>::value, const Type&, Type& >::Type  RT;
+
+      //! Pointer type for the access to the value of a matrix element.
+      typedef typename IfTrue< IsConst<MatrixType>::value, const Type*, Type* >::Type  PT2;
+
+      typedef std::random_access_iterator_tag  IteratorCategory;  //!< The iterator category.
+      typedef Type                             ValueType;         //!< Type of the underlying elements.
+      typedef PT2                              PointerType;       //!< Pointer return type.
+      typedef RT                               ReferenceType;     //!< Reference return type.
+      typedef ptrdiff_t                        DifferenceType;    //!< Difference between two iterators.
+
+      // STL iterator requirements
+      typedef IteratorCategory  iterator_category;  //!< The iterator category.
+      typedef ValueType         value_type;         //!< Type of the underlying elements.
+      typedef PointerType       pointer;            //!< Pointer return type.
+      typedef ReferenceType     reference;          //!< Reference return type.
+      typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Default constructor of the PackedIterator class.
+      */
+      inline PackedIterator()
+         : matrix_( NULL )  // Pointer to the packed matrix
+         , line_  ( 0UL  )  // The current row/column of the packed matrix
+         , index_ ( 0UL  )  // The current index within the row/column
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor of the PackedIterator class.
+      //
+      // \param matrix The packed matrix.
+      // \param line The row/column of the packed matrix.
+      // \param index The initial index within the row/column.
+      */
+      inline PackedIterator( MatrixType& matrix, size_t line, size_t index )
+         : matrix_( &matrix )  // Pointer to the packed matrix
+         , line_  ( line    )  // The current row/column of the packed matrix
+         , index_ ( index   )  // The current index within the row/column
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Conversion constructor from different PackedIterator instances.
+      //
+      // \param it The iterator to be copied.
+      */
+      template< typename MatrixType2 >
+      inline PackedIterator( const PackedIterator<MatrixType2>& it )
+         : matrix_( it.matrix_ )  // Pointer to the packed matrix
+         , line_  ( it.line_   )  // The current row/column of the packed matrix
+         , index_ ( it.index_  )  // The current index within the row/column
+      {}
+      //*******************************************************************************************
+
+      //**Addition assignment operator*************************************************************
+      /*!\brief Addition assignment operator.
+      //
+      // \param inc The increment of the iterator.
+      // \return The incremented iterator.
+      */
+      inline PackedIterator& operator+=( size_t inc ) {
+         index_ += inc;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction assignment operator**********************************************************
+      /*!\brief Subtraction assignment operator.
+      //
+      // \param dec The decrement of the iterator.
+      // \return The decremented iterator.
+      */
+      inline PackedIterator& operator-=( size_t dec ) {
+         index_ -= dec;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline PackedIterator& operator++() {
+         ++index_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const PackedIterator operator++( int ) {
+         const PackedIterator tmp( *this );
+         ++index_;
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Prefix decrement operator****************************************************************
+      /*!\brief Pre-decrement operator.
+      //
+      // \return Reference to the decremented iterator.
+      */
+      inline PackedIterator& operator--() {
+         --index_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix decrement operator***************************************************************
+      /*!\brief Post-decrement operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const PackedIterator operator--( int ) {
+         const PackedIterator tmp( *this );
+         --index_;
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the element at the current iterator position.
+      //
+      // \return The resulting value.
+      */
+      inline ReferenceType operator*() const {
+         return ( SO )?( (*matrix_)(index_,line_) ):( (*matrix_)(line_,index_) );
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two PackedIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      inline bool operator==( const PackedIterator& rhs ) const {
+         return index_ == rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two PackedIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      inline bool operator!=( const PackedIterator& rhs ) const {
+         return index_ != rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Less-than operator***********************************************************************
+      /*!\brief Less-than comparison between two PackedIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller, \a false if not.
+      */
+      inline bool operator<( const PackedIterator& rhs ) const {
+         return index_ < rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Greater-than operator********************************************************************
+      /*!\brief Greater-than comparison between two PackedIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater, \a false if not.
+      */
+      inline bool operator>( const PackedIterator& rhs ) const {
+         return index_ > rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Less-or-equal-than operator**************************************************************
+      /*!\brief Less-than comparison between two PackedIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
+      */
+      inline bool operator<=( const PackedIterator& rhs ) const {
+         return index_ <= rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Greater-or-equal-than operator***********************************************************
+      /*!\brief Greater-than comparison between two PackedIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+      */
+      inline bool operator>=( const PackedIterator& rhs ) const {
+         return index_ >= rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two iterators.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      */
+      inline DifferenceType operator-( const PackedIterator& rhs ) const {
+         return index_ - rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between a PackedIterator and an integral value.
+      //
+      // \param it The iterator to be incremented.
+      // \param inc The number of elements the iterator is incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const PackedIterator operator+( const PackedIterator& it, size_t inc ) {
+         return PackedIterator( *it.matrix_, it.line_, it.index_ + inc );
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between an integral value and a PackedIterator.
+      //
+      // \param inc The number of elements the iterator is incremented.
+      // \param it The iterator to be incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const PackedIterator operator+( size_t inc, const PackedIterator& it ) {
+         return PackedIterator( *it.matrix_, it.line_, it.index_ + inc );
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Subtraction between a PackedIterator and an integral value.
+      //
+      // \param it The iterator to be decremented.
+      // \param dec The number of elements the iterator is decremented.
+      // \return The decremented iterator.
+      */
+      friend inline const PackedIterator operator-( const PackedIterator& it, size_t dec ) {
+         return PackedIterator( *it.matrix_, it.line_, it.index_ - dec );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      MatrixType* matrix_;  //!< Pointer to the packed matrix.
+      size_t      line_;    //!< The current row/column of the packed matrix.
+      size_t      index_;   //!< The current index within the row/column.
+      //*******************************************************************************************
+
+      //**Friend declarations**********************************************************************
+      template< typename MatrixType2 > friend class PackedIterator;
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef PackedIterator<This>        Iterator;       //!< Iterator over non-constant elements.
+   typedef PackedIterator<const This>  ConstIterator;  //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for intrinsic optimization.
+   /*! The \a vectorizable compilation flag indicates whether expressions the matrix is involved
+       in can be optimized via intrinsics. Since the elements of a packed matrix cannot be
+       accessed in terms of padded rows/columns, the \a vectorizable flag is always set to 0. */
+   enum { vectorizable = 0 };
+
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). Since all elements outside the stored part of a lower, upper or diagonal
+       packed matrix share the same memory location, packed matrices are not SMP assignable. */
+   enum { smpAssignable = 0 };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline PackedMatrix();
+   explicit inline PackedMatrix( size_t n );
+   explicit inline PackedMatrix( size_t m, size_t n );
+   explicit inline PackedMatrix( size_t m, size_t n, const Type& init );
+
+                                     inline PackedMatrix( const PackedMatrix& m );
+   template< typename MT, bool SO2 > inline PackedMatrix( const Matrix<MT,SO2>& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~PackedMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j );
+   inline ConstReference operator()( size_t i, size_t j ) const;
+   inline Pointer        data  ();
+   inline ConstPointer   data  () const;
+   inline Iterator       begin ( size_t i );
+   inline ConstIterator  begin ( size_t i ) const;
+   inline ConstIterator  cbegin( size_t i ) const;
+   inline Iterator       end   ( size_t i );
+   inline ConstIterator  end   ( size_t i ) const;
+   inline ConstIterator  cend  ( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+                                     inline PackedMatrix& operator= ( const Type& set );
+                                     inline PackedMatrix& operator= ( const PackedMatrix& rhs );
+   template< typename MT, bool SO2 > inline PackedMatrix& operator= ( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline PackedMatrix& operator+=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline PackedMatrix& operator-=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline PackedMatrix& operator*=( const Matrix<MT,SO2>& rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, PackedMatrix >::Type&
+      operator*=( Other rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, PackedMatrix >::Type&
+      operator/=( Other rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+                              inline size_t        rows() const;
+                              inline size_t        columns() const;
+                              inline size_t        capacity() const;
+                              inline size_t        capacity( size_t i ) const;
+                              inline size_t        nonZeros() const;
+                              inline size_t        nonZeros( size_t i ) const;
+                              inline void          reset();
+                              inline void          reset( size_t i );
+                              inline void          clear();
+                                     void          resize ( size_t m, size_t n, bool preserve=true );
+                              inline void          reserve( size_t elements );
+   template< typename Other > inline PackedMatrix& scale( const Other& scalar );
+                              inline void          swap( PackedMatrix& m ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the compile time detection of matrices complying with the packing type.
+   template< typename MT >
+   struct HasPackedPattern {
+      enum { value = IsSame<typename MT::ResultType,This>::value ||
+                     IsDiagonal<MT>::value ||
+                     ( PT == packedLower     && IsLower<MT>::value ) ||
+                     ( PT == packedUpper     && IsUpper<MT>::value ) ||
+                     ( PT == packedSymmetric && IsSymmetric<MT>::value ) };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT >
+   struct VectorizedAssign {
+      enum { value = IsVectorizable<Type>::value &&
+                     HasConstDataAccess<MT>::value &&
+                     IsSame<Type,typename MT::ElementType>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT >
+   struct VectorizedAddAssign {
+      enum { value = IsVectorizable<Type>::value &&
+                     HasConstDataAccess<MT>::value &&
+                     IsSame<Type,typename MT::ElementType>::value &&
+                     IntrinsicTrait<Type>::addition };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT >
+   struct VectorizedSubAssign {
+      enum { value = IsVectorizable<Type>::value &&
+                     HasConstDataAccess<MT>::value &&
+                     IsSame<Type,typename MT::ElementType>::value &&
+                     IntrinsicTrait<Type>::subtraction };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+
+   inline bool isAligned   () const;
+   inline bool canSMPAssign() const;
+
+   inline void assign( const PackedMatrix& rhs );
+
+   template< typename MT >
+   inline typename DisableIf< VectorizedAssign<MT> >::Type
+      assign( const DenseMatrix<MT,SO>& rhs );
+
+   template< typename MT >
+   inline typename EnableIf< VectorizedAssign<MT> >::Type
+      assign( const DenseMatrix<MT,SO>& rhs );
+
+   template< typename MT >          inline void assign( const DenseMatrix<MT,!SO>& rhs );
+   template< typename MT, bool SO2 > inline void assign( const SparseMatrix<MT,SO2>& rhs );
+
+   inline void addAssign( const PackedMatrix& rhs );
+
+   template< typename MT >
+   inline typename DisableIf< VectorizedAddAssign<MT> >::Type
+      addAssign( const DenseMatrix<MT,SO>& rhs );
+
+   template< typename MT >
+   inline typename EnableIf< VectorizedAddAssign<MT> >::Type
+      addAssign( const DenseMatrix<MT,SO>& rhs );
+
+   template< typename MT >          inline void addAssign( const DenseMatrix<MT,!SO>& rhs );
+   template< typename MT, bool SO2 > inline void addAssign( const SparseMatrix<MT,SO2>& rhs );
+
+   inline void subAssign( const PackedMatrix& rhs );
+
+   template< typename MT >
+   inline typename DisableIf< VectorizedSubAssign<MT> >::Type
+      subAssign( const DenseMatrix<MT,SO>& rhs );
+
+   template< typename MT >
+   inline typename EnableIf< VectorizedSubAssign<MT> >::Type
+      subAssign( const DenseMatrix<MT,SO>& rhs );
+
+   template< typename MT >          inline void subAssign( const DenseMatrix<MT,!SO>& rhs );
+   template< typename MT, bool SO2 > inline void subAssign( const SparseMatrix<MT,SO2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT, bool SO2 >
+   inline bool hasPackedPattern( const Matrix<MT,SO2>& rhs ) const;
+
+   inline bool   isStored( size_t i, size_t j ) const;
+   inline size_t index   ( size_t i, size_t j ) const;
+
+   static inline size_t packedSize( size_t n );
+   static inline size_t first     ( size_t k );
+   static inline size_t last      ( size_t k, size_t n );
+   static inline size_t offset    ( size_t k, size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t n_;                //!< The current number of rows and columns of the matrix.
+   size_t capacity_;         //!< The maximum capacity of the matrix.
+   Type* BLAZE_RESTRICT v_;  //!< The stored matrix elements.
+                             /*!< Access to the matrix elements is gained via the function call
+                                  operator. The stored elements of each row (or column in case
+                                  of a column-major matrix) are stored contiguously. */
+   Type sink_;               //!< Target of the write access to non-stored matrix elements.
+
+   static const Type zero_;  //!< The value of all non-stored elements of a non-symmetric matrix.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+const Type PackedMatrix<Type,PT,SO>::zero_ = Type();
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for PackedMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline PackedMatrix<Type,PT,SO>::PackedMatrix()
+   : n_       ( 0UL  )  // The current number of rows and columns of the matrix
+   , capacity_( 0UL  )  // The maximum capacity of the matrix
+   , v_       ( NULL )  // The stored matrix elements
+   , sink_    ()        // Target of the write access to non-stored matrix elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ n \times n \f$. No element initialization is performed!
+//
+// \param n The number of rows and columns of the matrix.
+//
+// \b Note: This constructor is only responsible to allocate the required dynamic memory. No
+//          element initialization is performed!
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline PackedMatrix<Type,PT,SO>::PackedMatrix( size_t n )
+   : n_       ( n )                            // The current number of rows and columns of the matrix
+   , capacity_( packedSize( n ) )              // The maximum capacity of the matrix
+   , v_       ( allocate<Type>( capacity_ ) )  // The stored matrix elements
+   , sink_    ()                               // Target of the write access to non-stored matrix elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ m \times n \f$. No element initialization is performed!
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \exception std::invalid_argument Invalid size for packed matrix.
+//
+// In case the given number of rows and columns don't match, a \a std::invalid_argument
+// exception is thrown. Note that this constructor is only responsible to allocate the required
+// dynamic memory. No element initialization is performed!
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline PackedMatrix<Type,PT,SO>::PackedMatrix( size_t m, size_t n )
+   : n_       ( n )     // The current number of rows and columns of the matrix
+   , capacity_( 0UL  )  // The maximum capacity of the matrix
+   , v_       ( NULL )  // The stored matrix elements
+   , sink_    ()        // Target of the write access to non-stored matrix elements
+{
+   if( m != n )
+      throw std::invalid_argument( "Invalid size for packed matrix" );
+
+   capacity_ = packedSize( n );
+   v_ = allocate<Type>( capacity_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a homogenous initialization of all stored matrix elements.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param init The initial value of the stored matrix elements.
+// \exception std::invalid_argument Invalid size for packed matrix.
+//
+// All stored matrix elements are initialized with the specified value. In case the given number
+// of rows and columns don't match, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline PackedMatrix<Type,PT,SO>::PackedMatrix( size_t m, size_t n, const Type& init )
+   : n_       ( n )     // The current number of rows and columns of the matrix
+   , capacity_( 0UL  )  // The maximum capacity of the matrix
+   , v_       ( NULL )  // The stored matrix elements
+   , sink_    ()        // Target of the write access to non-stored matrix elements
+{
+   if( m != n )
+      throw std::invalid_argument( "Invalid size for packed matrix" );
+
+   capacity_ = packedSize( n );
+   v_ = allocate<Type>( capacity_ );
+
+   std::fill( v_, v_+capacity_, init );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for PackedMatrix.
+//
+// \param m Matrix to be copied.
+//
+// The copy constructor is explicitly defined due to the required dynamic memory management
+// and in order to enable/facilitate NRV optimization.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline PackedMatrix<Type,PT,SO>::PackedMatrix( const PackedMatrix& m )
+   : n_       ( m.n_ )                         // The current number of rows and columns of the matrix
+   , capacity_( packedSize( n_ ) )             // The maximum capacity of the matrix
+   , v_       ( allocate<Type>( capacity_ ) )  // The stored matrix elements
+   , sink_    ()                               // Target of the write access to non-stored matrix elements
+{
+   assign( m );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m Matrix to be copied.
+// \exception std::invalid_argument Invalid setup of packed matrix.
+//
+// This constructor initializes the packed matrix as a copy of the given matrix. In case the
+// given matrix is not square or cannot be represented by the packing type (i.e. is not lower,
+// upper, symmetric, or diagonal, respectively), a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+template< typename MT    // Type of the foreign matrix
+        , bool SO2 >     // Storage order of the foreign matrix
+inline PackedMatrix<Type,PT,SO>::PackedMatrix( const Matrix<MT,SO2>& m )
+   : n_       ( 0UL  )  // The current number of rows and columns of the matrix
+   , capacity_( 0UL  )  // The maximum capacity of the matrix
+   , v_       ( NULL )  // The stored matrix elements
+   , sink_    ()        // Target of the write access to non-stored matrix elements
+{
+   try {
+      *this = ~m;
+   }
+   catch( ... ) {
+      deallocate( v_ );
+      throw;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for PackedMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline PackedMatrix<Type,PT,SO>::~PackedMatrix()
+{
+   deallocate( v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// In case of a symmetric packed matrix, the access to a non-stored element is redirected to
+// the according stored element. In case of a lower, upper, or diagonal packed matrix, any
+// write access to a non-stored element has no effect.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline typename PackedMatrix<Type,PT,SO>::Reference
+   PackedMatrix<Type,PT,SO>::operator()( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i<n_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+
+   if( isStored( i, j ) )
+      return v_[index(i,j)];
+   else if( PT == packedSymmetric )
+      return v_[index(j,i)];
+
+   sink_ = Type();
+   return sink_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline typename PackedMatrix<Type,PT,SO>::ConstReference
+   PackedMatrix<Type,PT,SO>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i<n_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+
+   if( isStored( i, j ) )
+      return v_[index(i,j)];
+   else if( PT == packedSymmetric )
+      return v_[index(j,i)];
+   else return zero_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the stored matrix elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the packed matrix. The stored
+// elements of each row (or column in case of a column-major matrix) are stored contiguously.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline typename PackedMatrix<Type,PT,SO>::Pointer PackedMatrix<Type,PT,SO>::data()
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the stored matrix elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the packed matrix. The stored
+// elements of each row (or column in case of a column-major matrix) are stored contiguously.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline typename PackedMatrix<Type,PT,SO>::ConstPointer PackedMatrix<Type,PT,SO>::data() const
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// This function returns a row/column iterator to the first element of row/column \a i. In case
+// the storage order is set to \a rowMajor the function returns an iterator to the first element
+// of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
+// to the first element of column \a i. The iterator traverses all elements of the row/column,
+// including the elements that are not stored explicitly.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline typename PackedMatrix<Type,PT,SO>::Iterator PackedMatrix<Type,PT,SO>::begin( size_t i )
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row/column access index" );
+   return Iterator( *this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// This function returns a row/column iterator to the first element of row/column \a i. In case
+// the storage order is set to \a rowMajor the function returns an iterator to the first element
+// of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
+// to the first element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline typename PackedMatrix<Type,PT,SO>::ConstIterator
+   PackedMatrix<Type,PT,SO>::begin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row/column access index" );
+   return ConstIterator( *this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// This function returns a row/column iterator to the first element of row/column \a i. In case
+// the storage order is set to \a rowMajor the function returns an iterator to the first element
+// of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
+// to the first element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline typename PackedMatrix<Type,PT,SO>::ConstIterator
+   PackedMatrix<Type,PT,SO>::cbegin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row/column access index" );
+   return ConstIterator( *this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator just past the last element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline typename PackedMatrix<Type,PT,SO>::Iterator PackedMatrix<Type,PT,SO>::end( size_t i )
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row/column access index" );
+   return Iterator( *this, i, n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator just past the last element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline typename PackedMatrix<Type,PT,SO>::ConstIterator
+   PackedMatrix<Type,PT,SO>::end( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row/column access index" );
+   return ConstIterator( *this, i, n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator just past the last element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline typename PackedMatrix<Type,PT,SO>::ConstIterator
+   PackedMatrix<Type,PT,SO>::cend( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row/column access index" );
+   return ConstIterator( *this, i, n_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Homogenous assignment to all stored matrix elements.
+//
+// \param rhs Scalar value to be assigned to all stored matrix elements.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline PackedMatrix<Type,PT,SO>& PackedMatrix<Type,PT,SO>::operator=( const Type& rhs )
+{
+   std::fill( v_, v_+packedSize( n_ ), rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for PackedMatrix.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+//
+// The matrix is resized according to the given \f$ N \times N \f$ matrix and initialized as a
+// copy of this matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline PackedMatrix<Type,PT,SO>& PackedMatrix<Type,PT,SO>::operator=( const PackedMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   resize( rhs.n_, rhs.n_, false );
+   assign( rhs );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Invalid assignment to packed matrix.
+//
+// The matrix is resized according to the given \f$ N \times N \f$ matrix and initialized as a
+// copy of this matrix. In case the given matrix is not square or cannot be represented by the
+// packing type (i.e. is not lower, upper, symmetric, or diagonal, respectively), a
+// \a std::invalid_argument exception is thrown. Expressions that are not known to comply with
+// the packing type at compile time are evaluated before the check.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline PackedMatrix<Type,PT,SO>& PackedMatrix<Type,PT,SO>::operator=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != (~rhs).columns() )
+      throw std::invalid_argument( "Invalid assignment to packed matrix" );
+
+   if( IsComputation<MT>::value && !HasPackedPattern<MT>::value ) {
+      const typename MT::ResultType tmp( ~rhs );
+      return ( *this = tmp );
+   }
+
+   if( !HasPackedPattern<MT>::value && !hasPackedPattern( ~rhs ) )
+      throw std::invalid_argument( "Invalid assignment to packed matrix" );
+
+   if( (~rhs).canAlias( this ) ) {
+      PackedMatrix tmp( (~rhs).rows() );
+      if( IsSparseMatrix<MT>::value )
+         tmp.reset();
+      smpAssign( tmp, ~rhs );
+      swap( tmp );
+   }
+   else {
+      resize( (~rhs).rows(), (~rhs).columns(), false );
+      if( IsSparseMatrix<MT>::value )
+         reset();
+      smpAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid addition to packed matrix.
+//
+// In case the current sizes of the two matrices don't match or the right-hand side matrix
+// cannot be represented by the packing type, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline PackedMatrix<Type,PT,SO>& PackedMatrix<Type,PT,SO>::operator+=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != n_ || (~rhs).columns() != n_ )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   if( IsComputation<MT>::value && !HasPackedPattern<MT>::value ) {
+      const typename MT::ResultType tmp( ~rhs );
+      return ( *this += tmp );
+   }
+
+   if( !HasPackedPattern<MT>::value && !hasPackedPattern( ~rhs ) )
+      throw std::invalid_argument( "Invalid addition to packed matrix" );
+
+   if( (~rhs).canAlias( this ) ) {
+      typename MT::ResultType tmp( ~rhs );
+      smpAddAssign( *this, tmp );
+   }
+   else {
+      smpAddAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid subtraction from packed matrix.
+//
+// In case the current sizes of the two matrices don't match or the right-hand side matrix
+// cannot be represented by the packing type, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline PackedMatrix<Type,PT,SO>& PackedMatrix<Type,PT,SO>::operator-=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != n_ || (~rhs).columns() != n_ )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   if( IsComputation<MT>::value && !HasPackedPattern<MT>::value ) {
+      const typename MT::ResultType tmp( ~rhs );
+      return ( *this -= tmp );
+   }
+
+   if( !HasPackedPattern<MT>::value && !hasPackedPattern( ~rhs ) )
+      throw std::invalid_argument( "Invalid subtraction from packed matrix" );
+
+   if( (~rhs).canAlias( this ) ) {
+      typename MT::ResultType tmp( ~rhs );
+      smpSubAssign( *this, tmp );
+   }
+   else {
+      smpSubAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication of a matrix (\f$ A*=B \f$).
+//
+// \param rhs The right-hand side matrix for the multiplication.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid assignment to packed matrix.
+//
+// In case the current sizes of the two matrices don't match or the resulting matrix cannot be
+// represented by the packing type, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline PackedMatrix<Type,PT,SO>& PackedMatrix<Type,PT,SO>::operator*=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != n_ )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   PackedMatrix tmp( *this * (~rhs) );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication between a matrix and
+//        a scalar value (\f$ A*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , PackingType PT    // Packing type
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, PackedMatrix<Type,PT,SO> >::Type&
+   PackedMatrix<Type,PT,SO>::operator*=( Other rhs )
+{
+   const size_t size( packedSize( n_ ) );
+
+   for( size_t k=0UL; k<size; ++k )
+      v_[k] *= rhs;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a matrix by a scalar value
+//        (\f$ A/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the matrix.
+//
+// \b Note: A division by zero is only checked by an user assert.
+*/
+template< typename Type     // Data type of the matrix
+        , PackingType PT    // Packing type
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, PackedMatrix<Type,PT,SO> >::Type&
+   PackedMatrix<Type,PT,SO>::operator/=( Other rhs )
+{
+   BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
+
+   typedef typename DivTrait<Type,Other>::Type  DT;
+   typedef typename If< IsNumeric<DT>, DT, Other >::Type  Tmp;
+
+   const size_t size( packedSize( n_ ) );
+
+   // Depending on the two involved data types, an integer division is applied or a
+   // floating point division is selected.
+   if( IsNumeric<DT>::value && IsFloatingPoint<DT>::value ) {
+      const Tmp tmp( Tmp(1)/static_cast<Tmp>( rhs ) );
+      for( size_t k=0UL; k<size; ++k )
+         v_[k] *= tmp;
+   }
+   else {
+      for( size_t k=0UL; k<size; ++k )
+         v_[k] /= rhs;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline size_t PackedMatrix<Type,PT,SO>::rows() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline size_t PackedMatrix<Type,PT,SO>::columns() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the matrix.
+//
+// \return The capacity of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline size_t PackedMatrix<Type,PT,SO>::capacity() const
+{
+   return capacity_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of stored elements in row/column \a i.
+//
+// This function returns the number of explicitly stored elements in the specified row/column.
+// In case the storage order is set to \a rowMajor the function returns the number of stored
+// elements in row \a i, in case the storage flag is set to \a columnMajor the function returns
+// the number of stored elements in column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline size_t PackedMatrix<Type,PT,SO>::capacity( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid row/column access index" );
+   return last( i, n_ ) - first( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero elements in the matrix
+//
+// \return The number of non-zero elements in the packed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline size_t PackedMatrix<Type,PT,SO>::nonZeros() const
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t k=0UL; k<n_; ++k )
+   {
+      const size_t jbegin( first( k ) );
+      const size_t jend  ( last( k, n_ ) );
+      const Type* BLAZE_RESTRICT v( v_ + offset( k, n_ ) - jbegin );
+
+      for( size_t j=jbegin; j<jend; ++j ) {
+         if( !isDefault( v[j] ) )
+            nonzeros += ( PT == packedSymmetric && j != k )?( 2UL ):( 1UL );
+      }
+   }
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+//
+// This function returns the current number of non-zero elements in the specified row/column.
+// In case the storage order is set to \a rowMajor the function returns the number of non-zero
+// elements in row \a i, in case the storage flag is set to \a columnMajor the function returns
+// the number of non-zero elements in column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline size_t PackedMatrix<Type,PT,SO>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid row/column access index" );
+
+   size_t nonzeros( 0UL );
+
+   for( size_t j=0UL; j<n_; ++j )
+      if( !isDefault( ( SO )?( (*this)(j,i) ):( (*this)(i,j) ) ) )
+         ++nonzeros;
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline void PackedMatrix<Type,PT,SO>::reset()
+{
+   using blaze::clear;
+
+   const size_t size( packedSize( n_ ) );
+
+   for( size_t k=0UL; k<size; ++k )
+      clear( v_[k] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column to the default initial values.
+//
+// \param i The index of the row/column.
+// \return void
+//
+// This function resets the values in the specified row/column to their default value. In case
+// the storage order is set to \a rowMajor the function resets the values in row \a i, in case
+// the storage order is set to \a columnMajor the function resets the values in column \a i.
+// Note that in case of a symmetric packed matrix this also resets the according column/row.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline void PackedMatrix<Type,PT,SO>::reset( size_t i )
+{
+   using blaze::clear;
+
+   BLAZE_USER_ASSERT( i < n_, "Invalid row/column access index" );
+
+   for( size_t j=0UL; j<n_; ++j )
+      clear( ( SO )?( (*this)(j,i) ):( (*this)(i,j) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the \f$ N \times N \f$ matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the matrix is 0.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline void PackedMatrix<Type,PT,SO>::clear()
+{
+   n_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the matrix.
+//
+// \param m The new number of rows of the matrix.
+// \param n The new number of columns of the matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+// \exception std::invalid_argument Invalid size for packed matrix.
+//
+// This function resizes the matrix using the given size to \f$ N \times N \f$. During this
+// operation, new dynamic memory may be allocated in case the capacity of the matrix is too
+// small. Note that this function may invalidate all existing views (submatrices, rows, columns,
+// ...) on the matrix if it is used to shrink the matrix. Additionally, the resize operation
+// potentially changes all matrix elements. In order to preserve the old matrix values, the
+// \a preserve flag can be set to \a true. However, new matrix elements are not initialized!
+// In case the given number of rows and columns don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+void PackedMatrix<Type,PT,SO>::resize( size_t m, size_t n, bool preserve )
+{
+   using blaze::min;
+
+   if( m != n )
+      throw std::invalid_argument( "Invalid size for packed matrix" );
+
+   if( n == n_ ) return;
+
+   const size_t size( packedSize( n ) );
+
+   if( preserve )
+   {
+      Type* BLAZE_RESTRICT v = allocate<Type>( size );
+      const size_t min_n( min( n, n_ ) );
+
+      for( size_t k=0UL; k<min_n; ++k ) {
+         const size_t jbegin( first( k ) );
+         const size_t jend  ( min( last( k, n ), last( k, n_ ) ) );
+         std::copy( v_ + offset( k, n_ ), v_ + offset( k, n_ ) + ( jend - jbegin ),
+                    v  + offset( k, n  ) );
+      }
+
+      std::swap( v_, v );
+      deallocate( v );
+      capacity_ = size;
+   }
+   else if( size > capacity_ ) {
+      Type* BLAZE_RESTRICT v = allocate<Type>( size );
+      std::swap( v_, v );
+      deallocate( v );
+      capacity_ = size;
+   }
+
+   n_ = n;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the matrix.
+//
+// \param elements The new minimum capacity of the packed matrix.
+// \return void
+//
+// This function increases the capacity of the packed matrix to at least \a elements elements.
+// The current values of the matrix elements are preserved.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline void PackedMatrix<Type,PT,SO>::reserve( size_t elements )
+{
+   if( elements > capacity_ )
+   {
+      // Allocating a new array
+      Type* BLAZE_RESTRICT tmp = allocate<Type>( elements );
+
+      // Initializing the new array
+      std::copy( v_, v_+packedSize( n_ ), tmp );
+
+      // Replacing the old array
+      std::swap( v_, tmp );
+      deallocate( tmp );
+      capacity_ = elements;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of the matrix by the scalar value \a scalar (\f$ A*=s \f$).
+//
+// \param scalar The scalar value for the matrix scaling.
+// \return Reference to the matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , PackingType PT    // Packing type
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the scalar value
+inline PackedMatrix<Type,PT,SO>& PackedMatrix<Type,PT,SO>::scale( const Other& scalar )
+{
+   const size_t size( packedSize( n_ ) );
+
+   for( size_t k=0UL; k<size; ++k )
+      v_[k] *= scalar;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline void PackedMatrix<Type,PT,SO>::swap( PackedMatrix& m ) /* throw() */
+{
+   std::swap( n_ , m.n_  );
+   std::swap( capacity_, m.capacity_ );
+   std::swap( v_ , m.v_  );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks whether the given matrix complies with the packing type.
+//
+// \param rhs The matrix to be checked.
+// \return \a true if the matrix can be represented by the packing type, \a false if not.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+template< typename MT    // Type of the matrix
+        , bool SO2 >     // Storage order of the matrix
+inline bool PackedMatrix<Type,PT,SO>::hasPackedPattern( const Matrix<MT,SO2>& rhs ) const
+{
+   switch( PT ) {
+      case packedLower    : return isLower    ( ~rhs );
+      case packedUpper    : return isUpper    ( ~rhs );
+      case packedSymmetric: return isSymmetric( ~rhs );
+      default             : return isDiagonal ( ~rhs );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the specified element is explicitly stored.
+//
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return \a true if the element is stored, \a false if not.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline bool PackedMatrix<Type,PT,SO>::isStored( size_t i, size_t j ) const
+{
+   const size_t k( SO ? j : i );
+   const size_t p( SO ? i : j );
+
+   if( diagonal )
+      return ( p == k );
+   else if( prefix )
+      return ( p <= k );
+   else
+      return ( p >= k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculation of the storage index of an explicitly stored element.
+//
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return The index of the element within the internal element storage.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline size_t PackedMatrix<Type,PT,SO>::index( size_t i, size_t j ) const
+{
+   BLAZE_INTERNAL_ASSERT( isStored( i, j ), "Access to non-stored element" );
+
+   const size_t k( SO ? j : i );
+   const size_t p( SO ? i : j );
+
+   return offset( k, n_ ) + p - first( k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculation of the number of stored elements of a \f$ N \times N \f$ matrix.
+//
+// \param n The number of rows and columns of the matrix.
+// \return The number of stored elements.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline size_t PackedMatrix<Type,PT,SO>::packedSize( size_t n )
+{
+   return ( diagonal )?( n ):( n*(n+1UL)/2UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index of the first stored element of row/column \a k.
+//
+// \param k The index of the row/column.
+// \return The index of the first stored element.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline size_t PackedMatrix<Type,PT,SO>::first( size_t k )
+{
+   return ( prefix )?( 0UL ):( k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index one past the last stored element of row/column \a k.
+//
+// \param k The index of the row/column.
+// \param n The number of rows and columns of the matrix.
+// \return The index one past the last stored element.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline size_t PackedMatrix<Type,PT,SO>::last( size_t k, size_t n )
+{
+   return ( prefix || diagonal )?( k+1UL ):( n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the storage offset of row/column \a k.
+//
+// \param k The index of the row/column.
+// \param n The number of rows and columns of the matrix.
+// \return The index of the first stored element of row/column \a k within the element storage.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline size_t PackedMatrix<Type,PT,SO>::offset( size_t k, size_t n )
+{
+   if( diagonal )
+      return k;
+   else if( prefix )
+      return k*(k+1UL)/2UL;
+   else
+      return k*(2UL*n-k+1UL)/2UL;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , PackingType PT    // Packing type
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool PackedMatrix<Type,PT,SO>::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , PackingType PT    // Packing type
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool PackedMatrix<Type,PT,SO>::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is properly aligned in memory.
+//
+// \return \a true in case the matrix is aligned, \a false if not.
+//
+// This function returns whether the matrix is guaranteed to be properly aligned in memory.
+// Since the rows/columns of a packed matrix are not padded, the function always returns
+// \a false.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline bool PackedMatrix<Type,PT,SO>::isAligned() const
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the matrix can be used in SMP assignments. Since packed
+// matrices are not SMP assignable, the function always returns \a false.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline bool PackedMatrix<Type,PT,SO>::canSMPAssign() const
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a packed matrix.
+//
+// \param rhs The right-hand side packed matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline void PackedMatrix<Type,PT,SO>::assign( const PackedMatrix& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == rhs.n_, "Invalid number of rows and columns" );
+
+   std::copy( rhs.v_, rhs.v_ + packedSize( n_ ), v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side dense matrix
+inline typename DisableIf< typename PackedMatrix<Type,PT,SO>::BLAZE_TEMPLATE VectorizedAssign<MT> >::Type
+   PackedMatrix<Type,PT,SO>::assign( const DenseMatrix<MT,SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   Type* BLAZE_RESTRICT v( v_ );
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      const size_t jend( last( k, n_ ) );
+      for( size_t j=first( k ); j<jend; ++j, ++v )
+         *v = ( SO )?( (~rhs)(j,k) ):( (~rhs)(k,j) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Vectorized implementation of the assignment of a dense matrix with data access.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side dense matrix
+inline typename EnableIf< typename PackedMatrix<Type,PT,SO>::BLAZE_TEMPLATE VectorizedAssign<MT> >::Type
+   PackedMatrix<Type,PT,SO>::assign( const DenseMatrix<MT,SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t k=0UL; k<n_; ++k )
+   {
+      const size_t jbegin( first( k ) );
+      const size_t jend  ( last( k, n_ ) );
+
+      Type* BLAZE_RESTRICT v( v_ + offset( k, n_ ) - jbegin );
+      const Type* BLAZE_RESTRICT w( (~rhs).data() + k*(~rhs).spacing() );
+
+      size_t j( jbegin );
+
+      for( ; j+IT::size<=jend; j+=IT::size )
+         storeu( v+j, loadu( w+j ) );
+
+      if( IT::masking ) {
+         if( j < jend )
+            maskstoreu( v+j, jend-j, maskloadu( w+j, jend-j, IntrinsicType() ) );
+      }
+      else {
+         for( ; j<jend; ++j )
+            v[j] = w[j];
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a dense matrix with opposite storage order.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side dense matrix
+inline void PackedMatrix<Type,PT,SO>::assign( const DenseMatrix<MT,!SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   Type* BLAZE_RESTRICT v( v_ );
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      const size_t jend( last( k, n_ ) );
+      for( size_t j=first( k ); j<jend; ++j, ++v )
+         *v = ( SO )?( (~rhs)(j,k) ):( (~rhs)(k,j) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator. Elements of the sparse matrix outside of the stored part are ignored.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline void PackedMatrix<Type,PT,SO>::assign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t l=0UL; l<n_; ++l ) {
+      for( typename MT::ConstIterator element=(~rhs).begin(l); element!=(~rhs).end(l); ++element ) {
+         const size_t i( SO2 ? element->index() : l );
+         const size_t j( SO2 ? l : element->index() );
+         if( isStored( i, j ) )
+            v_[index(i,j)] = element->value();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a packed matrix.
+//
+// \param rhs The right-hand side packed matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline void PackedMatrix<Type,PT,SO>::addAssign( const PackedMatrix& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == rhs.n_, "Invalid number of rows and columns" );
+
+   const size_t size( packedSize( n_ ) );
+
+   for( size_t k=0UL; k<size; ++k )
+      v_[k] += rhs.v_[k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side dense matrix
+inline typename DisableIf< typename PackedMatrix<Type,PT,SO>::BLAZE_TEMPLATE VectorizedAddAssign<MT> >::Type
+   PackedMatrix<Type,PT,SO>::addAssign( const DenseMatrix<MT,SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   Type* BLAZE_RESTRICT v( v_ );
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      const size_t jend( last( k, n_ ) );
+      for( size_t j=first( k ); j<jend; ++j, ++v )
+         *v += ( SO )?( (~rhs)(j,k) ):( (~rhs)(k,j) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Vectorized implementation of the addition assignment of a dense matrix with data access.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side dense matrix
+inline typename EnableIf< typename PackedMatrix<Type,PT,SO>::BLAZE_TEMPLATE VectorizedAddAssign<MT> >::Type
+   PackedMatrix<Type,PT,SO>::addAssign( const DenseMatrix<MT,SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t k=0UL; k<n_; ++k )
+   {
+      const size_t jbegin( first( k ) );
+      const size_t jend  ( last( k, n_ ) );
+
+      Type* BLAZE_RESTRICT v( v_ + offset( k, n_ ) - jbegin );
+      const Type* BLAZE_RESTRICT w( (~rhs).data() + k*(~rhs).spacing() );
+
+      size_t j( jbegin );
+
+      for( ; j+IT::size<=jend; j+=IT::size )
+         storeu( v+j, loadu( v+j ) + loadu( w+j ) );
+
+      if( IT::masking ) {
+         if( j < jend )
+            maskstoreu( v+j, jend-j, maskloadu( v+j, jend-j, IntrinsicType() )
+                                  + maskloadu( w+j, jend-j, IntrinsicType() ) );
+      }
+      else {
+         for( ; j<jend; ++j )
+            v[j] += w[j];
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a dense matrix with opposite
+//        storage order.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side dense matrix
+inline void PackedMatrix<Type,PT,SO>::addAssign( const DenseMatrix<MT,!SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   Type* BLAZE_RESTRICT v( v_ );
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      const size_t jend( last( k, n_ ) );
+      for( size_t j=first( k ); j<jend; ++j, ++v )
+         *v += ( SO )?( (~rhs)(j,k) ):( (~rhs)(k,j) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator. Elements of the sparse matrix outside of the stored part are ignored.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline void PackedMatrix<Type,PT,SO>::addAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t l=0UL; l<n_; ++l ) {
+      for( typename MT::ConstIterator element=(~rhs).begin(l); element!=(~rhs).end(l); ++element ) {
+         const size_t i( SO2 ? element->index() : l );
+         const size_t j( SO2 ? l : element->index() );
+         if( isStored( i, j ) )
+            v_[index(i,j)] += element->value();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a packed matrix.
+//
+// \param rhs The right-hand side packed matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline void PackedMatrix<Type,PT,SO>::subAssign( const PackedMatrix& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == rhs.n_, "Invalid number of rows and columns" );
+
+   const size_t size( packedSize( n_ ) );
+
+   for( size_t k=0UL; k<size; ++k )
+      v_[k] -= rhs.v_[k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side dense matrix
+inline typename DisableIf< typename PackedMatrix<Type,PT,SO>::BLAZE_TEMPLATE VectorizedSubAssign<MT> >::Type
+   PackedMatrix<Type,PT,SO>::subAssign( const DenseMatrix<MT,SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   Type* BLAZE_RESTRICT v( v_ );
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      const size_t jend( last( k, n_ ) );
+      for( size_t j=first( k ); j<jend; ++j, ++v )
+         *v -= ( SO )?( (~rhs)(j,k) ):( (~rhs)(k,j) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Vectorized implementation of the subtraction assignment of a dense matrix with data
+//        access.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side dense matrix
+inline typename EnableIf< typename PackedMatrix<Type,PT,SO>::BLAZE_TEMPLATE VectorizedSubAssign<MT> >::Type
+   PackedMatrix<Type,PT,SO>::subAssign( const DenseMatrix<MT,SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t k=0UL; k<n_; ++k )
+   {
+      const size_t jbegin( first( k ) );
+      const size_t jend  ( last( k, n_ ) );
+
+      Type* BLAZE_RESTRICT v( v_ + offset( k, n_ ) - jbegin );
+      const Type* BLAZE_RESTRICT w( (~rhs).data() + k*(~rhs).spacing() );
+
+      size_t j( jbegin );
+
+      for( ; j+IT::size<=jend; j+=IT::size )
+         storeu( v+j, loadu( v+j ) - loadu( w+j ) );
+
+      if( IT::masking ) {
+         if( j < jend )
+            maskstoreu( v+j, jend-j, maskloadu( v+j, jend-j, IntrinsicType() )
+                                  - maskloadu( w+j, jend-j, IntrinsicType() ) );
+      }
+      else {
+         for( ; j<jend; ++j )
+            v[j] -= w[j];
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a dense matrix with opposite
+//        storage order.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side dense matrix
+inline void PackedMatrix<Type,PT,SO>::subAssign( const DenseMatrix<MT,!SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   Type* BLAZE_RESTRICT v( v_ );
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      const size_t jend( last( k, n_ ) );
+      for( size_t j=first( k ); j<jend; ++j, ++v )
+         *v -= ( SO )?( (~rhs)(j,k) ):( (~rhs)(k,j) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator. Elements of the sparse matrix outside of the stored part are ignored.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline void PackedMatrix<Type,PT,SO>::subAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t l=0UL; l<n_; ++l ) {
+      for( typename MT::ConstIterator element=(~rhs).begin(l); element!=(~rhs).end(l); ++element ) {
+         const size_t i( SO2 ? element->index() : l );
+         const size_t j( SO2 ? l : element->index() );
+         if( isStored( i, j ) )
+            v_[index(i,j)] -= element->value();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PACKEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name PackedMatrix operators */
+//@{
+template< typename Type, PackingType PT, bool SO >
+inline void reset( PackedMatrix<Type,PT,SO>& m );
+
+template< typename Type, PackingType PT, bool SO >
+inline void reset( PackedMatrix<Type,PT,SO>& m, size_t i );
+
+template< typename Type, PackingType PT, bool SO >
+inline void clear( PackedMatrix<Type,PT,SO>& m );
+
+template< typename Type, PackingType PT, bool SO >
+inline bool isDefault( const PackedMatrix<Type,PT,SO>& m );
+
+template< typename Type, PackingType PT, bool SO >
+inline void swap( PackedMatrix<Type,PT,SO>& a, PackedMatrix<Type,PT,SO>& b ) /* throw() */;
+
+template< typename Type, PackingType PT, bool SO >
+inline void move( PackedMatrix<Type,PT,SO>& dst, PackedMatrix<Type,PT,SO>& src ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given packed matrix.
+// \ingroup packed_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline void reset( PackedMatrix<Type,PT,SO>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column of the given packed matrix.
+// \ingroup packed_matrix
+//
+// \param m The matrix to be resetted.
+// \param i The index of the row/column to be resetted.
+// \return void
+//
+// This function resets the values in the specified row/column of the given packed matrix to
+// their default value. In case the given matrix is a \a rowMajor matrix the function resets the
+// values in row \a i, if it is a \a columnMajor matrix the function resets the values in column
+// \a i. Note that the capacity of the row/column remains unchanged.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline void reset( PackedMatrix<Type,PT,SO>& m, size_t i )
+{
+   m.reset( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given packed matrix.
+// \ingroup packed_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline void clear( PackedMatrix<Type,PT,SO>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given packed matrix is in default state.
+// \ingroup packed_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+//
+// This function checks whether the packed matrix is in default (constructed) state, i.e. if
+// it's number of rows and columns is 0. In case it is in default state, the function returns
+// \a true, else it will return \a false.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline bool isDefault( const PackedMatrix<Type,PT,SO>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two packed matrices.
+// \ingroup packed_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline void swap( PackedMatrix<Type,PT,SO>& a, PackedMatrix<Type,PT,SO>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Moving the contents of one packed matrix to another.
+// \ingroup packed_matrix
+//
+// \param dst The destination matrix.
+// \param src The source matrix.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the matrix
+        , PackingType PT // Packing type
+        , bool SO >      // Storage order
+inline void move( PackedMatrix<Type,PT,SO>& dst, PackedMatrix<Type,PT,SO>& src ) /* throw() */
+{
+   dst.swap( src );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISRESIZABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, PackingType PT, bool SO >
+struct IsResizable< PackedMatrix<T,PT,SO> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, PackingType PT, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct AddTrait< PackedMatrix<T1,PT,SO1>, StaticMatrix<T2,M,N,SO2> >
+{
+   typedef typename AddTrait< DynamicMatrix<T1,SO1>, StaticMatrix<T2,M,N,SO2> >::Type  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, PackingType PT, bool SO2 >
+struct AddTrait< StaticMatrix<T1,M,N,SO1>, PackedMatrix<T2,PT,SO2> >
+{
+   typedef typename AddTrait< StaticMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2> >::Type  Type;
+};
+
+template< typename T1, PackingType PT, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct AddTrait< PackedMatrix<T1,PT,SO1>, HybridMatrix<T2,M,N,SO2> >
+{
+   typedef typename AddTrait< DynamicMatrix<T1,SO1>, HybridMatrix<T2,M,N,SO2> >::Type  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, PackingType PT, bool SO2 >
+struct AddTrait< HybridMatrix<T1,M,N,SO1>, PackedMatrix<T2,PT,SO2> >
+{
+   typedef typename AddTrait< HybridMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2> >::Type  Type;
+};
+
+template< typename T1, PackingType PT, bool SO1, typename T2, bool SO2 >
+struct AddTrait< PackedMatrix<T1,PT,SO1>, DynamicMatrix<T2,SO2> >
+{
+   typedef typename AddTrait< DynamicMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >::Type  Type;
+};
+
+template< typename T1, bool SO1, typename T2, PackingType PT, bool SO2 >
+struct AddTrait< DynamicMatrix<T1,SO1>, PackedMatrix<T2,PT,SO2> >
+{
+   typedef typename AddTrait< DynamicMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >::Type  Type;
+};
+
+template< typename T1, PackingType PT, bool SO1, typename T2, bool SO2, typename IT >
+struct AddTrait< PackedMatrix<T1,PT,SO1>, CompressedMatrix<T2,SO2,IT> >
+{
+   typedef typename AddTrait< DynamicMatrix<T1,SO1>, CompressedMatrix<T2,SO2,IT> >::Type  Type;
+};
+
+template< typename T1, bool SO1, typename T2, PackingType PT, bool SO2, typename IT >
+struct AddTrait< CompressedMatrix<T1,SO1,IT>, PackedMatrix<T2,PT,SO2> >
+{
+   typedef typename AddTrait< CompressedMatrix<T1,SO1,IT>, DynamicMatrix<T2,SO2> >::Type  Type;
+};
+
+template< typename T1, PackingType PT1, bool SO1, typename T2, PackingType PT2, bool SO2 >
+struct AddTrait< PackedMatrix<T1,PT1,SO1>, PackedMatrix<T2,PT2,SO2> >
+{
+ private:
+   enum { packed = ( PT1 == PT2 || PT1 == packedDiagonal || PT2 == packedDiagonal ) };
+   enum { order = ( SO1 == SO2 )?( SO1 ):( false ) };
+   typedef typename AddTrait<T1,T2>::Type  ET;
+
+ public:
+   typedef typename SelectType< packed
+                              , PackedMatrix< ET, ( PT1 == packedDiagonal )?( PT2 ):( PT1 ), order >
+                              , DynamicMatrix< ET, order > >::Type  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, PackingType PT, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct SubTrait< PackedMatrix<T1,PT,SO1>, StaticMatrix<T2,M,N,SO2> >
+{
+   typedef typename SubTrait< DynamicMatrix<T1,SO1>, StaticMatrix<T2,M,N,SO2> >::Type  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, PackingType PT, bool SO2 >
+struct SubTrait< StaticMatrix<T1,M,N,SO1>, PackedMatrix<T2,PT,SO2> >
+{
+   typedef typename SubTrait< StaticMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2> >::Type  Type;
+};
+
+template< typename T1, PackingType PT, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct SubTrait< PackedMatrix<T1,PT,SO1>, HybridMatrix<T2,M,N,SO2> >
+{
+   typedef typename SubTrait< DynamicMatrix<T1,SO1>, HybridMatrix<T2,M,N,SO2> >::Type  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, PackingType PT, bool SO2 >
+struct SubTrait< HybridMatrix<T1,M,N,SO1>, PackedMatrix<T2,PT,SO2> >
+{
+   typedef typename SubTrait< HybridMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2> >::Type  Type;
+};
+
+template< typename T1, PackingType PT, bool SO1, typename T2, bool SO2 >
+struct SubTrait< PackedMatrix<T1,PT,SO1>, DynamicMatrix<T2,SO2> >
+{
+   typedef typename SubTrait< DynamicMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >::Type  Type;
+};
+
+template< typename T1, bool SO1, typename T2, PackingType PT, bool SO2 >
+struct SubTrait< DynamicMatrix<T1,SO1>, PackedMatrix<T2,PT,SO2> >
+{
+   typedef typename SubTrait< DynamicMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >::Type  Type;
+};
+
+template< typename T1, PackingType PT, bool SO1, typename T2, bool SO2, typename IT >
+struct SubTrait< PackedMatrix<T1,PT,SO1>, CompressedMatrix<T2,SO2,IT> >
+{
+   typedef typename SubTrait< DynamicMatrix<T1,SO1>, CompressedMatrix<T2,SO2,IT> >::Type  Type;
+};
+
+template< typename T1, bool SO1, typename T2, PackingType PT, bool SO2, typename IT >
+struct SubTrait< CompressedMatrix<T1,SO1,IT>, PackedMatrix<T2,PT,SO2> >
+{
+   typedef typename SubTrait< CompressedMatrix<T1,SO1,IT>, DynamicMatrix<T2,SO2> >::Type  Type;
+};
+
+template< typename T1, PackingType PT1, bool SO1, typename T2, PackingType PT2, bool SO2 >
+struct SubTrait< PackedMatrix<T1,PT1,SO1>, PackedMatrix<T2,PT2,SO2> >
+{
+ private:
+   enum { packed = ( PT1 == PT2 || PT1 == packedDiagonal || PT2 == packedDiagonal ) };
+   enum { order = ( SO1 == SO2 )?( SO1 ):( false ) };
+   typedef typename SubTrait<T1,T2>::Type  ET;
+
+ public:
+   typedef typename SelectType< packed
+                              , PackedMatrix< ET, ( PT1 == packedDiagonal )?( PT2 ):( PT1 ), order >
+                              , DynamicMatrix< ET, order > >::Type  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, PackingType PT, bool SO, typename T2 >
+struct MultTrait< PackedMatrix<T1,PT,SO>, T2 >
+{
+   typedef PackedMatrix< typename MultTrait<T1,T2>::Type, PT, SO >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
+};
+
+template< typename T1, typename T2, PackingType PT, bool SO >
+struct MultTrait< T1, PackedMatrix<T2,PT,SO> >
+{
+   typedef PackedMatrix< typename MultTrait<T1,T2>::Type, PT, SO >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T1 );
+};
+
+template< typename T1, PackingType PT, bool SO, typename T2, size_t N >
+struct MultTrait< PackedMatrix<T1,PT,SO>, StaticVector<T2,N,false> >
+{
+   typedef typename MultTrait< DynamicMatrix<T1,SO>, StaticVector<T2,N,false> >::Type  Type;
+};
+
+template< typename T1, size_t N, typename T2, PackingType PT, bool SO >
+struct MultTrait< StaticVector<T1,N,true>, PackedMatrix<T2,PT,SO> >
+{
+   typedef typename MultTrait< StaticVector<T1,N,true>, DynamicMatrix<T2,SO> >::Type  Type;
+};
+
+template< typename T1, PackingType PT, bool SO, typename T2, size_t N >
+struct MultTrait< PackedMatrix<T1,PT,SO>, HybridVector<T2,N,false> >
+{
+   typedef typename MultTrait< DynamicMatrix<T1,SO>, HybridVector<T2,N,false> >::Type  Type;
+};
+
+template< typename T1, size_t N, typename T2, PackingType PT, bool SO >
+struct MultTrait< HybridVector<T1,N,true>, PackedMatrix<T2,PT,SO> >
+{
+   typedef typename MultTrait< HybridVector<T1,N,true>, DynamicMatrix<T2,SO> >::Type  Type;
+};
+
+template< typename T1, PackingType PT, bool SO, typename T2 >
+struct MultTrait< PackedMatrix<T1,PT,SO>, DynamicVector<T2,false> >
+{
+   typedef typename MultTrait< DynamicMatrix<T1,SO>, DynamicVector<T2,false> >::Type  Type;
+};
+
+template< typename T1, typename T2, PackingType PT, bool SO >
+struct MultTrait< DynamicVector<T1,true>, PackedMatrix<T2,PT,SO> >
+{
+   typedef typename MultTrait< DynamicVector<T1,true>, DynamicMatrix<T2,SO> >::Type  Type;
+};
+
+template< typename T1, PackingType PT, bool SO, typename T2, typename IT >
+struct MultTrait< PackedMatrix<T1,PT,SO>, CompressedVector<T2,false,IT> >
+{
+   typedef typename MultTrait< DynamicMatrix<T1,SO>, CompressedVector<T2,false,IT> >::Type  Type;
+};
+
+template< typename T1, typename T2, PackingType PT, bool SO, typename IT >
+struct MultTrait< CompressedVector<T1,true,IT>, PackedMatrix<T2,PT,SO> >
+{
+   typedef typename MultTrait< CompressedVector<T1,true,IT>, DynamicMatrix<T2,SO> >::Type  Type;
+};
+
+template< typename T1, PackingType PT, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct MultTrait< PackedMatrix<T1,PT,SO1>, StaticMatrix<T2,M,N,SO2> >
+{
+   typedef typename MultTrait< DynamicMatrix<T1,SO1>, StaticMatrix<T2,M,N,SO2> >::Type  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, PackingType PT, bool SO2 >
+struct MultTrait< StaticMatrix<T1,M,N,SO1>, PackedMatrix<T2,PT,SO2> >
+{
+   typedef typename MultTrait< StaticMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2> >::Type  Type;
+};
+
+template< typename T1, PackingType PT, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct MultTrait< PackedMatrix<T1,PT,SO1>, HybridMatrix<T2,M,N,SO2> >
+{
+   typedef typename MultTrait< DynamicMatrix<T1,SO1>, HybridMatrix<T2,M,N,SO2> >::Type  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, PackingType PT, bool SO2 >
+struct MultTrait< HybridMatrix<T1,M,N,SO1>, PackedMatrix<T2,PT,SO2> >
+{
+   typedef typename MultTrait< HybridMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2> >::Type  Type;
+};
+
+template< typename T1, PackingType PT, bool SO1, typename T2, bool SO2 >
+struct MultTrait< PackedMatrix<T1,PT,SO1>, DynamicMatrix<T2,SO2> >
+{
+   typedef typename MultTrait< DynamicMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >::Type  Type;
+};
+
+template< typename T1, bool SO1, typename T2, PackingType PT, bool SO2 >
+struct MultTrait< DynamicMatrix<T1,SO1>, PackedMatrix<T2,PT,SO2> >
+{
+   typedef typename MultTrait< DynamicMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >::Type  Type;
+};
+
+template< typename T1, PackingType PT, bool SO1, typename T2, bool SO2, typename IT >
+struct MultTrait< PackedMatrix<T1,PT,SO1>, CompressedMatrix<T2,SO2,IT> >
+{
+   typedef typename MultTrait< DynamicMatrix<T1,SO1>, CompressedMatrix<T2,SO2,IT> >::Type  Type;
+};
+
+template< typename T1, bool SO1, typename T2, PackingType PT, bool SO2, typename IT >
+struct MultTrait< CompressedMatrix<T1,SO1,IT>, PackedMatrix<T2,PT,SO2> >
+{
+   typedef typename MultTrait< CompressedMatrix<T1,SO1,IT>, DynamicMatrix<T2,SO2> >::Type  Type;
+};
+
+template< typename T1, PackingType PT1, bool SO1, typename T2, PackingType PT2, bool SO2 >
+struct MultTrait< PackedMatrix<T1,PT1,SO1>, PackedMatrix<T2,PT2,SO2> >
+{
+ private:
+   enum { packed = ( PT1 == packedLower    && PT2 == packedLower    ) ||
+                   ( PT1 == packedUpper    && PT2 == packedUpper    ) ||
+                   ( PT1 == packedDiagonal && PT2 != packedSymmetric ) ||
+                   ( PT2 == packedDiagonal && PT1 != packedSymmetric ) };
+   typedef typename MultTrait<T1,T2>::Type  ET;
+
+ public:
+   typedef typename SelectType< packed
+                              , PackedMatrix< ET, ( PT1 == packedDiagonal )?( PT2 ):( PT1 ), SO1 >
+                              , DynamicMatrix< ET, SO1 > >::Type  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DIVTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, PackingType PT, bool SO, typename T2 >
+struct DivTrait< PackedMatrix<T1,PT,SO>, T2 >
+{
+   typedef PackedMatrix< typename DivTrait<T1,T2>::Type, PT, SO >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATHTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, PackingType PT, bool SO, typename T2 >
+struct MathTrait< PackedMatrix<T1,PT,SO>, PackedMatrix<T2,PT,SO> >
+{
+   typedef PackedMatrix< typename MathTrait<T1,T2>::HighType, PT, SO >  HighType;
+   typedef PackedMatrix< typename MathTrait<T1,T2>::LowType , PT, SO >  LowType;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, PackingType PT, bool SO >
+struct SubmatrixTrait< PackedMatrix<T1,PT,SO> >
+{
+   typedef DynamicMatrix<T1,SO>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, PackingType PT, bool SO >
+struct RowTrait< PackedMatrix<T1,PT,SO> >
+{
+   typedef DynamicVector<T1,true>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, PackingType PT, bool SO >
+struct ColumnTrait< PackedMatrix<T1,PT,SO> >
+{
+   typedef DynamicVector<T1,false>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
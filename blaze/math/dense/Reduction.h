@@ -0,0 +1,842 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Reduction.h
+//  \brief Header file for the vectorized reduction kernels for dense vectors and matrices
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_REDUCTION_H_
+#define _BLAZE_MATH_DENSE_REDUCTION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/dispatch/Level1.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/shims/IsNaN.h>
+#include <blaze/math/shims/Square.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  REDUCTION OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reduction operation for the sum of all elements.
+// \ingroup dense
+//
+// The reduction operations are used by the reduction kernels to reduce all elements of a dense
+// vector or matrix to a single value. Each reduction operation provides the resulting type,
+// the initial value of the reduction for a given first element (init()), the mapping of a
+// single element to the resulting type (map()) and the combination of two partial results
+// (combine()). The initial value has to be either the neutral element of the combination or
+// an element of the reduction, whose repeated combination does not change the result. The
+// according intrinsic functions (initv(), mapv(), and combinev()) are only used in case the
+// \a vectorizable flag is set to 1.
+*/
+template< typename T >  // Type of the elements
+struct SumReduction
+{
+   //**Type definitions****************************************************************************
+   typedef T                                ResultType;     //!< Resulting type of the reduction.
+   typedef typename IntrinsicTrait<T>::Type  IntrinsicType;  //!< Intrinsic type of the reduction.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   enum { vectorizable = IntrinsicTrait<T>::addition };
+   //**********************************************************************************************
+
+   //**Scalar functions****************************************************************************
+   static inline ResultType init   ( const ResultType& ) { return ResultType(); }
+   static inline ResultType map    ( const T& a ) { return a; }
+   static inline ResultType combine( const ResultType& a, const ResultType& b ) { return a + b; }
+   //**********************************************************************************************
+
+   //**Intrinsic functions*************************************************************************
+   static inline IntrinsicType initv   ( const ResultType& ) { return IntrinsicType(); }
+   static inline IntrinsicType mapv    ( const IntrinsicType& a ) { return a; }
+   static inline IntrinsicType combinev( const IntrinsicType& a, const IntrinsicType& b ) {
+      return a + b;
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reduction operation for the product of all elements.
+// \ingroup dense
+*/
+template< typename T >  // Type of the elements
+struct ProdReduction
+{
+   //**Type definitions****************************************************************************
+   typedef T                                ResultType;     //!< Resulting type of the reduction.
+   typedef typename IntrinsicTrait<T>::Type  IntrinsicType;  //!< Intrinsic type of the reduction.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   enum { vectorizable = IntrinsicTrait<T>::multiplication };
+   //**********************************************************************************************
+
+   //**Scalar functions****************************************************************************
+   static inline ResultType init   ( const ResultType& ) { return ResultType( 1 ); }
+   static inline ResultType map    ( const T& a ) { return a; }
+   static inline ResultType combine( const ResultType& a, const ResultType& b ) { return a * b; }
+   //**********************************************************************************************
+
+   //**Intrinsic functions*************************************************************************
+   static inline IntrinsicType initv   ( const ResultType& ) { return set( ResultType( 1 ) ); }
+   static inline IntrinsicType mapv    ( const IntrinsicType& a ) { return a; }
+   static inline IntrinsicType combinev( const IntrinsicType& a, const IntrinsicType& b ) {
+      return a * b;
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reduction operation for the smallest element.
+// \ingroup dense
+*/
+template< typename T >  // Type of the elements
+struct MinReduction
+{
+   //**Type definitions****************************************************************************
+   typedef T                                ResultType;     //!< Resulting type of the reduction.
+   typedef typename IntrinsicTrait<T>::Type  IntrinsicType;  //!< Intrinsic type of the reduction.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   enum { vectorizable = IntrinsicTrait<T>::minimum };
+   //**********************************************************************************************
+
+   //**Scalar functions****************************************************************************
+   static inline ResultType init   ( const ResultType& first ) { return first; }
+   static inline ResultType map    ( const T& a ) { return a; }
+   static inline ResultType combine( const ResultType& a, const ResultType& b ) {
+      return min( a, b );
+   }
+   //**********************************************************************************************
+
+   //**Intrinsic functions*************************************************************************
+   static inline IntrinsicType initv   ( const ResultType& first ) { return set( first ); }
+   static inline IntrinsicType mapv    ( const IntrinsicType& a ) { return a; }
+   static inline IntrinsicType combinev( const IntrinsicType& a, const IntrinsicType& b ) {
+      return min( a, b );
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reduction operation for the largest element.
+// \ingroup dense
+*/
+template< typename T >  // Type of the elements
+struct MaxReduction
+{
+   //**Type definitions****************************************************************************
+   typedef T                                ResultType;     //!< Resulting type of the reduction.
+   typedef typename IntrinsicTrait<T>::Type  IntrinsicType;  //!< Intrinsic type of the reduction.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   enum { vectorizable = IntrinsicTrait<T>::maximum };
+   //**********************************************************************************************
+
+   //**Scalar functions****************************************************************************
+   static inline ResultType init   ( const ResultType& first ) { return first; }
+   static inline ResultType map    ( const T& a ) { return a; }
+   static inline ResultType combine( const ResultType& a, const ResultType& b ) {
+      return max( a, b );
+   }
+   //**********************************************************************************************
+
+   //**Intrinsic functions*************************************************************************
+   static inline IntrinsicType initv   ( const ResultType& first ) { return set( first ); }
+   static inline IntrinsicType mapv    ( const IntrinsicType& a ) { return a; }
+   static inline IntrinsicType combinev( const IntrinsicType& a, const IntrinsicType& b ) {
+      return max( a, b );
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reduction operation for the sum of the squares of all elements.
+// \ingroup dense
+//
+// The SqrSumReduction class template computes the sum of the squares of all elements in terms
+// of the resulting type \a RT. The reduction can only be vectorized in case the resulting type
+// and the element type are identical.
+*/
+template< typename T       // Type of the elements
+        , typename RT=T >  // Resulting type
+struct SqrSumReduction
+{
+   //**Type definitions****************************************************************************
+   typedef RT                               ResultType;     //!< Resulting type of the reduction.
+   typedef typename IntrinsicTrait<T>::Type  IntrinsicType;  //!< Intrinsic type of the reduction.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   enum { vectorizable = IsSame<T,RT>::value &&
+                         IntrinsicTrait<T>::addition &&
+                         IntrinsicTrait<T>::multiplication };
+   //**********************************************************************************************
+
+   //**Scalar functions****************************************************************************
+   static inline ResultType init   ( const ResultType& ) { return ResultType(); }
+   static inline ResultType map    ( const T& a ) { return sq( a ); }
+   static inline ResultType combine( const ResultType& a, const ResultType& b ) { return a + b; }
+   //**********************************************************************************************
+
+   //**Intrinsic functions*************************************************************************
+   static inline IntrinsicType initv   ( const ResultType& ) { return IntrinsicType(); }
+   static inline IntrinsicType mapv    ( const IntrinsicType& a ) { return a * a; }
+   static inline IntrinsicType combinev( const IntrinsicType& a, const IntrinsicType& b ) {
+      return a + b;
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reduction operation for the number of not-a-number elements.
+// \ingroup dense
+*/
+template< typename T >  // Type of the elements
+struct NaNReduction
+{
+   //**Type definitions****************************************************************************
+   typedef size_t                           ResultType;     //!< Resulting type of the reduction.
+   typedef typename IntrinsicTrait<T>::Type  IntrinsicType;  //!< Intrinsic type of the reduction.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   enum { vectorizable = 0 };
+   //**********************************************************************************************
+
+   //**Scalar functions****************************************************************************
+   static inline ResultType init   ( const ResultType& ) { return 0UL; }
+   static inline ResultType map    ( const T& a ) { return ( isnan( a ) )?( 1UL ):( 0UL ); }
+   static inline ResultType combine( const ResultType& a, const ResultType& b ) { return a + b; }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  AUXILIARY CLASS DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the selection of the vectorized reduction kernels.
+// \ingroup dense
+//
+// In case both the given reduction operation and the given dense vector or matrix type are
+// vectorizable, \a value is set to 1 and the vectorized reduction kernel is selected. Otherwise
+// \a value is set to 0 and the default kernel is chosen.
+*/
+template< typename OP    // Type of the reduction operation
+        , typename T >   // Type of the dense vector or matrix
+struct UseVectorizedReduction
+{
+   enum { value = OP::vectorizable && T::vectorizable };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the selection of the masked remainder kernels.
+// \ingroup dense
+//
+// In case the elements of the given dense vector or matrix type can be accessed via mask
+// registers and the type provides low-level data access, \a value is set to 1 and the remainder
+// of a vectorized reduction is handled by a single masked load. Otherwise \a value is set to 0
+// and the remainder is reduced element by element.
+*/
+template< typename T >  // Type of the dense vector or matrix
+struct UseMaskedRemainder
+{
+   enum { value = IntrinsicTrait<typename T::ElementType>::masking &&
+                  HasConstDataAccess<T>::value };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  REMAINDER KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default reduction of the remainder of a vectorized dense vector reduction.
+// \ingroup dense
+//
+// \param dv The dense vector to be reduced.
+// \param begin The index of the first element of the remainder.
+// \param end The index one past the last element of the remainder.
+// \param op The reduction operation.
+// \param xmm The intrinsic accumulator of the reduction.
+// \param result The scalar accumulator of the reduction.
+// \return void
+//
+// This function reduces the remainder [\a begin, \a end) of a vectorized reduction, which is
+// smaller than a single intrinsic vector, element by element into the scalar accumulator.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline typename DisableIf< UseMaskedRemainder<VT> >::Type
+   reduceRemainder( const DenseVector<VT,TF>& dv, size_t begin, size_t end, OP op,
+                    typename OP::IntrinsicType& xmm, typename OP::ResultType& result )
+{
+   UNUSED_PARAMETER( xmm );
+
+   for( size_t i=begin; i<end; ++i )
+      result = op.combine( result, op.map( (~dv)[i] ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Masked reduction of the remainder of a vectorized dense vector reduction.
+// \ingroup dense
+//
+// \param dv The dense vector to be reduced.
+// \param begin The index of the first element of the remainder.
+// \param end The index one past the last element of the remainder.
+// \param op The reduction operation.
+// \param xmm The intrinsic accumulator of the reduction.
+// \param result The scalar accumulator of the reduction.
+// \return void
+//
+// This function reduces the remainder [\a begin, \a end) of a vectorized reduction, which is
+// smaller than a single intrinsic vector, by means of a single masked load into the intrinsic
+// accumulator. The masked-off elements are filled with the initial value of the reduction.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline typename EnableIf< UseMaskedRemainder<VT> >::Type
+   reduceRemainder( const DenseVector<VT,TF>& dv, size_t begin, size_t end, OP op,
+                    typename OP::IntrinsicType& xmm, typename OP::ResultType& result )
+{
+   if( begin < end ) {
+      xmm = op.combinev( xmm, op.mapv( maskloadu( (~dv).data()+begin, end-begin,
+                                                  op.initv( result ) ) ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default reduction of the remainder of a row/column of a vectorized dense matrix reduction.
+// \ingroup dense
+//
+// \param dm The dense matrix to be reduced.
+// \param k The index of the row (row-major) or column (column-major) to be reduced.
+// \param begin The index of the first element of the remainder.
+// \param end The index one past the last element of the remainder.
+// \param op The reduction operation.
+// \param xmm The intrinsic accumulator of the reduction.
+// \param result The scalar accumulator of the reduction.
+// \return void
+//
+// This function reduces the remainder [\a begin, \a end) of the row/column \a k of a vectorized
+// reduction, which is smaller than a single intrinsic vector, element by element into the scalar
+// accumulator.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+inline typename DisableIf< UseMaskedRemainder<MT> >::Type
+   reduceRemainder( const DenseMatrix<MT,SO>& dm, size_t k, size_t begin, size_t end, OP op,
+                    typename OP::IntrinsicType& xmm, typename OP::ResultType& result )
+{
+   UNUSED_PARAMETER( xmm );
+
+   for( size_t l=begin; l<end; ++l )
+      result = op.combine( result, op.map( ( SO )?( (~dm)(l,k) ):( (~dm)(k,l) ) ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Masked reduction of the remainder of a row/column of a vectorized dense matrix reduction.
+// \ingroup dense
+//
+// \param dm The dense matrix to be reduced.
+// \param k The index of the row (row-major) or column (column-major) to be reduced.
+// \param begin The index of the first element of the remainder.
+// \param end The index one past the last element of the remainder.
+// \param op The reduction operation.
+// \param xmm The intrinsic accumulator of the reduction.
+// \param result The scalar accumulator of the reduction.
+// \return void
+//
+// This function reduces the remainder [\a begin, \a end) of the row/column \a k of a vectorized
+// reduction, which is smaller than a single intrinsic vector, by means of a single masked load
+// into the intrinsic accumulator. The masked-off elements are filled with the initial value of
+// the reduction.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+inline typename EnableIf< UseMaskedRemainder<MT> >::Type
+   reduceRemainder( const DenseMatrix<MT,SO>& dm, size_t k, size_t begin, size_t end, OP op,
+                    typename OP::IntrinsicType& xmm, typename OP::ResultType& result )
+{
+   if( begin < end ) {
+      const typename MT::ElementType* ptr( (~dm).data() + k*(~dm).spacing() + begin );
+      xmm = op.combinev( xmm, op.mapv( maskloadu( ptr, end-begin, op.initv( result ) ) ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DISPATCHED REDUCTION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default dispatch of the reduction of a range of elements of a dense vector.
+// \ingroup dense
+//
+// \param dv The dense vector to be reduced.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
+// \param op The reduction operation.
+// \param result The reduction of the range of elements.
+// \return \a false since the reduction cannot be dispatched.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline bool dispatchReduce( const DenseVector<VT,TF>& dv, size_t begin, size_t end, OP op,
+                            typename OP::ResultType& result )
+{
+   UNUSED_PARAMETER( dv, begin, end, op, result );
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Dispatch of the sum of a range of elements of a dense vector.
+// \ingroup dense
+//
+// \param dv The dense vector to be reduced.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
+// \param op The summation operation.
+// \param result The sum of the range of elements.
+// \return \a true in case the sum has been computed by a dispatched kernel, \a false if not.
+//
+// This function relays the summation of the range [\a begin, \a end) to the dispatched kernel
+// for the current instruction set (see getInstructionSet()).
+*/
+template< typename VT   // Type of the dense vector
+        , bool TF       // Transpose flag
+        , typename T >  // Type of the elements
+inline bool dispatchReduce( const DenseVector<VT,TF>& dv, size_t begin, size_t end,
+                            SumReduction<T> op, T& result )
+{
+   UNUSED_PARAMETER( op );
+
+   return dispatchSum( ~dv, begin, end, result );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  REDUCTION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default reduction of a range of elements of a dense vector.
+// \ingroup dense
+//
+// \param dv The dense vector to be reduced.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
+// \param op The reduction operation.
+// \return The reduction of the range of elements.
+//
+// This function reduces the non-empty range [\a begin, \a end) of the given dense vector by
+// means of the given reduction operation.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline typename DisableIf< UseVectorizedReduction<OP,VT>, typename OP::ResultType >::Type
+   reduce( const DenseVector<VT,TF>& dv, size_t begin, size_t end, OP op )
+{
+   BLAZE_INTERNAL_ASSERT( begin < end && end <= (~dv).size(), "Invalid range detected" );
+
+   typename OP::ResultType result( op.init( op.map( (~dv)[begin] ) ) );
+
+   for( size_t i=begin; i<end; ++i )
+      result = op.combine( result, op.map( (~dv)[i] ) );
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized reduction of a range of elements of a dense vector.
+// \ingroup dense
+//
+// \param dv The dense vector to be reduced.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
+// \param op The reduction operation.
+// \return The reduction of the range of elements.
+//
+// This function reduces the non-empty range [\a begin, \a end) of the given dense vector by
+// means of the given reduction operation. The reduction is performed by four independent
+// intrinsic accumulators in order to hide the latency of the intrinsic operations. Note that
+// the first index of the range is required to be a multiple of the intrinsic vector size. In
+// case the runtime dispatch is active, sums are computed by the according dispatched kernel.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline typename EnableIf< UseVectorizedReduction<OP,VT>, typename OP::ResultType >::Type
+   reduce( const DenseVector<VT,TF>& dv, size_t begin, size_t end, OP op )
+{
+   typedef typename VT::ElementType    ET;
+   typedef IntrinsicTrait<ET>          IT;
+   typedef typename OP::IntrinsicType  IntrinsicType;
+
+   BLAZE_INTERNAL_ASSERT( begin < end && end <= (~dv).size(), "Invalid range detected" );
+   BLAZE_INTERNAL_ASSERT( begin % IT::size == 0UL, "Invalid range detected" );
+
+   typename OP::ResultType result( op.init( op.map( (~dv)[begin] ) ) );
+
+   if( dispatchReduce( ~dv, begin, end, op, result ) )
+      return result;
+
+   IntrinsicType xmm1( op.initv( result ) ), xmm2( xmm1 ), xmm3( xmm1 ), xmm4( xmm1 );
+
+   size_t i( begin );
+
+   for( ; (i+IT::size*4UL) <= end; i+=IT::size*4UL ) {
+      xmm1 = op.combinev( xmm1, op.mapv( (~dv).load(i             ) ) );
+      xmm2 = op.combinev( xmm2, op.mapv( (~dv).load(i+IT::size    ) ) );
+      xmm3 = op.combinev( xmm3, op.mapv( (~dv).load(i+IT::size*2UL) ) );
+      xmm4 = op.combinev( xmm4, op.mapv( (~dv).load(i+IT::size*3UL) ) );
+   }
+   for( ; (i+IT::size) <= end; i+=IT::size ) {
+      xmm1 = op.combinev( xmm1, op.mapv( (~dv).load(i) ) );
+   }
+
+   reduceRemainder( ~dv, i, end, op, xmm2, result );
+
+   xmm1 = op.combinev( op.combinev( xmm1, xmm2 ), op.combinev( xmm3, xmm4 ) );
+
+   ET tmp[IT::size];
+   storeu( tmp, xmm1 );
+
+   for( size_t k=0UL; k<IT::size; ++k )
+      result = op.combine( result, tmp[k] );
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default reduction of a range of rows of a row-major dense matrix.
+// \ingroup dense
+//
+// \param dm The row-major dense matrix to be reduced.
+// \param begin The index of the first row of the range.
+// \param end The index one past the last row of the range.
+// \param op The reduction operation.
+// \return The reduction of the range of rows.
+//
+// This function reduces all elements of the non-empty range of rows [\a begin, \a end) of the
+// given row-major dense matrix by means of the given reduction operation.
+*/
+template< typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+inline typename DisableIf< UseVectorizedReduction<OP,MT>, typename OP::ResultType >::Type
+   reduce( const DenseMatrix<MT,false>& dm, size_t begin, size_t end, OP op )
+{
+   BLAZE_INTERNAL_ASSERT( begin < end && end <= (~dm).rows(), "Invalid range detected" );
+   BLAZE_INTERNAL_ASSERT( (~dm).columns() > 0UL, "Invalid number of columns detected" );
+
+   typename OP::ResultType result( op.init( op.map( (~dm)(begin,0UL) ) ) );
+
+   for( size_t i=begin; i<end; ++i )
+      for( size_t j=0UL; j<(~dm).columns(); ++j )
+         result = op.combine( result, op.map( (~dm)(i,j) ) );
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized reduction of a range of rows of a row-major dense matrix.
+// \ingroup dense
+//
+// \param dm The row-major dense matrix to be reduced.
+// \param begin The index of the first row of the range.
+// \param end The index one past the last row of the range.
+// \param op The reduction operation.
+// \return The reduction of the range of rows.
+//
+// This function reduces all elements of the non-empty range of rows [\a begin, \a end) of the
+// given row-major dense matrix by means of the given reduction operation. The reduction is
+// performed by four independent intrinsic accumulators, which are carried across all rows.
+*/
+template< typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+inline typename EnableIf< UseVectorizedReduction<OP,MT>, typename OP::ResultType >::Type
+   reduce( const DenseMatrix<MT,false>& dm, size_t begin, size_t end, OP op )
+{
+   typedef typename MT::ElementType    ET;
+   typedef IntrinsicTrait<ET>          IT;
+   typedef typename OP::IntrinsicType  IntrinsicType;
+
+   BLAZE_INTERNAL_ASSERT( begin < end && end <= (~dm).rows(), "Invalid range detected" );
+   BLAZE_INTERNAL_ASSERT( (~dm).columns() > 0UL, "Invalid number of columns detected" );
+
+   const size_t N( (~dm).columns() );
+
+   typename OP::ResultType result( op.init( op.map( (~dm)(begin,0UL) ) ) );
+
+   IntrinsicType xmm1( op.initv( result ) ), xmm2( xmm1 ), xmm3( xmm1 ), xmm4( xmm1 );
+
+   for( size_t i=begin; i<end; ++i )
+   {
+      size_t j( 0UL );
+
+      for( ; (j+IT::size*4UL) <= N; j+=IT::size*4UL ) {
+         xmm1 = op.combinev( xmm1, op.mapv( (~dm).load(i,j             ) ) );
+         xmm2 = op.combinev( xmm2, op.mapv( (~dm).load(i,j+IT::size    ) ) );
+         xmm3 = op.combinev( xmm3, op.mapv( (~dm).load(i,j+IT::size*2UL) ) );
+         xmm4 = op.combinev( xmm4, op.mapv( (~dm).load(i,j+IT::size*3UL) ) );
+      }
+      for( ; (j+IT::size) <= N; j+=IT::size ) {
+         xmm1 = op.combinev( xmm1, op.mapv( (~dm).load(i,j) ) );
+      }
+      reduceRemainder( ~dm, i, j, N, op, xmm2, result );
+   }
+
+   xmm1 = op.combinev( op.combinev( xmm1, xmm2 ), op.combinev( xmm3, xmm4 ) );
+
+   ET tmp[IT::size];
+   storeu( tmp, xmm1 );
+
+   for( size_t k=0UL; k<IT::size; ++k )
+      result = op.combine( result, tmp[k] );
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default reduction of a range of columns of a column-major dense matrix.
+// \ingroup dense
+//
+// \param dm The column-major dense matrix to be reduced.
+// \param begin The index of the first column of the range.
+// \param end The index one past the last column of the range.
+// \param op The reduction operation.
+// \return The reduction of the range of columns.
+//
+// This function reduces all elements of the non-empty range of columns [\a begin, \a end) of
+// the given column-major dense matrix by means of the given reduction operation.
+*/
+template< typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+inline typename DisableIf< UseVectorizedReduction<OP,MT>, typename OP::ResultType >::Type
+   reduce( const DenseMatrix<MT,true>& dm, size_t begin, size_t end, OP op )
+{
+   BLAZE_INTERNAL_ASSERT( begin < end && end <= (~dm).columns(), "Invalid range detected" );
+   BLAZE_INTERNAL_ASSERT( (~dm).rows() > 0UL, "Invalid number of rows detected" );
+
+   typename OP::ResultType result( op.init( op.map( (~dm)(0UL,begin) ) ) );
+
+   for( size_t j=begin; j<end; ++j )
+      for( size_t i=0UL; i<(~dm).rows(); ++i )
+         result = op.combine( result, op.map( (~dm)(i,j) ) );
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized reduction of a range of columns of a column-major dense matrix.
+// \ingroup dense
+//
+// \param dm The column-major dense matrix to be reduced.
+// \param begin The index of the first column of the range.
+// \param end The index one past the last column of the range.
+// \param op The reduction operation.
+// \return The reduction of the range of columns.
+//
+// This function reduces all elements of the non-empty range of columns [\a begin, \a end) of
+// the given column-major dense matrix by means of the given reduction operation. The reduction
+// is performed by four independent intrinsic accumulators, which are carried across all columns.
+*/
+template< typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+inline typename EnableIf< UseVectorizedReduction<OP,MT>, typename OP::ResultType >::Type
+   reduce( const DenseMatrix<MT,true>& dm, size_t begin, size_t end, OP op )
+{
+   typedef typename MT::ElementType    ET;
+   typedef IntrinsicTrait<ET>          IT;
+   typedef typename OP::IntrinsicType  IntrinsicType;
+
+   BLAZE_INTERNAL_ASSERT( begin < end && end <= (~dm).columns(), "Invalid range detected" );
+   BLAZE_INTERNAL_ASSERT( (~dm).rows() > 0UL, "Invalid number of rows detected" );
+
+   const size_t M( (~dm).rows() );
+
+   typename OP::ResultType result( op.init( op.map( (~dm)(0UL,begin) ) ) );
+
+   IntrinsicType xmm1( op.initv( result ) ), xmm2( xmm1 ), xmm3( xmm1 ), xmm4( xmm1 );
+
+   for( size_t j=begin; j<end; ++j )
+   {
+      size_t i( 0UL );
+
+      for( ; (i+IT::size*4UL) <= M; i+=IT::size*4UL ) {
+         xmm1 = op.combinev( xmm1, op.mapv( (~dm).load(i             ,j) ) );
+         xmm2 = op.combinev( xmm2, op.mapv( (~dm).load(i+IT::size    ,j) ) );
+         xmm3 = op.combinev( xmm3, op.mapv( (~dm).load(i+IT::size*2UL,j) ) );
+         xmm4 = op.combinev( xmm4, op.mapv( (~dm).load(i+IT::size*3UL,j) ) );
+      }
+      for( ; (i+IT::size) <= M; i+=IT::size ) {
+         xmm1 = op.combinev( xmm1, op.mapv( (~dm).load(i,j) ) );
+      }
+      reduceRemainder( ~dm, j, i, M, op, xmm2, result );
+   }
+
+   xmm1 = op.combinev( op.combinev( xmm1, xmm2 ), op.combinev( xmm3, xmm4 ) );
+
+   ET tmp[IT::size];
+   storeu( tmp, xmm1 );
+
+   for( size_t k=0UL; k<IT::size; ++k )
+      result = op.combine( result, tmp[k] );
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
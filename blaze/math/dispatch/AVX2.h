@@ -0,0 +1,241 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dispatch/AVX2.h
+//  \brief Header file for the AVX2/FMA kernels of the runtime dispatch
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DISPATCH_AVX2_H_
+#define _BLAZE_MATH_DISPATCH_AVX2_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/Dispatch.h>
+#include <blaze/util/Types.h>
+
+
+#if BLAZE_DISPATCH_MODE
+
+namespace blaze {
+
+namespace dispatch {
+
+namespace avx2 {
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Function attributes of the AVX2/FMA packet functions.
+// \ingroup math
+*/
+#define BLAZE_DISPATCH_INLINE \
+   static inline __attribute__((always_inline,target("avx2,fma")))
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Function attributes of the AVX2/FMA kernels.
+// \ingroup math
+*/
+#define BLAZE_DISPATCH_KERNEL \
+   inline __attribute__((target("avx2,fma")))
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS TEMPLATE PACKET
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packet of floating point values for the AVX2/FMA kernels.
+// \ingroup math
+//
+// The Packet class template provides the register type and the basic operations of the AVX2/FMA
+// instruction set for the given element type. It is only available for single and double
+// precision floating point values.
+*/
+template< typename T >  // Type of the elements
+struct Packet;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief AVX2/FMA packet of single precision floating point values.
+// \ingroup math
+*/
+template<>
+struct Packet<float>
+{
+   //**Type definitions****************************************************************************
+   typedef __m256  Type;  //!< Type of the packet.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   enum { size = 8 };  //!< Number of elements in the packet.
+   //**********************************************************************************************
+
+   //**Packet functions****************************************************************************
+   BLAZE_DISPATCH_INLINE Type zero() {
+      return _mm256_setzero_ps();
+   }
+
+   BLAZE_DISPATCH_INLINE Type set( float value ) {
+      return _mm256_set1_ps( value );
+   }
+
+   BLAZE_DISPATCH_INLINE Type load( const float* address ) {
+      return _mm256_loadu_ps( address );
+   }
+
+   BLAZE_DISPATCH_INLINE void store( float* address, Type value ) {
+      _mm256_storeu_ps( address, value );
+   }
+
+   BLAZE_DISPATCH_INLINE Type add( Type a, Type b ) {
+      return _mm256_add_ps( a, b );
+   }
+
+   BLAZE_DISPATCH_INLINE Type mul( Type a, Type b ) {
+      return _mm256_mul_ps( a, b );
+   }
+
+   BLAZE_DISPATCH_INLINE Type fmadd( Type a, Type b, Type c ) {
+      return _mm256_fmadd_ps( a, b, c );
+   }
+
+   BLAZE_DISPATCH_INLINE float sum( Type a ) {
+      const __m128 b( _mm_add_ps( _mm256_castps256_ps128( a ), _mm256_extractf128_ps( a, 1 ) ) );
+      const __m128 c( _mm_hadd_ps( b, b ) );
+      return _mm_cvtss_f32( _mm_hadd_ps( c, c ) );
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief AVX2/FMA packet of double precision floating point values.
+// \ingroup math
+*/
+template<>
+struct Packet<double>
+{
+   //**Type definitions****************************************************************************
+   typedef __m256d  Type;  //!< Type of the packet.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   enum { size = 4 };  //!< Number of elements in the packet.
+   //**********************************************************************************************
+
+   //**Packet functions****************************************************************************
+   BLAZE_DISPATCH_INLINE Type zero() {
+      return _mm256_setzero_pd();
+   }
+
+   BLAZE_DISPATCH_INLINE Type set( double value ) {
+      return _mm256_set1_pd( value );
+   }
+
+   BLAZE_DISPATCH_INLINE Type load( const double* address ) {
+      return _mm256_loadu_pd( address );
+   }
+
+   BLAZE_DISPATCH_INLINE void store( double* address, Type value ) {
+      _mm256_storeu_pd( address, value );
+   }
+
+   BLAZE_DISPATCH_INLINE Type add( Type a, Type b ) {
+      return _mm256_add_pd( a, b );
+   }
+
+   BLAZE_DISPATCH_INLINE Type mul( Type a, Type b ) {
+      return _mm256_mul_pd( a, b );
+   }
+
+   BLAZE_DISPATCH_INLINE Type fmadd( Type a, Type b, Type c ) {
+      return _mm256_fmadd_pd( a, b, c );
+   }
+
+   BLAZE_DISPATCH_INLINE double sum( Type a ) {
+      const __m128d b( _mm_add_pd( _mm256_castpd256_pd128( a ), _mm256_extractf128_pd( a, 1 ) ) );
+      return _mm_cvtsd_f64( _mm_hadd_pd( b, b ) );
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+
+//=================================================================================================
+//
+//  KERNELS
+//
+//=================================================================================================
+
+// The generic kernels are instantiated for the AVX2/FMA instruction set by including them within
+// the according namespace (see <tt><blaze/math/dispatch/GenericKernels.h></tt>).
+#include <blaze/math/dispatch/GenericKernels.h>
+
+#undef BLAZE_DISPATCH_KERNEL
+#undef BLAZE_DISPATCH_INLINE
+
+} // namespace avx2
+
+} // namespace dispatch
+
+} // namespace blaze
+
+#endif
+
+#endif
@@ -0,0 +1,245 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dispatch/AVX512.h
+//  \brief Header file for the AVX-512 kernels of the runtime dispatch
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DISPATCH_AVX512_H_
+#define _BLAZE_MATH_DISPATCH_AVX512_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/Dispatch.h>
+#include <blaze/util/Types.h>
+
+
+#if BLAZE_DISPATCH_MODE
+
+namespace blaze {
+
+namespace dispatch {
+
+namespace avx512 {
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Function attributes of the AVX-512 packet functions.
+// \ingroup math
+*/
+#define BLAZE_DISPATCH_INLINE \
+   static inline __attribute__((always_inline,target("avx512f")))
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Function attributes of the AVX-512 kernels.
+// \ingroup math
+*/
+#define BLAZE_DISPATCH_KERNEL \
+   inline __attribute__((target("avx512f")))
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS TEMPLATE PACKET
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packet of floating point values for the AVX-512 kernels.
+// \ingroup math
+//
+// The Packet class template provides the register type and the basic operations of the AVX-512
+// instruction set for the given element type. It is only available for single and double
+// precision floating point values.
+*/
+template< typename T >  // Type of the elements
+struct Packet;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief AVX-512 packet of single precision floating point values.
+// \ingroup math
+*/
+template<>
+struct Packet<float>
+{
+   //**Type definitions****************************************************************************
+   typedef __m512  Type;  //!< Type of the packet.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   enum { size = 16 };  //!< Number of elements in the packet.
+   //**********************************************************************************************
+
+   //**Packet functions****************************************************************************
+   BLAZE_DISPATCH_INLINE Type zero() {
+      return _mm512_setzero_ps();
+   }
+
+   BLAZE_DISPATCH_INLINE Type set( float value ) {
+      return _mm512_set1_ps( value );
+   }
+
+   BLAZE_DISPATCH_INLINE Type load( const float* address ) {
+      return _mm512_loadu_ps( address );
+   }
+
+   BLAZE_DISPATCH_INLINE void store( float* address, Type value ) {
+      _mm512_storeu_ps( address, value );
+   }
+
+   BLAZE_DISPATCH_INLINE Type add( Type a, Type b ) {
+      return _mm512_add_ps( a, b );
+   }
+
+   BLAZE_DISPATCH_INLINE Type mul( Type a, Type b ) {
+      return _mm512_mul_ps( a, b );
+   }
+
+   BLAZE_DISPATCH_INLINE Type fmadd( Type a, Type b, Type c ) {
+      return _mm512_fmadd_ps( a, b, c );
+   }
+
+   BLAZE_DISPATCH_INLINE float sum( Type a ) {
+      const __m512 b( _mm512_add_ps( a, _mm512_mask_shuffle_f32x4( a, 0xFFFF, a, a, 0x4E ) ) );
+      const __m512 c( _mm512_add_ps( b, _mm512_mask_shuffle_f32x4( b, 0xFFFF, b, b, 0xB1 ) ) );
+      const __m512 d( _mm512_add_ps( c, _mm512_mask_permute_ps( c, 0xFFFF, c, 0x4E ) ) );
+      const __m512 e( _mm512_add_ps( d, _mm512_mask_permute_ps( d, 0xFFFF, d, 0xB1 ) ) );
+      return _mm512_cvtss_f32( e );
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief AVX-512 packet of double precision floating point values.
+// \ingroup math
+*/
+template<>
+struct Packet<double>
+{
+   //**Type definitions****************************************************************************
+   typedef __m512d  Type;  //!< Type of the packet.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   enum { size = 8 };  //!< Number of elements in the packet.
+   //**********************************************************************************************
+
+   //**Packet functions****************************************************************************
+   BLAZE_DISPATCH_INLINE Type zero() {
+      return _mm512_setzero_pd();
+   }
+
+   BLAZE_DISPATCH_INLINE Type set( double value ) {
+      return _mm512_set1_pd( value );
+   }
+
+   BLAZE_DISPATCH_INLINE Type load( const double* address ) {
+      return _mm512_loadu_pd( address );
+   }
+
+   BLAZE_DISPATCH_INLINE void store( double* address, Type value ) {
+      _mm512_storeu_pd( address, value );
+   }
+
+   BLAZE_DISPATCH_INLINE Type add( Type a, Type b ) {
+      return _mm512_add_pd( a, b );
+   }
+
+   BLAZE_DISPATCH_INLINE Type mul( Type a, Type b ) {
+      return _mm512_mul_pd( a, b );
+   }
+
+   BLAZE_DISPATCH_INLINE Type fmadd( Type a, Type b, Type c ) {
+      return _mm512_fmadd_pd( a, b, c );
+   }
+
+   BLAZE_DISPATCH_INLINE double sum( Type a ) {
+      const __m512d b( _mm512_add_pd( a, _mm512_mask_shuffle_f64x2( a, 0xFF, a, a, 0x4E ) ) );
+      const __m512d c( _mm512_add_pd( b, _mm512_mask_shuffle_f64x2( b, 0xFF, b, b, 0xB1 ) ) );
+      const __m512d d( _mm512_add_pd( c, _mm512_mask_permute_pd( c, 0xFF, c, 0x55 ) ) );
+      return _mm512_cvtsd_f64( d );
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+
+//=================================================================================================
+//
+//  KERNELS
+//
+//=================================================================================================
+
+// The generic kernels are instantiated for the AVX-512 instruction set by including them within
+// the according namespace (see <tt><blaze/math/dispatch/GenericKernels.h></tt>).
+#include <blaze/math/dispatch/GenericKernels.h>
+
+#undef BLAZE_DISPATCH_KERNEL
+#undef BLAZE_DISPATCH_INLINE
+
+} // namespace avx512
+
+} // namespace dispatch
+
+} // namespace blaze
+
+#endif
+
+#endif
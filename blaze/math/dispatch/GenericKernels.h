@@ -0,0 +1,541 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dispatch/GenericKernels.h
+//  \brief Header file for the generic kernels of the runtime dispatch
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+//*************************************************************************************************
+// Note: This file deliberately has no include guard. It is included once for each instruction
+// set of the runtime dispatch (see <tt><blaze/math/dispatch/AVX.h></tt>, <tt><blaze/math/
+// dispatch/AVX2.h></tt>, and <tt><blaze/math/dispatch/AVX512.h></tt>) within the namespace of
+// the according instruction set, which also provides the Packet class template and the
+// BLAZE_DISPATCH_KERNEL and BLAZE_DISPATCH_INLINE macros. All matrices are stored in row-major
+// order, a scaling factor \a beta of 0 results in a plain assignment to the target (i.e. the
+// initial values of the target are not accessed).
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTANTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+//! Number of rows of the right-hand side matrix operand processed per block of the GEMM kernel.
+const size_t gemmBlockDepth = 128UL;
+
+//! Number of columns of the right-hand side matrix operand processed per block of the GEMM kernel.
+const size_t gemmBlockWidth = 256UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LEVEL 1 KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Dispatched kernel for the inner product of two dense vectors
+//        (\f$ s=\vec{x}^T*\vec{y} \f$).
+// \ingroup math
+//
+// \param n The size of the two vectors.
+// \param x Pointer to the first element of the left-hand side vector.
+// \param y Pointer to the first element of the right-hand side vector.
+// \return The inner product of the two vectors.
+*/
+template< typename T >  // Type of the elements
+BLAZE_DISPATCH_KERNEL T dot( size_t n, const T* x, const T* y )
+{
+   typedef Packet<T>          P;
+   typedef typename P::Type  PT;
+
+   PT xmm1( P::zero() ), xmm2( P::zero() ), xmm3( P::zero() ), xmm4( P::zero() );
+
+   size_t i( 0UL );
+
+   for( ; (i+P::size*4UL) <= n; i+=P::size*4UL ) {
+      xmm1 = P::fmadd( P::load( x+i             ), P::load( y+i             ), xmm1 );
+      xmm2 = P::fmadd( P::load( x+i+P::size     ), P::load( y+i+P::size     ), xmm2 );
+      xmm3 = P::fmadd( P::load( x+i+P::size*2UL ), P::load( y+i+P::size*2UL ), xmm3 );
+      xmm4 = P::fmadd( P::load( x+i+P::size*3UL ), P::load( y+i+P::size*3UL ), xmm4 );
+   }
+   for( ; (i+P::size) <= n; i+=P::size ) {
+      xmm1 = P::fmadd( P::load( x+i ), P::load( y+i ), xmm1 );
+   }
+
+   T res( P::sum( P::add( P::add( xmm1, xmm2 ), P::add( xmm3, xmm4 ) ) ) );
+
+   for( ; i<n; ++i )
+      res += x[i] * y[i];
+
+   return res;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Dispatched kernel for the sum of all elements of a dense vector.
+// \ingroup math
+//
+// \param n The size of the vector.
+// \param x Pointer to the first element of the vector.
+// \return The sum of all elements.
+*/
+template< typename T >  // Type of the elements
+BLAZE_DISPATCH_KERNEL T sum( size_t n, const T* x )
+{
+   typedef Packet<T>          P;
+   typedef typename P::Type  PT;
+
+   PT xmm1( P::zero() ), xmm2( P::zero() ), xmm3( P::zero() ), xmm4( P::zero() );
+
+   size_t i( 0UL );
+
+   for( ; (i+P::size*4UL) <= n; i+=P::size*4UL ) {
+      xmm1 = P::add( xmm1, P::load( x+i             ) );
+      xmm2 = P::add( xmm2, P::load( x+i+P::size     ) );
+      xmm3 = P::add( xmm3, P::load( x+i+P::size*2UL ) );
+      xmm4 = P::add( xmm4, P::load( x+i+P::size*3UL ) );
+   }
+   for( ; (i+P::size) <= n; i+=P::size ) {
+      xmm1 = P::add( xmm1, P::load( x+i ) );
+   }
+
+   T res( P::sum( P::add( P::add( xmm1, xmm2 ), P::add( xmm3, xmm4 ) ) ) );
+
+   for( ; i<n; ++i )
+      res += x[i];
+
+   return res;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Dispatched kernel for the scaled addition of two dense vectors
+//        (\f$ \vec{y}+=\alpha*\vec{x} \f$).
+// \ingroup math
+//
+// \param n The size of the two vectors.
+// \param alpha The scaling factor for \f$ \vec{x} \f$.
+// \param x Pointer to the first element of the right-hand side vector.
+// \param y Pointer to the first element of the target vector.
+// \return void
+*/
+template< typename T >  // Type of the elements
+BLAZE_DISPATCH_KERNEL void axpy( size_t n, T alpha, const T* x, T* y )
+{
+   typedef Packet<T>          P;
+   typedef typename P::Type  PT;
+
+   const PT factor( P::set( alpha ) );
+
+   size_t i( 0UL );
+
+   for( ; (i+P::size*2UL) <= n; i+=P::size*2UL ) {
+      P::store( y+i        , P::fmadd( factor, P::load( x+i         ), P::load( y+i         ) ) );
+      P::store( y+i+P::size, P::fmadd( factor, P::load( x+i+P::size ), P::load( y+i+P::size ) ) );
+   }
+   for( ; (i+P::size) <= n; i+=P::size ) {
+      P::store( y+i, P::fmadd( factor, P::load( x+i ), P::load( y+i ) ) );
+   }
+   for( ; i<n; ++i ) {
+      y[i] += alpha * x[i];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scaling of a dense vector (\f$ \vec{y}*=\beta \f$).
+// \ingroup math
+//
+// \param n The size of the vector.
+// \param beta The scaling factor. In case \a beta is 0, the vector is reset.
+// \param y Pointer to the first element of the vector.
+// \return void
+*/
+template< typename T >  // Type of the elements
+BLAZE_DISPATCH_KERNEL void scal( size_t n, T beta, T* y )
+{
+   if( beta == T(0) ) {
+      for( size_t i=0UL; i<n; ++i )
+         y[i] = T(0);
+   }
+   else if( beta != T(1) ) {
+      for( size_t i=0UL; i<n; ++i )
+         y[i] *= beta;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LEVEL 2 KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Dispatched kernel for a row-major dense matrix/dense vector multiplication
+//        (\f$ \vec{y}=\alpha*A*\vec{x}+\beta*\vec{y} \f$).
+// \ingroup math
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \param A Pointer to the first element of the row-major matrix.
+// \param lda The spacing between two rows of the matrix.
+// \param x Pointer to the first element of the right-hand side vector of size \a n.
+// \param beta The scaling factor for \f$ \vec{y} \f$.
+// \param y Pointer to the first element of the target vector of size \a m.
+// \return void
+//
+// This kernel computes four inner products at once in order to reuse the loaded packets of
+// the right-hand side vector.
+*/
+template< typename T >  // Type of the elements
+BLAZE_DISPATCH_KERNEL void gemv( size_t m, size_t n, T alpha, const T* A, size_t lda,
+                                 const T* x, T beta, T* y )
+{
+   typedef Packet<T>          P;
+   typedef typename P::Type  PT;
+
+   size_t i( 0UL );
+
+   for( ; (i+4UL) <= m; i+=4UL )
+   {
+      const T* a1( A + i*lda );
+      const T* a2( a1 + lda );
+      const T* a3( a2 + lda );
+      const T* a4( a3 + lda );
+
+      PT xmm1( P::zero() ), xmm2( P::zero() ), xmm3( P::zero() ), xmm4( P::zero() );
+
+      size_t j( 0UL );
+
+      for( ; (j+P::size) <= n; j+=P::size ) {
+         const PT x1( P::load( x+j ) );
+         xmm1 = P::fmadd( P::load( a1+j ), x1, xmm1 );
+         xmm2 = P::fmadd( P::load( a2+j ), x1, xmm2 );
+         xmm3 = P::fmadd( P::load( a3+j ), x1, xmm3 );
+         xmm4 = P::fmadd( P::load( a4+j ), x1, xmm4 );
+      }
+
+      T s1( P::sum( xmm1 ) ), s2( P::sum( xmm2 ) ), s3( P::sum( xmm3 ) ), s4( P::sum( xmm4 ) );
+
+      for( ; j<n; ++j ) {
+         s1 += a1[j] * x[j];
+         s2 += a2[j] * x[j];
+         s3 += a3[j] * x[j];
+         s4 += a4[j] * x[j];
+      }
+
+      if( beta == T(0) ) {
+         y[i    ] = alpha * s1;
+         y[i+1UL] = alpha * s2;
+         y[i+2UL] = alpha * s3;
+         y[i+3UL] = alpha * s4;
+      }
+      else {
+         y[i    ] = alpha * s1 + beta * y[i    ];
+         y[i+1UL] = alpha * s2 + beta * y[i+1UL];
+         y[i+2UL] = alpha * s3 + beta * y[i+2UL];
+         y[i+3UL] = alpha * s4 + beta * y[i+3UL];
+      }
+   }
+
+   for( ; i<m; ++i ) {
+      const T s( alpha * dot( n, A+i*lda, x ) );
+      y[i] = ( beta == T(0) )?( s ):( s + beta * y[i] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Dispatched kernel for a transpose row-major dense matrix/dense vector multiplication
+//        (\f$ \vec{y}=\alpha*A^T*\vec{x}+\beta*\vec{y} \f$).
+// \ingroup math
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param alpha The scaling factor for \f$ A^T*\vec{x} \f$.
+// \param A Pointer to the first element of the row-major matrix.
+// \param lda The spacing between two rows of the matrix.
+// \param x Pointer to the first element of the right-hand side vector of size \a m.
+// \param beta The scaling factor for \f$ \vec{y} \f$.
+// \param y Pointer to the first element of the target vector of size \a n.
+// \return void
+//
+// This kernel adds four scaled rows of the matrix at once in order to reuse the loaded packets
+// of the target vector.
+*/
+template< typename T >  // Type of the elements
+BLAZE_DISPATCH_KERNEL void gemvt( size_t m, size_t n, T alpha, const T* A, size_t lda,
+                                  const T* x, T beta, T* y )
+{
+   typedef Packet<T>          P;
+   typedef typename P::Type  PT;
+
+   scal( n, beta, y );
+
+   size_t i( 0UL );
+
+   for( ; (i+4UL) <= m; i+=4UL )
+   {
+      const T* a1( A + i*lda );
+      const T* a2( a1 + lda );
+      const T* a3( a2 + lda );
+      const T* a4( a3 + lda );
+
+      const T c1( alpha * x[i    ] );
+      const T c2( alpha * x[i+1UL] );
+      const T c3( alpha * x[i+2UL] );
+      const T c4( alpha * x[i+3UL] );
+
+      const PT x1( P::set( c1 ) ), x2( P::set( c2 ) ), x3( P::set( c3 ) ), x4( P::set( c4 ) );
+
+      size_t j( 0UL );
+
+      for( ; (j+P::size) <= n; j+=P::size ) {
+         PT y1( P::load( y+j ) );
+         y1 = P::fmadd( P::load( a1+j ), x1, y1 );
+         y1 = P::fmadd( P::load( a2+j ), x2, y1 );
+         y1 = P::fmadd( P::load( a3+j ), x3, y1 );
+         y1 = P::fmadd( P::load( a4+j ), x4, y1 );
+         P::store( y+j, y1 );
+      }
+      for( ; j<n; ++j ) {
+         y[j] += a1[j] * c1 + a2[j] * c2 + a3[j] * c3 + a4[j] * c4;
+      }
+   }
+
+   for( ; i<m; ++i ) {
+      axpy( n, alpha * x[i], A+i*lda, y );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LEVEL 3 KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Dispatched kernel for a block of a single row of a row-major dense matrix/dense matrix
+//        multiplication.
+// \ingroup math
+//
+// \param jbegin The index of the first column of the block.
+// \param jend The index one past the last column of the block.
+// \param kbegin The index of the first row of the right-hand side block.
+// \param kend The index one past the last row of the right-hand side block.
+// \param alpha The scaling factor for the product.
+// \param a Pointer to the first element of the row of the left-hand side matrix.
+// \param B Pointer to the first element of the right-hand side matrix.
+// \param ldb The spacing between two rows of the right-hand side matrix.
+// \param c Pointer to the first element of the row of the target matrix.
+// \return void
+*/
+template< typename T >  // Type of the elements
+BLAZE_DISPATCH_KERNEL void gemmRow( size_t jbegin, size_t jend, size_t kbegin, size_t kend,
+                                    T alpha, const T* a, const T* B, size_t ldb, T* c )
+{
+   typedef Packet<T>          P;
+   typedef typename P::Type  PT;
+
+   const PT factor( P::set( alpha ) );
+
+   size_t j( jbegin );
+
+   for( ; (j+P::size*2UL) <= jend; j+=P::size*2UL ) {
+      PT xmm1( P::zero() ), xmm2( P::zero() );
+      for( size_t k=kbegin; k<kend; ++k ) {
+         const PT a1( P::set( a[k] ) );
+         xmm1 = P::fmadd( a1, P::load( B+k*ldb+j         ), xmm1 );
+         xmm2 = P::fmadd( a1, P::load( B+k*ldb+j+P::size ), xmm2 );
+      }
+      P::store( c+j        , P::fmadd( factor, xmm1, P::load( c+j         ) ) );
+      P::store( c+j+P::size, P::fmadd( factor, xmm2, P::load( c+j+P::size ) ) );
+   }
+   for( ; (j+P::size) <= jend; j+=P::size ) {
+      PT xmm1( P::zero() );
+      for( size_t k=kbegin; k<kend; ++k ) {
+         xmm1 = P::fmadd( P::set( a[k] ), P::load( B+k*ldb+j ), xmm1 );
+      }
+      P::store( c+j, P::fmadd( factor, xmm1, P::load( c+j ) ) );
+   }
+   for( ; j<jend; ++j ) {
+      T value( 0 );
+      for( size_t k=kbegin; k<kend; ++k ) {
+         value += a[k] * B[k*ldb+j];
+      }
+      c[j] += alpha * value;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Dispatched kernel for a row-major dense matrix/dense matrix multiplication
+//        (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup math
+//
+// \param m The number of rows of the left-hand side matrix and the target matrix.
+// \param n The number of columns of the right-hand side matrix and the target matrix.
+// \param k The number of columns of the left-hand side matrix.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param A Pointer to the first element of the row-major left-hand side matrix.
+// \param lda The spacing between two rows of the left-hand side matrix.
+// \param B Pointer to the first element of the row-major right-hand side matrix.
+// \param ldb The spacing between two rows of the right-hand side matrix.
+// \param beta The scaling factor for \f$ C \f$.
+// \param C Pointer to the first element of the row-major target matrix.
+// \param ldc The spacing between two rows of the target matrix.
+// \return void
+//
+// This kernel traverses the right-hand side matrix in cache sized blocks and computes blocks of
+// four rows and two packets of the target matrix in registers.
+*/
+template< typename T >  // Type of the elements
+BLAZE_DISPATCH_KERNEL void gemm( size_t m, size_t n, size_t k, T alpha, const T* A, size_t lda,
+                                 const T* B, size_t ldb, T beta, T* C, size_t ldc )
+{
+   typedef Packet<T>          P;
+   typedef typename P::Type  PT;
+
+   for( size_t i=0UL; i<m; ++i ) {
+      scal( n, beta, C+i*ldc );
+   }
+
+   const PT factor( P::set( alpha ) );
+
+   for( size_t kk=0UL; kk<k; kk+=gemmBlockDepth )
+   {
+      const size_t kend( ( kk+gemmBlockDepth < k )?( kk+gemmBlockDepth ):( k ) );
+
+      for( size_t jj=0UL; jj<n; jj+=gemmBlockWidth )
+      {
+         const size_t jend( ( jj+gemmBlockWidth < n )?( jj+gemmBlockWidth ):( n ) );
+
+         size_t i( 0UL );
+
+         for( ; (i+4UL) <= m; i+=4UL )
+         {
+            const T* a1( A + i*lda );
+            const T* a2( a1 + lda );
+            const T* a3( a2 + lda );
+            const T* a4( a3 + lda );
+
+            T* c1( C + i*ldc );
+            T* c2( c1 + ldc );
+            T* c3( c2 + ldc );
+            T* c4( c3 + ldc );
+
+            size_t j( jj );
+
+            for( ; (j+P::size*2UL) <= jend; j+=P::size*2UL )
+            {
+               PT xmm1( P::zero() ), xmm2( P::zero() ), xmm3( P::zero() ), xmm4( P::zero() );
+               PT xmm5( P::zero() ), xmm6( P::zero() ), xmm7( P::zero() ), xmm8( P::zero() );
+
+               for( size_t l=kk; l<kend; ++l ) {
+                  const PT b1( P::load( B+l*ldb+j         ) );
+                  const PT b2( P::load( B+l*ldb+j+P::size ) );
+                  const PT a11( P::set( a1[l] ) );
+                  const PT a21( P::set( a2[l] ) );
+                  const PT a31( P::set( a3[l] ) );
+                  const PT a41( P::set( a4[l] ) );
+                  xmm1 = P::fmadd( a11, b1, xmm1 );
+                  xmm2 = P::fmadd( a11, b2, xmm2 );
+                  xmm3 = P::fmadd( a21, b1, xmm3 );
+                  xmm4 = P::fmadd( a21, b2, xmm4 );
+                  xmm5 = P::fmadd( a31, b1, xmm5 );
+                  xmm6 = P::fmadd( a31, b2, xmm6 );
+                  xmm7 = P::fmadd( a41, b1, xmm7 );
+                  xmm8 = P::fmadd( a41, b2, xmm8 );
+               }
+
+               P::store( c1+j        , P::fmadd( factor, xmm1, P::load( c1+j         ) ) );
+               P::store( c1+j+P::size, P::fmadd( factor, xmm2, P::load( c1+j+P::size ) ) );
+               P::store( c2+j        , P::fmadd( factor, xmm3, P::load( c2+j         ) ) );
+               P::store( c2+j+P::size, P::fmadd( factor, xmm4, P::load( c2+j+P::size ) ) );
+               P::store( c3+j        , P::fmadd( factor, xmm5, P::load( c3+j         ) ) );
+               P::store( c3+j+P::size, P::fmadd( factor, xmm6, P::load( c3+j+P::size ) ) );
+               P::store( c4+j        , P::fmadd( factor, xmm7, P::load( c4+j         ) ) );
+               P::store( c4+j+P::size, P::fmadd( factor, xmm8, P::load( c4+j+P::size ) ) );
+            }
+
+            gemmRow( j, jend, kk, kend, alpha, a1, B, ldb, c1 );
+            gemmRow( j, jend, kk, kend, alpha, a2, B, ldb, c2 );
+            gemmRow( j, jend, kk, kend, alpha, a3, B, ldb, c3 );
+            gemmRow( j, jend, kk, kend, alpha, a4, B, ldb, c4 );
+         }
+
+         for( ; i<m; ++i ) {
+            gemmRow( jj, jend, kk, kend, alpha, A+i*lda, B, ldb, C+i*ldc );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
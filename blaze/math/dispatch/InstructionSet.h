@@ -0,0 +1,468 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dispatch/InstructionSet.h
+//  \brief Header file for the instruction set selection of the runtime dispatch
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DISPATCH_INSTRUCTIONSET_H_
+#define _BLAZE_MATH_DISPATCH_INSTRUCTIONSET_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <blaze/system/Dispatch.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INSTRUCTION SETS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Identifiers of the instruction sets of the runtime dispatch.
+// \ingroup math
+//
+// The InstructionSet enumeration identifies the instruction sets that are distinguished by the
+// runtime dispatch of the Blaze library. The order of the enumerators reflects the capabilities
+// of the instruction sets, i.e. each instruction set comprises all preceding instruction sets.
+*/
+enum InstructionSet
+{
+   defaultInstructionSet = 0,  //!< No vectorization.
+   sse2InstructionSet    = 1,  //!< SSE2 (including SSE3, SSSE3, and SSE4).
+   avxInstructionSet     = 2,  //!< AVX.
+   avx2InstructionSet    = 3,  //!< AVX2 and FMA3.
+   avx512InstructionSet  = 4   //!< AVX-512 foundation.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS INSTRUCTIONSETREGISTRY
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Registry for the instruction set used by the runtime dispatch.
+// \ingroup math
+//
+// The InstructionSetRegistry class determines the instruction set of the executing CPU and
+// stores the instruction set that is currently used by the dispatched kernels. The single
+// instance is created on first use, i.e. the CPU is queried only once.
+*/
+class InstructionSetRegistry : private NonCopyable
+{
+ public:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline InstructionSetRegistry& instance();
+
+   inline InstructionSet available() const;
+   inline InstructionSet get      () const;
+   inline void           set      ( InstructionSet is );
+
+   static inline InstructionSet compiled();
+   static inline const char*    name    ( InstructionSet is );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline InstructionSetRegistry();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline InstructionSet detect();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   InstructionSet available_;  //!< The instruction set of the executing CPU.
+   InstructionSet current_;    //!< The instruction set currently used by the dispatched kernels.
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The constructor of the InstructionSetRegistry class.
+//
+// The constructor determines the instruction set of the executing CPU. In case the environment
+// variable \c BLAZE_INSTRUCTION_SET names a less powerful instruction set (\c default, \c sse2,
+// \c avx, \c avx2, or \c avx512), the dispatched kernels are restricted to this instruction set.
+// Invalid settings in the environment are ignored.
+*/
+inline InstructionSetRegistry::InstructionSetRegistry()
+   : available_( detect()   )  // The instruction set of the executing CPU
+   , current_  ( available_ )  // The instruction set currently used by the dispatched kernels
+{
+   const char* value( std::getenv( "BLAZE_INSTRUCTION_SET" ) );
+
+   if( value == NULL ) return;
+
+   for( int i=defaultInstructionSet; i<=available_; ++i ) {
+      if( std::strcmp( value, name( static_cast<InstructionSet>( i ) ) ) == 0 ) {
+         current_ = static_cast<InstructionSet>( i );
+         break;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the single instance of the instruction set registry.
+//
+// \return Reference to the instruction set registry.
+*/
+inline InstructionSetRegistry& InstructionSetRegistry::instance()
+{
+   static InstructionSetRegistry registry;
+   return registry;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the instruction set of the executing CPU.
+//
+// \return The instruction set of the executing CPU.
+*/
+inline InstructionSet InstructionSetRegistry::available() const
+{
+   return available_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the instruction set currently used by the dispatched kernels.
+//
+// \return The current instruction set.
+*/
+inline InstructionSet InstructionSetRegistry::get() const
+{
+   return current_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Setting the instruction set used by the dispatched kernels.
+//
+// \param is The new instruction set.
+// \return void
+// \exception std::invalid_argument Instruction set not available.
+*/
+inline void InstructionSetRegistry::set( InstructionSet is )
+{
+   if( is < defaultInstructionSet || is > available_ )
+      throw std::invalid_argument( std::string( "Instruction set '" ) + name( is ) +
+                                   "' is not available on the executing CPU" );
+
+   current_ = is;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the instruction set selected at compile time.
+//
+// \return The instruction set selected at compile time.
+//
+// Note that the AVX2 instruction set is only reported in case both AVX2 and FMA3 are enabled.
+*/
+inline InstructionSet InstructionSetRegistry::compiled()
+{
+#if BLAZE_AVX512F_MODE
+   return avx512InstructionSet;
+#elif BLAZE_AVX2_MODE && BLAZE_FMA_MODE
+   return avx2InstructionSet;
+#elif BLAZE_AVX_MODE
+   return avxInstructionSet;
+#elif BLAZE_SSE2_MODE
+   return sse2InstructionSet;
+#else
+   return defaultInstructionSet;
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the name of the given instruction set.
+//
+// \param is The instruction set.
+// \return The name of the instruction set.
+*/
+inline const char* InstructionSetRegistry::name( InstructionSet is )
+{
+   switch( is ) {
+      case defaultInstructionSet: return "default";
+      case sse2InstructionSet   : return "sse2";
+      case avxInstructionSet    : return "avx";
+      case avx2InstructionSet   : return "avx2";
+      case avx512InstructionSet : return "avx512";
+      default                   : return "unknown";
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Determines the instruction set of the executing CPU.
+//
+// \return The instruction set of the executing CPU.
+//
+// In dispatch mode, this function queries the capabilities of the executing CPU via the CPUID
+// instruction (including the check whether the operating system supports the according register
+// state). Otherwise the instruction set selected at compile time is returned.
+*/
+inline InstructionSet InstructionSetRegistry::detect()
+{
+#if BLAZE_DISPATCH_MODE
+   __builtin_cpu_init();
+
+   if( __builtin_cpu_supports( "avx512f" ) )
+      return avx512InstructionSet;
+   else if( __builtin_cpu_supports( "avx2" ) && __builtin_cpu_supports( "fma" ) )
+      return avx2InstructionSet;
+   else if( __builtin_cpu_supports( "avx" ) )
+      return avxInstructionSet;
+   else if( __builtin_cpu_supports( "sse2" ) )
+      return sse2InstructionSet;
+   else return defaultInstructionSet;
+#else
+   return compiled();
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INSTRUCTION SET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Instruction set functions */
+//@{
+inline InstructionSet getInstructionSet();
+inline void           setInstructionSet( InstructionSet is );
+inline InstructionSet getAvailableInstructionSet();
+inline InstructionSet getCompiledInstructionSet();
+inline const char*    getInstructionSetName( InstructionSet is );
+inline bool           isDispatchActive();
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the instruction set currently used by the dispatched kernels.
+// \ingroup math
+//
+// \return The current instruction set.
+//
+// By default, the dispatched kernels of the Blaze library use the most powerful instruction set
+// of the executing CPU. In case this instruction set is more powerful than the one selected at
+// compile time (see getCompiledInstructionSet()), the dense matrix/vector multiplications, the
+// dense matrix multiplications, the inner products, the scaled vector additions, and the sums of
+// dense vectors of single and double precision values are relayed to kernels specifically
+// compiled for this instruction set:
+
+   \code
+   using blaze::getInstructionSetName;
+
+   std::cout << "Compiled for " << getInstructionSetName( blaze::getCompiledInstructionSet() )
+             << ", running on " << getInstructionSetName( blaze::getInstructionSet() ) << "\n";
+   \endcode
+*/
+inline InstructionSet getInstructionSet()
+{
+   return InstructionSetRegistry::instance().get();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the instruction set used by the dispatched kernels.
+// \ingroup math
+//
+// \param is The new instruction set.
+// \return void
+// \exception std::invalid_argument Instruction set not available.
+//
+// This function restricts the dispatched kernels to the given instruction set. Setting an
+// instruction set that is not more powerful than the one selected at compile time effectively
+// disables the runtime dispatch. In case the given instruction set is not available on the
+// executing CPU, a \a std::invalid_argument exception is thrown. The initial setting can also
+// be given via the \c BLAZE_INSTRUCTION_SET environment variable (as for instance
+// \c BLAZE_INSTRUCTION_SET=avx2).
+//
+// Note that the instruction set is not synchronized. Therefore it should not be changed while
+// another thread evaluates Blaze expressions.
+*/
+inline void setInstructionSet( InstructionSet is )
+{
+   InstructionSetRegistry::instance().set( is );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the most powerful instruction set of the executing CPU.
+// \ingroup math
+//
+// \return The instruction set of the executing CPU.
+//
+// In case the dispatch mode is disabled (see BLAZE_DISPATCH_MODE), this function returns the
+// instruction set selected at compile time.
+*/
+inline InstructionSet getAvailableInstructionSet()
+{
+   return InstructionSetRegistry::instance().available();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the instruction set selected at compile time.
+// \ingroup math
+//
+// \return The instruction set selected at compile time.
+*/
+inline InstructionSet getCompiledInstructionSet()
+{
+   return InstructionSetRegistry::compiled();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the name of the given instruction set.
+// \ingroup math
+//
+// \param is The instruction set.
+// \return The name of the instruction set (as used by the \c BLAZE_INSTRUCTION_SET variable).
+*/
+inline const char* getInstructionSetName( InstructionSet is )
+{
+   return InstructionSetRegistry::name( is );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether operations are currently relayed to the dispatched kernels.
+// \ingroup math
+//
+// \return \a true in case the dispatched kernels are used, \a false if not.
+//
+// The dispatched kernels are used in case the current instruction set is at least AVX and more
+// powerful than the instruction set selected at compile time.
+*/
+inline bool isDispatchActive()
+{
+#if BLAZE_DISPATCH_MODE
+   const InstructionSet is( getInstructionSet() );
+   return is >= avxInstructionSet && is > getCompiledInstructionSet();
+#else
+   return false;
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
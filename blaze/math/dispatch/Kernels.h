@@ -0,0 +1,285 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dispatch/Kernels.h
+//  \brief Header file for the selection of the kernels of the runtime dispatch
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DISPATCH_KERNELS_H_
+#define _BLAZE_MATH_DISPATCH_KERNELS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/dispatch/AVX.h>
+#include <blaze/math/dispatch/AVX2.h>
+#include <blaze/math/dispatch/AVX512.h>
+#include <blaze/math/dispatch/InstructionSet.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/IsDiagonal.h>
+#include <blaze/system/Dispatch.h>
+#include <blaze/util/typetraits/IsDouble.h>
+#include <blaze/util/typetraits/IsFloat.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS USEDISPATCHEDKERNEL
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the selection of the dispatched kernels.
+// \ingroup math
+//
+// In case the dispatch mode is enabled and the given vector and/or matrix types can be handled
+// by the dispatched kernels, the nested \a value is set to 1, otherwise it is 0. This requires
+// all types to provide access to their (vectorizable) data, to have the same single or double
+// precision element type, and to not be diagonal matrices.
+*/
+template< typename T1         // Type of the first operand
+        , typename T2 = T1    // Type of the second operand
+        , typename T3 = T1 >  // Type of the third operand
+struct UseDispatchedKernel
+{
+   //**********************************************************************************************
+   typedef typename T1::ElementType  ET;  //!< Element type of the first operand.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   enum { value = BLAZE_DISPATCH_MODE &&
+                  HasConstDataAccess<T1>::value &&
+                  HasConstDataAccess<T2>::value &&
+                  HasConstDataAccess<T3>::value &&
+                  !IsDiagonal<T1>::value && !IsDiagonal<T2>::value && !IsDiagonal<T3>::value &&
+                  T1::vectorizable && T2::vectorizable && T3::vectorizable &&
+                  ( IsFloat<ET>::value || IsDouble<ET>::value ) &&
+                  IsSame<ET,typename T2::ElementType>::value &&
+                  IsSame<ET,typename T3::ElementType>::value };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DISPATCHED KERNELS
+//
+//=================================================================================================
+
+#if BLAZE_DISPATCH_MODE
+
+namespace dispatch {
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Inner product of two dense vectors for the current instruction set.
+// \ingroup math
+//
+// \param n The size of the two vectors.
+// \param x Pointer to the first element of the left-hand side vector.
+// \param y Pointer to the first element of the right-hand side vector.
+// \return The inner product of the two vectors.
+*/
+template< typename T >  // Type of the elements
+inline T dot( size_t n, const T* x, const T* y )
+{
+   switch( getInstructionSet() ) {
+      case avx512InstructionSet: return avx512::dot( n, x, y );
+      case avx2InstructionSet  : return avx2::dot( n, x, y );
+      default                  : return avx::dot( n, x, y );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sum of all elements of a dense vector for the current instruction set.
+// \ingroup math
+//
+// \param n The size of the vector.
+// \param x Pointer to the first element of the vector.
+// \return The sum of all elements.
+*/
+template< typename T >  // Type of the elements
+inline T sum( size_t n, const T* x )
+{
+   switch( getInstructionSet() ) {
+      case avx512InstructionSet: return avx512::sum( n, x );
+      case avx2InstructionSet  : return avx2::sum( n, x );
+      default                  : return avx::sum( n, x );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scaled addition of two dense vectors for the current instruction set
+//        (\f$ \vec{y}+=\alpha*\vec{x} \f$).
+// \ingroup math
+//
+// \param n The size of the two vectors.
+// \param alpha The scaling factor for \f$ \vec{x} \f$.
+// \param x Pointer to the first element of the right-hand side vector.
+// \param y Pointer to the first element of the target vector.
+// \return void
+*/
+template< typename T >  // Type of the elements
+inline void axpy( size_t n, T alpha, const T* x, T* y )
+{
+   switch( getInstructionSet() ) {
+      case avx512InstructionSet: avx512::axpy( n, alpha, x, y ); break;
+      case avx2InstructionSet  : avx2::axpy( n, alpha, x, y ); break;
+      default                  : avx::axpy( n, alpha, x, y ); break;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Row-major dense matrix/dense vector multiplication for the current instruction set
+//        (\f$ \vec{y}=\alpha*A*\vec{x}+\beta*\vec{y} \f$).
+// \ingroup math
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \param A Pointer to the first element of the row-major matrix.
+// \param lda The spacing between two rows of the matrix.
+// \param x Pointer to the first element of the right-hand side vector.
+// \param beta The scaling factor for \f$ \vec{y} \f$.
+// \param y Pointer to the first element of the target vector.
+// \return void
+*/
+template< typename T >  // Type of the elements
+inline void gemv( size_t m, size_t n, T alpha, const T* A, size_t lda,
+                  const T* x, T beta, T* y )
+{
+   switch( getInstructionSet() ) {
+      case avx512InstructionSet: avx512::gemv( m, n, alpha, A, lda, x, beta, y ); break;
+      case avx2InstructionSet  : avx2::gemv( m, n, alpha, A, lda, x, beta, y ); break;
+      default                  : avx::gemv( m, n, alpha, A, lda, x, beta, y ); break;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Transpose row-major dense matrix/dense vector multiplication for the current
+//        instruction set (\f$ \vec{y}=\alpha*A^T*\vec{x}+\beta*\vec{y} \f$).
+// \ingroup math
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param alpha The scaling factor for \f$ A^T*\vec{x} \f$.
+// \param A Pointer to the first element of the row-major matrix.
+// \param lda The spacing between two rows of the matrix.
+// \param x Pointer to the first element of the right-hand side vector.
+// \param beta The scaling factor for \f$ \vec{y} \f$.
+// \param y Pointer to the first element of the target vector.
+// \return void
+*/
+template< typename T >  // Type of the elements
+inline void gemvt( size_t m, size_t n, T alpha, const T* A, size_t lda,
+                   const T* x, T beta, T* y )
+{
+   switch( getInstructionSet() ) {
+      case avx512InstructionSet: avx512::gemvt( m, n, alpha, A, lda, x, beta, y ); break;
+      case avx2InstructionSet  : avx2::gemvt( m, n, alpha, A, lda, x, beta, y ); break;
+      default                  : avx::gemvt( m, n, alpha, A, lda, x, beta, y ); break;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Row-major dense matrix/dense matrix multiplication for the current instruction set
+//        (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup math
+//
+// \param m The number of rows of the left-hand side matrix and the target matrix.
+// \param n The number of columns of the right-hand side matrix and the target matrix.
+// \param k The number of columns of the left-hand side matrix.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param A Pointer to the first element of the row-major left-hand side matrix.
+// \param lda The spacing between two rows of the left-hand side matrix.
+// \param B Pointer to the first element of the row-major right-hand side matrix.
+// \param ldb The spacing between two rows of the right-hand side matrix.
+// \param beta The scaling factor for \f$ C \f$.
+// \param C Pointer to the first element of the row-major target matrix.
+// \param ldc The spacing between two rows of the target matrix.
+// \return void
+*/
+template< typename T >  // Type of the elements
+inline void gemm( size_t m, size_t n, size_t k, T alpha, const T* A, size_t lda,
+                  const T* B, size_t ldb, T beta, T* C, size_t ldc )
+{
+   switch( getInstructionSet() ) {
+      case avx512InstructionSet:
+         avx512::gemm( m, n, k, alpha, A, lda, B, ldb, beta, C, ldc );
+         break;
+      case avx2InstructionSet:
+         avx2::gemm( m, n, k, alpha, A, lda, B, ldb, beta, C, ldc );
+         break;
+      default:
+         avx::gemm( m, n, k, alpha, A, lda, B, ldb, beta, C, ldc );
+         break;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace dispatch
+
+#endif
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,289 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dispatch/Level1.h
+//  \brief Header file for the dispatched level 1 functions
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DISPATCH_LEVEL1_H_
+#define _BLAZE_MATH_DISPATCH_LEVEL1_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/dispatch/InstructionSet.h>
+#include <blaze/math/dispatch/Kernels.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/system/Dispatch.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  DISPATCHED LEVEL 1 FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Dispatched level 1 functions */
+//@{
+template< typename VT1, bool TF1, typename VT2, bool TF2, typename T >
+inline typename DisableIf< UseDispatchedKernel<VT1,VT2>, bool >::Type
+   dispatchDot( const DenseVector<VT1,TF1>& x, const DenseVector<VT2,TF2>& y, T& result );
+
+template< typename VT, bool TF, typename T >
+inline typename DisableIf< UseDispatchedKernel<VT>, bool >::Type
+   dispatchSum( const DenseVector<VT,TF>& x, size_t begin, size_t end, T& result );
+
+template< typename VT1, bool TF, typename VT2, typename ST >
+inline typename DisableIfTrue< HasMutableDataAccess<VT1>::value &&
+                               UseDispatchedKernel<VT1,VT2>::value, bool >::Type
+   dispatchAxpy( DenseVector<VT1,TF>& y, const DenseVector<VT2,TF>& x, ST alpha );
+
+#if BLAZE_DISPATCH_MODE
+
+template< typename VT1, bool TF1, typename VT2, bool TF2, typename T >
+inline typename EnableIf< UseDispatchedKernel<VT1,VT2>, bool >::Type
+   dispatchDot( const DenseVector<VT1,TF1>& x, const DenseVector<VT2,TF2>& y, T& result );
+
+template< typename VT, bool TF, typename T >
+inline typename EnableIf< UseDispatchedKernel<VT>, bool >::Type
+   dispatchSum( const DenseVector<VT,TF>& x, size_t begin, size_t end, T& result );
+
+template< typename VT1, bool TF, typename VT2, typename ST >
+inline typename EnableIfTrue< HasMutableDataAccess<VT1>::value &&
+                              UseDispatchedKernel<VT1,VT2>::value, bool >::Type
+   dispatchAxpy( DenseVector<VT1,TF>& y, const DenseVector<VT2,TF>& x, ST alpha );
+
+#endif
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default inner product of two dense vectors (\f$ s=\vec{x}^T*\vec{y} \f$).
+// \ingroup math
+//
+// \param x The left-hand side dense vector operand.
+// \param y The right-hand side dense vector operand.
+// \param result The inner product of the two vectors.
+// \return \a false since the operation cannot be dispatched.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , bool TF2      // Transpose flag of the right-hand side dense vector
+        , typename T >  // Type of the result
+inline typename DisableIf< UseDispatchedKernel<VT1,VT2>, bool >::Type
+   dispatchDot( const DenseVector<VT1,TF1>& x, const DenseVector<VT2,TF2>& y, T& result )
+{
+   UNUSED_PARAMETER( x, y, result );
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+#if BLAZE_DISPATCH_MODE
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Dispatched inner product of two dense vectors (\f$ s=\vec{x}^T*\vec{y} \f$).
+// \ingroup math
+//
+// \param x The left-hand side dense vector operand.
+// \param y The right-hand side dense vector operand.
+// \param result The inner product of the two vectors.
+// \return \a true in case the inner product has been computed, \a false if not.
+//
+// This function computes the inner product of the two given dense vectors based on the kernels
+// for the current instruction set (see getInstructionSet()). In case the runtime dispatch is
+// not active, the function returns \a false and leaves the result unchanged.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , bool TF2      // Transpose flag of the right-hand side dense vector
+        , typename T >  // Type of the result
+inline typename EnableIf< UseDispatchedKernel<VT1,VT2>, bool >::Type
+   dispatchDot( const DenseVector<VT1,TF1>& x, const DenseVector<VT2,TF2>& y, T& result )
+{
+   BLAZE_INTERNAL_ASSERT( (~x).size() == (~y).size(), "Invalid vector sizes" );
+
+   if( !isDispatchActive() )
+      return false;
+
+   result = dispatch::dot( (~x).size(), (~x).data(), (~y).data() );
+
+   return true;
+}
+/*! \endcond */
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default sum of a range of elements of a dense vector.
+// \ingroup math
+//
+// \param x The dense vector.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
+// \param result The sum of the elements of the range.
+// \return \a false since the operation cannot be dispatched.
+*/
+template< typename VT   // Type of the dense vector
+        , bool TF       // Transpose flag
+        , typename T >  // Type of the result
+inline typename DisableIf< UseDispatchedKernel<VT>, bool >::Type
+   dispatchSum( const DenseVector<VT,TF>& x, size_t begin, size_t end, T& result )
+{
+   UNUSED_PARAMETER( x, begin, end, result );
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+#if BLAZE_DISPATCH_MODE
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Dispatched sum of a range of elements of a dense vector.
+// \ingroup math
+//
+// \param x The dense vector.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
+// \param result The sum of the elements of the range.
+// \return \a true in case the sum has been computed, \a false if not.
+//
+// This function computes the sum of the range [\a begin, \a end) of the given dense vector
+// based on the kernels for the current instruction set (see getInstructionSet()). In case the
+// runtime dispatch is not active, the function returns \a false and leaves the result unchanged.
+*/
+template< typename VT   // Type of the dense vector
+        , bool TF       // Transpose flag
+        , typename T >  // Type of the result
+inline typename EnableIf< UseDispatchedKernel<VT>, bool >::Type
+   dispatchSum( const DenseVector<VT,TF>& x, size_t begin, size_t end, T& result )
+{
+   BLAZE_INTERNAL_ASSERT( begin <= end && end <= (~x).size(), "Invalid range detected" );
+
+   if( !isDispatchActive() )
+      return false;
+
+   result = dispatch::sum( end - begin, (~x).data() + begin );
+
+   return true;
+}
+/*! \endcond */
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default scaled addition of two dense vectors (\f$ \vec{y}+=\alpha*\vec{x} \f$).
+// \ingroup math
+//
+// \param y The target left-hand side dense vector.
+// \param x The right-hand side dense vector operand.
+// \param alpha The scaling factor for \f$ \vec{x} \f$.
+// \return \a false since the operation cannot be dispatched.
+*/
+template< typename VT1   // Type of the left-hand side target vector
+        , bool TF        // Transpose flag
+        , typename VT2   // Type of the right-hand side vector operand
+        , typename ST >  // Type of the scaling factor
+inline typename DisableIfTrue< HasMutableDataAccess<VT1>::value &&
+                               UseDispatchedKernel<VT1,VT2>::value, bool >::Type
+   dispatchAxpy( DenseVector<VT1,TF>& y, const DenseVector<VT2,TF>& x, ST alpha )
+{
+   UNUSED_PARAMETER( y, x, alpha );
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+#if BLAZE_DISPATCH_MODE
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Dispatched scaled addition of two dense vectors (\f$ \vec{y}+=\alpha*\vec{x} \f$).
+// \ingroup math
+//
+// \param y The target left-hand side dense vector.
+// \param x The right-hand side dense vector operand.
+// \param alpha The scaling factor for \f$ \vec{x} \f$.
+// \return \a true in case the addition has been performed, \a false if not.
+//
+// This function performs the scaled addition based on the kernels for the current instruction
+// set (see getInstructionSet()). In case the runtime dispatch is not active, the function
+// returns \a false and leaves the target vector unchanged.
+*/
+template< typename VT1   // Type of the left-hand side target vector
+        , bool TF        // Transpose flag
+        , typename VT2   // Type of the right-hand side vector operand
+        , typename ST >  // Type of the scaling factor
+inline typename EnableIfTrue< HasMutableDataAccess<VT1>::value &&
+                              UseDispatchedKernel<VT1,VT2>::value, bool >::Type
+   dispatchAxpy( DenseVector<VT1,TF>& y, const DenseVector<VT2,TF>& x, ST alpha )
+{
+   typedef typename VT1::ElementType  ET;
+
+   BLAZE_INTERNAL_ASSERT( (~y).size() == (~x).size(), "Invalid vector sizes" );
+
+   if( !isDispatchActive() )
+      return false;
+
+   dispatch::axpy( (~y).size(), ET( alpha ), (~x).data(), (~y).data() );
+
+   return true;
+}
+/*! \endcond */
+#endif
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
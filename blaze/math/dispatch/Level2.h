@@ -0,0 +1,277 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dispatch/Level2.h
+//  \brief Header file for the dispatched level 2 functions
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DISPATCH_LEVEL2_H_
+#define _BLAZE_MATH_DISPATCH_LEVEL2_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/dispatch/InstructionSet.h>
+#include <blaze/math/dispatch/Kernels.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/system/Dispatch.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  DISPATCHED LEVEL 2 FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Dispatched level 2 functions */
+//@{
+template< typename VT1, typename MT1, bool SO, typename VT2, typename ST1, typename ST2 >
+inline typename DisableIfTrue< HasMutableDataAccess<VT1>::value &&
+                               UseDispatchedKernel<VT1,MT1,VT2>::value, bool >::Type
+   dispatchGemv( DenseVector<VT1,false>& y, const DenseMatrix<MT1,SO>& A,
+                 const DenseVector<VT2,false>& x, ST1 alpha, ST2 beta );
+
+template< typename VT1, typename VT2, typename MT1, bool SO, typename ST1, typename ST2 >
+inline typename DisableIfTrue< HasMutableDataAccess<VT1>::value &&
+                               UseDispatchedKernel<VT1,VT2,MT1>::value, bool >::Type
+   dispatchGemv( DenseVector<VT1,true>& y, const DenseVector<VT2,true>& x,
+                 const DenseMatrix<MT1,SO>& A, ST1 alpha, ST2 beta );
+
+#if BLAZE_DISPATCH_MODE
+
+template< typename VT1, typename MT1, bool SO, typename VT2, typename ST1, typename ST2 >
+inline typename EnableIfTrue< HasMutableDataAccess<VT1>::value &&
+                              UseDispatchedKernel<VT1,MT1,VT2>::value, bool >::Type
+   dispatchGemv( DenseVector<VT1,false>& y, const DenseMatrix<MT1,SO>& A,
+                 const DenseVector<VT2,false>& x, ST1 alpha, ST2 beta );
+
+template< typename VT1, typename VT2, typename MT1, bool SO, typename ST1, typename ST2 >
+inline typename EnableIfTrue< HasMutableDataAccess<VT1>::value &&
+                              UseDispatchedKernel<VT1,VT2,MT1>::value, bool >::Type
+   dispatchGemv( DenseVector<VT1,true>& y, const DenseVector<VT2,true>& x,
+                 const DenseMatrix<MT1,SO>& A, ST1 alpha, ST2 beta );
+
+#endif
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default dense matrix/dense vector multiplication
+//        (\f$ \vec{y}=\alpha*A*\vec{x}+\beta*\vec{y} \f$).
+// \ingroup math
+//
+// \param y The target left-hand side dense vector.
+// \param A The left-hand side dense matrix operand.
+// \param x The right-hand side dense vector operand.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \param beta The scaling factor for \f$ \vec{y} \f$.
+// \return \a false since the operation cannot be dispatched.
+*/
+template< typename VT1    // Type of the left-hand side target vector
+        , typename MT1    // Type of the left-hand side matrix operand
+        , bool SO         // Storage order of the left-hand side matrix operand
+        , typename VT2    // Type of the right-hand side vector operand
+        , typename ST1    // Type of the scaling factor for the product
+        , typename ST2 >  // Type of the scaling factor for the target vector
+inline typename DisableIfTrue< HasMutableDataAccess<VT1>::value &&
+                               UseDispatchedKernel<VT1,MT1,VT2>::value, bool >::Type
+   dispatchGemv( DenseVector<VT1,false>& y, const DenseMatrix<MT1,SO>& A,
+                 const DenseVector<VT2,false>& x, ST1 alpha, ST2 beta )
+{
+   UNUSED_PARAMETER( y, A, x, alpha, beta );
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+#if BLAZE_DISPATCH_MODE
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Dispatched dense matrix/dense vector multiplication
+//        (\f$ \vec{y}=\alpha*A*\vec{x}+\beta*\vec{y} \f$).
+// \ingroup math
+//
+// \param y The target left-hand side dense vector.
+// \param A The left-hand side dense matrix operand.
+// \param x The right-hand side dense vector operand.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \param beta The scaling factor for \f$ \vec{y} \f$.
+// \return \a true in case the multiplication has been performed, \a false if not.
+//
+// This function performs the dense matrix/dense vector multiplication based on the kernels for
+// the current instruction set (see getInstructionSet()). In case the runtime dispatch is not
+// active, the function returns \a false and leaves the target vector unchanged. In case \a beta
+// is 0, the initial values of the target vector are not accessed.
+*/
+template< typename VT1    // Type of the left-hand side target vector
+        , typename MT1    // Type of the left-hand side matrix operand
+        , bool SO         // Storage order of the left-hand side matrix operand
+        , typename VT2    // Type of the right-hand side vector operand
+        , typename ST1    // Type of the scaling factor for the product
+        , typename ST2 >  // Type of the scaling factor for the target vector
+inline typename EnableIfTrue< HasMutableDataAccess<VT1>::value &&
+                              UseDispatchedKernel<VT1,MT1,VT2>::value, bool >::Type
+   dispatchGemv( DenseVector<VT1,false>& y, const DenseMatrix<MT1,SO>& A,
+                 const DenseVector<VT2,false>& x, ST1 alpha, ST2 beta )
+{
+   typedef typename VT1::ElementType  ET;
+
+   BLAZE_INTERNAL_ASSERT( (~y).size() == (~A).rows()   , "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( (~x).size() == (~A).columns(), "Invalid vector size" );
+
+   if( !isDispatchActive() )
+      return false;
+
+   const size_t M( (~A).rows()    );
+   const size_t N( (~A).columns() );
+
+   if( SO ) {
+      dispatch::gemvt( N, M, ET( alpha ), (~A).data(), (~A).spacing(),
+                       (~x).data(), ET( beta ), (~y).data() );
+   }
+   else {
+      dispatch::gemv( M, N, ET( alpha ), (~A).data(), (~A).spacing(),
+                      (~x).data(), ET( beta ), (~y).data() );
+   }
+
+   return true;
+}
+/*! \endcond */
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default transpose dense vector/dense matrix multiplication
+//        (\f$ \vec{y}^T=\alpha*\vec{x}^T*A+\beta*\vec{y}^T \f$).
+// \ingroup math
+//
+// \param y The target left-hand side dense vector.
+// \param x The left-hand side dense vector operand.
+// \param A The right-hand side dense matrix operand.
+// \param alpha The scaling factor for \f$ \vec{x}^T*A \f$.
+// \param beta The scaling factor for \f$ \vec{y}^T \f$.
+// \return \a false since the operation cannot be dispatched.
+*/
+template< typename VT1    // Type of the left-hand side target vector
+        , typename VT2    // Type of the left-hand side vector operand
+        , typename MT1    // Type of the right-hand side matrix operand
+        , bool SO         // Storage order of the right-hand side matrix operand
+        , typename ST1    // Type of the scaling factor for the product
+        , typename ST2 >  // Type of the scaling factor for the target vector
+inline typename DisableIfTrue< HasMutableDataAccess<VT1>::value &&
+                               UseDispatchedKernel<VT1,VT2,MT1>::value, bool >::Type
+   dispatchGemv( DenseVector<VT1,true>& y, const DenseVector<VT2,true>& x,
+                 const DenseMatrix<MT1,SO>& A, ST1 alpha, ST2 beta )
+{
+   UNUSED_PARAMETER( y, x, A, alpha, beta );
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+#if BLAZE_DISPATCH_MODE
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Dispatched transpose dense vector/dense matrix multiplication
+//        (\f$ \vec{y}^T=\alpha*\vec{x}^T*A+\beta*\vec{y}^T \f$).
+// \ingroup math
+//
+// \param y The target left-hand side dense vector.
+// \param x The left-hand side dense vector operand.
+// \param A The right-hand side dense matrix operand.
+// \param alpha The scaling factor for \f$ \vec{x}^T*A \f$.
+// \param beta The scaling factor for \f$ \vec{y}^T \f$.
+// \return \a true in case the multiplication has been performed, \a false if not.
+//
+// This function performs the transpose dense vector/dense matrix multiplication based on the
+// kernels for the current instruction set (see getInstructionSet()). In case the runtime
+// dispatch is not active, the function returns \a false and leaves the target vector unchanged.
+// In case \a beta is 0, the initial values of the target vector are not accessed.
+*/
+template< typename VT1    // Type of the left-hand side target vector
+        , typename VT2    // Type of the left-hand side vector operand
+        , typename MT1    // Type of the right-hand side matrix operand
+        , bool SO         // Storage order of the right-hand side matrix operand
+        , typename ST1    // Type of the scaling factor for the product
+        , typename ST2 >  // Type of the scaling factor for the target vector
+inline typename EnableIfTrue< HasMutableDataAccess<VT1>::value &&
+                              UseDispatchedKernel<VT1,VT2,MT1>::value, bool >::Type
+   dispatchGemv( DenseVector<VT1,true>& y, const DenseVector<VT2,true>& x,
+                 const DenseMatrix<MT1,SO>& A, ST1 alpha, ST2 beta )
+{
+   typedef typename VT1::ElementType  ET;
+
+   BLAZE_INTERNAL_ASSERT( (~y).size() == (~A).columns(), "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( (~x).size() == (~A).rows()   , "Invalid vector size" );
+
+   if( !isDispatchActive() )
+      return false;
+
+   const size_t M( (~A).rows()    );
+   const size_t N( (~A).columns() );
+
+   if( SO ) {
+      dispatch::gemv( N, M, ET( alpha ), (~A).data(), (~A).spacing(),
+                      (~x).data(), ET( beta ), (~y).data() );
+   }
+   else {
+      dispatch::gemvt( M, N, ET( alpha ), (~A).data(), (~A).spacing(),
+                       (~x).data(), ET( beta ), (~y).data() );
+   }
+
+   return true;
+}
+/*! \endcond */
+#endif
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,187 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dispatch/Level3.h
+//  \brief Header file for the dispatched level 3 functions
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DISPATCH_LEVEL3_H_
+#define _BLAZE_MATH_DISPATCH_LEVEL3_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/dispatch/InstructionSet.h>
+#include <blaze/math/dispatch/Kernels.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/system/Dispatch.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  DISPATCHED LEVEL 3 FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Dispatched level 3 functions */
+//@{
+template< typename MT1, bool SO1, typename MT2, bool SO2, typename MT3, bool SO3
+        , typename ST1, typename ST2 >
+inline typename DisableIfTrue< SO1 == SO2 && SO1 == SO3 &&
+                               HasMutableDataAccess<MT1>::value &&
+                               UseDispatchedKernel<MT1,MT2,MT3>::value, bool >::Type
+   dispatchGemm( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A,
+                 const DenseMatrix<MT3,SO3>& B, ST1 alpha, ST2 beta );
+
+#if BLAZE_DISPATCH_MODE
+
+template< typename MT1, bool SO1, typename MT2, bool SO2, typename MT3, bool SO3
+        , typename ST1, typename ST2 >
+inline typename EnableIfTrue< SO1 == SO2 && SO1 == SO3 &&
+                              HasMutableDataAccess<MT1>::value &&
+                              UseDispatchedKernel<MT1,MT2,MT3>::value, bool >::Type
+   dispatchGemm( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A,
+                 const DenseMatrix<MT3,SO3>& B, ST1 alpha, ST2 beta );
+
+#endif
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default dense matrix/dense matrix multiplication (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup math
+//
+// \param C The target left-hand side dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return \a false since the operation cannot be dispatched.
+*/
+template< typename MT1    // Type of the left-hand side target matrix
+        , bool SO1        // Storage order of the left-hand side target matrix
+        , typename MT2    // Type of the left-hand side matrix operand
+        , bool SO2        // Storage order of the left-hand side matrix operand
+        , typename MT3    // Type of the right-hand side matrix operand
+        , bool SO3        // Storage order of the right-hand side matrix operand
+        , typename ST1    // Type of the scaling factor for the product
+        , typename ST2 >  // Type of the scaling factor for the target matrix
+inline typename DisableIfTrue< SO1 == SO2 && SO1 == SO3 &&
+                               HasMutableDataAccess<MT1>::value &&
+                               UseDispatchedKernel<MT1,MT2,MT3>::value, bool >::Type
+   dispatchGemm( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A,
+                 const DenseMatrix<MT3,SO3>& B, ST1 alpha, ST2 beta )
+{
+   UNUSED_PARAMETER( C, A, B, alpha, beta );
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+#if BLAZE_DISPATCH_MODE
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Dispatched dense matrix/dense matrix multiplication (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup math
+//
+// \param C The target left-hand side dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return \a true in case the multiplication has been performed, \a false if not.
+//
+// This function performs the dense matrix/dense matrix multiplication based on the kernels for
+// the current instruction set (see getInstructionSet()). All three matrices are required to have
+// the same storage order. Column-major matrices are handled as the according row-major product
+// \f$ C^T=\alpha*B^T*A^T+\beta*C^T \f$. In case the runtime dispatch is not active, the function
+// returns \a false and leaves the target matrix unchanged. In case \a beta is 0, the initial
+// values of the target matrix are not accessed.
+*/
+template< typename MT1    // Type of the left-hand side target matrix
+        , bool SO1        // Storage order of the left-hand side target matrix
+        , typename MT2    // Type of the left-hand side matrix operand
+        , bool SO2        // Storage order of the left-hand side matrix operand
+        , typename MT3    // Type of the right-hand side matrix operand
+        , bool SO3        // Storage order of the right-hand side matrix operand
+        , typename ST1    // Type of the scaling factor for the product
+        , typename ST2 >  // Type of the scaling factor for the target matrix
+inline typename EnableIfTrue< SO1 == SO2 && SO1 == SO3 &&
+                              HasMutableDataAccess<MT1>::value &&
+                              UseDispatchedKernel<MT1,MT2,MT3>::value, bool >::Type
+   dispatchGemm( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A,
+                 const DenseMatrix<MT3,SO3>& B, ST1 alpha, ST2 beta )
+{
+   typedef typename MT1::ElementType  ET;
+
+   BLAZE_INTERNAL_ASSERT( (~C).rows()    == (~A).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~C).columns() == (~B).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( (~A).columns() == (~B).rows()   , "Invalid matrix sizes"      );
+
+   if( !isDispatchActive() )
+      return false;
+
+   const size_t M( (~A).rows()    );
+   const size_t N( (~B).columns() );
+   const size_t K( (~A).columns() );
+
+   if( SO1 ) {
+      dispatch::gemm( N, M, K, ET( alpha ), (~B).data(), (~B).spacing(),
+                      (~A).data(), (~A).spacing(), ET( beta ), (~C).data(), (~C).spacing() );
+   }
+   else {
+      dispatch::gemm( M, N, K, ET( alpha ), (~A).data(), (~A).spacing(),
+                      (~B).data(), (~B).spacing(), ET( beta ), (~C).data(), (~C).spacing() );
+   }
+
+   return true;
+}
+/*! \endcond */
+#endif
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
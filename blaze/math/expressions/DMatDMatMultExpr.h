@@ -46,6 +46,8 @@
 #include <blaze/math/constraints/MatMatMultExpr.h>
 #include <blaze/math/constraints/StorageOrder.h>
 #include <blaze/math/constraints/Symmetric.h>
+#include <blaze/math/dense/MMM.h>
+#include <blaze/math/dispatch/Level3.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/DenseVector.h>
@@ -475,8 +477,8 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    */
    inline bool canSMPAssign() const {
       return ( !BLAZE_BLAS_IS_PARALLEL ||
-               ( rows() * columns() < DMATDMATMULT_THRESHOLD ) ) &&
-             ( rows() > SMP_DMATDMATMULT_THRESHOLD );
+               ( rows() * columns() < getThreshold( dmatDMatMultThreshold ) ) ) &&
+             ( rows() > getThreshold( smpDMatDMatMultThreshold ) );
    }
    //**********************************************************************************************
 
@@ -549,7 +551,7 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    static inline void selectAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       if( ( IsDiagonal<MT5>::value ) ||
-          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < getThreshold( dmatDMatMultThreshold ) ) )
          selectSmallAssignKernel( C, A, B );
       else
          selectBlasAssignKernel( C, A, B );
@@ -1084,7 +1086,7 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    //
    // This function implements the vectorized default assignment of a dense matrix-dense matrix
    // multiplication expression to a row-major dense matrix. This kernel is optimized for large
-   // matrices.
+   // matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -1092,8 +1094,10 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallAssignKernel( ~C, A, B );
+      if( IsDiagonal<MT4>::value )
+         selectSmallAssignKernel( ~C, A, B );
+      else
+         mmm( ~C, A, B, ElementType(1), ElementType(0) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1109,8 +1113,9 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    // \param B The right-hand side multiplication operand.
    // \return void
    //
-   // This function relays to the default implementation of the assignment of a small dense
-   // matrix-dense matrix multiplication expression to a column-major dense matrix.
+   // This function implements the vectorized default assignment of a dense matrix-dense matrix
+   // multiplication expression to a column-major dense matrix. This kernel is optimized for large
+   // matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -1118,7 +1123,10 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
-      selectSmallAssignKernel( ~C, A, B );
+      if( IsDiagonal<MT4>::value )
+         selectSmallAssignKernel( ~C, A, B );
+      else
+         mmm( ~C, A, B, ElementType(1), ElementType(0) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1135,6 +1143,9 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    //
    // This function relays to the default implementation of the assignment of a large dense
    // matrix-dense matrix multiplication expression to a dense matrix.
+   //
+   // In case the runtime dispatch is active (see getInstructionSet()), the operation is
+   // relayed to the according dispatched kernel instead.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -1142,7 +1153,8 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    static inline typename EnableIf< UseDefaultKernel<MT3,MT4,MT5> >::Type
       selectBlasAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
-      selectLargeAssignKernel( C, A, B );
+      if( !dispatchGemm( C, A, B, 1, 0 ) )
+         selectLargeAssignKernel( C, A, B );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1436,7 +1448,7 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    static inline void selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       if( ( IsDiagonal<MT5>::value ) ||
-          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < getThreshold( dmatDMatMultThreshold ) ) )
          selectSmallAddAssignKernel( C, A, B );
       else
          selectBlasAddAssignKernel( C, A, B );
@@ -1972,7 +1984,7 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    //
    // This function implements the vectorized default addition assignment of a dense matrix-dense
    // matrix multiplication expression to a row-major dense matrix. This kernel is optimized for
-   // large matrices.
+   // large matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -1980,8 +1992,10 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallAddAssignKernel( ~C, A, B );
+      if( IsDiagonal<MT4>::value )
+         selectSmallAddAssignKernel( ~C, A, B );
+      else
+         mmm( ~C, A, B, ElementType(1), ElementType(1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1997,8 +2011,9 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    // \param B The right-hand side multiplication operand.
    // \return void
    //
-   // This function relays to the default implementation of the addition assignment of a small
-   // dense matrix-dense matrix multiplication expression to a column-major dense matrix.
+   // This function implements the vectorized default addition assignment of a dense matrix-dense
+   // matrix multiplication expression to a column-major dense matrix. This kernel is optimized for
+   // large matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -2006,7 +2021,10 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
-      selectSmallAddAssignKernel( ~C, A, B );
+      if( IsDiagonal<MT4>::value )
+         selectSmallAddAssignKernel( ~C, A, B );
+      else
+         mmm( ~C, A, B, ElementType(1), ElementType(1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2024,6 +2042,9 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    //
    // This function relays to the default implementation of the addition assignment of a large
    // dense matrix-dense matrix multiplication expression to a dense matrix.
+   //
+   // In case the runtime dispatch is active (see getInstructionSet()), the operation is
+   // relayed to the according dispatched kernel instead.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -2031,7 +2052,8 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    static inline typename EnableIf< UseDefaultKernel<MT3,MT4,MT5> >::Type
       selectBlasAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
-      selectLargeAddAssignKernel( C, A, B );
+      if( !dispatchGemm( C, A, B, 1, 1 ) )
+         selectLargeAddAssignKernel( C, A, B );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2299,7 +2321,7 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    static inline void selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       if( ( IsDiagonal<MT5>::value ) ||
-          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < getThreshold( dmatDMatMultThreshold ) ) )
          selectSmallSubAssignKernel( C, A, B );
       else
          selectBlasSubAssignKernel( C, A, B );
@@ -2833,9 +2855,9 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    // \param B The right-hand side multiplication operand.
    // \return void
    //
-   // This function implements the vectorized default subtraction assignment of a dense matrix-
-   // dense matrix multiplication expression to a row-major dense matrix. This kernel is optimized
-   // for large matrices.
+   // This function implements the vectorized default subtraction assignment of a dense matrix-dense
+   // matrix multiplication expression to a row-major dense matrix. This kernel is optimized for
+   // large matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -2843,8 +2865,10 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallSubAssignKernel( ~C, A, B );
+      if( IsDiagonal<MT4>::value )
+         selectSmallSubAssignKernel( ~C, A, B );
+      else
+         mmm( ~C, A, B, ElementType(-1), ElementType(1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2860,8 +2884,9 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    // \param B The right-hand side multiplication operand.
    // \return void
    //
-   // This function relays to the default implementation of the subtraction assignment of a small
-   // dense matrix-dense matrix multiplication expression to a column-major dense matrix.
+   // This function implements the vectorized default subtraction assignment of a dense matrix-dense
+   // matrix multiplication expression to a column-major dense matrix. This kernel is optimized for
+   // large matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -2869,7 +2894,10 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
-      selectSmallSubAssignKernel( ~C, A, B );
+      if( IsDiagonal<MT4>::value )
+         selectSmallSubAssignKernel( ~C, A, B );
+      else
+         mmm( ~C, A, B, ElementType(-1), ElementType(1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2887,6 +2915,9 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    //
    // This function relays to the default implementation of the subtraction assignment of a large
    // dense matrix-dense matrix multiplication expression to a dense matrix.
+   //
+   // In case the runtime dispatch is active (see getInstructionSet()), the operation is
+   // relayed to the according dispatched kernel instead.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -2894,7 +2925,8 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    static inline typename EnableIf< UseDefaultKernel<MT3,MT4,MT5> >::Type
       selectBlasSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
-      selectLargeSubAssignKernel( C, A, B );
+      if( !dispatchGemm( C, A, B, -1, 1 ) )
+         selectLargeSubAssignKernel( C, A, B );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -3754,8 +3786,8 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    inline bool canSMPAssign() const {
       typename MMM::LeftOperand A( matrix_.leftOperand() );
       return ( !BLAZE_BLAS_IS_PARALLEL ||
-               ( rows() * columns() < DMATDMATMULT_THRESHOLD ) ) &&
-             ( A.rows() > SMP_DMATDMATMULT_THRESHOLD );
+               ( rows() * columns() < getThreshold( dmatDMatMultThreshold ) ) ) &&
+             ( A.rows() > getThreshold( smpDMatDMatMultThreshold ) );
    }
    //**********************************************************************************************
 
@@ -3830,7 +3862,7 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    static inline void selectAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       if( ( IsDiagonal<MT5>::value ) ||
-          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < getThreshold( dmatDMatMultThreshold ) ) )
          selectSmallAssignKernel( C, A, B, scalar );
       else
          selectBlasAssignKernel( C, A, B, scalar );
@@ -4376,7 +4408,7 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    //
    // This function implements the vectorized default assignment of a scaled dense matrix-dense
    // matrix multiplication expression to a row-major dense matrix. This kernel is optimized for
-   // large matrices.
+   // large matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -4385,8 +4417,10 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallAssignKernel( ~C, A, B, scalar );
+      if( IsDiagonal<MT4>::value )
+         selectSmallAssignKernel( ~C, A, B, scalar );
+      else
+         mmm( ~C, A, B, scalar, ST2(0) );
    }
    //**********************************************************************************************
 
@@ -4401,8 +4435,9 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    // \param scalar The scaling factor.
    // \return void
    //
-   // This function relays to the default implementation of the assignment of a small scaled
-   // dense matrix-dense matrix multiplication expression to a column-major dense matrix.
+   // This function implements the vectorized default assignment of a scaled dense matrix-dense
+   // matrix multiplication expression to a column-major dense matrix. This kernel is optimized for
+   // large matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -4411,7 +4446,10 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      selectSmallAssignKernel( ~C, A, B, scalar );
+      if( IsDiagonal<MT4>::value )
+         selectSmallAssignKernel( ~C, A, B, scalar );
+      else
+         mmm( ~C, A, B, scalar, ST2(0) );
    }
    //**********************************************************************************************
 
@@ -4428,6 +4466,9 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    //
    // This function relays to the default implementation of the assignment of a large scaled
    // dense matrix-dense matrix multiplication expression to a dense matrix.
+   //
+   // In case the runtime dispatch is active (see getInstructionSet()), the operation is
+   // relayed to the according dispatched kernel instead.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -4436,7 +4477,8 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectBlasAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      selectLargeAssignKernel( C, A, B, scalar );
+      if( !dispatchGemm( C, A, B, scalar, 0 ) )
+         selectLargeAssignKernel( C, A, B, scalar );
    }
    //**********************************************************************************************
 
@@ -4730,7 +4772,7 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    static inline void selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       if( ( IsDiagonal<MT5>::value ) ||
-          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < getThreshold( dmatDMatMultThreshold ) ) )
          selectSmallAddAssignKernel( C, A, B, scalar );
       else
          selectBlasAddAssignKernel( C, A, B, scalar );
@@ -5216,9 +5258,9 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    // \param scalar The scaling factor.
    // \return void
    //
-   // This function implements the vectorized default addition assignment of a scaled dense
-   // matrix-dense matrix multiplication expression to a row-major dense matrix. This kernel
-   // is optimized for large matrices.
+   // This function implements the vectorized default addition assignment of a scaled dense matrix-
+   // dense matrix multiplication expression to a row-major dense matrix. This kernel is optimized
+   // for large matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -5227,8 +5269,10 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallAddAssignKernel( ~C, A, B, scalar );
+      if( IsDiagonal<MT4>::value )
+         selectSmallAddAssignKernel( ~C, A, B, scalar );
+      else
+         mmm( ~C, A, B, scalar, ST2(1) );
    }
    //**********************************************************************************************
 
@@ -5243,8 +5287,9 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    // \param scalar The scaling factor.
    // \return void
    //
-   // This function relays to the default implementation of the addition assignment of a small
-   // scaled dense matrix-dense matrix multiplication expression to a column-major dense matrix.
+   // This function implements the vectorized default addition assignment of a scaled dense matrix-
+   // dense matrix multiplication expression to a column-major dense matrix. This kernel is
+   // optimized for large matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -5253,7 +5298,10 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      selectSmallAddAssignKernel( ~C, A, B, scalar );
+      if( IsDiagonal<MT4>::value )
+         selectSmallAddAssignKernel( ~C, A, B, scalar );
+      else
+         mmm( ~C, A, B, scalar, ST2(1) );
    }
    //**********************************************************************************************
 
@@ -5270,6 +5318,9 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    //
    // This function relays to the default implementation of the addition assignment of a large
    // scaled dense matrix-dense matrix multiplication expression to a dense matrix.
+   //
+   // In case the runtime dispatch is active (see getInstructionSet()), the operation is
+   // relayed to the according dispatched kernel instead.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -5278,7 +5329,8 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectBlasAddAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      selectLargeAddAssignKernel( C, A, B, scalar );
+      if( !dispatchGemm( C, A, B, scalar, 1 ) )
+         selectLargeAddAssignKernel( C, A, B, scalar );
    }
    //**********************************************************************************************
 
@@ -5548,7 +5600,7 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    static inline void selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       if( ( IsDiagonal<MT5>::value ) ||
-          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < getThreshold( dmatDMatMultThreshold ) ) )
          selectSmallSubAssignKernel( C, A, B, scalar );
       else
          selectBlasSubAssignKernel( C, A, B, scalar );
@@ -6036,7 +6088,7 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    //
    // This function implements the vectorized default subtraction assignment of a scaled dense
    // matrix-dense matrix multiplication expression to a row-major dense matrix. This kernel is
-   // optimized for large matrices.
+   // optimized for large matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -6045,8 +6097,10 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallSubAssignKernel( ~C, A, B, scalar );
+      if( IsDiagonal<MT4>::value )
+         selectSmallSubAssignKernel( ~C, A, B, scalar );
+      else
+         mmm( ~C, A, B, ST2(-scalar), ST2(1) );
    }
    //**********************************************************************************************
 
@@ -6061,8 +6115,9 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    // \param scalar The scaling factor.
    // \return void
    //
-   // This function relays to the default implementation of the subtraction assignment of a small
-   // scaled dense matrix-dense matrix multiplication expression to a column-major dense matrix.
+   // This function implements the vectorized default subtraction assignment of a scaled dense
+   // matrix-dense matrix multiplication expression to a column-major dense matrix. This kernel is
+   // optimized for large matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -6071,7 +6126,10 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      selectSmallSubAssignKernel( ~C, A, B, scalar );
+      if( IsDiagonal<MT4>::value )
+         selectSmallSubAssignKernel( ~C, A, B, scalar );
+      else
+         mmm( ~C, A, B, ST2(-scalar), ST2(1) );
    }
    //**********************************************************************************************
 
@@ -6088,6 +6146,9 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    //
    // This function relays to the default implementation of the subtraction assignment of a large
    // scaled dense matrix-dense matrix multiplication expression to a dense matrix.
+   //
+   // In case the runtime dispatch is active (see getInstructionSet()), the operation is
+   // relayed to the according dispatched kernel instead.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -6096,7 +6157,8 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectBlasSubAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      selectLargeSubAssignKernel( C, A, B, scalar );
+      if( !dispatchGemm( C, A, B, -scalar, 1 ) )
+         selectLargeSubAssignKernel( C, A, B, scalar );
    }
    //**********************************************************************************************
 
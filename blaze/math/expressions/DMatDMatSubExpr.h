@@ -591,7 +591,8 @@ class DMatDMatSubExpr : public DenseMatrix< DMatDMatSubExpr<MT1,MT2,SO>, SO >
    */
    inline bool canSMPAssign() const {
       return lhs_.canSMPAssign() || rhs_.canSMPAssign() ||
-             ( ( ( SO == rowMajor ) ? rows() : columns() ) > SMP_DMATDMATSUB_THRESHOLD );
+             ( ( ( SO == rowMajor ) ? rows() : columns() ) >
+               getThreshold( smpDMatDMatSubThreshold ) );
    }
    //**********************************************************************************************
 
@@ -48,6 +48,7 @@
 #include <blaze/math/constraints/StorageOrder.h>
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/constraints/TransposeFlag.h>
+#include <blaze/math/dispatch/Level2.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/Forward.h>
@@ -422,8 +423,8 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    inline bool canSMPAssign() const {
       return ( !BLAZE_BLAS_IS_PARALLEL ||
                ( IsComputation<MT>::value && !evaluateMatrix ) ||
-               ( mat_.rows() * mat_.columns() < DMATDVECMULT_THRESHOLD ) ) &&
-             ( size() > SMP_DMATDVECMULT_THRESHOLD );
+               ( mat_.rows() * mat_.columns() < getThreshold( dmatDVecMultThreshold ) ) ) &&
+             ( size() > getThreshold( smpDMatDVecMultThreshold ) );
    }
    //**********************************************************************************************
 
@@ -492,7 +493,7 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < getThreshold( dmatDVecMultThreshold ) ) )
          selectSmallAssignKernel( y, A, x );
       else
          selectBlasAssignKernel( y, A, x );
@@ -911,6 +912,9 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    //
    // This function relays to the default implementation of the assignment of a large dense
    // matrix-dense vector multiplication expression to a dense vector.
+   //
+   // In case the runtime dispatch is active (see getInstructionSet()), the operation is
+   // relayed to the according dispatched kernel instead.
    */
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
@@ -918,7 +922,8 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    static inline typename EnableIf< UseDefaultKernel<VT1,MT1,VT2> >::Type
       selectBlasAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
-      selectLargeAssignKernel( y, A, x );
+      if( !dispatchGemv( y, A, x, 1, 0 ) )
+         selectLargeAssignKernel( y, A, x );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1140,7 +1145,7 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < getThreshold( dmatDVecMultThreshold ) ) )
          selectSmallAddAssignKernel( y, A, x );
       else
          selectBlasAddAssignKernel( y, A, x );
@@ -1557,6 +1562,9 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    //
    // This function relays to the default implementation of the addition assignment of a large
    // dense matrix-dense vector multiplication expression to a dense vector.
+   //
+   // In case the runtime dispatch is active (see getInstructionSet()), the operation is
+   // relayed to the according dispatched kernel instead.
    */
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
@@ -1564,7 +1572,8 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    static inline typename EnableIf< UseDefaultKernel<VT1,MT1,VT2> >::Type
       selectBlasAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
-      selectLargeAddAssignKernel( y, A, x );
+      if( !dispatchGemv( y, A, x, 1, 1 ) )
+         selectLargeAddAssignKernel( y, A, x );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1764,7 +1773,7 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < getThreshold( dmatDVecMultThreshold ) ) )
          selectSmallSubAssignKernel( y, A, x );
       else
          selectBlasSubAssignKernel( y, A, x );
@@ -2181,6 +2190,9 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    //
    // This function relays to the default implementation of the subtraction assignment of a large
    // dense matrix-dense vector multiplication expression to a dense vector.
+   //
+   // In case the runtime dispatch is active (see getInstructionSet()), the operation is
+   // relayed to the according dispatched kernel instead.
    */
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
@@ -2188,7 +2200,8 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    static inline typename EnableIf< UseDefaultKernel<VT1,MT1,VT2> >::Type
       selectBlasSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
-      selectLargeSubAssignKernel( y, A, x );
+      if( !dispatchGemv( y, A, x, -1, 1 ) )
+         selectLargeSubAssignKernel( y, A, x );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2884,8 +2897,8 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
       typename MVM::LeftOperand A( vector_.leftOperand() );
       return ( !BLAZE_BLAS_IS_PARALLEL ||
                ( IsComputation<MT>::value && !evaluateMatrix ) ||
-               ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) ) &&
-             ( size() > SMP_DMATDVECMULT_THRESHOLD );
+               ( A.rows() * A.columns() < getThreshold( dmatDVecMultThreshold ) ) ) &&
+             ( size() > getThreshold( smpDMatDVecMultThreshold ) );
    }
    //**********************************************************************************************
 
@@ -2956,7 +2969,7 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < getThreshold( dmatDVecMultThreshold ) ) )
          selectSmallAssignKernel( y, A, x, scalar );
       else
          selectBlasAssignKernel( y, A, x, scalar );
@@ -3394,6 +3407,9 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    //
    // This function relays to the default implementation of the assignment of a large scaled
    // dense matrix-dense vector multiplication expression to a dense vector.
+   //
+   // In case the runtime dispatch is active (see getInstructionSet()), the operation is
+   // relayed to the according dispatched kernel instead.
    */
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
@@ -3402,7 +3418,8 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    static inline typename EnableIf< UseDefaultKernel<VT1,MT1,VT2,ST2> >::Type
       selectBlasAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
-      selectLargeAssignKernel( y, A, x, scalar );
+      if( !dispatchGemv( y, A, x, scalar, 0 ) )
+         selectLargeAssignKernel( y, A, x, scalar );
    }
    //**********************************************************************************************
 
@@ -3623,7 +3640,7 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < getThreshold( dmatDVecMultThreshold ) ) )
          selectSmallAddAssignKernel( y, A, x, scalar );
       else
          selectBlasAddAssignKernel( y, A, x, scalar );
@@ -4039,6 +4056,9 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    //
    // This function relays to the default implementation of the addition assignment of a large
    // scaled dense matrix-dense vector multiplication expression to a dense vector.
+   //
+   // In case the runtime dispatch is active (see getInstructionSet()), the operation is
+   // relayed to the according dispatched kernel instead.
    */
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
@@ -4047,7 +4067,8 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    static inline typename EnableIf< UseDefaultKernel<VT1,MT1,VT2,ST2> >::Type
       selectBlasAddAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
-      selectLargeAddAssignKernel( y, A, x, scalar );
+      if( !dispatchGemv( y, A, x, scalar, 1 ) )
+         selectLargeAddAssignKernel( y, A, x, scalar );
    }
    //**********************************************************************************************
 
@@ -4248,7 +4269,7 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < getThreshold( dmatDVecMultThreshold ) ) )
          selectSmallSubAssignKernel( y, A, x, scalar );
       else
          selectBlasSubAssignKernel( y, A, x, scalar );
@@ -4664,6 +4685,9 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    //
    // This function relays to the default implementation of the subtraction assignment of a large
    // scaled dense matrix-dense vector multiplication expression to a dense vector.
+   //
+   // In case the runtime dispatch is active (see getInstructionSet()), the operation is
+   // relayed to the according dispatched kernel instead.
    */
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
@@ -4672,7 +4696,8 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    static inline typename EnableIf< UseDefaultKernel<VT1,MT1,VT2,ST2> >::Type
       selectBlasSubAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
-      selectLargeSubAssignKernel( y, A, x, scalar );
+      if( !dispatchGemv( y, A, x, -scalar, 1 ) )
+         selectLargeSubAssignKernel( y, A, x, scalar );
    }
    //**********************************************************************************************
 
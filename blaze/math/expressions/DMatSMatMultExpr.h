@@ -346,7 +346,7 @@ class DMatSMatMultExpr : public DenseMatrix< DMatSMatMultExpr<MT1,MT2>, false >
    // \return \a true in case the expression can be used in SMP assignments, \a false if not.
    */
    inline bool canSMPAssign() const {
-      return ( rows() > SMP_DMATSMATMULT_THRESHOLD );
+      return ( rows() > getThreshold( smpDMatSMatMultThreshold ) );
    }
    //**********************************************************************************************
 
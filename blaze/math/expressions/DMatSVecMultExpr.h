@@ -302,7 +302,7 @@ class DMatSVecMultExpr : public DenseVector< DMatSVecMultExpr<MT,VT>, false >
    // \return \a true in case the expression can be used in SMP assignments, \a false if not.
    */
    inline bool canSMPAssign() const {
-      return ( size() > SMP_DMATSVECMULT_THRESHOLD );
+      return ( size() > getThreshold( smpDMatSVecMultThreshold ) );
    }
    //**********************************************************************************************
 
@@ -588,7 +588,8 @@ class DMatScalarDivExpr : public DenseMatrix< DMatScalarDivExpr<MT,ST,SO>, SO >
    */
    inline bool canSMPAssign() const {
       return matrix_.canSMPAssign() ||
-             ( ( ( SO == rowMajor ) ? rows() : columns() ) > SMP_DMATSCALARMULT_THRESHOLD );
+             ( ( ( SO == rowMajor ) ? rows() : columns() ) >
+               getThreshold( smpDMatScalarMultThreshold ) );
    }
    //**********************************************************************************************
 
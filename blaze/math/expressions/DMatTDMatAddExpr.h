@@ -294,7 +294,7 @@ class DMatTDMatAddExpr : public DenseMatrix< DMatTDMatAddExpr<MT1,MT2>, false >
    */
    inline bool canSMPAssign() const {
       return lhs_.canSMPAssign() || rhs_.canSMPAssign() ||
-             ( rows() > SMP_DMATTDMATADD_THRESHOLD );
+             ( rows() > getThreshold( smpDMatTDMatAddThreshold ) );
    }
    //**********************************************************************************************
 
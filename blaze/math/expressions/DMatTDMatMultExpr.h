@@ -45,6 +45,7 @@
 #include <blaze/math/constraints/DenseMatrix.h>
 #include <blaze/math/constraints/MatMatMultExpr.h>
 #include <blaze/math/constraints/StorageOrder.h>
+#include <blaze/math/dense/MMM.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/Forward.h>
@@ -456,8 +457,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    */
    inline bool canSMPAssign() const {
       return ( !BLAZE_BLAS_IS_PARALLEL ||
-               ( rows() * columns() < DMATTDMATMULT_THRESHOLD ) ) &&
-             ( rows() > SMP_DMATTDMATMULT_THRESHOLD );
+               ( rows() * columns() < getThreshold( dmatTDMatMultThreshold ) ) ) &&
+             ( rows() > getThreshold( smpDMatTDMatMultThreshold ) );
    }
    //**********************************************************************************************
 
@@ -529,7 +530,7 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    static inline void selectAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       if( ( IsDiagonal<MT4>::value || IsDiagonal<MT5>::value ) ||
-          ( C.rows() * C.columns() < DMATTDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < getThreshold( dmatTDMatMultThreshold ) ) )
          selectSmallAssignKernel( C, A, B );
       else
          selectBlasAssignKernel( C, A, B );
@@ -1310,7 +1311,7 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    //
    // This function implements the vectorized default assignment of a dense matrix-transpose dense
    // matrix multiplication expression to a row-major dense matrix. This kernel is optimized for
-   // large matrices.
+   // large matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -1318,8 +1319,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallAssignKernel( ~C, A, B );
+      if( IsDiagonal<MT4>::value )
+         selectSmallAssignKernel( ~C, A, B );
+      else
+         mmm( ~C, A, B, ElementType(1), ElementType(0) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1337,7 +1340,7 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    //
    // This function implements the vectorized default assignment of a dense matrix-transpose dense
    // matrix multiplication expression to a column-major dense matrix. This kernel is optimized for
-   // large matrices.
+   // large matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -1345,8 +1348,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallAssignKernel( ~C, A, B );
+      if( IsDiagonal<MT4>::value )
+         selectSmallAssignKernel( ~C, A, B );
+      else
+         mmm( ~C, A, B, ElementType(1), ElementType(0) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1627,7 +1632,7 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    static inline void selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       if( ( IsDiagonal<MT4>::value || IsDiagonal<MT5>::value ) ||
-          ( C.rows() * C.columns() < DMATTDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < getThreshold( dmatTDMatMultThreshold ) ) )
          selectSmallAddAssignKernel( C, A, B );
       else
          selectBlasAddAssignKernel( C, A, B );
@@ -2380,8 +2385,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    // \return void
    //
    // This function implements the vectorized default addition assignment of a dense matrix-
-   // transpose dense matrix multiplication expression to a row-major dense matrix. This
-   // kernel is optimized for large matrices.
+   // transpose dense matrix multiplication expression to a row-major dense matrix. This kernel is
+   // optimized for large matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -2389,8 +2394,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallAddAssignKernel( ~C, A, B );
+      if( IsDiagonal<MT4>::value )
+         selectSmallAddAssignKernel( ~C, A, B );
+      else
+         mmm( ~C, A, B, ElementType(1), ElementType(1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2407,8 +2414,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    // \return void
    //
    // This function implements the vectorized default addition assignment of a dense matrix-
-   // transpose dense matrix multiplication expression to a column-major dense matrix. This
-   // kernel is optimized for large matrices.
+   // transpose dense matrix multiplication expression to a column-major dense matrix. This kernel
+   // is optimized for large matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -2416,8 +2423,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallAddAssignKernel( ~C, A, B );
+      if( IsDiagonal<MT4>::value )
+         selectSmallAddAssignKernel( ~C, A, B );
+      else
+         mmm( ~C, A, B, ElementType(1), ElementType(1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2673,7 +2682,7 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    static inline void selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       if( ( IsDiagonal<MT4>::value || IsDiagonal<MT5>::value ) ||
-          ( C.rows() * C.columns() < DMATTDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < getThreshold( dmatTDMatMultThreshold ) ) )
          selectSmallSubAssignKernel( C, A, B );
       else
          selectBlasSubAssignKernel( C, A, B );
@@ -3425,9 +3434,9 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    // \param B The right-hand side multiplication operand.
    // \return void
    //
-   // This function implements the default subtraction assignment of a dense matrix-transpose
-   // dense matrix multiplication expression to a row-major dense matrix. This kernel is
-   // optimized for large matrices.
+   // This function implements the vectorized default subtraction assignment of a dense matrix-
+   // transpose dense matrix multiplication expression to a row-major dense matrix. This kernel is
+   // optimized for large matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -3435,8 +3444,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallSubAssignKernel( ~C, A, B );
+      if( IsDiagonal<MT4>::value )
+         selectSmallSubAssignKernel( ~C, A, B );
+      else
+         mmm( ~C, A, B, ElementType(-1), ElementType(1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -3452,9 +3463,9 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    // \param B The right-hand side multiplication operand.
    // \return void
    //
-   // This function implements the default subtraction assignment of a dense matrix-transpose
-   // dense matrix multiplication expression to a column-major dense matrix. This kernel is
-   // optimized for large matrices.
+   // This function implements the vectorized default subtraction assignment of a dense matrix-
+   // transpose dense matrix multiplication expression to a column-major dense matrix. This kernel
+   // is optimized for large matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -3462,8 +3473,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallSubAssignKernel( ~C, A, B );
+      if( IsDiagonal<MT4>::value )
+         selectSmallSubAssignKernel( ~C, A, B );
+      else
+         mmm( ~C, A, B, ElementType(-1), ElementType(1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -4188,8 +4201,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    inline bool canSMPAssign() const {
       typename MMM::LeftOperand A( matrix_.leftOperand() );
       return ( !BLAZE_BLAS_IS_PARALLEL ||
-               ( rows() * columns() < DMATTDMATMULT_THRESHOLD ) ) &&
-             ( A.rows() > SMP_DMATTDMATMULT_THRESHOLD );
+               ( rows() * columns() < getThreshold( dmatTDMatMultThreshold ) ) ) &&
+             ( A.rows() > getThreshold( smpDMatTDMatMultThreshold ) );
    }
    //**********************************************************************************************
 
@@ -4263,7 +4276,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    static inline void selectAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       if( ( IsDiagonal<MT4>::value || IsDiagonal<MT5>::value ) ||
-          ( C.rows() * C.columns() < DMATTDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < getThreshold( dmatTDMatMultThreshold ) ) )
          selectSmallAssignKernel( C, A, B, scalar );
       else
          selectBlasAssignKernel( C, A, B, scalar );
@@ -5043,9 +5056,9 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    // \param scalar The scaling factor.
    // \return void
    //
-   // This function implements the vectorized default assignment of a scaled dense matrix-
-   // transpose dense matrix multiplication expression to a row-major dense matrix. This
-   // kernel is optimized for large matrices.
+   // This function implements the vectorized default assignment of a scaled dense matrix-transpose
+   // dense matrix multiplication expression to a row-major dense matrix. This kernel is optimized
+   // for large matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -5054,8 +5067,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallAssignKernel( ~C, A, B, scalar );
+      if( IsDiagonal<MT4>::value )
+         selectSmallAssignKernel( ~C, A, B, scalar );
+      else
+         mmm( ~C, A, B, scalar, ST2(0) );
    }
    //**********************************************************************************************
 
@@ -5070,9 +5085,9 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    // \param scalar The scaling factor.
    // \return void
    //
-   // This function implements the vectorized default assignment of a scaled dense matrix-
-   // transpose dense matrix multiplication expression to a column-major dense matrix. This
-   // kernel is optimized for large matrices.
+   // This function implements the vectorized default assignment of a scaled dense matrix-transpose
+   // dense matrix multiplication expression to a column-major dense matrix. This kernel is
+   // optimized for large matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -5081,8 +5096,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallAssignKernel( ~C, A, B, scalar );
+      if( IsDiagonal<MT4>::value )
+         selectSmallAssignKernel( ~C, A, B, scalar );
+      else
+         mmm( ~C, A, B, scalar, ST2(0) );
    }
    //**********************************************************************************************
 
@@ -5362,7 +5379,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    static inline void selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       if( ( IsDiagonal<MT4>::value || IsDiagonal<MT5>::value ) ||
-          ( C.rows() * C.columns() < DMATTDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < getThreshold( dmatTDMatMultThreshold ) ) )
          selectSmallAddAssignKernel( C, A, B, scalar );
       else
          selectBlasAddAssignKernel( C, A, B, scalar );
@@ -6040,9 +6057,9 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    // \param scalar The scaling factor.
    // \return void
    //
-   // This function implements the vectorized default addition assignment of a scaled dense
-   // matrix-transpose dense matrix multiplication expression to a row-major dense matrix.
-   // This kernel is optimized for large matrices.
+   // This function implements the vectorized default addition assignment of a scaled dense matrix-
+   // transpose dense matrix multiplication expression to a row-major dense matrix. This kernel is
+   // optimized for large matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -6051,8 +6068,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallAddAssignKernel( ~C, A, B, scalar );
+      if( IsDiagonal<MT4>::value )
+         selectSmallAddAssignKernel( ~C, A, B, scalar );
+      else
+         mmm( ~C, A, B, scalar, ST2(1) );
    }
    //**********************************************************************************************
 
@@ -6067,9 +6086,9 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    // \param scalar The scaling factor.
    // \return void
    //
-   // This function implements the vectorized default addition assignment of a scaled dense
-   // matrix-transpose dense matrix multiplication expression to a column-major dense matrix.
-   // This kernel is optimized for large matrices.
+   // This function implements the vectorized default addition assignment of a scaled dense matrix-
+   // transpose dense matrix multiplication expression to a column-major dense matrix. This kernel
+   // is optimized for large matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -6078,8 +6097,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallAddAssignKernel( ~C, A, B, scalar );
+      if( IsDiagonal<MT4>::value )
+         selectSmallAddAssignKernel( ~C, A, B, scalar );
+      else
+         mmm( ~C, A, B, scalar, ST2(1) );
    }
    //**********************************************************************************************
 
@@ -6336,7 +6357,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    static inline void selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       if( ( IsDiagonal<MT4>::value || IsDiagonal<MT5>::value ) ||
-          ( C.rows() * C.columns() < DMATTDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < getThreshold( dmatTDMatMultThreshold ) ) )
          selectSmallSubAssignKernel( C, A, B, scalar );
       else
          selectBlasSubAssignKernel( C, A, B, scalar );
@@ -7019,7 +7040,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    //
    // This function implements the vectorized default subtraction assignment of a scaled dense
    // matrix-transpose dense matrix multiplication expression to a row-major dense matrix. This
-   // kernel is optimized for large matrices.
+   // kernel is optimized for large matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -7028,8 +7049,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallSubAssignKernel( ~C, A, B, scalar );
+      if( IsDiagonal<MT4>::value )
+         selectSmallSubAssignKernel( ~C, A, B, scalar );
+      else
+         mmm( ~C, A, B, ST2(-scalar), ST2(1) );
    }
    //**********************************************************************************************
 
@@ -7045,8 +7068,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    // \return void
    //
    // This function implements the vectorized default subtraction assignment of a scaled dense
-   // matrix-transpose dense matrix multiplication expression to a column-major dense matrix.
-   // This kernel is optimized for large matrices.
+   // matrix-transpose dense matrix multiplication expression to a column-major dense matrix. This
+   // kernel is optimized for large matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -7055,8 +7078,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallSubAssignKernel( ~C, A, B, scalar );
+      if( IsDiagonal<MT4>::value )
+         selectSmallSubAssignKernel( ~C, A, B, scalar );
+      else
+         mmm( ~C, A, B, ST2(-scalar), ST2(1) );
    }
    //**********************************************************************************************
 
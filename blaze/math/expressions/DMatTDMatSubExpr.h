@@ -294,7 +294,7 @@ class DMatTDMatSubExpr : public DenseMatrix< DMatTDMatSubExpr<MT1,MT2>, false >
    */
    inline bool canSMPAssign() const {
       return lhs_.canSMPAssign() || rhs_.canSMPAssign() ||
-             ( rows() > SMP_DMATTDMATSUB_THRESHOLD );
+             ( rows() > getThreshold( smpDMatTDMatSubThreshold ) );
    }
    //**********************************************************************************************
 
@@ -568,7 +568,7 @@ class DVecDVecAddExpr : public DenseVector< DVecDVecAddExpr<VT1,VT2,TF>, TF >
    */
    inline bool canSMPAssign() const {
       return lhs_.canSMPAssign() || rhs_.canSMPAssign() ||
-             ( size() > SMP_DVECDVECADD_THRESHOLD );
+             ( size() > getThreshold( smpDVecDVecAddThreshold ) );
    }
    //**********************************************************************************************
 
@@ -566,7 +566,7 @@ class DVecDVecMultExpr : public DenseVector< DVecDVecMultExpr<VT1,VT2,TF>, TF >
    */
    inline bool canSMPAssign() const {
       return lhs_.canSMPAssign() || rhs_.canSMPAssign() ||
-             ( size() > SMP_DVECDVECMULT_THRESHOLD );
+             ( size() > getThreshold( smpDVecDVecMultThreshold ) );
    }
    //**********************************************************************************************
 
@@ -566,7 +566,7 @@ class DVecDVecSubExpr : public DenseVector< DVecDVecSubExpr<VT1,VT2,TF>, TF >
    */
    inline bool canSMPAssign() const {
       return lhs_.canSMPAssign() || rhs_.canSMPAssign() ||
-             ( size() > SMP_DVECDVECSUB_THRESHOLD );
+             ( size() > getThreshold( smpDVecDVecSubThreshold ) );
    }
    //**********************************************************************************************
 
@@ -43,6 +43,7 @@
 #include <iterator>
 #include <blaze/math/constraints/DenseVector.h>
 #include <blaze/math/constraints/TransposeFlag.h>
+#include <blaze/math/dispatch/Level1.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/DenseVector.h>
@@ -58,6 +59,7 @@
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/traits/SubvectorExprTrait.h>
 #include <blaze/math/typetraits/BaseElementType.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/IsColumnMajorMatrix.h>
 #include <blaze/math/typetraits/IsColumnVector.h>
 #include <blaze/math/typetraits/IsComputation.h>
@@ -150,6 +152,21 @@ class DVecScalarMultExpr : public DenseVector< DVecScalarMultExpr<VT,ST,TF>, TF
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Dispatch evaluation strategy****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the dense vector operand does not require an intermediate evaluation and both the
+       target vector and the vector operand can be handled by the dispatched kernels, \a value
+       is set to 1 and the addition and subtraction assignments are relayed to the dispatched
+       scaled vector addition (see dispatchAxpy()). Otherwise \a value is set to 0. */
+   template< typename VT2 >
+   struct UseDispatchedAssign {
+      enum { value = !useAssign && HasMutableDataAccess<VT2>::value &&
+                     UseDispatchedKernel<VT2,VT>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Parallel evaluation strategy****************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper structure for the explicit application of the SFINAE principle.
@@ -263,7 +280,7 @@ class DVecScalarMultExpr : public DenseVector< DVecScalarMultExpr<VT,ST,TF>, TF
       // \return The previous position of the iterator.
       */
       inline const ConstIterator operator++( int ) {
-         return ConstIterator( iterator_++ );
+         return ConstIterator( iterator_++, scalar_ );
       }
       //*******************************************************************************************
 
@@ -284,7 +301,7 @@ class DVecScalarMultExpr : public DenseVector< DVecScalarMultExpr<VT,ST,TF>, TF
       // \return The previous position of the iterator.
       */
       inline const ConstIterator operator--( int ) {
-         return ConstIterator( iterator_-- );
+         return ConstIterator( iterator_--, scalar_ );
       }
       //*******************************************************************************************
 
@@ -303,7 +320,7 @@ class DVecScalarMultExpr : public DenseVector< DVecScalarMultExpr<VT,ST,TF>, TF
       //
       // \return The resulting intrinsic value.
       */
-      inline IntrinsicType load() const {
+      inline typename IntrinsicMultTrait<IntrinsicType>::Type load() const {
          return iterator_.load() * set( scalar_ );
       }
       //*******************************************************************************************
@@ -393,7 +410,7 @@ class DVecScalarMultExpr : public DenseVector< DVecScalarMultExpr<VT,ST,TF>, TF
       // \return The incremented iterator.
       */
       friend inline const ConstIterator operator+( const ConstIterator& it, size_t inc ) {
-         return ConstIterator( it.iterator_ + inc );
+         return ConstIterator( it.iterator_ + inc, it.scalar_ );
       }
       //*******************************************************************************************
 
@@ -405,7 +422,7 @@ class DVecScalarMultExpr : public DenseVector< DVecScalarMultExpr<VT,ST,TF>, TF
       // \return The incremented iterator.
       */
       friend inline const ConstIterator operator+( size_t inc, const ConstIterator& it ) {
-         return ConstIterator( it.iterator_ + inc );
+         return ConstIterator( it.iterator_ + inc, it.scalar_ );
       }
       //*******************************************************************************************
 
@@ -417,7 +434,7 @@ class DVecScalarMultExpr : public DenseVector< DVecScalarMultExpr<VT,ST,TF>, TF
       // \return The decremented iterator.
       */
       friend inline const ConstIterator operator-( const ConstIterator& it, size_t dec ) {
-         return ConstIterator( it.iterator_ - dec );
+         return ConstIterator( it.iterator_ - dec, it.scalar_ );
       }
       //*******************************************************************************************
 
@@ -469,7 +486,7 @@ class DVecScalarMultExpr : public DenseVector< DVecScalarMultExpr<VT,ST,TF>, TF
    // \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
    // \return Reference to the accessed values.
    */
-   BLAZE_ALWAYS_INLINE IntrinsicType load( size_t index ) const {
+   BLAZE_ALWAYS_INLINE typename IntrinsicMultTrait<IntrinsicType>::Type load( size_t index ) const {
       typedef IntrinsicTrait<ElementType>  IT;
       BLAZE_INTERNAL_ASSERT( index < vector_.size() , "Invalid vector access index" );
       BLAZE_INTERNAL_ASSERT( index % IT::size == 0UL, "Invalid vector access index" );
@@ -569,7 +586,7 @@ class DVecScalarMultExpr : public DenseVector< DVecScalarMultExpr<VT,ST,TF>, TF
    // \return \a true in case the expression can be used in SMP assignments, \a false if not.
    */
    inline bool canSMPAssign() const {
-      return vector_.canSMPAssign() || ( size() > SMP_DVECSCALARMULT_THRESHOLD );
+      return vector_.canSMPAssign() || ( size() > getThreshold( smpDVecScalarMultThreshold ) );
    }
    //**********************************************************************************************
 
@@ -667,6 +684,36 @@ class DVecScalarMultExpr : public DenseVector< DVecScalarMultExpr<VT,ST,TF>, TF
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Dispatched addition assignment to dense vectors*********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Dispatched addition assignment of a dense vector-scalar multiplication to a dense
+   //        vector (\f$ \vec{y}+=\vec{x}*s \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function relays the addition assignment of a dense vector-scalar multiplication to
+   // the dispatched scaled vector addition in case the runtime dispatch is active (see
+   // getInstructionSet()). Otherwise the default addition assignment is performed. Due to the
+   // explicit application of the SFINAE principle, this function can only be selected by the
+   // compiler in case the involved vectors can be handled by the dispatched kernels.
+   */
+   template< typename VT2 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseDispatchedAssign<VT2> >::Type
+      addAssign( DenseVector<VT2,TF>& lhs, const DVecScalarMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( !dispatchAxpy( ~lhs, rhs.vector_, rhs.scalar_ ) )
+         (~lhs).addAssign( rhs );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Addition assignment to sparse vectors*******************************************************
    // No special implementation for the addition assignment to sparse vectors.
    //**********************************************************************************************
@@ -703,6 +750,36 @@ class DVecScalarMultExpr : public DenseVector< DVecScalarMultExpr<VT,ST,TF>, TF
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Dispatched subtraction assignment to dense vectors******************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Dispatched subtraction assignment of a dense vector-scalar multiplication to a dense
+   //        vector (\f$ \vec{y}-=\vec{x}*s \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function relays the subtraction assignment of a dense vector-scalar multiplication to
+   // the dispatched scaled vector addition in case the runtime dispatch is active (see
+   // getInstructionSet()). Otherwise the default subtraction assignment is performed. Due to the
+   // explicit application of the SFINAE principle, this function can only be selected by the
+   // compiler in case the involved vectors can be handled by the dispatched kernels.
+   */
+   template< typename VT2 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseDispatchedAssign<VT2> >::Type
+      subAssign( DenseVector<VT2,TF>& lhs, const DVecScalarMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( !dispatchAxpy( ~lhs, rhs.vector_, -rhs.scalar_ ) )
+         (~lhs).subAssign( rhs );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Subtraction assignment to sparse vectors****************************************************
    // No special implementation for the subtraction assignment to sparse vectors.
    //**********************************************************************************************
@@ -623,7 +623,7 @@ class DVecTDVecMultExpr : public DenseMatrix< DVecTDVecMultExpr<VT1,VT2>, false
    // \return \a true in case the expression can be used in SMP assignments, \a false if not.
    */
    inline bool canSMPAssign() const {
-      return ( rows() > SMP_DVECTDVECMULT_THRESHOLD );
+      return ( rows() > getThreshold( smpDVecTDVecMultThreshold ) );
    }
    //**********************************************************************************************
 
@@ -401,7 +401,7 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2>, false >
    // \return \a true in case the expression can be used in SMP assignments, \a false if not.
    */
    inline bool canSMPAssign() const {
-      return ( rows() > SMP_SMATDMATMULT_THRESHOLD );
+      return ( rows() > getThreshold( smpSMatDMatMultThreshold ) );
    }
    //**********************************************************************************************
 
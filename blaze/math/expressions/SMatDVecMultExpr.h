@@ -60,6 +60,7 @@
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsMatMatMultExpr.h>
+#include <blaze/math/typetraits/IsSellMatrix.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/typetraits/Rows.h>
 #include <blaze/math/typetraits/Size.h>
@@ -71,6 +72,7 @@
 #include <blaze/util/logging/FunctionTrace.h>
 #include <blaze/util/SelectType.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
 
@@ -117,11 +119,12 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
    //! Compilation switch for the evaluation strategy of the multiplication expression.
    /*! The \a useAssign compile time constant expression represents a compilation switch for
        the evaluation strategy of the multiplication expression. In case either the matrix or
-       the vector operand requires an intermediate evaluation or the dense vector expression
-       is a compound expression, \a useAssign will be set to \a true and the multiplication
-       expression will be evaluated via the \a assign function family. Otherwise \a useAssign
-       will be set to \a false and the expression will be evaluated via the subscript operator. */
-   enum { useAssign = evaluateMatrix || evaluateVector };
+       the vector operand requires an intermediate evaluation, the dense vector expression
+       is a compound expression or the sparse matrix is a SELL matrix, \a useAssign will be
+       set to \a true and the multiplication expression will be evaluated via the \a assign
+       function family. Otherwise \a useAssign will be set to \a false and the expression will
+       be evaluated via the subscript operator. */
+   enum { useAssign = evaluateMatrix || evaluateVector || IsSellMatrix<MT>::value };
    //**********************************************************************************************
 
    //**********************************************************************************************
@@ -339,7 +342,7 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
    // \return \a true in case the expression can be used in SMP assignments, \a false if not.
    */
    inline bool canSMPAssign() const {
-      return ( size() > SMP_SMATDVECMULT_THRESHOLD );
+      return ( size() > getThreshold( smpSMatDVecMultThreshold ) );
    }
    //**********************************************************************************************
 
@@ -349,6 +352,75 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
    RightOperand vec_;  //!< Right-hand side dense vector of the multiplication expression.
    //**********************************************************************************************
 
+   //**SELL kernel*********************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Kernel for the chunk-wise computation of a SELL matrix-dense vector multiplication.
+   //
+   // The SellKernel class computes the elements of the target vector that correspond to a range
+   // of chunks of a SELL matrix by means of the given product function of the SELL matrix (i.e.
+   // assignProduct(), addAssignProduct() or subAssignProduct()). Since the rows of different
+   // chunks are disjoint, several copies of the kernel can be used concurrently.
+   */
+   template< typename VT1    // Type of the target dense vector
+           , typename MT1    // Type of the left-hand side SELL matrix
+           , typename VT2 >  // Type of the right-hand side dense vector
+   class SellKernel
+   {
+    public:
+      //**Type definitions*************************************************************************
+      //! Type of the product function of the SELL matrix.
+      typedef void (MT1::*Product)( VT1&, const VT2&, size_t, size_t ) const;
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the SellKernel class.
+      //
+      // \param y The target dense vector.
+      // \param A The left-hand side SELL matrix operand.
+      // \param x The right-hand side dense vector operand.
+      // \param product The product function of the SELL matrix.
+      */
+      explicit inline SellKernel( VT1& y, const MT1& A, const VT2& x, Product product )
+         : y_      ( y )        // The target dense vector
+         , A_      ( A )        // The left-hand side SELL matrix operand
+         , x_      ( x )        // The right-hand side dense vector operand
+         , product_( product )  // The product function of the SELL matrix
+      {}
+      //*******************************************************************************************
+
+      //**Chunks function**************************************************************************
+      /*!\brief Returns the number of chunks of the SELL matrix.
+      //
+      // \return The number of chunks of the SELL matrix.
+      */
+      inline size_t chunks() const {
+         return A_.chunks();
+      }
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Computes the elements of the target vector for the given range of chunks.
+      //
+      // \param first The index of the first chunk.
+      // \param last The index one past the last chunk.
+      // \return void
+      */
+      inline void operator()( size_t first, size_t last ) const {
+         (A_.*product_)( y_, x_, first, last );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      VT1&       y_;        //!< The target dense vector.
+      const MT1& A_;        //!< The left-hand side SELL matrix operand.
+      const VT2& x_;        //!< The right-hand side dense vector operand.
+      Product    product_;  //!< The product function of the SELL matrix.
+      //*******************************************************************************************
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to dense vectors*****************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a sparse matrix-dense vector multiplication to a dense vector
@@ -388,7 +460,56 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
       BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
 
-      assign( ~lhs, A * x );
+      SMatDVecMultExpr::selectAssignKernel( ~lhs, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default assignment to dense vectors**********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default assignment of a sparse matrix-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function assigns the product of the evaluated operands via the default sparse
+   // matrix-dense vector multiplication kernel.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename DisableIf< IsSellMatrix<MT1> >::Type
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      assign( y, A * x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SELL assignment to dense vectors*************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SELL assignment of a SELL matrix-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side SELL matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function assigns the product of a SELL matrix and a dense vector chunk by chunk.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< IsSellMatrix<MT1> >::Type
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      A.assignProduct( y, x, 0UL, A.chunks() );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -465,7 +586,56 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
       BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
 
-      addAssign( ~lhs, A * x );
+      SMatDVecMultExpr::selectAddAssignKernel( ~lhs, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default addition assignment to dense vectors*************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default addition assignment of a sparse matrix-dense vector multiplication
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function adds the product of the evaluated operands via the default sparse
+   // matrix-dense vector multiplication kernel.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename DisableIf< IsSellMatrix<MT1> >::Type
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      addAssign( y, A * x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SELL addition assignment to dense vectors****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SELL addition assignment of a SELL matrix-dense vector multiplication
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side SELL matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function adds the product of a SELL matrix and a dense vector chunk by chunk.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< IsSellMatrix<MT1> >::Type
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      A.addAssignProduct( y, x, 0UL, A.chunks() );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -512,7 +682,56 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
       BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
 
-      subAssign( ~lhs, A * x );
+      SMatDVecMultExpr::selectSubAssignKernel( ~lhs, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default subtraction assignment to dense vectors**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default subtraction assignment of a sparse matrix-dense vector multiplication
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function subtracts the product of the evaluated operands via the default sparse
+   // matrix-dense vector multiplication kernel.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename DisableIf< IsSellMatrix<MT1> >::Type
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      subAssign( y, A * x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SELL subtraction assignment to dense vectors*************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SELL subtraction assignment of a SELL matrix-dense vector multiplication
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side SELL matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function subtracts the product of a SELL matrix and a dense vector chunk by chunk.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< IsSellMatrix<MT1> >::Type
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      A.subAssignProduct( y, x, 0UL, A.chunks() );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -597,7 +816,63 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
       BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
 
-      smpAssign( ~lhs, A * x );
+      SMatDVecMultExpr::selectSmpAssignKernel( ~lhs, A, x, rhs );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default SMP assignment to dense vectors******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default SMP assignment of a sparse matrix-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param rhs The multiplication expression.
+   // \return void
+   //
+   // This function assigns the product of the evaluated operands via the default SMP
+   // evaluation of the sparse matrix-dense vector multiplication.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename DisableIf< IsSellMatrix<MT1> >::Type
+      selectSmpAssignKernel( VT1& y, const MT1& A, const VT2& x, const SMatDVecMultExpr& rhs )
+   {
+      UNUSED_PARAMETER( rhs );
+
+      smpAssign( y, A * x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SELL SMP assignment to dense vectors*********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SELL SMP assignment of a SELL matrix-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side SELL matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param rhs The multiplication expression.
+   // \return void
+   //
+   // This function assigns the product of a SELL matrix and a dense vector chunk by chunk.
+   // The chunks are distributed among all available threads.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< IsSellMatrix<MT1> >::Type
+      selectSmpAssignKernel( VT1& y, const MT1& A, const VT2& x, const SMatDVecMultExpr& rhs )
+   {
+      typedef SellKernel<VT1,MT1,VT2>  Kernel;
+
+      smpSellAssign( rhs, Kernel( y, A, x, &MT1::template assignProduct<VT1,VT2> ) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -672,7 +947,63 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
       BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
 
-      smpAddAssign( ~lhs, A * x );
+      SMatDVecMultExpr::selectSmpAddAssignKernel( ~lhs, A, x, rhs );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default SMP addition assignment to dense vectors*********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default SMP addition assignment of a sparse matrix-dense vector multiplication
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param rhs The multiplication expression.
+   // \return void
+   //
+   // This function adds the product of the evaluated operands via the default SMP
+   // evaluation of the sparse matrix-dense vector multiplication.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename DisableIf< IsSellMatrix<MT1> >::Type
+      selectSmpAddAssignKernel( VT1& y, const MT1& A, const VT2& x, const SMatDVecMultExpr& rhs )
+   {
+      UNUSED_PARAMETER( rhs );
+
+      smpAddAssign( y, A * x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SELL SMP addition assignment to dense vectors************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SELL SMP addition assignment of a SELL matrix-dense vector multiplication
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side SELL matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param rhs The multiplication expression.
+   // \return void
+   //
+   // This function adds the product of a SELL matrix and a dense vector chunk by chunk.
+   // The chunks are distributed among all available threads.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< IsSellMatrix<MT1> >::Type
+      selectSmpAddAssignKernel( VT1& y, const MT1& A, const VT2& x, const SMatDVecMultExpr& rhs )
+   {
+      typedef SellKernel<VT1,MT1,VT2>  Kernel;
+
+      smpSellAssign( rhs, Kernel( y, A, x, &MT1::template addAssignProduct<VT1,VT2> ) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -718,7 +1049,63 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
       BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
 
-      smpSubAssign( ~lhs, A * x );
+      SMatDVecMultExpr::selectSmpSubAssignKernel( ~lhs, A, x, rhs );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default SMP subtraction assignment to dense vectors******************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default SMP subtraction assignment of a sparse matrix-dense vector multiplication
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param rhs The multiplication expression.
+   // \return void
+   //
+   // This function subtracts the product of the evaluated operands via the default SMP
+   // evaluation of the sparse matrix-dense vector multiplication.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename DisableIf< IsSellMatrix<MT1> >::Type
+      selectSmpSubAssignKernel( VT1& y, const MT1& A, const VT2& x, const SMatDVecMultExpr& rhs )
+   {
+      UNUSED_PARAMETER( rhs );
+
+      smpSubAssign( y, A * x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SELL SMP subtraction assignment to dense vectors*********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SELL SMP subtraction assignment of a SELL matrix-dense vector multiplication
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side SELL matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param rhs The multiplication expression.
+   // \return void
+   //
+   // This function subtracts the product of a SELL matrix and a dense vector chunk by chunk.
+   // The chunks are distributed among all available threads.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< IsSellMatrix<MT1> >::Type
+      selectSmpSubAssignKernel( VT1& y, const MT1& A, const VT2& x, const SMatDVecMultExpr& rhs )
+   {
+      typedef SellKernel<VT1,MT1,VT2>  Kernel;
+
+      smpSellAssign( rhs, Kernel( y, A, x, &MT1::template subAssignProduct<VT1,VT2> ) );
    }
    /*! \endcond */
    //**********************************************************************************************
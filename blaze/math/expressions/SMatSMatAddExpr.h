@@ -66,6 +66,7 @@
 #include <blaze/math/typetraits/IsUpper.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/typetraits/Rows.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
@@ -290,12 +291,145 @@ class SMatSMatAddExpr : public SparseMatrix< SMatSMatAddExpr<MT1,MT2>, false >
    }
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const {
+      return ( rows() > getThreshold( smpSMatSMatAddThreshold ) );
+   }
+   //**********************************************************************************************
+
  private:
    //**Member variables****************************************************************************
    LeftOperand  lhs_;  //!< Left-hand side sparse matrix of the addition expression.
    RightOperand rhs_;  //!< Right-hand side sparse matrix of the addition expression.
    //**********************************************************************************************
 
+   //**Row kernel**********************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Kernel for the computation of single rows of a sparse matrix-sparse matrix
+   //        addition.
+   //
+   // The RowKernel class computes single rows of a sparse matrix-sparse matrix addition by
+   // merging the according rows of the two operands. The nonZeros() function determines the exact
+   // number of non-zero elements of a row, the assign() function appends the non-zero elements
+   // of a row to a sparse matrix.
+   */
+   class RowKernel
+   {
+    private:
+      //**Type definitions*************************************************************************
+      typedef typename RemoveReference<CT1>::Type  Left;   //!< Type of the left-hand side operand.
+      typedef typename RemoveReference<CT2>::Type  Right;  //!< Type of the right-hand side operand.
+
+      typedef typename Left::ConstIterator   LeftIterator;   //!< Iterator over the left operand.
+      typedef typename Right::ConstIterator  RightIterator;  //!< Iterator over the right operand.
+      //*******************************************************************************************
+
+    public:
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the RowKernel class.
+      //
+      // \param A The evaluated left-hand side sparse matrix operand.
+      // \param B The evaluated right-hand side sparse matrix operand.
+      */
+      explicit inline RowKernel( const Left& A, const Right& B )
+         : A_( A )  // The evaluated left-hand side sparse matrix operand
+         , B_( B )  // The evaluated right-hand side sparse matrix operand
+      {}
+      //*******************************************************************************************
+
+      //**NonZeros function************************************************************************
+      /*!\brief Returns the exact number of non-zero elements in the specified row.
+      //
+      // \param i The index of the row.
+      // \return The number of non-zero elements in row \a i.
+      */
+      inline size_t nonZeros( size_t i ) const
+      {
+         const LeftIterator  lend( A_.end(i) );
+         const RightIterator rend( B_.end(i) );
+
+         LeftIterator  l( A_.begin(i) );
+         RightIterator r( B_.begin(i) );
+
+         size_t nonzeros( 0UL );
+
+         while( l != lend && r != rend )
+         {
+            if( l->index() < r->index() ) {
+               ++l;
+            }
+            else if( l->index() > r->index() ) {
+               ++r;
+            }
+            else {
+               ++l;
+               ++r;
+            }
+            ++nonzeros;
+         }
+
+         return nonzeros + size_t( lend - l ) + size_t( rend - r );
+      }
+      //*******************************************************************************************
+
+      //**Assign function**************************************************************************
+      /*!\brief Appends the non-zero elements of the specified row to the given sparse matrix.
+      //
+      // \param lhs The target left-hand side sparse matrix.
+      // \param i The index of the row.
+      // \return void
+      */
+      template< typename MT >  // Type of the target sparse matrix
+      inline void assign( MT& lhs, size_t i ) const
+      {
+         const LeftIterator  lend( A_.end(i) );
+         const RightIterator rend( B_.end(i) );
+
+         LeftIterator  l( A_.begin(i) );
+         RightIterator r( B_.begin(i) );
+
+         while( l != lend && r != rend )
+         {
+            if( l->index() < r->index() ) {
+               lhs.append( i, l->index(), l->value() );
+               ++l;
+            }
+            else if( l->index() > r->index() ) {
+               lhs.append( i, r->index(), r->value() );
+               ++r;
+            }
+            else {
+               lhs.append( i, l->index(), l->value()+r->value() );
+               ++l;
+               ++r;
+            }
+         }
+
+         while( l != lend ) {
+            lhs.append( i, l->index(), l->value() );
+            ++l;
+         }
+
+         while( r != rend ) {
+            lhs.append( i, r->index(), r->value() );
+            ++r;
+         }
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      const Left&  A_;  //!< The evaluated left-hand side sparse matrix operand.
+      const Right& B_;  //!< The evaluated right-hand side sparse matrix operand.
+      //*******************************************************************************************
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to dense matrices****************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a sparse matrix-sparse matrix addition to a dense matrix.
@@ -367,9 +501,6 @@ class SMatSMatAddExpr : public SparseMatrix< SMatSMatAddExpr<MT1,MT2>, false >
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      typedef typename RemoveReference<CT1>::Type::ConstIterator  LeftIterator;
-      typedef typename RemoveReference<CT2>::Type::ConstIterator  RightIterator;
-
       CT1 A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side sparse matrix operand
       CT2 B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side sparse matrix operand
 
@@ -384,41 +515,10 @@ class SMatSMatAddExpr : public SparseMatrix< SMatSMatAddExpr<MT1,MT2>, false >
       (~lhs).reserve( A.nonZeros() + B.nonZeros() );
 
       // Performing the matrix addition
-      for( size_t i=0UL; i<(~lhs).rows(); ++i )
-      {
-         const LeftIterator  lend( A.end(i) );
-         const RightIterator rend( B.end(i) );
-
-         LeftIterator  l( A.begin(i) );
-         RightIterator r( B.begin(i) );
-
-         while( l != lend && r != rend )
-         {
-            if( l->index() < r->index() ) {
-               (~lhs).append( i, l->index(), l->value() );
-               ++l;
-            }
-            else if( l->index() > r->index() ) {
-               (~lhs).append( i, r->index(), r->value() );
-               ++r;
-            }
-            else {
-               (~lhs).append( i, l->index(), l->value()+r->value() );
-               ++l;
-               ++r;
-            }
-         }
-
-         while( l != lend ) {
-            (~lhs).append( i, l->index(), l->value() );
-            ++l;
-         }
-
-         while( r != rend ) {
-            (~lhs).append( i, r->index(), r->value() );
-            ++r;
-         }
+      RowKernel kernel( A, B );
 
+      for( size_t i=0UL; i<(~lhs).rows(); ++i ) {
+         kernel.assign( ~lhs, i );
          (~lhs).finalize( i );
       }
    }
@@ -649,8 +749,41 @@ class SMatSMatAddExpr : public SparseMatrix< SMatSMatAddExpr<MT1,MT2>, false >
    // No special implementation for the SMP assignment to dense matrices.
    //**********************************************************************************************
 
-   //**SMP assignment to sparse matrices***********************************************************
-   // No special implementation for the SMP assignment to sparse matrices.
+   //**SMP assignment to row-major sparse matrices*************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a sparse matrix-sparse matrix addition to a
+   //        row-major sparse matrix.
+   // \ingroup sparse_matrix
+   //
+   // \param lhs The target left-hand side sparse matrix.
+   // \param rhs The right-hand side addition expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a sparse matrix-sparse matrix
+   // addition expression to a row-major sparse matrix. The rows of the result are computed in
+   // parallel by means of the row kernel of the addition.
+   */
+   template< typename MT >  // Type of the target sparse matrix
+   friend inline void smpAssign( SparseMatrix<MT,false>& lhs, const SMatSMatAddExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      CT1 A( rhs.lhs_ );  // Evaluation of the left-hand side sparse matrix operand
+      CT2 B( rhs.rhs_ );  // Evaluation of the right-hand side sparse matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.lhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( B.rows()    == rhs.rhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == rhs.rhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()     , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == (~lhs).columns()  , "Invalid number of columns" );
+
+      smpSparseAssign( ~lhs, rhs, RowKernel( A, B ) );
+   }
+   /*! \endcond */
    //**********************************************************************************************
 
    //**SMP addition assignment to dense matrices***************************************************
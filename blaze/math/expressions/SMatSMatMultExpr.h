@@ -352,7 +352,7 @@ class SMatSMatMultExpr : public SparseMatrix< SMatSMatMultExpr<MT1,MT2>, false >
    // \return \a true in case the expression can be used in SMP assignments, \a false if not.
    */
    inline bool canSMPAssign() const {
-      return ( rows() > SMP_SMATSMATMULT_THRESHOLD );
+      return ( rows() > getThreshold( smpSMatSMatMultThreshold ) );
    }
    //**********************************************************************************************
 
@@ -362,6 +362,175 @@ class SMatSMatMultExpr : public SparseMatrix< SMatSMatMultExpr<MT1,MT2>, false >
    RightOperand rhs_;  //!< Right-hand side sparse matrix of the multiplication expression.
    //**********************************************************************************************
 
+   //**Row kernel**********************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Kernel for the computation of single rows of a sparse matrix-sparse matrix
+   //        multiplication.
+   //
+   // The RowKernel class computes single rows of a sparse matrix-sparse matrix multiplication
+   // by means of a sparse accumulator. The nonZeros() function determines the exact number of
+   // non-zero elements of a row, the assign() function appends the non-zero elements of a row
+   // to a sparse matrix. Since every copy of the kernel uses its own accumulator, several copies
+   // can be used concurrently for different rows.
+   */
+   class RowKernel
+   {
+    private:
+      //**Type definitions*************************************************************************
+      typedef typename RemoveReference<CT1>::Type  Left;   //!< Type of the left-hand side operand.
+      typedef typename RemoveReference<CT2>::Type  Right;  //!< Type of the right-hand side operand.
+
+      typedef typename Left::ConstIterator   LeftIterator;   //!< Iterator over the left operand.
+      typedef typename Right::ConstIterator  RightIterator;  //!< Iterator over the right operand.
+      //*******************************************************************************************
+
+    public:
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the RowKernel class.
+      //
+      // \param A The evaluated left-hand side sparse matrix operand.
+      // \param B The evaluated right-hand side sparse matrix operand.
+      */
+      explicit inline RowKernel( const Left& A, const Right& B )
+         : A_      ( A )  // The evaluated left-hand side sparse matrix operand
+         , B_      ( B )  // The evaluated right-hand side sparse matrix operand
+         , values_ ()     // The accumulated values of the current row
+         , valid_  ()     // The validity flags of the accumulated values
+         , indices_()     // The column indices of the accumulated values
+      {}
+      //*******************************************************************************************
+
+      //**NonZeros function************************************************************************
+      /*!\brief Returns the exact number of non-zero elements in the specified row.
+      //
+      // \param i The index of the row.
+      // \return The number of non-zero elements in row \a i.
+      */
+      inline size_t nonZeros( size_t i )
+      {
+         init();
+
+         size_t nonzeros( 0UL );
+
+         const LeftIterator lend( A_.end(i) );
+         for( LeftIterator lelem=A_.begin(i); lelem!=lend; ++lelem )
+         {
+            const RightIterator rend( B_.end( lelem->index() ) );
+            for( RightIterator relem=B_.begin( lelem->index() ); relem!=rend; ++relem )
+            {
+               if( !valid_[relem->index()] ) {
+                  valid_[relem->index()] = 1;
+                  indices_[nonzeros] = relem->index();
+                  ++nonzeros;
+               }
+            }
+         }
+
+         for( size_t j=0UL; j<nonzeros; ++j ) {
+            reset( valid_[indices_[j]] );
+         }
+
+         return nonzeros;
+      }
+      //*******************************************************************************************
+
+      //**Assign function**************************************************************************
+      /*!\brief Appends the non-zero elements of the specified row to the given sparse matrix.
+      //
+      // \param lhs The target left-hand side sparse matrix.
+      // \param i The index of the row.
+      // \return void
+      */
+      template< typename MT >  // Type of the target sparse matrix
+      inline void assign( MT& lhs, size_t i )
+      {
+         init();
+
+         size_t nonzeros( 0UL ), minIndex( inf ), maxIndex( 0UL );
+
+         const LeftIterator lend( A_.end(i) );
+         for( LeftIterator lelem=A_.begin(i); lelem!=lend; ++lelem )
+         {
+            const RightIterator rend( B_.end( lelem->index() ) );
+            for( RightIterator relem=B_.begin( lelem->index() ); relem!=rend; ++relem )
+            {
+               if( !valid_[relem->index()] ) {
+                  values_[relem->index()] = lelem->value() * relem->value();
+                  valid_ [relem->index()] = 1;
+                  indices_[nonzeros] = relem->index();
+                  ++nonzeros;
+                  if( relem->index() < minIndex ) minIndex = relem->index();
+                  if( relem->index() > maxIndex ) maxIndex = relem->index();
+               }
+               else {
+                  values_[relem->index()] += lelem->value() * relem->value();
+               }
+            }
+         }
+
+         BLAZE_INTERNAL_ASSERT( nonzeros <= lhs.columns(), "Invalid number of non-zero elements" );
+
+         if( nonzeros == 0UL )
+            return;
+
+         BLAZE_INTERNAL_ASSERT( minIndex <= maxIndex, "Invalid index detected" );
+
+         if( ( nonzeros + nonzeros ) < ( maxIndex - minIndex ) )
+         {
+            std::sort( indices_.begin(), indices_.begin() + nonzeros );
+
+            for( size_t j=0UL; j<nonzeros; ++j )
+            {
+               const size_t index( indices_[j] );
+               if( !isDefault( values_[index] ) ) {
+                  lhs.append( i, index, values_[index] );
+                  reset( values_[index] );
+               }
+
+               reset( valid_[index] );
+            }
+         }
+         else {
+            for( size_t j=minIndex; j<=maxIndex; ++j )
+            {
+               if( !isDefault( values_[j] ) ) {
+                  lhs.append( i, j, values_[j] );
+                  reset( values_[j] );
+               }
+
+               reset( valid_[j] );
+            }
+         }
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Init function****************************************************************************
+      /*!\brief Allocates the sparse accumulator on first use.
+      //
+      // \return void
+      */
+      inline void init()
+      {
+         if( valid_.empty() ) {
+            values_ .resize( B_.columns(), ElementType() );
+            valid_  .resize( B_.columns(), 0   );
+            indices_.resize( B_.columns(), 0UL );
+         }
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      const Left&              A_;        //!< The evaluated left-hand side sparse matrix operand.
+      const Right&             B_;        //!< The evaluated right-hand side sparse matrix operand.
+      std::vector<ElementType> values_;   //!< The accumulated values of the current row.
+      std::vector<byte>        valid_;    //!< The validity flags of the accumulated values.
+      std::vector<size_t>      indices_;  //!< The column indices of the accumulated values.
+      //*******************************************************************************************
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to dense matrices****************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a sparse matrix-sparse matrix multiplication to a dense matrix
@@ -463,7 +632,6 @@ class SMatSMatMultExpr : public SparseMatrix< SMatSMatMultExpr<MT1,MT2>, false >
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
       typedef typename RemoveReference<CT1>::Type::ConstIterator  LeftIterator;
-      typedef typename RemoveReference<CT2>::Type::ConstIterator  RightIterator;
 
       CT1 A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side sparse matrix operand
       CT2 B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side sparse matrix operand
@@ -490,74 +658,12 @@ class SMatSMatMultExpr : public SparseMatrix< SMatSMatMultExpr<MT1,MT2>, false >
       }
 
       (~lhs).reserve( nonzeros );
-      nonzeros = 0UL;
 
       // Performing the matrix-matrix multiplication
-      std::vector<ElementType> values ( (~lhs).columns(), ElementType() );
-      std::vector<byte>        valid  ( (~lhs).columns(), 0   );
-      std::vector<size_t>      indices( (~lhs).columns(), 0UL );
-      size_t minIndex( inf ), maxIndex( 0UL );
-
-      for( size_t i=0UL; i<(~lhs).rows(); ++i )
-      {
-         const LeftIterator lend( A.end(i) );
-         for( LeftIterator lelem=A.begin(i); lelem!=lend; ++lelem )
-         {
-            const RightIterator rend( B.end( lelem->index() ) );
-            for( RightIterator relem=B.begin( lelem->index() ); relem!=rend; ++relem )
-            {
-               if( !valid[relem->index()] ) {
-                  values[relem->index()] = lelem->value() * relem->value();
-                  valid [relem->index()] = 1;
-                  indices[nonzeros] = relem->index();
-                  ++nonzeros;
-                  if( relem->index() < minIndex ) minIndex = relem->index();
-                  if( relem->index() > maxIndex ) maxIndex = relem->index();
-               }
-               else {
-                  values[relem->index()] += lelem->value() * relem->value();
-               }
-            }
-         }
-
-         BLAZE_INTERNAL_ASSERT( nonzeros <= (~lhs).columns(), "Invalid number of non-zero elements" );
-
-         if( nonzeros > 0UL )
-         {
-            BLAZE_INTERNAL_ASSERT( minIndex <= maxIndex, "Invalid index detected" );
-
-            if( ( nonzeros + nonzeros ) < ( maxIndex - minIndex ) )
-            {
-               std::sort( indices.begin(), indices.begin() + nonzeros );
-
-               for( size_t j=0UL; j<nonzeros; ++j )
-               {
-                  const size_t index( indices[j] );
-                  if( !isDefault( values[index] ) ) {
-                     (~lhs).append( i, index, values[index] );
-                     reset( values[index] );
-                  }
-
-                  reset( valid [index] );
-               }
-            }
-            else {
-               for( size_t j=minIndex; j<=maxIndex; ++j )
-               {
-                  if( !isDefault( values[j] ) ) {
-                     (~lhs).append( i, j, values[j] );
-                     reset( values[j] );
-                  }
-
-                  reset( valid [j] );
-               }
-            }
-
-            nonzeros = 0UL;
-            minIndex = inf;
-            maxIndex = 0UL;
-         }
+      RowKernel kernel( A, B );
 
+      for( size_t i=0UL; i<(~lhs).rows(); ++i ) {
+         kernel.assign( ~lhs, i );
          (~lhs).finalize( i );
       }
    }
@@ -893,6 +999,46 @@ class SMatSMatMultExpr : public SparseMatrix< SMatSMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP assignment to row-major sparse matrices*************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a sparse matrix-sparse matrix multiplication to a row-major sparse
+   //        matrix (\f$ C=A*B \f$).
+   // \ingroup sparse_matrix
+   //
+   // \param lhs The target left-hand side sparse matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a sparse matrix-sparse
+   // matrix multiplication expression to a row-major sparse matrix. The rows of the result are
+   // computed in parallel by means of the row kernel of the multiplication. Due to the explicit
+   // application of the SFINAE principle this function can only be selected by the compiler in
+   // case none of the two matrix operands requires an intermediate evaluation.
+   */
+   template< typename MT >  // Type of the target sparse matrix
+   friend inline typename DisableIf< IsEvaluationRequired<MT,MT1,MT2> >::Type
+      smpAssign( SparseMatrix<MT,false>& lhs, const SMatSMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      CT1 A( rhs.lhs_ );  // Evaluation of the left-hand side sparse matrix operand
+      CT2 B( rhs.rhs_ );  // Evaluation of the right-hand side sparse matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.lhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( B.rows()    == rhs.rhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == rhs.rhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()     , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == (~lhs).columns()  , "Invalid number of columns" );
+
+      smpSparseAssign( ~lhs, rhs, RowKernel( A, B ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Restructuring SMP assignment to column-major matrices***************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Restructuring SMP assignment of a sparse matrix-sparse matrix multiplication to a
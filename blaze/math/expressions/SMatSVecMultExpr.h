@@ -367,7 +367,7 @@ class SMatSVecMultExpr : public SparseVector< SMatSVecMultExpr<MT,VT>, false >
    // \return \a true in case the expression can be used in SMP assignments, \a false if not.
    */
    inline bool canSMPAssign() const {
-      return ( size() > SMP_SMATSVECMULT_THRESHOLD );
+      return ( size() > getThreshold( smpSMatSVecMultThreshold ) );
    }
    //**********************************************************************************************
 
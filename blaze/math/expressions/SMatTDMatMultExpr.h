@@ -77,6 +77,7 @@
 #include <blaze/math/typetraits/IsLower.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/math/typetraits/IsRowVector.h>
+#include <blaze/math/typetraits/IsSellMatrix.h>
 #include <blaze/math/typetraits/IsSparseMatrix.h>
 #include <blaze/math/typetraits/IsSparseVector.h>
 #include <blaze/math/typetraits/IsSymmetric.h>
@@ -166,6 +167,20 @@ class SMatTDMatMultExpr : public DenseMatrix< SMatTDMatMultExpr<MT1,MT2>, false
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! The UseSellKernel struct is a helper struct for the selection of the parallel evaluation
+       strategy. In case the left-hand side sparse matrix operand is a SELL matrix and no
+       symmetry can be exploited, \a value is set to 1 and the chunk-wise SELL kernels are
+       selected. Otherwise \a value is set to 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseSellKernel {
+      enum { value = IsSellMatrix<T2>::value && !CanExploitSymmetry<T1,T2,T3>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    typedef SMatTDMatMultExpr<MT1,MT2>          This;           //!< Type of this SMatTDMatMultExpr instance.
@@ -348,7 +363,7 @@ class SMatTDMatMultExpr : public DenseMatrix< SMatTDMatMultExpr<MT1,MT2>, false
    // \return \a true in case the expression can be used in SMP assignments, \a false if not.
    */
    inline bool canSMPAssign() const {
-      return ( rows() > SMP_SMATTDMATMULT_THRESHOLD );
+      return ( rows() > getThreshold( smpSMatTDMatMultThreshold ) );
    }
    //**********************************************************************************************
 
@@ -358,6 +373,86 @@ class SMatTDMatMultExpr : public DenseMatrix< SMatTDMatMultExpr<MT1,MT2>, false
    RightOperand rhs_;  //!< Right-hand side dense matrix of the multiplication expression.
    //**********************************************************************************************
 
+   //**SELL kernel*********************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Kernel for the chunk-wise computation of a SELL matrix-dense matrix multiplication.
+   //
+   // The SellKernel class computes the rows of the target matrix that correspond to a range of
+   // chunks of a SELL matrix. The columns of the right-hand side dense matrix are processed one
+   // after another by means of the given product function of the SELL matrix (i.e.
+   // assignProduct(), addAssignProduct() or subAssignProduct()). Since the rows of different
+   // chunks are disjoint, several copies of the kernel can be used concurrently.
+   */
+   template< typename MT3    // Type of the target dense matrix
+           , typename MT4    // Type of the left-hand side SELL matrix
+           , typename MT5 >  // Type of the right-hand side dense matrix
+   class SellKernel
+   {
+    public:
+      //**Type definitions*************************************************************************
+      //! Type of a column of the target dense matrix.
+      typedef typename ColumnExprTrait<MT3>::Type  TargetColumn;
+
+      //! Type of a column of the right-hand side dense matrix.
+      typedef typename ColumnExprTrait<const MT5>::Type  OperandColumn;
+
+      //! Type of the product function of the SELL matrix.
+      typedef void (MT4::*Product)( TargetColumn&, const OperandColumn&, size_t, size_t ) const;
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the SellKernel class.
+      //
+      // \param C The target dense matrix.
+      // \param A The left-hand side SELL matrix operand.
+      // \param B The right-hand side dense matrix operand.
+      // \param product The product function of the SELL matrix.
+      */
+      explicit inline SellKernel( MT3& C, const MT4& A, const MT5& B, Product product )
+         : C_      ( C )        // The target dense matrix
+         , A_      ( A )        // The left-hand side SELL matrix operand
+         , B_      ( B )        // The right-hand side dense matrix operand
+         , product_( product )  // The product function of the SELL matrix
+      {}
+      //*******************************************************************************************
+
+      //**Chunks function**************************************************************************
+      /*!\brief Returns the number of chunks of the SELL matrix.
+      //
+      // \return The number of chunks of the SELL matrix.
+      */
+      inline size_t chunks() const {
+         return A_.chunks();
+      }
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Computes the rows of the target matrix for the given range of chunks.
+      //
+      // \param first The index of the first chunk.
+      // \param last The index one past the last chunk.
+      // \return void
+      */
+      inline void operator()( size_t first, size_t last ) const {
+         for( size_t j=0UL; j<B_.columns(); ++j ) {
+            TargetColumn y( column( C_, j ) );
+            const OperandColumn x( column( B_, j ) );
+            (A_.*product_)( y, x, first, last );
+         }
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      MT3&       C_;        //!< The target dense matrix.
+      const MT4& A_;        //!< The left-hand side SELL matrix operand.
+      const MT5& B_;        //!< The right-hand side dense matrix operand.
+      Product    product_;  //!< The product function of the SELL matrix.
+      //*******************************************************************************************
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to dense matrices****************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a sparse matrix-transpose dense matrix multiplication to a dense matrix
@@ -413,7 +508,8 @@ class SMatTDMatMultExpr : public DenseMatrix< SMatTDMatMultExpr<MT1,MT2>, false
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline void selectAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   static inline typename DisableIf< IsSellMatrix<MT4> >::Type
+      selectAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       typedef typename MT4::ConstIterator  ConstIterator;
 
@@ -474,6 +570,37 @@ class SMatTDMatMultExpr : public DenseMatrix< SMatTDMatMultExpr<MT1,MT2>, false
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SELL assignment to dense matrices************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SELL assignment of a SELL matrix-transpose dense matrix multiplication
+   //        (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side SELL matrix operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function implements the assignment kernel for the multiplication of a
+   // SELL matrix and a column-major dense matrix. The dense matrix is processed column by
+   // column via the SELL matrix-dense vector multiplication kernels.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< IsSellMatrix<MT4> >::Type
+      selectAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      typedef SellKernel<MT3,MT4,MT5>  Kernel;
+      typedef typename Kernel::TargetColumn   TargetColumn;
+      typedef typename Kernel::OperandColumn  OperandColumn;
+
+      const Kernel kernel( C, A, B, &MT4::template assignProduct<TargetColumn,OperandColumn> );
+      kernel( 0UL, A.chunks() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to sparse matrices***************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a sparse matrix-transpose dense matrix multiplication to a sparse matrix
@@ -596,7 +723,8 @@ class SMatTDMatMultExpr : public DenseMatrix< SMatTDMatMultExpr<MT1,MT2>, false
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline void selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   static inline typename DisableIf< IsSellMatrix<MT4> >::Type
+      selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       typedef typename MT4::ConstIterator  ConstIterator;
 
@@ -637,6 +765,37 @@ class SMatTDMatMultExpr : public DenseMatrix< SMatTDMatMultExpr<MT1,MT2>, false
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SELL addition assignment to dense matrices***************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SELL addition assignment of a SELL matrix-transpose dense matrix multiplication
+   //        (\f$ C+=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side SELL matrix operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function implements the addition assignment kernel for the multiplication of a
+   // SELL matrix and a column-major dense matrix. The dense matrix is processed column by
+   // column via the SELL matrix-dense vector multiplication kernels.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< IsSellMatrix<MT4> >::Type
+      selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      typedef SellKernel<MT3,MT4,MT5>  Kernel;
+      typedef typename Kernel::TargetColumn   TargetColumn;
+      typedef typename Kernel::OperandColumn  OperandColumn;
+
+      const Kernel kernel( C, A, B, &MT4::template addAssignProduct<TargetColumn,OperandColumn> );
+      kernel( 0UL, A.chunks() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Restructuring addition assignment to row-major matrices*************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Restructuring addition assignment of a sparse matrix-transpose dense matrix
@@ -724,7 +883,8 @@ class SMatTDMatMultExpr : public DenseMatrix< SMatTDMatMultExpr<MT1,MT2>, false
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline void selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   static inline typename DisableIf< IsSellMatrix<MT4> >::Type
+      selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       typedef typename MT4::ConstIterator  ConstIterator;
 
@@ -765,6 +925,37 @@ class SMatTDMatMultExpr : public DenseMatrix< SMatTDMatMultExpr<MT1,MT2>, false
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SELL subtraction assignment to dense matrices************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SELL subtraction assignment of a SELL matrix-transpose dense matrix multiplication
+   //        (\f$ C-=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side SELL matrix operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function implements the subtraction assignment kernel for the multiplication of a
+   // SELL matrix and a column-major dense matrix. The dense matrix is processed column by
+   // column via the SELL matrix-dense vector multiplication kernels.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< IsSellMatrix<MT4> >::Type
+      selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      typedef SellKernel<MT3,MT4,MT5>  Kernel;
+      typedef typename Kernel::TargetColumn   TargetColumn;
+      typedef typename Kernel::OperandColumn  OperandColumn;
+
+      const Kernel kernel( C, A, B, &MT4::template subAssignProduct<TargetColumn,OperandColumn> );
+      kernel( 0UL, A.chunks() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Restructuring subtraction assignment to row-major matrices**********************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Restructuring subtraction assignment of a sparse matrix-transpose dense matrix
@@ -846,6 +1037,78 @@ class SMatTDMatMultExpr : public DenseMatrix< SMatTDMatMultExpr<MT1,MT2>, false
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SELL SMP assignment to dense matrices********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a SELL matrix-transpose dense matrix multiplication
+   //        to a dense matrix (\f$ A=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the SMP assignment of a SELL matrix-transpose dense
+   // matrix multiplication expression to a dense matrix. The chunks of the SELL matrix are
+   // distributed among all available threads. Due to the explicit application of the SFINAE
+   // principle this function can only be selected by the compiler in case the left-hand side
+   // matrix operand is a SELL matrix and no symmetry can be exploited.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline typename EnableIf< UseSellKernel<MT,MT1,MT2> >::Type
+      smpAssign( DenseMatrix<MT,SO>& lhs, const SMatTDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      LT A( rhs.lhs_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.lhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( B.rows()    == rhs.rhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == rhs.rhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()     , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == (~lhs).columns()  , "Invalid number of columns" );
+
+      SMatTDMatMultExpr::selectSmpAssignKernel( ~lhs, A, B, rhs );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SELL SMP assignment kernel*******************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment kernel for a SELL matrix-transpose dense matrix
+   //        multiplication (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side SELL matrix operand.
+   // \param B The right-hand side multiplication operand.
+   // \param rhs The multiplication expression.
+   // \return void
+   //
+   // This function assigns the product of a SELL matrix and a column-major dense matrix chunk
+   // by chunk. The chunks are distributed among all available threads.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline void
+      selectSmpAssignKernel( MT3& C, const MT4& A, const MT5& B, const SMatTDMatMultExpr& rhs )
+   {
+      typedef SellKernel<MT3,MT4,MT5>  Kernel;
+      typedef typename Kernel::TargetColumn   TargetColumn;
+      typedef typename Kernel::OperandColumn  OperandColumn;
+
+      const Kernel kernel( C, A, B, &MT4::template assignProduct<TargetColumn,OperandColumn> );
+      smpSellAssign( rhs, kernel );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP assignment to sparse matrices***********************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief SMP assignment of a sparse matrix-transpose dense matrix multiplication to a sparse
@@ -956,6 +1219,78 @@ class SMatTDMatMultExpr : public DenseMatrix< SMatTDMatMultExpr<MT1,MT2>, false
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SELL SMP addition assignment to dense matrices***********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a SELL matrix-transpose dense matrix multiplication
+   //        to a dense matrix (\f$ A+=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the SMP addition assignment of a SELL matrix-transpose dense
+   // matrix multiplication expression to a dense matrix. The chunks of the SELL matrix are
+   // distributed among all available threads. Due to the explicit application of the SFINAE
+   // principle this function can only be selected by the compiler in case the left-hand side
+   // matrix operand is a SELL matrix and no symmetry can be exploited.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline typename EnableIf< UseSellKernel<MT,MT1,MT2> >::Type
+      smpAddAssign( DenseMatrix<MT,SO>& lhs, const SMatTDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      LT A( rhs.lhs_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.lhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( B.rows()    == rhs.rhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == rhs.rhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()     , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == (~lhs).columns()  , "Invalid number of columns" );
+
+      SMatTDMatMultExpr::selectSmpAddAssignKernel( ~lhs, A, B, rhs );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SELL SMP addition assignment kernel**********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment kernel for a SELL matrix-transpose dense matrix
+   //        multiplication (\f$ C+=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side SELL matrix operand.
+   // \param B The right-hand side multiplication operand.
+   // \param rhs The multiplication expression.
+   // \return void
+   //
+   // This function adds the product of a SELL matrix and a column-major dense matrix chunk
+   // by chunk. The chunks are distributed among all available threads.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline void
+      selectSmpAddAssignKernel( MT3& C, const MT4& A, const MT5& B, const SMatTDMatMultExpr& rhs )
+   {
+      typedef SellKernel<MT3,MT4,MT5>  Kernel;
+      typedef typename Kernel::TargetColumn   TargetColumn;
+      typedef typename Kernel::OperandColumn  OperandColumn;
+
+      const Kernel kernel( C, A, B, &MT4::template addAssignProduct<TargetColumn,OperandColumn> );
+      smpSellAssign( rhs, kernel );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Restructuring SMP addition assignment to row-major matrices*********************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Restructuring SMP addition assignment of a sparse matrix-transpose dense matrix
@@ -1030,6 +1365,78 @@ class SMatTDMatMultExpr : public DenseMatrix< SMatTDMatMultExpr<MT1,MT2>, false
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SELL SMP subtraction assignment to dense matrices********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a SELL matrix-transpose dense matrix multiplication
+   //        to a dense matrix (\f$ A-=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the SMP subtraction assignment of a SELL matrix-transpose dense
+   // matrix multiplication expression to a dense matrix. The chunks of the SELL matrix are
+   // distributed among all available threads. Due to the explicit application of the SFINAE
+   // principle this function can only be selected by the compiler in case the left-hand side
+   // matrix operand is a SELL matrix and no symmetry can be exploited.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline typename EnableIf< UseSellKernel<MT,MT1,MT2> >::Type
+      smpSubAssign( DenseMatrix<MT,SO>& lhs, const SMatTDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      LT A( rhs.lhs_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.lhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( B.rows()    == rhs.rhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == rhs.rhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()     , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == (~lhs).columns()  , "Invalid number of columns" );
+
+      SMatTDMatMultExpr::selectSmpSubAssignKernel( ~lhs, A, B, rhs );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SELL SMP subtraction assignment kernel*******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment kernel for a SELL matrix-transpose dense matrix
+   //        multiplication (\f$ C-=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side SELL matrix operand.
+   // \param B The right-hand side multiplication operand.
+   // \param rhs The multiplication expression.
+   // \return void
+   //
+   // This function subtracts the product of a SELL matrix and a column-major dense matrix chunk
+   // by chunk. The chunks are distributed among all available threads.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline void
+      selectSmpSubAssignKernel( MT3& C, const MT4& A, const MT5& B, const SMatTDMatMultExpr& rhs )
+   {
+      typedef SellKernel<MT3,MT4,MT5>  Kernel;
+      typedef typename Kernel::TargetColumn   TargetColumn;
+      typedef typename Kernel::OperandColumn  OperandColumn;
+
+      const Kernel kernel( C, A, B, &MT4::template subAssignProduct<TargetColumn,OperandColumn> );
+      smpSellAssign( rhs, kernel );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Restructuring SMP subtraction assignment to row-major matrices******************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Restructuring SMP subtraction assignment of a sparse matrix-transpose dense matrix
@@ -406,7 +406,7 @@ class SMatTSMatMultExpr : public SparseMatrix< SMatTSMatMultExpr<MT1,MT2>, false
    // \return \a true in case the expression can be used in SMP assignments, \a false if not.
    */
    inline bool canSMPAssign() const {
-      return ( rows() > SMP_SMATTSMATMULT_THRESHOLD );
+      return ( rows() > getThreshold( smpSMatTSMatMultThreshold ) );
    }
    //**********************************************************************************************
 
@@ -45,6 +45,7 @@
 #include <blaze/math/constraints/DenseMatrix.h>
 #include <blaze/math/constraints/MatMatMultExpr.h>
 #include <blaze/math/constraints/StorageOrder.h>
+#include <blaze/math/dense/MMM.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/Forward.h>
@@ -461,8 +462,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    */
    inline bool canSMPAssign() const {
       return ( !BLAZE_BLAS_IS_PARALLEL ||
-               ( rows() * columns() < TDMATDMATMULT_THRESHOLD ) ) &&
-             ( columns() > SMP_TDMATDMATMULT_THRESHOLD );
+               ( rows() * columns() < getThreshold( tdmatDMatMultThreshold ) ) ) &&
+             ( columns() > getThreshold( smpTDMatDMatMultThreshold ) );
    }
    //**********************************************************************************************
 
@@ -534,7 +535,7 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    static inline void selectAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       if( ( IsDiagonal<MT4>::value && IsDiagonal<MT5>::value ) ||
-          ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < getThreshold( tdmatDMatMultThreshold ) ) )
          selectSmallAssignKernel( C, A, B );
       else
          selectBlasAssignKernel( C, A, B );
@@ -1424,9 +1425,9 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    // \param B The right-hand side multiplication operand.
    // \return void
    //
-   // This function implements the vectorized default assignment of a transpose dense matrix-
-   // dense matrix multiplication expression to a row-major dense matrix. This kernel is
-   // optimized for large matrices.
+   // This function implements the vectorized default assignment of a transpose dense matrix-dense
+   // matrix multiplication expression to a row-major dense matrix. This kernel is optimized for
+   // large matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -1434,8 +1435,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallAssignKernel( ~C, A, B );
+      if( IsDiagonal<MT4>::value )
+         selectSmallAssignKernel( ~C, A, B );
+      else
+         mmm( ~C, A, B, ElementType(1), ElementType(0) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1451,9 +1454,9 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    // \param B The right-hand side multiplication operand.
    // \return void
    //
-   // This function implements the vectorized default assignment of a transpose dense matrix-
-   // dense matrix multiplication expression to a column-major dense matrix. This kernel is
-   // optimized for large matrices.
+   // This function implements the vectorized default assignment of a transpose dense matrix-dense
+   // matrix multiplication expression to a column-major dense matrix. This kernel is optimized for
+   // large matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -1461,8 +1464,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallAssignKernel( ~C, A, B );
+      if( IsDiagonal<MT4>::value )
+         selectSmallAssignKernel( ~C, A, B );
+      else
+         mmm( ~C, A, B, ElementType(1), ElementType(0) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1743,7 +1748,7 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    static inline void selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       if( ( IsDiagonal<MT4>::value && IsDiagonal<MT5>::value ) ||
-          ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < getThreshold( tdmatDMatMultThreshold ) ) )
          selectSmallAddAssignKernel( C, A, B );
       else
          selectBlasAddAssignKernel( C, A, B );
@@ -2620,8 +2625,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    // \return void
    //
    // This function implements the vectorized default addition assignment of a transpose dense
-   // matrix-dense matrix multiplication expression to a row-major dense matrix. This kernel
-   // is optimized for large matrices.
+   // matrix-dense matrix multiplication expression to a row-major dense matrix. This kernel is
+   // optimized for large matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -2629,8 +2634,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallAddAssignKernel( ~C, A, B );
+      if( IsDiagonal<MT4>::value )
+         selectSmallAddAssignKernel( ~C, A, B );
+      else
+         mmm( ~C, A, B, ElementType(1), ElementType(1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2647,8 +2654,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    // \return void
    //
    // This function implements the vectorized default addition assignment of a transpose dense
-   // matrix-dense matrix multiplication expression to a column-major dense matrix. This kernel
-   // is optimized for large matrices.
+   // matrix-dense matrix multiplication expression to a column-major dense matrix. This kernel is
+   // optimized for large matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -2656,8 +2663,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallAddAssignKernel( ~C, A, B );
+      if( IsDiagonal<MT4>::value )
+         selectSmallAddAssignKernel( ~C, A, B );
+      else
+         mmm( ~C, A, B, ElementType(1), ElementType(1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2913,7 +2922,7 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    static inline void selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       if( ( IsDiagonal<MT4>::value && IsDiagonal<MT5>::value ) ||
-          ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < getThreshold( tdmatDMatMultThreshold ) ) )
          selectSmallSubAssignKernel( C, A, B );
       else
          selectBlasSubAssignKernel( C, A, B );
@@ -3789,9 +3798,9 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    // \param B The right-hand side multiplication operand.
    // \return void
    //
-   // This function implements the vectorized default subtraction assignment of a transpose
-   // dense matrix-dense matrix multiplication expression to a row-major dense matrix. This
-   // kernel is optimized for large matrices.
+   // This function implements the vectorized default subtraction assignment of a transpose dense
+   // matrix-dense matrix multiplication expression to a row-major dense matrix. This kernel is
+   // optimized for large matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -3799,8 +3808,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallSubAssignKernel( ~C, A, B );
+      if( IsDiagonal<MT4>::value )
+         selectSmallSubAssignKernel( ~C, A, B );
+      else
+         mmm( ~C, A, B, ElementType(-1), ElementType(1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -3816,9 +3827,9 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    // \param B The right-hand side multiplication operand.
    // \return void
    //
-   // This function implements the vectorized default subtraction assignment of a transpose
-   // dense matrix-dense matrix multiplication expression to a column-major dense matrix.
-   // This kernel is optimized for large matrices.
+   // This function implements the vectorized default subtraction assignment of a transpose dense
+   // matrix-dense matrix multiplication expression to a column-major dense matrix. This kernel is
+   // optimized for large matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -3826,8 +3837,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallSubAssignKernel( ~C, A, B );
+      if( IsDiagonal<MT4>::value )
+         selectSmallSubAssignKernel( ~C, A, B );
+      else
+         mmm( ~C, A, B, ElementType(-1), ElementType(1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -4557,8 +4570,8 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
    inline bool canSMPAssign() const {
       typename MMM::RightOperand B( matrix_.rightOperand() );
       return ( !BLAZE_BLAS_IS_PARALLEL ||
-               ( rows() * columns() < TDMATDMATMULT_THRESHOLD ) ) &&
-             ( B.columns() > SMP_TDMATDMATMULT_THRESHOLD );
+               ( rows() * columns() < getThreshold( tdmatDMatMultThreshold ) ) ) &&
+             ( B.columns() > getThreshold( smpTDMatDMatMultThreshold ) );
    }
    //**********************************************************************************************
 
@@ -4632,7 +4645,7 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
    static inline void selectAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       if( ( IsDiagonal<MT4>::value && IsDiagonal<MT5>::value ) ||
-          ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < getThreshold( tdmatDMatMultThreshold ) ) )
          selectSmallAssignKernel( C, A, B, scalar );
       else
          selectBlasAssignKernel( C, A, B, scalar );
@@ -5541,9 +5554,9 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
    // \param scalar The scaling factor.
    // \return void
    //
-   // This function implements the vectorized default assignment of a scaled transpose dense
-   // matrix-dense matrix multiplication expression to a row-major dense matrix. This kernel
-   // is optimized for large matrices.
+   // This function implements the vectorized default assignment of a scaled transpose dense matrix-
+   // dense matrix multiplication expression to a row-major dense matrix. This kernel is optimized
+   // for large matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -5552,8 +5565,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallAssignKernel( ~C, A, B, scalar );
+      if( IsDiagonal<MT4>::value )
+         selectSmallAssignKernel( ~C, A, B, scalar );
+      else
+         mmm( ~C, A, B, scalar, ST2(0) );
    }
    //**********************************************************************************************
 
@@ -5568,9 +5583,9 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
    // \param scalar The scaling factor.
    // \return void
    //
-   // This function implements the vectorized default assignment of a scaled transpose dense
-   // matrix-dense matrix multiplication expression to a column-major dense matrix. This kernel
-   // is optimized for large matrices.
+   // This function implements the vectorized default assignment of a scaled transpose dense matrix-
+   // dense matrix multiplication expression to a column-major dense matrix. This kernel is
+   // optimized for large matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -5579,8 +5594,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallAssignKernel( ~C, A, B, scalar );
+      if( IsDiagonal<MT4>::value )
+         selectSmallAssignKernel( ~C, A, B, scalar );
+      else
+         mmm( ~C, A, B, scalar, ST2(0) );
    }
    //**********************************************************************************************
 
@@ -5860,7 +5877,7 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
    static inline void selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       if( ( IsDiagonal<MT4>::value && IsDiagonal<MT5>::value ) ||
-          ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < getThreshold( tdmatDMatMultThreshold ) ) )
          selectSmallAddAssignKernel( C, A, B, scalar );
       else
          selectBlasAddAssignKernel( C, A, B, scalar );
@@ -6618,8 +6635,8 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
    // \return void
    //
    // This function implements the vectorized default addition assignment of a scaled transpose
-   // dense matrix-dense matrix multiplication expression to a row-major dense matrix. This
-   // kernel is optimized for large matrices.
+   // dense matrix-dense matrix multiplication expression to a row-major dense matrix. This kernel
+   // is optimized for large matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -6628,8 +6645,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallAddAssignKernel( ~C, A, B, scalar );
+      if( IsDiagonal<MT4>::value )
+         selectSmallAddAssignKernel( ~C, A, B, scalar );
+      else
+         mmm( ~C, A, B, scalar, ST2(1) );
    }
    //**********************************************************************************************
 
@@ -6646,7 +6665,7 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
    //
    // This function implements the vectorized default addition assignment of a scaled transpose
    // dense matrix-dense matrix multiplication expression to a column-major dense matrix. This
-   // kernel is optimized for large matrices.
+   // kernel is optimized for large matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -6655,8 +6674,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallAddAssignKernel( ~C, A, B, scalar );
+      if( IsDiagonal<MT4>::value )
+         selectSmallAddAssignKernel( ~C, A, B, scalar );
+      else
+         mmm( ~C, A, B, scalar, ST2(1) );
    }
    //**********************************************************************************************
 
@@ -6913,7 +6934,7 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
    static inline void selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       if( ( IsDiagonal<MT4>::value && IsDiagonal<MT5>::value ) ||
-          ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < getThreshold( tdmatDMatMultThreshold ) ) )
          selectSmallSubAssignKernel( C, A, B, scalar );
       else
          selectBlasSubAssignKernel( C, A, B, scalar );
@@ -7671,7 +7692,7 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
    //
    // This function implements the vectorized default subtraction assignment of a scaled transpose
    // dense matrix-dense matrix multiplication expression to a row-major dense matrix. This kernel
-   // is optimized for large matrices.
+   // is optimized for large matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -7680,8 +7701,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallSubAssignKernel( ~C, A, B, scalar );
+      if( IsDiagonal<MT4>::value )
+         selectSmallSubAssignKernel( ~C, A, B, scalar );
+      else
+         mmm( ~C, A, B, ST2(-scalar), ST2(1) );
    }
    //**********************************************************************************************
 
@@ -7698,7 +7721,7 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
    //
    // This function implements the vectorized default subtraction assignment of a scaled transpose
    // dense matrix-dense matrix multiplication expression to a column-major dense matrix. This
-   // kernel is optimized for large matrices.
+   // kernel is optimized for large matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -7707,8 +7730,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallSubAssignKernel( ~C, A, B, scalar );
+      if( IsDiagonal<MT4>::value )
+         selectSmallSubAssignKernel( ~C, A, B, scalar );
+      else
+         mmm( ~C, A, B, ST2(-scalar), ST2(1) );
    }
    //**********************************************************************************************
 
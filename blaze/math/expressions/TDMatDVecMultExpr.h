@@ -47,6 +47,7 @@
 #include <blaze/math/constraints/MatVecMultExpr.h>
 #include <blaze/math/constraints/StorageOrder.h>
 #include <blaze/math/constraints/TransposeFlag.h>
+#include <blaze/math/dispatch/Level2.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/Forward.h>
@@ -422,8 +423,8 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
    inline bool canSMPAssign() const {
       return ( !BLAZE_BLAS_IS_PARALLEL ||
                ( IsComputation<MT>::value && !evaluateMatrix ) ||
-               ( mat_.rows() * mat_.columns() < TDMATDVECMULT_THRESHOLD ) ) &&
-             ( size() > SMP_TDMATDVECMULT_THRESHOLD );
+               ( mat_.rows() * mat_.columns() < getThreshold( tdmatDVecMultThreshold ) ) ) &&
+             ( size() > getThreshold( smpTDMatDVecMultThreshold ) );
    }
    //**********************************************************************************************
 
@@ -492,7 +493,7 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < TDMATDVECMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < getThreshold( tdmatDVecMultThreshold ) ) )
          selectSmallAssignKernel( y, A, x );
       else
          selectBlasAssignKernel( y, A, x );
@@ -893,6 +894,9 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
    //
    // This function relays to the default implementation of the assignment of a large transpose
    // dense matrix-dense vector multiplication expression to a dense vector.
+   //
+   // In case the runtime dispatch is active (see getInstructionSet()), the operation is
+   // relayed to the according dispatched kernel instead.
    */
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
@@ -900,7 +904,8 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
    static inline typename EnableIf< UseDefaultKernel<VT1,MT1,VT2> >::Type
       selectBlasAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
-      selectLargeAssignKernel( y, A, x );
+      if( !dispatchGemv( y, A, x, 1, 0 ) )
+         selectLargeAssignKernel( y, A, x );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1122,7 +1127,7 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < TDMATDVECMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < getThreshold( tdmatDVecMultThreshold ) ) )
          selectSmallAddAssignKernel( y, A, x );
       else
          selectBlasAddAssignKernel( y, A, x );
@@ -1520,6 +1525,9 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
    //
    // This function relays to the default implementation of the addition assignment of a large
    // transpose dense matrix-dense vector multiplication expression to a dense vector.
+   //
+   // In case the runtime dispatch is active (see getInstructionSet()), the operation is
+   // relayed to the according dispatched kernel instead.
    */
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
@@ -1527,7 +1535,8 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
    static inline typename EnableIf< UseDefaultKernel<VT1,MT1,VT2> >::Type
       selectBlasAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
-      selectLargeAddAssignKernel( y, A, x );
+      if( !dispatchGemv( y, A, x, 1, 1 ) )
+         selectLargeAddAssignKernel( y, A, x );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1727,7 +1736,7 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < TDMATDVECMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < getThreshold( tdmatDVecMultThreshold ) ) )
          selectSmallSubAssignKernel( y, A, x );
       else
          selectBlasSubAssignKernel( y, A, x );
@@ -2127,6 +2136,9 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
    //
    // This function relays to the default implementation of the subtraction assignment of a large
    // transpose dense matrix-dense vector multiplication expression to a dense vector.
+   //
+   // In case the runtime dispatch is active (see getInstructionSet()), the operation is
+   // relayed to the according dispatched kernel instead.
    */
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
@@ -2134,7 +2146,8 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
    static inline typename EnableIf< UseDefaultKernel<VT1,MT1,VT2> >::Type
       selectBlasSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
-      selectLargeSubAssignKernel( y, A, x );
+      if( !dispatchGemv( y, A, x, -1, 1 ) )
+         selectLargeSubAssignKernel( y, A, x );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2831,8 +2844,8 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
       typename MVM::LeftOperand A( vector_.leftOperand() );
       return ( !BLAZE_BLAS_IS_PARALLEL ||
                ( IsComputation<MT>::value && !evaluateMatrix ) ||
-               ( A.rows() * A.columns() < TDMATDVECMULT_THRESHOLD ) ) &&
-             ( size() > SMP_TDMATDVECMULT_THRESHOLD );
+               ( A.rows() * A.columns() < getThreshold( tdmatDVecMultThreshold ) ) ) &&
+             ( size() > getThreshold( smpTDMatDVecMultThreshold ) );
    }
    //**********************************************************************************************
 
@@ -2903,7 +2916,7 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < TDMATDVECMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < getThreshold( tdmatDVecMultThreshold ) ) )
          selectSmallAssignKernel( y, A, x, scalar );
       else
          selectBlasAssignKernel( y, A, x, scalar );
@@ -3313,6 +3326,9 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
    //
    // This function relays to the default implementation of the assignment of a large scaled
    // transpose dense matrix-dense vector multiplication expression to a dense vector.
+   //
+   // In case the runtime dispatch is active (see getInstructionSet()), the operation is
+   // relayed to the according dispatched kernel instead.
    */
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
@@ -3321,7 +3337,8 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
    static inline typename EnableIf< UseDefaultKernel<VT1,MT1,VT2,ST2> >::Type
       selectBlasAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
-      selectLargeAssignKernel( y, A, x, scalar );
+      if( !dispatchGemv( y, A, x, scalar, 0 ) )
+         selectLargeAssignKernel( y, A, x, scalar );
    }
    //**********************************************************************************************
 
@@ -3542,7 +3559,7 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < TDMATDVECMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < getThreshold( tdmatDVecMultThreshold ) ) )
          selectSmallAddAssignKernel( y, A, x, scalar );
       else
          selectBlasAddAssignKernel( y, A, x, scalar );
@@ -3906,6 +3923,9 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
    //
    // This function relays to the default implementation of the addition assignment of a large
    // scaled transpose dense matrix-dense vector multiplication expression to a dense vector.
+   //
+   // In case the runtime dispatch is active (see getInstructionSet()), the operation is
+   // relayed to the according dispatched kernel instead.
    */
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
@@ -3914,7 +3934,8 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
    static inline typename EnableIf< UseDefaultKernel<VT1,MT1,VT2,ST2> >::Type
       selectBlasAddAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
-      selectLargeAddAssignKernel( y, A, x, scalar );
+      if( !dispatchGemv( y, A, x, scalar, 1 ) )
+         selectLargeAddAssignKernel( y, A, x, scalar );
    }
    //**********************************************************************************************
 
@@ -4115,7 +4136,7 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < TDMATDVECMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < getThreshold( tdmatDVecMultThreshold ) ) )
          selectSmallSubAssignKernel( y, A, x, scalar );
       else
          selectBlasSubAssignKernel( y, A, x, scalar );
@@ -4478,6 +4499,9 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
    //
    // This function relays to the default implementation of the subtraction assignment of a large
    // scaled transpose dense matrix-dense vector multiplication expression to a dense vector.
+   //
+   // In case the runtime dispatch is active (see getInstructionSet()), the operation is
+   // relayed to the according dispatched kernel instead.
    */
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
@@ -4486,7 +4510,8 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
    static inline typename EnableIf< UseDefaultKernel<VT1,MT1,VT2,ST2> >::Type
       selectBlasSubAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
-      selectLargeSubAssignKernel( y, A, x, scalar );
+      if( !dispatchGemv( y, A, x, -scalar, 1 ) )
+         selectLargeSubAssignKernel( y, A, x, scalar );
    }
    //**********************************************************************************************
 
@@ -334,7 +334,7 @@ class TDMatSVecMultExpr : public DenseVector< TDMatSVecMultExpr<MT,VT>, false >
    // \return \a true in case the expression can be used in SMP assignments, \a false if not.
    */
    inline bool canSMPAssign() const {
-      return ( size() > SMP_TDMATSVECMULT_THRESHOLD );
+      return ( size() > getThreshold( smpTDMatSVecMultThreshold ) );
    }
    //**********************************************************************************************
 
@@ -46,6 +46,8 @@
 #include <blaze/math/constraints/MatMatMultExpr.h>
 #include <blaze/math/constraints/StorageOrder.h>
 #include <blaze/math/constraints/Symmetric.h>
+#include <blaze/math/dense/MMM.h>
+#include <blaze/math/dispatch/Level3.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/Forward.h>
@@ -473,8 +475,8 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    */
    inline bool canSMPAssign() const {
       return ( !BLAZE_BLAS_IS_PARALLEL ||
-               ( rows() * columns() < TDMATTDMATMULT_THRESHOLD ) ) &&
-             ( columns() > SMP_TDMATTDMATMULT_THRESHOLD );
+               ( rows() * columns() < getThreshold( tdmatTDMatMultThreshold ) ) ) &&
+             ( columns() > getThreshold( smpTDMatTDMatMultThreshold ) );
    }
    //**********************************************************************************************
 
@@ -547,7 +549,7 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    static inline void selectAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       if( ( IsDiagonal<MT4>::value ) ||
-          ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < getThreshold( tdmatTDMatMultThreshold ) ) )
          selectSmallAssignKernel( C, A, B );
       else
          selectBlasAssignKernel( C, A, B );
@@ -1083,8 +1085,8 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    // \return void
    //
    // This function implements the vectorized default assignment of a transpose dense matrix-
-   // transpose dense matrix multiplication expression to a row-major dense matrix. This kernel
-   // is optimized for large matrices.
+   // transpose dense matrix multiplication expression to a row-major dense matrix. This kernel is
+   // optimized for large matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -1092,7 +1094,10 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
-      selectSmallAssignKernel( ~C, A, B );
+      if( IsDiagonal<MT4>::value )
+         selectSmallAssignKernel( ~C, A, B );
+      else
+         mmm( ~C, A, B, ElementType(1), ElementType(0) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1109,8 +1114,8 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    // \return void
    //
    // This function implements the vectorized default assignment of a transpose dense matrix-
-   // transpose dense matrix multiplication expression to a column-major dense matrix. This
-   // kernel is optimized for large matrices.
+   // transpose dense matrix multiplication expression to a column-major dense matrix. This kernel
+   // is optimized for large matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -1118,8 +1123,10 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallAssignKernel( ~C, A, B );
+      if( IsDiagonal<MT4>::value )
+         selectSmallAssignKernel( ~C, A, B );
+      else
+         mmm( ~C, A, B, ElementType(1), ElementType(0) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1137,6 +1144,9 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    //
    // This function relays to the default implementation of the assignment of a large transpose
    // dense matrix-transpose dense matrix multiplication expression to a dense matrix.
+   //
+   // In case the runtime dispatch is active (see getInstructionSet()), the operation is
+   // relayed to the according dispatched kernel instead.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -1144,7 +1154,8 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    static inline typename EnableIf< UseDefaultKernel<MT3,MT4,MT5> >::Type
       selectBlasAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
-      selectLargeAssignKernel( C, A, B );
+      if( !dispatchGemm( C, A, B, 1, 0 ) )
+         selectLargeAssignKernel( C, A, B );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1438,7 +1449,7 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    static inline void selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       if( ( IsDiagonal<MT4>::value ) ||
-          ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < getThreshold( tdmatTDMatMultThreshold ) ) )
          selectSmallAddAssignKernel( C, A, B );
       else
          selectBlasAddAssignKernel( C, A, B );
@@ -1974,7 +1985,7 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    //
    // This function implements the vectorized default addition assignment of a transpose dense
    // matrix-transpose dense matrix multiplication expression to a row-major dense matrix. This
-   // kernel is optimized for large matrices.
+   // kernel is optimized for large matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -1982,7 +1993,10 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
-      selectSmallAddAssignKernel( ~C, A, B );
+      if( IsDiagonal<MT4>::value )
+         selectSmallAddAssignKernel( ~C, A, B );
+      else
+         mmm( ~C, A, B, ElementType(1), ElementType(1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1999,8 +2013,8 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    // \return void
    //
    // This function implements the vectorized default addition assignment of a transpose dense
-   // matrix-transpose dense matrix multiplication expression to a column-major dense matrix.
-   // This kernel is optimized for large matrices.
+   // matrix-transpose dense matrix multiplication expression to a column-major dense matrix. This
+   // kernel is optimized for large matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -2008,8 +2022,10 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallAddAssignKernel( ~C, A, B );
+      if( IsDiagonal<MT4>::value )
+         selectSmallAddAssignKernel( ~C, A, B );
+      else
+         mmm( ~C, A, B, ElementType(1), ElementType(1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2027,6 +2043,9 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    //
    // This function relays to the default implementation of the addition assignment of a large
    // transpose dense matrix-transpose dense matrix multiplication expression to a dense matrix.
+   //
+   // In case the runtime dispatch is active (see getInstructionSet()), the operation is
+   // relayed to the according dispatched kernel instead.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -2034,7 +2053,8 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    static inline typename EnableIf< UseDefaultKernel<MT3,MT4,MT5> >::Type
       selectBlasAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
-      selectLargeAddAssignKernel( C, A, B );
+      if( !dispatchGemm( C, A, B, 1, 1 ) )
+         selectLargeAddAssignKernel( C, A, B );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2302,7 +2322,7 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    static inline void selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       if( ( IsDiagonal<MT4>::value ) ||
-          ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < getThreshold( tdmatTDMatMultThreshold ) ) )
          selectSmallSubAssignKernel( C, A, B );
       else
          selectBlasSubAssignKernel( C, A, B );
@@ -2838,7 +2858,7 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    //
    // This function implements the vectorized default subtraction assignment of a transpose dense
    // matrix-transpose dense matrix multiplication expression to a row-major dense matrix. This
-   // kernel is optimized for large matrices.
+   // kernel is optimized for large matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -2846,7 +2866,10 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
-      selectSmallSubAssignKernel( ~C, A, B );
+      if( IsDiagonal<MT4>::value )
+         selectSmallSubAssignKernel( ~C, A, B );
+      else
+         mmm( ~C, A, B, ElementType(-1), ElementType(1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2863,8 +2886,8 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    // \return void
    //
    // This function implements the vectorized default subtraction assignment of a transpose dense
-   // matrix-transpose dense matrix multiplication expression to a column-major dense matrix.
-   // This kernel is optimized for large matrices.
+   // matrix-transpose dense matrix multiplication expression to a column-major dense matrix. This
+   // kernel is optimized for large matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -2872,8 +2895,10 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallSubAssignKernel( ~C, A, B );
+      if( IsDiagonal<MT4>::value )
+         selectSmallSubAssignKernel( ~C, A, B );
+      else
+         mmm( ~C, A, B, ElementType(-1), ElementType(1) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2891,6 +2916,9 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    //
    // This function relays to the default implementation of the subtraction assignment of a large
    // transpose dense matrix-transpose dense matrix multiplication expression to a dense matrix.
+   //
+   // In case the runtime dispatch is active (see getInstructionSet()), the operation is
+   // relayed to the according dispatched kernel instead.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -2898,7 +2926,8 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    static inline typename EnableIf< UseDefaultKernel<MT3,MT4,MT5> >::Type
       selectBlasSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
-      selectLargeSubAssignKernel( C, A, B );
+      if( !dispatchGemm( C, A, B, -1, 1 ) )
+         selectLargeSubAssignKernel( C, A, B );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -3763,8 +3792,8 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
    inline bool canSMPAssign() const {
       typename MMM::RightOperand B( matrix_.rightOperand() );
       return ( !BLAZE_BLAS_IS_PARALLEL ||
-               ( rows() * columns() < TDMATTDMATMULT_THRESHOLD ) ) &&
-             ( B.columns() > SMP_TDMATTDMATMULT_THRESHOLD );
+               ( rows() * columns() < getThreshold( tdmatTDMatMultThreshold ) ) ) &&
+             ( B.columns() > getThreshold( smpTDMatTDMatMultThreshold ) );
    }
    //**********************************************************************************************
 
@@ -3839,7 +3868,7 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
    static inline void selectAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       if( ( IsDiagonal<MT4>::value ) ||
-          ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < getThreshold( tdmatTDMatMultThreshold ) ) )
          selectSmallAssignKernel( C, A, B, scalar );
       else
          selectBlasAssignKernel( C, A, B, scalar );
@@ -4383,9 +4412,9 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
    // \param scalar The scaling factor.
    // \return void
    //
-   // This function implements the vectorized default assignment of a scaled transpose dense
-   // matrix-transpose dense matrix multiplication expression to a row-major dense matrix.
-   // This kernel is optimized for large matrices.
+   // This function implements the vectorized default assignment of a scaled transpose dense matrix-
+   // transpose dense matrix multiplication expression to a row-major dense matrix. This kernel is
+   // optimized for large matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -4394,7 +4423,10 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      selectSmallAssignKernel( ~C, A, B, scalar );
+      if( IsDiagonal<MT4>::value )
+         selectSmallAssignKernel( ~C, A, B, scalar );
+      else
+         mmm( ~C, A, B, scalar, ST2(0) );
    }
    //**********************************************************************************************
 
@@ -4409,9 +4441,9 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
    // \param scalar The scaling factor.
    // \return void
    //
-   // This function implements the vectorized default assignment of a scaled transpose dense
-   // matrix-transpose dense matrix multiplication expression to a column-major dense matrix.
-   // This kernel is optimized for large matrices.
+   // This function implements the vectorized default assignment of a scaled transpose dense matrix-
+   // transpose dense matrix multiplication expression to a column-major dense matrix. This kernel
+   // is optimized for large matrices and is based on the cache-blocked, packed mmm() kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -4420,8 +4452,10 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallAssignKernel( ~C, A, B, scalar );
+      if( IsDiagonal<MT4>::value )
+         selectSmallAssignKernel( ~C, A, B, scalar );
+      else
+         mmm( ~C, A, B, scalar, ST2(0) );
    }
    //**********************************************************************************************
 
@@ -4438,6 +4472,9 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
    //
    // This function relays to the default implementation of the assignment of a large scaled
    // transpose dense matrix-transpose dense matrix multiplication expression to a dense matrix.
+   //
+   // In case the runtime dispatch is active (see getInstructionSet()), the operation is
+   // relayed to the according dispatched kernel instead.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -4446,7 +4483,8 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
    static inline typename EnableIf< UseDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectBlasAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      selectLargeAssignKernel( C, A, B, scalar );
+      if( !dispatchGemm( C, A, B, scalar, 0 ) )
+         selectLargeAssignKernel( C, A, B, scalar );
    }
    //**********************************************************************************************
 
@@ -4739,7 +4777,7 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
    static inline void selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       if( ( IsDiagonal<MT4>::value ) ||
-          ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < getThreshold( tdmatTDMatMultThreshold ) ) )
          selectSmallAddAssignKernel( C, A, B, scalar );
       else
          selectBlasAddAssignKernel( C, A, B, scalar );
@@ -5228,7 +5266,8 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
    //
    // This function implements the vectorized default addition assignment of a scaled transpose
    // dense matrix-transpose dense matrix multiplication expression to a row-major dense matrix.
-   // This kernel is optimized for large matrices.
+   // This kernel is optimized for large matrices and is based on the cache-blocked, packed mmm()
+   // kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -5237,7 +5276,10 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      selectSmallAddAssignKernel( ~C, A, B, scalar );
+      if( IsDiagonal<MT4>::value )
+         selectSmallAddAssignKernel( ~C, A, B, scalar );
+      else
+         mmm( ~C, A, B, scalar, ST2(1) );
    }
    //**********************************************************************************************
 
@@ -5254,7 +5296,8 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
    //
    // This function implements the vectorized default addition assignment of a scaled transpose
    // dense matrix-transpose dense matrix multiplication expression to a column-major dense matrix.
-   // This kernel is optimized for large matrices.
+   // This kernel is optimized for large matrices and is based on the cache-blocked, packed mmm()
+   // kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -5263,8 +5306,10 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallAddAssignKernel( ~C, A, B, scalar );
+      if( IsDiagonal<MT4>::value )
+         selectSmallAddAssignKernel( ~C, A, B, scalar );
+      else
+         mmm( ~C, A, B, scalar, ST2(1) );
    }
    //**********************************************************************************************
 
@@ -5282,6 +5327,9 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
    // This function relays to the default implementation of the addition assignment of a large
    // scaled transpose dense matrix-transpose dense matrix multiplication expression to a dense
    // matrix.
+   //
+   // In case the runtime dispatch is active (see getInstructionSet()), the operation is
+   // relayed to the according dispatched kernel instead.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -5290,7 +5338,8 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
    static inline typename EnableIf< UseDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectBlasAddAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      selectLargeAddAssignKernel( C, A, B, scalar );
+      if( !dispatchGemm( C, A, B, scalar, 1 ) )
+         selectLargeAddAssignKernel( C, A, B, scalar );
    }
    //**********************************************************************************************
 
@@ -5560,7 +5609,7 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
    static inline void selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       if( ( IsDiagonal<MT4>::value ) ||
-          ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < getThreshold( tdmatTDMatMultThreshold ) ) )
          selectSmallSubAssignKernel( C, A, B, scalar );
       else
          selectBlasSubAssignKernel( C, A, B, scalar );
@@ -6049,7 +6098,8 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
    //
    // This function implements the vectorized default subtraction assignment of a scaled transpose
    // dense matrix-transpose dense matrix multiplication expression to a row-major dense matrix.
-   // This kernel is optimized for large matrices.
+   // This kernel is optimized for large matrices and is based on the cache-blocked, packed mmm()
+   // kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -6058,7 +6108,10 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      selectSmallSubAssignKernel( ~C, A, B, scalar );
+      if( IsDiagonal<MT4>::value )
+         selectSmallSubAssignKernel( ~C, A, B, scalar );
+      else
+         mmm( ~C, A, B, ST2(-scalar), ST2(1) );
    }
    //**********************************************************************************************
 
@@ -6075,7 +6128,8 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
    //
    // This function implements the vectorized default subtraction assignment of a scaled transpose
    // dense matrix-transpose dense matrix multiplication expression to a column-major dense matrix.
-   // This kernel is optimized for large matrices.
+   // This kernel is optimized for large matrices and is based on the cache-blocked, packed mmm()
+   // kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -6084,8 +6138,10 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallSubAssignKernel( ~C, A, B, scalar );
+      if( IsDiagonal<MT4>::value )
+         selectSmallSubAssignKernel( ~C, A, B, scalar );
+      else
+         mmm( ~C, A, B, ST2(-scalar), ST2(1) );
    }
    //**********************************************************************************************
 
@@ -6103,6 +6159,9 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
    // This function relays to the default implementation of the subtraction assignment of a large
    // scaled transpose dense matrix-transpose dense matrix multiplication expression to a dense
    // matrix.
+   //
+   // In case the runtime dispatch is active (see getInstructionSet()), the operation is
+   // relayed to the according dispatched kernel instead.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -6111,7 +6170,8 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
    static inline typename EnableIf< UseDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectBlasSubAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      selectLargeSubAssignKernel( C, A, B, scalar );
+      if( !dispatchGemm( C, A, B, -scalar, 1 ) )
+         selectLargeSubAssignKernel( C, A, B, scalar );
    }
    //**********************************************************************************************
 
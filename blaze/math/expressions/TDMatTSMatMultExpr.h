@@ -403,7 +403,7 @@ class TDMatTSMatMultExpr : public DenseMatrix< TDMatTSMatMultExpr<MT1,MT2>, true
    // \return \a true in case the expression can be used in SMP assignments, \a false if not.
    */
    inline bool canSMPAssign() const {
-      return ( columns() > SMP_TDMATTSMATMULT_THRESHOLD );
+      return ( columns() > getThreshold( smpTDMatTSMatMultThreshold ) );
    }
    //**********************************************************************************************
 
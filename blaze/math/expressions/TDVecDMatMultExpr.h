@@ -48,6 +48,7 @@
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/constraints/TransposeFlag.h>
 #include <blaze/math/constraints/TVecMatMultExpr.h>
+#include <blaze/math/dispatch/Level2.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/Forward.h>
@@ -423,8 +424,8 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
    inline bool canSMPAssign() const {
       return ( !BLAZE_BLAS_IS_PARALLEL ||
                ( IsComputation<MT>::value && !evaluateMatrix ) ||
-               ( mat_.rows() * mat_.columns() < TDVECDMATMULT_THRESHOLD ) ) &&
-             ( size() > SMP_TDVECDMATMULT_THRESHOLD );
+               ( mat_.rows() * mat_.columns() < getThreshold( tdvecDMatMultThreshold ) ) ) &&
+             ( size() > getThreshold( smpTDVecDMatMultThreshold ) );
    }
    //**********************************************************************************************
 
@@ -493,7 +494,7 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < getThreshold( tdvecDMatMultThreshold ) ) )
          selectSmallAssignKernel( y, x, A );
       else
          selectBlasAssignKernel( y, x, A );
@@ -894,6 +895,9 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
    //
    // This function relays to the default implementation of the assignment of a large transpose
    // dense vector-dense matrix multiplication expression to a dense vector.
+   //
+   // In case the runtime dispatch is active (see getInstructionSet()), the operation is
+   // relayed to the according dispatched kernel instead.
    */
    template< typename VT1    // Type of the left-hand side target vector
            , typename VT2    // Type of the left-hand side vector operand
@@ -901,7 +905,8 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
    static inline typename EnableIf< UseDefaultKernel<VT1,VT2,MT1> >::Type
       selectBlasAssignKernel( VT1& y, const VT2& x, const MT1& A )
    {
-      selectLargeAssignKernel( y, x, A );
+      if( !dispatchGemv( y, x, A, 1, 0 ) )
+         selectLargeAssignKernel( y, x, A );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1123,7 +1128,7 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < getThreshold( tdvecDMatMultThreshold ) ) )
          selectSmallAddAssignKernel( y, x, A );
       else
          selectBlasAddAssignKernel( y, x, A );
@@ -1521,6 +1526,9 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
    //
    // This function relays to the default implementation of the addition assignment of a large
    // transpose dense vector-dense matrix multiplication expression to a dense vector.
+   //
+   // In case the runtime dispatch is active (see getInstructionSet()), the operation is
+   // relayed to the according dispatched kernel instead.
    */
    template< typename VT1    // Type of the left-hand side target vector
            , typename VT2    // Type of the left-hand side vector operand
@@ -1528,7 +1536,8 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
    static inline typename EnableIf< UseDefaultKernel<VT1,VT2,MT1> >::Type
       selectBlasAddAssignKernel( VT1& y, const VT2& x, const MT1& A )
    {
-      selectLargeAddAssignKernel( y, x, A );
+      if( !dispatchGemv( y, x, A, 1, 1 ) )
+         selectLargeAddAssignKernel( y, x, A );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1728,7 +1737,7 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < getThreshold( tdvecDMatMultThreshold ) ) )
          selectSmallSubAssignKernel( y, x, A );
       else
          selectBlasSubAssignKernel( y, x, A );
@@ -2128,6 +2137,9 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
    //
    // This function relays to the default implementation of the subtraction assignment of a large
    // transpose dense vector-dense matrix multiplication expression to a dense vector.
+   //
+   // In case the runtime dispatch is active (see getInstructionSet()), the operation is
+   // relayed to the according dispatched kernel instead.
    */
    template< typename VT1    // Type of the left-hand side target vector
            , typename VT2    // Type of the left-hand side vector operand
@@ -2135,7 +2147,8 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
    static inline typename EnableIf< UseDefaultKernel<VT1,VT2,MT1> >::Type
       selectBlasSubAssignKernel( VT1& y, const VT2& x, const MT1& A )
    {
-      selectLargeSubAssignKernel( y, x, A );
+      if( !dispatchGemv( y, x, A, -1, 1 ) )
+         selectLargeSubAssignKernel( y, x, A );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2831,8 +2844,8 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
       typename VMM::RightOperand A( vector_.rightOperand() );
       return ( !BLAZE_BLAS_IS_PARALLEL ||
                ( IsComputation<MT>::value && !evaluateMatrix ) ||
-               ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) ) &&
-             ( size() > SMP_TDVECDMATMULT_THRESHOLD );
+               ( A.rows() * A.columns() < getThreshold( tdvecDMatMultThreshold ) ) ) &&
+             ( size() > getThreshold( smpTDVecDMatMultThreshold ) );
    }
    //**********************************************************************************************
 
@@ -2903,7 +2916,7 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < getThreshold( tdvecDMatMultThreshold ) ) )
          selectSmallAssignKernel( y, x, A, scalar );
       else
          selectBlasAssignKernel( y, x, A, scalar );
@@ -3311,6 +3324,9 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
    //
    // This function relays to the default implementation of the assignment of a large scaled
    // transpose dense vector-dense matrix multiplication expression to a dense vector.
+   //
+   // In case the runtime dispatch is active (see getInstructionSet()), the operation is
+   // relayed to the according dispatched kernel instead.
    */
    template< typename VT1    // Type of the left-hand side target vector
            , typename VT2    // Type of the left-hand side vector operand
@@ -3319,7 +3335,8 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
    static inline typename EnableIf< UseDefaultKernel<VT1,VT2,MT1,ST2> >::Type
       selectBlasAssignKernel( VT1& y, const VT2& x, const MT1& A, ST2 scalar )
    {
-      selectLargeAssignKernel( y, x, A, scalar );
+      if( !dispatchGemv( y, x, A, scalar, 0 ) )
+         selectLargeAssignKernel( y, x, A, scalar );
    }
    //**********************************************************************************************
 
@@ -3540,7 +3557,7 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < getThreshold( tdvecDMatMultThreshold ) ) )
          selectSmallAddAssignKernel( y, x, A, scalar );
       else
          selectBlasAddAssignKernel( y, x, A, scalar );
@@ -3904,6 +3921,9 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
    //
    // This function relays to the default implementation of the addition assignment of a large
    // scaled transpose dense vector-dense matrix multiplication expression to a dense vector.
+   //
+   // In case the runtime dispatch is active (see getInstructionSet()), the operation is
+   // relayed to the according dispatched kernel instead.
    */
    template< typename VT1    // Type of the left-hand side target vector
            , typename VT2    // Type of the left-hand side vector operand
@@ -3912,7 +3932,8 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
    static inline typename EnableIf< UseDefaultKernel<VT1,VT2,MT1,ST2> >::Type
       selectBlasAddAssignKernel( VT1& y, const VT2& x, const MT1& A, ST2 scalar )
    {
-      selectLargeAddAssignKernel( y, x, A, scalar );
+      if( !dispatchGemv( y, x, A, scalar, 1 ) )
+         selectLargeAddAssignKernel( y, x, A, scalar );
    }
    //**********************************************************************************************
 
@@ -4113,7 +4134,7 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < getThreshold( tdvecDMatMultThreshold ) ) )
          selectSmallSubAssignKernel( y, x, A, scalar );
       else
          selectBlasSubAssignKernel( y, x, A, scalar );
@@ -4477,6 +4498,9 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
    //
    // This function relays to the default implementation of the subtraction assignment of a large
    // scaled transpose dense vector-dense matrix multiplication expression to a dense vector.
+   //
+   // In case the runtime dispatch is active (see getInstructionSet()), the operation is
+   // relayed to the according dispatched kernel instead.
    */
    template< typename VT1    // Type of the left-hand side target vector
            , typename VT2    // Type of the left-hand side vector operand
@@ -4485,7 +4509,8 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
    static inline typename EnableIf< UseDefaultKernel<VT1,VT2,MT1,ST2> >::Type
       selectBlasSubAssignKernel( VT1& y, const VT2& x, const MT1& A, ST2 scalar )
    {
-      selectLargeSubAssignKernel( y, x, A, scalar );
+      if( !dispatchGemv( y, x, A, -scalar, 1 ) )
+         selectLargeSubAssignKernel( y, x, A, scalar );
    }
    //**********************************************************************************************
 
@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <stdexcept>
+#include <blaze/math/dispatch/Level1.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/Intrinsics.h>
 #include <blaze/math/traits/MultTrait.h>
@@ -181,7 +182,8 @@ inline typename DisableIf< TDVecDVecMultExprHelper<T1,T2>,
 // and \a T2 as well as the two element types \a T1::ElementType and \a T2::ElementType have
 // to be supported by the MultTrait class template.\n
 // In case the current sizes of the two given vectors don't match, a \a std::invalid_argument
-// is thrown.
+// is thrown. In case the runtime dispatch is active (see getInstructionSet()), the scalar product
+// is computed by the according dispatched kernel.
 */
 template< typename T1    // Type of the left-hand side dense vector
         , typename T2 >  // Type of the right-hand side dense vector
@@ -206,6 +208,11 @@ inline typename EnableIf< TDVecDVecMultExprHelper<T1,T2>,
    Lhs left ( ~lhs );
    Rhs right( ~rhs );
 
+   MultType sp;
+
+   if( dispatchDot( left, right, sp ) )
+      return sp;
+
    typename IT::Type xmm1, xmm2, xmm3, xmm4;
 
    const size_t N  ( left.size() );
@@ -218,7 +225,7 @@ inline typename EnableIf< TDVecDVecMultExprHelper<T1,T2>,
       xmm4 = xmm4 + ( left.load(i+IT::size*3UL) * right.load(i+IT::size*3UL) );
    }
 
-   MultType sp( sum( xmm1 + xmm2 + xmm3 + xmm4 ) );
+   sp = sum( xmm1 + xmm2 + xmm3 + xmm4 );
 
    for( size_t i=end; i<N; ++i )
       sp += left[i] * right[i];
@@ -268,7 +268,7 @@ class TDVecSMatMultExpr : public DenseVector< TDVecSMatMultExpr<VT,MT>, true >
    // \return \a true in case the expression can be used in SMP assignments, \a false if not.
    */
    inline bool canSMPAssign() const {
-      return ( size() > SMP_TDVECSMATMULT_THRESHOLD );
+      return ( size() > getThreshold( smpTDVecSMatMultThreshold ) );
    }
    //**********************************************************************************************
 
@@ -47,6 +47,7 @@
 #include <blaze/math/constraints/StorageOrder.h>
 #include <blaze/math/constraints/TransposeFlag.h>
 #include <blaze/math/constraints/TVecMatMultExpr.h>
+#include <blaze/math/dispatch/Level2.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/Forward.h>
@@ -421,8 +422,8 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
    inline bool canSMPAssign() const {
       return ( !BLAZE_BLAS_IS_PARALLEL ||
                ( IsComputation<MT>::value && !evaluateMatrix ) ||
-               ( mat_.rows() * mat_.columns() < TDVECTDMATMULT_THRESHOLD ) ) &&
-             ( size() > SMP_TDVECTDMATMULT_THRESHOLD );
+               ( mat_.rows() * mat_.columns() < getThreshold( tdvecTDMatMultThreshold ) ) ) &&
+             ( size() > getThreshold( smpTDVecTDMatMultThreshold ) );
    }
    //**********************************************************************************************
 
@@ -491,7 +492,7 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < TDVECTDMATMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < getThreshold( tdvecTDMatMultThreshold ) ) )
          selectSmallAssignKernel( y, x, A );
       else
          selectBlasAssignKernel( y, x, A );
@@ -910,6 +911,9 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
    //
    // This function relays to the default implementation of the assignment of a large transpose
    // dense vector-transpose dense matrix multiplication expression to a dense vector.
+   //
+   // In case the runtime dispatch is active (see getInstructionSet()), the operation is
+   // relayed to the according dispatched kernel instead.
    */
    template< typename VT1    // Type of the left-hand side target vector
            , typename VT2    // Type of the left-hand side vector operand
@@ -917,7 +921,8 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
    static inline typename EnableIf< UseDefaultKernel<VT1,VT2,MT1> >::Type
       selectBlasAssignKernel( VT1& y, const VT2& x, const MT1& A )
    {
-      selectLargeAssignKernel( y, x, A );
+      if( !dispatchGemv( y, x, A, 1, 0 ) )
+         selectLargeAssignKernel( y, x, A );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1139,7 +1144,7 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < TDVECTDMATMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < getThreshold( tdvecTDMatMultThreshold ) ) )
          selectSmallAddAssignKernel( y, x, A );
       else
          selectBlasAddAssignKernel( y, x, A );
@@ -1558,6 +1563,9 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
    //
    // This function relays to the default implementation of the addition assignment of a large
    // transpose dense vector-transpose dense matrix multiplication expression to a dense vector.
+   //
+   // In case the runtime dispatch is active (see getInstructionSet()), the operation is
+   // relayed to the according dispatched kernel instead.
    */
    template< typename VT1    // Type of the left-hand side target vector
            , typename VT2    // Type of the left-hand side vector operand
@@ -1565,7 +1573,8 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
    static inline typename EnableIf< UseDefaultKernel<VT1,VT2,MT1> >::Type
       selectBlasAddAssignKernel( VT1& y, const VT2& x, const MT1& A )
    {
-      selectLargeAddAssignKernel( y, x, A );
+      if( !dispatchGemv( y, x, A, 1, 1 ) )
+         selectLargeAddAssignKernel( y, x, A );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1765,7 +1774,7 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < TDVECTDMATMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < getThreshold( tdvecTDMatMultThreshold ) ) )
          selectSmallSubAssignKernel( y, x, A );
       else
          selectBlasSubAssignKernel( y, x, A );
@@ -2184,6 +2193,9 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
    //
    // This function relays to the default implementation of the subtraction assignment of a large
    // transpose dense vector-transpose dense matrix multiplication expression to a dense vector.
+   //
+   // In case the runtime dispatch is active (see getInstructionSet()), the operation is
+   // relayed to the according dispatched kernel instead.
    */
    template< typename VT1    // Type of the left-hand side target vector
            , typename VT2    // Type of the left-hand side vector operand
@@ -2191,7 +2203,8 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
    static inline typename EnableIf< UseDefaultKernel<VT1,VT2,MT1> >::Type
       selectBlasSubAssignKernel( VT1& y, const VT2& x, const MT1& A )
    {
-      selectLargeSubAssignKernel( y, x, A );
+      if( !dispatchGemv( y, x, A, -1, 1 ) )
+         selectLargeSubAssignKernel( y, x, A );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2887,8 +2900,8 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
       typename VMM::RightOperand A( vector_.rightOperand() );
       return ( !BLAZE_BLAS_IS_PARALLEL ||
                ( IsComputation<MT>::value && !evaluateMatrix ) ||
-               ( A.rows() * A.columns() < TDVECTDMATMULT_THRESHOLD ) ) &&
-             ( size() > SMP_TDVECTDMATMULT_THRESHOLD );
+               ( A.rows() * A.columns() < getThreshold( tdvecTDMatMultThreshold ) ) ) &&
+             ( size() > getThreshold( smpTDVecTDMatMultThreshold ) );
    }
    //**********************************************************************************************
 
@@ -2960,7 +2973,7 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < TDVECTDMATMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < getThreshold( tdvecTDMatMultThreshold ) ) )
          selectSmallAssignKernel( y, x, A, scalar );
       else
          selectBlasAssignKernel( y, x, A, scalar );
@@ -3398,6 +3411,9 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
    //
    // This function relays to the default implementation of the assignment of a large scaled
    // transpose dense vector-transpose dense matrix multiplication expression to a dense vector.
+   //
+   // In case the runtime dispatch is active (see getInstructionSet()), the operation is
+   // relayed to the according dispatched kernel instead.
    */
    template< typename VT1    // Type of the left-hand side target vector
            , typename VT2    // Type of the left-hand side vector operand
@@ -3406,7 +3422,8 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
    static inline typename EnableIf< UseDefaultKernel<VT1,VT2,MT1,ST2> >::Type
       selectBlasAssignKernel( VT1& y, const VT2& x, const MT1& A, ST2 scalar )
    {
-      selectLargeAssignKernel( y, x, A, scalar );
+      if( !dispatchGemv( y, x, A, scalar, 0 ) )
+         selectLargeAssignKernel( y, x, A, scalar );
    }
    //**********************************************************************************************
 
@@ -3631,7 +3648,7 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < getThreshold( tdvecDMatMultThreshold ) ) )
          selectSmallAddAssignKernel( y, x, A, scalar );
       else
          selectBlasAddAssignKernel( y, x, A, scalar );
@@ -4050,6 +4067,9 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
    // This function relays to the default implementation of the addition assignment of a large
    // scaled transpose dense vector-transpose dense matrix multiplication expression to a dense
    // vector.
+   //
+   // In case the runtime dispatch is active (see getInstructionSet()), the operation is
+   // relayed to the according dispatched kernel instead.
    */
    template< typename VT1    // Type of the left-hand side target vector
            , typename VT2    // Type of the left-hand side vector operand
@@ -4058,7 +4078,8 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
    static inline typename EnableIf< UseDefaultKernel<VT1,VT2,MT1,ST2> >::Type
       selectBlasAddAssignKernel( VT1& y, const VT2& x, const MT1& A, ST2 scalar )
    {
-      selectLargeAddAssignKernel( y, x, A, scalar );
+      if( !dispatchGemv( y, x, A, scalar, 1 ) )
+         selectLargeAddAssignKernel( y, x, A, scalar );
    }
    //**********************************************************************************************
 
@@ -4262,7 +4283,7 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < getThreshold( tdvecDMatMultThreshold ) ) )
          selectSmallSubAssignKernel( y, x, A, scalar );
       else
          selectBlasSubAssignKernel( y, x, A, scalar );
@@ -4681,6 +4702,9 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
    // This function relays to the default implementation of the subtraction assignment of a large
    // scaled transpose dense vector-transpose dense matrix multiplication expression to a dense
    // vector.
+   //
+   // In case the runtime dispatch is active (see getInstructionSet()), the operation is
+   // relayed to the according dispatched kernel instead.
    */
    template< typename VT1    // Type of the left-hand side target vector
            , typename VT2    // Type of the left-hand side vector operand
@@ -4689,7 +4713,8 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
    static inline typename EnableIf< UseDefaultKernel<VT1,VT2,MT1,ST2> >::Type
       selectBlasSubAssignKernel( VT1& y, const VT2& x, const MT1& A, ST2 scalar )
    {
-      selectLargeSubAssignKernel( y, x, A, scalar );
+      if( !dispatchGemv( y, x, A, -scalar, 1 ) )
+         selectLargeSubAssignKernel( y, x, A, scalar );
    }
    //**********************************************************************************************
 
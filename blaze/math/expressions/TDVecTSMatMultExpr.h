@@ -296,7 +296,7 @@ class TDVecTSMatMultExpr : public DenseVector< TDVecTSMatMultExpr<VT,MT>, true >
    // \return \a true in case the expression can be used in SMP assignments, \a false if not.
    */
    inline bool canSMPAssign() const {
-      return ( size() > SMP_TDVECTSMATMULT_THRESHOLD );
+      return ( size() > getThreshold( smpTDVecTSMatMultThreshold ) );
    }
    //**********************************************************************************************
 
@@ -352,7 +352,7 @@ class TSMatDMatMultExpr : public DenseMatrix< TSMatDMatMultExpr<MT1,MT2>, true >
    // \return \a true in case the expression can be used in SMP assignments, \a false if not.
    */
    inline bool canSMPAssign() const {
-      return ( columns() > SMP_TSMATDMATMULT_THRESHOLD );
+      return ( columns() > getThreshold( smpTSMatDMatMultThreshold ) );
    }
    //**********************************************************************************************
 
@@ -269,7 +269,7 @@ class TSMatDVecMultExpr : public DenseVector< TSMatDVecMultExpr<MT,VT>, false >
    // \return \a true in case the expression can be used in SMP assignments, \a false if not.
    */
    inline bool canSMPAssign() const {
-      return ( size() > SMP_TSMATDVECMULT_THRESHOLD );
+      return ( size() > getThreshold( smpTSMatDVecMultThreshold ) );
    }
    //**********************************************************************************************
 
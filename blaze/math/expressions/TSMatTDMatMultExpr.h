@@ -346,7 +346,7 @@ class TSMatTDMatMultExpr : public DenseMatrix< TSMatTDMatMultExpr<MT1,MT2>, true
    // \return \a true in case the expression can be used in SMP assignments, \a false if not.
    */
    inline bool canSMPAssign() const {
-      return ( columns() > SMP_TSMATTDMATMULT_THRESHOLD );
+      return ( columns() > getThreshold( smpTSMatTDMatMultThreshold ) );
    }
    //**********************************************************************************************
 
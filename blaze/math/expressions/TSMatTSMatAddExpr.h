@@ -66,6 +66,7 @@
 #include <blaze/math/typetraits/IsUpper.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/typetraits/Rows.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
@@ -290,12 +291,145 @@ class TSMatTSMatAddExpr : public SparseMatrix< TSMatTSMatAddExpr<MT1,MT2>, true
    }
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const {
+      return ( columns() > getThreshold( smpSMatSMatAddThreshold ) );
+   }
+   //**********************************************************************************************
+
  private:
    //**Member variables****************************************************************************
    LeftOperand  lhs_;  //!< Left-hand side sparse matrix of the addition expression.
    RightOperand rhs_;  //!< Right-hand side sparse matrix of the addition expression.
    //**********************************************************************************************
 
+   //**Column kernel*******************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Kernel for the computation of single columns of a transpose sparse matrix-transpose sparse matrix
+   //        addition.
+   //
+   // The ColumnKernel class computes single columns of a transpose sparse matrix-transpose sparse matrix addition by
+   // merging the according columns of the two operands. The nonZeros() function determines the exact
+   // number of non-zero elements of a column, the assign() function appends the non-zero elements
+   // of a column to a sparse matrix.
+   */
+   class ColumnKernel
+   {
+    private:
+      //**Type definitions*************************************************************************
+      typedef typename RemoveReference<CT1>::Type  Left;   //!< Type of the left-hand side operand.
+      typedef typename RemoveReference<CT2>::Type  Right;  //!< Type of the right-hand side operand.
+
+      typedef typename Left::ConstIterator   LeftIterator;   //!< Iterator over the left operand.
+      typedef typename Right::ConstIterator  RightIterator;  //!< Iterator over the right operand.
+      //*******************************************************************************************
+
+    public:
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the ColumnKernel class.
+      //
+      // \param A The evaluated left-hand side sparse matrix operand.
+      // \param B The evaluated right-hand side sparse matrix operand.
+      */
+      explicit inline ColumnKernel( const Left& A, const Right& B )
+         : A_( A )  // The evaluated left-hand side sparse matrix operand
+         , B_( B )  // The evaluated right-hand side sparse matrix operand
+      {}
+      //*******************************************************************************************
+
+      //**NonZeros function************************************************************************
+      /*!\brief Returns the exact number of non-zero elements in the specified column.
+      //
+      // \param j The index of the column.
+      // \return The number of non-zero elements in column \a j.
+      */
+      inline size_t nonZeros( size_t j ) const
+      {
+         const LeftIterator  lend( A_.end(j) );
+         const RightIterator rend( B_.end(j) );
+
+         LeftIterator  l( A_.begin(j) );
+         RightIterator r( B_.begin(j) );
+
+         size_t nonzeros( 0UL );
+
+         while( l != lend && r != rend )
+         {
+            if( l->index() < r->index() ) {
+               ++l;
+            }
+            else if( l->index() > r->index() ) {
+               ++r;
+            }
+            else {
+               ++l;
+               ++r;
+            }
+            ++nonzeros;
+         }
+
+         return nonzeros + size_t( lend - l ) + size_t( rend - r );
+      }
+      //*******************************************************************************************
+
+      //**Assign function**************************************************************************
+      /*!\brief Appends the non-zero elements of the specified column to the given sparse matrix.
+      //
+      // \param lhs The target left-hand side sparse matrix.
+      // \param j The index of the column.
+      // \return void
+      */
+      template< typename MT >  // Type of the target sparse matrix
+      inline void assign( MT& lhs, size_t j ) const
+      {
+         const LeftIterator  lend( A_.end(j) );
+         const RightIterator rend( B_.end(j) );
+
+         LeftIterator  l( A_.begin(j) );
+         RightIterator r( B_.begin(j) );
+
+         while( l != lend && r != rend )
+         {
+            if( l->index() < r->index() ) {
+               lhs.append( l->index(), j, l->value() );
+               ++l;
+            }
+            else if( l->index() > r->index() ) {
+               lhs.append( r->index(), j, r->value() );
+               ++r;
+            }
+            else {
+               lhs.append( l->index(), j, l->value()+r->value() );
+               ++l;
+               ++r;
+            }
+         }
+
+         while( l != lend ) {
+            lhs.append( l->index(), j, l->value() );
+            ++l;
+         }
+
+         while( r != rend ) {
+            lhs.append( r->index(), j, r->value() );
+            ++r;
+         }
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      const Left&  A_;  //!< The evaluated left-hand side sparse matrix operand.
+      const Right& B_;  //!< The evaluated right-hand side sparse matrix operand.
+      //*******************************************************************************************
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to dense matrices****************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a transpose sparse matrix-transpose sparse matrix addition to a
@@ -521,9 +655,6 @@ class TSMatTSMatAddExpr : public SparseMatrix< TSMatTSMatAddExpr<MT1,MT2>, true
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      typedef typename RemoveReference<CT1>::Type::ConstIterator  LeftIterator;
-      typedef typename RemoveReference<CT2>::Type::ConstIterator  RightIterator;
-
       CT1 A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side sparse matrix operand
       CT2 B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side sparse matrix operand
 
@@ -538,41 +669,10 @@ class TSMatTSMatAddExpr : public SparseMatrix< TSMatTSMatAddExpr<MT1,MT2>, true
       (~lhs).reserve( A.nonZeros() + B.nonZeros() );
 
       // Performing the matrix addition
-      for( size_t j=0UL; j<(~lhs).columns(); ++j )
-      {
-         const LeftIterator  lend( A.end(j) );
-         const RightIterator rend( B.end(j) );
-
-         LeftIterator  l( A.begin(j) );
-         RightIterator r( B.begin(j) );
-
-         while( l != lend && r != rend )
-         {
-            if( l->index() < r->index() ) {
-               (~lhs).append( l->index(), j, l->value() );
-               ++l;
-            }
-            else if( l->index() > r->index() ) {
-               (~lhs).append( r->index(), j, r->value() );
-               ++r;
-            }
-            else {
-               (~lhs).append( l->index(), j, l->value()+r->value() );
-               ++l;
-               ++r;
-            }
-         }
-
-         while( l != lend ) {
-            (~lhs).append( l->index(), j, l->value() );
-            ++l;
-         }
-
-         while( r != rend ) {
-            (~lhs).append( r->index(), j, r->value() );
-            ++r;
-         }
+      ColumnKernel kernel( A, B );
 
+      for( size_t j=0UL; j<(~lhs).columns(); ++j ) {
+         kernel.assign( ~lhs, j );
          (~lhs).finalize( j );
       }
    }
@@ -655,8 +755,41 @@ class TSMatTSMatAddExpr : public SparseMatrix< TSMatTSMatAddExpr<MT1,MT2>, true
    // No special implementation for the SMP assignment to dense matrices.
    //**********************************************************************************************
 
-   //**SMP assignment to sparse matrices***********************************************************
-   // No special implementation for the SMP assignment to sparse matrices.
+   //**SMP assignment to column-major sparse matrices**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a transpose sparse matrix-transpose sparse matrix addition to a
+   //        column-major sparse matrix.
+   // \ingroup sparse_matrix
+   //
+   // \param lhs The target left-hand side sparse matrix.
+   // \param rhs The right-hand side addition expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a transpose sparse matrix-transpose sparse matrix
+   // addition expression to a column-major sparse matrix. The columns of the result are computed in
+   // parallel by means of the column kernel of the addition.
+   */
+   template< typename MT >  // Type of the target sparse matrix
+   friend inline void smpAssign( SparseMatrix<MT,true>& lhs, const TSMatTSMatAddExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      CT1 A( rhs.lhs_ );  // Evaluation of the left-hand side sparse matrix operand
+      CT2 B( rhs.rhs_ );  // Evaluation of the right-hand side sparse matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.lhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( B.rows()    == rhs.rhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == rhs.rhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()     , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == (~lhs).columns()  , "Invalid number of columns" );
+
+      smpSparseAssign( ~lhs, rhs, ColumnKernel( A, B ) );
+   }
+   /*! \endcond */
    //**********************************************************************************************
 
    //**SMP addition assignment to dense matrices***************************************************
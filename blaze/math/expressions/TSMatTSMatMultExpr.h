@@ -352,7 +352,7 @@ class TSMatTSMatMultExpr : public SparseMatrix< TSMatTSMatMultExpr<MT1,MT2>, tru
    // \return \a true in case the expression can be used in SMP assignments, \a false if not.
    */
    inline bool canSMPAssign() const {
-      return ( rows() > SMP_TSMATTSMATMULT_THRESHOLD );
+      return ( rows() > getThreshold( smpTSMatTSMatMultThreshold ) );
    }
    //**********************************************************************************************
 
@@ -362,6 +362,175 @@ class TSMatTSMatMultExpr : public SparseMatrix< TSMatTSMatMultExpr<MT1,MT2>, tru
    RightOperand rhs_;  //!< Right-hand side sparse matrix of the multiplication expression.
    //**********************************************************************************************
 
+   //**Column kernel*******************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Kernel for the computation of single columns of a transpose sparse matrix-transpose
+   //        sparse matrix multiplication.
+   //
+   // The ColumnKernel class computes single columns of a transpose sparse matrix-transpose sparse
+   // matrix multiplication by means of a sparse accumulator. The nonZeros() function determines
+   // the exact number of non-zero elements of a column, the assign() function appends the non-zero
+   // elements of a column to a sparse matrix. Since every copy of the kernel uses its own
+   // accumulator, several copies can be used concurrently for different columns.
+   */
+   class ColumnKernel
+   {
+    private:
+      //**Type definitions*************************************************************************
+      typedef typename RemoveReference<CT1>::Type  Left;   //!< Type of the left-hand side operand.
+      typedef typename RemoveReference<CT2>::Type  Right;  //!< Type of the right-hand side operand.
+
+      typedef typename Left::ConstIterator   LeftIterator;   //!< Iterator over the left operand.
+      typedef typename Right::ConstIterator  RightIterator;  //!< Iterator over the right operand.
+      //*******************************************************************************************
+
+    public:
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the ColumnKernel class.
+      //
+      // \param A The evaluated left-hand side sparse matrix operand.
+      // \param B The evaluated right-hand side sparse matrix operand.
+      */
+      explicit inline ColumnKernel( const Left& A, const Right& B )
+         : A_      ( A )  // The evaluated left-hand side sparse matrix operand
+         , B_      ( B )  // The evaluated right-hand side sparse matrix operand
+         , values_ ()     // The accumulated values of the current column
+         , valid_  ()     // The validity flags of the accumulated values
+         , indices_()     // The row indices of the accumulated values
+      {}
+      //*******************************************************************************************
+
+      //**NonZeros function************************************************************************
+      /*!\brief Returns the exact number of non-zero elements in the specified column.
+      //
+      // \param j The index of the column.
+      // \return The number of non-zero elements in column \a j.
+      */
+      inline size_t nonZeros( size_t j )
+      {
+         init();
+
+         size_t nonzeros( 0UL );
+
+         const RightIterator rend( B_.end(j) );
+         for( RightIterator relem=B_.begin(j); relem!=rend; ++relem )
+         {
+            const LeftIterator lend( A_.end( relem->index() ) );
+            for( LeftIterator lelem=A_.begin( relem->index() ); lelem!=lend; ++lelem )
+            {
+               if( !valid_[lelem->index()] ) {
+                  valid_[lelem->index()] = 1;
+                  indices_[nonzeros] = lelem->index();
+                  ++nonzeros;
+               }
+            }
+         }
+
+         for( size_t i=0UL; i<nonzeros; ++i ) {
+            reset( valid_[indices_[i]] );
+         }
+
+         return nonzeros;
+      }
+      //*******************************************************************************************
+
+      //**Assign function**************************************************************************
+      /*!\brief Appends the non-zero elements of the specified column to the given sparse matrix.
+      //
+      // \param lhs The target left-hand side sparse matrix.
+      // \param j The index of the column.
+      // \return void
+      */
+      template< typename MT >  // Type of the target sparse matrix
+      inline void assign( MT& lhs, size_t j )
+      {
+         init();
+
+         size_t nonzeros( 0UL ), minIndex( inf ), maxIndex( 0UL );
+
+         const RightIterator rend( B_.end(j) );
+         for( RightIterator relem=B_.begin(j); relem!=rend; ++relem )
+         {
+            const LeftIterator lend( A_.end( relem->index() ) );
+            for( LeftIterator lelem=A_.begin( relem->index() ); lelem!=lend; ++lelem )
+            {
+               if( !valid_[lelem->index()] ) {
+                  values_[lelem->index()] = lelem->value() * relem->value();
+                  valid_ [lelem->index()] = 1;
+                  indices_[nonzeros] = lelem->index();
+                  ++nonzeros;
+                  if( lelem->index() < minIndex ) minIndex = lelem->index();
+                  if( lelem->index() > maxIndex ) maxIndex = lelem->index();
+               }
+               else {
+                  values_[lelem->index()] += lelem->value() * relem->value();
+               }
+            }
+         }
+
+         BLAZE_INTERNAL_ASSERT( nonzeros <= lhs.rows(), "Invalid number of non-zero elements" );
+
+         if( nonzeros == 0UL )
+            return;
+
+         BLAZE_INTERNAL_ASSERT( minIndex <= maxIndex, "Invalid index detected" );
+
+         if( ( nonzeros + nonzeros ) < ( maxIndex - minIndex ) )
+         {
+            std::sort( indices_.begin(), indices_.begin() + nonzeros );
+
+            for( size_t i=0UL; i<nonzeros; ++i )
+            {
+               const size_t index( indices_[i] );
+               if( !isDefault( values_[index] ) ) {
+                  lhs.append( index, j, values_[index] );
+                  reset( values_[index] );
+               }
+
+               reset( valid_[index] );
+            }
+         }
+         else {
+            for( size_t i=minIndex; i<=maxIndex; ++i )
+            {
+               if( !isDefault( values_[i] ) ) {
+                  lhs.append( i, j, values_[i] );
+                  reset( values_[i] );
+               }
+
+               reset( valid_[i] );
+            }
+         }
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Init function****************************************************************************
+      /*!\brief Allocates the sparse accumulator on first use.
+      //
+      // \return void
+      */
+      inline void init()
+      {
+         if( valid_.empty() ) {
+            values_ .resize( A_.rows(), ElementType() );
+            valid_  .resize( A_.rows(), 0   );
+            indices_.resize( A_.rows(), 0UL );
+         }
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      const Left&              A_;        //!< The evaluated left-hand side sparse matrix operand.
+      const Right&             B_;        //!< The evaluated right-hand side sparse matrix operand.
+      std::vector<ElementType> values_;   //!< The accumulated values of the current column.
+      std::vector<byte>        valid_;    //!< The validity flags of the accumulated values.
+      std::vector<size_t>      indices_;  //!< The row indices of the accumulated values.
+      //*******************************************************************************************
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to dense matrices****************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a transpose sparse matrix-transpose sparse matrix multiplication
@@ -497,7 +666,6 @@ class TSMatTSMatMultExpr : public SparseMatrix< TSMatTSMatMultExpr<MT1,MT2>, tru
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      typedef typename RemoveReference<CT1>::Type::ConstIterator  LeftIterator;
       typedef typename RemoveReference<CT2>::Type::ConstIterator  RightIterator;
 
       CT1 A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side sparse matrix operand
@@ -525,74 +693,12 @@ class TSMatTSMatMultExpr : public SparseMatrix< TSMatTSMatMultExpr<MT1,MT2>, tru
       }
 
       (~lhs).reserve( nonzeros );
-      nonzeros = 0UL;
 
       // Performing the matrix-matrix multiplication
-      std::vector<ElementType> values ( (~lhs).rows(), ElementType() );
-      std::vector<byte>        valid  ( (~lhs).rows(), 0   );
-      std::vector<size_t>      indices( (~lhs).rows(), 0UL );
-      size_t minIndex( inf ), maxIndex( 0UL );
-
-      for( size_t j=0UL; j<(~lhs).columns(); ++j )
-      {
-         const RightIterator rend( B.end(j) );
-         for( RightIterator relem=B.begin(j); relem!=rend; ++relem )
-         {
-            const LeftIterator lend( A.end( relem->index() ) );
-            for( LeftIterator lelem=A.begin( relem->index() ); lelem!=lend; ++lelem )
-            {
-               if( !valid[lelem->index()] ) {
-                  values[lelem->index()] = lelem->value() * relem->value();
-                  valid [lelem->index()] = 1;
-                  indices[nonzeros] = lelem->index();
-                  ++nonzeros;
-                  if( lelem->index() < minIndex ) minIndex = lelem->index();
-                  if( lelem->index() > maxIndex ) maxIndex = lelem->index();
-               }
-               else {
-                  values[lelem->index()] += lelem->value() * relem->value();
-               }
-            }
-         }
-
-         BLAZE_INTERNAL_ASSERT( nonzeros <= (~lhs).rows(), "Invalid number of non-zero elements" );
-
-         if( nonzeros > 0UL )
-         {
-            BLAZE_INTERNAL_ASSERT( minIndex <= maxIndex, "Invalid index detected" );
-
-            if( ( nonzeros + nonzeros ) < ( maxIndex - minIndex ) )
-            {
-               std::sort( indices.begin(), indices.begin() + nonzeros );
-
-               for( size_t i=0UL; i<nonzeros; ++i )
-               {
-                  const size_t index( indices[i] );
-                  if( !isDefault( values[index] ) ) {
-                     (~lhs).append( index, j, values[index] );
-                     reset( values[index] );
-                  }
-
-                  reset( valid [index] );
-               }
-            }
-            else {
-               for( size_t i=minIndex; i<=maxIndex; ++i )
-               {
-                  if( !isDefault( values[i] ) ) {
-                     (~lhs).append( i, j, values[i] );
-                     reset( values[i] );
-                  }
-
-                  reset( valid [i] );
-               }
-            }
-
-            nonzeros = 0UL;
-            minIndex = inf;
-            maxIndex = 0UL;
-         }
+      ColumnKernel kernel( A, B );
 
+      for( size_t j=0UL; j<(~lhs).columns(); ++j ) {
+         kernel.assign( ~lhs, j );
          (~lhs).finalize( j );
       }
    }
@@ -899,6 +1005,47 @@ class TSMatTSMatMultExpr : public SparseMatrix< TSMatTSMatMultExpr<MT1,MT2>, tru
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP assignment to column-major sparse matrices**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a transpose sparse matrix-transpose sparse matrix multiplication to
+   //        a column-major sparse matrix (\f$ C=A*B \f$).
+   // \ingroup sparse_matrix
+   //
+   // \param lhs The target left-hand side sparse matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a transpose sparse
+   // matrix-transpose sparse matrix multiplication expression to a column-major sparse matrix.
+   // The columns of the result are computed in parallel by means of the column kernel of the
+   // multiplication. Due to the explicit application of the SFINAE principle this function can
+   // only be selected by the compiler in case none of the two matrix operands requires an
+   // intermediate evaluation.
+   */
+   template< typename MT >  // Type of the target sparse matrix
+   friend inline typename DisableIf< IsEvaluationRequired<MT,MT1,MT2> >::Type
+      smpAssign( SparseMatrix<MT,true>& lhs, const TSMatTSMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      CT1 A( rhs.lhs_ );  // Evaluation of the left-hand side sparse matrix operand
+      CT2 B( rhs.rhs_ );  // Evaluation of the right-hand side sparse matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.lhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( B.rows()    == rhs.rhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == rhs.rhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()     , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == (~lhs).columns()  , "Invalid number of columns" );
+
+      smpSparseAssign( ~lhs, rhs, ColumnKernel( A, B ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Restructuring SMP assignment to row-major matrices******************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Restructuring SMP assignment of a transpose sparse matrix-transpose sparse matrix
@@ -335,7 +335,7 @@ class TSVecDMatMultExpr : public DenseVector< TSVecDMatMultExpr<VT,MT>, true >
    // \return \a true in case the expression can be used in SMP assignments, \a false if not.
    */
    inline bool canSMPAssign() const {
-      return ( size() > SMP_TSVECDMATMULT_THRESHOLD );
+      return ( size() > getThreshold( smpTSVecDMatMultThreshold ) );
    }
    //**********************************************************************************************
 
@@ -301,7 +301,7 @@ class TSVecTDMatMultExpr : public DenseVector< TSVecTDMatMultExpr<VT,MT>, true >
    // \return \a true in case the expression can be used in SMP assignments, \a false if not.
    */
    inline bool canSMPAssign() const {
-      return ( size() > SMP_TSVECTDMATMULT_THRESHOLD );
+      return ( size() > getThreshold( smpTSVecTDMatMultThreshold ) );
    }
    //**********************************************************************************************
 
@@ -315,7 +315,7 @@ class TSVecTSMatMultExpr : public SparseVector< TSVecTSMatMultExpr<VT,MT>, true
    // \return \a true in case the expression can be used in SMP assignments, \a false if not.
    */
    inline bool canSMPAssign() const {
-      return ( size() > SMP_TSVECSMATMULT_THRESHOLD );
+      return ( size() > getThreshold( smpTSVecSMatMultThreshold ) );
    }
    //**********************************************************************************************
 
@@ -0,0 +1,577 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/intrinsics/FMA.h
+//  \brief Header file for the intrinsic fused multiply-add functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_INTRINSICS_FMA_H_
+#define _BLAZE_MATH_INTRINSICS_FMA_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/intrinsics/BasicTypes.h>
+#include <blaze/math/intrinsics/Multiplication.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INTRINSIC FMADD FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Fused multiply-add of three vectors of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand of the multiplication.
+// \param b The right-hand side operand of the multiplication.
+// \param c The addend.
+// \return The result of the operation.
+//
+// This function computes \f$ a*b+c \f$. In case the FMA mode is enabled (see BLAZE_FMA_MODE),
+// the computation is performed by a single fused multiply-add instruction, which rounds only once.
+// Otherwise the multiply-add is emulated by a separate multiplication and addition.
+*/
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
+BLAZE_ALWAYS_INLINE sse_float_t
+   fmadd( const sse_float_t& a, const sse_float_t& b, const sse_float_t& c )
+{
+   return _mm512_fmadd_ps( a.value, b.value, c.value );
+}
+#elif BLAZE_FMA_MODE
+BLAZE_ALWAYS_INLINE sse_float_t
+   fmadd( const sse_float_t& a, const sse_float_t& b, const sse_float_t& c )
+{
+   return _mm256_fmadd_ps( a.value, b.value, c.value );
+}
+#elif BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_float_t
+   fmadd( const sse_float_t& a, const sse_float_t& b, const sse_float_t& c )
+{
+   return _mm256_add_ps( _mm256_mul_ps( a.value, b.value ), c.value );
+}
+#elif BLAZE_SSE_MODE
+BLAZE_ALWAYS_INLINE sse_float_t
+   fmadd( const sse_float_t& a, const sse_float_t& b, const sse_float_t& c )
+{
+   return _mm_add_ps( _mm_mul_ps( a.value, b.value ), c.value );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Fused multiply-add of three vectors of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand of the multiplication.
+// \param b The right-hand side operand of the multiplication.
+// \param c The addend.
+// \return The result of the operation.
+//
+// This function computes \f$ a*b+c \f$. In case the FMA mode is enabled (see BLAZE_FMA_MODE),
+// the computation is performed by a single fused multiply-add instruction, which rounds only once.
+// Otherwise the multiply-add is emulated by a separate multiplication and addition.
+*/
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
+BLAZE_ALWAYS_INLINE sse_double_t
+   fmadd( const sse_double_t& a, const sse_double_t& b, const sse_double_t& c )
+{
+   return _mm512_fmadd_pd( a.value, b.value, c.value );
+}
+#elif BLAZE_FMA_MODE
+BLAZE_ALWAYS_INLINE sse_double_t
+   fmadd( const sse_double_t& a, const sse_double_t& b, const sse_double_t& c )
+{
+   return _mm256_fmadd_pd( a.value, b.value, c.value );
+}
+#elif BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_double_t
+   fmadd( const sse_double_t& a, const sse_double_t& b, const sse_double_t& c )
+{
+   return _mm256_add_pd( _mm256_mul_pd( a.value, b.value ), c.value );
+}
+#elif BLAZE_SSE2_MODE
+BLAZE_ALWAYS_INLINE sse_double_t
+   fmadd( const sse_double_t& a, const sse_double_t& b, const sse_double_t& c )
+{
+   return _mm_add_pd( _mm_mul_pd( a.value, b.value ), c.value );
+}
+#endif
+//*************************************************************************************************
+
+
+
+//=================================================================================================
+//
+//  INTRINSIC FMSUB FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Fused multiply-subtract of three vectors of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand of the multiplication.
+// \param b The right-hand side operand of the multiplication.
+// \param c The subtrahend.
+// \return The result of the operation.
+//
+// This function computes \f$ a*b-c \f$. In case the FMA mode is enabled (see BLAZE_FMA_MODE),
+// the computation is performed by a single fused multiply-subtract instruction, which rounds only
+// once. Otherwise the operation is emulated by a separate multiplication and subtraction.
+*/
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
+BLAZE_ALWAYS_INLINE sse_float_t
+   fmsub( const sse_float_t& a, const sse_float_t& b, const sse_float_t& c )
+{
+   return _mm512_fmsub_ps( a.value, b.value, c.value );
+}
+#elif BLAZE_FMA_MODE
+BLAZE_ALWAYS_INLINE sse_float_t
+   fmsub( const sse_float_t& a, const sse_float_t& b, const sse_float_t& c )
+{
+   return _mm256_fmsub_ps( a.value, b.value, c.value );
+}
+#elif BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_float_t
+   fmsub( const sse_float_t& a, const sse_float_t& b, const sse_float_t& c )
+{
+   return _mm256_sub_ps( _mm256_mul_ps( a.value, b.value ), c.value );
+}
+#elif BLAZE_SSE_MODE
+BLAZE_ALWAYS_INLINE sse_float_t
+   fmsub( const sse_float_t& a, const sse_float_t& b, const sse_float_t& c )
+{
+   return _mm_sub_ps( _mm_mul_ps( a.value, b.value ), c.value );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Fused multiply-subtract of three vectors of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand of the multiplication.
+// \param b The right-hand side operand of the multiplication.
+// \param c The subtrahend.
+// \return The result of the operation.
+//
+// This function computes \f$ a*b-c \f$. In case the FMA mode is enabled (see BLAZE_FMA_MODE),
+// the computation is performed by a single fused multiply-subtract instruction, which rounds only
+// once. Otherwise the operation is emulated by a separate multiplication and subtraction.
+*/
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
+BLAZE_ALWAYS_INLINE sse_double_t
+   fmsub( const sse_double_t& a, const sse_double_t& b, const sse_double_t& c )
+{
+   return _mm512_fmsub_pd( a.value, b.value, c.value );
+}
+#elif BLAZE_FMA_MODE
+BLAZE_ALWAYS_INLINE sse_double_t
+   fmsub( const sse_double_t& a, const sse_double_t& b, const sse_double_t& c )
+{
+   return _mm256_fmsub_pd( a.value, b.value, c.value );
+}
+#elif BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_double_t
+   fmsub( const sse_double_t& a, const sse_double_t& b, const sse_double_t& c )
+{
+   return _mm256_sub_pd( _mm256_mul_pd( a.value, b.value ), c.value );
+}
+#elif BLAZE_SSE2_MODE
+BLAZE_ALWAYS_INLINE sse_double_t
+   fmsub( const sse_double_t& a, const sse_double_t& b, const sse_double_t& c )
+{
+   return _mm_sub_pd( _mm_mul_pd( a.value, b.value ), c.value );
+}
+#endif
+//*************************************************************************************************
+
+
+
+//=================================================================================================
+//
+//  INTRINSIC FNMADD FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Fused negative multiply-add of three vectors of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand of the multiplication.
+// \param b The right-hand side operand of the multiplication.
+// \param c The minuend.
+// \return The result of the operation.
+//
+// This function computes \f$ c-a*b \f$. In case the FMA mode is enabled (see BLAZE_FMA_MODE),
+// the computation is performed by a single fused negative multiply-add instruction, which rounds
+// only once. Otherwise the operation is emulated by a separate multiplication and subtraction.
+*/
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
+BLAZE_ALWAYS_INLINE sse_float_t
+   fnmadd( const sse_float_t& a, const sse_float_t& b, const sse_float_t& c )
+{
+   return _mm512_fnmadd_ps( a.value, b.value, c.value );
+}
+#elif BLAZE_FMA_MODE
+BLAZE_ALWAYS_INLINE sse_float_t
+   fnmadd( const sse_float_t& a, const sse_float_t& b, const sse_float_t& c )
+{
+   return _mm256_fnmadd_ps( a.value, b.value, c.value );
+}
+#elif BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_float_t
+   fnmadd( const sse_float_t& a, const sse_float_t& b, const sse_float_t& c )
+{
+   return _mm256_sub_ps( c.value, _mm256_mul_ps( a.value, b.value ) );
+}
+#elif BLAZE_SSE_MODE
+BLAZE_ALWAYS_INLINE sse_float_t
+   fnmadd( const sse_float_t& a, const sse_float_t& b, const sse_float_t& c )
+{
+   return _mm_sub_ps( c.value, _mm_mul_ps( a.value, b.value ) );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Fused negative multiply-add of three vectors of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand of the multiplication.
+// \param b The right-hand side operand of the multiplication.
+// \param c The minuend.
+// \return The result of the operation.
+//
+// This function computes \f$ c-a*b \f$. In case the FMA mode is enabled (see BLAZE_FMA_MODE),
+// the computation is performed by a single fused negative multiply-add instruction, which rounds
+// only once. Otherwise the operation is emulated by a separate multiplication and subtraction.
+*/
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
+BLAZE_ALWAYS_INLINE sse_double_t
+   fnmadd( const sse_double_t& a, const sse_double_t& b, const sse_double_t& c )
+{
+   return _mm512_fnmadd_pd( a.value, b.value, c.value );
+}
+#elif BLAZE_FMA_MODE
+BLAZE_ALWAYS_INLINE sse_double_t
+   fnmadd( const sse_double_t& a, const sse_double_t& b, const sse_double_t& c )
+{
+   return _mm256_fnmadd_pd( a.value, b.value, c.value );
+}
+#elif BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_double_t
+   fnmadd( const sse_double_t& a, const sse_double_t& b, const sse_double_t& c )
+{
+   return _mm256_sub_pd( c.value, _mm256_mul_pd( a.value, b.value ) );
+}
+#elif BLAZE_SSE2_MODE
+BLAZE_ALWAYS_INLINE sse_double_t
+   fnmadd( const sse_double_t& a, const sse_double_t& b, const sse_double_t& c )
+{
+   return _mm_sub_pd( c.value, _mm_mul_pd( a.value, b.value ) );
+}
+#endif
+//*************************************************************************************************
+
+
+
+//=================================================================================================
+//
+//  FUSED INTRINSIC ADDITION/SUBTRACTION OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\fn sse_float_t operator+( sse_float_mult_t, sse_float_t )
+// \brief Addition of a multiplication expression and a vector of single precision values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The result of the addition.
+//
+// This operator is only available in case the FMA mode is enabled. It combines the pending
+// multiplication and the addition into a single fused multiply-add instruction.
+*/
+#if BLAZE_FMA_MODE
+BLAZE_ALWAYS_INLINE sse_float_t operator+( const sse_float_mult_t& a, const sse_float_t& b )
+{
+   return fmadd( a.a_, a.b_, b );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_float_t operator+( sse_float_t, sse_float_mult_t )
+// \brief Addition of a vector of single precision values and a multiplication expression.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The result of the addition.
+//
+// This operator is only available in case the FMA mode is enabled. It combines the pending
+// multiplication and the addition into a single fused multiply-add instruction.
+*/
+#if BLAZE_FMA_MODE
+BLAZE_ALWAYS_INLINE sse_float_t operator+( const sse_float_t& a, const sse_float_mult_t& b )
+{
+   return fmadd( b.a_, b.b_, a );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_float_t operator+( sse_float_mult_t, sse_float_mult_t )
+// \brief Addition of two multiplication expressions of single precision values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The result of the addition.
+//
+// This operator is only available in case the FMA mode is enabled. It combines the pending
+// multiplication and the addition into a single fused multiply-add instruction.
+*/
+#if BLAZE_FMA_MODE
+BLAZE_ALWAYS_INLINE sse_float_t operator+( const sse_float_mult_t& a, const sse_float_mult_t& b )
+{
+   return fmadd( a.a_, a.b_, b.eval() );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_float_t operator-( sse_float_mult_t, sse_float_t )
+// \brief Subtraction of a vector of single precision values from a multiplication expression.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The result of the subtraction.
+//
+// This operator is only available in case the FMA mode is enabled. It combines the pending
+// multiplication and the subtraction into a single fused multiply-add instruction.
+*/
+#if BLAZE_FMA_MODE
+BLAZE_ALWAYS_INLINE sse_float_t operator-( const sse_float_mult_t& a, const sse_float_t& b )
+{
+   return fmsub( a.a_, a.b_, b );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_float_t operator-( sse_float_t, sse_float_mult_t )
+// \brief Subtraction of a multiplication expression from a vector of single precision values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The result of the subtraction.
+//
+// This operator is only available in case the FMA mode is enabled. It combines the pending
+// multiplication and the subtraction into a single fused multiply-add instruction.
+*/
+#if BLAZE_FMA_MODE
+BLAZE_ALWAYS_INLINE sse_float_t operator-( const sse_float_t& a, const sse_float_mult_t& b )
+{
+   return fnmadd( b.a_, b.b_, a );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_float_t operator-( sse_float_mult_t, sse_float_mult_t )
+// \brief Subtraction of two multiplication expressions of single precision values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The result of the subtraction.
+//
+// This operator is only available in case the FMA mode is enabled. It combines the pending
+// multiplication and the subtraction into a single fused multiply-add instruction.
+*/
+#if BLAZE_FMA_MODE
+BLAZE_ALWAYS_INLINE sse_float_t operator-( const sse_float_mult_t& a, const sse_float_mult_t& b )
+{
+   return fmsub( a.a_, a.b_, b.eval() );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_double_t operator+( sse_double_mult_t, sse_double_t )
+// \brief Addition of a multiplication expression and a vector of double precision values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The result of the addition.
+//
+// This operator is only available in case the FMA mode is enabled. It combines the pending
+// multiplication and the addition into a single fused multiply-add instruction.
+*/
+#if BLAZE_FMA_MODE
+BLAZE_ALWAYS_INLINE sse_double_t operator+( const sse_double_mult_t& a, const sse_double_t& b )
+{
+   return fmadd( a.a_, a.b_, b );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_double_t operator+( sse_double_t, sse_double_mult_t )
+// \brief Addition of a vector of double precision values and a multiplication expression.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The result of the addition.
+//
+// This operator is only available in case the FMA mode is enabled. It combines the pending
+// multiplication and the addition into a single fused multiply-add instruction.
+*/
+#if BLAZE_FMA_MODE
+BLAZE_ALWAYS_INLINE sse_double_t operator+( const sse_double_t& a, const sse_double_mult_t& b )
+{
+   return fmadd( b.a_, b.b_, a );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_double_t operator+( sse_double_mult_t, sse_double_mult_t )
+// \brief Addition of two multiplication expressions of double precision values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The result of the addition.
+//
+// This operator is only available in case the FMA mode is enabled. It combines the pending
+// multiplication and the addition into a single fused multiply-add instruction.
+*/
+#if BLAZE_FMA_MODE
+BLAZE_ALWAYS_INLINE sse_double_t operator+( const sse_double_mult_t& a, const sse_double_mult_t& b )
+{
+   return fmadd( a.a_, a.b_, b.eval() );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_double_t operator-( sse_double_mult_t, sse_double_t )
+// \brief Subtraction of a vector of double precision values from a multiplication expression.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The result of the subtraction.
+//
+// This operator is only available in case the FMA mode is enabled. It combines the pending
+// multiplication and the subtraction into a single fused multiply-add instruction.
+*/
+#if BLAZE_FMA_MODE
+BLAZE_ALWAYS_INLINE sse_double_t operator-( const sse_double_mult_t& a, const sse_double_t& b )
+{
+   return fmsub( a.a_, a.b_, b );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_double_t operator-( sse_double_t, sse_double_mult_t )
+// \brief Subtraction of a multiplication expression from a vector of double precision values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The result of the subtraction.
+//
+// This operator is only available in case the FMA mode is enabled. It combines the pending
+// multiplication and the subtraction into a single fused multiply-add instruction.
+*/
+#if BLAZE_FMA_MODE
+BLAZE_ALWAYS_INLINE sse_double_t operator-( const sse_double_t& a, const sse_double_mult_t& b )
+{
+   return fnmadd( b.a_, b.b_, a );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_double_t operator-( sse_double_mult_t, sse_double_mult_t )
+// \brief Subtraction of two multiplication expressions of double precision values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The result of the subtraction.
+//
+// This operator is only available in case the FMA mode is enabled. It combines the pending
+// multiplication and the subtraction into a single fused multiply-add instruction.
+*/
+#if BLAZE_FMA_MODE
+BLAZE_ALWAYS_INLINE sse_double_t operator-( const sse_double_mult_t& a, const sse_double_mult_t& b )
+{
+   return fmsub( a.a_, a.b_, b.eval() );
+}
+#endif
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
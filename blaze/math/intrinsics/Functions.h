@@ -43,8 +43,14 @@
 #include <blaze/math/intrinsics/Abs.h>
 #include <blaze/math/intrinsics/Addition.h>
 #include <blaze/math/intrinsics/Division.h>
+#include <blaze/math/intrinsics/FMA.h>
+#include <blaze/math/intrinsics/Gather.h>
 #include <blaze/math/intrinsics/Load.h>
 #include <blaze/math/intrinsics/Loadu.h>
+#include <blaze/math/intrinsics/Maskloadu.h>
+#include <blaze/math/intrinsics/Maskstoreu.h>
+#include <blaze/math/intrinsics/Maximum.h>
+#include <blaze/math/intrinsics/Minimum.h>
 #include <blaze/math/intrinsics/Multiplication.h>
 #include <blaze/math/intrinsics/Reduction.h>
 #include <blaze/math/intrinsics/Set.h>
@@ -0,0 +1,186 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/intrinsics/Gather.h
+//  \brief Header file for the intrinsic gather functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_INTRINSICS_GATHER_H_
+#define _BLAZE_MATH_INTRINSICS_GATHER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/intrinsics/BasicTypes.h>
+#include <blaze/math/intrinsics/IntrinsicTrait.h>
+#include <blaze/math/intrinsics/Loadu.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INTRINSIC GATHER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'float' values.
+// \ingroup intrinsics
+//
+// \param address The base address of the 'float' values.
+// \param indices The indices of the values to be loaded, relative to \a address.
+// \return The vector of the gathered 'float' values.
+//
+// This function loads the values \a address[indices[0]], \a address[indices[1]], ... into a
+// single vector. In case the AVX2 or AVX-512 mode is enabled, the values are loaded by means of
+// gather instructions, else they are loaded one by one.
+*/
+BLAZE_ALWAYS_INLINE sse_float_t gather( const float* address, const size_t* indices )
+{
+#if BLAZE_AVX512F_MODE
+   const __m256 v1( _mm512_i64gather_ps( _mm512_loadu_si512( indices     ), address, 4 ) );
+   const __m256 v2( _mm512_i64gather_ps( _mm512_loadu_si512( indices+8UL ), address, 4 ) );
+   const __m512d v3( _mm512_insertf64x4( _mm512_setzero_pd(), _mm256_castps_pd( v1 ), 0 ) );
+   return _mm512_castpd_ps( _mm512_insertf64x4( v3, _mm256_castps_pd( v2 ), 1 ) );
+#elif BLAZE_AVX2_MODE
+   const __m256i* i( reinterpret_cast<const __m256i*>( indices ) );
+   const __m128 v1( _mm256_i64gather_ps( address, _mm256_loadu_si256( i     ), 4 ) );
+   const __m128 v2( _mm256_i64gather_ps( address, _mm256_loadu_si256( i+1UL ), 4 ) );
+   return _mm256_insertf128_ps( _mm256_castps128_ps256( v1 ), v2, 1 );
+#else
+   float tmp[IntrinsicTrait<float>::size];
+   for( size_t i=0UL; i<IntrinsicTrait<float>::size; ++i )
+      tmp[i] = address[indices[i]];
+   return loadu( tmp );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'double' values.
+// \ingroup intrinsics
+//
+// \param address The base address of the 'double' values.
+// \param indices The indices of the values to be loaded, relative to \a address.
+// \return The vector of the gathered 'double' values.
+//
+// This function loads the values \a address[indices[0]], \a address[indices[1]], ... into a
+// single vector. In case the AVX2 or AVX-512 mode is enabled, the values are loaded by means of
+// gather instructions, else they are loaded one by one.
+*/
+BLAZE_ALWAYS_INLINE sse_double_t gather( const double* address, const size_t* indices )
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_i64gather_pd( _mm512_loadu_si512( indices ), address, 8 );
+#elif BLAZE_AVX2_MODE
+   const __m256i i( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( indices ) ) );
+   return _mm256_i64gather_pd( address, i, 8 );
+#else
+   double tmp[IntrinsicTrait<double>::size];
+   for( size_t i=0UL; i<IntrinsicTrait<double>::size; ++i )
+      tmp[i] = address[indices[i]];
+   return loadu( tmp );
+#endif
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'float' values by means of 32-bit indices.
+// \ingroup intrinsics
+//
+// \param address The base address of the 'float' values.
+// \param indices The indices of the values to be loaded, relative to \a address.
+// \return The vector of the gathered 'float' values.
+//
+// This function loads the values \a address[indices[0]], \a address[indices[1]], ... into a
+// single vector. In case the AVX2 or AVX-512 mode is enabled, the values are loaded by means of
+// gather instructions with 32-bit indices, else they are loaded one by one. Note that the gather
+// instructions interpret the indices as signed integers, i.e. all indices must be smaller than
+// \f$ 2^{31} \f$.
+*/
+BLAZE_ALWAYS_INLINE sse_float_t gather( const float* address, const unsigned int* indices )
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_i32gather_ps( _mm512_loadu_si512( indices ), address, 4 );
+#elif BLAZE_AVX2_MODE
+   const __m256i i( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( indices ) ) );
+   return _mm256_i32gather_ps( address, i, 4 );
+#else
+   float tmp[IntrinsicTrait<float>::size];
+   for( size_t i=0UL; i<IntrinsicTrait<float>::size; ++i )
+      tmp[i] = address[indices[i]];
+   return loadu( tmp );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'double' values by means of 32-bit indices.
+// \ingroup intrinsics
+//
+// \param address The base address of the 'double' values.
+// \param indices The indices of the values to be loaded, relative to \a address.
+// \return The vector of the gathered 'double' values.
+//
+// This function loads the values \a address[indices[0]], \a address[indices[1]], ... into a
+// single vector. In case the AVX2 or AVX-512 mode is enabled, the values are loaded by means of
+// gather instructions with 32-bit indices, else they are loaded one by one. Note that the gather
+// instructions interpret the indices as signed integers, i.e. all indices must be smaller than
+// \f$ 2^{31} \f$.
+*/
+BLAZE_ALWAYS_INLINE sse_double_t gather( const double* address, const unsigned int* indices )
+{
+#if BLAZE_AVX512F_MODE
+   const __m256i i( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( indices ) ) );
+   return _mm512_i32gather_pd( i, address, 8 );
+#elif BLAZE_AVX2_MODE
+   const __m128i i( _mm_loadu_si128( reinterpret_cast<const __m128i*>( indices ) ) );
+   return _mm256_i32gather_pd( address, i, 8 );
+#else
+   double tmp[IntrinsicTrait<double>::size];
+   for( size_t i=0UL; i<IntrinsicTrait<double>::size; ++i )
+      tmp[i] = address[indices[i]];
+   return loadu( tmp );
+#endif
+}
+//*************************************************************************************************
+
+
+} // namespace blaze
+
+#endif
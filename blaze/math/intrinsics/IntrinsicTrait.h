@@ -76,7 +76,22 @@ struct IntrinsicTraitHelper;
 /*!\brief Specialization of the IntrinsicTraitHelper class template for 1-byte integral data types.
 // \ingroup intrinsics
 */
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+template<>
+struct IntrinsicTraitHelper<1UL>
+{
+   typedef sse_int8_t  Type;
+   enum { size           = 64,
+          addition       = 1,
+          subtraction    = 1,
+          multiplication = 0,
+          division       = 0,
+          absoluteValue  = 1,
+          minimum        = 0,
+          maximum        = 0,
+          masking        = 1 };
+};
+#elif BLAZE_AVX2_MODE
 template<>
 struct IntrinsicTraitHelper<1UL>
 {
@@ -86,7 +101,10 @@ struct IntrinsicTraitHelper<1UL>
           subtraction    = 1,
           multiplication = 0,
           division       = 0,
-          absoluteValue  = 1 };
+          absoluteValue  = 1,
+          minimum        = 0,
+          maximum        = 0,
+          masking        = 0 };
 };
 #else
 template<>
@@ -98,7 +116,10 @@ struct IntrinsicTraitHelper<1UL>
           subtraction    = BLAZE_SSE2_MODE,
           multiplication = 0,
           division       = 0,
-          absoluteValue  = BLAZE_SSSE3_MODE };
+          absoluteValue  = BLAZE_SSSE3_MODE,
+          minimum        = 0,
+          maximum        = 0,
+          masking        = 0 };
 };
 #endif
 /*! \endcond */
@@ -110,7 +131,22 @@ struct IntrinsicTraitHelper<1UL>
 /*!\brief Specialization of the IntrinsicTraitHelper class template for 2-byte integral data types.
 // \ingroup intrinsics
 */
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+template<>
+struct IntrinsicTraitHelper<2UL>
+{
+   typedef sse_int16_t  Type;
+   enum { size           = 32,
+          addition       = 1,
+          subtraction    = 1,
+          multiplication = 1,
+          division       = 0,
+          absoluteValue  = 1,
+          minimum        = 0,
+          maximum        = 0,
+          masking        = 1 };
+};
+#elif BLAZE_AVX2_MODE
 template<>
 struct IntrinsicTraitHelper<2UL>
 {
@@ -120,7 +156,10 @@ struct IntrinsicTraitHelper<2UL>
           subtraction    = 1,
           multiplication = 1,
           division       = 0,
-          absoluteValue  = 1 };
+          absoluteValue  = 1,
+          minimum        = 0,
+          maximum        = 0,
+          masking        = 0 };
 };
 #else
 template<>
@@ -132,7 +171,10 @@ struct IntrinsicTraitHelper<2UL>
           subtraction    = BLAZE_SSE2_MODE,
           multiplication = BLAZE_SSE2_MODE,
           division       = 0,
-          absoluteValue  = BLAZE_SSSE3_MODE };
+          absoluteValue  = BLAZE_SSSE3_MODE,
+          minimum        = 0,
+          maximum        = 0,
+          masking        = 0 };
 };
 #endif
 /*! \endcond */
@@ -144,7 +186,22 @@ struct IntrinsicTraitHelper<2UL>
 /*!\brief Specialization of the IntrinsicTraitHelper class template for 4-byte integral data types.
 // \ingroup intrinsics
 */
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+template<>
+struct IntrinsicTraitHelper<4UL>
+{
+   typedef sse_int32_t  Type;
+   enum { size           = 16,
+          addition       = 1,
+          subtraction    = 1,
+          multiplication = 1,
+          division       = 0,
+          absoluteValue  = 1,
+          minimum        = 0,
+          maximum        = 0,
+          masking        = 1 };
+};
+#elif BLAZE_MIC_MODE
 template<>
 struct IntrinsicTraitHelper<4UL>
 {
@@ -154,7 +211,10 @@ struct IntrinsicTraitHelper<4UL>
           subtraction    = 1,
           multiplication = 1,
           division       = 1,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          minimum        = 0,
+          maximum        = 0,
+          masking        = 0 };
 };
 #elif BLAZE_AVX2_MODE
 template<>
@@ -166,7 +226,10 @@ struct IntrinsicTraitHelper<4UL>
           subtraction    = 1,
           multiplication = 1,
           division       = 0,
-          absoluteValue  = 1 };
+          absoluteValue  = 1,
+          minimum        = 0,
+          maximum        = 0,
+          masking        = 0 };
 };
 #else
 template<>
@@ -178,7 +241,10 @@ struct IntrinsicTraitHelper<4UL>
           subtraction    = BLAZE_SSE2_MODE,
           multiplication = BLAZE_SSE4_MODE,
           division       = 0,
-          absoluteValue  = BLAZE_SSSE3_MODE };
+          absoluteValue  = BLAZE_SSSE3_MODE,
+          minimum        = 0,
+          maximum        = 0,
+          masking        = 0 };
 };
 #endif
 /*! \endcond */
@@ -190,7 +256,22 @@ struct IntrinsicTraitHelper<4UL>
 /*!\brief Specialization of the IntrinsicTraitHelper class template for 8-byte integral data types.
 // \ingroup intrinsics
 */
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+template<>
+struct IntrinsicTraitHelper<8UL>
+{
+   typedef sse_int64_t  Type;
+   enum { size           = 8,
+          addition       = 1,
+          subtraction    = 1,
+          multiplication = BLAZE_AVX512DQ_MODE,
+          division       = 0,
+          absoluteValue  = 1,
+          minimum        = 0,
+          maximum        = 0,
+          masking        = 1 };
+};
+#elif BLAZE_MIC_MODE
 template<>
 struct IntrinsicTraitHelper<8UL>
 {
@@ -200,7 +281,10 @@ struct IntrinsicTraitHelper<8UL>
           subtraction    = 0,
           multiplication = 0,
           division       = 1,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          minimum        = 0,
+          maximum        = 0,
+          masking        = 0 };
 };
 #elif BLAZE_AVX2_MODE
 template<>
@@ -212,7 +296,10 @@ struct IntrinsicTraitHelper<8UL>
           subtraction    = 1,
           multiplication = 0,
           division       = 0,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          minimum        = 0,
+          maximum        = 0,
+          masking        = 0 };
 };
 #else
 template<>
@@ -224,7 +311,10 @@ struct IntrinsicTraitHelper<8UL>
           subtraction    = BLAZE_SSE2_MODE,
           multiplication = 0,
           division       = 0,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          minimum        = 0,
+          maximum        = 0,
+          masking        = 0 };
 };
 #endif
 /*! \endcond */
@@ -254,7 +344,10 @@ struct IntrinsicTraitBase
           subtraction    = 0,
           multiplication = 0,
           division       = 0,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          minimum        = 0,
+          maximum        = 0,
+          masking        = 0 };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -279,7 +372,10 @@ struct IntrinsicTraitBase<char>
           subtraction    = Helper::subtraction,
           multiplication = Helper::multiplication,
           division       = Helper::division,
-          absoluteValue  = Helper::absoluteValue };
+          absoluteValue  = Helper::absoluteValue,
+          minimum        = Helper::minimum,
+          maximum        = Helper::maximum,
+          masking        = Helper::masking };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -304,7 +400,10 @@ struct IntrinsicTraitBase<signed char>
           subtraction    = Helper::subtraction,
           multiplication = Helper::multiplication,
           division       = Helper::division,
-          absoluteValue  = Helper::absoluteValue };
+          absoluteValue  = Helper::absoluteValue,
+          minimum        = Helper::minimum,
+          maximum        = Helper::maximum,
+          masking        = Helper::masking };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -329,7 +428,10 @@ struct IntrinsicTraitBase<unsigned char>
           subtraction    = Helper::subtraction,
           multiplication = Helper::multiplication,
           division       = Helper::division,
-          absoluteValue  = Helper::absoluteValue };
+          absoluteValue  = Helper::absoluteValue,
+          minimum        = Helper::minimum,
+          maximum        = Helper::maximum,
+          masking        = Helper::masking };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -354,7 +456,10 @@ struct IntrinsicTraitBase<wchar_t>
           subtraction    = Helper::subtraction,
           multiplication = Helper::multiplication,
           division       = Helper::division,
-          absoluteValue  = Helper::absoluteValue };
+          absoluteValue  = Helper::absoluteValue,
+          minimum        = Helper::minimum,
+          maximum        = Helper::maximum,
+          masking        = Helper::masking };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -379,7 +484,10 @@ struct IntrinsicTraitBase<short>
           subtraction    = Helper::subtraction,
           multiplication = Helper::multiplication,
           division       = Helper::division,
-          absoluteValue  = Helper::absoluteValue };
+          absoluteValue  = Helper::absoluteValue,
+          minimum        = Helper::minimum,
+          maximum        = Helper::maximum,
+          masking        = Helper::masking };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -404,7 +512,10 @@ struct IntrinsicTraitBase<unsigned short>
           subtraction    = Helper::subtraction,
           multiplication = Helper::multiplication,
           division       = Helper::division,
-          absoluteValue  = Helper::absoluteValue };
+          absoluteValue  = Helper::absoluteValue,
+          minimum        = Helper::minimum,
+          maximum        = Helper::maximum,
+          masking        = Helper::masking };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -429,7 +540,10 @@ struct IntrinsicTraitBase<int>
           subtraction    = Helper::subtraction,
           multiplication = Helper::multiplication,
           division       = Helper::division,
-          absoluteValue  = Helper::absoluteValue };
+          absoluteValue  = Helper::absoluteValue,
+          minimum        = Helper::minimum,
+          maximum        = Helper::maximum,
+          masking        = Helper::masking };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -454,7 +568,10 @@ struct IntrinsicTraitBase<unsigned int>
           subtraction    = Helper::subtraction,
           multiplication = Helper::multiplication,
           division       = Helper::division,
-          absoluteValue  = Helper::absoluteValue };
+          absoluteValue  = Helper::absoluteValue,
+          minimum        = Helper::minimum,
+          maximum        = Helper::maximum,
+          masking        = Helper::masking };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -479,7 +596,10 @@ struct IntrinsicTraitBase<long>
           subtraction    = Helper::subtraction,
           multiplication = Helper::multiplication,
           division       = Helper::division,
-          absoluteValue  = Helper::absoluteValue };
+          absoluteValue  = Helper::absoluteValue,
+          minimum        = Helper::minimum,
+          maximum        = Helper::maximum,
+          masking        = Helper::masking };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -504,7 +624,10 @@ struct IntrinsicTraitBase<unsigned long>
           subtraction    = Helper::subtraction,
           multiplication = Helper::multiplication,
           division       = Helper::division,
-          absoluteValue  = Helper::absoluteValue };
+          absoluteValue  = Helper::absoluteValue,
+          minimum        = Helper::minimum,
+          maximum        = Helper::maximum,
+          masking        = Helper::masking };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -515,7 +638,8 @@ struct IntrinsicTraitBase<unsigned long>
 /*!\brief Specialization of the IntrinsicTraitBase class template for 'float'.
 // \ingroup intrinsics
 */
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
+template<>
 struct IntrinsicTraitBase<float>
 {
    typedef sse_float_t  Type;
@@ -525,7 +649,10 @@ struct IntrinsicTraitBase<float>
           subtraction    = 1,
           multiplication = 1,
           division       = 1,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          minimum        = 1,
+          maximum        = 1,
+          masking        = BLAZE_AVX512F_MODE };
 };
 #elif BLAZE_AVX_MODE
 template<>
@@ -538,7 +665,10 @@ struct IntrinsicTraitBase<float>
           subtraction    = 1,
           multiplication = 1,
           division       = 1,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          minimum        = 1,
+          maximum        = 1,
+          masking        = 0 };
 };
 #else
 template<>
@@ -551,7 +681,10 @@ struct IntrinsicTraitBase<float>
           subtraction    = BLAZE_SSE_MODE,
           multiplication = BLAZE_SSE_MODE,
           division       = BLAZE_SSE_MODE,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          minimum        = BLAZE_SSE_MODE,
+          maximum        = BLAZE_SSE_MODE,
+          masking        = 0 };
 };
 #endif
 /*! \endcond */
@@ -563,7 +696,7 @@ struct IntrinsicTraitBase<float>
 /*!\brief Specialization of the IntrinsicTraitBase class template for 'double'.
 // \ingroup intrinsics
 */
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
 template<>
 struct IntrinsicTraitBase<double>
 {
@@ -574,7 +707,10 @@ struct IntrinsicTraitBase<double>
           subtraction    = 1,
           multiplication = 1,
           division       = 1,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          minimum        = 1,
+          maximum        = 1,
+          masking        = BLAZE_AVX512F_MODE };
 };
 #elif BLAZE_AVX_MODE
 template<>
@@ -587,7 +723,10 @@ struct IntrinsicTraitBase<double>
           subtraction    = 1,
           multiplication = 1,
           division       = 1,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          minimum        = 1,
+          maximum        = 1,
+          masking        = 0 };
 };
 #else
 template<>
@@ -600,7 +739,10 @@ struct IntrinsicTraitBase<double>
           subtraction    = BLAZE_SSE2_MODE,
           multiplication = BLAZE_SSE2_MODE,
           division       = BLAZE_SSE2_MODE,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          minimum        = BLAZE_SSE2_MODE,
+          maximum        = BLAZE_SSE2_MODE,
+          masking        = 0 };
 };
 #endif
 /*! \endcond */
@@ -612,7 +754,25 @@ struct IntrinsicTraitBase<double>
 /*!\brief Specialization of the IntrinsicTraitBase class template for 'complex<float>'.
 // \ingroup intrinsics
 */
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+template<>
+struct IntrinsicTraitBase< complex<float> >
+{
+   typedef sse_cfloat_t  Type;
+   enum { size           = ( 64UL / sizeof(complex<float>) ),
+          alignment      = AlignmentOf< complex<float> >::value,
+          addition       = 1,
+          subtraction    = 1,
+          multiplication = 1,
+          division       = 0,
+          absoluteValue  = 0,
+          minimum        = 0,
+          maximum        = 0,
+          masking        = 1 };
+
+   BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
+};
+#elif BLAZE_MIC_MODE
 template<>
 struct IntrinsicTraitBase< complex<float> >
 {
@@ -623,7 +783,10 @@ struct IntrinsicTraitBase< complex<float> >
           subtraction    = 1,
           multiplication = 0,
           division       = 0,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          minimum        = 0,
+          maximum        = 0,
+          masking        = 0 };
 
    BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
 };
@@ -638,7 +801,10 @@ struct IntrinsicTraitBase< complex<float> >
           subtraction    = 1,
           multiplication = 1,
           division       = 0,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          minimum        = 0,
+          maximum        = 0,
+          masking        = 0 };
 
    BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
 };
@@ -653,7 +819,10 @@ struct IntrinsicTraitBase< complex<float> >
           subtraction    = BLAZE_SSE_MODE,
           multiplication = BLAZE_SSE3_MODE,
           division       = 0,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          minimum        = 0,
+          maximum        = 0,
+          masking        = 0 };
 
    BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
 };
@@ -667,7 +836,25 @@ struct IntrinsicTraitBase< complex<float> >
 /*!\brief Specialization of the IntrinsicTraitBase class template for 'complex<double>'.
 // \ingroup intrinsics
 */
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+template<>
+struct IntrinsicTraitBase< complex<double> >
+{
+   typedef sse_cdouble_t  Type;
+   enum { size           = ( 64UL / sizeof(complex<double>) ),
+          alignment      = AlignmentOf< complex<double> >::value,
+          addition       = 1,
+          subtraction    = 1,
+          multiplication = 1,
+          division       = 0,
+          absoluteValue  = 0,
+          minimum        = 0,
+          maximum        = 0,
+          masking        = 1 };
+
+   BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
+};
+#elif BLAZE_MIC_MODE
 template<>
 struct IntrinsicTraitBase< complex<double> >
 {
@@ -678,7 +865,10 @@ struct IntrinsicTraitBase< complex<double> >
           subtraction    = 1,
           multiplication = 0,
           division       = 0,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          minimum        = 0,
+          maximum        = 0,
+          masking        = 0 };
 
    BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
 };
@@ -693,7 +883,10 @@ struct IntrinsicTraitBase< complex<double> >
           subtraction    = 1,
           multiplication = 1,
           division       = 0,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          minimum        = 0,
+          maximum        = 0,
+          masking        = 0 };
 
    BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
 };
@@ -708,7 +901,10 @@ struct IntrinsicTraitBase< complex<double> >
           subtraction    = BLAZE_SSE2_MODE,
           multiplication = BLAZE_SSE3_MODE,
           division       = 0,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          minimum        = 0,
+          maximum        = 0,
+          masking        = 0 };
 
    BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
 };
@@ -744,6 +940,11 @@ struct IntrinsicTraitBase< complex<double> >
 //    Else it is set to 0.
 //  - If the data type supports vectorized multiplications, the \a multiplication value is set to
 //    1. If it cannot be used in multiplications, it is set to 0.
+//  - In case the data type supports vectorized componentwise minimum and maximum operations, the
+//    \a minimum and \a maximum values are set to 1. Else they are set to 0.
+//  - If partial vectors of the data type can be loaded and stored by means of mask registers
+//    (see the maskloadu() and maskstoreu() functions), the \a masking value is set to 1.
+//    Otherwise, \a masking is set to 0.
 */
 template< typename T >
 class IntrinsicTrait : public IntrinsicTraitBase< typename RemoveCV<T>::Type >
@@ -0,0 +1,307 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/intrinsics/Maskloadu.h
+//  \brief Header file for the intrinsic masked load functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_INTRINSICS_MASKLOADU_H_
+#define _BLAZE_MATH_INTRINSICS_MASKLOADU_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/intrinsics/BasicTypes.h>
+#include <blaze/math/intrinsics/IntrinsicTrait.h>
+#include <blaze/math/intrinsics/Loadu.h>
+#include <blaze/math/intrinsics/Storeu.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/HasSize.h>
+#include <blaze/util/typetraits/IsIntegral.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INTRINSIC MASKLOADU FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Masked load of a partial vector of 2-byte integral values.
+// \ingroup intrinsics
+//
+// \param address The first integral value to be loaded.
+// \param n The number of values to be loaded \f$[0..size]\f$.
+// \param fill The vector providing the values of the remaining elements.
+// \return The loaded vector of 2-byte integral values.
+//
+// This function loads the first \a n 2-byte integral values from the given address. The remaining
+// elements of the resulting vector are taken from \a fill. Only the first \a n values at the given
+// address are accessed, which is why the address is neither required to be properly aligned nor to
+// be followed by a full intrinsic vector of values.
+*/
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,2UL> >, sse_int16_t >::Type
+   maskloadu( const T* address, size_t n, const sse_int16_t& fill )
+{
+   BLAZE_INTERNAL_ASSERT( n <= IntrinsicTrait<T>::size, "Invalid number of elements" );
+
+#if BLAZE_AVX512BW_MODE
+   const __mmask32 mask( ( uint64_t(1) << n ) - 1U );
+   return _mm512_mask_loadu_epi16( fill.value, mask, address );
+#else
+   T tmp[IntrinsicTrait<T>::size];
+   storeu( tmp, fill );
+   for( size_t i=0UL; i<n; ++i )
+      tmp[i] = address[i];
+   return loadu( tmp );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked load of a partial vector of 4-byte integral values.
+// \ingroup intrinsics
+//
+// \param address The first integral value to be loaded.
+// \param n The number of values to be loaded \f$[0..size]\f$.
+// \param fill The vector providing the values of the remaining elements.
+// \return The loaded vector of 4-byte integral values.
+//
+// This function loads the first \a n 4-byte integral values from the given address. The remaining
+// elements of the resulting vector are taken from \a fill. Only the first \a n values at the given
+// address are accessed, which is why the address is neither required to be properly aligned nor to
+// be followed by a full intrinsic vector of values.
+*/
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,4UL> >, sse_int32_t >::Type
+   maskloadu( const T* address, size_t n, const sse_int32_t& fill )
+{
+   BLAZE_INTERNAL_ASSERT( n <= IntrinsicTrait<T>::size, "Invalid number of elements" );
+
+#if BLAZE_AVX512F_MODE
+   const __mmask16 mask( ( uint64_t(1) << n ) - 1U );
+   return _mm512_mask_loadu_epi32( fill.value, mask, address );
+#else
+   T tmp[IntrinsicTrait<T>::size];
+   storeu( tmp, fill );
+   for( size_t i=0UL; i<n; ++i )
+      tmp[i] = address[i];
+   return loadu( tmp );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked load of a partial vector of 8-byte integral values.
+// \ingroup intrinsics
+//
+// \param address The first integral value to be loaded.
+// \param n The number of values to be loaded \f$[0..size]\f$.
+// \param fill The vector providing the values of the remaining elements.
+// \return The loaded vector of 8-byte integral values.
+//
+// This function loads the first \a n 8-byte integral values from the given address. The remaining
+// elements of the resulting vector are taken from \a fill. Only the first \a n values at the given
+// address are accessed, which is why the address is neither required to be properly aligned nor to
+// be followed by a full intrinsic vector of values.
+*/
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,8UL> >, sse_int64_t >::Type
+   maskloadu( const T* address, size_t n, const sse_int64_t& fill )
+{
+   BLAZE_INTERNAL_ASSERT( n <= IntrinsicTrait<T>::size, "Invalid number of elements" );
+
+#if BLAZE_AVX512F_MODE
+   const __mmask8 mask( ( uint64_t(1) << n ) - 1U );
+   return _mm512_mask_loadu_epi64( fill.value, mask, address );
+#else
+   T tmp[IntrinsicTrait<T>::size];
+   storeu( tmp, fill );
+   for( size_t i=0UL; i<n; ++i )
+      tmp[i] = address[i];
+   return loadu( tmp );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked load of a partial vector of 'float' values.
+// \ingroup intrinsics
+//
+// \param address The first 'float' value to be loaded.
+// \param n The number of values to be loaded \f$[0..size]\f$.
+// \param fill The vector providing the values of the remaining elements.
+// \return The loaded vector of 'float' values.
+//
+// This function loads the first \a n 'float' values from the given address. The remaining elements
+// of the resulting vector are taken from \a fill. Only the first \a n values at the given address
+// are accessed, which is why the address is neither required to be properly aligned nor to be
+// followed by a full intrinsic vector of values.
+*/
+BLAZE_ALWAYS_INLINE sse_float_t maskloadu( const float* address, size_t n, const sse_float_t& fill )
+{
+   BLAZE_INTERNAL_ASSERT( n <= IntrinsicTrait<float>::size, "Invalid number of elements" );
+
+#if BLAZE_AVX512F_MODE
+   const __mmask16 mask( ( uint64_t(1) << n ) - 1U );
+   return _mm512_mask_loadu_ps( fill.value, mask, address );
+#else
+   float tmp[IntrinsicTrait<float>::size];
+   storeu( tmp, fill );
+   for( size_t i=0UL; i<n; ++i )
+      tmp[i] = address[i];
+   return loadu( tmp );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked load of a partial vector of 'double' values.
+// \ingroup intrinsics
+//
+// \param address The first 'double' value to be loaded.
+// \param n The number of values to be loaded \f$[0..size]\f$.
+// \param fill The vector providing the values of the remaining elements.
+// \return The loaded vector of 'double' values.
+//
+// This function loads the first \a n 'double' values from the given address. The remaining elements
+// of the resulting vector are taken from \a fill. Only the first \a n values at the given address
+// are accessed, which is why the address is neither required to be properly aligned nor to be
+// followed by a full intrinsic vector of values.
+*/
+BLAZE_ALWAYS_INLINE sse_double_t
+   maskloadu( const double* address, size_t n, const sse_double_t& fill )
+{
+   BLAZE_INTERNAL_ASSERT( n <= IntrinsicTrait<double>::size, "Invalid number of elements" );
+
+#if BLAZE_AVX512F_MODE
+   const __mmask8 mask( ( uint64_t(1) << n ) - 1U );
+   return _mm512_mask_loadu_pd( fill.value, mask, address );
+#else
+   double tmp[IntrinsicTrait<double>::size];
+   storeu( tmp, fill );
+   for( size_t i=0UL; i<n; ++i )
+      tmp[i] = address[i];
+   return loadu( tmp );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked load of a partial vector of 'complex<float>' values.
+// \ingroup intrinsics
+//
+// \param address The first 'complex<float>' value to be loaded.
+// \param n The number of values to be loaded \f$[0..size]\f$.
+// \param fill The vector providing the values of the remaining elements.
+// \return The loaded vector of 'complex<float>' values.
+//
+// This function loads the first \a n 'complex<float>' values from the given address. The remaining
+// elements of the resulting vector are taken from \a fill. Only the first \a n values at the given
+// address are accessed, which is why the address is neither required to be properly aligned nor to
+// be followed by a full intrinsic vector of values.
+*/
+BLAZE_ALWAYS_INLINE sse_cfloat_t
+   maskloadu( const complex<float>* address, size_t n, const sse_cfloat_t& fill )
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
+
+   BLAZE_INTERNAL_ASSERT( n <= IntrinsicTrait< complex<float> >::size
+                        , "Invalid number of elements" );
+
+#if BLAZE_AVX512F_MODE
+   const __mmask16 mask( ( uint64_t(1) << ( 2UL*n ) ) - 1U );
+   return _mm512_mask_loadu_ps( fill.value, mask, reinterpret_cast<const float*>( address ) );
+#else
+   complex<float> tmp[IntrinsicTrait< complex<float> >::size];
+   storeu( tmp, fill );
+   for( size_t i=0UL; i<n; ++i )
+      tmp[i] = address[i];
+   return loadu( tmp );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked load of a partial vector of 'complex<double>' values.
+// \ingroup intrinsics
+//
+// \param address The first 'complex<double>' value to be loaded.
+// \param n The number of values to be loaded \f$[0..size]\f$.
+// \param fill The vector providing the values of the remaining elements.
+// \return The loaded vector of 'complex<double>' values.
+//
+// This function loads the first \a n 'complex<double>' values from the given address. The remaining
+// elements of the resulting vector are taken from \a fill. Only the first \a n values at the given
+// address are accessed, which is why the address is neither required to be properly aligned nor to
+// be followed by a full intrinsic vector of values.
+*/
+BLAZE_ALWAYS_INLINE sse_cdouble_t
+   maskloadu( const complex<double>* address, size_t n, const sse_cdouble_t& fill )
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
+
+   BLAZE_INTERNAL_ASSERT( n <= IntrinsicTrait< complex<double> >::size
+                        , "Invalid number of elements" );
+
+#if BLAZE_AVX512F_MODE
+   const __mmask8 mask( ( uint64_t(1) << ( 2UL*n ) ) - 1U );
+   return _mm512_mask_loadu_pd( fill.value, mask, reinterpret_cast<const double*>( address ) );
+#else
+   complex<double> tmp[IntrinsicTrait< complex<double> >::size];
+   storeu( tmp, fill );
+   for( size_t i=0UL; i<n; ++i )
+      tmp[i] = address[i];
+   return loadu( tmp );
+#endif
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,290 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/intrinsics/Maskstoreu.h
+//  \brief Header file for the intrinsic masked store functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_INTRINSICS_MASKSTOREU_H_
+#define _BLAZE_MATH_INTRINSICS_MASKSTOREU_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/intrinsics/BasicTypes.h>
+#include <blaze/math/intrinsics/IntrinsicTrait.h>
+#include <blaze/math/intrinsics/Storeu.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/HasSize.h>
+#include <blaze/util/typetraits/IsIntegral.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INTRINSIC MASKSTOREU FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Masked store of a partial vector of 2-byte integral values.
+// \ingroup intrinsics
+//
+// \param address The target address.
+// \param n The number of values to be stored \f$[0..size]\f$.
+// \param value The 2-byte integral vector to be stored.
+// \return void
+//
+// This function stores the first \a n elements of the given vector of 2-byte integral values. Only
+// the first \a n values at the given address are written, which is why the address is neither
+// required to be properly aligned nor to be followed by a full intrinsic vector of values.
+*/
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,2UL> > >::Type
+   maskstoreu( T* address, size_t n, const sse_int16_t& value )
+{
+   BLAZE_INTERNAL_ASSERT( n <= IntrinsicTrait<T>::size, "Invalid number of elements" );
+
+#if BLAZE_AVX512BW_MODE
+   const __mmask32 mask( ( uint64_t(1) << n ) - 1U );
+   _mm512_mask_storeu_epi16( address, mask, value.value );
+#else
+   T tmp[IntrinsicTrait<T>::size];
+   storeu( tmp, value );
+   for( size_t i=0UL; i<n; ++i )
+      address[i] = tmp[i];
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked store of a partial vector of 4-byte integral values.
+// \ingroup intrinsics
+//
+// \param address The target address.
+// \param n The number of values to be stored \f$[0..size]\f$.
+// \param value The 4-byte integral vector to be stored.
+// \return void
+//
+// This function stores the first \a n elements of the given vector of 4-byte integral values. Only
+// the first \a n values at the given address are written, which is why the address is neither
+// required to be properly aligned nor to be followed by a full intrinsic vector of values.
+*/
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,4UL> > >::Type
+   maskstoreu( T* address, size_t n, const sse_int32_t& value )
+{
+   BLAZE_INTERNAL_ASSERT( n <= IntrinsicTrait<T>::size, "Invalid number of elements" );
+
+#if BLAZE_AVX512F_MODE
+   const __mmask16 mask( ( uint64_t(1) << n ) - 1U );
+   _mm512_mask_storeu_epi32( address, mask, value.value );
+#else
+   T tmp[IntrinsicTrait<T>::size];
+   storeu( tmp, value );
+   for( size_t i=0UL; i<n; ++i )
+      address[i] = tmp[i];
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked store of a partial vector of 8-byte integral values.
+// \ingroup intrinsics
+//
+// \param address The target address.
+// \param n The number of values to be stored \f$[0..size]\f$.
+// \param value The 8-byte integral vector to be stored.
+// \return void
+//
+// This function stores the first \a n elements of the given vector of 8-byte integral values. Only
+// the first \a n values at the given address are written, which is why the address is neither
+// required to be properly aligned nor to be followed by a full intrinsic vector of values.
+*/
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,8UL> > >::Type
+   maskstoreu( T* address, size_t n, const sse_int64_t& value )
+{
+   BLAZE_INTERNAL_ASSERT( n <= IntrinsicTrait<T>::size, "Invalid number of elements" );
+
+#if BLAZE_AVX512F_MODE
+   const __mmask8 mask( ( uint64_t(1) << n ) - 1U );
+   _mm512_mask_storeu_epi64( address, mask, value.value );
+#else
+   T tmp[IntrinsicTrait<T>::size];
+   storeu( tmp, value );
+   for( size_t i=0UL; i<n; ++i )
+      address[i] = tmp[i];
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked store of a partial vector of 'float' values.
+// \ingroup intrinsics
+//
+// \param address The target address.
+// \param n The number of values to be stored \f$[0..size]\f$.
+// \param value The 'float' vector to be stored.
+// \return void
+//
+// This function stores the first \a n elements of the given vector of 'float' values. Only the
+// first \a n values at the given address are written, which is why the address is neither required
+// to be properly aligned nor to be followed by a full intrinsic vector of values.
+*/
+BLAZE_ALWAYS_INLINE void maskstoreu( float* address, size_t n, const sse_float_t& value )
+{
+   BLAZE_INTERNAL_ASSERT( n <= IntrinsicTrait<float>::size, "Invalid number of elements" );
+
+#if BLAZE_AVX512F_MODE
+   const __mmask16 mask( ( uint64_t(1) << n ) - 1U );
+   _mm512_mask_storeu_ps( address, mask, value.value );
+#else
+   float tmp[IntrinsicTrait<float>::size];
+   storeu( tmp, value );
+   for( size_t i=0UL; i<n; ++i )
+      address[i] = tmp[i];
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked store of a partial vector of 'double' values.
+// \ingroup intrinsics
+//
+// \param address The target address.
+// \param n The number of values to be stored \f$[0..size]\f$.
+// \param value The 'double' vector to be stored.
+// \return void
+//
+// This function stores the first \a n elements of the given vector of 'double' values. Only the
+// first \a n values at the given address are written, which is why the address is neither required
+// to be properly aligned nor to be followed by a full intrinsic vector of values.
+*/
+BLAZE_ALWAYS_INLINE void maskstoreu( double* address, size_t n, const sse_double_t& value )
+{
+   BLAZE_INTERNAL_ASSERT( n <= IntrinsicTrait<double>::size, "Invalid number of elements" );
+
+#if BLAZE_AVX512F_MODE
+   const __mmask8 mask( ( uint64_t(1) << n ) - 1U );
+   _mm512_mask_storeu_pd( address, mask, value.value );
+#else
+   double tmp[IntrinsicTrait<double>::size];
+   storeu( tmp, value );
+   for( size_t i=0UL; i<n; ++i )
+      address[i] = tmp[i];
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked store of a partial vector of 'complex<float>' values.
+// \ingroup intrinsics
+//
+// \param address The target address.
+// \param n The number of values to be stored \f$[0..size]\f$.
+// \param value The 'complex<float>' vector to be stored.
+// \return void
+//
+// This function stores the first \a n elements of the given vector of 'complex<float>' values. Only
+// the first \a n values at the given address are written, which is why the address is neither
+// required to be properly aligned nor to be followed by a full intrinsic vector of values.
+*/
+BLAZE_ALWAYS_INLINE void maskstoreu( complex<float>* address, size_t n, const sse_cfloat_t& value )
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
+
+   BLAZE_INTERNAL_ASSERT( n <= IntrinsicTrait< complex<float> >::size
+                        , "Invalid number of elements" );
+
+#if BLAZE_AVX512F_MODE
+   const __mmask16 mask( ( uint64_t(1) << ( 2UL*n ) ) - 1U );
+   _mm512_mask_storeu_ps( reinterpret_cast<float*>( address ), mask, value.value );
+#else
+   complex<float> tmp[IntrinsicTrait< complex<float> >::size];
+   storeu( tmp, value );
+   for( size_t i=0UL; i<n; ++i )
+      address[i] = tmp[i];
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked store of a partial vector of 'complex<double>' values.
+// \ingroup intrinsics
+//
+// \param address The target address.
+// \param n The number of values to be stored \f$[0..size]\f$.
+// \param value The 'complex<double>' vector to be stored.
+// \return void
+//
+// This function stores the first \a n elements of the given vector of 'complex<double>' values.
+// Only the first \a n values at the given address are written, which is why the address is neither
+// required to be properly aligned nor to be followed by a full intrinsic vector of values.
+*/
+BLAZE_ALWAYS_INLINE void
+   maskstoreu( complex<double>* address, size_t n, const sse_cdouble_t& value )
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
+
+   BLAZE_INTERNAL_ASSERT( n <= IntrinsicTrait< complex<double> >::size
+                        , "Invalid number of elements" );
+
+#if BLAZE_AVX512F_MODE
+   const __mmask8 mask( ( uint64_t(1) << ( 2UL*n ) ) - 1U );
+   _mm512_mask_storeu_pd( reinterpret_cast<double*>( address ), mask, value.value );
+#else
+   complex<double> tmp[IntrinsicTrait< complex<double> >::size];
+   storeu( tmp, value );
+   for( size_t i=0UL; i<n; ++i )
+      address[i] = tmp[i];
+#endif
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
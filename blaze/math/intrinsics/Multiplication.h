@@ -47,6 +47,130 @@
 
 namespace blaze {
 
+//=================================================================================================
+//
+//  INTRINSIC MULTIPLICATION EXPRESSIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\class blaze::sse_float_mult_t
+// \brief Expression class for the multiplication of two vectors of single precision values.
+// \ingroup intrinsics
+//
+// In case the FMA mode is enabled (see BLAZE_FMA_MODE), the multiplication of two sse_float_t
+// values is not evaluated immediately, but results in a sse_float_mult_t expression object.
+// In case the product is subsequently added to or subtracted from another vector of single
+// precision values, both operations are combined into a single fused multiply-add instruction
+// (see the fmadd(), fmsub(), and fnmadd() functions). In all other cases the expression is
+// evaluated by means of the implicit conversion to sse_float_t.
+*/
+/*! \cond BLAZE_INTERNAL */
+#if BLAZE_FMA_MODE
+struct sse_float_mult_t {
+   BLAZE_ALWAYS_INLINE sse_float_mult_t( const sse_float_t& a, const sse_float_t& b ) : a_( a ), b_( b ) {}
+   BLAZE_ALWAYS_INLINE operator sse_float_t() const { return eval(); }
+   BLAZE_ALWAYS_INLINE float operator[]( size_t i ) const { return eval()[i]; }
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
+   BLAZE_ALWAYS_INLINE sse_float_t eval() const { return _mm512_mul_ps( a_.value, b_.value ); }
+#else
+   BLAZE_ALWAYS_INLINE sse_float_t eval() const { return _mm256_mul_ps( a_.value, b_.value ); }
+#endif
+   sse_float_t a_;  // The left-hand side operand of the multiplication
+   sse_float_t b_;  // The right-hand side operand of the multiplication
+};
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\class blaze::sse_double_mult_t
+// \brief Expression class for the multiplication of two vectors of double precision values.
+// \ingroup intrinsics
+//
+// In case the FMA mode is enabled (see BLAZE_FMA_MODE), the multiplication of two sse_double_t
+// values is not evaluated immediately, but results in a sse_double_mult_t expression object.
+// In case the product is subsequently added to or subtracted from another vector of double
+// precision values, both operations are combined into a single fused multiply-add instruction
+// (see the fmadd(), fmsub(), and fnmadd() functions). In all other cases the expression is
+// evaluated by means of the implicit conversion to sse_double_t.
+*/
+/*! \cond BLAZE_INTERNAL */
+#if BLAZE_FMA_MODE
+struct sse_double_mult_t {
+   BLAZE_ALWAYS_INLINE sse_double_mult_t( const sse_double_t& a, const sse_double_t& b ) : a_( a ), b_( b ) {}
+   BLAZE_ALWAYS_INLINE operator sse_double_t() const { return eval(); }
+   BLAZE_ALWAYS_INLINE double operator[]( size_t i ) const { return eval()[i]; }
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
+   BLAZE_ALWAYS_INLINE sse_double_t eval() const { return _mm512_mul_pd( a_.value, b_.value ); }
+#else
+   BLAZE_ALWAYS_INLINE sse_double_t eval() const { return _mm256_mul_pd( a_.value, b_.value ); }
+#endif
+   sse_double_t a_;  // The left-hand side operand of the multiplication
+   sse_double_t b_;  // The right-hand side operand of the multiplication
+};
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Evaluation of the result type of an intrinsic multiplication.
+// \ingroup intrinsics
+//
+// The IntrinsicMultTrait class template evaluates the type resulting from the multiplication of
+// two values of the given intrinsic type \a T. By default the result type is \a T itself. Only
+// in case the FMA mode is enabled, the multiplication of sse_float_t and sse_double_t values
+// results in the according multiplication expression (sse_float_mult_t or sse_double_mult_t),
+// which enables the fusion of a subsequent addition or subtraction. The resulting type can be
+// queried via the nested \a Type typedef:
+
+   \code
+   typedef typename IntrinsicTrait<ElementType>::Type           IntrinsicType;
+   typedef typename IntrinsicMultTrait<IntrinsicType>::Type  MultType;
+   \endcode
+*/
+template< typename T >
+struct IntrinsicMultTrait
+{
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   typedef T  Type;
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+#if BLAZE_FMA_MODE
+template<>
+struct IntrinsicMultTrait<sse_float_t>
+{
+   typedef sse_float_mult_t  Type;
+};
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+#if BLAZE_FMA_MODE
+template<>
+struct IntrinsicMultTrait<sse_double_t>
+{
+   typedef sse_double_mult_t  Type;
+};
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  INTRINSIC MULTIPLICATION OPERATORS
@@ -62,7 +186,12 @@ namespace blaze {
 // \param b The right-hand side operand.
 // \return The result of the multiplication.
 */
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+BLAZE_ALWAYS_INLINE sse_int16_t operator*( const sse_int16_t& a, const sse_int16_t& b )
+{
+   return _mm512_mullo_epi16( a.value, b.value );
+}
+#elif BLAZE_AVX2_MODE
 BLAZE_ALWAYS_INLINE sse_int16_t operator*( const sse_int16_t& a, const sse_int16_t& b )
 {
    return _mm256_mullo_epi16( a.value, b.value );
@@ -85,7 +214,7 @@ BLAZE_ALWAYS_INLINE sse_int16_t operator*( const sse_int16_t& a, const sse_int16
 // \param b The right-hand side operand.
 // \return The result of the multiplication.
 */
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
 BLAZE_ALWAYS_INLINE sse_int32_t operator*( const sse_int32_t& a, const sse_int32_t& b )
 {
    return _mm512_mullo_epi32( a.value, b.value );
@@ -104,6 +233,24 @@ BLAZE_ALWAYS_INLINE sse_int32_t operator*( const sse_int32_t& a, const sse_int32
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\fn sse_int64_t operator*( sse_int64_t, sse_int64_t )
+// \brief Multiplication of two vectors of 64-bit integral values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The result of the multiplication.
+*/
+#if BLAZE_AVX512DQ_MODE
+BLAZE_ALWAYS_INLINE sse_int64_t operator*( const sse_int64_t& a, const sse_int64_t& b )
+{
+   return _mm512_mullo_epi64( a.value, b.value );
+}
+#endif
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\fn sse_float_t operator*( sse_float_t, sse_float_t )
 // \brief Multiplication of two vectors of single precision floating point values.
@@ -112,8 +259,17 @@ BLAZE_ALWAYS_INLINE sse_int32_t operator*( const sse_int32_t& a, const sse_int32
 // \param a The left-hand side operand.
 // \param b The right-hand side operand.
 // \return The result of the multiplication.
+//
+// In case the FMA mode is enabled, the multiplication results in a sse_float_mult_t expression
+// object, which is either evaluated by conversion to sse_float_t or as part of a fused
+// multiply-add operation.
 */
-#if BLAZE_MIC_MODE
+#if BLAZE_FMA_MODE
+BLAZE_ALWAYS_INLINE sse_float_mult_t operator*( const sse_float_t& a, const sse_float_t& b )
+{
+   return sse_float_mult_t( a, b );
+}
+#elif BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
 BLAZE_ALWAYS_INLINE sse_float_t operator*( const sse_float_t& a, const sse_float_t& b )
 {
    return _mm512_mul_ps( a.value, b.value );
@@ -140,8 +296,17 @@ BLAZE_ALWAYS_INLINE sse_float_t operator*( const sse_float_t& a, const sse_float
 // \param a The left-hand side operand.
 // \param b The right-hand side operand.
 // \return The result of the multiplication.
+//
+// In case the FMA mode is enabled, the multiplication results in a sse_double_mult_t expression
+// object, which is either evaluated by conversion to sse_double_t or as part of a fused
+// multiply-add operation.
 */
-#if BLAZE_MIC_MODE
+#if BLAZE_FMA_MODE
+BLAZE_ALWAYS_INLINE sse_double_mult_t operator*( const sse_double_t& a, const sse_double_t& b )
+{
+   return sse_double_mult_t( a, b );
+}
+#elif BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
 BLAZE_ALWAYS_INLINE sse_double_t operator*( const sse_double_t& a, const sse_double_t& b )
 {
    return _mm512_mul_pd( a.value, b.value );
@@ -169,7 +334,19 @@ BLAZE_ALWAYS_INLINE sse_double_t operator*( const sse_double_t& a, const sse_dou
 // \param b The right-hand side operand.
 // \return The result of the multiplication.
 */
-#if BLAZE_AVX_MODE
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_cfloat_t operator*( const sse_cfloat_t& a, const sse_cfloat_t& b )
+{
+   __m512 x, y, z;
+
+   x = _mm512_shuffle_ps( a.value, a.value, 0xA0 );
+   z = _mm512_mul_ps( x, b.value );
+   x = _mm512_shuffle_ps( a.value, a.value, 0xF5 );
+   y = _mm512_shuffle_ps( b.value, b.value, 0xB1 );
+   y = _mm512_mul_ps( x, y );
+   return _mm512_mask_sub_ps( _mm512_add_ps( z, y ), 0x5555, z, y );
+}
+#elif BLAZE_AVX_MODE
 BLAZE_ALWAYS_INLINE sse_cfloat_t operator*( const sse_cfloat_t& a, const sse_cfloat_t& b )
 {
    __m256 x, y, z;
@@ -206,7 +383,19 @@ BLAZE_ALWAYS_INLINE sse_cfloat_t operator*( const sse_cfloat_t& a, const sse_cfl
 // \param b The right-hand side operand.
 // \return The result of the multiplication.
 */
-#if BLAZE_AVX_MODE
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_cdouble_t operator*( const sse_cdouble_t& a, const sse_cdouble_t& b )
+{
+   __m512d x, y, z;
+
+   x = _mm512_shuffle_pd( a.value, a.value, 0 );
+   z = _mm512_mul_pd( x, b.value );
+   x = _mm512_shuffle_pd( a.value, a.value, 255 );
+   y = _mm512_shuffle_pd( b.value, b.value, 85 );
+   y = _mm512_mul_pd( x, y );
+   return _mm512_mask_sub_pd( _mm512_add_pd( z, y ), 0x55, z, y );
+}
+#elif BLAZE_AVX_MODE
 BLAZE_ALWAYS_INLINE sse_cdouble_t operator*( const sse_cdouble_t& a, const sse_cdouble_t& b )
 {
    __m256d x, y, z;
@@ -62,7 +62,16 @@ namespace blaze {
 */
 BLAZE_ALWAYS_INLINE int16_t sum( const sse_int16_t& a )
 {
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+   const __m256i b = _mm256_add_epi16( _mm512_extracti64x4_epi64( a.value, 1 )
+                                     , _mm512_castsi512_si256( a.value ) );
+   const __m256i c = _mm256_hadd_epi16( b, b );
+   const __m256i d = _mm256_hadd_epi16( c, c );
+   const __m256i e = _mm256_hadd_epi16( d, d );
+   const __m128i f = _mm_add_epi16( _mm256_extracti128_si256( e, 1 )
+                                  , _mm256_castsi256_si128( e ) );
+   return _mm_extract_epi16( f, 0 );
+#elif BLAZE_AVX2_MODE
    const sse_int16_t b( _mm256_hadd_epi16( a.value, a.value ) );
    const sse_int16_t c( _mm256_hadd_epi16( b.value, b.value ) );
    const sse_int16_t d( _mm256_hadd_epi16( c.value, c.value ) );
@@ -92,7 +101,7 @@ BLAZE_ALWAYS_INLINE int16_t sum( const sse_int16_t& a )
 */
 BLAZE_ALWAYS_INLINE int32_t sum( const sse_int32_t& a )
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    return _mm512_reduce_add_epi32( a.value );
 #elif BLAZE_AVX2_MODE
    const sse_int32_t b( _mm256_hadd_epi32( a.value, a.value ) );
@@ -122,7 +131,7 @@ BLAZE_ALWAYS_INLINE int32_t sum( const sse_int32_t& a )
 */
 BLAZE_ALWAYS_INLINE int64_t sum( const sse_int64_t& a )
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    return _mm512_reduce_add_epi64( a.value );
 #elif BLAZE_AVX2_MODE
    return a[0] + a[1] + a[2] + a[3];
@@ -144,7 +153,7 @@ BLAZE_ALWAYS_INLINE int64_t sum( const sse_int64_t& a )
 */
 BLAZE_ALWAYS_INLINE float sum( const sse_float_t& a )
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    return _mm512_reduce_add_ps( a.value );
 #elif BLAZE_AVX_MODE
    const sse_float_t b( _mm256_hadd_ps( a.value, a.value ) );
@@ -174,7 +183,7 @@ BLAZE_ALWAYS_INLINE float sum( const sse_float_t& a )
 */
 BLAZE_ALWAYS_INLINE double sum( const sse_double_t& a )
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    return _mm512_reduce_add_pd( a.value );
 #elif BLAZE_AVX_MODE
    const sse_double_t b( _mm256_hadd_pd( a.value, a.value ) );
@@ -202,7 +211,7 @@ BLAZE_ALWAYS_INLINE double sum( const sse_double_t& a )
 */
 BLAZE_ALWAYS_INLINE complex<float> sum( const sse_cfloat_t& a )
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    return complex<float>( a[0] + a[1] + a[2] + a[3] + a[4] + a[5] + a[6] + a[7] );
 #elif BLAZE_AVX_MODE
    return complex<float>( a[0] + a[1] + a[2] + a[3] );
@@ -224,7 +233,7 @@ BLAZE_ALWAYS_INLINE complex<float> sum( const sse_cfloat_t& a )
 */
 BLAZE_ALWAYS_INLINE complex<double> sum( const sse_cdouble_t& a )
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    return complex<double>( a[0] + a[1] + a[2] + a[3] );
 #elif BLAZE_AVX_MODE
    return complex<double>( a[0] + a[1] );
@@ -62,7 +62,9 @@ namespace blaze {
 */
 BLAZE_ALWAYS_INLINE void setzero( sse_int8_t& value )
 {
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+   value.value = _mm512_setzero_si512();
+#elif BLAZE_AVX2_MODE
    value.value = _mm256_setzero_si256();
 #elif BLAZE_SSE2_MODE
    value.value = _mm_setzero_si128();
@@ -82,7 +84,9 @@ BLAZE_ALWAYS_INLINE void setzero( sse_int8_t& value )
 */
 BLAZE_ALWAYS_INLINE void setzero( sse_int16_t& value )
 {
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+   value.value = _mm512_setzero_si512();
+#elif BLAZE_AVX2_MODE
    value.value = _mm256_setzero_si256();
 #elif BLAZE_SSE2_MODE
    value.value = _mm_setzero_si128();
@@ -102,7 +106,7 @@ BLAZE_ALWAYS_INLINE void setzero( sse_int16_t& value )
 */
 BLAZE_ALWAYS_INLINE void setzero( sse_int32_t& value )
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    value.value = _mm512_setzero_epi32();
 #elif BLAZE_AVX2_MODE
    value.value = _mm256_setzero_si256();
@@ -124,7 +128,7 @@ BLAZE_ALWAYS_INLINE void setzero( sse_int32_t& value )
 */
 BLAZE_ALWAYS_INLINE void setzero( sse_int64_t& value )
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    value.value = _mm512_setzero_epi32();
 #elif BLAZE_AVX2_MODE
    value.value = _mm256_setzero_si256();
@@ -146,7 +150,7 @@ BLAZE_ALWAYS_INLINE void setzero( sse_int64_t& value )
 */
 BLAZE_ALWAYS_INLINE void setzero( sse_float_t& value )
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    value.value = _mm512_setzero_ps();
 #elif BLAZE_AVX_MODE
    value.value = _mm256_setzero_ps();
@@ -168,7 +172,7 @@ BLAZE_ALWAYS_INLINE void setzero( sse_float_t& value )
 */
 BLAZE_ALWAYS_INLINE void setzero( sse_double_t& value )
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    value.value = _mm512_setzero_pd();
 #elif BLAZE_AVX_MODE
    value.value = _mm256_setzero_pd();
@@ -190,7 +194,7 @@ BLAZE_ALWAYS_INLINE void setzero( sse_double_t& value )
 */
 BLAZE_ALWAYS_INLINE void setzero( sse_cfloat_t& value )
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    value.value = _mm512_setzero_ps();
 #elif BLAZE_AVX_MODE
    value.value = _mm256_setzero_ps();
@@ -212,7 +216,7 @@ BLAZE_ALWAYS_INLINE void setzero( sse_cfloat_t& value )
 */
 BLAZE_ALWAYS_INLINE void setzero( sse_cdouble_t& value )
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    value.value = _mm512_setzero_pd();
 #elif BLAZE_AVX_MODE
    value.value = _mm256_setzero_pd();
@@ -45,6 +45,7 @@
 #include <blaze/math/DynamicVector.h>
 #include <blaze/math/Functions.h>
 #include <blaze/math/Infinity.h>
+#include <blaze/math/typetraits/BlockSize.h>
 #include <blaze/system/Precision.h>
 #include <blaze/util/Types.h>
 
@@ -179,6 +180,22 @@ inline real ContactLCP::residual() const
 }
 //*************************************************************************************************
 
+
+
+//=================================================================================================
+//
+//  BLOCKSIZE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template<>
+struct BlockSize< ContactLCP > : public SizeT<3UL>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
@@ -0,0 +1,542 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/serialization/MappedFormat.h
+//  \brief Header file for the memory-mapped binary matrix format
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SERIALIZATION_MAPPEDFORMAT_H_
+#define _BLAZE_MATH_SERIALIZATION_MAPPEDFORMAT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/serialization/TypeValueMapping.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/util/Byte.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/MappedFile.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  MAPPED FILE HEADER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Alignment of the data arrays in the memory-mapped matrix format.
+// \ingroup math_serialization
+//
+// All data arrays of a memory-mapped matrix file start at a multiple of this number of bytes
+// and the rows/columns of dense matrices are padded to a multiple of this number of bytes. The
+// value corresponds to the widest intrinsic vector of all supported instruction sets, which
+// guarantees that the files can be used with any vectorization setting.
+*/
+const size_t mappedAlignment( 64UL );
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Header of the memory-mapped binary matrix format.
+// \ingroup math_serialization
+//
+// The MappedHeader represents the first 64 bytes of a memory-mapped matrix file, which is
+// written by the writeMapped() functions and read by the MappedMatrix and MappedCompressedMatrix
+// class templates. In contrast to the portable format of the MatrixSerializer all data is stored
+// exactly as it is laid out in memory, i.e. in the native byte order of the platform:
+//
+//  - dense matrices: all rows (columns in case of column-major matrices) are stored back to back,
+//    each one padded with zeros to a multiple of \a mappedAlignment bytes. The \a spacing_ member
+//    holds the number of elements per row (column) including the padding and \a offset_ holds the
+//    position of the first element within the file.
+//  - sparse matrices: directly after the header the file contains an array of \a rows_+1 (or
+//    \a columns_+1 in case of column-major matrices) 64-bit offsets of the first element of
+//    each row (column). The array of value-index-pairs, stored in the same layout as in the
+//    CompressedMatrix class template, starts at position \a offset_ of the file.
+*/
+struct MappedHeader
+{
+   byte     magic_[8];     //!< The magic number of the file format ("BLAZEMAP").
+   uint32_t byteOrder_;    //!< The byte order mark (0x01020304 in native byte order).
+   uint8_t  version_;      //!< The version of the file format.
+   uint8_t  type_;         //!< The type of the matrix.
+   uint8_t  elementType_;  //!< The type of an element.
+   uint8_t  elementSize_;  //!< The size in bytes of a single element of the matrix.
+   uint8_t  indexSize_;    //!< The size in bytes of a single index (sparse matrices only).
+   uint8_t  reserved_[7];  //!< Reserved bytes (always zero).
+   uint64_t rows_;         //!< The number of rows of the matrix.
+   uint64_t columns_;      //!< The number of columns of the matrix.
+   uint64_t spacing_;      //!< The number of elements per row/column (dense matrices only).
+   uint64_t nonZeros_;     //!< The total number of non-zero elements (sparse matrices only).
+   uint64_t offset_;       //!< The position of the first element within the file.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+BLAZE_STATIC_ASSERT( sizeof( MappedHeader ) == 64UL );
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Calculates the padded number of elements of a row/column in the memory-mapped format.
+// \ingroup math_serialization
+//
+// \param n The number of elements of the row/column.
+// \return The number of elements including padding.
+*/
+template< typename Type >  // Data type of the elements
+inline size_t mappedSpacing( size_t n )
+{
+   const size_t block( ( mappedAlignment % sizeof( Type ) == 0UL )
+                       ? ( mappedAlignment / sizeof( Type ) )
+                       : ( 1UL ) );
+
+   return n + ( block - ( n % block ) ) % block;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Rounds the given file position up to the next multiple of \a mappedAlignment.
+// \ingroup math_serialization
+//
+// \param offset The file position in bytes.
+// \return The aligned file position.
+*/
+inline size_t mappedOffset( size_t offset )
+{
+   return offset + ( mappedAlignment - ( offset % mappedAlignment ) ) % mappedAlignment;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates the header of a memory-mapped matrix file.
+// \ingroup math_serialization
+//
+// \param type The type of the matrix.
+// \param indexSize The size of a single index (0 for dense matrices).
+// \param rows The number of rows of the matrix.
+// \param columns The number of columns of the matrix.
+// \param spacing The number of elements per row/column (0 for sparse matrices).
+// \param nonZeros The total number of non-zero elements (0 for dense matrices).
+// \param offset The position of the first element within the file.
+// \return The header of the file.
+*/
+template< typename Type >  // Data type of the elements
+inline MappedHeader makeMappedHeader( uint8_t type, uint8_t indexSize, size_t rows, size_t columns,
+                                      size_t spacing, size_t nonZeros, size_t offset )
+{
+   MappedHeader header;
+
+   std::memset( &header, 0, sizeof( header ) );
+   std::memcpy( header.magic_, "BLAZEMAP", 8UL );
+
+   header.byteOrder_   = 0x01020304U;
+   header.version_     = 1U;
+   header.type_        = type;
+   header.elementType_ = uint8_t( TypeValueMapping<Type>::value );
+   header.elementSize_ = uint8_t( sizeof( Type ) );
+   header.indexSize_   = indexSize;
+   header.rows_        = rows;
+   header.columns_     = columns;
+   header.spacing_     = spacing;
+   header.nonZeros_    = nonZeros;
+   header.offset_      = offset;
+
+   return header;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks the header of a memory-mapped matrix file.
+// \ingroup math_serialization
+//
+// \param file The mapped file.
+// \param type The expected type of the matrix.
+// \param indexSize The expected size of a single index (0 for dense matrices).
+// \return Reference to the header of the file.
+// \exception std::runtime_error Invalid file header.
+//
+// This function checks the header of the given mapped file against the expected matrix type,
+// element type and index size. In case any of these does not match, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >  // Data type of the elements
+inline const MappedHeader& readMappedHeader( const MappedFile& file, uint8_t type, uint8_t indexSize )
+{
+   if( file.size() < sizeof( MappedHeader ) ) {
+      throw std::runtime_error( "Corrupt file detected" );
+   }
+
+   const MappedHeader& header( *reinterpret_cast<const MappedHeader*>( file.data() ) );
+
+   if( std::memcmp( header.magic_, "BLAZEMAP", 8UL ) != 0 ) {
+      throw std::runtime_error( "Corrupt file detected" );
+   }
+   else if( header.byteOrder_ != 0x01020304U ) {
+      throw std::runtime_error( "Invalid byte order detected" );
+   }
+   else if( header.version_ != 1U ) {
+      throw std::runtime_error( "Invalid version detected" );
+   }
+   else if( header.type_ != type ) {
+      throw std::runtime_error( "Invalid matrix type detected" );
+   }
+   else if( header.elementType_ != TypeValueMapping<Type>::value ) {
+      throw std::runtime_error( "Invalid element type detected" );
+   }
+   else if( header.elementSize_ != sizeof( Type ) ) {
+      throw std::runtime_error( "Invalid element size detected" );
+   }
+   else if( header.indexSize_ != indexSize ) {
+      throw std::runtime_error( "Invalid index size detected" );
+   }
+   else if( header.offset_ % mappedAlignment != 0UL || header.offset_ > file.size() ) {
+      throw std::runtime_error( "Corrupt file detected" );
+   }
+
+   return header;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes the given number of zero bytes to the given file.
+// \ingroup math_serialization
+//
+// \param file The file to be written.
+// \param bytes The number of zero bytes (must be smaller than \a mappedAlignment).
+// \return void
+*/
+inline void writeMappedPadding( std::ofstream& file, size_t bytes )
+{
+   static const char zeros[mappedAlignment] = { 0 };
+
+   if( bytes > 0UL )
+      file.write( zeros, static_cast<std::streamsize>( bytes ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  WRITE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Write functions for the memory-mapped matrix format */
+//@{
+template< typename MT, bool SO >
+void writeMapped( const std::string& filename, const DenseMatrix<MT,SO>& dm );
+
+template< typename MT, bool SO >
+void writeMapped( const std::string& filename, const SparseMatrix<MT,SO>& sm );
+
+template< typename Type, bool SO, typename IT >
+void writeMapped( const std::string& filename, const CompressedMatrix<Type,SO,IT>& sm );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes the rows/columns of a dense matrix with low-level data access.
+// \ingroup math_serialization
+//
+// \param file The file to be written.
+// \param dm The dense matrix to be written.
+// \param spacing The number of elements per row/column in the file.
+// \return void
+//
+// The rows/columns are written directly from the memory of the matrix. In case the matrix
+// does not require any padding, the complete array of elements is written at once.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename EnableIf< HasConstDataAccess<MT> >::Type
+   writeMappedElements( std::ofstream& file, const DenseMatrix<MT,SO>& dm, size_t spacing )
+{
+   typedef typename MT::ElementType  ET;
+
+   const size_t lines ( SO ? (~dm).columns() : (~dm).rows() );
+   const size_t length( SO ? (~dm).rows() : (~dm).columns() );
+
+   if( length == spacing && (~dm).spacing() == spacing ) {
+      file.write( reinterpret_cast<const char*>( (~dm).data() ),
+                  static_cast<std::streamsize>( lines*spacing*sizeof(ET) ) );
+      return;
+   }
+
+   for( size_t i=0UL; i<lines; ++i ) {
+      file.write( reinterpret_cast<const char*>( (~dm).data() + i*(~dm).spacing() ),
+                  static_cast<std::streamsize>( length*sizeof(ET) ) );
+      writeMappedPadding( file, ( spacing - length ) * sizeof(ET) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes the rows/columns of a dense matrix without low-level data access.
+// \ingroup math_serialization
+//
+// \param file The file to be written.
+// \param dm The dense matrix to be written.
+// \param spacing The number of elements per row/column in the file.
+// \return void
+//
+// Each row/column is copied into a zero-padded buffer, which is written at once.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename DisableIf< HasConstDataAccess<MT> >::Type
+   writeMappedElements( std::ofstream& file, const DenseMatrix<MT,SO>& dm, size_t spacing )
+{
+   typedef typename MT::ElementType    ET;
+   typedef typename MT::CompositeType  CT;
+
+   if( spacing == 0UL ) return;
+
+   CT A( ~dm );  // Evaluation of the dense matrix operand
+
+   const size_t lines ( SO ? A.columns() : A.rows() );
+   const size_t length( SO ? A.rows() : A.columns() );
+
+   std::vector<ET> buffer( spacing, ET() );
+
+   for( size_t i=0UL; i<lines; ++i ) {
+      for( size_t j=0UL; j<length; ++j )
+         buffer[j] = ( SO ? A(j,i) : A(i,j) );
+      file.write( reinterpret_cast<const char*>( &buffer[0] ),
+                  static_cast<std::streamsize>( spacing*sizeof(ET) ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given dense matrix to a file in the memory-mapped matrix format.
+// \ingroup math_serialization
+//
+// \param filename The name of the file to be written.
+// \param dm The dense matrix to be written.
+// \return void
+// \exception std::runtime_error Dense matrix could not be written.
+//
+// This function writes the given dense matrix in the memory-mapped matrix format (see
+// MappedHeader), which can be loaded without any copy operation via the MappedMatrix class
+// template. The rows of a row-major matrix (the columns of a column-major matrix) are padded
+// with zeros to a multiple of 64 bytes. The element type of the matrix must be a numeric type.
+
+   \code
+   blaze::DynamicMatrix<double,blaze::rowMajor> A( 100000UL, 100000UL );
+   // ... Initialization of the matrix
+
+   blaze::writeMapped( "A.blaze", A );
+
+   blaze::MappedMatrix<double,blaze::rowMajor> B( "A.blaze" );  // No copy of the elements
+   \endcode
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+void writeMapped( const std::string& filename, const DenseMatrix<MT,SO>& dm )
+{
+   typedef typename MT::ElementType  ET;
+
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ET );
+
+   const size_t spacing( mappedSpacing<ET>( SO ? (~dm).rows() : (~dm).columns() ) );
+
+   const MappedHeader header( makeMappedHeader<ET>( ( SO ? 5U : 1U ), 0U, (~dm).rows(),
+                                                    (~dm).columns(), spacing, 0UL,
+                                                    sizeof( MappedHeader ) ) );
+
+   std::ofstream file( filename.c_str(), std::ofstream::binary | std::ofstream::trunc );
+
+   if( !file ) {
+      throw std::runtime_error( "File could not be opened" );
+   }
+
+   file.write( reinterpret_cast<const char*>( &header ), sizeof( header ) );
+   writeMappedElements( file, ~dm, spacing );
+   file.close();
+
+   if( !file ) {
+      throw std::runtime_error( "Dense matrix could not be written" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given sparse matrix to a file in the memory-mapped matrix format.
+// \ingroup math_serialization
+//
+// \param filename The name of the file to be written.
+// \param sm The sparse matrix to be written.
+// \return void
+// \exception std::runtime_error Sparse matrix could not be written.
+//
+// This function writes the given sparse matrix in the memory-mapped matrix format (see
+// MappedHeader), which can be loaded without any copy operation via the MappedCompressedMatrix
+// class template. The matrix is first converted to a compressed matrix with the default index
+// type. The element type of the matrix must be a numeric type.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+void writeMapped( const std::string& filename, const SparseMatrix<MT,SO>& sm )
+{
+   typedef typename MT::ElementType  ET;
+
+   const CompressedMatrix<ET,SO> tmp( ~sm );
+   writeMapped( filename, tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given compressed matrix to a file in the memory-mapped matrix format.
+// \ingroup math_serialization
+//
+// \param filename The name of the file to be written.
+// \param sm The compressed matrix to be written.
+// \return void
+// \exception std::runtime_error Sparse matrix could not be written.
+//
+// This function writes the given compressed matrix in the memory-mapped matrix format (see
+// MappedHeader), which can be loaded without any copy operation via the MappedCompressedMatrix
+// class template. The value-index-pairs of each row (column in case of a column-major matrix)
+// are written directly from the memory of the matrix. The element type of the matrix must be
+// a numeric type.
+
+   \code
+   blaze::CompressedMatrix<double,blaze::rowMajor,uint32_t> A( 100000UL, 100000UL );
+   // ... Initialization of the matrix
+
+   blaze::writeMapped( "A.blaze", A );
+
+   blaze::MappedCompressedMatrix<double,blaze::rowMajor,uint32_t> B( "A.blaze" );
+   \endcode
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+void writeMapped( const std::string& filename, const CompressedMatrix<Type,SO,IT>& sm )
+{
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( Type );
+
+   const size_t lines( SO ? sm.columns() : sm.rows() );
+
+   std::vector<uint64_t> offsets( lines+1UL, 0UL );
+   for( size_t i=0UL; i<lines; ++i ) {
+      offsets[i+1UL] = offsets[i] + sm.nonZeros( i );
+   }
+
+   const size_t begin ( sizeof( MappedHeader ) + offsets.size()*sizeof( uint64_t ) );
+   const size_t offset( mappedOffset( begin ) );
+
+   const MappedHeader header( makeMappedHeader<Type>( ( SO ? 7U : 3U ), sizeof( IT ),
+                                                      sm.rows(), sm.columns(), 0UL,
+                                                      offsets[lines], offset ) );
+
+   std::ofstream file( filename.c_str(), std::ofstream::binary | std::ofstream::trunc );
+
+   if( !file ) {
+      throw std::runtime_error( "File could not be opened" );
+   }
+
+   file.write( reinterpret_cast<const char*>( &header ), sizeof( header ) );
+   file.write( reinterpret_cast<const char*>( &offsets[0] ),
+               static_cast<std::streamsize>( offsets.size()*sizeof( uint64_t ) ) );
+   writeMappedPadding( file, offset - begin );
+
+   for( size_t i=0UL; i<lines; ++i ) {
+      file.write( reinterpret_cast<const char*>( sm.begin(i) ),
+                  static_cast<std::streamsize>( sm.nonZeros(i) * sizeof( *sm.begin(i) ) ) );
+   }
+
+   file.close();
+
+   if( !file ) {
+      throw std::runtime_error( "Sparse matrix could not be written" );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -40,7 +40,10 @@
 // Includes
 //*************************************************************************************************
 
+#include <cstring>
+#include <ios>
 #include <stdexcept>
+#include <vector>
 #include <blaze/math/constraints/Matrix.h>
 #include <blaze/math/dense/DynamicMatrix.h>
 #include <blaze/math/expressions/DenseMatrix.h>
@@ -48,10 +51,12 @@
 #include <blaze/math/expressions/Matrix.h>
 #include <blaze/math/serialization/TypeValueMapping.h>
 #include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/IsDenseMatrix.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/util/Assert.h>
+#include <blaze/util/Byte.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/Types.h>
@@ -153,6 +158,12 @@ namespace blaze {
 //
 // In case an error is encountered during (de-)serialization, a \a std::runtime_exception is
 // thrown.
+//
+// For matrices of numeric element type, the elements are not written one by one, but in bulk:
+// dense matrices with direct data access write each row/column (or the entire matrix in case it
+// is not padded) in a single write operation, sparse matrices write the indices and values of
+// each row/column in a single write operation. The resulting representation is identical to the
+// element-wise representation.
 */
 class MatrixSerializer
 {
@@ -234,10 +245,25 @@ class MatrixSerializer
    void serializeHeader( Archive& archive, const MT& mat );
 
    template< typename Archive, typename MT, bool SO >
-   void serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat );
+   typename DisableIfTrue< HasConstDataAccess<MT>::value &&
+                           IsNumeric< typename MT::ElementType >::value >::Type
+      serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat );
+
+   template< typename Archive, typename MT, bool SO >
+   typename EnableIfTrue< HasConstDataAccess<MT>::value &&
+                          IsNumeric< typename MT::ElementType >::value >::Type
+      serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat );
 
    template< typename Archive, typename MT, bool SO >
    void serializeMatrix( Archive& archive, const SparseMatrix<MT,SO>& mat );
+
+   template< typename Archive, typename MT, bool SO >
+   typename DisableIf< IsNumeric< typename MT::ElementType > >::Type
+      serializeElements( Archive& archive, const SparseMatrix<MT,SO>& mat, size_t i );
+
+   template< typename Archive, typename MT, bool SO >
+   typename EnableIf< IsNumeric< typename MT::ElementType > >::Type
+      serializeElements( Archive& archive, const SparseMatrix<MT,SO>& mat, size_t i );
    //@}
    //**********************************************************************************************
 
@@ -290,22 +316,46 @@ class MatrixSerializer
       deserializeDenseColumnMatrix( Archive& archive, SparseMatrix<MT,SO>& mat );
 
    template< typename Archive, typename MT, bool SO >
-   void deserializeSparseRowMatrix( Archive& archive, DenseMatrix<MT,SO>& mat );
+   typename DisableIf< IsNumeric< typename MT::ElementType > >::Type
+      deserializeSparseRowMatrix( Archive& archive, DenseMatrix<MT,SO>& mat );
+
+   template< typename Archive, typename MT, bool SO >
+   typename EnableIf< IsNumeric< typename MT::ElementType > >::Type
+      deserializeSparseRowMatrix( Archive& archive, DenseMatrix<MT,SO>& mat );
 
    template< typename Archive, typename MT >
-   void deserializeSparseRowMatrix( Archive& archive, SparseMatrix<MT,rowMajor>& mat );
+   typename DisableIf< IsNumeric< typename MT::ElementType > >::Type
+      deserializeSparseRowMatrix( Archive& archive, SparseMatrix<MT,rowMajor>& mat );
+
+   template< typename Archive, typename MT >
+   typename EnableIf< IsNumeric< typename MT::ElementType > >::Type
+      deserializeSparseRowMatrix( Archive& archive, SparseMatrix<MT,rowMajor>& mat );
 
    template< typename Archive, typename MT >
    void deserializeSparseRowMatrix( Archive& archive, SparseMatrix<MT,columnMajor>& mat );
 
    template< typename Archive, typename MT, bool SO >
-   void deserializeSparseColumnMatrix( Archive& archive, DenseMatrix<MT,SO>& mat );
+   typename DisableIf< IsNumeric< typename MT::ElementType > >::Type
+      deserializeSparseColumnMatrix( Archive& archive, DenseMatrix<MT,SO>& mat );
+
+   template< typename Archive, typename MT, bool SO >
+   typename EnableIf< IsNumeric< typename MT::ElementType > >::Type
+      deserializeSparseColumnMatrix( Archive& archive, DenseMatrix<MT,SO>& mat );
 
    template< typename Archive, typename MT >
    void deserializeSparseColumnMatrix( Archive& archive, SparseMatrix<MT,rowMajor>& mat );
 
    template< typename Archive, typename MT >
-   void deserializeSparseColumnMatrix( Archive& archive, SparseMatrix<MT,columnMajor>& mat );
+   typename DisableIf< IsNumeric< typename MT::ElementType > >::Type
+      deserializeSparseColumnMatrix( Archive& archive, SparseMatrix<MT,columnMajor>& mat );
+
+   template< typename Archive, typename MT >
+   typename EnableIf< IsNumeric< typename MT::ElementType > >::Type
+      deserializeSparseColumnMatrix( Archive& archive, SparseMatrix<MT,columnMajor>& mat );
+
+   template< typename Archive, typename ET >
+   bool deserializeElements( Archive& archive, size_t length,
+                             std::vector<size_t>& indices, std::vector<ET>& values );
    //@}
    //**********************************************************************************************
 
@@ -319,6 +369,8 @@ class MatrixSerializer
    uint64_t rows_;         //!< The number of rows of the matrix.
    uint64_t columns_;      //!< The number of columns of the matrix.
    uint64_t number_;       //!< The total number of elements contained in the matrix.
+
+   std::vector<byte> buffer_;  //!< Buffer for the bulk (de-)serialization of sparse elements.
    //@}
    //**********************************************************************************************
 };
@@ -344,6 +396,7 @@ MatrixSerializer::MatrixSerializer()
    , rows_       ( 0UL )  // The number of rows of the matrix
    , columns_    ( 0UL )  // The number of columns of the matrix
    , number_     ( 0UL )  // The total number of elements contained in the matrix
+   , buffer_     ()       // Buffer for the bulk (de-)serialization of sparse elements
 {}
 //*************************************************************************************************
 
@@ -419,7 +472,9 @@ void MatrixSerializer::serializeHeader( Archive& archive, const MT& mat )
 template< typename Archive  // Type of the archive
         , typename MT       // Type of the matrix
         , bool SO >         // Storage order
-void MatrixSerializer::serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat )
+typename DisableIfTrue< HasConstDataAccess<MT>::value &&
+                        IsNumeric< typename MT::ElementType >::value >::Type
+   MatrixSerializer::serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat )
 {
    if( IsRowMajorMatrix<MT>::value ) {
       for( size_t i=0UL; i<(~mat).rows(); ++i ) {
@@ -444,37 +499,65 @@ void MatrixSerializer::serializeMatrix( Archive& archive, const DenseMatrix<MT,S
 
 
 //*************************************************************************************************
-/*!\brief Serializes the elements of a sparse matrix.
+/*!\brief Serializes the elements of a dense matrix with direct access to its numeric elements.
 //
 // \param archive The archive to be written.
 // \param mat The matrix to be serialized.
 // \return void
-// \exception std::runtime_error Sparse matrix could not be serialized.
+// \exception std::runtime_error Dense matrix could not be serialized.
+//
+// This function writes each row (in case of a row-major matrix) or column (in case of a
+// column-major matrix) of the given dense matrix in a single write operation. In case the
+// matrix is not padded, the entire matrix is written in a single write operation.
 */
 template< typename Archive  // Type of the archive
         , typename MT       // Type of the matrix
         , bool SO >         // Storage order
-void MatrixSerializer::serializeMatrix( Archive& archive, const SparseMatrix<MT,SO>& mat )
+typename EnableIfTrue< HasConstDataAccess<MT>::value &&
+                       IsNumeric< typename MT::ElementType >::value >::Type
+   MatrixSerializer::serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat )
 {
-   typedef typename MT::ConstIterator  ConstIterator;
+   const size_t lines  ( ( SO == rowMajor )?( (~mat).rows() ):( (~mat).columns() ) );
+   const size_t length ( ( SO == rowMajor )?( (~mat).columns() ):( (~mat).rows() ) );
+   const size_t spacing( (~mat).spacing() );
 
-   if( IsRowMajorMatrix<MT>::value ) {
-      for( size_t i=0UL; i<(~mat).rows(); ++i ) {
-         archive << uint64_t( (~mat).nonZeros( i ) );
-         for( ConstIterator element=(~mat).begin(i); element!=(~mat).end(i); ++element ) {
-            archive << element->index() << element->value();
-         }
-      }
+   if( lines == 0UL || length == 0UL ) return;
+
+   if( spacing == length ) {
+      archive.write( (~mat).data(), lines*length );
    }
    else {
-      for( size_t j=0UL; j<(~mat).columns(); ++j ) {
-         archive << uint64_t( (~mat).nonZeros( j ) );
-         for( ConstIterator element=(~mat).begin(j); element!=(~mat).end(j); ++element ) {
-            archive << element->index() << element->value();
-         }
+      for( size_t i=0UL; i<lines; ++i ) {
+         archive.write( (~mat).data() + i*spacing, length );
       }
    }
 
+   if( !archive ) {
+      throw std::runtime_error( "Dense matrix could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes the elements of a sparse matrix.
+//
+// \param archive The archive to be written.
+// \param mat The matrix to be serialized.
+// \return void
+// \exception std::runtime_error Sparse matrix could not be serialized.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the matrix
+        , bool SO >         // Storage order
+void MatrixSerializer::serializeMatrix( Archive& archive, const SparseMatrix<MT,SO>& mat )
+{
+   const size_t lines( IsRowMajorMatrix<MT>::value ? (~mat).rows() : (~mat).columns() );
+
+   for( size_t i=0UL; i<lines; ++i ) {
+      serializeElements( archive, ~mat, i );
+   }
+
    if( !archive ) {
       throw std::runtime_error( "Sparse matrix could not be serialized" );
    }
@@ -482,6 +565,79 @@ void MatrixSerializer::serializeMatrix( Archive& archive, const SparseMatrix<MT,
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Serializes the elements of a single row/column of a sparse matrix.
+//
+// \param archive The archive to be written.
+// \param mat The matrix to be serialized.
+// \param i The index of the row/column to be serialized.
+// \return void
+//
+// This function writes the number of non-zero elements of the specified row/column followed by
+// the index and value of each non-zero element.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the matrix
+        , bool SO >         // Storage order
+typename DisableIf< IsNumeric< typename MT::ElementType > >::Type
+   MatrixSerializer::serializeElements( Archive& archive, const SparseMatrix<MT,SO>& mat, size_t i )
+{
+   typedef typename MT::ConstIterator  ConstIterator;
+
+   archive << uint64_t( (~mat).nonZeros( i ) );
+   for( ConstIterator element=(~mat).begin(i); element!=(~mat).end(i); ++element ) {
+      archive << element->index() << element->value();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes the numeric elements of a single row/column of a sparse matrix.
+//
+// \param archive The archive to be written.
+// \param mat The matrix to be serialized.
+// \param i The index of the row/column to be serialized.
+// \return void
+//
+// This function writes the number of non-zero elements of the specified row/column followed by
+// the index and value of each non-zero element. The indices and values are first packed into
+// an internal buffer, which is then written in a single write operation.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the matrix
+        , bool SO >         // Storage order
+typename EnableIf< IsNumeric< typename MT::ElementType > >::Type
+   MatrixSerializer::serializeElements( Archive& archive, const SparseMatrix<MT,SO>& mat, size_t i )
+{
+   typedef typename MT::ElementType    ET;
+   typedef typename MT::ConstIterator  ConstIterator;
+
+   const size_t nonzeros( (~mat).nonZeros( i ) );
+
+   archive << uint64_t( nonzeros );
+
+   if( nonzeros == 0UL ) return;
+
+   buffer_.resize( nonzeros * ( sizeof(size_t) + sizeof(ET) ) );
+   byte* ptr( &buffer_[0] );
+
+   for( ConstIterator element=(~mat).begin(i); element!=(~mat).end(i); ++element ) {
+      const size_t index( element->index() );
+      const ET     value( element->value() );
+      std::memcpy( ptr, &index, sizeof(size_t) );
+      ptr += sizeof(size_t);
+      std::memcpy( ptr, &value, sizeof(ET) );
+      ptr += sizeof(ET);
+   }
+
+   BLAZE_INTERNAL_ASSERT( ptr == &buffer_[0] + buffer_.size(), "Invalid number of non-zero elements" );
+
+   archive.write( &buffer_[0], buffer_.size() );
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -927,7 +1083,8 @@ typename DisableIf< IsNumeric< typename MT::ElementType > >::Type
 template< typename Archive  // Type of the archive
         , typename MT       // Type of the matrix
         , bool SO >         // Storage order
-void MatrixSerializer::deserializeSparseRowMatrix( Archive& archive, DenseMatrix<MT,SO>& mat )
+typename DisableIf< IsNumeric< typename MT::ElementType > >::Type
+   MatrixSerializer::deserializeSparseRowMatrix( Archive& archive, DenseMatrix<MT,SO>& mat )
 {
    typedef typename MT::ElementType  ET;
 
@@ -935,10 +1092,19 @@ void MatrixSerializer::deserializeSparseRowMatrix( Archive& archive, DenseMatrix
    size_t   index ( 0UL );
    ET       value = ET();
 
-   for( size_t i=0UL; i<rows_; ++i ) {
-      archive >> number;
+   for( size_t i=0UL; i<rows_ && ( archive >> number ); ++i )
+   {
+      if( number > columns_ ) {
+         archive.setstate( std::ios_base::failbit );
+         break;
+      }
+
       size_t j( 0UL );
       while( ( j != number ) && ( archive >> index >> value ) ) {
+         if( index >= columns_ ) {
+            archive.setstate( std::ios_base::failbit );
+            break;
+         }
          (~mat)(i,index) = value;
          ++j;
       }
@@ -951,6 +1117,42 @@ void MatrixSerializer::deserializeSparseRowMatrix( Archive& archive, DenseMatrix
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Deserializes a row-major sparse matrix with numeric elements from the archive.
+//
+// \param archive The archive to be read from.
+// \param mat The matrix to be reconstituted.
+// \return void
+// \exception std::runtime_error Dense matrix could not be deserialized.
+//
+// This function deserializes a row-major sparse matrix from the archive and reconstitutes
+// the given dense matrix. In case any error is detected during the deserialization process,
+// a \a std::runtime_error is thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the matrix
+        , bool SO >         // Storage order
+typename EnableIf< IsNumeric< typename MT::ElementType > >::Type
+   MatrixSerializer::deserializeSparseRowMatrix( Archive& archive, DenseMatrix<MT,SO>& mat )
+{
+   typedef typename MT::ElementType  ET;
+
+   std::vector<size_t> indices;
+   std::vector<ET>     values;
+
+   for( size_t i=0UL; i<rows_ && deserializeElements( archive, columns_, indices, values ); ++i ) {
+      for( size_t j=0UL; j<indices.size(); ++j ) {
+         (~mat)(i,indices[j]) = values[j];
+      }
+   }
+
+   if( !archive ) {
+      throw std::runtime_error( "Dense matrix could not be deserialized" );
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Deserializes a row-major sparse matrix from the archive.
 //
@@ -965,24 +1167,79 @@ void MatrixSerializer::deserializeSparseRowMatrix( Archive& archive, DenseMatrix
 */
 template< typename Archive  // Type of the archive
         , typename MT >     // Type of the matrix
-void MatrixSerializer::deserializeSparseRowMatrix( Archive& archive, SparseMatrix<MT,rowMajor>& mat )
+typename DisableIf< IsNumeric< typename MT::ElementType > >::Type
+   MatrixSerializer::deserializeSparseRowMatrix( Archive& archive, SparseMatrix<MT,rowMajor>& mat )
 {
    typedef typename MT::ElementType  ET;
 
    uint64_t number( 0UL );
    size_t   index ( 0UL );
+   size_t   total ( 0UL );
    ET       value = ET();
 
-   for( size_t i=0UL; i<rows_; ++i )
+   for( size_t i=0UL; i<rows_ && ( archive >> number ); ++i )
    {
-      archive >> number;
-      (~mat).reserve( i, number );
+      total += number;
+      if( number > columns_ || total > number_ ) {
+         archive.setstate( std::ios_base::failbit );
+         break;
+      }
 
       size_t j( 0UL );
       while( ( j != number ) && ( archive >> index >> value ) ) {
+         if( index >= columns_ ) {
+            archive.setstate( std::ios_base::failbit );
+            break;
+         }
          (~mat).append( i, index, value, false );
          ++j;
       }
+      (~mat).finalize( i );
+   }
+
+   if( !archive ) {
+      throw std::runtime_error( "Sparse matrix could not be deserialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a row-major sparse matrix with numeric elements from the archive.
+//
+// \param archive The archive to be read from.
+// \param mat The matrix to be reconstituted.
+// \return void
+// \exception std::runtime_error Sparse matrix could not be deserialized.
+//
+// This function deserializes a row-major sparse matrix from the archive and reconstitutes
+// the given row-major sparse matrix. In case any error is detected during the deserialization
+// process, a \a std::runtime_error is thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT >     // Type of the matrix
+typename EnableIf< IsNumeric< typename MT::ElementType > >::Type
+   MatrixSerializer::deserializeSparseRowMatrix( Archive& archive, SparseMatrix<MT,rowMajor>& mat )
+{
+   typedef typename MT::ElementType  ET;
+
+   std::vector<size_t> indices;
+   std::vector<ET>     values;
+
+   size_t total( 0UL );
+
+   for( size_t i=0UL; i<rows_ && deserializeElements( archive, columns_, indices, values ); ++i )
+   {
+      total += indices.size();
+      if( total > number_ ) {
+         archive.setstate( std::ios_base::failbit );
+         break;
+      }
+
+      for( size_t j=0UL; j<indices.size(); ++j ) {
+         (~mat).append( i, indices[j], values[j], false );
+      }
+      (~mat).finalize( i );
    }
 
    if( !archive ) {
@@ -1034,7 +1291,8 @@ void MatrixSerializer::deserializeSparseRowMatrix( Archive& archive, SparseMatri
 template< typename Archive  // Type of the archive
         , typename MT       // Type of the matrix
         , bool SO >         // Storage order
-void MatrixSerializer::deserializeSparseColumnMatrix( Archive& archive, DenseMatrix<MT,SO>& mat )
+typename DisableIf< IsNumeric< typename MT::ElementType > >::Type
+   MatrixSerializer::deserializeSparseColumnMatrix( Archive& archive, DenseMatrix<MT,SO>& mat )
 {
    typedef typename MT::ElementType  ET;
 
@@ -1042,10 +1300,19 @@ void MatrixSerializer::deserializeSparseColumnMatrix( Archive& archive, DenseMat
    size_t   index ( 0UL );
    ET       value = ET();
 
-   for( size_t j=0UL; j<columns_; ++j ) {
-      archive >> number;
+   for( size_t j=0UL; j<columns_ && ( archive >> number ); ++j )
+   {
+      if( number > rows_ ) {
+         archive.setstate( std::ios_base::failbit );
+         break;
+      }
+
       size_t i( 0UL );
       while( ( i != number ) && ( archive >> index >> value ) ) {
+         if( index >= rows_ ) {
+            archive.setstate( std::ios_base::failbit );
+            break;
+         }
          (~mat)(index,j) = value;
          ++i;
       }
@@ -1058,6 +1325,42 @@ void MatrixSerializer::deserializeSparseColumnMatrix( Archive& archive, DenseMat
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Deserializes a column-major sparse matrix with numeric elements from the archive.
+//
+// \param archive The archive to be read from.
+// \param mat The matrix to be reconstituted.
+// \return void
+// \exception std::runtime_error Dense matrix could not be deserialized.
+//
+// This function deserializes a column-major sparse matrix from the archive and reconstitutes
+// the given dense matrix. In case any error is detected during the deserialization process,
+// a \a std::runtime_error is thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the matrix
+        , bool SO >         // Storage order
+typename EnableIf< IsNumeric< typename MT::ElementType > >::Type
+   MatrixSerializer::deserializeSparseColumnMatrix( Archive& archive, DenseMatrix<MT,SO>& mat )
+{
+   typedef typename MT::ElementType  ET;
+
+   std::vector<size_t> indices;
+   std::vector<ET>     values;
+
+   for( size_t j=0UL; j<columns_ && deserializeElements( archive, rows_, indices, values ); ++j ) {
+      for( size_t i=0UL; i<indices.size(); ++i ) {
+         (~mat)(indices[i],j) = values[i];
+      }
+   }
+
+   if( !archive ) {
+      throw std::runtime_error( "Dense matrix could not be deserialized" );
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Deserializes a column-major sparse matrix from the archive.
 //
@@ -1099,24 +1402,79 @@ void MatrixSerializer::deserializeSparseColumnMatrix( Archive& archive, SparseMa
 */
 template< typename Archive  // Type of the archive
         , typename MT >     // Type of the matrix
-void MatrixSerializer::deserializeSparseColumnMatrix( Archive& archive, SparseMatrix<MT,columnMajor>& mat )
+typename DisableIf< IsNumeric< typename MT::ElementType > >::Type
+   MatrixSerializer::deserializeSparseColumnMatrix( Archive& archive, SparseMatrix<MT,columnMajor>& mat )
 {
    typedef typename MT::ElementType  ET;
 
    uint64_t number( 0UL );
    size_t   index ( 0UL );
+   size_t   total ( 0UL );
    ET       value = ET();
 
-   for( size_t j=0UL; j<columns_; ++j )
+   for( size_t j=0UL; j<columns_ && ( archive >> number ); ++j )
    {
-      archive >> number;
-      (~mat).reserve( j, number );
+      total += number;
+      if( number > rows_ || total > number_ ) {
+         archive.setstate( std::ios_base::failbit );
+         break;
+      }
 
       size_t i( 0UL );
       while( ( i != number ) && ( archive >> index >> value ) ) {
+         if( index >= rows_ ) {
+            archive.setstate( std::ios_base::failbit );
+            break;
+         }
          (~mat).append( index, j, value, false );
          ++i;
       }
+      (~mat).finalize( j );
+   }
+
+   if( !archive ) {
+      throw std::runtime_error( "Sparse matrix could not be deserialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a column-major sparse matrix with numeric elements from the archive.
+//
+// \param archive The archive to be read from.
+// \param mat The matrix to be reconstituted.
+// \return void
+// \exception std::runtime_error Sparse matrix could not be deserialized.
+//
+// This function deserializes a column-major sparse matrix from the archive and reconstitutes
+// the given column-major sparse matrix. In case any error is detected during the deserialization
+// process, a \a std::runtime_error is thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT >     // Type of the matrix
+typename EnableIf< IsNumeric< typename MT::ElementType > >::Type
+   MatrixSerializer::deserializeSparseColumnMatrix( Archive& archive, SparseMatrix<MT,columnMajor>& mat )
+{
+   typedef typename MT::ElementType  ET;
+
+   std::vector<size_t> indices;
+   std::vector<ET>     values;
+
+   size_t total( 0UL );
+
+   for( size_t j=0UL; j<columns_ && deserializeElements( archive, rows_, indices, values ); ++j )
+   {
+      total += indices.size();
+      if( total > number_ ) {
+         archive.setstate( std::ios_base::failbit );
+         break;
+      }
+
+      for( size_t i=0UL; i<indices.size(); ++i ) {
+         (~mat).append( indices[i], j, values[i], false );
+      }
+      (~mat).finalize( j );
    }
 
    if( !archive ) {
@@ -1126,6 +1484,65 @@ void MatrixSerializer::deserializeSparseColumnMatrix( Archive& archive, SparseMa
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Deserializes the numeric elements of a single row/column of a sparse matrix.
+//
+// \param archive The archive to be read from.
+// \param length The number of elements of the row/column.
+// \param indices The indices of the non-zero elements of the row/column.
+// \param values The values of the non-zero elements of the row/column.
+// \return \a true in case the row/column was deserialized successfully, \a false if not.
+//
+// This function reads the number of non-zero elements of the next row/column followed by the
+// index and value of each non-zero element. The indices and values are read into an internal
+// buffer in a single read operation. In case the number of non-zero elements or any of the
+// indices exceeds the length of the row/column, the archive is set to a failed state.
+*/
+template< typename Archive  // Type of the archive
+        , typename ET >     // Type of the elements
+bool MatrixSerializer::deserializeElements( Archive& archive, size_t length,
+                                            std::vector<size_t>& indices, std::vector<ET>& values )
+{
+   uint64_t number( 0UL );
+
+   if( !( archive >> number ) ) {
+      return false;
+   }
+   else if( number > length ) {
+      archive.setstate( std::ios_base::failbit );
+      return false;
+   }
+
+   indices.resize( number );
+   values.resize( number );
+
+   if( number == 0UL ) return true;
+
+   buffer_.resize( number * ( sizeof(size_t) + sizeof(ET) ) );
+
+   if( !archive.read( &buffer_[0], buffer_.size() ) ) {
+      return false;
+   }
+
+   const byte* ptr( &buffer_[0] );
+
+   for( size_t i=0UL; i<number; ++i ) {
+      std::memcpy( &indices[i], ptr, sizeof(size_t) );
+      ptr += sizeof(size_t);
+      std::memcpy( &values[i], ptr, sizeof(ET) );
+      ptr += sizeof(ET);
+
+      if( indices[i] >= length ) {
+         archive.setstate( std::ios_base::failbit );
+         return false;
+      }
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
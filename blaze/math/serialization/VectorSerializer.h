@@ -40,15 +40,20 @@
 // Includes
 //*************************************************************************************************
 
+#include <cstring>
+#include <ios>
 #include <stdexcept>
+#include <vector>
 #include <blaze/math/constraints/Vector.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/SparseVector.h>
 #include <blaze/math/expressions/Vector.h>
 #include <blaze/math/serialization/TypeValueMapping.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/IsDenseVector.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/util/Assert.h>
+#include <blaze/util/Byte.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/Types.h>
@@ -149,6 +154,11 @@ namespace blaze {
 //
 // In case an error is encountered during (de-)serialization, a \a std::runtime_exception is
 // thrown.
+//
+// For vectors of numeric element type, the elements are not written one by one, but in bulk:
+// dense vectors with direct access to their contiguous elements are written in a single write
+// operation, the indices and values of sparse vectors are written in a single write operation.
+// The resulting representation is identical to the element-wise representation.
 */
 class VectorSerializer
 {
@@ -230,10 +240,20 @@ class VectorSerializer
    void serializeHeader( Archive& archive, const VT& vec );
 
    template< typename Archive, typename VT, bool TF >
-   void serializeVector( Archive& archive, const DenseVector<VT,TF>& vec );
+   typename DisableIfTrue< HasConstDataAccess<VT>::value && VT::vectorizable >::Type
+      serializeVector( Archive& archive, const DenseVector<VT,TF>& vec );
+
+   template< typename Archive, typename VT, bool TF >
+   typename EnableIfTrue< HasConstDataAccess<VT>::value && VT::vectorizable >::Type
+      serializeVector( Archive& archive, const DenseVector<VT,TF>& vec );
+
+   template< typename Archive, typename VT, bool TF >
+   typename DisableIf< IsNumeric< typename VT::ElementType > >::Type
+      serializeVector( Archive& archive, const SparseVector<VT,TF>& vec );
 
    template< typename Archive, typename VT, bool TF >
-   void serializeVector( Archive& archive, const SparseVector<VT,TF>& vec );
+   typename EnableIf< IsNumeric< typename VT::ElementType > >::Type
+      serializeVector( Archive& archive, const SparseVector<VT,TF>& vec );
    //@}
    //**********************************************************************************************
 
@@ -267,10 +287,23 @@ class VectorSerializer
    void deserializeDenseVector( Archive& archive, SparseVector<VT,TF>& vec );
 
    template< typename Archive, typename VT, bool TF >
-   void deserializeSparseVector( Archive& archive, DenseVector<VT,TF>& vec );
+   typename DisableIf< IsNumeric< typename VT::ElementType > >::Type
+      deserializeSparseVector( Archive& archive, DenseVector<VT,TF>& vec );
+
+   template< typename Archive, typename VT, bool TF >
+   typename EnableIf< IsNumeric< typename VT::ElementType > >::Type
+      deserializeSparseVector( Archive& archive, DenseVector<VT,TF>& vec );
+
+   template< typename Archive, typename VT, bool TF >
+   typename DisableIf< IsNumeric< typename VT::ElementType > >::Type
+      deserializeSparseVector( Archive& archive, SparseVector<VT,TF>& vec );
 
    template< typename Archive, typename VT, bool TF >
-   void deserializeSparseVector( Archive& archive, SparseVector<VT,TF>& vec );
+   typename EnableIf< IsNumeric< typename VT::ElementType > >::Type
+      deserializeSparseVector( Archive& archive, SparseVector<VT,TF>& vec );
+
+   template< typename Archive, typename ET >
+   bool deserializeElements( Archive& archive, std::vector<size_t>& indices, std::vector<ET>& values );
    //@}
    //**********************************************************************************************
 
@@ -283,6 +316,8 @@ class VectorSerializer
    uint8_t  elementSize_;  //!< The size in bytes of a single element of the vector.
    uint64_t size_;         //!< The size of the vector.
    uint64_t number_;       //!< The total number of elements contained in the vector.
+
+   std::vector<byte> buffer_;  //!< Buffer for the bulk (de-)serialization of sparse elements.
    //@}
    //**********************************************************************************************
 };
@@ -307,6 +342,7 @@ VectorSerializer::VectorSerializer()
    , elementSize_( 0U  )  // The size in bytes of a single element of the vector
    , size_       ( 0UL )  // The size of the vector
    , number_     ( 0UL )  // The total number of elements contained in the vector
+   , buffer_     ()       // Buffer for the bulk (de-)serialization of sparse elements
 {}
 //*************************************************************************************************
 
@@ -384,7 +420,8 @@ void VectorSerializer::serializeHeader( Archive& archive, const VT& vec )
 template< typename Archive  // Type of the archive
         , typename VT       // Type of the vector
         , bool TF >         // Transpose flag
-void VectorSerializer::serializeVector( Archive& archive, const DenseVector<VT,TF>& vec )
+typename DisableIfTrue< HasConstDataAccess<VT>::value && VT::vectorizable >::Type
+   VectorSerializer::serializeVector( Archive& archive, const DenseVector<VT,TF>& vec )
 {
    size_t i( 0UL );
    while( ( i < (~vec).size() ) && ( archive << (~vec)[i] ) ) {
@@ -398,6 +435,32 @@ void VectorSerializer::serializeVector( Archive& archive, const DenseVector<VT,T
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Serializes the elements of a dense vector with direct access to its elements.
+//
+// \param archive The archive to be written.
+// \param vec The vector to be serialized.
+// \return void
+// \exception std::runtime_error Dense vector could not be serialized.
+//
+// This function writes all elements of the given dense vector in a single write operation.
+*/
+template< typename Archive  // Type of the archive
+        , typename VT       // Type of the vector
+        , bool TF >         // Transpose flag
+typename EnableIfTrue< HasConstDataAccess<VT>::value && VT::vectorizable >::Type
+   VectorSerializer::serializeVector( Archive& archive, const DenseVector<VT,TF>& vec )
+{
+   if( (~vec).size() == 0UL ) return;
+   archive.write( (~vec).data(), (~vec).size() );
+
+   if( !archive ) {
+      throw std::runtime_error( "Dense vector could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Serializes the elements of a sparse vector.
 //
@@ -409,7 +472,8 @@ void VectorSerializer::serializeVector( Archive& archive, const DenseVector<VT,T
 template< typename Archive  // Type of the archive
         , typename VT       // Type of the vector
         , bool TF >         // Transpose flag
-void VectorSerializer::serializeVector( Archive& archive, const SparseVector<VT,TF>& vec )
+typename DisableIf< IsNumeric< typename VT::ElementType > >::Type
+   VectorSerializer::serializeVector( Archive& archive, const SparseVector<VT,TF>& vec )
 {
    typedef typename VT::ConstIterator  ConstIterator;
 
@@ -426,6 +490,53 @@ void VectorSerializer::serializeVector( Archive& archive, const SparseVector<VT,
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Serializes the numeric elements of a sparse vector.
+//
+// \param archive The archive to be written.
+// \param vec The vector to be serialized.
+// \return void
+// \exception std::runtime_error Sparse vector could not be serialized.
+//
+// This function packs the indices and values of all non-zero elements of the given sparse
+// vector into an internal buffer, which is then written in a single write operation.
+*/
+template< typename Archive  // Type of the archive
+        , typename VT       // Type of the vector
+        , bool TF >         // Transpose flag
+typename EnableIf< IsNumeric< typename VT::ElementType > >::Type
+   VectorSerializer::serializeVector( Archive& archive, const SparseVector<VT,TF>& vec )
+{
+   typedef typename VT::ElementType    ET;
+   typedef typename VT::ConstIterator  ConstIterator;
+
+   const size_t nonzeros( (~vec).nonZeros() );
+
+   if( nonzeros == 0UL ) return;
+
+   buffer_.resize( nonzeros * ( sizeof(size_t) + sizeof(ET) ) );
+   byte* ptr( &buffer_[0] );
+
+   for( ConstIterator element=(~vec).begin(); element!=(~vec).end(); ++element ) {
+      const size_t index( element->index() );
+      const ET     value( element->value() );
+      std::memcpy( ptr, &index, sizeof(size_t) );
+      ptr += sizeof(size_t);
+      std::memcpy( ptr, &value, sizeof(ET) );
+      ptr += sizeof(ET);
+   }
+
+   BLAZE_INTERNAL_ASSERT( ptr == &buffer_[0] + buffer_.size(), "Invalid number of non-zero elements" );
+
+   archive.write( &buffer_[0], buffer_.size() );
+
+   if( !archive ) {
+      throw std::runtime_error( "Sparse vector could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -689,7 +800,8 @@ void VectorSerializer::deserializeDenseVector( Archive& archive, SparseVector<VT
 template< typename Archive  // Type of the archive
         , typename VT       // Type of the vector
         , bool TF >         // Transpose flag
-void VectorSerializer::deserializeSparseVector( Archive& archive, DenseVector<VT,TF>& vec )
+typename DisableIf< IsNumeric< typename VT::ElementType > >::Type
+   VectorSerializer::deserializeSparseVector( Archive& archive, DenseVector<VT,TF>& vec )
 {
    typedef typename VT::ElementType  ET;
 
@@ -698,6 +810,10 @@ void VectorSerializer::deserializeSparseVector( Archive& archive, DenseVector<VT
    ET     value = ET();
 
    while( ( i != number_ ) && ( archive >> index >> value ) ) {
+      if( index >= size_ ) {
+         archive.setstate( std::ios_base::failbit );
+         break;
+      }
       (~vec)[index] = value;
       ++i;
    }
@@ -709,6 +825,42 @@ void VectorSerializer::deserializeSparseVector( Archive& archive, DenseVector<VT
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Deserializes a sparse vector with numeric elements from the archive.
+//
+// \param archive The archive to be read from.
+// \param vec The dense vector to be reconstituted.
+// \return void
+// \exception std::runtime_error Dense vector could not be deserialized.
+//
+// This function deserializes a sparse vector from the archive and reconstitutes the given
+// dense vector. In case any error is detected during the deserialization process, a
+// \a std::runtime_error is thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename VT       // Type of the vector
+        , bool TF >         // Transpose flag
+typename EnableIf< IsNumeric< typename VT::ElementType > >::Type
+   VectorSerializer::deserializeSparseVector( Archive& archive, DenseVector<VT,TF>& vec )
+{
+   typedef typename VT::ElementType  ET;
+
+   std::vector<size_t> indices;
+   std::vector<ET>     values;
+
+   if( deserializeElements( archive, indices, values ) ) {
+      for( size_t i=0UL; i<indices.size(); ++i ) {
+         (~vec)[indices[i]] = values[i];
+      }
+   }
+
+   if( !archive ) {
+      throw std::runtime_error( "Dense vector could not be deserialized" );
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Deserializes a sparse vector from the archive.
 //
@@ -724,7 +876,8 @@ void VectorSerializer::deserializeSparseVector( Archive& archive, DenseVector<VT
 template< typename Archive  // Type of the archive
         , typename VT       // Type of the vector
         , bool TF >         // Transpose flag
-void VectorSerializer::deserializeSparseVector( Archive& archive, SparseVector<VT,TF>& vec )
+typename DisableIf< IsNumeric< typename VT::ElementType > >::Type
+   VectorSerializer::deserializeSparseVector( Archive& archive, SparseVector<VT,TF>& vec )
 {
    typedef typename VT::ElementType  ET;
 
@@ -733,6 +886,10 @@ void VectorSerializer::deserializeSparseVector( Archive& archive, SparseVector<V
    ET     value = ET();
 
    while( ( i != number_ ) && ( archive >> index >> value ) ) {
+      if( index >= size_ ) {
+         archive.setstate( std::ios_base::failbit );
+         break;
+      }
       (~vec).append( index, value, false );
       ++i;
    }
@@ -744,6 +901,89 @@ void VectorSerializer::deserializeSparseVector( Archive& archive, SparseVector<V
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Deserializes a sparse vector with numeric elements from the archive.
+//
+// \param archive The archive to be read from.
+// \param vec The sparse vector to be reconstituted.
+// \return void
+// \exception std::runtime_error Sparse vector could not be deserialized.
+//
+// This function deserializes a sparse vector from the archive and reconstitutes the given
+// sparse vector. In case any error is detected during the deserialization process, a
+// \a std::runtime_error is thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename VT       // Type of the vector
+        , bool TF >         // Transpose flag
+typename EnableIf< IsNumeric< typename VT::ElementType > >::Type
+   VectorSerializer::deserializeSparseVector( Archive& archive, SparseVector<VT,TF>& vec )
+{
+   typedef typename VT::ElementType  ET;
+
+   std::vector<size_t> indices;
+   std::vector<ET>     values;
+
+   if( deserializeElements( archive, indices, values ) ) {
+      for( size_t i=0UL; i<indices.size(); ++i ) {
+         (~vec).append( indices[i], values[i], false );
+      }
+   }
+
+   if( !archive ) {
+      throw std::runtime_error( "Sparse vector could not be deserialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes the numeric elements of a sparse vector.
+//
+// \param archive The archive to be read from.
+// \param indices The indices of the non-zero elements of the vector.
+// \param values The values of the non-zero elements of the vector.
+// \return \a true in case the elements were deserialized successfully, \a false if not.
+//
+// This function reads the indices and values of all non-zero elements of the sparse vector
+// into an internal buffer in a single read operation. In case any of the indices exceeds the
+// size of the vector, the archive is set to a failed state.
+*/
+template< typename Archive  // Type of the archive
+        , typename ET >     // Type of the elements
+bool VectorSerializer::deserializeElements( Archive& archive, std::vector<size_t>& indices,
+                                            std::vector<ET>& values )
+{
+   indices.resize( number_ );
+   values.resize( number_ );
+
+   if( number_ == 0UL ) return true;
+
+   buffer_.resize( number_ * ( sizeof(size_t) + sizeof(ET) ) );
+
+   if( !archive.read( &buffer_[0], buffer_.size() ) ) {
+      return false;
+   }
+
+   const byte* ptr( &buffer_[0] );
+
+   for( size_t i=0UL; i<number_; ++i ) {
+      std::memcpy( &indices[i], ptr, sizeof(size_t) );
+      ptr += sizeof(size_t);
+      std::memcpy( &values[i], ptr, sizeof(ET) );
+      ptr += sizeof(ET);
+
+      if( indices[i] >= size_ ) {
+         archive.setstate( std::ios_base::failbit );
+         return false;
+      }
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
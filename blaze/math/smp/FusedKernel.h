@@ -0,0 +1,104 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/FusedKernel.h
+//  \brief Header file for the SMP execution of fused kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_FUSEDKERNEL_H_
+#define _BLAZE_MATH_SMP_FUSEDKERNEL_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/smp/RangeKernel.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name SMP fused kernel functions */
+//@{
+template< typename KT >
+inline typename KT::ResultType
+   smpFusedKernel( size_t size, const KT& kernel, ThresholdID threshold=smpDVecReductionThreshold );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP execution of a fused kernel.
+// \ingroup smp
+//
+// \param size The total number of elements/rows processed by the kernel.
+// \param kernel The fused kernel.
+// \param threshold The SMP threshold of the kernel.
+// \return The combined result of the kernel.
+//
+// This function implements the SMP execution of a fused kernel on the range [0, \a size). The
+// range is split into one range per thread, which starts at a multiple of the intrinsic vector
+// size of the element type of the kernel. The partial results of all ranges are combined in the
+// order of the ranges (see the smpRangeReduction() function). In case the size is below the
+// given SMP threshold (per default the SMP_DVECREDUCTION_THRESHOLD) or in case the range is
+// empty, the kernel is executed single-threaded.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of fused vector kernels. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// according fused kernel function (as for instance fusedMultDot()).
+*/
+template< typename KT >  // Type of the fused kernel
+inline typename KT::ResultType
+   smpFusedKernel( size_t size, const KT& kernel, ThresholdID threshold )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return smpRangeReduction( size, IntrinsicTrait<typename KT::ElementType>::size, kernel,
+                             size != 0UL && size >= getThreshold( threshold ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
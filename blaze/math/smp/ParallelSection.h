@@ -40,8 +40,17 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/system/SMP.h>
+
+#if BLAZE_WORK_STEALING_PARALLEL_MODE && BLAZE_CPP_THREADS_PARALLEL_MODE
+#  include <atomic>
+#elif BLAZE_WORK_STEALING_PARALLEL_MODE
+#  include <boost/atomic.hpp>
+#endif
+
 #include <stdexcept>
 #include <blaze/util/Suffix.h>
+#include <blaze/util/Types.h>
 
 
 namespace blaze {
@@ -58,7 +67,10 @@ namespace blaze {
 //
 // The ParallelSection class is an auxiliary helper class for the \a BLAZE_PARALLEL_SECTION macro.
 // It provides the functionality to detected whether a parallel section has been started and with
-// that serves as a utility for debugging the shared-memory parallelization.
+// that serves as a utility for debugging the shared-memory parallelization. In case the
+// work-stealing scheduler is active, parallel sections may be nested and may be started by
+// several threads concurrently. Therefore the class counts the number of active parallel
+// sections instead of detecting nested sections.
 */
 template< typename T >
 class ParallelSection
@@ -86,6 +98,25 @@ class ParallelSection
    //**********************************************************************************************
 
  private:
+#if BLAZE_WORK_STEALING_PARALLEL_MODE
+   //**Type definitions****************************************************************************
+#  if BLAZE_CPP_THREADS_PARALLEL_MODE
+   typedef std::atomic<size_t>  Counter;    //!< Type of the counter of active sections.
+#  else
+   typedef boost::atomic<size_t>  Counter;  //!< Type of the counter of active sections.
+#  endif
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   const bool activate_;    //!< Activation flag of this parallel section.
+   static Counter active_;  //!< Number of active parallel sections.
+                            /*!< In case at least one parallel section is active (i.e. code is
+                                 executed inside a parallel section by any thread), the counter
+                                 is larger than zero. */
+   //@}
+#else
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
@@ -94,6 +125,7 @@ class ParallelSection
                               code is inside a parallel section), the flag is set to \a true,
                               otherwise it is \a false. */
    //@}
+#endif
    //**********************************************************************************************
 
    //**Friend declarations*************************************************************************
@@ -115,8 +147,13 @@ class ParallelSection
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
+#if BLAZE_WORK_STEALING_PARALLEL_MODE
+template< typename T >
+typename ParallelSection<T>::Counter ParallelSection<T>::active_( 0UL );
+#else
 template< typename T >
 bool ParallelSection<T>::active_ = false;
+#endif
 /*! \endcond */
 //*************************************************************************************************
 
@@ -135,6 +172,15 @@ bool ParallelSection<T>::active_ = false;
 // \param activate Activation flag for the parallel section.
 // \exception std::runtime_error Nested parallel sections detected.
 */
+#if BLAZE_WORK_STEALING_PARALLEL_MODE
+template< typename T >
+inline ParallelSection<T>::ParallelSection( bool activate )
+   : activate_( activate )  // Activation flag of this parallel section
+{
+   if( activate_ )
+      ++active_;
+}
+#else
 template< typename T >
 inline ParallelSection<T>::ParallelSection( bool activate )
 {
@@ -143,6 +189,7 @@ inline ParallelSection<T>::ParallelSection( bool activate )
 
    active_ = activate;
 }
+#endif
 //*************************************************************************************************
 
 
@@ -160,7 +207,12 @@ inline ParallelSection<T>::ParallelSection( bool activate )
 template< typename T >
 inline ParallelSection<T>::~ParallelSection()
 {
+#if BLAZE_WORK_STEALING_PARALLEL_MODE
+   if( activate_ )
+      --active_;
+#else
    active_ = false;  // Resetting the activity flag
+#endif
 }
 //*************************************************************************************************
 
@@ -182,7 +234,11 @@ inline ParallelSection<T>::~ParallelSection()
 template< typename T >
 inline ParallelSection<T>::operator bool() const
 {
+#if BLAZE_WORK_STEALING_PARALLEL_MODE
+   return activate_;
+#else
    return active_;
+#endif
 }
 //*************************************************************************************************
 
@@ -211,7 +267,11 @@ inline bool isParallelSectionActive();
 */
 inline bool isParallelSectionActive()
 {
+#if BLAZE_WORK_STEALING_PARALLEL_MODE
+   return ParallelSection<int>::active_.load() != 0UL;
+#else
    return ParallelSection<int>::active_;
+#endif
 }
 //*************************************************************************************************
 
@@ -237,7 +297,8 @@ inline bool isParallelSectionActive()
 // SMP assign function from within a non-SMP assign function. The BLAZE_PARALLEL_SECTION macro
 // can be used to mark the start of a parallel section and with that detect nested SMP assign
 // function calls. In case a nested use of a parallel section is detected, a \a std::runtime_error
-// exception is thrown.\n
+// exception is thrown. Only in case the work-stealing scheduler is active (see the
+// \c BLAZE_USE_WORK_STEALING command line argument), nested parallel sections are permitted.\n
 // Note that this macro is reserved for internal debugging purposes only and therefore must \b NOT
 // be used explicitly! Using this macro might result in erroneous results, runtime or compilation
 // errors.
@@ -0,0 +1,149 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/Ranges.h
+//  \brief Header file for the splitting of index ranges for the SMP execution of range kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_RANGES_H_
+#define _BLAZE_MATH_SMP_RANGES_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary kernel for the storage of the partial results of a range kernel.
+// \ingroup smp
+//
+// The PartialResultKernel class template executes the given range kernel on a range of
+// indices and stores the result in the slot of the range. The range [0,size) is assumed to
+// be split into ranges of \a step indices each, i.e. the slot of the range starting at index
+// \a begin is \a begin / \a step.
+*/
+template< typename KT >  // Type of the range kernel
+struct PartialResultKernel
+{
+   //**Type definitions****************************************************************************
+   typedef typename KT::ResultType  ResultType;  //!< Resulting type of the range kernel.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the PartialResultKernel class template.
+   //
+   // \param kernel The range kernel.
+   // \param step The number of indices per range.
+   // \param results The slots for the partial results of all ranges.
+   */
+   explicit inline PartialResultKernel( const KT& kernel, size_t step, ResultType* results )
+      : kernel_ ( kernel  )  // The range kernel
+      , step_   ( step    )  // The number of indices per range
+      , results_( results )  // The slots for the partial results of all ranges
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Executes the range kernel on the range [\a begin, \a end).
+   //
+   // \param begin The index of the first element of the range.
+   // \param end The index one past the last element of the range.
+   // \return void
+   */
+   inline void operator()( size_t begin, size_t end ) const {
+      BLAZE_INTERNAL_ASSERT( begin % step_ == 0UL, "Invalid range detected" );
+      results_[begin/step_] = kernel_( begin, end );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   KT          kernel_;   //!< The range kernel.
+   size_t      step_;     //!< The number of indices per range.
+   ResultType* results_;  //!< The slots for the partial results of all ranges.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the number of indices per range for the SMP execution of a range kernel.
+// \ingroup smp
+//
+// \param size The total number of indices.
+// \param ranges The maximum number of ranges.
+// \param alignment The alignment of the first index of each range.
+// \return The number of indices per range.
+//
+// This function splits the range [0,size) into at most \a ranges ranges of equal size. The
+// returned size is a multiple of the given alignment (for instance the number of elements of
+// an intrinsic vector), i.e. all ranges start at an aligned index. Only the last range may be
+// smaller than the others. The returned size is at least 1, even in case \a size is 0.
+*/
+inline size_t smpRangeSize( size_t size, size_t ranges, size_t alignment )
+{
+   BLAZE_INTERNAL_ASSERT( ranges    > 0UL, "Invalid number of ranges"   );
+   BLAZE_INTERNAL_ASSERT( alignment > 0UL, "Invalid range alignment" );
+
+   const size_t share( ( size + ranges - 1UL ) / ranges );
+   const size_t rest ( share % alignment );
+   const size_t step ( ( rest )?( share - rest + alignment ):( share ) );
+
+   return ( step > 0UL )?( step ):( 1UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,90 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/SellMatrix.h
+//  \brief Header file for the SMP evaluation of SELL matrix kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_SELLMATRIX_H_
+#define _BLAZE_MATH_SMP_SELLMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/smp/RangeKernel.h>
+#include <blaze/util/logging/FunctionTrace.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Chunk-wise SMP evaluation of a SELL matrix kernel.
+// \ingroup smp
+//
+// \param rhs The right-hand side expression to be evaluated.
+// \param kernel The kernel for the computation of a range of chunks of the SELL matrix.
+// \return void
+//
+// This function implements the chunk-wise SMP evaluation of a SELL matrix kernel (for instance
+// the product of a SELL matrix and a dense vector). The \c chunks() function of the kernel has
+// to return the number of chunks of the SELL matrix, the function call operator has to compute
+// the results of all rows of the given range of chunks. Since the rows of different chunks are
+// disjoint, the chunk ranges are computed independently by the active SMP backend (see the
+// smpRangeKernel() function). In case the right-hand side expression cannot be assigned in
+// parallel, all chunks are computed single-threaded.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename T     // Type of the right-hand side expression
+        , typename KT >  // Type of the SELL kernel
+inline void smpSellAssign( const T& rhs, const KT& kernel )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   smpRangeKernel( kernel.chunks(), kernel, rhs.canSMPAssign() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,338 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/TileGrid.h
+//  \brief Header file for the TileGrid class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_TILEGRID_H_
+#define _BLAZE_MATH_SMP_TILEGRID_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/system/CacheSize.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitioning of a matrix into tiles for the SMP assignment.
+// \ingroup smp
+//
+// The TileGrid class partitions the index space of a matrix into a regular grid of rectangular
+// tiles, which are assigned to the available threads dynamically. The matrix is decomposed
+// into several tiles per thread in order to balance the work between the threads even in case
+// individual tiles require different amounts of work. The number of elements per tile is
+// additionally limited by the size of the L2 cache (as long as this does not result in an
+// excessive number of tiles). The shape of the tiles is adapted to the
+// shape and storage order of the matrix: In case of a row-major matrix the tiles span as many
+// columns as possible, in case of a column-major matrix they span as many rows as possible.
+// Both extents of a tile are multiples of the given SIMD width (except for the last tile in
+// a row or column of tiles) such that aligned submatrices can be used for all tiles.
+//
+// In case the matrix is a lower or upper matrix, square tiles are used and the tiles that lie
+// completely within the zero triangle of the matrix are marked as zero tiles (see the isZero()
+// function). Since these tiles don't contain any actual work, they don't contribute to the
+// number of tiles per thread.\n
+// This class must \b NOT be used explicitly! It is reserved for internal use only.
+*/
+class TileGrid
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   template< typename MT, bool SO >
+   explicit inline TileGrid( const Matrix<MT,SO>& matrix, size_t threads, size_t simdSize );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size   () const;
+   inline size_t row    ( size_t tile ) const;
+   inline size_t column ( size_t tile ) const;
+   inline size_t rows   ( size_t tile ) const;
+   inline size_t columns( size_t tile ) const;
+   inline bool   isZero ( size_t tile ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void init( size_t m, size_t n, bool isRowMajor, size_t threads,
+                     size_t simdSize, size_t elementSize, bool lower, bool upper );
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time constants**********************************************************************
+   enum { tilesPerThread    =  4 };  //!< Preferred number of tiles per thread.
+   enum { maxTilesPerThread = 16 };  //!< Maximum number of tiles per thread.
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t rows_;            //!< The number of rows of the matrix.
+   size_t columns_;         //!< The number of columns of the matrix.
+   size_t rowsPerTile_;     //!< The number of rows per tile.
+   size_t columnsPerTile_;  //!< The number of columns per tile.
+   size_t tileRows_;        //!< The number of rows of tiles.
+   size_t tileColumns_;     //!< The number of columns of tiles.
+   bool   rowMajor_;        //!< Storage order flag; tiles are enumerated in this order.
+   bool   lower_;           //!< \a true in case the upper part of the matrix is zero.
+   bool   upper_;           //!< \a true in case the lower part of the matrix is zero.
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for the TileGrid class.
+//
+// \param matrix The matrix to be partitioned.
+// \param threads The number of threads to be used.
+// \param simdSize The SIMD width the tile extents are aligned to.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order of the matrix
+inline TileGrid::TileGrid( const Matrix<MT,SO>& matrix, size_t threads, size_t simdSize )
+{
+   init( (~matrix).rows(), (~matrix).columns(), SO == rowMajor, threads, simdSize,
+         sizeof( typename MT::ElementType ), IsLower<MT>::value, IsUpper<MT>::value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the total number of tiles.
+//
+// \return The total number of tiles.
+*/
+inline size_t TileGrid::size() const
+{
+   return tileRows_ * tileColumns_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the index of the first row of the given tile.
+//
+// \param tile The index of the tile \f$[0..size())\f$.
+// \return The index of the first row of the tile.
+*/
+inline size_t TileGrid::row( size_t tile ) const
+{
+   BLAZE_USER_ASSERT( tile < size(), "Invalid tile access index" );
+   return ( ( rowMajor_ )?( tile / tileColumns_ ):( tile % tileRows_ ) ) * rowsPerTile_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the index of the first column of the given tile.
+//
+// \param tile The index of the tile \f$[0..size())\f$.
+// \return The index of the first column of the tile.
+*/
+inline size_t TileGrid::column( size_t tile ) const
+{
+   BLAZE_USER_ASSERT( tile < size(), "Invalid tile access index" );
+   return ( ( rowMajor_ )?( tile % tileColumns_ ):( tile / tileRows_ ) ) * columnsPerTile_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of rows of the given tile.
+//
+// \param tile The index of the tile \f$[0..size())\f$.
+// \return The number of rows of the tile.
+*/
+inline size_t TileGrid::rows( size_t tile ) const
+{
+   return min( rowsPerTile_, rows_ - row( tile ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of columns of the given tile.
+//
+// \param tile The index of the tile \f$[0..size())\f$.
+// \return The number of columns of the tile.
+*/
+inline size_t TileGrid::columns( size_t tile ) const
+{
+   return min( columnsPerTile_, columns_ - column( tile ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the given tile lies completely within the zero triangle of the matrix.
+//
+// \param tile The index of the tile \f$[0..size())\f$.
+// \return \a true in case all elements of the tile are zero, \a false if not.
+*/
+inline bool TileGrid::isZero( size_t tile ) const
+{
+   const size_t i( row   ( tile ) );
+   const size_t j( column( tile ) );
+
+   return ( lower_ && i + rows   ( tile ) <= j ) ||
+          ( upper_ && j + columns( tile ) <= i );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the tile extents for the given matrix.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param isRowMajor \a true in case of a row-major matrix, \a false in case of a column-major matrix.
+// \param threads The number of threads to be used.
+// \param simdSize The SIMD width the tile extents are aligned to.
+// \param elementSize The size of a single matrix element in bytes.
+// \param lower \a true in case the upper part of the matrix is zero.
+// \param upper \a true in case the lower part of the matrix is zero.
+// \return void
+*/
+inline void TileGrid::init( size_t m, size_t n, bool isRowMajor, size_t threads,
+                            size_t simdSize, size_t elementSize, bool lower, bool upper )
+{
+   rows_     = m;
+   columns_  = n;
+   rowMajor_ = isRowMajor;
+   lower_    = lower;
+   upper_    = upper;
+
+   if( m == 0UL || n == 0UL ) {
+      rowsPerTile_ = columnsPerTile_ = 1UL;
+      tileRows_    = tileColumns_    = 0UL;
+      return;
+   }
+
+   const size_t simd ( max( simdSize, size_t( 1UL ) ) );
+   const size_t area ( ( lower || upper )?( m*n/2UL + 1UL ):( m*n ) );
+   const size_t tiles   ( max( threads, size_t( 1UL ) ) * size_t( tilesPerThread ) );
+   const size_t maxTiles( max( threads, size_t( 1UL ) ) * size_t( maxTilesPerThread ) );
+   const size_t cache   ( max( l2CacheSize / ( 2UL*elementSize ), simd*simd ) );
+
+   // Cache-sized tiles, but neither less than the preferred nor more than the maximum number of
+   // tiles per thread in order to limit the scheduling overhead for large matrices
+   const size_t elements( max( max( min( ( area + tiles - 1UL ) / tiles, cache ),
+                                    ( area + maxTiles - 1UL ) / maxTiles ), simd*simd ) );
+
+   const size_t majorSize( ( isRowMajor )?( n ):( m ) );
+   const size_t minorSize( ( isRowMajor )?( m ):( n ) );
+
+   size_t major, minor;
+
+   if( lower || upper ) {
+      const size_t side( static_cast<size_t>( std::ceil( std::sqrt( double( elements ) ) ) ) );
+      major = minor = ( side + simd - 1UL ) / simd * simd;
+   }
+   else {
+      major = ( ( elements + simd - 1UL ) / simd + simd - 1UL ) / simd * simd;
+      major = min( major, majorSize );
+      minor = ( ( elements + major - 1UL ) / major + simd - 1UL ) / simd * simd;
+   }
+
+   major = min( major, majorSize );
+   minor = min( minor, minorSize );
+
+   rowsPerTile_    = ( isRowMajor )?( minor ):( major );
+   columnsPerTile_ = ( isRowMajor )?( major ):( minor );
+   tileRows_       = ( m + rowsPerTile_    - 1UL ) / rowsPerTile_;
+   tileColumns_    = ( n + columnsPerTile_ - 1UL ) / columnsPerTile_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,88 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/TripletBuilder.h
+//  \brief Header file for the SMP execution of triplet builder kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_TRIPLETBUILDER_H_
+#define _BLAZE_MATH_SMP_TRIPLETBUILDER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/smp/RangeKernel.h>
+#include <blaze/util/logging/FunctionTrace.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP execution of a triplet builder kernel.
+// \ingroup smp
+//
+// \param kernel The kernel for the processing of a range of rows/columns.
+// \return void
+//
+// This function implements the SMP execution of a triplet builder kernel (for instance the
+// sorting and merging of the triplets of all rows/columns of a compressed matrix). The \c size()
+// function of the kernel has to return the number of rows/columns, the function call operator
+// has to process all rows/columns of the given range. Since different rows/columns are disjoint,
+// the ranges are processed independently by the active SMP backend (see the smpRangeKernel()
+// function). In case the \c canSMPAssign() function of the kernel returns \a false (for instance
+// since the number of triplets is below the SMP_TRIPLETASSIGN_THRESHOLD), all rows/columns are
+// processed single-threaded.\n
+// This function must \b NOT be called explicitly! It is used internally by the TripletBuilder
+// class template. Calling this function explicitly might result in erroneous results and/or in
+// compilation errors. Instead of using this function use the build() function of the builder.
+*/
+template< typename KT >  // Type of the triplet builder kernel
+inline void smpTripletAssign( const KT& kernel )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   smpRangeKernel( kernel.size(), kernel, kernel.canSMPAssign() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
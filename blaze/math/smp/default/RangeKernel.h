@@ -0,0 +1,133 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/default/RangeKernel.h
+//  \brief Header file for the default SMP execution of range kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_DEFAULT_RANGEKERNEL_H_
+#define _BLAZE_MATH_SMP_DEFAULT_RANGEKERNEL_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Range kernel SMP functions */
+//@{
+template< typename KT >
+inline void smpRangeKernel( size_t size, const KT& kernel, bool parallel );
+
+template< typename KT >
+inline typename KT::ResultType
+   smpRangeReduction( size_t size, size_t alignment, const KT& kernel, bool parallel );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the SMP execution of a range kernel.
+// \ingroup smp
+//
+// \param size The total number of indices.
+// \param kernel The range kernel.
+// \param parallel \a true in case the kernel may be executed in parallel, \a false if not.
+// \return void
+//
+// This function implements the default SMP execution of a range kernel on the range [0,
+// \a size). The function call operator of the kernel has to process the range [\a begin,
+// \a end) of indices. Due to the default setting the kernel is executed single-threaded.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename KT >  // Type of the range kernel
+inline void smpRangeKernel( size_t size, const KT& kernel, bool parallel )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   UNUSED_PARAMETER( parallel );
+
+   kernel( 0UL, size );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the SMP execution of a reducing range kernel.
+// \ingroup smp
+//
+// \param size The total number of indices.
+// \param alignment The alignment of the first index of each range.
+// \param kernel The range kernel.
+// \param parallel \a true in case the kernel may be executed in parallel, \a false if not.
+// \return The result of the kernel.
+//
+// This function implements the default SMP execution of a reducing range kernel on the range
+// [0, \a size). Due to the default setting the kernel is executed single-threaded.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of fused vector kernels. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename KT >  // Type of the range kernel
+inline typename KT::ResultType
+   smpRangeReduction( size_t size, size_t alignment, const KT& kernel, bool parallel )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   UNUSED_PARAMETER( alignment, parallel );
+
+   return kernel( 0UL, size );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -47,6 +47,7 @@
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/logging/FunctionTrace.h>
 #include <blaze/util/StaticAssert.h>
+#include <blaze/util/Unused.h>
 
 
 namespace blaze {
@@ -71,6 +72,10 @@ inline typename EnableIf< IsSparseMatrix<MT1> >::Type
 template< typename MT1, bool SO1, typename MT2, bool SO2 >
 inline typename EnableIf< IsSparseMatrix<MT1> >::Type
    smpSubAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
+
+template< typename MT1, typename MT2, bool SO, typename KT >
+inline void smpSparseAssign( SparseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,SO>& rhs,
+                             const KT& kernel );
 //@}
 //*************************************************************************************************
 
@@ -167,6 +172,49 @@ inline typename EnableIf< IsSparseMatrix<MT1> >::Type
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the kernel-based SMP assignment to a sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \param kernel The kernel for the computation of single rows/columns of the right-hand side.
+// \return void
+//
+// This function implements the default kernel-based SMP assignment of a sparse matrix to a
+// sparse matrix. The given kernel is used by the parallel backends to compute the rows (in
+// case of row-major matrices) or columns (in case of column-major matrices) of the right-hand
+// side sparse matrix in two passes: The \c nonZeros() function of the kernel has to return the
+// exact number of non-zero elements of the given row/column (symbolic pass), the \c assign()
+// function has to append the elements of the given row/column to the given sparse matrix via
+// its low-level \c append() function (numeric pass). The default implementation ignores the
+// kernel and performs a serial assignment.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side sparse matrix
+        , bool SO       // Storage order of both sparse matrices
+        , typename KT > // Type of the row/column kernel
+inline void smpSparseAssign( SparseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,SO>& rhs,
+                             const KT& kernel )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   UNUSED_PARAMETER( kernel );
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   assign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
@@ -49,6 +49,7 @@
 #include <blaze/math/intrinsics/IntrinsicTrait.h>
 #include <blaze/math/smp/ParallelSection.h>
 #include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/TileGrid.h>
 #include <blaze/math/SparseSubmatrix.h>
 #include <blaze/math/StorageOrder.h>
 #include <blaze/math/traits/SubmatrixExprTrait.h>
@@ -109,37 +110,36 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMajor
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).rows() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t rowsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const TileGrid grid( ~rhs, omp_get_num_threads(), ( vectorizable )?( size_t( IT::size ) ):( 1UL ) );
+   const int      tiles( static_cast<int>( grid.size() ) );
 
 #pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+   for( int i=0; i<tiles; ++i )
    {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
-         continue;
-
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
-
-      if( vectorizable && lhsAligned && rhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         assign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
+      const size_t row   ( grid.row    ( i ) );
+      const size_t column( grid.column ( i ) );
+      const size_t m     ( grid.rows   ( i ) );
+      const size_t n     ( grid.columns( i ) );
+
+      if( grid.isZero( i ) ) {
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         reset( target );
+      }
+      else if( vectorizable && lhsAligned && rhsAligned ) {
+         AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+         assign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
       }
       else if( vectorizable && lhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         assign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
+         AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+         assign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
       }
       else if( vectorizable && rhsAligned ) {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         assign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         assign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
       }
       else {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         assign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         assign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
       }
    }
 }
@@ -182,37 +182,36 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,columnMa
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).columns() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t colsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const TileGrid grid( ~rhs, omp_get_num_threads(), ( vectorizable )?( size_t( IT::size ) ):( 1UL ) );
+   const int      tiles( static_cast<int>( grid.size() ) );
 
 #pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+   for( int i=0; i<tiles; ++i )
    {
-      const size_t column( i*colsPerThread );
-
-      if( column >= (~lhs).columns() )
-         continue;
-
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
-
-      if( vectorizable && lhsAligned && rhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         assign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+      const size_t row   ( grid.row    ( i ) );
+      const size_t column( grid.column ( i ) );
+      const size_t m     ( grid.rows   ( i ) );
+      const size_t n     ( grid.columns( i ) );
+
+      if( grid.isZero( i ) ) {
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         reset( target );
+      }
+      else if( vectorizable && lhsAligned && rhsAligned ) {
+         AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+         assign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
       }
       else if( vectorizable && lhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         assign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+         assign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
       }
       else if( vectorizable && rhsAligned ) {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         assign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         assign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
       }
       else {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         assign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         assign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
       }
    }
 }
@@ -249,21 +248,25 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,rowMajo
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t rowsPerThread( (~lhs).rows() / threads + addon );
+   const TileGrid grid( ~rhs, omp_get_num_threads(), 1UL );
+   const int      tiles( static_cast<int>( grid.size() ) );
 
 #pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+   for( int i=0; i<tiles; ++i )
    {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
-         continue;
-
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
-      UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-      assign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
+      const size_t row   ( grid.row    ( i ) );
+      const size_t column( grid.column ( i ) );
+      const size_t m     ( grid.rows   ( i ) );
+      const size_t n     ( grid.columns( i ) );
+
+      if( grid.isZero( i ) ) {
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         reset( target );
+      }
+      else {
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         assign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
+      }
    }
 }
 /*! \endcond */
@@ -299,21 +302,25 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,columnM
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t colsPerThread( (~lhs).columns() / threads + addon );
+   const TileGrid grid( ~rhs, omp_get_num_threads(), 1UL );
+   const int      tiles( static_cast<int>( grid.size() ) );
 
 #pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+   for( int i=0; i<tiles; ++i )
    {
-      const size_t column( i*colsPerThread );
-
-      if( column >= (~lhs).columns() )
-         continue;
-
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
-      UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-      assign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+      const size_t row   ( grid.row    ( i ) );
+      const size_t column( grid.column ( i ) );
+      const size_t m     ( grid.rows   ( i ) );
+      const size_t n     ( grid.columns( i ) );
+
+      if( grid.isZero( i ) ) {
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         reset( target );
+      }
+      else {
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         assign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
+      }
    }
 }
 /*! \endcond */
@@ -452,37 +459,35 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMa
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).rows() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t rowsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const TileGrid grid( ~rhs, omp_get_num_threads(), ( vectorizable )?( size_t( IT::size ) ):( 1UL ) );
+   const int      tiles( static_cast<int>( grid.size() ) );
 
 #pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+   for( int i=0; i<tiles; ++i )
    {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
+      if( grid.isZero( i ) )
          continue;
 
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
+      const size_t row   ( grid.row    ( i ) );
+      const size_t column( grid.column ( i ) );
+      const size_t m     ( grid.rows   ( i ) );
+      const size_t n     ( grid.columns( i ) );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         addAssign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
+         AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+         addAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
       }
       else if( vectorizable && lhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         addAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
+         AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+         addAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
       }
       else if( vectorizable && rhsAligned ) {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         addAssign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         addAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
       }
       else {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         addAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         addAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
       }
    }
 }
@@ -526,37 +531,35 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,colum
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).columns() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t colsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const TileGrid grid( ~rhs, omp_get_num_threads(), ( vectorizable )?( size_t( IT::size ) ):( 1UL ) );
+   const int      tiles( static_cast<int>( grid.size() ) );
 
 #pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+   for( int i=0; i<tiles; ++i )
    {
-      const size_t column( i*colsPerThread );
-
-      if( column >= (~lhs).columns() )
+      if( grid.isZero( i ) )
          continue;
 
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+      const size_t row   ( grid.row    ( i ) );
+      const size_t column( grid.column ( i ) );
+      const size_t m     ( grid.rows   ( i ) );
+      const size_t n     ( grid.columns( i ) );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         addAssign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+         addAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
       }
       else if( vectorizable && lhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         addAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+         addAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
       }
       else if( vectorizable && rhsAligned ) {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         addAssign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         addAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
       }
       else {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         addAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         addAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
       }
    }
 }
@@ -594,21 +597,22 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,rowM
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t rowsPerThread( (~lhs).rows() / threads + addon );
+   const TileGrid grid( ~rhs, omp_get_num_threads(), 1UL );
+   const int      tiles( static_cast<int>( grid.size() ) );
 
 #pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+   for( int i=0; i<tiles; ++i )
    {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
+      if( grid.isZero( i ) )
          continue;
 
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
-      UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-      addAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
+      const size_t row   ( grid.row    ( i ) );
+      const size_t column( grid.column ( i ) );
+      const size_t m     ( grid.rows   ( i ) );
+      const size_t n     ( grid.columns( i ) );
+
+      UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+      addAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
    }
 }
 /*! \endcond */
@@ -645,21 +649,22 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,colu
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t colsPerThread( (~lhs).columns() / threads + addon );
+   const TileGrid grid( ~rhs, omp_get_num_threads(), 1UL );
+   const int      tiles( static_cast<int>( grid.size() ) );
 
 #pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+   for( int i=0; i<tiles; ++i )
    {
-      const size_t column( i*colsPerThread );
-
-      if( column >= (~lhs).columns() )
+      if( grid.isZero( i ) )
          continue;
 
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
-      UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-      addAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+      const size_t row   ( grid.row    ( i ) );
+      const size_t column( grid.column ( i ) );
+      const size_t m     ( grid.rows   ( i ) );
+      const size_t n     ( grid.columns( i ) );
+
+      UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+      addAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
    }
 }
 /*! \endcond */
@@ -798,37 +803,35 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMa
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).rows() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t rowsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const TileGrid grid( ~rhs, omp_get_num_threads(), ( vectorizable )?( size_t( IT::size ) ):( 1UL ) );
+   const int      tiles( static_cast<int>( grid.size() ) );
 
 #pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+   for( int i=0; i<tiles; ++i )
    {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
+      if( grid.isZero( i ) )
          continue;
 
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
+      const size_t row   ( grid.row    ( i ) );
+      const size_t column( grid.column ( i ) );
+      const size_t m     ( grid.rows   ( i ) );
+      const size_t n     ( grid.columns( i ) );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         subAssign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
+         AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+         subAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
       }
       else if( vectorizable && lhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         subAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
+         AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+         subAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
       }
       else if( vectorizable && rhsAligned ) {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         subAssign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         subAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
       }
       else {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         subAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         subAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
       }
    }
 }
@@ -872,37 +875,35 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,colum
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).columns() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t colsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const TileGrid grid( ~rhs, omp_get_num_threads(), ( vectorizable )?( size_t( IT::size ) ):( 1UL ) );
+   const int      tiles( static_cast<int>( grid.size() ) );
 
 #pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+   for( int i=0; i<tiles; ++i )
    {
-      const size_t column( i*colsPerThread );
-
-      if( column >= (~lhs).columns() )
+      if( grid.isZero( i ) )
          continue;
 
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+      const size_t row   ( grid.row    ( i ) );
+      const size_t column( grid.column ( i ) );
+      const size_t m     ( grid.rows   ( i ) );
+      const size_t n     ( grid.columns( i ) );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         subAssign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+         subAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
       }
       else if( vectorizable && lhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         subAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+         subAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
       }
       else if( vectorizable && rhsAligned ) {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         subAssign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         subAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
       }
       else {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         subAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         subAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
       }
    }
 }
@@ -940,21 +941,22 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,rowM
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t rowsPerThread( (~lhs).rows() / threads + addon );
+   const TileGrid grid( ~rhs, omp_get_num_threads(), 1UL );
+   const int      tiles( static_cast<int>( grid.size() ) );
 
 #pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+   for( int i=0; i<tiles; ++i )
    {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
+      if( grid.isZero( i ) )
          continue;
 
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
-      UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-      subAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
+      const size_t row   ( grid.row    ( i ) );
+      const size_t column( grid.column ( i ) );
+      const size_t m     ( grid.rows   ( i ) );
+      const size_t n     ( grid.columns( i ) );
+
+      UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+      subAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
    }
 }
 /*! \endcond */
@@ -991,21 +993,22 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,colu
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t colsPerThread( (~lhs).columns() / threads + addon );
+   const TileGrid grid( ~rhs, omp_get_num_threads(), 1UL );
+   const int      tiles( static_cast<int>( grid.size() ) );
 
 #pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+   for( int i=0; i<tiles; ++i )
    {
-      const size_t column( i*colsPerThread );
-
-      if( column >= (~lhs).columns() )
+      if( grid.isZero( i ) )
          continue;
 
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
-      UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-      subAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+      const size_t row   ( grid.row    ( i ) );
+      const size_t column( grid.column ( i ) );
+      const size_t m     ( grid.rows   ( i ) );
+      const size_t n     ( grid.columns( i ) );
+
+      UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+      subAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
    }
 }
 /*! \endcond */
@@ -0,0 +1,201 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/openmp/RangeKernel.h
+//  \brief Header file for the OpenMP-based SMP execution of range kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_OPENMP_RANGEKERNEL_H_
+#define _BLAZE_MATH_SMP_OPENMP_RANGEKERNEL_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <omp.h>
+#include <vector>
+#include <blaze/math/Functions.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/Ranges.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP execution of a range kernel.
+// \ingroup smp
+//
+// \param size The total number of indices.
+// \param step The number of indices per range.
+// \param kernel The range kernel.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP execution of a range
+// kernel. The range [0, \a size) is split into ranges of \a step indices, which are assigned
+// dynamically to the threads.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename KT >  // Type of the range kernel
+void smpRangeKernel_backend( size_t size, size_t step, const KT& kernel )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+   BLAZE_INTERNAL_ASSERT( step > 0UL, "Invalid range size detected" );
+
+   const int ranges( static_cast<int>( ( size + step - 1UL ) / step ) );
+
+#pragma omp parallel for schedule(dynamic,1) shared( kernel )
+   for( int r=0; r<ranges; ++r )
+   {
+      const size_t begin( size_t( r )*step );
+      const size_t end  ( min( begin+step, size ) );
+
+      kernel( begin, end );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP execution of a range kernel.
+// \ingroup smp
+//
+// \param size The total number of indices.
+// \param kernel The range kernel.
+// \param parallel \a true in case the kernel may be executed in parallel, \a false if not.
+// \return void
+//
+// This function implements the OpenMP-based SMP execution of a range kernel on the range
+// [0, \a size). The function call operator of the kernel has to process the range [\a begin,
+// \a end) of indices, different ranges have to be independent of each other. The range is
+// split into up to eight ranges per thread, which are assigned dynamically to the threads to
+// balance ranges of different cost. In case the kernel must not be executed in parallel (for
+// instance since the problem size is below the according SMP threshold) or in case the
+// function is called within a serial section, the kernel is executed single-threaded.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename KT >  // Type of the range kernel
+inline void smpRangeKernel( size_t size, const KT& kernel, bool parallel )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || !parallel ) {
+         kernel( 0UL, size );
+      }
+      else {
+         smpRangeKernel_backend( size, smpRangeSize( size, 8UL*omp_get_max_threads(), 1UL ),
+                                 kernel );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP execution of a reducing range kernel.
+// \ingroup smp
+//
+// \param size The total number of indices.
+// \param alignment The alignment of the first index of each range.
+// \param kernel The range kernel.
+// \param parallel \a true in case the kernel may be executed in parallel, \a false if not.
+// \return The combined result of the kernel.
+//
+// This function implements the OpenMP-based SMP execution of a reducing range kernel on the
+// range [0, \a size). The function call operator of the kernel has to return the result of
+// the range [\a begin, \a end), the static \c combine() function has to combine the results
+// of two consecutive ranges. The range is split into one range per thread, which starts at a
+// multiple of the given alignment. The partial results are combined in the order of the
+// ranges. In case the kernel must not be executed in parallel, in case the range does not
+// exceed a single aligned range or in case the function is called within a serial or parallel
+// section, the kernel is executed single-threaded.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of fused vector kernels. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename KT >  // Type of the range kernel
+inline typename KT::ResultType
+   smpRangeReduction( size_t size, size_t alignment, const KT& kernel, bool parallel )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef typename KT::ResultType  RT;
+
+   const size_t step( smpRangeSize( size, omp_get_max_threads(), alignment ) );
+
+   if( isSerialSectionActive() || isParallelSectionActive() || !parallel || step >= size ) {
+      return kernel( 0UL, size );
+   }
+
+   std::vector<RT> results( ( size - 1UL ) / step + 1UL );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      smpRangeKernel_backend( size, step, PartialResultKernel<KT>( kernel, step, &results[0] ) );
+   }
+
+   RT result( results[0UL] );
+   for( size_t i=1UL; i<results.size(); ++i )
+      result = KT::combine( result, results[i] );
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,278 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/openmp/Reduction.h
+//  \brief Header file for the OpenMP-based SMP reduction implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_OPENMP_REDUCTION_H_
+#define _BLAZE_MATH_SMP_OPENMP_REDUCTION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <omp.h>
+#include <vector>
+#include <blaze/math/dense/Reduction.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  DENSE VECTOR REDUCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The dense vector to be reduced.
+// \param op The reduction operation.
+// \return The reduction of all elements of the dense vector.
+//
+// This function is the backend implementation of the OpenMP-based SMP reduction of a dense
+// vector. The vector is split into one range per thread, which starts at a multiple of the
+// intrinsic vector size. The partial results of all ranges are combined in the order of the
+// ranges, which guarantees reproducible results for a fixed number of threads.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reductions. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// according reduction function (as for instance sum() or max()).
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+typename OP::ResultType smpReduce_backend( const DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef typename OP::ResultType                    RT;
+   typedef IntrinsicTrait<typename VT::ElementType>  IT;
+
+   const size_t N( (~dv).size() );
+
+   const size_t threads      ( omp_get_max_threads() );
+   const size_t addon        ( ( ( N % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( N / threads + addon );
+   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
+   const size_t sizePerThread( ( rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const size_t chunks       ( ( N + sizePerThread - 1UL ) / sizePerThread );
+
+   std::vector<RT> results( chunks );
+
+#pragma omp parallel for schedule(static,1) shared( dv, op, results )
+   for( int c=0; c<static_cast<int>( chunks ); ++c )
+   {
+      const size_t begin( size_t( c )*sizePerThread );
+      const size_t end  ( min( begin+sizePerThread, N ) );
+      results[c] = reduce( ~dv, begin, end, op );
+   }
+
+   RT result( results[0UL] );
+   for( size_t c=1UL; c<chunks; ++c )
+      result = op.combine( result, results[c] );
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The dense vector to be reduced.
+// \param op The reduction operation.
+// \return The reduction of all elements of the dense vector.
+//
+// This function implements the OpenMP-based SMP reduction of a non-empty dense vector. In case
+// the number of elements is below the SMP_DVECREDUCTION_THRESHOLD or in case the function is
+// called within a serial or parallel section, the reduction is performed single-threaded.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reductions. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// according reduction function (as for instance sum() or max()).
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline typename OP::ResultType smpReduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~dv).size() > 0UL, "Invalid vector size detected" );
+
+   if( isSerialSectionActive() || isParallelSectionActive() ||
+       (~dv).size() < getThreshold( smpDVecReductionThreshold ) ) {
+      return reduce( ~dv, 0UL, (~dv).size(), op );
+   }
+
+   typename OP::ResultType result = typename OP::ResultType();
+
+   BLAZE_PARALLEL_SECTION
+   {
+      result = smpReduce_backend( ~dv, op );
+   }
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DENSE MATRIX REDUCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP reduction of a dense matrix.
+// \ingroup smp
+//
+// \param dm The dense matrix to be reduced.
+// \param op The reduction operation.
+// \return The reduction of all elements of the dense matrix.
+//
+// This function is the backend implementation of the OpenMP-based SMP reduction of a dense
+// matrix. The rows (in case of a row-major matrix) or columns (in case of a column-major
+// matrix) are split into one range per thread. The partial results of all ranges are combined
+// in the order of the ranges, which guarantees reproducible results for a fixed number of
+// threads.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reductions. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// according reduction function (as for instance sum() or max()).
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+typename OP::ResultType smpReduce_backend( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef typename OP::ResultType  RT;
+
+   const size_t major ( ( SO )?( (~dm).columns() ):( (~dm).rows() ) );
+   const size_t chunks( min( size_t( omp_get_max_threads() ), major ) );
+
+   std::vector<RT> results( chunks );
+
+#pragma omp parallel for schedule(static,1) shared( dm, op, results )
+   for( int c=0; c<static_cast<int>( chunks ); ++c )
+   {
+      const size_t begin( ( size_t( c )*major )/chunks );
+      const size_t end  ( ( size_t( c+1 )*major )/chunks );
+      results[c] = reduce( ~dm, begin, end, op );
+   }
+
+   RT result( results[0UL] );
+   for( size_t c=1UL; c<chunks; ++c )
+      result = op.combine( result, results[c] );
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP reduction of a dense matrix.
+// \ingroup smp
+//
+// \param dm The dense matrix to be reduced.
+// \param op The reduction operation.
+// \return The reduction of all elements of the dense matrix.
+//
+// This function implements the OpenMP-based SMP reduction of a non-empty dense matrix. In case
+// the number of rows/columns is below the SMP_DMATREDUCTION_THRESHOLD or in case the function
+// is called within a serial or parallel section, the reduction is performed single-threaded.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reductions. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// according reduction function (as for instance sum() or max()).
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+inline typename OP::ResultType smpReduce( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~dm).rows()    > 0UL, "Invalid number of rows detected"    );
+   BLAZE_INTERNAL_ASSERT( (~dm).columns() > 0UL, "Invalid number of columns detected" );
+
+   const size_t major( ( SO )?( (~dm).columns() ):( (~dm).rows() ) );
+
+   if( isSerialSectionActive() || isParallelSectionActive() ||
+       major < getThreshold( smpDMatReductionThreshold ) ) {
+      return reduce( ~dm, 0UL, major, op );
+   }
+
+   typename OP::ResultType result = typename OP::ResultType();
+
+   BLAZE_PARALLEL_SECTION
+   {
+      result = smpReduce_backend( ~dm, op );
+   }
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,204 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/openmp/SparseMatrix.h
+//  \brief Header file for the OpenMP-based sparse matrix SMP implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_OPENMP_SPARSEMATRIX_H_
+#define _BLAZE_MATH_SMP_OPENMP_SPARSEMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <omp.h>
+#include <algorithm>
+#include <vector>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/smp/default/SparseMatrix.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PLAIN ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based kernel-based assignment to a compressed matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side compressed matrix.
+// \param kernel The kernel for the computation of single rows/columns of the right-hand side.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based kernel-based assignment to
+// a compressed matrix. The assignment is performed in three steps: First, the exact number of
+// non-zero elements of each row/column is computed in parallel (symbolic pass). Second, the
+// row/column structure of the result is set up based on the prefix sum of these numbers.
+// Third, the elements of all rows/columns are computed and appended in parallel (numeric
+// pass). Since the rows/columns of the result don't share any memory, no synchronization is
+// required during the numeric pass. In order to balance the work between the threads the
+// rows/columns are distributed in several chunks per thread, which in the numeric pass
+// contain approximately the same number of non-zero elements.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the compressed matrix
+        , bool SO        // Storage order of the compressed matrix
+        , typename IT    // Index type of the compressed matrix
+        , typename KT >  // Type of the row/column kernel
+void smpSparseAssign_backend( CompressedMatrix<Type,SO,IT>& lhs, const KT& kernel )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef CompressedMatrix<Type,SO,IT>  Target;
+
+   const size_t major ( ( SO )?( lhs.columns() ):( lhs.rows() ) );
+   const size_t chunks( min( 8UL*size_t( omp_get_max_threads() ), major ) );
+
+   std::vector<size_t> nonzeros( major, 0UL );
+
+   // Symbolic pass: Counting the non-zero elements of all rows/columns
+#pragma omp parallel shared( kernel, nonzeros )
+   {
+      KT local( kernel );
+
+#pragma omp for schedule(dynamic,1)
+      for( int c=0; c<static_cast<int>( chunks ); ++c )
+      {
+         const size_t begin( ( size_t( c )*major )/chunks );
+         const size_t end  ( ( size_t( c+1 )*major )/chunks );
+
+         for( size_t i=begin; i<end; ++i )
+            nonzeros[i] = local.nonZeros( i );
+      }
+   }
+
+   // Setting up the row/column structure of the result
+   Target tmp( lhs.rows(), lhs.columns(), nonzeros );
+
+   // Numeric pass: Computing the elements of all rows/columns
+   std::vector<size_t> work( major+1UL, 0UL );
+   for( size_t i=0UL; i<major; ++i ) {
+      work[i+1UL] = work[i] + nonzeros[i] + 1UL;
+   }
+
+#pragma omp parallel shared( kernel, tmp, work )
+   {
+      KT local( kernel );
+
+#pragma omp for schedule(dynamic,1)
+      for( int c=0; c<static_cast<int>( chunks ); ++c )
+      {
+         const size_t lower( ( size_t( c )*work[major] )/chunks );
+         const size_t upper( ( size_t( c+1 )*work[major] )/chunks );
+         const size_t begin( std::lower_bound( work.begin(), work.end(), lower ) - work.begin() );
+         const size_t end  ( std::lower_bound( work.begin(), work.end(), upper ) - work.begin() );
+
+         for( size_t i=begin; i<end; ++i )
+            local.assign( tmp, i );
+      }
+   }
+
+   lhs.swap( tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based kernel-based assignment to a compressed matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side compressed matrix.
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \param kernel The kernel for the computation of single rows/columns of the right-hand side.
+// \return void
+//
+// This function implements the OpenMP-based kernel-based assignment of a sparse matrix to a
+// compressed matrix. Due to the explicit application of the SFINAE principle, this function
+// can only be selected by the compiler in case the element type of the compressed matrix is
+// not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the compressed matrix
+        , bool SO        // Storage order of both sparse matrices
+        , typename IT    // Index type of the compressed matrix
+        , typename MT    // Type of the right-hand side sparse matrix
+        , typename KT >  // Type of the row/column kernel
+inline typename DisableIf< IsSMPAssignable<Type> >::Type
+   smpSparseAssign( CompressedMatrix<Type,SO,IT>& lhs, const SparseMatrix<MT,SO>& rhs,
+                    const KT& kernel )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( lhs.rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( lhs.columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         assign( lhs, ~rhs );
+      }
+      else {
+         smpSparseAssign_backend( lhs, kernel );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -48,6 +48,7 @@
 #include <blaze/math/intrinsics/IntrinsicTrait.h>
 #include <blaze/math/smp/ParallelSection.h>
 #include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/TileGrid.h>
 #include <blaze/math/smp/threads/ThreadBackend.h>
 #include <blaze/math/SparseSubmatrix.h>
 #include <blaze/math/StorageOrder.h>
@@ -110,36 +111,34 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMajor
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).rows() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t rowsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const TileGrid grid( ~rhs, TheThreadBackend::size(), ( vectorizable )?( size_t( IT::size ) ):( 1UL ) );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<grid.size(); ++i )
    {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
-         continue;
-
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
-
-      if( vectorizable && lhsAligned && rhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleAssign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
+      const size_t row   ( grid.row    ( i ) );
+      const size_t column( grid.column ( i ) );
+      const size_t m     ( grid.rows   ( i ) );
+      const size_t n     ( grid.columns( i ) );
+
+      if( grid.isZero( i ) ) {
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         TheThreadBackend::scheduleReset( target );
+      }
+      else if( vectorizable && lhsAligned && rhsAligned ) {
+         AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+         TheThreadBackend::scheduleAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
       }
       else if( vectorizable && lhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
+         AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+         TheThreadBackend::scheduleAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
       }
       else if( vectorizable && rhsAligned ) {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleAssign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         TheThreadBackend::scheduleAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
       }
       else {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         TheThreadBackend::scheduleAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
       }
    }
 
@@ -185,36 +184,34 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,columnMa
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).columns() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t colsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const TileGrid grid( ~rhs, TheThreadBackend::size(), ( vectorizable )?( size_t( IT::size ) ):( 1UL ) );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<grid.size(); ++i )
    {
-      const size_t column( i*colsPerThread );
-
-      if( column >= (~lhs).columns() )
-         continue;
-
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
-
-      if( vectorizable && lhsAligned && rhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleAssign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+      const size_t row   ( grid.row    ( i ) );
+      const size_t column( grid.column ( i ) );
+      const size_t m     ( grid.rows   ( i ) );
+      const size_t n     ( grid.columns( i ) );
+
+      if( grid.isZero( i ) ) {
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         TheThreadBackend::scheduleReset( target );
+      }
+      else if( vectorizable && lhsAligned && rhsAligned ) {
+         AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+         TheThreadBackend::scheduleAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
       }
       else if( vectorizable && lhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+         TheThreadBackend::scheduleAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
       }
       else if( vectorizable && rhsAligned ) {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleAssign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         TheThreadBackend::scheduleAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
       }
       else {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         TheThreadBackend::scheduleAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
       }
    }
 
@@ -254,20 +251,23 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,rowMajo
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t rowsPerThread( (~lhs).rows() / threads + addon );
+   const TileGrid grid( ~rhs, TheThreadBackend::size(), 1UL );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<grid.size(); ++i )
    {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
-         continue;
-
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
-      UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-      TheThreadBackend::scheduleAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
+      const size_t row   ( grid.row    ( i ) );
+      const size_t column( grid.column ( i ) );
+      const size_t m     ( grid.rows   ( i ) );
+      const size_t n     ( grid.columns( i ) );
+
+      if( grid.isZero( i ) ) {
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         TheThreadBackend::scheduleReset( target );
+      }
+      else {
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         TheThreadBackend::scheduleAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
+      }
    }
 
    TheThreadBackend::wait();
@@ -306,20 +306,23 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,columnM
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t colsPerThread( (~lhs).columns() / threads + addon );
+   const TileGrid grid( ~rhs, TheThreadBackend::size(), 1UL );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<grid.size(); ++i )
    {
-      const size_t column( i*colsPerThread );
-
-      if( column >= (~lhs).columns() )
-         continue;
-
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
-      UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-      TheThreadBackend::scheduleAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+      const size_t row   ( grid.row    ( i ) );
+      const size_t column( grid.column ( i ) );
+      const size_t m     ( grid.rows   ( i ) );
+      const size_t n     ( grid.columns( i ) );
+
+      if( grid.isZero( i ) ) {
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         TheThreadBackend::scheduleReset( target );
+      }
+      else {
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         TheThreadBackend::scheduleAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
+      }
    }
 
    TheThreadBackend::wait();
@@ -459,36 +462,33 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMa
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).rows() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t rowsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const TileGrid grid( ~rhs, TheThreadBackend::size(), ( vectorizable )?( size_t( IT::size ) ):( 1UL ) );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<grid.size(); ++i )
    {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
+      if( grid.isZero( i ) )
          continue;
 
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
+      const size_t row   ( grid.row    ( i ) );
+      const size_t column( grid.column ( i ) );
+      const size_t m     ( grid.rows   ( i ) );
+      const size_t n     ( grid.columns( i ) );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleAddAssign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
+         AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+         TheThreadBackend::scheduleAddAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
       }
       else if( vectorizable && lhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleAddAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
+         AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+         TheThreadBackend::scheduleAddAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
       }
       else if( vectorizable && rhsAligned ) {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleAddAssign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         TheThreadBackend::scheduleAddAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
       }
       else {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleAddAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         TheThreadBackend::scheduleAddAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
       }
    }
 
@@ -534,36 +534,33 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,colum
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).columns() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t colsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const TileGrid grid( ~rhs, TheThreadBackend::size(), ( vectorizable )?( size_t( IT::size ) ):( 1UL ) );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<grid.size(); ++i )
    {
-      const size_t column( i*colsPerThread );
-
-      if( column >= (~lhs).columns() )
+      if( grid.isZero( i ) )
          continue;
 
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+      const size_t row   ( grid.row    ( i ) );
+      const size_t column( grid.column ( i ) );
+      const size_t m     ( grid.rows   ( i ) );
+      const size_t n     ( grid.columns( i ) );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleAddAssign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+         TheThreadBackend::scheduleAddAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
       }
       else if( vectorizable && lhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleAddAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+         TheThreadBackend::scheduleAddAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
       }
       else if( vectorizable && rhsAligned ) {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleAddAssign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         TheThreadBackend::scheduleAddAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
       }
       else {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleAddAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         TheThreadBackend::scheduleAddAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
       }
    }
 
@@ -603,20 +600,20 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,rowM
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t rowsPerThread( (~lhs).rows() / threads + addon );
+   const TileGrid grid( ~rhs, TheThreadBackend::size(), 1UL );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<grid.size(); ++i )
    {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
+      if( grid.isZero( i ) )
          continue;
 
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
-      UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-      TheThreadBackend::scheduleAddAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
+      const size_t row   ( grid.row    ( i ) );
+      const size_t column( grid.column ( i ) );
+      const size_t m     ( grid.rows   ( i ) );
+      const size_t n     ( grid.columns( i ) );
+
+      UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+      TheThreadBackend::scheduleAddAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
    }
 
    TheThreadBackend::wait();
@@ -655,20 +652,20 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,colu
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t colsPerThread( (~lhs).columns() / threads + addon );
+   const TileGrid grid( ~rhs, TheThreadBackend::size(), 1UL );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<grid.size(); ++i )
    {
-      const size_t column( i*colsPerThread );
-
-      if( column >= (~lhs).columns() )
+      if( grid.isZero( i ) )
          continue;
 
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
-      UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-      TheThreadBackend::scheduleAddAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+      const size_t row   ( grid.row    ( i ) );
+      const size_t column( grid.column ( i ) );
+      const size_t m     ( grid.rows   ( i ) );
+      const size_t n     ( grid.columns( i ) );
+
+      UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+      TheThreadBackend::scheduleAddAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
    }
 
    TheThreadBackend::wait();
@@ -809,36 +806,33 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMa
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).rows() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t rowsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const TileGrid grid( ~rhs, TheThreadBackend::size(), ( vectorizable )?( size_t( IT::size ) ):( 1UL ) );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<grid.size(); ++i )
    {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
+      if( grid.isZero( i ) )
          continue;
 
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
+      const size_t row   ( grid.row    ( i ) );
+      const size_t column( grid.column ( i ) );
+      const size_t m     ( grid.rows   ( i ) );
+      const size_t n     ( grid.columns( i ) );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleSubAssign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
+         AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+         TheThreadBackend::scheduleSubAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
       }
       else if( vectorizable && lhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleSubAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
+         AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+         TheThreadBackend::scheduleSubAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
       }
       else if( vectorizable && rhsAligned ) {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleSubAssign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         TheThreadBackend::scheduleSubAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
       }
       else {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleSubAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         TheThreadBackend::scheduleSubAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
       }
    }
 
@@ -884,36 +878,33 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,colum
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).columns() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t colsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const TileGrid grid( ~rhs, TheThreadBackend::size(), ( vectorizable )?( size_t( IT::size ) ):( 1UL ) );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<grid.size(); ++i )
    {
-      const size_t column( i*colsPerThread );
-
-      if( column >= (~lhs).columns() )
+      if( grid.isZero( i ) )
          continue;
 
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+      const size_t row   ( grid.row    ( i ) );
+      const size_t column( grid.column ( i ) );
+      const size_t m     ( grid.rows   ( i ) );
+      const size_t n     ( grid.columns( i ) );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleSubAssign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+         TheThreadBackend::scheduleSubAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
       }
       else if( vectorizable && lhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleSubAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+         TheThreadBackend::scheduleSubAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
       }
       else if( vectorizable && rhsAligned ) {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleSubAssign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         TheThreadBackend::scheduleSubAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
       }
       else {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleSubAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         TheThreadBackend::scheduleSubAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
       }
    }
 
@@ -953,20 +944,20 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,rowM
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t rowsPerThread( (~lhs).rows() / threads + addon );
+   const TileGrid grid( ~rhs, TheThreadBackend::size(), 1UL );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<grid.size(); ++i )
    {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
+      if( grid.isZero( i ) )
          continue;
 
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
-      UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-      TheThreadBackend::scheduleSubAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
+      const size_t row   ( grid.row    ( i ) );
+      const size_t column( grid.column ( i ) );
+      const size_t m     ( grid.rows   ( i ) );
+      const size_t n     ( grid.columns( i ) );
+
+      UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+      TheThreadBackend::scheduleSubAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
    }
 
    TheThreadBackend::wait();
@@ -1005,20 +996,20 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,colu
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t colsPerThread( (~lhs).columns() / threads + addon );
+   const TileGrid grid( ~rhs, TheThreadBackend::size(), 1UL );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<grid.size(); ++i )
    {
-      const size_t column( i*colsPerThread );
-
-      if( column >= (~lhs).columns() )
+      if( grid.isZero( i ) )
          continue;
 
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
-      UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-      TheThreadBackend::scheduleSubAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+      const size_t row   ( grid.row    ( i ) );
+      const size_t column( grid.column ( i ) );
+      const size_t m     ( grid.rows   ( i ) );
+      const size_t n     ( grid.columns( i ) );
+
+      UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+      TheThreadBackend::scheduleSubAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
    }
 
    TheThreadBackend::wait();
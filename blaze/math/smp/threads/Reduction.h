@@ -0,0 +1,344 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/Reduction.h
+//  \brief Header file for the C++11/Boost thread-based SMP reduction implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADS_REDUCTION_H_
+#define _BLAZE_MATH_SMP_THREADS_REDUCTION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/dense/Reduction.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary functor for the threaded reduction of a dense vector or matrix.
+// \ingroup smp
+//
+// The ReductionTask class template reduces a range of elements of a dense vector or a range of
+// rows/columns of a dense matrix and stores the partial result at the given location.
+*/
+template< typename T     // Type of the dense vector or matrix
+        , typename OP >  // Type of the reduction operation
+struct ReductionTask
+{
+   //**Type definitions****************************************************************************
+   typedef typename OP::ResultType  ResultType;  //!< Resulting type of the reduction.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the ReductionTask class template.
+   //
+   // \param operand The dense vector or matrix to be reduced.
+   // \param begin The index of the first element/row/column of the range.
+   // \param end The index one past the last element/row/column of the range.
+   // \param op The reduction operation.
+   // \param result The location of the partial result.
+   */
+   explicit inline ReductionTask( const T& operand, size_t begin, size_t end,
+                                  OP op, ResultType* result )
+      : operand_( operand )  // The dense vector or matrix to be reduced
+      , begin_  ( begin   )  // The index of the first element/row/column of the range
+      , end_    ( end     )  // The index one past the last element/row/column of the range
+      , op_     ( op      )  // The reduction operation
+      , result_ ( result  )  // The location of the partial result
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Reduces the range of elements/rows/columns.
+   //
+   // \return void
+   */
+   inline void operator()() {
+      *result_ = reduce( operand_, begin_, end_, op_ );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   const T&    operand_;  //!< The dense vector or matrix to be reduced.
+   size_t      begin_;    //!< The index of the first element/row/column of the range.
+   size_t      end_;      //!< The index one past the last element/row/column of the range.
+   OP          op_;       //!< The reduction operation.
+   ResultType* result_;   //!< The location of the partial result.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DENSE VECTOR REDUCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The dense vector to be reduced.
+// \param op The reduction operation.
+// \return The reduction of all elements of the dense vector.
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP reduction
+// of a dense vector. The vector is split into one range per thread, which starts at a multiple
+// of the intrinsic vector size. The partial results of all ranges are combined in the order of
+// the ranges.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reductions. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// according reduction function (as for instance sum() or max()).
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+typename OP::ResultType smpReduce_backend( const DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef typename OP::ResultType                    RT;
+   typedef IntrinsicTrait<typename VT::ElementType>  IT;
+
+   const size_t N( (~dv).size() );
+
+   const size_t threads      ( TheThreadBackend::size() );
+   const size_t addon        ( ( ( N % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( N / threads + addon );
+   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
+   const size_t sizePerThread( ( rest )?( equalShare - rest + IT::size ):( equalShare ) );
+
+   std::vector<RT> results( threads );
+   size_t count( 0UL );
+
+   for( ; count<threads && count*sizePerThread<N; ++count ) {
+      const size_t begin( count*sizePerThread );
+      const size_t end  ( min( begin+sizePerThread, N ) );
+      TheThreadBackend::schedule( ReductionTask<VT,OP>( ~dv, begin, end, op, &results[count] ) );
+   }
+
+   TheThreadBackend::wait();
+
+   RT result( results[0UL] );
+   for( size_t i=1UL; i<count; ++i )
+      result = op.combine( result, results[i] );
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The dense vector to be reduced.
+// \param op The reduction operation.
+// \return The reduction of all elements of the dense vector.
+//
+// This function implements the C++11/Boost thread-based SMP reduction of a non-empty dense
+// vector. In case the number of elements is below the SMP_DVECREDUCTION_THRESHOLD or in case
+// the function is called within a serial or parallel section, the reduction is performed
+// single-threaded.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reductions. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// according reduction function (as for instance sum() or max()).
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline typename OP::ResultType smpReduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~dv).size() > 0UL, "Invalid vector size detected" );
+
+   if( isSerialSectionActive() || isParallelSectionActive() ||
+       (~dv).size() < getThreshold( smpDVecReductionThreshold ) ) {
+      return reduce( ~dv, 0UL, (~dv).size(), op );
+   }
+
+   typename OP::ResultType result = typename OP::ResultType();
+
+   BLAZE_PARALLEL_SECTION
+   {
+      result = smpReduce_backend( ~dv, op );
+   }
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DENSE MATRIX REDUCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP reduction of a dense matrix.
+// \ingroup smp
+//
+// \param dm The dense matrix to be reduced.
+// \param op The reduction operation.
+// \return The reduction of all elements of the dense matrix.
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP reduction
+// of a dense matrix. The rows (in case of a row-major matrix) or columns (in case of a
+// column-major matrix) are split into one range per thread. The partial results of all ranges
+// are combined in the order of the ranges.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reductions. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// according reduction function (as for instance sum() or max()).
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+typename OP::ResultType smpReduce_backend( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef typename OP::ResultType  RT;
+
+   const size_t major ( ( SO )?( (~dm).columns() ):( (~dm).rows() ) );
+   const size_t chunks( min( TheThreadBackend::size(), major ) );
+
+   std::vector<RT> results( chunks );
+
+   for( size_t c=0UL; c<chunks; ++c ) {
+      const size_t begin( ( c*major )/chunks );
+      const size_t end  ( ( (c+1UL)*major )/chunks );
+      TheThreadBackend::schedule( ReductionTask<MT,OP>( ~dm, begin, end, op, &results[c] ) );
+   }
+
+   TheThreadBackend::wait();
+
+   RT result( results[0UL] );
+   for( size_t c=1UL; c<chunks; ++c )
+      result = op.combine( result, results[c] );
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP reduction of a dense matrix.
+// \ingroup smp
+//
+// \param dm The dense matrix to be reduced.
+// \param op The reduction operation.
+// \return The reduction of all elements of the dense matrix.
+//
+// This function implements the C++11/Boost thread-based SMP reduction of a non-empty dense
+// matrix. In case the number of rows/columns is below the SMP_DMATREDUCTION_THRESHOLD or in
+// case the function is called within a serial or parallel section, the reduction is performed
+// single-threaded.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reductions. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// according reduction function (as for instance sum() or max()).
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+inline typename OP::ResultType smpReduce( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~dm).rows()    > 0UL, "Invalid number of rows detected"    );
+   BLAZE_INTERNAL_ASSERT( (~dm).columns() > 0UL, "Invalid number of columns detected" );
+
+   const size_t major( ( SO )?( (~dm).columns() ):( (~dm).rows() ) );
+
+   if( isSerialSectionActive() || isParallelSectionActive() ||
+       major < getThreshold( smpDMatReductionThreshold ) ) {
+      return reduce( ~dm, 0UL, major, op );
+   }
+
+   typename OP::ResultType result = typename OP::ResultType();
+
+   BLAZE_PARALLEL_SECTION
+   {
+      result = smpReduce_backend( ~dm, op );
+   }
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -53,6 +53,7 @@
 #include <cstdlib>
 #include <blaze/math/constraints/Expression.h>
 #include <blaze/math/Functions.h>
+#include <blaze/math/smp/threads/WorkStealingBackend.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/constraints/Const.h>
 #include <blaze/util/StaticAssert.h>
@@ -98,6 +99,9 @@ class ThreadBackend
    //**Thread execution functions******************************************************************
    /*!\name Thread execution functions */
    //@{
+   template< typename Callable >
+   static inline void schedule( const Callable& func );
+
    template< typename Target, typename Source >
    static inline void scheduleAssign( Target& target, const Source& source );
 
@@ -109,6 +113,9 @@ class ThreadBackend
 
    template< typename Target, typename Source >
    static inline void scheduleMultAssign( Target& target, const Source& source );
+
+   template< typename Target >
+   static inline void scheduleReset( Target& target );
    //@}
    //**********************************************************************************************
 
@@ -277,6 +284,42 @@ class ThreadBackend
    };
    //**********************************************************************************************
 
+   //**Private class Resetter**********************************************************************
+   /*!\brief Auxiliary functor for the threaded reset of a target operand.
+   */
+   template< typename Target >  // Type of the target operand
+   struct Resetter
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Resetter class template.
+      //
+      // \param target The target operand to be reset.
+      */
+      explicit inline Resetter( Target& target )
+         : target_( target )  // The target operand
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Resets the target operand.
+      //
+      // \return void
+      */
+      inline void operator()() {
+         reset( target_ );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      Target target_;  //!< The target operand.
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      BLAZE_CONSTRAINT_MUST_BE_EXPRESSION_TYPE( Target );
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
    //**Initialization functions********************************************************************
    /*!\name Initialization functions */
    //@{
@@ -398,6 +441,28 @@ inline void ThreadBackend<TT,MT,LT,CT>::wait()
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling the given callable for execution.
+//
+// \param func The callable to be executed.
+// \return void
+//
+// This function schedules a copy of the given callable for execution.
+*/
+template< typename TT          // Type of the encapsulated thread
+        , typename MT          // Type of the synchronization mutex
+        , typename LT          // Type of the mutex lock
+        , typename CT >        // Type of the condition variable
+template< typename Callable >  // Type of the callable
+inline void ThreadBackend<TT,MT,LT,CT>::schedule( const Callable& func )
+{
+   threadpool_.schedule( func );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Scheduling an assignment of the given operands for execution.
@@ -498,6 +563,29 @@ inline void ThreadBackend<TT,MT,LT,CT>::scheduleMultAssign( Target& target, cons
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling a reset of the given target operand for execution.
+//
+// \param target The target operand to be reset.
+// \return void
+//
+// This function schedules a reset of the given target operand for execution.
+*/
+template< typename TT        // Type of the encapsulated thread
+        , typename MT        // Type of the synchronization mutex
+        , typename LT        // Type of the mutex lock
+        , typename CT >      // Type of the condition variable
+template< typename Target >  // Type of the target operand
+inline void ThreadBackend<TT,MT,LT,CT>::scheduleReset( Target& target )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
+   threadpool_.schedule( Resetter<Target>( target ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -554,9 +642,24 @@ inline size_t ThreadBackend<TT,MT,LT,CT>::initPool()
 //
 // This type represents the active thread backend system. This backend system must be used to
 // manage the active number of threads used to execute operations and to schedule tasks to be
-// executed.
+// executed. In case the \c BLAZE_USE_WORK_STEALING command line argument is specified, the
+// work-stealing backend system is used instead of the default thread backend system.
 */
-#if BLAZE_CPP_THREADS_PARALLEL_MODE
+#if BLAZE_WORK_STEALING_PARALLEL_MODE && BLAZE_CPP_THREADS_PARALLEL_MODE
+typedef WorkStealingBackend< std::thread
+                           , std::mutex
+                           , std::unique_lock< std::mutex >
+                           , std::condition_variable
+                           , std::atomic
+                           >  TheThreadBackend;
+#elif BLAZE_WORK_STEALING_PARALLEL_MODE && BLAZE_BOOST_THREADS_PARALLEL_MODE
+typedef WorkStealingBackend< boost::thread
+                           , boost::mutex
+                           , boost::unique_lock< boost::mutex >
+                           , boost::condition_variable
+                           , boost::atomic
+                           >  TheThreadBackend;
+#elif BLAZE_CPP_THREADS_PARALLEL_MODE
 typedef ThreadBackend< std::thread
                      , std::mutex
                      , std::unique_lock< std::mutex >
@@ -0,0 +1,1486 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/WorkStealingBackend.h
+//  \brief Header file for the work-stealing C++11 and Boost thread backend
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADS_WORKSTEALINGBACKEND_H_
+#define _BLAZE_MATH_SMP_THREADS_WORKSTEALINGBACKEND_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/SMP.h>
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE
+#  include <atomic>
+#  include <condition_variable>
+#  include <mutex>
+#  include <thread>
+#elif BLAZE_BOOST_THREADS_PARALLEL_MODE
+#  include <boost/atomic.hpp>
+#  include <boost/thread/condition.hpp>
+#  include <boost/thread/mutex.hpp>
+#  include <boost/thread/thread.hpp>
+#endif
+
+#include <cstdlib>
+#include <new>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/constraints/Expression.h>
+#include <blaze/math/Functions.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Work-stealing backend system for the C++11 and Boost thread-based parallelization.
+// \ingroup smp
+//
+// The WorkStealingBackend class template is an alternative to the ThreadBackend class template
+// that provides the same interface, but schedules tasks via a work-stealing scheduler instead
+// of a single, mutex protected task queue. Each worker thread owns a lock-free deque (according
+// to Chase and Lev) from which it executes its own tasks in LIFO order and from which idle
+// threads steal in FIFO order. Tasks are stored in a fixed number of preallocated task slots
+// per thread that are recycled after the execution of a task, i.e. scheduling a task does not
+// require any dynamic memory allocation.
+//
+// The wait() function only waits for the tasks that have been scheduled by the calling thread
+// on its current nesting level and executes pending tasks while waiting. Therefore tasks are
+// allowed to schedule tasks themselves (i.e. SMP assignments may be nested) without blocking a
+// worker thread or serializing the nested operation. Threads that are not part of the backend
+// system (as for instance the main thread) share a single context, i.e. SMP assignments started
+// by several of these threads concurrently are executed one after another.\n
+// This class must \b NOT be used explicitly! It is reserved for internal use only. Using
+// this class explicitly might result in erroneous results and/or in undefined behavior.
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic wrapper
+class WorkStealingBackend
+{
+ public:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline size_t size  ();
+   static inline void   resize( size_t n, bool block=false );
+   static inline void   wait  ();
+   //@}
+   //**********************************************************************************************
+
+   //**Thread execution functions******************************************************************
+   /*!\name Thread execution functions */
+   //@{
+   template< typename Callable >
+   static inline void schedule( const Callable& func );
+
+   template< typename Target, typename Source >
+   static inline void scheduleAssign( Target& target, const Source& source );
+
+   template< typename Target, typename Source >
+   static inline void scheduleAddAssign( Target& target, const Source& source );
+
+   template< typename Target, typename Source >
+   static inline void scheduleSubAssign( Target& target, const Source& source );
+
+   template< typename Target, typename Source >
+   static inline void scheduleMultAssign( Target& target, const Source& source );
+
+   template< typename Target >
+   static inline void scheduleReset( Target& target );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   typedef typename TT::id  ThreadID;  //!< Type of the thread identifiers.
+   //**********************************************************************************************
+
+   //**Compile time constants**********************************************************************
+   enum { taskCapacity = 256 };  //!< Number of preallocated task slots per thread.
+   enum { storageSize  = 256 };  //!< Number of bytes of the in-place storage of a task slot.
+   enum { maxDepth     =  64 };  //!< Maximum nesting depth of scheduled tasks.
+   enum { spinCount    = 128 };  //!< Number of unsuccessful steal attempts before sleeping.
+   //**********************************************************************************************
+
+   //**Private class Task**************************************************************************
+   /*!\brief Preallocated, recyclable slot for a single scheduled task.
+   //
+   // The given callable is copied into the in-place storage of the slot. Only in case it does
+   // not fit into this storage it is allocated dynamically. The slot is marked as busy by the
+   // scheduling thread and released by the thread that has executed the task.
+   */
+   struct Task : private NonCopyable
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Default constructor for the Task class.
+      */
+      inline Task()
+         : invoke_ ( NULL )  // Type-erased execution function
+         , object_ ( NULL )  // The stored callable
+         , pending_( NULL )  // Counter of the pending tasks of the scheduling thread
+      {
+         busy_.store( false );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      void (*invoke_)( void* );  //!< Type-erased execution function.
+      void* object_;             //!< The stored callable.
+      AT<size_t>* pending_;      //!< Counter of the pending tasks of the scheduling thread.
+      AT<bool> busy_;            //!< Occupation flag of the task slot.
+
+      union {
+         char        bytes_[storageSize];  //!< In-place storage for the callable.
+         long double alignLongDouble_;     //!< Alignment helper.
+         void*       alignPointer_;        //!< Alignment helper.
+         size_t      alignSize_;           //!< Alignment helper.
+      } storage_;                          //!< In-place storage for the callable.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Private class Deque*************************************************************************
+   /*!\brief Lock-free work-stealing deque of a single thread.
+   //
+   // This class implements the fixed-size variant of the work-stealing deque by Chase and Lev.
+   // Only the owning thread is allowed to push and pop tasks at the bottom of the deque, all
+   // other threads may concurrently steal tasks from the top of the deque. Since the capacity
+   // of the deque equals the number of task slots of a thread, a push operation never fails.
+   */
+   class Deque : private NonCopyable
+   {
+    public:
+      //**Constructor******************************************************************************
+      /*!\brief Default constructor for the Deque class.
+      */
+      inline Deque()
+      {
+         top_.store( 0 );
+         bottom_.store( 0 );
+      }
+      //*******************************************************************************************
+
+      //**Push function****************************************************************************
+      /*!\brief Adding a task at the bottom of the deque (owner only).
+      //
+      // \param task The task to be added.
+      // \return \a true if the task was added, \a false if the deque is full.
+      */
+      inline bool push( Task* task ) {
+         const ptrdiff_t b( bottom_.load() );
+         const ptrdiff_t t( top_.load() );
+         if( b - t >= ptrdiff_t( taskCapacity ) )
+            return false;
+         buffer_[b % taskCapacity].store( task );
+         bottom_.store( b+1 );
+         return true;
+      }
+      //*******************************************************************************************
+
+      //**Pop function*****************************************************************************
+      /*!\brief Removing the task at the bottom of the deque (owner only).
+      //
+      // \return The removed task or \a NULL in case the deque is empty.
+      */
+      inline Task* pop() {
+         const ptrdiff_t b( bottom_.load() - 1 );
+         bottom_.store( b );
+         ptrdiff_t t( top_.load() );
+         if( t > b ) {
+            bottom_.store( b+1 );
+            return NULL;
+         }
+         Task* task( buffer_[b % taskCapacity].load() );
+         if( t == b ) {
+            if( !top_.compare_exchange_strong( t, t+1 ) )
+               task = NULL;
+            bottom_.store( b+1 );
+         }
+         return task;
+      }
+      //*******************************************************************************************
+
+      //**Steal function***************************************************************************
+      /*!\brief Removing the task at the top of the deque (any thread).
+      //
+      // \return The removed task or \a NULL in case the deque is empty or the race was lost.
+      */
+      inline Task* steal() {
+         ptrdiff_t t( top_.load() );
+         const ptrdiff_t b( bottom_.load() );
+         if( t >= b )
+            return NULL;
+         Task* task( buffer_[t % taskCapacity].load() );
+         if( !top_.compare_exchange_strong( t, t+1 ) )
+            return NULL;
+         return task;
+      }
+      //*******************************************************************************************
+
+      //**Empty function***************************************************************************
+      /*!\brief Returns whether the deque is (currently) empty.
+      //
+      // \return \a true if the deque is empty, \a false if not.
+      */
+      inline bool empty() const {
+         return bottom_.load() <= top_.load();
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      AT<ptrdiff_t> top_;                  //!< Index of the top of the deque.
+      AT<Task*> buffer_[taskCapacity];     //!< Circular buffer of the scheduled tasks.
+      AT<ptrdiff_t> bottom_;               //!< Index of the bottom of the deque.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Private class Context***********************************************************************
+   /*!\brief Scheduling context of a single thread.
+   //
+   // A context contains the deque and the task slots of a thread, the current nesting depth of
+   // the executed tasks and one counter of pending tasks per nesting level. All data members
+   // except for the deque, the task slots and the counters are accessed by the owning thread
+   // only.
+   */
+   struct Context : private NonCopyable
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Default constructor for the Context class.
+      */
+      inline Context()
+         : deque_ ()  // The work-stealing deque of the thread
+         , next_  ()  // Index of the next task slot to be probed
+         , victim_()  // Index of the next context to steal from
+         , depth_ ()  // Current nesting depth
+         , id_    ()  // Identifier of the owning thread
+      {
+         for( size_t i=0UL; i<=size_t( maxDepth ); ++i )
+            pending_[i].store( 0UL );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      Deque deque_;                    //!< The work-stealing deque of the thread.
+      Task tasks_[taskCapacity];       //!< The preallocated task slots of the thread.
+      size_t next_;                    //!< Index of the next task slot to be probed.
+      size_t victim_;                  //!< Index of the next context to steal from.
+      size_t depth_;                   //!< Current nesting depth.
+      ThreadID id_;                    //!< Identifier of the owning thread.
+      AT<size_t> pending_[maxDepth+1];  //!< Number of pending tasks per nesting level.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Private class Runner************************************************************************
+   /*!\brief Auxiliary functor for the main loop of a worker thread.
+   */
+   struct Runner
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Runner class.
+      //
+      // \param context The context of the worker thread.
+      */
+      explicit inline Runner( Context* context )
+         : context_( context )  // The context of the worker thread
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Executes the main loop of the worker thread.
+      //
+      // \return void
+      */
+      inline void operator()() {
+         run( *context_ );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      Context* context_;  //!< The context of the worker thread.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Private class Pool**************************************************************************
+   /*!\brief The state of the work-stealing backend system.
+   */
+   struct Pool : private NonCopyable
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Pool class.
+      //
+      // \param n The initial number of worker threads.
+      */
+      explicit inline Pool( size_t n )
+         : workers_      ()  // The contexts of the worker threads
+         , threads_      ()  // The worker threads
+         , external_     ()  // The shared context of all non-worker threads
+         , owner_        ()  // The non-worker thread currently owning the shared context
+         , ownerMutex_   ()  // Synchronization mutex for the owner of the shared context
+         , externalMutex_()  // Mutex serializing the non-worker threads
+         , mutex_        ()  // Synchronization mutex for idle worker threads
+         , wakeUp_       ()  // Wait condition for idle worker threads
+         , started_      ()  // Wait condition for the start of the worker threads
+         , ready_        ()  // Number of started worker threads
+      {
+         sleeping_.store( 0UL );
+         shutdown_.store( false );
+         startWorkers( n );
+      }
+      //*******************************************************************************************
+
+      //**Destructor*******************************************************************************
+      /*!\brief Destructor for the Pool class.
+      */
+      inline ~Pool() {
+         stopWorkers();
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      std::vector<Context*> workers_;  //!< The contexts of the worker threads.
+      std::vector<TT*> threads_;       //!< The worker threads.
+      Context external_;               //!< The shared context of all non-worker threads.
+      ThreadID owner_;                 //!< The non-worker thread currently owning the context.
+      MT ownerMutex_;                  //!< Synchronization mutex for the owner of the context.
+      MT externalMutex_;               //!< Mutex serializing the non-worker threads.
+      MT mutex_;                       //!< Synchronization mutex for idle worker threads.
+      CT wakeUp_;                      //!< Wait condition for idle worker threads.
+      CT started_;                     //!< Wait condition for the start of the worker threads.
+      size_t ready_;                   //!< Number of started worker threads.
+      AT<size_t> sleeping_;            //!< Number of sleeping worker threads.
+      AT<bool> shutdown_;              //!< Shutdown flag for the worker threads.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Private class Assigner**********************************************************************
+   /*!\brief Auxiliary functor for the threaded execution of a plain assignment.
+   */
+   template< typename Target    // Type of the target operand
+           , typename Source >  // Type of the source operand
+   struct Assigner
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Assigner class template.
+      //
+      // \param target The target operand to be assigned to.
+      // \param source The source operand to be assigned to the target.
+      */
+      explicit inline Assigner( Target& target, const Source& source )
+         : target_( target )  // The target operand
+         , source_( source )  // The source operand
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Performs the assignment between the two given operands.
+      //
+      // \return void
+      */
+      inline void operator()() {
+         assign( target_, source_ );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      Target       target_;  //!< The target operand.
+      const Source source_;  //!< The source operand.
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      BLAZE_CONSTRAINT_MUST_BE_EXPRESSION_TYPE( Target );
+      BLAZE_CONSTRAINT_MUST_BE_EXPRESSION_TYPE( Source );
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Private class AddAssigner*******************************************************************
+   /*!\brief Auxiliary functor for the threaded execution of an addition assignment.
+   */
+   template< typename Target    // Type of the target operand
+           , typename Source >  // Type of the source operand
+   struct AddAssigner
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the AddAssigner class template.
+      //
+      // \param target The target operand to be assigned to.
+      // \param source The source operand to be added to the target.
+      */
+      explicit inline AddAssigner( Target& target, const Source& source )
+         : target_( target )  // The target operand
+         , source_( source )  // The source operand
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Performs the addition assignment between the two given operands.
+      //
+      // \return void
+      */
+      inline void operator()() {
+         addAssign( target_, source_ );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      Target       target_;  //!< The target operand.
+      const Source source_;  //!< The source operand.
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      BLAZE_CONSTRAINT_MUST_BE_EXPRESSION_TYPE( Target );
+      BLAZE_CONSTRAINT_MUST_BE_EXPRESSION_TYPE( Source );
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Private class SubAssigner*******************************************************************
+   /*!\brief Auxiliary functor for the threaded execution of a subtraction assignment.
+   */
+   template< typename Target    // Type of the target operand
+           , typename Source >  // Type of the source operand
+   struct SubAssigner
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the SubAssigner class template.
+      //
+      // \param target The target operand to be assigned to.
+      // \param source The source operand to be subtracted from the target.
+      */
+      explicit inline SubAssigner( Target& target, const Source& source )
+         : target_( target )  // The target operand
+         , source_( source )  // The source operand
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Performs the subtraction assignment between the two given operands.
+      //
+      // \return void
+      */
+      inline void operator()() {
+         subAssign( target_, source_ );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      Target       target_;  //!< The target operand.
+      const Source source_;  //!< The source operand.
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      BLAZE_CONSTRAINT_MUST_BE_EXPRESSION_TYPE( Target );
+      BLAZE_CONSTRAINT_MUST_BE_EXPRESSION_TYPE( Source );
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Private class MultAssigner******************************************************************
+   /*!\brief Auxiliary functor for the threaded execution of a multiplication assignment.
+   */
+   template< typename Target    // Type of the target operand
+           , typename Source >  // Type of the source operand
+   struct MultAssigner
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the MultAssigner class template.
+      //
+      // \param target The target operand to be assigned to.
+      // \param source The source operand to be multiplied with the target.
+      */
+      explicit inline MultAssigner( Target& target, const Source& source )
+         : target_( target )  // The target operand
+         , source_( source )  // The source operand
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Performs the multiplication assignment between the two given operands.
+      //
+      // \return void
+      */
+      inline void operator()() {
+         multAssign( target_, source_ );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      Target       target_;  //!< The target operand.
+      const Source source_;  //!< The source operand.
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      BLAZE_CONSTRAINT_MUST_BE_EXPRESSION_TYPE( Target );
+      BLAZE_CONSTRAINT_MUST_BE_EXPRESSION_TYPE( Source );
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Private class Resetter**********************************************************************
+   /*!\brief Auxiliary functor for the threaded reset of a target operand.
+   */
+   template< typename Target >  // Type of the target operand
+   struct Resetter
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Resetter class template.
+      //
+      // \param target The target operand to be reset.
+      */
+      explicit inline Resetter( Target& target )
+         : target_( target )  // The target operand
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Resets the target operand.
+      //
+      // \return void
+      */
+      inline void operator()() {
+         reset( target_ );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      Target target_;  //!< The target operand.
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      BLAZE_CONSTRAINT_MUST_BE_EXPRESSION_TYPE( Target );
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Scheduling functions************************************************************************
+   /*!\name Scheduling functions */
+   //@{
+   template< typename Callable >
+   static void invoke( void* object );
+
+   template< typename Callable >
+   static void invokeAndDelete( void* object );
+
+   static inline Context* findWorker( const ThreadID& id );
+   static inline Context& acquireContext();
+   static inline Task*    allocate( Context& context );
+   static inline void     execute( Context& context, Task* task );
+   static inline Task*    steal( Context& context );
+   static inline bool     hasWork();
+   static inline void     notify();
+   //@}
+   //**********************************************************************************************
+
+   //**Thread management functions*****************************************************************
+   /*!\name Thread management functions */
+   //@{
+   static void run( Context& context );
+   static void startWorkers( size_t n );
+   static void stopWorkers();
+
+   static inline ThreadID getThreadID();
+   static inline void     yield();
+   //@}
+   //**********************************************************************************************
+
+   //**Initialization functions********************************************************************
+   /*!\name Initialization functions */
+   //@{
+   static inline size_t initPool();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   static Pool pool_;  //!< The state of the work-stealing backend system.
+                       /*!< It is initialized with the number of threads specified via the
+                            environment variable \c BLAZE_NUM_THREADS. However, it can be
+                            explicitly resized to arbitrary numbers of threads. */
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename TT, typename MT, typename LT, typename CT, template< typename > class AT >
+typename WorkStealingBackend<TT,MT,LT,CT,AT>::Pool
+   WorkStealingBackend<TT,MT,LT,CT,AT>::pool_( initPool() );
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the total number of worker threads managed by the backend system.
+//
+// \return The total number of worker threads of the backend system.
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic wrapper
+inline size_t WorkStealingBackend<TT,MT,LT,CT,AT>::size()
+{
+   return pool_.workers_.size();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Changes the total number of worker threads managed by the backend system.
+//
+// \param n The new number of threads \f$[1..\infty)\f$.
+// \param block \a true if the function shall block, \a false if not.
+// \return void
+// \exception std::invalid_argument Invalid number of threads.
+//
+// This function changes the total number of worker threads managed by the backend system. In
+// contrast to the ThreadBackend class template all worker threads are terminated and the new
+// number of worker threads is started before the function returns, i.e. the function always
+// blocks. Note that this function must not be called while tasks are scheduled or executed.
+// In case an invalid number of threads is specified, an \a std::invalid_argument exception is
+// thrown.
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic wrapper
+inline void WorkStealingBackend<TT,MT,LT,CT,AT>::resize( size_t n, bool block )
+{
+   UNUSED_PARAMETER( block );
+
+#if !(defined _MSC_VER)
+   if( n == 0UL )
+      throw std::invalid_argument( "Invalid number of threads" );
+#endif
+
+   if( n == pool_.workers_.size() )
+      return;
+
+   stopWorkers();
+   startWorkers( n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Waiting for all tasks scheduled by the calling thread to be completed.
+//
+// \return void
+//
+// This function blocks until all tasks that have been scheduled by the calling thread on its
+// current nesting level have been completed. While waiting, the calling thread executes its
+// own pending tasks and steals tasks from other threads.
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic wrapper
+inline void WorkStealingBackend<TT,MT,LT,CT,AT>::wait()
+{
+   const ThreadID id( getThreadID() );
+
+   Context* context( findWorker( id ) );
+   bool external( false );
+
+   if( context == NULL ) {
+      LT lock( pool_.ownerMutex_ );
+      if( pool_.owner_ != id )
+         return;
+      context  = &pool_.external_;
+      external = true;
+   }
+
+   AT<size_t>& pending( context->pending_[context->depth_] );
+
+   while( pending.load() != 0UL )
+   {
+      Task* task( context->deque_.pop() );
+
+      if( task == NULL )
+         task = steal( *context );
+
+      if( task != NULL )
+         execute( *context, task );
+      else yield();
+   }
+
+   if( external && context->depth_ == 0UL ) {
+      {
+         LT lock( pool_.ownerMutex_ );
+         pool_.owner_ = ThreadID();
+      }
+      pool_.externalMutex_.unlock();
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THREAD EXECUTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling the given callable for execution.
+//
+// \param func The callable to be executed.
+// \return void
+//
+// This function schedules a copy of the given callable for execution. The copy is stored in
+// one of the preallocated task slots of the calling thread. In case the callable does not fit
+// into a task slot it is allocated dynamically, in case all task slots of the calling thread
+// are occupied or the maximum nesting depth has been reached it is executed immediately.
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic wrapper
+template< typename Callable >              // Type of the callable
+inline void WorkStealingBackend<TT,MT,LT,CT,AT>::schedule( const Callable& func )
+{
+   Context& context( acquireContext() );
+   Task* task( NULL );
+
+   if( context.depth_ < size_t( maxDepth ) )
+      task = allocate( context );
+
+   if( task == NULL ) {
+      Callable tmp( func );
+      tmp();
+      return;
+   }
+
+   if( sizeof( Callable ) <= sizeof( task->storage_ ) ) {
+      task->object_ = new ( &task->storage_ ) Callable( func );
+      task->invoke_ = &invoke<Callable>;
+   }
+   else {
+      task->object_ = new Callable( func );
+      task->invoke_ = &invokeAndDelete<Callable>;
+   }
+
+   task->pending_ = &context.pending_[context.depth_];
+   ++(*task->pending_);
+
+   if( !context.deque_.push( task ) ) {
+      BLAZE_INTERNAL_ASSERT( false, "Work-stealing deque overflow" );
+      execute( context, task );
+      return;
+   }
+
+   notify();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling an assignment of the given operands for execution.
+//
+// \param target The target operand to be assigned to.
+// \param source The target operand to be assigned to the target.
+// \return void
+//
+// This function schedules a plain assignment of the two given operands for execution.
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic wrapper
+template< typename Target                  // Type of the target operand
+        , typename Source >                // Type of the source operand
+inline void
+   WorkStealingBackend<TT,MT,LT,CT,AT>::scheduleAssign( Target& target, const Source& source )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
+   schedule( Assigner<Target,Source>( target, source ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling an addition assignment of the given operands for execution.
+//
+// \param target The target operand to be assigned to.
+// \param source The target operand to be added to the target.
+// \return void
+//
+// This function schedules an addition assignment of the two given operands for execution.
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic wrapper
+template< typename Target                  // Type of the target operand
+        , typename Source >                // Type of the source operand
+inline void
+   WorkStealingBackend<TT,MT,LT,CT,AT>::scheduleAddAssign( Target& target, const Source& source )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
+   schedule( AddAssigner<Target,Source>( target, source ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling a subtraction assignment of the given operands for execution.
+//
+// \param target The target operand to be assigned to.
+// \param source The target operand to be subtracted from the target.
+// \return void
+//
+// This function schedules a subtraction assignment of the two given operands for execution.
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic wrapper
+template< typename Target                  // Type of the target operand
+        , typename Source >                // Type of the source operand
+inline void
+   WorkStealingBackend<TT,MT,LT,CT,AT>::scheduleSubAssign( Target& target, const Source& source )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
+   schedule( SubAssigner<Target,Source>( target, source ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling a multiplication assignment of the given operands for execution.
+//
+// \param target The target operand to be assigned to.
+// \param source The target operand to be multiplied with the target.
+// \return void
+//
+// This function schedules a multiplication assignment of the two given operands for execution.
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic wrapper
+template< typename Target                  // Type of the target operand
+        , typename Source >                // Type of the source operand
+inline void
+   WorkStealingBackend<TT,MT,LT,CT,AT>::scheduleMultAssign( Target& target, const Source& source )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
+   schedule( MultAssigner<Target,Source>( target, source ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling a reset of the given target operand for execution.
+//
+// \param target The target operand to be reset.
+// \return void
+//
+// This function schedules a reset of the given target operand for execution.
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic wrapper
+template< typename Target >                // Type of the target operand
+inline void WorkStealingBackend<TT,MT,LT,CT,AT>::scheduleReset( Target& target )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
+   schedule( Resetter<Target>( target ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SCHEDULING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executes and destroys a callable stored in the in-place storage of a task slot.
+//
+// \param object The callable to be executed.
+// \return void
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic wrapper
+template< typename Callable >              // Type of the callable
+void WorkStealingBackend<TT,MT,LT,CT,AT>::invoke( void* object )
+{
+   Callable* func( static_cast<Callable*>( object ) );
+   (*func)();
+   func->~Callable();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executes and destroys a dynamically allocated callable.
+//
+// \param object The callable to be executed.
+// \return void
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic wrapper
+template< typename Callable >              // Type of the callable
+void WorkStealingBackend<TT,MT,LT,CT,AT>::invokeAndDelete( void* object )
+{
+   Callable* func( static_cast<Callable*>( object ) );
+   (*func)();
+   delete func;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the context of the worker thread with the given identifier.
+//
+// \param id The identifier of the thread.
+// \return The context of the worker thread or \a NULL in case the thread is no worker thread.
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic wrapper
+inline typename WorkStealingBackend<TT,MT,LT,CT,AT>::Context*
+   WorkStealingBackend<TT,MT,LT,CT,AT>::findWorker( const ThreadID& id )
+{
+   for( size_t i=0UL; i<pool_.workers_.size(); ++i ) {
+      if( pool_.workers_[i]->id_ == id )
+         return pool_.workers_[i];
+   }
+   return NULL;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the scheduling context of the calling thread.
+//
+// \return The scheduling context of the calling thread.
+//
+// For worker threads this function returns their own context. All other threads share a single
+// context. The first call of such a thread acquires the context, which is released again in
+// the wait() function on the outermost nesting level.
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic wrapper
+inline typename WorkStealingBackend<TT,MT,LT,CT,AT>::Context&
+   WorkStealingBackend<TT,MT,LT,CT,AT>::acquireContext()
+{
+   const ThreadID id( getThreadID() );
+
+   Context* context( findWorker( id ) );
+   if( context != NULL )
+      return *context;
+
+   {
+      LT lock( pool_.ownerMutex_ );
+      if( pool_.owner_ == id )
+         return pool_.external_;
+   }
+
+   pool_.externalMutex_.lock();
+
+   {
+      LT lock( pool_.ownerMutex_ );
+      pool_.owner_ = id;
+   }
+
+   return pool_.external_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an unoccupied task slot of the given context.
+//
+// \param context The context of the calling thread.
+// \return An unoccupied task slot or \a NULL in case all task slots are occupied.
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic wrapper
+inline typename WorkStealingBackend<TT,MT,LT,CT,AT>::Task*
+   WorkStealingBackend<TT,MT,LT,CT,AT>::allocate( Context& context )
+{
+   for( size_t i=0UL; i<size_t( taskCapacity ); ++i )
+   {
+      Task& task( context.tasks_[context.next_] );
+      context.next_ = ( context.next_ + 1UL ) % size_t( taskCapacity );
+
+      if( !task.busy_.load() ) {
+         task.busy_.store( true );
+         return &task;
+      }
+   }
+
+   return NULL;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executes the given task within the given context.
+//
+// \param context The context of the calling thread.
+// \param task The task to be executed.
+// \return void
+//
+// This function executes the given task on the next nesting level of the given context and
+// releases the task slot afterwards.
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic wrapper
+inline void WorkStealingBackend<TT,MT,LT,CT,AT>::execute( Context& context, Task* task )
+{
+   ++context.depth_;
+   task->invoke_( task->object_ );
+   --context.depth_;
+
+   AT<size_t>* pending( task->pending_ );
+   task->busy_.store( false );
+   --(*pending);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Tries to steal a task from any other context.
+//
+// \param context The context of the calling thread.
+// \return The stolen task or \a NULL in case no task could be stolen.
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic wrapper
+inline typename WorkStealingBackend<TT,MT,LT,CT,AT>::Task*
+   WorkStealingBackend<TT,MT,LT,CT,AT>::steal( Context& context )
+{
+   const size_t n( pool_.workers_.size() + 1UL );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const size_t index( context.victim_ );
+      context.victim_ = ( context.victim_ + 1UL ) % n;
+
+      Context* victim( ( index+1UL < n )?( pool_.workers_[index] ):( &pool_.external_ ) );
+
+      if( victim == &context )
+         continue;
+
+      Task* task( victim->deque_.steal() );
+      if( task != NULL )
+         return task;
+   }
+
+   return NULL;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether any context contains scheduled tasks.
+//
+// \return \a true in case there are scheduled tasks, \a false if not.
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic wrapper
+inline bool WorkStealingBackend<TT,MT,LT,CT,AT>::hasWork()
+{
+   for( size_t i=0UL; i<pool_.workers_.size(); ++i ) {
+      if( !pool_.workers_[i]->deque_.empty() )
+         return true;
+   }
+   return !pool_.external_.deque_.empty();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Wakes up a sleeping worker thread after a task has been scheduled.
+//
+// \return void
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic wrapper
+inline void WorkStealingBackend<TT,MT,LT,CT,AT>::notify()
+{
+   if( pool_.sleeping_.load() != 0UL ) {
+      LT lock( pool_.mutex_ );
+      pool_.wakeUp_.notify_one();
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THREAD MANAGEMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The main loop of a worker thread.
+//
+// \param context The context of the worker thread.
+// \return void
+//
+// The worker thread executes the tasks of its own deque and steals tasks from other threads.
+// After a number of unsuccessful attempts to find a task the thread goes to sleep until new
+// tasks are scheduled or the backend system is shut down.
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic wrapper
+void WorkStealingBackend<TT,MT,LT,CT,AT>::run( Context& context )
+{
+   {
+      LT lock( pool_.mutex_ );
+      context.id_ = getThreadID();
+      ++pool_.ready_;
+      pool_.started_.notify_all();
+   }
+
+   size_t idle( 0UL );
+
+   while( !pool_.shutdown_.load() )
+   {
+      Task* task( context.deque_.pop() );
+
+      if( task == NULL )
+         task = steal( context );
+
+      if( task != NULL ) {
+         execute( context, task );
+         idle = 0UL;
+      }
+      else if( ++idle < size_t( spinCount ) ) {
+         yield();
+      }
+      else {
+         idle = 0UL;
+         LT lock( pool_.mutex_ );
+         ++pool_.sleeping_;
+         if( !pool_.shutdown_.load() && !hasWork() )
+            pool_.wakeUp_.wait( lock );
+         --pool_.sleeping_;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Starts the given number of worker threads.
+//
+// \param n The number of worker threads to be started.
+// \return void
+//
+// This function blocks until all worker threads have been started.
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic wrapper
+void WorkStealingBackend<TT,MT,LT,CT,AT>::startWorkers( size_t n )
+{
+   BLAZE_INTERNAL_ASSERT( pool_.workers_.empty(), "Active worker threads detected" );
+
+   pool_.shutdown_.store( false );
+   pool_.ready_ = 0UL;
+
+   for( size_t i=0UL; i<n; ++i )
+      pool_.workers_.push_back( new Context() );
+
+   for( size_t i=0UL; i<n; ++i )
+      pool_.threads_.push_back( new TT( Runner( pool_.workers_[i] ) ) );
+
+   LT lock( pool_.mutex_ );
+   while( pool_.ready_ != n ) {
+      pool_.started_.wait( lock );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Terminates all worker threads.
+//
+// \return void
+//
+// This function blocks until all worker threads have been terminated.
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic wrapper
+void WorkStealingBackend<TT,MT,LT,CT,AT>::stopWorkers()
+{
+   {
+      LT lock( pool_.mutex_ );
+      pool_.shutdown_.store( true );
+      pool_.wakeUp_.notify_all();
+   }
+
+   for( size_t i=0UL; i<pool_.threads_.size(); ++i ) {
+      pool_.threads_[i]->join();
+      delete pool_.threads_[i];
+      delete pool_.workers_[i];
+   }
+
+   pool_.threads_.clear();
+   pool_.workers_.clear();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the identifier of the calling thread.
+//
+// \return The identifier of the calling thread.
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic wrapper
+inline typename WorkStealingBackend<TT,MT,LT,CT,AT>::ThreadID
+   WorkStealingBackend<TT,MT,LT,CT,AT>::getThreadID()
+{
+#if BLAZE_CPP_THREADS_PARALLEL_MODE
+   return std::this_thread::get_id();
+#else
+   return boost::this_thread::get_id();
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Offers the remaining time slice of the calling thread to other threads.
+//
+// \return void
+*/
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic wrapper
+inline void WorkStealingBackend<TT,MT,LT,CT,AT>::yield()
+{
+#if BLAZE_CPP_THREADS_PARALLEL_MODE
+   std::this_thread::yield();
+#else
+   boost::this_thread::yield();
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INITIALIZATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the initial number of worker threads.
+//
+// \return The initial number of worker threads.
+//
+// This function determines the initial number of threads based on the \c BLAZE_NUM_THREADS
+// environment variable. In case the environment variable is not defined or not set, the
+// function returns 1. Otherwise it returns the specified number of threads.
+*/
+#if (defined _MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable:4996)
+#endif
+template< typename TT                      // Type of the encapsulated thread
+        , typename MT                      // Type of the synchronization mutex
+        , typename LT                      // Type of the mutex lock
+        , typename CT                      // Type of the condition variable
+        , template< typename > class AT >  // Type of the atomic wrapper
+inline size_t WorkStealingBackend<TT,MT,LT,CT,AT>::initPool()
+{
+   const char* env = std::getenv( "BLAZE_NUM_THREADS" );
+
+   if( env == NULL )
+      return 1UL;
+   else return max( 1, atoi( env ) );
+}
+#if (defined _MSC_VER)
+#  pragma warning(pop)
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,281 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/BiCGSTAB.h
+//  \brief Header file for the BiCGSTAB solver
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_BICGSTAB_H_
+#define _BLAZE_MATH_SOLVERS_BICGSTAB_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/solvers/IdentityPreconditioner.h>
+#include <blaze/math/solvers/Solver.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/util/constraints/FloatingPoint.h>
+#include <blaze/util/logging/DebugSection.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief A preconditioned biconjugate gradient stabilized (BiCGSTAB) solver.
+// \ingroup lse_solvers
+//
+// The BiCGSTAB class solves the linear system \f$ A \cdot x = b \f$ for a general, possibly
+// non-symmetric system matrix \a A by means of the right preconditioned BiCGSTAB method. The
+// system matrix can be any dense or sparse matrix, the preconditioner can be any class providing
+// an \a apply() function (see for instance the JacobiPreconditioner, the SSORPreconditioner and
+// the IncompleteLU class templates):
+
+   \code
+   blaze::CompressedMatrix<double> A( 1000UL, 1000UL );
+   blaze::DynamicVector<double> b( 1000UL ), x;
+   // ... Initialization of A and b
+
+   blaze::BiCGSTAB bicgstab;
+   bicgstab.solve( A, b, x, blaze::IncompleteLU<double>( A ) );
+   \endcode
+
+// In case the size of \a x matches the size of \a b, \a x is used as initial guess, otherwise
+// it is resized and initialized with zero. Due to the right preconditioning the convergence
+// is monitored by the relative residual \f$ \|b - A \cdot x\|_2 / \|b\|_2 \f$ of the original
+// system. The iteration stops as soon as it drops below the threshold of the solver, the
+// maximum number of iterations is reached or the method breaks down. Each iteration requires
+// two matrix/vector multiplications and two applications of the preconditioner. All vector
+// updates, scalar products and norms are executed in parallel by the active SMP backend.
+*/
+class BiCGSTAB : public Solver
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline BiCGSTAB();
+   //@}
+   //**********************************************************************************************
+
+   //**Solver functions****************************************************************************
+   /*!\name Solver functions */
+   //@{
+   template< typename MT, bool SO, typename VT1, typename VT2 >
+   inline bool solve( const Matrix<MT,SO>& A, const DenseVector<VT1,columnVector>& b,
+                      DenseVector<VT2,columnVector>& x );
+
+   template< typename MT, bool SO, typename VT1, typename VT2, typename PT >
+   bool solve( const Matrix<MT,SO>& A, const DenseVector<VT1,columnVector>& b,
+               DenseVector<VT2,columnVector>& x, const PT& M );
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for the BiCGSTAB solver.
+*/
+inline BiCGSTAB::BiCGSTAB()
+   : Solver()  // Initialization of the base class
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solves the given linear system without preconditioning.
+//
+// \param A The system matrix.
+// \param b The right-hand side vector.
+// \param x The vector of unknowns (initial guess and solution).
+// \return \a true if the solution meets the threshold, \a false if not.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector size.
+*/
+template< typename MT     // Type of the system matrix
+        , bool SO         // Storage order of the system matrix
+        , typename VT1    // Type of the right-hand side vector
+        , typename VT2 >  // Type of the vector of unknowns
+inline bool BiCGSTAB::solve( const Matrix<MT,SO>& A, const DenseVector<VT1,columnVector>& b,
+                             DenseVector<VT2,columnVector>& x )
+{
+   return solve( A, b, x, IdentityPreconditioner() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the given linear system with the given preconditioner.
+//
+// \param A The system matrix.
+// \param b The right-hand side vector.
+// \param x The vector of unknowns (initial guess and solution).
+// \param M The preconditioner.
+// \return \a true if the solution meets the threshold, \a false if not.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector size.
+//
+// The iteration is terminated prematurely (returning \a false) in case of a breakdown of the
+// method, i.e. in case \f$ \rho = \hat{r}_0^T \cdot r \f$ or \f$ \omega \f$ become zero.
+*/
+template< typename MT     // Type of the system matrix
+        , bool SO         // Storage order of the system matrix
+        , typename VT1    // Type of the right-hand side vector
+        , typename VT2    // Type of the vector of unknowns
+        , typename PT >   // Type of the preconditioner
+bool BiCGSTAB::solve( const Matrix<MT,SO>& A, const DenseVector<VT1,columnVector>& b,
+                      DenseVector<VT2,columnVector>& x, const PT& M )
+{
+   typedef typename VT2::ElementType  ET;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( ET );
+
+   const size_t n( (~b).size() );
+
+   if( (~A).rows() != (~A).columns() )
+      throw std::invalid_argument( "Invalid non-square matrix provided" );
+
+   if( (~A).rows() != n )
+      throw std::invalid_argument( "Invalid right-hand side vector size" );
+
+   if( (~x).size() != n ) {
+      ~x = ~b;
+      reset( ~x );
+   }
+
+   bool converged( false );
+   size_t it( 0UL );
+
+   const ET bnorm( length( ~b ) );
+   const ET scale( ( bnorm != ET(0) )?( ET(1) / bnorm ):( ET(1) ) );
+
+   DynamicVector<ET> r( (~b) - (~A) * (~x) );
+   DynamicVector<ET> r0( r ), p( n, ET(0) ), v( n, ET(0) ), y( n ), t( n );
+
+   ET rho( 1 ), alpha( 1 ), omega( 1 );
+
+   lastPrecision_ = length( r ) * scale;
+   converged = ( lastPrecision_ <= threshold_ );
+
+   for( ; !converged && it<maxIterations_; ++it )
+   {
+      const ET rhoNew( sum( r0 * r ) );
+      if( rhoNew == ET(0) )
+         break;
+
+      p = r + ( ( rhoNew / rho ) * ( alpha / omega ) ) * ( p - omega * v );
+      rho = rhoNew;
+
+      M.apply( p, y );
+      v = (~A) * y;
+
+      const ET r0v( sum( r0 * v ) );
+      if( r0v == ET(0) )
+         break;
+
+      alpha = rho / r0v;
+      ~x += alpha * y;
+      r  -= alpha * v;
+
+      lastPrecision_ = length( r ) * scale;
+
+      if( lastPrecision_ <= threshold_ ) {
+         converged = true;
+         ++it;
+         break;
+      }
+
+      M.apply( r, y );
+      t = (~A) * y;
+
+      const ET tt( sum( t * t ) );
+      omega = ( tt != ET(0) )?( sum( t * r ) / tt ):( ET(0) );
+
+      ~x += omega * y;
+      r  -= omega * t;
+
+      lastPrecision_ = length( r ) * scale;
+
+      if( lastPrecision_ <= threshold_ ) {
+         converged = true;
+         ++it;
+         break;
+      }
+
+      if( omega == ET(0) )
+         break;
+   }
+
+   BLAZE_LOG_DEBUG_SECTION( log ) {
+      if( converged )
+         log << "      Solved the linear system in " << it << " BiCGSTAB iterations.";
+      else
+         log << "      WARNING: Did not solve the linear system within accuracy. ("
+             << lastPrecision_ << ")";
+   }
+
+   lastIterations_ = it;
+
+   return converged;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -125,6 +125,7 @@ bool CPG::solve( CP& cp )
    const VecN&    b( cp.b_ );
 
    bool converged( false );
+   stagnated_ = false;
    VecN& x( cp.x_ );
    size_t activeSetChanges( 0 );
    real alpha( 0 ), alpha_nom( 0 ), alpha_denom( 1 );
@@ -166,7 +167,7 @@ bool CPG::solve( CP& cp )
    w_ = real(0);
 
    size_t it( 0 );
-   for( ; !converged && it < maxIterations_; ++it )
+   for( ; !converged && !stagnated_ && it < maxIterations_; ++it )
    {
       // Computing the steepest descent direction
       r_ = -( A*x + b );
@@ -261,14 +262,19 @@ bool CPG::solve( CP& cp )
       }
 
       // Computing the residual (TODO we should improve this)
+      const real previous( lastPrecision_ );
       lastPrecision_ = cp.residual();
       if( lastPrecision_ < threshold_ )
          converged = true;
+      else if( hasStagnated( previous, lastPrecision_ ) )
+         stagnated_ = true;
    }
 
    BLAZE_LOG_DEBUG_SECTION( log ) {
       if( converged )
          log << "      Solved the quadratic program in " << it << " CPG iterations.";
+      else if( stagnated_ )
+         log << BLAZE_YELLOW << "      WARNING: The CPG iterations stagnated after " << it << " iterations. (" << lastPrecision_ << ")" << BLAZE_OLDCOLOR;
       else
          log << BLAZE_YELLOW << "      WARNING: Did not solve the quadratic program within accuracy. (" << lastPrecision_ << ")" << BLAZE_OLDCOLOR;
    }
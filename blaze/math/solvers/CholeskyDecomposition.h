@@ -0,0 +1,464 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/CholeskyDecomposition.h
+//  \brief Header file for the CholeskyDecomposition class template
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_CHOLESKYDECOMPOSITION_H_
+#define _BLAZE_MATH_SOLVERS_CHOLESKYDECOMPOSITION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <stdexcept>
+#include <blaze/math/DenseSubmatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/LowerMatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/util/constraints/FloatingPoint.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Blocked Cholesky decomposition of a symmetric positive definite dense matrix.
+// \ingroup lse_solvers
+//
+// The CholeskyDecomposition class template computes and stores the decomposition \f$ A = L
+// \cdot L^T \f$ of a symmetric positive definite dense matrix \a A, where \a L is a lower
+// triangular matrix with positive diagonal elements. The decomposition is computed once and
+// can afterwards be reused to solve an arbitrary number of linear systems \f$ A \cdot x = b \f$
+// with the same system matrix:
+
+   \code
+   blaze::SymmetricMatrix< blaze::DynamicMatrix<double> > A( 500UL );
+   blaze::DynamicVector<double> b( 500UL ), x;
+   // ... Initialization of A and b
+
+   blaze::CholeskyDecomposition<double> llt( A );  // Decomposition of A
+
+   llt.solve( b, x );  // Solving A*x = b
+   llt.solve( b );     // Solving A*x = b in-place; b is overwritten with the solution
+   \endcode
+
+// The decomposition is computed by a right-looking blocked algorithm. Each diagonal block of
+// size \a blockSize is decomposed directly, the corresponding block column of \a L is computed
+// by means of the inverse of the diagonal block (using the triangular LowerMatrix multiplication
+// kernel) and the trailing submatrix is updated by a single dense matrix/dense matrix
+// multiplication, which is performed by the BLAS kernels (in case the BLAZE_BLAS_MODE is
+// enabled) or the native, vectorized and parallelized Blaze kernels.
+//
+// The decomposition accepts any dense matrix. In case the given matrix is not a SymmetricMatrix
+// it is checked for symmetry first. The element type \a Type must be a built-in floating point
+// data type. In case the matrix is not symmetric or not positive definite a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the matrix elements
+class CholeskyDecomposition
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef DynamicMatrix<Type,columnMajor>  MatrixType;  //!< Type of the Cholesky factor.
+   //**********************************************************************************************
+
+   //**Block size**********************************************************************************
+   //! Number of columns of a single block column of the blocked decomposition.
+   static const size_t blockSize = 64UL;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline CholeskyDecomposition();
+
+   template< typename MT, bool SO >
+   explicit inline CholeskyDecomposition( const DenseMatrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t            size  () const;
+   inline const MatrixType& factor() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Decomposition functions*********************************************************************
+   /*!\name Decomposition functions */
+   //@{
+   template< typename MT, bool SO >
+   void factorize( const DenseMatrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Solver functions****************************************************************************
+   /*!\name Solver functions */
+   //@{
+   template< typename VT, bool TF >
+   void solve( DenseVector<VT,TF>& b ) const;
+
+   template< typename VT1, bool TF, typename VT2 >
+   void solve( const DenseVector<VT1,TF>& b, DenseVector<VT2,TF>& x ) const;
+
+   template< typename MT, bool SO >
+   void solve( DenseMatrix<MT,SO>& B ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MatrixType l_;  //!< The lower triangular Cholesky factor.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER CONSTANTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename Type >  // Data type of the matrix elements
+const size_t CholeskyDecomposition<Type>::blockSize;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for CholeskyDecomposition.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline CholeskyDecomposition<Type>::CholeskyDecomposition()
+   : l_()  // The lower triangular Cholesky factor
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Decomposition constructor for CholeskyDecomposition.
+//
+// \param A The symmetric positive definite dense matrix to be decomposed.
+// \exception std::invalid_argument Invalid non-symmetric matrix provided.
+// \exception std::invalid_argument Decomposition of non-positive-definite matrix failed.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename MT      // Type of the dense matrix
+        , bool SO >        // Storage order of the dense matrix
+inline CholeskyDecomposition<Type>::CholeskyDecomposition( const DenseMatrix<MT,SO>& A )
+   : l_()  // The lower triangular Cholesky factor
+{
+   factorize( A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows/columns of the decomposed matrix.
+//
+// \return The number of rows/columns of the decomposed matrix.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline size_t CholeskyDecomposition<Type>::size() const
+{
+   return l_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the lower triangular Cholesky factor \a L.
+//
+// \return The lower triangular Cholesky factor.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline const typename CholeskyDecomposition<Type>::MatrixType&
+   CholeskyDecomposition<Type>::factor() const
+{
+   return l_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DECOMPOSITION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the Cholesky decomposition of the given symmetric dense matrix.
+//
+// \param A The symmetric positive definite dense matrix to be decomposed.
+// \return void
+// \exception std::invalid_argument Invalid non-symmetric matrix provided.
+// \exception std::invalid_argument Decomposition of non-positive-definite matrix failed.
+//
+// This function computes the Cholesky decomposition of the given matrix and replaces any
+// previously computed decomposition. In case the decomposition fails, the decomposition is
+// reset to the state of a default constructed decomposition.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename MT      // Type of the dense matrix
+        , bool SO >        // Storage order of the dense matrix
+void CholeskyDecomposition<Type>::factorize( const DenseMatrix<MT,SO>& A )
+{
+   using std::sqrt;
+
+   l_ = ~A;
+
+   if( !isSymmetric( l_ ) ) {
+      l_.clear();
+      throw std::invalid_argument( "Invalid non-symmetric matrix provided" );
+   }
+
+   const size_t n( l_.rows() );
+
+   MatrixType tmp, L21;
+   LowerMatrix<MatrixType> L11;
+
+   for( size_t k=0UL; k<n; k+=blockSize )
+   {
+      const size_t kb  ( min( blockSize, n-k ) );
+      const size_t kend( k+kb );
+
+      // Unblocked decomposition of the current diagonal block
+      for( size_t j=k; j<kend; ++j )
+      {
+         if( !( l_(j,j) > Type(0) ) ) {
+            l_.clear();
+            throw std::invalid_argument( "Decomposition of non-positive-definite matrix failed" );
+         }
+
+         const Type ljj( sqrt( l_(j,j) ) );
+         const Type inv( Type(1) / ljj );
+
+         l_(j,j) = ljj;
+
+         for( size_t i=j+1UL; i<kend; ++i )
+            l_(i,j) *= inv;
+
+         for( size_t l=j+1UL; l<kend; ++l ) {
+            const Type llj( l_(l,j) );
+            for( size_t i=l; i<kend; ++i )
+               l_(i,l) -= l_(i,j) * llj;
+         }
+      }
+
+      if( kend == n ) break;
+
+      const size_t rest( n - kend );
+
+      // Inversion of the lower triangular diagonal block
+      tmp.resize( kb, kb, false );
+      reset( tmp );
+
+      for( size_t j=0UL; j<kb; ++j ) {
+         tmp(j,j) = Type(1);
+         for( size_t l=j; l<kb; ++l ) {
+            tmp(l,j) /= l_(k+l,k+l);
+            const Type xl( tmp(l,j) );
+            for( size_t i=l+1UL; i<kb; ++i )
+               tmp(i,j) -= l_(k+i,k+l) * xl;
+         }
+      }
+
+      L11 = tmp;
+
+      // Computation of the block column of L and update of the trailing submatrix
+      L21 = submatrix( l_, kend, k, rest, kb ) * trans( L11 );
+      submatrix( l_, kend, k, rest, kb ) = L21;
+      submatrix( l_, kend, kend, rest, rest ) -= L21 * trans( L21 );
+   }
+
+   for( size_t j=1UL; j<n; ++j )
+      for( size_t i=0UL; i<j; ++i )
+         reset( l_(i,j) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solves the linear system \f$ A \cdot x = b \f$ in-place.
+//
+// \param b The right-hand side vector, which is overwritten with the solution vector.
+// \return void
+// \exception std::invalid_argument Invalid right-hand side vector size.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename VT      // Type of the right-hand side vector
+        , bool TF >        // Transpose flag of the right-hand side vector
+void CholeskyDecomposition<Type>::solve( DenseVector<VT,TF>& b ) const
+{
+   VT& x( ~b );
+
+   const size_t n( l_.rows() );
+
+   if( x.size() != n )
+      throw std::invalid_argument( "Invalid right-hand side vector size" );
+
+   for( size_t j=0UL; j<n; ++j ) {
+      x[j] /= l_(j,j);
+      const Type xj( x[j] );
+      for( size_t i=j+1UL; i<n; ++i )
+         x[i] -= l_(i,j) * xj;
+   }
+
+   for( size_t j=n; j-->0UL; ) {
+      Type xj( x[j] );
+      for( size_t i=j+1UL; i<n; ++i )
+         xj -= l_(i,j) * x[i];
+      x[j] = xj / l_(j,j);
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the linear system \f$ A \cdot x = b \f$.
+//
+// \param b The right-hand side vector.
+// \param x The solution vector.
+// \return void
+// \exception std::invalid_argument Invalid right-hand side vector size.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename VT1     // Type of the right-hand side vector
+        , bool TF          // Transpose flag of the vectors
+        , typename VT2 >   // Type of the solution vector
+void CholeskyDecomposition<Type>::solve( const DenseVector<VT1,TF>& b,
+                                         DenseVector<VT2,TF>& x ) const
+{
+   if( (~b).size() != l_.rows() )
+      throw std::invalid_argument( "Invalid right-hand side vector size" );
+
+   ~x = ~b;
+   solve( ~x );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the linear system \f$ A \cdot X = B \f$ in-place.
+//
+// \param B The matrix of right-hand sides, which is overwritten with the solution.
+// \return void
+// \exception std::invalid_argument Invalid right-hand side matrix size.
+//
+// This function solves the linear system for each column of the given matrix \a B.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename MT      // Type of the right-hand side matrix
+        , bool SO >        // Storage order of the right-hand side matrix
+void CholeskyDecomposition<Type>::solve( DenseMatrix<MT,SO>& B ) const
+{
+   MT& X( ~B );
+
+   const size_t n( l_.rows() );
+
+   if( X.rows() != n )
+      throw std::invalid_argument( "Invalid right-hand side matrix size" );
+
+   for( size_t c=0UL; c<X.columns(); ++c )
+   {
+      for( size_t j=0UL; j<n; ++j ) {
+         X(j,c) /= l_(j,j);
+         const Type xj( X(j,c) );
+         for( size_t i=j+1UL; i<n; ++i )
+            X(i,c) -= l_(i,j) * xj;
+      }
+
+      for( size_t j=n; j-->0UL; ) {
+         Type xj( X(j,c) );
+         for( size_t i=j+1UL; i<n; ++i )
+            xj -= l_(i,j) * X(i,c);
+         X(j,c) = xj / l_(j,j);
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,399 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/GMRES.h
+//  \brief Header file for the restarted GMRES solver
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_GMRES_H_
+#define _BLAZE_MATH_SOLVERS_GMRES_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/solvers/IdentityPreconditioner.h>
+#include <blaze/math/solvers/Solver.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/util/constraints/FloatingPoint.h>
+#include <blaze/util/logging/DebugSection.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief A preconditioned, restarted generalized minimal residual (GMRES(m)) solver.
+// \ingroup lse_solvers
+//
+// The GMRES class solves the linear system \f$ A \cdot x = b \f$ for a general, possibly
+// non-symmetric system matrix \a A by means of the right preconditioned GMRES method, which is
+// restarted every \a m iterations. The system matrix can be any dense or sparse matrix, the
+// preconditioner can be any class providing an \a apply() function (see for instance the
+// JacobiPreconditioner, the SSORPreconditioner and the IncompleteLU class templates):
+
+   \code
+   blaze::CompressedMatrix<double> A( 1000UL, 1000UL );
+   blaze::DynamicVector<double> b( 1000UL ), x;
+   // ... Initialization of A and b
+
+   blaze::GMRES gmres( 50UL );  // GMRES(50)
+   gmres.solve( A, b, x, blaze::IncompleteLU<double>( A ) );
+   \endcode
+
+// The Krylov basis is orthonormalized by the modified Gram-Schmidt method, the least squares
+// problem is updated by Givens rotations. Thus the residual norm of the original system is
+// available in every iteration without additional cost. In case the size of \a x matches the
+// size of \a b, \a x is used as initial guess, otherwise it is resized and initialized with zero.
+// The iteration stops as soon as the relative residual \f$ \|b - A \cdot x\|_2 / \|b\|_2 \f$
+// drops below the threshold of the solver or the maximum number of iterations is reached. All
+// vector updates, scalar products and norms are executed in parallel by the active SMP backend.
+// The memory requirement of the solver is \a m+1 vectors of the size of the linear system.
+*/
+class GMRES : public Solver
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline GMRES( size_t restart=30UL );
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline size_t getRestart() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Set functions*******************************************************************************
+   /*!\name Set functions */
+   //@{
+   inline void setRestart( size_t restart );
+   //@}
+   //**********************************************************************************************
+
+   //**Solver functions****************************************************************************
+   /*!\name Solver functions */
+   //@{
+   template< typename MT, bool SO, typename VT1, typename VT2 >
+   inline bool solve( const Matrix<MT,SO>& A, const DenseVector<VT1,columnVector>& b,
+                      DenseVector<VT2,columnVector>& x );
+
+   template< typename MT, bool SO, typename VT1, typename VT2, typename PT >
+   bool solve( const Matrix<MT,SO>& A, const DenseVector<VT1,columnVector>& b,
+               DenseVector<VT2,columnVector>& x, const PT& M );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t restart_;  //!< The number of iterations between two restarts.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The constructor for the GMRES solver.
+//
+// \param restart The number of iterations between two restarts.
+// \exception std::invalid_argument Invalid restart parameter.
+*/
+inline GMRES::GMRES( size_t restart )
+   : Solver()             // Initialization of the base class
+   , restart_( restart )  // The number of iterations between two restarts
+{
+   if( restart == 0UL )
+      throw std::invalid_argument( "Invalid restart parameter" );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of iterations between two restarts.
+//
+// \return The restart parameter \a m.
+*/
+inline size_t GMRES::getRestart() const
+{
+   return restart_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Sets the number of iterations between two restarts.
+//
+// \param restart The restart parameter \a m.
+// \return void
+// \exception std::invalid_argument Invalid restart parameter.
+*/
+inline void GMRES::setRestart( size_t restart )
+{
+   if( restart == 0UL )
+      throw std::invalid_argument( "Invalid restart parameter" );
+
+   restart_ = restart;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solves the given linear system without preconditioning.
+//
+// \param A The system matrix.
+// \param b The right-hand side vector.
+// \param x The vector of unknowns (initial guess and solution).
+// \return \a true if the solution meets the threshold, \a false if not.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector size.
+*/
+template< typename MT     // Type of the system matrix
+        , bool SO         // Storage order of the system matrix
+        , typename VT1    // Type of the right-hand side vector
+        , typename VT2 >  // Type of the vector of unknowns
+inline bool GMRES::solve( const Matrix<MT,SO>& A, const DenseVector<VT1,columnVector>& b,
+                          DenseVector<VT2,columnVector>& x )
+{
+   return solve( A, b, x, IdentityPreconditioner() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the given linear system with the given preconditioner.
+//
+// \param A The system matrix.
+// \param b The right-hand side vector.
+// \param x The vector of unknowns (initial guess and solution).
+// \param M The preconditioner.
+// \return \a true if the solution meets the threshold, \a false if not.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector size.
+//
+// At the end of each restart cycle the residual of the original system is recomputed
+// explicitly, which guards the convergence test against the accumulated rounding errors of
+// the Givens updates.
+*/
+template< typename MT     // Type of the system matrix
+        , bool SO         // Storage order of the system matrix
+        , typename VT1    // Type of the right-hand side vector
+        , typename VT2    // Type of the vector of unknowns
+        , typename PT >   // Type of the preconditioner
+bool GMRES::solve( const Matrix<MT,SO>& A, const DenseVector<VT1,columnVector>& b,
+                   DenseVector<VT2,columnVector>& x, const PT& M )
+{
+   using std::abs;
+   using std::sqrt;
+
+   typedef typename VT2::ElementType  ET;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( ET );
+
+   const size_t n( (~b).size() );
+
+   if( (~A).rows() != (~A).columns() )
+      throw std::invalid_argument( "Invalid non-square matrix provided" );
+
+   if( (~A).rows() != n )
+      throw std::invalid_argument( "Invalid right-hand side vector size" );
+
+   if( (~x).size() != n ) {
+      ~x = ~b;
+      reset( ~x );
+   }
+
+   const size_t m( restart_ );
+
+   bool converged( false );
+   size_t it( 0UL );
+
+   const ET bnorm( length( ~b ) );
+   const ET scale( ( bnorm != ET(0) )?( ET(1) / bnorm ):( ET(1) ) );
+
+   std::vector< DynamicVector<ET> > V( m+1UL, DynamicVector<ET>( n ) );
+   DynamicMatrix<ET> H( m+1UL, m );
+   DynamicVector<ET> cs( m ), sn( m ), g( m+1UL ), y( m ), w( n ), z( n );
+
+   DynamicVector<ET> r( (~b) - (~A) * (~x) );
+   ET beta( length( r ) );
+
+   lastPrecision_ = beta * scale;
+   converged = ( lastPrecision_ <= threshold_ );
+
+   while( !converged && it<maxIterations_ && beta != ET(0) )
+   {
+      V[0] = r * ( ET(1) / beta );
+      reset( g );
+      g[0] = beta;
+
+      size_t k( 0UL );
+
+      // Arnoldi process with modified Gram-Schmidt orthogonalization
+      for( ; k<m && it<maxIterations_; )
+      {
+         M.apply( V[k], z );
+         w = (~A) * z;
+
+         for( size_t i=0UL; i<=k; ++i ) {
+            H(i,k) = sum( w * V[i] );
+            w -= H(i,k) * V[i];
+         }
+
+         const ET hnext( length( w ) );
+         H(k+1UL,k) = hnext;
+
+         if( hnext != ET(0) )
+            V[k+1UL] = w * ( ET(1) / hnext );
+
+         // Application of the previous Givens rotations to the new column of H
+         for( size_t i=0UL; i<k; ++i ) {
+            const ET tmp( cs[i]*H(i,k) + sn[i]*H(i+1UL,k) );
+            H(i+1UL,k) = -sn[i]*H(i,k) + cs[i]*H(i+1UL,k);
+            H(i,k) = tmp;
+         }
+
+         // Computation of the Givens rotation eliminating H(k+1,k)
+         const ET denom( sqrt( H(k,k)*H(k,k) + H(k+1UL,k)*H(k+1UL,k) ) );
+         if( denom == ET(0) ) break;
+
+         cs[k] = H(k,k) / denom;
+         sn[k] = H(k+1UL,k) / denom;
+         H(k,k) = denom;
+         H(k+1UL,k) = ET(0);
+
+         g[k+1UL] = -sn[k] * g[k];
+         g[k]    *= cs[k];
+
+         ++k;
+         ++it;
+
+         lastPrecision_ = abs( g[k] ) * scale;
+
+         if( lastPrecision_ <= threshold_ || hnext == ET(0) )
+            break;
+      }
+
+      if( k == 0UL )
+         break;
+
+      // Solution of the upper triangular least squares system
+      for( size_t i=k; i-- > 0UL; ) {
+         ET tmp( g[i] );
+         for( size_t j=i+1UL; j<k; ++j ) {
+            tmp -= H(i,j) * y[j];
+         }
+         y[i] = tmp / H(i,i);
+      }
+
+      // Update of the solution
+      w = y[0] * V[0];
+      for( size_t i=1UL; i<k; ++i ) {
+         w += y[i] * V[i];
+      }
+
+      M.apply( w, z );
+      ~x += z;
+
+      r = (~b) - (~A) * (~x);
+      beta = length( r );
+
+      lastPrecision_ = beta * scale;
+      converged = ( lastPrecision_ <= threshold_ );
+   }
+
+   BLAZE_LOG_DEBUG_SECTION( log ) {
+      if( converged )
+         log << "      Solved the linear system in " << it << " GMRES iterations.";
+      else
+         log << "      WARNING: Did not solve the linear system within accuracy. ("
+             << lastPrecision_ << ")";
+   }
+
+   lastIterations_ = it;
+
+   return converged;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,104 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/IdentityPreconditioner.h
+//  \brief Header file for the IdentityPreconditioner class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_IDENTITYPRECONDITIONER_H_
+#define _BLAZE_MATH_SOLVERS_IDENTITYPRECONDITIONER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/TransposeFlag.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Identity preconditioner for the iterative linear system solvers.
+// \ingroup lse_solvers
+//
+// The IdentityPreconditioner class represents the trivial preconditioner \f$ M = I \f$. It is
+// used by the PCG, BiCGSTAB and GMRES solvers in case no preconditioner is specified. Every
+// preconditioner for these solvers has to provide an \a apply() function with the same
+// signature, which computes \f$ z = M^{-1} \cdot r \f$ for the given residual vector \a r.
+*/
+class IdentityPreconditioner
+{
+ public:
+   //**Preconditioning functions*******************************************************************
+   /*!\name Preconditioning functions */
+   //@{
+   template< typename VT1, typename VT2 >
+   inline void apply( const DenseVector<VT1,columnVector>& r, DenseVector<VT2,columnVector>& z ) const;
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PRECONDITIONING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Applies the preconditioner to the given residual vector.
+//
+// \param r The residual vector.
+// \param z The preconditioned residual vector \f$ z = r \f$.
+// \return void
+*/
+template< typename VT1    // Type of the residual vector
+        , typename VT2 >  // Type of the preconditioned residual vector
+inline void IdentityPreconditioner::apply( const DenseVector<VT1,columnVector>& r,
+                                           DenseVector<VT2,columnVector>& z ) const
+{
+   ~z = ~r;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
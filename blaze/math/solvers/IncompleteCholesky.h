@@ -0,0 +1,337 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/IncompleteCholesky.h
+//  \brief Header file for the IncompleteCholesky class template
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_INCOMPLETECHOLESKY_H_
+#define _BLAZE_MATH_SOLVERS_INCOMPLETECHOLESKY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <stdexcept>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/util/constraints/FloatingPoint.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Incomplete Cholesky preconditioner without fill-in (IC(0)).
+// \ingroup lse_solvers
+//
+// The IncompleteCholesky class template computes the incomplete Cholesky factorization
+// \f$ A \approx L \cdot L^T \f$ of a symmetric positive definite matrix \a A, where the lower
+// triangular factor \a L has exactly the sparsity pattern of the lower part of \a A. The factor
+// is stored in a row-major CompressedMatrix. The application of the preconditioner consists of
+// one forward substitution with \a L and one backward substitution with \f$ L^T \f$:
+
+   \code
+   blaze::CompressedMatrix<double> A( 1000UL, 1000UL );
+   blaze::DynamicVector<double> b( 1000UL ), x;
+   // ... Initialization of A and b
+
+   blaze::IncompleteCholesky<double> ic( A );
+
+   blaze::PCG pcg;
+   pcg.solve( A, b, x, ic );
+   \endcode
+
+// Only the lower part of the given matrix is accessed, the matrix is not checked for symmetry.
+// In case the matrix is not square, a diagonal element is missing or the factorization breaks
+// down due to a non-positive pivot (which may happen even for symmetric positive definite
+// matrices), a \a std::invalid_argument exception is thrown. In the latter case a diagonally
+// shifted matrix or the SSORPreconditioner can be used instead.
+*/
+template< typename Type >  // Data type of the matrix elements
+class IncompleteCholesky
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef CompressedMatrix<Type,rowMajor>  MatrixType;  //!< Type of the incomplete Cholesky factor.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   template< typename MT, bool SO >
+   explicit inline IncompleteCholesky( const Matrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline const MatrixType& factor() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Preconditioning functions*******************************************************************
+   /*!\name Preconditioning functions */
+   //@{
+   template< typename VT1, typename VT2 >
+   void apply( const DenseVector<VT1,columnVector>& r, DenseVector<VT2,columnVector>& z ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Decomposition functions*********************************************************************
+   /*!\name Decomposition functions */
+   //@{
+   void factorize();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MatrixType l_;  //!< The lower triangular incomplete Cholesky factor.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the incomplete Cholesky factorization of the given system matrix.
+//
+// \param A The symmetric positive definite system matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Missing diagonal element detected.
+// \exception std::invalid_argument Incomplete Cholesky factorization breakdown.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename MT      // Type of the system matrix
+        , bool SO >        // Storage order of the system matrix
+inline IncompleteCholesky<Type>::IncompleteCholesky( const Matrix<MT,SO>& A )
+   : l_()  // The lower triangular incomplete Cholesky factor
+{
+   typedef typename MatrixType::ConstIterator  ConstIterator;
+
+   if( (~A).rows() != (~A).columns() )
+      throw std::invalid_argument( "Invalid non-square matrix provided" );
+
+   const MatrixType tmp( ~A );
+   const size_t n( tmp.rows() );
+
+   size_t nonzeros( 0UL );
+   for( size_t i=0UL; i<n; ++i ) {
+      for( ConstIterator element=tmp.begin(i); element!=tmp.end(i) && element->index()<=i; ++element )
+         ++nonzeros;
+   }
+
+   l_.resize( n, n, false );
+   l_.reserve( nonzeros );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      ConstIterator element( tmp.begin(i) );
+      for( ; element!=tmp.end(i) && element->index()<=i; ++element ) {
+         l_.append( i, element->index(), element->value(), false );
+      }
+      l_.finalize( i );
+
+      if( l_.begin(i) == l_.end(i) || ( l_.end(i)-1 )->index() != i )
+         throw std::invalid_argument( "Missing diagonal element detected" );
+   }
+
+   factorize();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the lower triangular incomplete Cholesky factor.
+//
+// \return Reference to the factor \a L.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline const typename IncompleteCholesky<Type>::MatrixType& IncompleteCholesky<Type>::factor() const
+{
+   return l_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DECOMPOSITION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the incomplete factorization in the sparsity pattern of the lower part.
+//
+// \return void
+// \exception std::invalid_argument Incomplete Cholesky factorization breakdown.
+//
+// The factorization is computed row by row. Each off-diagonal element \f$ l_{ik} \f$ is
+// computed from the scalar product of the already computed parts of row \a i and row \a k,
+// which is evaluated by merging the two sorted index sequences. The diagonal element is always
+// the last element of a row of the lower triangular factor.
+*/
+template< typename Type >  // Data type of the matrix elements
+void IncompleteCholesky<Type>::factorize()
+{
+   typedef typename MatrixType::Iterator  Iterator;
+
+   for( size_t i=0UL; i<l_.rows(); ++i )
+   {
+      const Iterator diag( l_.end(i) - 1 );
+      Type sum( diag->value() );
+
+      for( Iterator lik=l_.begin(i); lik!=diag; ++lik )
+      {
+         const size_t k( lik->index() );
+         const Iterator lkk( l_.end(k) - 1 );
+
+         Type value( lik->value() );
+
+         Iterator lij( l_.begin(i) );
+         Iterator lkj( l_.begin(k) );
+
+         while( lij != lik && lkj != lkk ) {
+            if( lij->index() < lkj->index() ) ++lij;
+            else if( lkj->index() < lij->index() ) ++lkj;
+            else {
+               value -= lij->value() * lkj->value();
+               ++lij;
+               ++lkj;
+            }
+         }
+
+         lik->value() = value / lkk->value();
+         sum -= lik->value() * lik->value();
+      }
+
+      if( !( sum > Type(0) ) )
+         throw std::invalid_argument( "Incomplete Cholesky factorization breakdown" );
+
+      diag->value() = std::sqrt( sum );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PRECONDITIONING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Applies the preconditioner to the given residual vector.
+//
+// \param r The residual vector.
+// \param z The preconditioned residual vector \f$ z = (L \cdot L^T)^{-1} \cdot r \f$.
+// \return void
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename VT1     // Type of the residual vector
+        , typename VT2 >   // Type of the preconditioned residual vector
+void IncompleteCholesky<Type>::apply( const DenseVector<VT1,columnVector>& r,
+                                      DenseVector<VT2,columnVector>& z ) const
+{
+   typedef typename MatrixType::ConstIterator  ConstIterator;
+
+   const size_t n( l_.rows() );
+
+   VT2& y( ~z );
+   y = ~r;
+
+   // Forward substitution with L
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const ConstIterator diag( l_.end(i) - 1 );
+      Type tmp( y[i] );
+      for( ConstIterator element=l_.begin(i); element!=diag; ++element ) {
+         tmp -= element->value() * y[element->index()];
+      }
+      y[i] = tmp / diag->value();
+   }
+
+   // Backward substitution with L^T (column-oriented on the row-major factor)
+   for( size_t i=n; i-- > 0UL; )
+   {
+      const ConstIterator diag( l_.end(i) - 1 );
+      const Type tmp( y[i] / diag->value() );
+      y[i] = tmp;
+      for( ConstIterator element=l_.begin(i); element!=diag; ++element ) {
+         y[element->index()] -= element->value() * tmp;
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
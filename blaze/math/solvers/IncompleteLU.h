@@ -0,0 +1,321 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/IncompleteLU.h
+//  \brief Header file for the IncompleteLU class template
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_INCOMPLETELU_H_
+#define _BLAZE_MATH_SOLVERS_INCOMPLETELU_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/util/constraints/FloatingPoint.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Incomplete LU preconditioner without fill-in (ILU(0)).
+// \ingroup lse_solvers
+//
+// The IncompleteLU class template computes the incomplete LU factorization \f$ A \approx L
+// \cdot U \f$ of a general square matrix \a A, where the unit lower triangular factor \a L and
+// the upper triangular factor \a U together have exactly the sparsity pattern of \a A. Both
+// factors are stored in a single row-major CompressedMatrix (the unit diagonal of \a L is not
+// stored). The application of the preconditioner consists of one forward and one backward
+// substitution:
+
+   \code
+   blaze::CompressedMatrix<double> A( 1000UL, 1000UL );
+   blaze::DynamicVector<double> b( 1000UL ), x;
+   // ... Initialization of A and b
+
+   blaze::IncompleteLU<double> ilu( A );
+
+   blaze::BiCGSTAB bicgstab;
+   bicgstab.solve( A, b, x, ilu );
+   \endcode
+
+// No pivoting is performed. In case the matrix is not square, a diagonal element is missing
+// or a zero pivot is encountered during the factorization, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type >  // Data type of the matrix elements
+class IncompleteLU
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef CompressedMatrix<Type,rowMajor>  MatrixType;  //!< Type of the combined LU factors.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   template< typename MT, bool SO >
+   explicit inline IncompleteLU( const Matrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline const MatrixType& factors() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Preconditioning functions*******************************************************************
+   /*!\name Preconditioning functions */
+   //@{
+   template< typename VT1, typename VT2 >
+   void apply( const DenseVector<VT1,columnVector>& r, DenseVector<VT2,columnVector>& z ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Decomposition functions*********************************************************************
+   /*!\name Decomposition functions */
+   //@{
+   void factorize();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MatrixType          lu_;    //!< The combined incomplete LU factors.
+   std::vector<size_t> diag_;  //!< The position of the diagonal element within each row.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the incomplete LU factorization of the given system matrix.
+//
+// \param A The system matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Missing diagonal element detected.
+// \exception std::invalid_argument Zero pivot detected.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename MT      // Type of the system matrix
+        , bool SO >        // Storage order of the system matrix
+inline IncompleteLU<Type>::IncompleteLU( const Matrix<MT,SO>& A )
+   : lu_  ( ~A )           // The combined incomplete LU factors
+   , diag_( (~A).rows() )  // The position of the diagonal element within each row
+{
+   typedef typename MatrixType::ConstIterator  ConstIterator;
+
+   if( lu_.rows() != lu_.columns() )
+      throw std::invalid_argument( "Invalid non-square matrix provided" );
+
+   for( size_t i=0UL; i<lu_.rows(); ++i )
+   {
+      const ConstIterator pos( lu_.find( i, i ) );
+
+      if( pos == lu_.end(i) )
+         throw std::invalid_argument( "Missing diagonal element detected" );
+
+      diag_[i] = pos - lu_.begin(i);
+   }
+
+   factorize();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the combined incomplete LU factors.
+//
+// \return Reference to the combined factors.
+//
+// The strictly lower part of the returned matrix contains the unit lower triangular factor
+// \a L (without its diagonal), the upper part contains the upper triangular factor \a U.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline const typename IncompleteLU<Type>::MatrixType& IncompleteLU<Type>::factors() const
+{
+   return lu_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DECOMPOSITION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the incomplete factorization in the sparsity pattern of the system matrix.
+//
+// \return void
+// \exception std::invalid_argument Zero pivot detected.
+//
+// The factorization is computed by the row-oriented IKJ variant of Gaussian elimination. The
+// update of row \a i by row \a k is restricted to the existing elements of row \a i, which are
+// found by merging the sorted index sequences of both rows.
+*/
+template< typename Type >  // Data type of the matrix elements
+void IncompleteLU<Type>::factorize()
+{
+   typedef typename MatrixType::Iterator  Iterator;
+
+   for( size_t i=0UL; i<lu_.rows(); ++i )
+   {
+      const Iterator diag( lu_.begin(i) + diag_[i] );
+
+      for( Iterator lik=lu_.begin(i); lik!=diag; ++lik )
+      {
+         const size_t k( lik->index() );
+         const Iterator ukk( lu_.begin(k) + diag_[k] );
+
+         lik->value() /= ukk->value();
+
+         Iterator aij( lik+1 );
+         Iterator ukj( ukk+1 );
+
+         while( aij != lu_.end(i) && ukj != lu_.end(k) ) {
+            if( aij->index() < ukj->index() ) ++aij;
+            else if( ukj->index() < aij->index() ) ++ukj;
+            else {
+               aij->value() -= lik->value() * ukj->value();
+               ++aij;
+               ++ukj;
+            }
+         }
+      }
+
+      if( isDefault( diag->value() ) )
+         throw std::invalid_argument( "Zero pivot detected" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PRECONDITIONING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Applies the preconditioner to the given residual vector.
+//
+// \param r The residual vector.
+// \param z The preconditioned residual vector \f$ z = (L \cdot U)^{-1} \cdot r \f$.
+// \return void
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename VT1     // Type of the residual vector
+        , typename VT2 >   // Type of the preconditioned residual vector
+void IncompleteLU<Type>::apply( const DenseVector<VT1,columnVector>& r,
+                                DenseVector<VT2,columnVector>& z ) const
+{
+   typedef typename MatrixType::ConstIterator  ConstIterator;
+
+   const size_t n( lu_.rows() );
+
+   VT2& y( ~z );
+   y = ~r;
+
+   // Forward substitution with the unit lower triangular factor L
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const ConstIterator diag( lu_.begin(i) + diag_[i] );
+      Type tmp( y[i] );
+      for( ConstIterator element=lu_.begin(i); element!=diag; ++element ) {
+         tmp -= element->value() * y[element->index()];
+      }
+      y[i] = tmp;
+   }
+
+   // Backward substitution with the upper triangular factor U
+   for( size_t i=n; i-- > 0UL; )
+   {
+      const ConstIterator diag( lu_.begin(i) + diag_[i] );
+      Type tmp( y[i] );
+      for( ConstIterator element=diag+1; element!=lu_.end(i); ++element ) {
+         tmp -= element->value() * y[element->index()];
+      }
+      y[i] = tmp / diag->value();
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,185 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/JacobiPreconditioner.h
+//  \brief Header file for the JacobiPreconditioner class template
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_JACOBIPRECONDITIONER_H_
+#define _BLAZE_MATH_SOLVERS_JACOBIPRECONDITIONER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/util/constraints/FloatingPoint.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Jacobi (diagonal) preconditioner for the iterative linear system solvers.
+// \ingroup lse_solvers
+//
+// The JacobiPreconditioner class template represents the preconditioner \f$ M = D \f$, where
+// \a D is the diagonal of the system matrix. The inverse of the diagonal is computed once during
+// the construction. Its application is a single componentwise vector multiplication, which is
+// vectorized and executed by the active SMP backend:
+
+   \code
+   blaze::CompressedMatrix<double> A( 1000UL, 1000UL );
+   blaze::DynamicVector<double> b( 1000UL ), x;
+   // ... Initialization of A and b
+
+   blaze::JacobiPreconditioner<double> jacobi( A );
+
+   blaze::PCG pcg;
+   pcg.solve( A, b, x, jacobi );
+   \endcode
+
+// The system matrix can be any dense or sparse matrix. In case the matrix is not square or
+// any diagonal element is zero, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the matrix elements
+class JacobiPreconditioner
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   template< typename MT, bool SO >
+   explicit inline JacobiPreconditioner( const Matrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Preconditioning functions*******************************************************************
+   /*!\name Preconditioning functions */
+   //@{
+   template< typename VT1, typename VT2 >
+   inline void apply( const DenseVector<VT1,columnVector>& r, DenseVector<VT2,columnVector>& z ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   DynamicVector<Type> inv_;  //!< The inverse of the diagonal of the system matrix.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates a Jacobi preconditioner for the given system matrix.
+//
+// \param A The system matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Zero diagonal element detected.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename MT      // Type of the system matrix
+        , bool SO >        // Storage order of the system matrix
+inline JacobiPreconditioner<Type>::JacobiPreconditioner( const Matrix<MT,SO>& A )
+   : inv_( (~A).rows() )  // The inverse of the diagonal of the system matrix
+{
+   if( (~A).rows() != (~A).columns() )
+      throw std::invalid_argument( "Invalid non-square matrix provided" );
+
+   for( size_t i=0UL; i<inv_.size(); ++i )
+   {
+      const Type diag( (~A)(i,i) );
+
+      if( isDefault( diag ) )
+         throw std::invalid_argument( "Zero diagonal element detected" );
+
+      inv_[i] = Type(1) / diag;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PRECONDITIONING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Applies the preconditioner to the given residual vector.
+//
+// \param r The residual vector.
+// \param z The preconditioned residual vector \f$ z = D^{-1} \cdot r \f$.
+// \return void
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename VT1     // Type of the residual vector
+        , typename VT2 >   // Type of the preconditioned residual vector
+inline void JacobiPreconditioner<Type>::apply( const DenseVector<VT1,columnVector>& r,
+                                               DenseVector<VT2,columnVector>& z ) const
+{
+   ~z = inv_ * (~r);
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,540 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/LUDecomposition.h
+//  \brief Header file for the LUDecomposition class template
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_LUDECOMPOSITION_H_
+#define _BLAZE_MATH_SOLVERS_LUDECOMPOSITION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/DenseSubmatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/UniLowerMatrix.h>
+#include <blaze/util/constraints/FloatingPoint.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Blocked LU decomposition with partial pivoting of a square dense matrix.
+// \ingroup lse_solvers
+//
+// The LUDecomposition class template computes and stores the decomposition \f$ P \cdot A = L
+// \cdot U \f$ of a square dense matrix \a A, where \a P is a permutation matrix, \a L is a unit
+// lower triangular matrix and \a U is an upper triangular matrix. The decomposition is computed
+// once and can afterwards be reused to solve an arbitrary number of linear systems \f$ A \cdot
+// x = b \f$ with the same system matrix:
+
+   \code
+   blaze::DynamicMatrix<double> A( 500UL, 500UL );
+   blaze::DynamicVector<double> b( 500UL ), x;
+   // ... Initialization of A and b
+
+   blaze::LUDecomposition<double> lu( A );  // Decomposition of A
+
+   lu.solve( b, x );  // Solving A*x = b
+   lu.solve( b );     // Solving A*x = b in-place; b is overwritten with the solution
+   \endcode
+
+// The decomposition is computed by a right-looking blocked algorithm. Each panel of \a blockSize
+// columns is decomposed column by column, the corresponding block row of \a U is computed by
+// means of the inverse of the unit lower triangular diagonal block of \a L (using the triangular
+// UniLowerMatrix multiplication kernel) and the trailing submatrix is updated by a single dense
+// matrix/dense matrix multiplication. Therefore the bulk of the computation is performed by the
+// matrix multiplication kernels of the Blaze library, which are either the BLAS kernels (in case
+// the BLAZE_BLAS_MODE is enabled) or the native, vectorized and parallelized Blaze kernels.
+//
+// The element type \a Type must be a built-in floating point data type. In case the matrix is
+// not square or singular a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the matrix elements
+class LUDecomposition
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef DynamicMatrix<Type,columnMajor>  MatrixType;   //!< Type of the matrix of LU factors.
+   typedef std::vector<size_t>              PivotVector;  //!< Type of the pivot vector.
+   //**********************************************************************************************
+
+   //**Block size**********************************************************************************
+   //! Number of columns of a single panel of the blocked decomposition.
+   static const size_t blockSize = 64UL;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline LUDecomposition();
+
+   template< typename MT, bool SO >
+   explicit inline LUDecomposition( const DenseMatrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t             size       () const;
+   inline const MatrixType&  factors    () const;
+   inline const PivotVector& pivots     () const;
+   inline Type               determinant() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Decomposition functions*********************************************************************
+   /*!\name Decomposition functions */
+   //@{
+   template< typename MT, bool SO >
+   void factorize( const DenseMatrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Solver functions****************************************************************************
+   /*!\name Solver functions */
+   //@{
+   template< typename VT, bool TF >
+   void solve( DenseVector<VT,TF>& b ) const;
+
+   template< typename VT1, bool TF, typename VT2 >
+   void solve( const DenseVector<VT1,TF>& b, DenseVector<VT2,TF>& x ) const;
+
+   template< typename MT, bool SO >
+   void solve( DenseMatrix<MT,SO>& B ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MatrixType  lu_;      //!< The strictly lower part of L and the upper part of U.
+   PivotVector pivots_;  //!< The row interchanges of the partial pivoting.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER CONSTANTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename Type >  // Data type of the matrix elements
+const size_t LUDecomposition<Type>::blockSize;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for LUDecomposition.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline LUDecomposition<Type>::LUDecomposition()
+   : lu_    ()  // The strictly lower part of L and the upper part of U
+   , pivots_()  // The row interchanges of the partial pivoting
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Decomposition constructor for LUDecomposition.
+//
+// \param A The square dense matrix to be decomposed.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Decomposition of singular matrix failed.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename MT      // Type of the dense matrix
+        , bool SO >        // Storage order of the dense matrix
+inline LUDecomposition<Type>::LUDecomposition( const DenseMatrix<MT,SO>& A )
+   : lu_    ()  // The strictly lower part of L and the upper part of U
+   , pivots_()  // The row interchanges of the partial pivoting
+{
+   factorize( A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows/columns of the decomposed matrix.
+//
+// \return The number of rows/columns of the decomposed matrix.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline size_t LUDecomposition<Type>::size() const
+{
+   return lu_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the combined LU factors.
+//
+// \return The combined LU factors.
+//
+// The strictly lower part of the returned matrix contains the strictly lower part of the unit
+// lower triangular factor \a L, the upper part (including the diagonal) contains the upper
+// triangular factor \a U.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline const typename LUDecomposition<Type>::MatrixType& LUDecomposition<Type>::factors() const
+{
+   return lu_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the row interchanges of the partial pivoting.
+//
+// \return The row interchanges of the partial pivoting.
+//
+// During the decomposition row \a i of the matrix has been interchanged with row \a pivots()[i]
+// (in ascending order of \a i).
+*/
+template< typename Type >  // Data type of the matrix elements
+inline const typename LUDecomposition<Type>::PivotVector& LUDecomposition<Type>::pivots() const
+{
+   return pivots_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the determinant of the decomposed matrix.
+//
+// \return The determinant of the decomposed matrix.
+//
+// The determinant is computed as the product of the diagonal elements of \a U and the sign of
+// the row permutation.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline Type LUDecomposition<Type>::determinant() const
+{
+   const size_t n( lu_.rows() );
+
+   Type det( 1 );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      det *= lu_(i,i);
+      if( pivots_[i] != i )
+         det = -det;
+   }
+
+   return det;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DECOMPOSITION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the LU decomposition of the given square dense matrix.
+//
+// \param A The square dense matrix to be decomposed.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Decomposition of singular matrix failed.
+//
+// This function computes the LU decomposition of the given matrix and replaces any previously
+// computed decomposition. In case the decomposition fails, the LUDecomposition is reset to the
+// state of a default constructed decomposition.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename MT      // Type of the dense matrix
+        , bool SO >        // Storage order of the dense matrix
+void LUDecomposition<Type>::factorize( const DenseMatrix<MT,SO>& A )
+{
+   using std::abs;
+   using std::swap;
+
+   if( !isSquare( ~A ) )
+      throw std::invalid_argument( "Invalid non-square matrix provided" );
+
+   lu_ = ~A;
+
+   const size_t n( lu_.rows() );
+
+   pivots_.resize( n );
+
+   MatrixType tmp, L21, U12;
+   UniLowerMatrix<MatrixType> L11;
+
+   for( size_t k=0UL; k<n; k+=blockSize )
+   {
+      const size_t kb  ( min( blockSize, n-k ) );
+      const size_t kend( k+kb );
+
+      // Unblocked decomposition of the current panel
+      for( size_t j=k; j<kend; ++j )
+      {
+         size_t pivot( j );
+         Type   max  ( abs( lu_(j,j) ) );
+
+         for( size_t i=j+1UL; i<n; ++i ) {
+            if( abs( lu_(i,j) ) > max ) {
+               max   = abs( lu_(i,j) );
+               pivot = i;
+            }
+         }
+
+         if( isDefault( max ) ) {
+            lu_.clear();
+            pivots_.clear();
+            throw std::invalid_argument( "Decomposition of singular matrix failed" );
+         }
+
+         pivots_[j] = pivot;
+
+         if( pivot != j ) {
+            for( size_t l=0UL; l<n; ++l )
+               swap( lu_(j,l), lu_(pivot,l) );
+         }
+
+         const Type inv( Type(1) / lu_(j,j) );
+
+         for( size_t i=j+1UL; i<n; ++i )
+            lu_(i,j) *= inv;
+
+         for( size_t l=j+1UL; l<kend; ++l ) {
+            const Type ujl( lu_(j,l) );
+            for( size_t i=j+1UL; i<n; ++i )
+               lu_(i,l) -= lu_(i,j) * ujl;
+         }
+      }
+
+      if( kend == n ) break;
+
+      const size_t rest( n - kend );
+
+      // Inversion of the unit lower triangular diagonal block
+      tmp.resize( kb, kb, false );
+      reset( tmp );
+
+      for( size_t j=0UL; j<kb; ++j ) {
+         tmp(j,j) = Type(1);
+         for( size_t l=j; l<kb; ++l ) {
+            const Type xl( tmp(l,j) );
+            for( size_t i=l+1UL; i<kb; ++i )
+               tmp(i,j) -= lu_(k+i,k+l) * xl;
+         }
+      }
+
+      L11 = tmp;
+
+      // Computation of the block row of U and update of the trailing submatrix
+      U12 = L11 * submatrix( lu_, k, kend, kb, rest );
+      submatrix( lu_, k, kend, kb, rest ) = U12;
+
+      L21 = submatrix( lu_, kend, k, rest, kb );
+      submatrix( lu_, kend, kend, rest, rest ) -= L21 * U12;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solves the linear system \f$ A \cdot x = b \f$ in-place.
+//
+// \param b The right-hand side vector, which is overwritten with the solution vector.
+// \return void
+// \exception std::invalid_argument Invalid right-hand side vector size.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename VT      // Type of the right-hand side vector
+        , bool TF >        // Transpose flag of the right-hand side vector
+void LUDecomposition<Type>::solve( DenseVector<VT,TF>& b ) const
+{
+   using std::swap;
+
+   VT& x( ~b );
+
+   const size_t n( lu_.rows() );
+
+   if( x.size() != n )
+      throw std::invalid_argument( "Invalid right-hand side vector size" );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( pivots_[i] != i )
+         swap( x[i], x[pivots_[i]] );
+   }
+
+   for( size_t j=0UL; j<n; ++j ) {
+      const Type xj( x[j] );
+      for( size_t i=j+1UL; i<n; ++i )
+         x[i] -= lu_(i,j) * xj;
+   }
+
+   for( size_t j=n; j-->0UL; ) {
+      x[j] /= lu_(j,j);
+      const Type xj( x[j] );
+      for( size_t i=0UL; i<j; ++i )
+         x[i] -= lu_(i,j) * xj;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the linear system \f$ A \cdot x = b \f$.
+//
+// \param b The right-hand side vector.
+// \param x The solution vector.
+// \return void
+// \exception std::invalid_argument Invalid right-hand side vector size.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename VT1     // Type of the right-hand side vector
+        , bool TF          // Transpose flag of the vectors
+        , typename VT2 >   // Type of the solution vector
+void LUDecomposition<Type>::solve( const DenseVector<VT1,TF>& b, DenseVector<VT2,TF>& x ) const
+{
+   if( (~b).size() != lu_.rows() )
+      throw std::invalid_argument( "Invalid right-hand side vector size" );
+
+   ~x = ~b;
+   solve( ~x );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the linear system \f$ A \cdot X = B \f$ in-place.
+//
+// \param B The matrix of right-hand sides, which is overwritten with the solution.
+// \return void
+// \exception std::invalid_argument Invalid right-hand side matrix size.
+//
+// This function solves the linear system for each column of the given matrix \a B.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename MT      // Type of the right-hand side matrix
+        , bool SO >        // Storage order of the right-hand side matrix
+void LUDecomposition<Type>::solve( DenseMatrix<MT,SO>& B ) const
+{
+   using std::swap;
+
+   MT& X( ~B );
+
+   const size_t n( lu_.rows() );
+
+   if( X.rows() != n )
+      throw std::invalid_argument( "Invalid right-hand side matrix size" );
+
+   for( size_t c=0UL; c<X.columns(); ++c )
+   {
+      for( size_t i=0UL; i<n; ++i ) {
+         if( pivots_[i] != i )
+            swap( X(i,c), X(pivots_[i],c) );
+      }
+
+      for( size_t j=0UL; j<n; ++j ) {
+         const Type xj( X(j,c) );
+         for( size_t i=j+1UL; i<n; ++i )
+            X(i,c) -= lu_(i,j) * xj;
+      }
+
+      for( size_t j=n; j-->0UL; ) {
+         X(j,c) /= lu_(j,j);
+         const Type xj( X(j,c) );
+         for( size_t i=0UL; i<j; ++i )
+            X(i,c) -= lu_(i,j) * xj;
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
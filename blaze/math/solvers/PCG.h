@@ -0,0 +1,268 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/PCG.h
+//  \brief Header file for the preconditioned conjugate gradient solver
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_PCG_H_
+#define _BLAZE_MATH_SOLVERS_PCG_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/solvers/IdentityPreconditioner.h>
+#include <blaze/math/solvers/Solver.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/util/constraints/FloatingPoint.h>
+#include <blaze/util/logging/DebugSection.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief A preconditioned conjugate gradient solver.
+// \ingroup lse_solvers
+//
+// The PCG class solves the linear system \f$ A \cdot x = b \f$ for a symmetric positive definite
+// system matrix \a A by means of the preconditioned conjugate gradient method. The system matrix
+// can be any dense or sparse matrix, the preconditioner can be any class providing an \a apply()
+// function (see for instance the IdentityPreconditioner, the JacobiPreconditioner, the
+// SSORPreconditioner and the IncompleteCholesky class templates):
+
+   \code
+   blaze::CompressedMatrix<double> A( 1000UL, 1000UL );
+   blaze::DynamicVector<double> b( 1000UL ), x;
+   // ... Initialization of A and b
+
+   blaze::PCG pcg;
+   pcg.setThreshold( 1E-10 );
+   pcg.solve( A, b, x );                                          // Unpreconditioned CG
+   pcg.solve( A, b, x, blaze::IncompleteCholesky<double>( A ) );  // IC(0) preconditioned CG
+   \endcode
+
+// In case the size of \a x matches the size of \a b, \a x is used as initial guess, otherwise
+// it is resized and initialized with zero. The iteration stops as soon as the relative residual
+// \f$ \|b - A \cdot x\|_2 / \|b\|_2 \f$ drops below the threshold of the solver or the maximum
+// number of iterations is reached. All vector updates, scalar products and norms are computed
+// by the vectorized kernels and are executed in parallel by the active SMP backend. In contrast
+// to the CG solver the system matrix is not explicitly checked for symmetry.
+*/
+class PCG : public Solver
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline PCG();
+   //@}
+   //**********************************************************************************************
+
+   //**Solver functions****************************************************************************
+   /*!\name Solver functions */
+   //@{
+   template< typename MT, bool SO, typename VT1, typename VT2 >
+   inline bool solve( const Matrix<MT,SO>& A, const DenseVector<VT1,columnVector>& b,
+                      DenseVector<VT2,columnVector>& x );
+
+   template< typename MT, bool SO, typename VT1, typename VT2, typename PT >
+   bool solve( const Matrix<MT,SO>& A, const DenseVector<VT1,columnVector>& b,
+               DenseVector<VT2,columnVector>& x, const PT& M );
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for the preconditioned conjugate gradient solver.
+*/
+inline PCG::PCG()
+   : Solver()  // Initialization of the base class
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solves the given linear system without preconditioning.
+//
+// \param A The symmetric positive definite system matrix.
+// \param b The right-hand side vector.
+// \param x The vector of unknowns (initial guess and solution).
+// \return \a true if the solution meets the threshold, \a false if not.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector size.
+*/
+template< typename MT     // Type of the system matrix
+        , bool SO         // Storage order of the system matrix
+        , typename VT1    // Type of the right-hand side vector
+        , typename VT2 >  // Type of the vector of unknowns
+inline bool PCG::solve( const Matrix<MT,SO>& A, const DenseVector<VT1,columnVector>& b,
+                        DenseVector<VT2,columnVector>& x )
+{
+   return solve( A, b, x, IdentityPreconditioner() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the given linear system with the given preconditioner.
+//
+// \param A The symmetric positive definite system matrix.
+// \param b The right-hand side vector.
+// \param x The vector of unknowns (initial guess and solution).
+// \param M The symmetric positive definite preconditioner.
+// \return \a true if the solution meets the threshold, \a false if not.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector size.
+//
+// The iteration is terminated prematurely (returning \a false) in case a search direction
+// with non-positive curvature \f$ p^T \cdot A \cdot p \le 0 \f$ is detected, i.e. in case the
+// system matrix or the preconditioner is not positive definite.
+*/
+template< typename MT     // Type of the system matrix
+        , bool SO         // Storage order of the system matrix
+        , typename VT1    // Type of the right-hand side vector
+        , typename VT2    // Type of the vector of unknowns
+        , typename PT >   // Type of the preconditioner
+bool PCG::solve( const Matrix<MT,SO>& A, const DenseVector<VT1,columnVector>& b,
+                 DenseVector<VT2,columnVector>& x, const PT& M )
+{
+   typedef typename VT2::ElementType  ET;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( ET );
+
+   const size_t n( (~b).size() );
+
+   if( (~A).rows() != (~A).columns() )
+      throw std::invalid_argument( "Invalid non-square matrix provided" );
+
+   if( (~A).rows() != n )
+      throw std::invalid_argument( "Invalid right-hand side vector size" );
+
+   if( (~x).size() != n ) {
+      ~x = ~b;
+      reset( ~x );
+   }
+
+   bool converged( false );
+   size_t it( 0UL );
+
+   const ET bnorm( length( ~b ) );
+   const ET scale( ( bnorm != ET(0) )?( ET(1) / bnorm ):( ET(1) ) );
+
+   DynamicVector<ET> r( (~b) - (~A) * (~x) );
+   DynamicVector<ET> z( n ), p( n ), q( n );
+
+   lastPrecision_ = length( r ) * scale;
+   converged = ( lastPrecision_ <= threshold_ );
+
+   if( !converged ) {
+      M.apply( r, z );
+      p = z;
+   }
+
+   ET rz( sum( r * z ) );
+
+   for( ; !converged && it<maxIterations_; ++it )
+   {
+      q = (~A) * p;
+
+      const ET pq( sum( p * q ) );
+      if( !( pq > ET(0) ) )
+         break;
+
+      const ET alpha( rz / pq );
+
+      ~x += alpha * p;
+      r  -= alpha * q;
+
+      lastPrecision_ = length( r ) * scale;
+
+      if( lastPrecision_ <= threshold_ ) {
+         converged = true;
+         ++it;
+         break;
+      }
+
+      M.apply( r, z );
+
+      const ET rzNew( sum( r * z ) );
+
+      p = z + ( rzNew / rz ) * p;
+      rz = rzNew;
+   }
+
+   BLAZE_LOG_DEBUG_SECTION( log ) {
+      if( converged )
+         log << "      Solved the linear system in " << it << " PCG iterations.";
+      else
+         log << "      WARNING: Did not solve the linear system within accuracy. ("
+             << lastPrecision_ << ")";
+   }
+
+   lastIterations_ = it;
+
+   return converged;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -41,13 +41,18 @@
 //*************************************************************************************************
 
 #include <cmath>
+#include <stdexcept>
+#include <vector>
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/DynamicVector.h>
 #include <blaze/math/Functions.h>
 #include <blaze/math/problems/BoxLCP.h>
 #include <blaze/math/problems/ContactLCP.h>
 #include <blaze/math/problems/LCP.h>
+#include <blaze/math/smp/FusedKernel.h>
 #include <blaze/math/solvers/Solver.h>
+#include <blaze/math/typetraits/BlockSize.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/ColorMacros.h>
 #include <blaze/util/logging/DebugSection.h>
@@ -66,17 +71,72 @@ namespace blaze {
 /*!\brief A projected Gauss-Seidel Solver for (box) LCPs.
 // \ingroup complementarity_solvers
 //
-// TODO: description of the PGS solver
-// TODO: capabilities of the PGS solver (which LCP problems, etc)
+// The PGS class solves (box) LCPs and contact LCPs by means of projected Gauss-Seidel sweeps.
+// The unknowns are relaxed in blocks: in case of an LCP or a box LCP every unknown forms a
+// block of its own, in case of a contact LCP the normal and the two frictional unknowns of a
+// contact form a block. The order of the relaxations within a sweep is selected by the mode of
+// the solver:
+//
+//  - \a sequential: The blocks are relaxed one after another in the order of the unknowns. This
+//    is the classical, strictly sequential Gauss-Seidel sweep.
+//  - \a colored: The blocks are colored such that no two coupled blocks share the same color.
+//    The colors are processed one after another, all blocks of a single color are relaxed in
+//    parallel. The result of a sweep only depends on the color ordering, which is recomputed
+//    in a deterministic fashion at the beginning of every solution process.
+//  - \a blockJacobi: The blocks are split into a fixed number of contiguous partitions, which
+//    are relaxed in parallel. Within a partition the sweep is a Gauss-Seidel sweep, the
+//    couplings to other partitions use the solution of the previous sweep (block-Jacobi/Gauss-
+//    Seidel hybrid). Since the partitioning does not depend on the number of threads, the
+//    result is deterministic. Note however that, depending on the coupling between the
+//    partitions, this mode may require more iterations than the other two modes.
+//
+// The parallel modes are executed by the active SMP backend in case the number of blocks to
+// relax in parallel exceeds the SMP_PGS_THRESHOLD.
+
+   \code
+   blaze::ContactLCP lcp;
+   // ... Initialization of the contact LCP
+
+   blaze::PGS pgs( blaze::PGS::colored );
+   pgs.solve( lcp );
+   \endcode
+
 // TODO: known issues of the PGS solver
 */
 class PGS : public Solver
 {
  public:
+   //**Mode definition*****************************************************************************
+   //! Execution modes of the PGS solver.
+   enum Mode {
+      sequential  = 0,  //!< Strictly sequential Gauss-Seidel sweeps.
+      colored     = 1,  //!< Parallel relaxation of the blocks of a single color.
+      blockJacobi = 2   //!< Parallel relaxation of contiguous partitions of blocks.
+   };
+   //**********************************************************************************************
+
    //**Constructors********************************************************************************
    /*!\name Constructors */
    //@{
-   explicit PGS();
+   explicit PGS( Mode mode=sequential );
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline Mode   getMode()       const;
+   inline size_t getPartitions() const;
+   inline size_t getColors()     const;
+   inline size_t getColor( size_t block ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Set functions*******************************************************************************
+   /*!\name Set functions */
+   //@{
+   inline void setMode      ( Mode mode );
+   inline void setPartitions( size_t partitions );
    //@}
    //**********************************************************************************************
 
@@ -88,19 +148,165 @@ class PGS : public Solver
    //**********************************************************************************************
 
  private:
+   //**ColorKernel class definition****************************************************************
+   /*!\brief Kernel for the parallel relaxation of the blocks of a single color.
+   */
+   template< typename CP >  // Type of the complementarity problem
+   struct ColorKernel
+   {
+      //**Type definitions*************************************************************************
+      typedef real  ElementType;  //!< Element type of the kernel.
+      typedef real  ResultType;   //!< Resulting type of the kernel.
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the ColorKernel class template.
+      //
+      // \param pgs The PGS solver.
+      // \param cp The complementarity problem to solve.
+      // \param blocks The blocks of the current color.
+      */
+      explicit inline ColorKernel( const PGS& pgs, CP& cp, const size_t* blocks )
+         : pgs_   ( pgs    )  // The PGS solver
+         , cp_    ( cp     )  // The complementarity problem to solve
+         , blocks_( blocks )  // The blocks of the current color
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Relaxes the blocks in the range [\a begin, \a end) of the current color.
+      //
+      // \param begin The index of the first block of the range.
+      // \param end The index one past the last block of the range.
+      // \return The maximum change of an unknown.
+      */
+      inline ResultType operator()( size_t begin, size_t end ) const {
+         const size_t n( cp_.size() );
+         real rmax( 0 );
+         for( size_t k=begin; k<end; ++k )
+            rmax = max( rmax, pgs_.relax( cp_, blocks_[k], 0UL, n ) );
+         return rmax;
+      }
+      //*******************************************************************************************
+
+      //**Combine function*************************************************************************
+      /*!\brief Combines the results of two ranges.
+      //
+      // \param a The result of the first range.
+      // \param b The result of the second range.
+      // \return The maximum of both results.
+      */
+      static inline ResultType combine( ResultType a, ResultType b ) {
+         return max( a, b );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      const PGS&    pgs_;     //!< The PGS solver.
+      CP&           cp_;      //!< The complementarity problem to solve.
+      const size_t* blocks_;  //!< The blocks of the current color.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**PartitionKernel class definition************************************************************
+   /*!\brief Kernel for the parallel relaxation of contiguous partitions of blocks.
+   //
+   // The kernel relaxes all partitions whose first block lies in the given range of blocks.
+   // Therefore the partitioning is independent of the number of threads.
+   */
+   template< typename CP >  // Type of the complementarity problem
+   struct PartitionKernel
+   {
+      //**Type definitions*************************************************************************
+      typedef real  ElementType;  //!< Element type of the kernel.
+      typedef real  ResultType;   //!< Resulting type of the kernel.
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the PartitionKernel class template.
+      //
+      // \param pgs The PGS solver.
+      // \param cp The complementarity problem to solve.
+      // \param blocks The total number of blocks.
+      */
+      explicit inline PartitionKernel( const PGS& pgs, CP& cp, size_t blocks )
+         : pgs_   ( pgs    )  // The PGS solver
+         , cp_    ( cp     )  // The complementarity problem to solve
+         , blocks_( blocks )  // The total number of blocks
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Relaxes all partitions starting in the range [\a begin, \a end) of blocks.
+      //
+      // \param begin The index of the first block of the range.
+      // \param end The index one past the last block of the range.
+      // \return The maximum change of an unknown.
+      */
+      inline ResultType operator()( size_t begin, size_t end ) const {
+         const size_t bs( BlockSize<CP>::value );
+         const size_t partitions( pgs_.partitions_ );
+         real rmax( 0 );
+         for( size_t p=0UL; p<partitions; ++p ) {
+            const size_t first( (  p      *blocks_ ) / partitions );
+            const size_t last ( ( (p+1UL)*blocks_ ) / partitions );
+            if( first < begin || first >= end ) continue;
+            for( size_t i=first; i<last; ++i )
+               rmax = max( rmax, pgs_.relax( cp_, i, first*bs, last*bs ) );
+         }
+         return rmax;
+      }
+      //*******************************************************************************************
+
+      //**Combine function*************************************************************************
+      /*!\brief Combines the results of two ranges.
+      //
+      // \param a The result of the first range.
+      // \param b The result of the second range.
+      // \return The maximum of both results.
+      */
+      static inline ResultType combine( ResultType a, ResultType b ) {
+         return max( a, b );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      const PGS& pgs_;     //!< The PGS solver.
+      CP&        cp_;      //!< The complementarity problem to solve.
+      size_t     blocks_;  //!< The total number of blocks.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
-   template< typename CP > inline real sweep( CP& cp ) const;
+   template< typename CP > inline real sweep           ( CP& cp );
+   template< typename CP > inline real sweepColored    ( CP& cp );
+   template< typename CP > inline real sweepBlockJacobi( CP& cp );
+   template< typename CP > inline real relax( CP& cp, size_t block, size_t lo, size_t hi ) const;
+
+   inline real product( const CMatMxN& A, const VecN& x, size_t i, size_t lo, size_t hi ) const;
+
+   void color( const CMatMxN& A, size_t bs );
    //@}
    //**********************************************************************************************
 
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   VecN diagonal_;  //!< Vector for the diagonal entries of the LCP matrix.
-                    /*!< For performance reasons, the vector contains the inverse of the
-                         diagonal elements. */
+   Mode mode_;                         //!< The execution mode of the solver.
+   size_t partitions_;                 //!< The number of partitions in block-Jacobi mode.
+   VecN diagonal_;                     //!< Vector for the diagonal entries of the LCP matrix.
+                                       /*!< For performance reasons, the vector contains the
+                                            inverse of the diagonal elements. */
+   VecN xprev_;                        //!< The solution of the previous sweep.
+                                       /*!< In block-Jacobi mode the couplings between the
+                                            partitions use the solution of the previous sweep. */
+   std::vector<size_t> colors_;        //!< The colors of the blocks.
+   std::vector<size_t> order_;         //!< The blocks sorted by color.
+   std::vector<size_t> colorOffsets_;  //!< The offsets of the colors within the block order.
    //@}
    //**********************************************************************************************
 };
@@ -109,6 +315,114 @@ class PGS : public Solver
 
 
 
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the execution mode of the solver.
+//
+// \return The execution mode of the solver.
+*/
+inline PGS::Mode PGS::getMode() const
+{
+   return mode_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of partitions in block-Jacobi mode.
+//
+// \return The number of partitions in block-Jacobi mode.
+*/
+inline size_t PGS::getPartitions() const
+{
+   return partitions_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of colors of the last coloring.
+//
+// \return The number of colors of the last coloring.
+//
+// The blocks of a complementarity problem are colored at the beginning of every solution
+// process in \a colored mode. In case no such solution process has been performed yet, the
+// function returns 0.
+*/
+inline size_t PGS::getColors() const
+{
+   return colorOffsets_.empty() ? 0UL : colorOffsets_.size() - 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the color of a block of the last coloring.
+//
+// \param block The index of the block.
+// \return The color of the block in the range \f$[0..colors-1]\f$.
+//
+// In case of a contact LCP, the block with index \a block consists of the unknowns
+// \f$ 3 \cdot block \f$ to \f$ 3 \cdot block + 2 \f$, in all other cases a block consists of
+// a single unknown.
+*/
+inline size_t PGS::getColor( size_t block ) const
+{
+   BLAZE_USER_ASSERT( block < colors_.size(), "Invalid block access index" );
+   return colors_[block];
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Sets the execution mode of the solver.
+//
+// \param mode The new execution mode of the solver.
+// \return void
+*/
+inline void PGS::setMode( Mode mode )
+{
+   mode_ = mode;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets the number of partitions in block-Jacobi mode.
+//
+// \param partitions The number of partitions in block-Jacobi mode.
+// \return void
+// \exception std::invalid_argument Invalid number of partitions.
+//
+// The number of partitions determines the result of a block-Jacobi sweep, but is independent
+// of the number of threads. It should therefore be chosen as a multiple of the number of
+// threads.
+*/
+inline void PGS::setPartitions( size_t partitions )
+{
+   if( partitions == 0UL )
+      throw std::invalid_argument( "Invalid number of partitions" );
+
+   partitions_ = partitions;
+}
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  UTILITY FUNCTIONS
@@ -129,6 +443,7 @@ bool PGS::solve( CP& cp )
    const size_t n( cp.size() );
    const CMatMxN& A( cp.A_ );
    bool converged( false );
+   stagnated_ = false;
 
    // Allocating the helper data
    diagonal_.resize( n, false );
@@ -140,6 +455,11 @@ bool PGS::solve( CP& cp )
       diagonal_[i] = real(1) / tmp;
    }
 
+   // Coloring the blocks of the complementarity problem
+   if( mode_ == colored ) {
+      color( A, BlockSize<CP>::value );
+   }
+
    // Projecting the initial solution to a feasible region
    for( size_t i=0; i<n; ++i ) {
       cp.project( i );
@@ -153,15 +473,24 @@ bool PGS::solve( CP& cp )
    // The main iteration loop
    size_t it( 0 );
 
-   for( ; !converged && it<maxIterations_; ++it ) {
-      lastPrecision_ = sweep( cp );
+   for( ; !converged && !stagnated_ && it<maxIterations_; ++it ) {
+      const real previous( lastPrecision_ );
+      switch( mode_ ) {
+         case colored    : lastPrecision_ = sweepColored( cp );     break;
+         case blockJacobi: lastPrecision_ = sweepBlockJacobi( cp ); break;
+         default         : lastPrecision_ = sweep( cp );            break;
+      }
       if( lastPrecision_ < threshold_ )
          converged = true;
+      else if( it > 0UL && hasStagnated( previous, lastPrecision_ ) )
+         stagnated_ = true;
    }
 
    BLAZE_LOG_DEBUG_SECTION( log ) {
       if( converged )
          log << "      Solved the complementarity problem in " << it << " PGS iterations.";
+      else if( stagnated_ )
+         log << BLAZE_YELLOW << "      WARNING: The PGS iterations stagnated after " << it << " iterations. (" << lastPrecision_ << ")" << BLAZE_OLDCOLOR;
       else
          log << BLAZE_YELLOW << "      WARNING: Did not solve the complementarity problem within accuracy. (" << lastPrecision_ << ")" << BLAZE_OLDCOLOR;
    }
@@ -174,83 +503,192 @@ bool PGS::solve( CP& cp )
 
 
 //*************************************************************************************************
-/*!\brief TODO
+/*!\brief Performs a sequential projected Gauss-Seidel sweep.
 //
 // \param cp The complementarity problem to solve.
-// \return TODO
-//
-// TODO
+// \return The maximum change of an unknown during the sweep.
 */
 template< typename CP >  // Type of the complementarity problem
-inline real PGS::sweep( CP& cp ) const
+inline real PGS::sweep( CP& cp )
 {
-   real maxResidual( 0 ), xold( 0 );
    const size_t n( cp.size() );
+   const size_t N( n / BlockSize<CP>::value );
+   real rmax( 0 );
 
+   for( size_t i=0; i<N; ++i ) {
+      rmax = max( rmax, relax( cp, i, 0UL, n ) );
+   }
+
+   return rmax;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Performs a parallel projected Gauss-Seidel sweep based on the coloring of the blocks.
+//
+// \param cp The complementarity problem to solve.
+// \return The maximum change of an unknown during the sweep.
+//
+// The colors are processed in ascending order, the blocks of a single color are mutually
+// independent and are therefore relaxed in parallel.
+*/
+template< typename CP >  // Type of the complementarity problem
+inline real PGS::sweepColored( CP& cp )
+{
+   const size_t colors( colorOffsets_.size() - 1UL );
+   real rmax( 0 );
+
+   for( size_t c=0UL; c<colors; ++c ) {
+      const size_t offset( colorOffsets_[c] );
+      const size_t count ( colorOffsets_[c+1UL] - offset );
+      const ColorKernel<CP> kernel( *this, cp, &order_[0] + offset );
+      rmax = max( rmax, smpFusedKernel( count, kernel, smpPGSThreshold ) );
+   }
+
+   return rmax;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Performs a parallel block-Jacobi/Gauss-Seidel sweep.
+//
+// \param cp The complementarity problem to solve.
+// \return The maximum change of an unknown during the sweep.
+//
+// The partitions of blocks are relaxed in parallel by means of Gauss-Seidel sweeps. The
+// couplings between the partitions use the solution of the previous sweep.
+*/
+template< typename CP >  // Type of the complementarity problem
+inline real PGS::sweepBlockJacobi( CP& cp )
+{
+   xprev_ = cp.x_;
+
+   const PartitionKernel<CP> kernel( *this, cp, cp.size() / BlockSize<CP>::value );
+   return smpFusedKernel( cp.size() / BlockSize<CP>::value, kernel, smpPGSThreshold );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Relaxes a single block of unknowns.
+//
+// \param cp The complementarity problem to solve.
+// \param block The index of the block.
+// \param lo The index of the first unknown of the current solution.
+// \param hi The index one past the last unknown of the current solution.
+// \return The maximum change of an unknown of the block.
+//
+// The residual of the block uses the current solution for all unknowns in the range
+// [\a lo, \a hi) and the solution of the previous sweep for all other unknowns.
+*/
+template< typename CP >  // Type of the complementarity problem
+inline real PGS::relax( CP& cp, size_t block, size_t lo, size_t hi ) const
+{
    const CMatMxN& A( cp.A_ );
    const VecN&    b( cp.b_ );
    VecN& x( cp.x_ );
 
-   for( size_t i=0; i<n; ++i )
-   {
-      const real residual( - b[i] - ( A * x )[i] );
+   const size_t i( block );
+   const real residual( - b[i] - product( A, x, i, lo, hi ) );
 
-      // Updating and projecting the unknown
-      xold = x[i];
-      x[i] += diagonal_[i] * residual;
-      cp.project( i );
-      maxResidual = max( maxResidual, std::fabs( xold - x[i] ) );
-   }
+   // Updating and projecting the unknown
+   const real xold( x[i] );
+   x[i] += diagonal_[i] * residual;
+   cp.project( i );
 
-   return maxResidual;
+   return std::fabs( xold - x[i] );
 }
 //*************************************************************************************************
 
 
 //*************************************************************************************************
-/*!\brief TODO
+/*!\brief Relaxes the three unknowns of a single contact.
 //
-// \param cp The complementarity problem to solve.
-// \return TODO
+// \param cp The contact LCP to solve.
+// \param block The index of the contact.
+// \param lo The index of the first unknown of the current solution.
+// \param hi The index one past the last unknown of the current solution.
+// \return The maximum change of an unknown of the contact.
 //
-// TODO: specialization for contact LCPs
-// TODO: more infos
+// The normal unknown is projected to the positive half-line, the frictional unknowns are
+// projected to the friction box defined by the updated normal unknown.
 */
 template<>
-inline real PGS::sweep( ContactLCP& cp ) const
+inline real PGS::relax( ContactLCP& cp, size_t block, size_t lo, size_t hi ) const
 {
-   const size_t N( cp.size() / 3 );
    real rmax( 0 ), residual, flimit, aux;
-   size_t j;
+   size_t j( block * 3UL );
 
    const CMatMxN& A( cp.A_ );
    const VecN&  b( cp.b_ );
    VecN& x( cp.x_ );
 
-   for( size_t i=0; i<N; ++i )
+   residual = -b[j] - product( A, x, j, lo, hi );
+   aux = max( 0, x[j] + diagonal_[j] * residual );
+   rmax = max( rmax, std::fabs( x[j] - aux ) );
+   x[j] = aux;
+
+   flimit = cp.cof_[block] * x[j];
+
+   ++j;
+   residual = -b[j] - product( A, x, j, lo, hi );
+   aux = max( -flimit, min( flimit, x[j] + diagonal_[j] * residual ) );
+   rmax = max( rmax, std::fabs( x[j] - aux ) );
+   x[j] = aux;
+
+   ++j;
+   residual = -b[j] - product( A, x, j, lo, hi );
+   aux = max( -flimit, min( flimit, x[j] + diagonal_[j] * residual ) );
+   rmax = max( rmax, std::fabs( x[j] - aux ) );
+   x[j] = aux;
+
+   return rmax;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the product of a row of the LCP matrix with the solution.
+//
+// \param A The LCP matrix.
+// \param x The current solution.
+// \param i The index of the row.
+// \param lo The index of the first unknown of the current solution.
+// \param hi The index one past the last unknown of the current solution.
+// \return The product of the row with the solution.
+//
+// The product uses the current solution for all unknowns in the range [\a lo, \a hi) and the
+// solution of the previous sweep for all other unknowns. The summation order matches the one
+// of a sparse matrix/dense vector multiplication.
+*/
+inline real PGS::product( const CMatMxN& A, const VecN& x, size_t i, size_t lo, size_t hi ) const
+{
+   const CMatMxN::ConstIterator end( A.end(i) );
+   CMatMxN::ConstIterator element( A.begin(i) );
+
+   const size_t kpos( A.nonZeros(i) & size_t(-2) );
+   real sum1( 0 ), sum2( 0 );
+
+   for( size_t k=0UL; k<kpos; k+=2UL )
    {
-      j = i * 3;
-      residual = -b[j] - ( A * x )[j];
-      aux = max( 0, x[j] + diagonal_[j] * residual );
-      rmax = max( rmax, std::fabs( x[j] - aux ) );
-      x[j] = aux;
-
-      flimit = cp.cof_[i] * x[j];
-
-      ++j;
-      residual = -b[j] - ( A * x )[j];
-      aux = max( -flimit, min( flimit, x[j] + diagonal_[j] * residual ) );
-      rmax = max( rmax, std::fabs( x[j] - aux ) );
-      x[j] = aux;
-
-      ++j;
-      residual = -b[j] - ( A * x )[j];
-      aux = max( -flimit, min( flimit, x[j] + diagonal_[j] * residual ) );
-      rmax = max( rmax, std::fabs( x[j] - aux ) );
-      x[j] = aux;
+      const real   value1( element->value() );
+      const size_t index1( element->index() );
+      ++element;
+      const real   value2( element->value() );
+      const size_t index2( element->index() );
+      ++element;
+
+      sum1 += value1 * ( ( index1 >= lo && index1 < hi )?( x[index1] ):( xprev_[index1] ) );
+      sum2 += value2 * ( ( index2 >= lo && index2 < hi )?( x[index2] ):( xprev_[index2] ) );
+   }
+   if( element != end ) {
+      const size_t index( element->index() );
+      sum1 += element->value() * ( ( index >= lo && index < hi )?( x[index] ):( xprev_[index] ) );
    }
 
-   return rmax;
+   return sum1 + sum2;
 }
 //*************************************************************************************************
 
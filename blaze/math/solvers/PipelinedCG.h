@@ -0,0 +1,250 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/PipelinedCG.h
+//  \brief Header file for the pipelined conjugate gradient solver
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_PIPELINEDCG_H_
+#define _BLAZE_MATH_SOLVERS_PIPELINEDCG_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <stdexcept>
+#include <blaze/math/dense/FusedKernels.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/solvers/Solver.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/util/constraints/FloatingPoint.h>
+#include <blaze/util/logging/DebugSection.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief A pipelined conjugate gradient solver.
+// \ingroup lse_solvers
+//
+// The PipelinedCG class solves the linear system \f$ A \cdot x = b \f$ for a symmetric positive
+// definite system matrix \a A by means of the Chronopoulos/Gear variant of the conjugate gradient
+// method. In contrast to the classical formulation (see the PCG class) both scalar products of
+// an iteration are computed from the same vectors and the recurrence \f$ s = A \cdot p \f$ is
+// updated instead of recomputed. Thus each iteration consists of only two sweeps over the data:
+
+//  - the fused multiplication \f$ w = A \cdot r \f$ with the scalar product \f$ r^T \cdot w \f$
+//    (see the fusedMultDot() function) and
+//  - the fused update of the vectors \a p, \a s, \a x and \a r with the scalar product
+//    \f$ r^T \cdot r \f$ (see the fusedCGUpdate() function).
+
+// Both sweeps are vectorized and executed in parallel by the active SMP backend. For row-major
+// sparse system matrices the multiplication and the scalar product are performed in a single
+// sweep over the rows of the matrix:
+
+   \code
+   blaze::CompressedMatrix<double> A( 1000UL, 1000UL );
+   blaze::DynamicVector<double> b( 1000UL ), x;
+   // ... Initialization of A and b
+
+   blaze::PipelinedCG cg;
+   cg.setThreshold( 1E-10 );
+   cg.solve( A, b, x );
+   \endcode
+
+// In case the size of \a x matches the size of \a b, \a x is used as initial guess, otherwise
+// it is resized and initialized with zero. The iteration stops as soon as the relative residual
+// \f$ \|r\|_2 / \|b\|_2 \f$ of the recursively updated residual \a r drops below the threshold of
+// the solver or the maximum number of iterations is reached. Note that due to the additional
+// recurrence the updated residual may deviate slightly further from the true residual than in
+// the classical formulation. The memory requirement of the solver is four vectors of the size
+// of the linear system.
+*/
+class PipelinedCG : public Solver
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline PipelinedCG();
+   //@}
+   //**********************************************************************************************
+
+   //**Solver functions****************************************************************************
+   /*!\name Solver functions */
+   //@{
+   template< typename MT, bool SO, typename VT1, typename VT2 >
+   bool solve( const Matrix<MT,SO>& A, const DenseVector<VT1,columnVector>& b,
+               DenseVector<VT2,columnVector>& x );
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for the pipelined conjugate gradient solver.
+*/
+inline PipelinedCG::PipelinedCG()
+   : Solver()  // Initialization of the base class
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solves the given linear system.
+//
+// \param A The symmetric positive definite system matrix.
+// \param b The right-hand side vector.
+// \param x The vector of unknowns (initial guess and solution).
+// \return \a true if the solution meets the threshold, \a false if not.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector size.
+//
+// The iteration is terminated prematurely (returning \a false) in case a search direction
+// with non-positive curvature is detected, i.e. in case the system matrix is not positive
+// definite.
+*/
+template< typename MT     // Type of the system matrix
+        , bool SO         // Storage order of the system matrix
+        , typename VT1    // Type of the right-hand side vector
+        , typename VT2 >  // Type of the vector of unknowns
+bool PipelinedCG::solve( const Matrix<MT,SO>& A, const DenseVector<VT1,columnVector>& b,
+                         DenseVector<VT2,columnVector>& x )
+{
+   using std::sqrt;
+
+   typedef typename VT2::ElementType  ET;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( ET );
+
+   const size_t n( (~b).size() );
+
+   if( (~A).rows() != (~A).columns() )
+      throw std::invalid_argument( "Invalid non-square matrix provided" );
+
+   if( (~A).rows() != n )
+      throw std::invalid_argument( "Invalid right-hand side vector size" );
+
+   if( (~x).size() != n ) {
+      ~x = ~b;
+      reset( ~x );
+   }
+
+   bool converged( false );
+   size_t it( 0UL );
+
+   const ET bnorm( length( ~b ) );
+   const ET scale( ( bnorm != ET(0) )?( ET(1) / bnorm ):( ET(1) ) );
+
+   DynamicVector<ET> r( (~b) - (~A) * (~x) );
+   DynamicVector<ET> w( n ), p( n, ET(0) ), s( n, ET(0) );
+
+   ET gamma( sum( r * r ) );
+   ET alpha( 0 ), beta( 0 );
+
+   lastPrecision_ = sqrt( gamma ) * scale;
+   converged = ( lastPrecision_ <= threshold_ );
+
+   if( !converged ) {
+      const ET delta( fusedMultDot( w, ~A, r ) );
+      if( delta > ET(0) )
+         alpha = gamma / delta;
+   }
+
+   for( ; !converged && alpha > ET(0) && it<maxIterations_; ++it )
+   {
+      const ET gammaNew( fusedCGUpdate( ~x, r, p, s, w, alpha, beta ) );
+
+      lastPrecision_ = sqrt( gammaNew ) * scale;
+
+      if( lastPrecision_ <= threshold_ ) {
+         converged = true;
+         ++it;
+         break;
+      }
+
+      const ET delta( fusedMultDot( w, ~A, r ) );
+
+      beta = gammaNew / gamma;
+
+      const ET curvature( delta - beta * gammaNew / alpha );
+      if( !( curvature > ET(0) ) ) {
+         ++it;
+         break;
+      }
+
+      alpha = gammaNew / curvature;
+      gamma = gammaNew;
+   }
+
+   BLAZE_LOG_DEBUG_SECTION( log ) {
+      if( converged )
+         log << "      Solved the linear system in " << it << " pipelined CG iterations.";
+      else
+         log << "      WARNING: Did not solve the linear system within accuracy. (" << lastPrecision_ << ")";
+   }
+
+   lastIterations_ = it;
+
+   return converged;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,524 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/QRDecomposition.h
+//  \brief Header file for the QRDecomposition class template
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_QRDECOMPOSITION_H_
+#define _BLAZE_MATH_SOLVERS_QRDECOMPOSITION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <stdexcept>
+#include <blaze/math/DenseSubmatrix.h>
+#include <blaze/math/DenseSubvector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/UpperMatrix.h>
+#include <blaze/util/constraints/FloatingPoint.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Blocked Householder QR decomposition of a dense matrix.
+// \ingroup lse_solvers
+//
+// The QRDecomposition class template computes and stores the decomposition \f$ A = Q \cdot R \f$
+// of a general \f$ M \times N \f$ dense matrix \a A with \f$ M \ge N \f$, where \a Q is an
+// orthogonal matrix and \a R is an upper triangular matrix. \a Q is stored implicitly as the
+// product of \a N Householder reflections \f$ H_j = I - \tau_j v_j v_j^T \f$. The decomposition
+// is computed once and can afterwards be reused to solve an arbitrary number of linear least
+// squares problems \f$ \min \| A \cdot x - b \|_2 \f$ with the same system matrix:
+
+   \code
+   blaze::DynamicMatrix<double> A( 800UL, 500UL );
+   blaze::DynamicVector<double> b( 800UL ), x;
+   // ... Initialization of A and b
+
+   blaze::QRDecomposition<double> qr( A );  // Decomposition of A
+
+   qr.solve( b, x );  // Least squares solution of A*x = b
+   \endcode
+
+// The decomposition is computed by a blocked algorithm. The Householder reflections of a panel
+// of \a blockSize columns are accumulated in the compact WY representation \f$ H_1 \cdots H_k =
+// I - V \cdot T \cdot V^T \f$ with upper triangular \a T (represented by an UpperMatrix) and the
+// trailing submatrix is updated by means of dense matrix/dense matrix multiplications, which are
+// performed by the BLAS kernels (in case the BLAZE_BLAS_MODE is enabled) or the native,
+// vectorized and parallelized Blaze kernels.
+//
+// The element type \a Type must be a built-in floating point data type. In case the matrix has
+// less rows than columns a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the matrix elements
+class QRDecomposition
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef DynamicMatrix<Type,columnMajor>  MatrixType;  //!< Type of the matrix of QR factors.
+   typedef DynamicVector<Type,columnVector> VectorType;  //!< Type of the vector of scalar factors.
+   //**********************************************************************************************
+
+   //**Block size**********************************************************************************
+   //! Number of columns of a single panel of the blocked decomposition.
+   static const size_t blockSize = 32UL;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline QRDecomposition();
+
+   template< typename MT, bool SO >
+   explicit inline QRDecomposition( const DenseMatrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t            rows   () const;
+   inline size_t            columns() const;
+   inline const MatrixType& factors() const;
+   inline const VectorType& tau    () const;
+   inline MatrixType        Q      () const;
+   inline MatrixType        R      () const;
+   //@}
+   //**********************************************************************************************
+
+   //**Decomposition functions*********************************************************************
+   /*!\name Decomposition functions */
+   //@{
+   template< typename MT, bool SO >
+   void factorize( const DenseMatrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Solver functions****************************************************************************
+   /*!\name Solver functions */
+   //@{
+   template< typename VT1, bool TF, typename VT2 >
+   void solve( const DenseVector<VT1,TF>& b, DenseVector<VT2,TF>& x ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MatrixType qr_;   //!< The Householder vectors and the upper triangular factor R.
+   VectorType tau_;  //!< The scalar factors of the Householder reflections.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER CONSTANTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename Type >  // Data type of the matrix elements
+const size_t QRDecomposition<Type>::blockSize;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for QRDecomposition.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline QRDecomposition<Type>::QRDecomposition()
+   : qr_ ()  // The Householder vectors and the upper triangular factor R
+   , tau_()  // The scalar factors of the Householder reflections
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Decomposition constructor for QRDecomposition.
+//
+// \param A The dense matrix to be decomposed.
+// \exception std::invalid_argument Invalid matrix size.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename MT      // Type of the dense matrix
+        , bool SO >        // Storage order of the dense matrix
+inline QRDecomposition<Type>::QRDecomposition( const DenseMatrix<MT,SO>& A )
+   : qr_ ()  // The Householder vectors and the upper triangular factor R
+   , tau_()  // The scalar factors of the Householder reflections
+{
+   factorize( A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows of the decomposed matrix.
+//
+// \return The number of rows of the decomposed matrix.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline size_t QRDecomposition<Type>::rows() const
+{
+   return qr_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of columns of the decomposed matrix.
+//
+// \return The number of columns of the decomposed matrix.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline size_t QRDecomposition<Type>::columns() const
+{
+   return qr_.columns();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the combined QR factors.
+//
+// \return The combined QR factors.
+//
+// The upper part (including the diagonal) of the returned matrix contains the upper triangular
+// factor \a R, the strictly lower part of column \a j contains the Householder vector \f$ v_j \f$
+// (the leading element of \f$ v_j \f$ is 1 and not stored).
+*/
+template< typename Type >  // Data type of the matrix elements
+inline const typename QRDecomposition<Type>::MatrixType& QRDecomposition<Type>::factors() const
+{
+   return qr_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the scalar factors of the Householder reflections.
+//
+// \return The scalar factors of the Householder reflections.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline const typename QRDecomposition<Type>::VectorType& QRDecomposition<Type>::tau() const
+{
+   return tau_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the first \a N columns of the orthogonal factor \a Q.
+//
+// \return The \f$ M \times N \f$ matrix of the first \a N columns of \a Q.
+//
+// This function explicitly forms the first \a N columns of the orthogonal factor \a Q by
+// applying the Householder reflections to the first \a N columns of the identity matrix.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline typename QRDecomposition<Type>::MatrixType QRDecomposition<Type>::Q() const
+{
+   const size_t m( qr_.rows()    );
+   const size_t n( qr_.columns() );
+
+   MatrixType Q( m, n, Type(0) );
+
+   for( size_t j=0UL; j<n; ++j )
+      Q(j,j) = Type(1);
+
+   for( size_t j=n; j-->0UL; ) {
+      for( size_t l=j; l<n; ++l ) {
+         Type w( Q(j,l) );
+         for( size_t i=j+1UL; i<m; ++i )
+            w += qr_(i,j) * Q(i,l);
+         w *= tau_[j];
+         Q(j,l) -= w;
+         for( size_t i=j+1UL; i<m; ++i )
+            Q(i,l) -= qr_(i,j) * w;
+      }
+   }
+
+   return Q;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the upper triangular factor \a R.
+//
+// \return The \f$ N \times N \f$ upper triangular factor \a R.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline typename QRDecomposition<Type>::MatrixType QRDecomposition<Type>::R() const
+{
+   const size_t n( qr_.columns() );
+
+   MatrixType R( n, n, Type(0) );
+
+   for( size_t j=0UL; j<n; ++j )
+      for( size_t i=0UL; i<=j; ++i )
+         R(i,j) = qr_(i,j);
+
+   return R;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DECOMPOSITION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the QR decomposition of the given dense matrix.
+//
+// \param A The dense matrix to be decomposed.
+// \return void
+// \exception std::invalid_argument Invalid matrix size.
+//
+// This function computes the QR decomposition of the given \f$ M \times N \f$ matrix and
+// replaces any previously computed decomposition. In case the matrix has less rows than
+// columns a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename MT      // Type of the dense matrix
+        , bool SO >        // Storage order of the dense matrix
+void QRDecomposition<Type>::factorize( const DenseMatrix<MT,SO>& A )
+{
+   using std::sqrt;
+
+   if( (~A).rows() < (~A).columns() )
+      throw std::invalid_argument( "Invalid matrix size" );
+
+   qr_ = ~A;
+
+   const size_t m( qr_.rows()    );
+   const size_t n( qr_.columns() );
+
+   tau_.resize( n, false );
+
+   MatrixType V, S, W, tmp;
+   UpperMatrix<MatrixType> T;
+
+   for( size_t k=0UL; k<n; k+=blockSize )
+   {
+      const size_t kb  ( min( blockSize, n-k ) );
+      const size_t kend( k+kb );
+
+      // Unblocked decomposition of the current panel
+      for( size_t j=k; j<kend; ++j )
+      {
+         const Type alpha( qr_(j,j) );
+
+         Type xnorm( 0 );
+         for( size_t i=j+1UL; i<m; ++i )
+            xnorm += qr_(i,j) * qr_(i,j);
+
+         if( isDefault( xnorm ) ) {
+            tau_[j] = Type(0);
+            continue;
+         }
+
+         const Type beta( ( alpha < Type(0) )?( sqrt( alpha*alpha + xnorm ) )
+                                             :( -sqrt( alpha*alpha + xnorm ) ) );
+         const Type scale( Type(1) / ( alpha - beta ) );
+
+         tau_[j]  = ( beta - alpha ) / beta;
+         qr_(j,j) = beta;
+
+         for( size_t i=j+1UL; i<m; ++i )
+            qr_(i,j) *= scale;
+
+         for( size_t l=j+1UL; l<kend; ++l ) {
+            Type w( qr_(j,l) );
+            for( size_t i=j+1UL; i<m; ++i )
+               w += qr_(i,j) * qr_(i,l);
+            w *= tau_[j];
+            qr_(j,l) -= w;
+            for( size_t i=j+1UL; i<m; ++i )
+               qr_(i,l) -= qr_(i,j) * w;
+         }
+      }
+
+      if( kend == n ) break;
+
+      const size_t mrest( m - k    );
+      const size_t nrest( n - kend );
+
+      // Setup of the unit lower trapezoidal matrix of Householder vectors
+      V.resize( mrest, kb, false );
+
+      for( size_t j=0UL; j<kb; ++j ) {
+         for( size_t i=0UL; i<j; ++i )
+            V(i,j) = Type(0);
+         V(j,j) = Type(1);
+         for( size_t i=j+1UL; i<mrest; ++i )
+            V(i,j) = qr_(k+i,k+j);
+      }
+
+      // Setup of the upper triangular factor T of the compact WY representation
+      S = trans( V ) * V;
+
+      tmp.resize( kb, kb, false );
+      reset( tmp );
+
+      for( size_t j=0UL; j<kb; ++j ) {
+         const Type t( tau_[k+j] );
+         for( size_t i=0UL; i<j; ++i ) {
+            Type sum( 0 );
+            for( size_t l=i; l<j; ++l )
+               sum += tmp(i,l) * S(l,j);
+            tmp(i,j) = -t * sum;
+         }
+         tmp(j,j) = t;
+      }
+
+      T = tmp;
+
+      // Update of the trailing submatrix
+      W = trans( V ) * submatrix( qr_, k, kend, mrest, nrest );
+      tmp = trans( T ) * W;
+      submatrix( qr_, k, kend, mrest, nrest ) -= V * tmp;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the least squares solution of the linear system \f$ A \cdot x = b \f$.
+//
+// \param b The right-hand side vector.
+// \param x The least squares solution vector.
+// \return void
+// \exception std::invalid_argument Invalid right-hand side vector size.
+// \exception std::invalid_argument Rank-deficient matrix detected.
+//
+// This function computes the vector \a x that minimizes \f$ \| A \cdot x - b \|_2 \f$. For a
+// square matrix \a A, \a x is the solution of the linear system \f$ A \cdot x = b \f$.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename VT1     // Type of the right-hand side vector
+        , bool TF          // Transpose flag of the vectors
+        , typename VT2 >   // Type of the solution vector
+void QRDecomposition<Type>::solve( const DenseVector<VT1,TF>& b, DenseVector<VT2,TF>& x ) const
+{
+   const size_t m( qr_.rows()    );
+   const size_t n( qr_.columns() );
+
+   if( (~b).size() != m )
+      throw std::invalid_argument( "Invalid right-hand side vector size" );
+
+   DynamicVector<Type,TF> y( ~b );
+
+   for( size_t j=0UL; j<n; ++j ) {
+      Type w( y[j] );
+      for( size_t i=j+1UL; i<m; ++i )
+         w += qr_(i,j) * y[i];
+      w *= tau_[j];
+      y[j] -= w;
+      for( size_t i=j+1UL; i<m; ++i )
+         y[i] -= qr_(i,j) * w;
+   }
+
+   for( size_t j=n; j-->0UL; ) {
+      if( isDefault( qr_(j,j) ) )
+         throw std::invalid_argument( "Rank-deficient matrix detected" );
+      y[j] /= qr_(j,j);
+      const Type yj( y[j] );
+      for( size_t i=0UL; i<j; ++i )
+         y[i] -= qr_(i,j) * yj;
+   }
+
+   ~x = subvector( y, 0UL, n );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
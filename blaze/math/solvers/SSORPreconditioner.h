@@ -0,0 +1,269 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/SSORPreconditioner.h
+//  \brief Header file for the SSORPreconditioner class template
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_SSORPRECONDITIONER_H_
+#define _BLAZE_MATH_SOLVERS_SSORPRECONDITIONER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/util/constraints/FloatingPoint.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Symmetric successive over-relaxation (SSOR) preconditioner.
+// \ingroup lse_solvers
+//
+// The SSORPreconditioner class template represents the preconditioner
+
+      \f[ M = \frac{\omega}{2-\omega} \left( \frac{D}{\omega} + L \right)
+          \left( \frac{D}{\omega} \right)^{-1} \left( \frac{D}{\omega} + U \right), \f]
+
+// where \a D, \a L and \a U are the diagonal, the strictly lower and the strictly upper part
+// of the system matrix and \f$ \omega \in (0,2) \f$ is the relaxation parameter. For \f$ \omega
+// = 1 \f$ this is the symmetric Gauss-Seidel preconditioner. The system matrix is copied into a
+// row-major CompressedMatrix, the application of the preconditioner consists of one forward and
+// one backward substitution sweep over this matrix:
+
+   \code
+   blaze::CompressedMatrix<double> A( 1000UL, 1000UL );
+   blaze::DynamicVector<double> b( 1000UL ), x;
+   // ... Initialization of A and b
+
+   blaze::SSORPreconditioner<double> ssor( A, 1.2 );
+
+   blaze::PCG pcg;
+   pcg.solve( A, b, x, ssor );
+   \endcode
+
+// For a symmetric positive definite system matrix the SSOR preconditioner is symmetric positive
+// definite as well and can therefore be used with the PCG solver. In case the matrix is not
+// square, any diagonal element is zero or the relaxation parameter is not in the range (0,2),
+// a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the matrix elements
+class SSORPreconditioner
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef CompressedMatrix<Type,rowMajor>  MatrixType;  //!< Type of the stored system matrix.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   template< typename MT, bool SO >
+   explicit inline SSORPreconditioner( const Matrix<MT,SO>& A, Type omega=Type(1) );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline Type omega() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Preconditioning functions*******************************************************************
+   /*!\name Preconditioning functions */
+   //@{
+   template< typename VT1, typename VT2 >
+   void apply( const DenseVector<VT1,columnVector>& r, DenseVector<VT2,columnVector>& z ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MatrixType          A_;      //!< Row-major copy of the system matrix.
+   DynamicVector<Type> scale_;  //!< The scaled diagonal \f$ D/\omega \f$.
+   Type                omega_;  //!< The relaxation parameter.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates a SSOR preconditioner for the given system matrix.
+//
+// \param A The system matrix.
+// \param omega The relaxation parameter in the range (0,2).
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid relaxation parameter.
+// \exception std::invalid_argument Zero diagonal element detected.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename MT      // Type of the system matrix
+        , bool SO >        // Storage order of the system matrix
+inline SSORPreconditioner<Type>::SSORPreconditioner( const Matrix<MT,SO>& A, Type omega )
+   : A_    ( ~A )                 // Row-major copy of the system matrix
+   , scale_( A_.rows(), Type() )  // The scaled diagonal
+   , omega_( omega )              // The relaxation parameter
+{
+   if( A_.rows() != A_.columns() )
+      throw std::invalid_argument( "Invalid non-square matrix provided" );
+
+   if( !( omega > Type(0) && omega < Type(2) ) )
+      throw std::invalid_argument( "Invalid relaxation parameter" );
+
+   for( size_t i=0UL; i<A_.rows(); ++i )
+   {
+      const typename MatrixType::ConstIterator diag( A_.find( i, i ) );
+
+      if( diag == A_.end(i) || isDefault( diag->value() ) )
+         throw std::invalid_argument( "Zero diagonal element detected" );
+
+      scale_[i] = diag->value() / omega;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the relaxation parameter of the preconditioner.
+//
+// \return The relaxation parameter \f$ \omega \f$.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline Type SSORPreconditioner<Type>::omega() const
+{
+   return omega_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PRECONDITIONING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Applies the preconditioner to the given residual vector.
+//
+// \param r The residual vector.
+// \param z The preconditioned residual vector \f$ z = M^{-1} \cdot r \f$.
+// \return void
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename VT1     // Type of the residual vector
+        , typename VT2 >   // Type of the preconditioned residual vector
+void SSORPreconditioner<Type>::apply( const DenseVector<VT1,columnVector>& r,
+                                      DenseVector<VT2,columnVector>& z ) const
+{
+   typedef typename MatrixType::ConstIterator  ConstIterator;
+
+   const size_t n( A_.rows() );
+
+   VT2& y( ~z );
+   y = ~r;
+
+   // Forward substitution with (D/omega + L), followed by the multiplication with D/omega
+   for( size_t i=0UL; i<n; ++i )
+   {
+      Type tmp( y[i] );
+      for( ConstIterator element=A_.begin(i); element!=A_.end(i) && element->index()<i; ++element ) {
+         tmp -= element->value() * y[element->index()];
+      }
+      y[i] = tmp / scale_[i];
+   }
+
+   for( size_t i=0UL; i<n; ++i ) {
+      y[i] *= scale_[i];
+   }
+
+   // Backward substitution with (D/omega + U)
+   for( size_t i=n; i-- > 0UL; )
+   {
+      Type tmp( y[i] );
+      for( ConstIterator element=A_.end(i); element!=A_.begin(i); ) {
+         --element;
+         if( element->index() <= i ) break;
+         tmp -= element->value() * y[element->index()];
+      }
+      y[i] = tmp / scale_[i];
+   }
+
+   y *= ( Type(2) - omega_ ) / omega_;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
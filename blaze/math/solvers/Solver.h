@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <cmath>
 #include <limits>
 #include <blaze/system/Solvers.h>
 #include <blaze/util/Types.h>
@@ -73,22 +74,32 @@ class Solver
    //**Get functions*******************************************************************************
    /*!\name Get functions */
    //@{
-   inline size_t getMaxIterations()  const;
-   inline size_t getLastIterations() const;
-   inline real   getLastPrecision()  const;
-   inline real   getThreshold()      const;
+   inline size_t getMaxIterations()     const;
+   inline size_t getLastIterations()    const;
+   inline real   getLastPrecision()     const;
+   inline real   getThreshold()         const;
+   inline real   getRelativeThreshold() const;
+   inline bool   isStagnated()          const;
    //@}
    //**********************************************************************************************
 
    //**Set functions***************************************************************************
    /*!\name Set functions */
    //@{
-   inline void   setMaxIterations( size_t maxIterations );
-   inline void   setThreshold    ( real threshold );
+   inline void   setMaxIterations    ( size_t maxIterations );
+   inline void   setThreshold        ( real threshold );
+   inline void   setRelativeThreshold( real threshold );
    //@}
    //**********************************************************************************************
 
  protected:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool hasStagnated( real previous, real current ) const;
+   //@}
+   //**********************************************************************************************
+
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
@@ -98,6 +109,14 @@ class Solver
    size_t lastIterations_;  //!< The number of iterations spent in the last solution process.
    real   lastPrecision_;   //!< The precision of the solution after the solution process.
    real   threshold_;       //!< Precision threshold for the solution.
+   real   relThreshold_;    //!< Threshold for the relative change of the precision.
+                            /*!< The solution process is terminated as soon as the relative
+                                 change of the precision between two iterations drops below
+                                 this threshold. A value of 0 disables the criterion. */
+   bool   stagnated_;       //!< Stagnation flag of the last solution process.
+                            /*!< The flag is set in case the last solution process has been
+                                 terminated by the relative threshold before reaching the
+                                 precision threshold. */
    //@}
    //**********************************************************************************************
 };
@@ -120,6 +139,8 @@ inline Solver::Solver()
    , lastIterations_( 0 )                                 // The number of iterations spent in the last solution process
    , lastPrecision_ ( std::numeric_limits<real>::max() )  // The precision of the solution after the solution process
    , threshold_     ( solvers::threshold )                // Precision threshold for the solution
+   , relThreshold_  ( 0 )                                 // Threshold for the relative change of the precision
+   , stagnated_     ( false )                             // Stagnation flag of the last solution process
 {}
 //*************************************************************************************************
 
@@ -183,6 +204,33 @@ inline real Solver::getThreshold() const
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Returns the threshold for the relative change of the precision between two iterations.
+//
+// \return The threshold for the relative change of the precision.
+*/
+inline real Solver::getRelativeThreshold() const
+{
+   return relThreshold_;
+}
+
+
+/*!\brief Returns whether the last solution process has been terminated due to stagnation.
+//
+// \return \a true in case the last solution process stagnated, \a false if not.
+//
+// In case the precision of the solution improves by less than the relative threshold between
+// two iterations (see setRelativeThreshold()), the solution process is terminated even though
+// the precision threshold has not been reached. In this case the solver returns \a false and
+// this function returns \a true.
+*/
+inline bool Solver::isStagnated() const
+{
+   return stagnated_;
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -214,6 +262,49 @@ inline void Solver::setThreshold( real threshold )
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Sets the threshold for the relative change of the precision between two iterations.
+//
+// \param threshold The threshold for the relative change of the precision.
+//
+// An iterative solver terminates the solution process as soon as the precision of the solution
+// improves by less than the given fraction between two iterations, i.e. as soon as
+// \f$ |p_{k-1} - p_k| \leq threshold \cdot p_{k-1} \f$ holds for the precisions \f$ p_{k-1} \f$
+// and \f$ p_k \f$ of two consecutive iterations. This allows to terminate early in case further
+// iterations would only marginally improve the solution (as for instance in case of a warm-started
+// solution process). Since the precision threshold has not been reached in this case, the solver
+// returns \a false and reports the stagnation via isStagnated(). Per default the threshold is 0,
+// which disables the criterion.
+*/
+inline void Solver::setRelativeThreshold( real threshold )
+{
+   relThreshold_ = threshold;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checks whether the precision has stagnated between two iterations.
+//
+// \param previous The precision of the previous iteration.
+// \param current The precision of the current iteration.
+// \return \a true in case the relative change is below the relative threshold, \a false if not.
+*/
+inline bool Solver::hasStagnated( real previous, real current ) const
+{
+   return relThreshold_ > real(0) && std::fabs( previous - current ) <= relThreshold_ * previous;
+}
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
@@ -44,11 +44,21 @@ namespace blaze {
 //
 //=================================================================================================
 
+class BiCGSTAB;
 class CG;
 class CPG;
 class GaussianElimination;
+class GMRES;
+class IdentityPreconditioner;
+template< typename > class IncompleteCholesky;
+template< typename > class IncompleteLU;
+template< typename > class JacobiPreconditioner;
 class Lemke;
+class PCG;
 class PGS;
+class PipelinedCG;
+template< typename > class SSORPreconditioner;
+class WarmStart;
 
 } // namespace blaze
 
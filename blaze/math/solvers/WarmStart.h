@@ -0,0 +1,281 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/WarmStart.h
+//  \brief Header file for the warm-start facility of the complementarity solvers
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_WARMSTART_H_
+#define _BLAZE_MATH_SOLVERS_WARMSTART_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/typetraits/BlockSize.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Warm-starting of complementarity problems across time steps.
+// \ingroup complementarity_solvers
+//
+// The WarmStart class transfers the solution of a complementarity problem to the next, slightly
+// modified complementarity problem (as for instance the contact problem of the next time step
+// of a simulation). For that purpose, every block of unknowns is identified by a unique
+// identifier (as for instance the identifier of a contact). In case of an LCP or box LCP, each
+// unknown forms a block of its own, in case of a contact LCP, the three unknowns of a contact
+// form a block. After the solution of a problem its solution is stored via the store() function.
+// Before the solution of the next problem, the apply() function initializes the unknowns of all
+// blocks with a known identifier with the previous solution, all other unknowns are set to 0:
+
+   \code
+   blaze::PGS pgs;
+   blaze::WarmStart warmstart;
+   std::vector<size_t> ids;
+
+   for( size_t step=0UL; step<steps; ++step )
+   {
+      blaze::ContactLCP lcp;
+      // ... Setup of the contact LCP and the contact identifiers
+
+      warmstart.apply( lcp, ids );
+      pgs.solve( lcp );
+      warmstart.store( lcp, ids );
+   }
+   \endcode
+
+// Note that the unknowns are projected to the feasible region by the solvers. In combination
+// with a relative threshold (see Solver::setRelativeThreshold()), warm-starting can considerably
+// reduce the number of iterations per time step.
+*/
+class WarmStart
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline WarmStart();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size () const;
+   inline void   clear();
+
+   template< typename CP > inline void   store( const CP& cp, const std::vector<size_t>& ids );
+   template< typename CP > inline size_t apply( CP& cp, const std::vector<size_t>& ids ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   typedef std::pair<size_t,size_t>  Entry;  //!< Pair of an identifier and a block index.
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t bs_;                  //!< The number of unknowns per block.
+   VecN x_;                     //!< The stored solution.
+   std::vector<Entry> blocks_;  //!< The block indices sorted by identifier.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for the WarmStart class.
+*/
+inline WarmStart::WarmStart()
+   : bs_    ( 1UL )  // The number of unknowns per block
+   , x_     ()       // The stored solution
+   , blocks_()       // The block indices sorted by identifier
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored blocks.
+//
+// \return The number of stored blocks.
+*/
+inline size_t WarmStart::size() const
+{
+   return blocks_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clears the stored solution.
+//
+// \return void
+*/
+inline void WarmStart::clear()
+{
+   bs_ = 1UL;
+   x_.clear();
+   blocks_.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Stores the solution of the given complementarity problem.
+//
+// \param cp The solved complementarity problem.
+// \param ids The identifiers of the blocks of unknowns.
+// \return void
+// \exception std::invalid_argument Invalid number of identifiers.
+// \exception std::invalid_argument Duplicate identifier.
+//
+// The number of unknowns per block is determined by the type of the complementarity problem
+// (see the BlockSize type trait), i.e. the number of unknowns must be three times the number of
+// identifiers in case of a contact LCP and must match the number of identifiers in all other
+// cases. In case the number of unknowns doesn't match or in case an identifier is used for
+// several blocks, a \a std::invalid_argument exception is thrown.
+*/
+template< typename CP >  // Type of the complementarity problem
+inline void WarmStart::store( const CP& cp, const std::vector<size_t>& ids )
+{
+   const size_t bs( BlockSize<CP>::value );
+
+   if( cp.x_.size() != bs*ids.size() )
+      throw std::invalid_argument( "Invalid number of identifiers" );
+
+   std::vector<Entry> blocks( ids.size() );
+   for( size_t i=0UL; i<ids.size(); ++i ) {
+      blocks[i] = Entry( ids[i], i );
+   }
+
+   std::sort( blocks.begin(), blocks.end() );
+
+   for( size_t i=1UL; i<blocks.size(); ++i ) {
+      if( blocks[i].first == blocks[i-1UL].first )
+         throw std::invalid_argument( "Duplicate identifier" );
+   }
+
+   bs_ = bs;
+   x_  = cp.x_;
+   blocks_.swap( blocks );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initializes the unknowns of the given complementarity problem with the stored solution.
+//
+// \param cp The complementarity problem to initialize.
+// \param ids The identifiers of the blocks of unknowns.
+// \return The number of blocks initialized with the stored solution.
+// \exception std::invalid_argument Invalid number of identifiers.
+// \exception std::invalid_argument Incompatible complementarity problem.
+//
+// This function resizes the vector of unknowns to the size of the system matrix of the given
+// complementarity problem. All blocks with an identifier contained in the stored solution are
+// initialized with the stored values, all other unknowns are set to 0. The number of unknowns
+// per block is determined by the type of the complementarity problem (see the BlockSize type
+// trait). In case the number of unknowns doesn't match the number of identifiers or in case the
+// stored solution has a different number of unknowns per block, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename CP >  // Type of the complementarity problem
+inline size_t WarmStart::apply( CP& cp, const std::vector<size_t>& ids ) const
+{
+   const size_t n ( cp.A_.rows() );
+   const size_t bs( BlockSize<CP>::value );
+
+   if( n != bs*ids.size() )
+      throw std::invalid_argument( "Invalid number of identifiers" );
+
+   if( !blocks_.empty() && bs != bs_ )
+      throw std::invalid_argument( "Incompatible complementarity problem" );
+
+   cp.x_.resize( n, false );
+   cp.x_ = real(0);
+
+   size_t matches( 0UL );
+
+   for( size_t i=0UL; i<ids.size(); ++i )
+   {
+      std::vector<Entry>::const_iterator pos(
+         std::lower_bound( blocks_.begin(), blocks_.end(), Entry( ids[i], 0UL ) ) );
+
+      if( pos == blocks_.end() || pos->first != ids[i] )
+         continue;
+
+      for( size_t k=0UL; k<bs; ++k ) {
+         cp.x_[i*bs+k] = x_[pos->second*bs+k];
+      }
+
+      ++matches;
+   }
+
+   return matches;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -42,7 +42,9 @@
 
 #include <algorithm>
 #include <functional>
+#include <limits>
 #include <stdexcept>
+#include <utility>
 #include <vector>
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/expressions/SparseMatrix.h>
@@ -56,6 +58,7 @@
 #include <blaze/math/traits/AddTrait.h>
 #include <blaze/math/traits/ColumnTrait.h>
 #include <blaze/math/traits/DivTrait.h>
+#include <blaze/math/traits/IndexTrait.h>
 #include <blaze/math/traits/MathTrait.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/traits/RowTrait.h>
@@ -68,6 +71,7 @@
 #include <blaze/math/typetraits/IsStrictlyLower.h>
 #include <blaze/math/typetraits/IsStrictlyUpper.h>
 #include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/system/Standard.h>
 #include <blaze/system/StorageOrder.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
@@ -103,11 +107,11 @@ namespace blaze {
 //
 // The CompressedMatrix class template is the representation of an arbitrary sized sparse
 // matrix with \f$ M \cdot N \f$ dynamically allocated elements of arbitrary type. The type
-// of the elements and the storage order of the matrix can be specified via the two template
-// parameters:
+// of the elements, the storage order of the matrix, and the type of the stored indices can be
+// specified via the three template parameters:
 
    \code
-   template< typename Type, bool SO >
+   template< typename Type, bool SO, typename IT >
    class CompressedMatrix;
    \endcode
 
@@ -115,6 +119,12 @@ namespace blaze {
 //          any non-cv-qualified, non-reference, non-pointer element type.
 //  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
 //          The default value is blaze::rowMajor.
+//  - IT  : specifies the unsigned integral type that is used to store the column indices of a
+//          row-major matrix and the row indices of a column-major matrix, respectively. The
+//          default value is \a size_t. A narrower index type (as for instance \a unsigned
+//          \a int) reduces the memory footprint of the matrix and the memory traffic of all
+//          sparse kernels, but restricts the number of columns (row-major) or rows (column-major)
+//          to the maximum value of the index type.
 //
 // Inserting/accessing elements in a compressed matrix can be done by several alternative
 // functions. The following example demonstrates all options:
@@ -205,12 +215,13 @@ namespace blaze {
    \endcode
 */
 template< typename Type                    // Data type of the sparse matrix
-        , bool SO = defaultStorageOrder >  // Storage order
-class CompressedMatrix : public SparseMatrix< CompressedMatrix<Type,SO>, SO >
+        , bool SO = defaultStorageOrder    // Storage order
+        , typename IT = size_t >           // Index type
+class CompressedMatrix : public SparseMatrix< CompressedMatrix<Type,SO,IT>, SO >
 {
  private:
    //**Type definitions****************************************************************************
-   typedef ValueIndexPair<Type>  ElementBase;  //!< Base class for the sparse matrix element.
+   typedef ValueIndexPair<Type,IT>  ElementBase;  //!< Base class for the sparse matrix element.
    //**********************************************************************************************
 
    //**Private class Element***********************************************************************
@@ -254,17 +265,17 @@ class CompressedMatrix : public SparseMatrix< CompressedMatrix<Type,SO>, SO >
 
  public:
    //**Type definitions****************************************************************************
-   typedef CompressedMatrix<Type,SO>   This;            //!< Type of this CompressedMatrix instance.
-   typedef This                        ResultType;      //!< Result type for expression template evaluations.
-   typedef CompressedMatrix<Type,!SO>  OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
-   typedef CompressedMatrix<Type,!SO>  TransposeType;   //!< Transpose type for expression template evaluations.
-   typedef Type                        ElementType;     //!< Type of the sparse matrix elements.
-   typedef const Type&                 ReturnType;      //!< Return type for expression template evaluations.
-   typedef const This&                 CompositeType;   //!< Data type for composite expression templates.
-   typedef MatrixAccessProxy<This>     Reference;       //!< Reference to a sparse matrix value.
-   typedef const Type&                 ConstReference;  //!< Reference to a constant sparse matrix value.
-   typedef Element*                    Iterator;        //!< Iterator over non-constant elements.
-   typedef const Element*              ConstIterator;   //!< Iterator over constant elements.
+   typedef CompressedMatrix<Type,SO,IT>   This;            //!< Type of this CompressedMatrix instance.
+   typedef This                           ResultType;      //!< Result type for expression template evaluations.
+   typedef CompressedMatrix<Type,!SO,IT>  OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef CompressedMatrix<Type,!SO,IT>  TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                           ElementType;     //!< Type of the sparse matrix elements.
+   typedef const Type&                    ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                    CompositeType;   //!< Data type for composite expression templates.
+   typedef MatrixAccessProxy<This>        Reference;       //!< Reference to a sparse matrix value.
+   typedef const Type&                    ConstReference;  //!< Reference to a constant sparse matrix value.
+   typedef Element*                       Iterator;        //!< Iterator over non-constant elements.
+   typedef const Element*                 ConstIterator;   //!< Iterator over constant elements.
    //**********************************************************************************************
 
    //**Rebind struct definition********************************************************************
@@ -272,7 +283,7 @@ class CompressedMatrix : public SparseMatrix< CompressedMatrix<Type,SO>, SO >
    */
    template< typename ET >  // Data type of the other matrix
    struct Rebind {
-      typedef CompressedMatrix<ET,SO>  Other;  //!< The type of the other CompressedMatrix.
+      typedef CompressedMatrix<ET,SO,IT>  Other;  //!< The type of the other CompressedMatrix.
    };
    //**********************************************************************************************
 
@@ -294,6 +305,10 @@ class CompressedMatrix : public SparseMatrix< CompressedMatrix<Type,SO>, SO >
                                      inline CompressedMatrix( const CompressedMatrix& sm );
    template< typename MT, bool SO2 > inline CompressedMatrix( const DenseMatrix<MT,SO2>&  dm );
    template< typename MT, bool SO2 > inline CompressedMatrix( const SparseMatrix<MT,SO2>& sm );
+
+#if BLAZE_CPP11_MODE
+   inline CompressedMatrix( CompressedMatrix&& sm ) noexcept;
+#endif
    //@}
    //**********************************************************************************************
 
@@ -335,6 +350,10 @@ class CompressedMatrix : public SparseMatrix< CompressedMatrix<Type,SO>, SO >
    template< typename Other >
    inline typename EnableIf< IsNumeric<Other>, CompressedMatrix >::Type&
       operator/=( Other rhs );
+
+#if BLAZE_CPP11_MODE
+   inline CompressedMatrix& operator=( CompressedMatrix&& rhs ) noexcept;
+#endif
    //@}
    //**********************************************************************************************
 
@@ -449,8 +468,8 @@ class CompressedMatrix : public SparseMatrix< CompressedMatrix<Type,SO>, SO >
 //
 //=================================================================================================
 
-template< typename Type, bool SO >
-const Type CompressedMatrix<Type,SO>::zero_ = Type();
+template< typename Type, bool SO, typename IT >
+const Type CompressedMatrix<Type,SO,IT>::zero_ = Type();
 
 
 
@@ -465,8 +484,9 @@ const Type CompressedMatrix<Type,SO>::zero_ = Type();
 /*!\brief The default constructor for CompressedMatrix.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::CompressedMatrix()
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,SO,IT>::CompressedMatrix()
    : m_       ( 0UL )           // The current number of rows of the sparse matrix
    , n_       ( 0UL )           // The current number of columns of the sparse matrix
    , capacity_( 0UL )           // The current capacity of the pointer array
@@ -487,14 +507,17 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix()
 // The matrix is initialized to the zero matrix and has no free capacity.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,SO,IT>::CompressedMatrix( size_t m, size_t n )
    : m_       ( m )                     // The current number of rows of the sparse matrix
    , n_       ( n )                     // The current number of columns of the sparse matrix
    , capacity_( m )                     // The current capacity of the pointer array
    , begin_( new Iterator[2UL*m+2UL] )  // Pointers to the first non-zero element of each row
    , end_  ( begin_+(m+1UL) )           // Pointers one past the last non-zero element of each row
 {
+   BLAZE_USER_ASSERT( n_ <= std::numeric_limits<IT>::max(), "Too many columns for index type" );
+
    for( size_t i=0UL; i<2UL*m_+2UL; ++i )
       begin_[i] = NULL;
 }
@@ -511,14 +534,17 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n )
 // The matrix is initialized to the zero matrix.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, size_t nonzeros )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,SO,IT>::CompressedMatrix( size_t m, size_t n, size_t nonzeros )
    : m_       ( m )                     // The current number of rows of the sparse matrix
    , n_       ( n )                     // The current number of columns of the sparse matrix
    , capacity_( m )                     // The current capacity of the pointer array
    , begin_( new Iterator[2UL*m+2UL] )  // Pointers to the first non-zero element of each row
    , end_  ( begin_+(m+1UL) )           // Pointers one past the last non-zero element of each row
 {
+   BLAZE_USER_ASSERT( n_ <= std::numeric_limits<IT>::max(), "Too many columns for index type" );
+
    begin_[0UL] = allocate<Element>( nonzeros );
    for( size_t i=1UL; i<(2UL*m_+1UL); ++i )
       begin_[i] = begin_[0UL];
@@ -539,14 +565,17 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, size_t n
 // \a m elements, in case of a column-major matrix at least \a n elements.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+CompressedMatrix<Type,SO,IT>::CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
    : m_       ( m )                      // The current number of rows of the sparse matrix
    , n_       ( n )                      // The current number of columns of the sparse matrix
    , capacity_( m )                      // The current capacity of the pointer array
    , begin_( new Iterator[2UL*m_+2UL] )  // Pointers to the first non-zero element of each row
    , end_  ( begin_+(m_+1UL) )           // Pointers one past the last non-zero element of each row
 {
+   BLAZE_USER_ASSERT( n_ <= std::numeric_limits<IT>::max(), "Too many columns for index type" );
+
    BLAZE_USER_ASSERT( nonzeros.size() == m, "Size of capacity vector and number of rows don't match" );
 
    size_t newCapacity( 0UL );
@@ -567,8 +596,9 @@ CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, const std::vect
 // \param sm Sparse matrix to be copied.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::CompressedMatrix( const CompressedMatrix& sm )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,SO,IT>::CompressedMatrix( const CompressedMatrix& sm )
    : m_       ( sm.m_ )                     // The current number of rows of the sparse matrix
    , n_       ( sm.n_ )                     // The current number of columns of the sparse matrix
    , capacity_( sm.m_ )                     // The current capacity of the pointer array
@@ -591,16 +621,19 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( const CompressedMatrix& sm )
 // \param dm Dense matrix to be copied.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the foreign dense matrix
         , bool SO2 >     // Storage order of the foreign dense matrix
-inline CompressedMatrix<Type,SO>::CompressedMatrix( const DenseMatrix<MT,SO2>& dm )
+inline CompressedMatrix<Type,SO,IT>::CompressedMatrix( const DenseMatrix<MT,SO2>& dm )
    : m_       ( (~dm).rows() )              // The current number of rows of the sparse matrix
    , n_       ( (~dm).columns() )           // The current number of columns of the sparse matrix
    , capacity_( m_ )                        // The current capacity of the pointer array
    , begin_   ( new Iterator[2UL*m_+2UL] )  // Pointers to the first non-zero element of each row
    , end_     ( begin_+(m_+1UL) )           // Pointers one past the last non-zero element of each row
 {
+   BLAZE_USER_ASSERT( n_ <= std::numeric_limits<IT>::max(), "Too many columns for index type" );
+
    using blaze::assign;
 
    for( size_t i=0UL; i<2UL*m_+2UL; ++i )
@@ -617,17 +650,18 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( const DenseMatrix<MT,SO2>& d
 // \param sm Sparse matrix to be copied.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the foreign sparse matrix
         , bool SO2 >     // Storage order of the foreign sparse matrix
-inline CompressedMatrix<Type,SO>::CompressedMatrix( const SparseMatrix<MT,SO2>& sm )
+inline CompressedMatrix<Type,SO,IT>::CompressedMatrix( const SparseMatrix<MT,SO2>& sm )
    : m_       ( (~sm).rows() )              // The current number of rows of the sparse matrix
    , n_       ( (~sm).columns() )           // The current number of columns of the sparse matrix
    , capacity_( m_ )                        // The current capacity of the pointer array
    , begin_   ( new Iterator[2UL*m_+2UL] )  // Pointers to the first non-zero element of each row
    , end_     ( begin_+(m_+1UL) )           // Pointers one past the last non-zero element of each row
 {
-   using blaze::assign;
+   BLAZE_USER_ASSERT( n_ <= std::numeric_limits<IT>::max(), "Too many columns for index type" );
 
    const size_t nonzeros( (~sm).nonZeros() );
 
@@ -636,8 +670,40 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( const SparseMatrix<MT,SO2>&
       begin_[i+1UL] = end_[i] = begin_[0UL];
    end_[m_] = begin_[0UL]+nonzeros;
 
-   assign( *this, ~sm );
+   smpAssign( *this, ~sm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+#if BLAZE_CPP11_MODE
+/*!\brief The move constructor for CompressedMatrix.
+//
+// \param sm The sparse matrix to be moved into this instance.
+//
+// The new matrix takes over the dynamically allocated non-zero elements and row/column pointers
+// of the given matrix, which is left as an empty \f$ 0 \times 0 \f$ matrix without any pointer
+// array. No element is copied and no memory is allocated. The moved-from matrix can be destroyed,
+// assigned to, resized or queried for its size and capacity; the pointer array is recreated on
+// demand. This constructor is only available in C++11 mode.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,SO,IT>::CompressedMatrix( CompressedMatrix&& sm ) noexcept
+   : m_       ( sm.m_ )         // The current number of rows of the sparse matrix
+   , n_       ( sm.n_ )         // The current number of columns of the sparse matrix
+   , capacity_( sm.capacity_ )  // The current capacity of the pointer array
+   , begin_   ( sm.begin_ )     // Pointers to the first non-zero element of each row
+   , end_     ( sm.end_ )       // Pointers one past the last non-zero element of each row
+{
+   sm.m_        = 0UL;
+   sm.n_        = 0UL;
+   sm.capacity_ = 0UL;
+   sm.begin_    = NULL;
+   sm.end_      = NULL;
 }
+#endif
 //*************************************************************************************************
 
 
@@ -653,10 +719,12 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( const SparseMatrix<MT,SO2>&
 /*!\brief The destructor for CompressedMatrix.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::~CompressedMatrix()
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,SO,IT>::~CompressedMatrix()
 {
-   deallocate( begin_[0UL] );
+   if( begin_ != NULL )
+      deallocate( begin_[0UL] );
    delete [] begin_;
 }
 //*************************************************************************************************
@@ -678,9 +746,10 @@ inline CompressedMatrix<Type,SO>::~CompressedMatrix()
 // \return Reference to the accessed value.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Reference
-   CompressedMatrix<Type,SO>::operator()( size_t i, size_t j )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Reference
+   CompressedMatrix<Type,SO,IT>::operator()( size_t i, size_t j )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -698,9 +767,10 @@ inline typename CompressedMatrix<Type,SO>::Reference
 // \return Reference to the accessed value.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstReference
-   CompressedMatrix<Type,SO>::operator()( size_t i, size_t j ) const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::ConstReference
+   CompressedMatrix<Type,SO,IT>::operator()( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -727,9 +797,10 @@ inline typename CompressedMatrix<Type,SO>::ConstReference
 // returns an iterator to the first non-zero element of column \a i.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::begin( size_t i )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Iterator
+   CompressedMatrix<Type,SO,IT>::begin( size_t i )
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
    return begin_[i];
@@ -749,9 +820,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // returns an iterator to the first non-zero element of column \a i.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::begin( size_t i ) const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::ConstIterator
+   CompressedMatrix<Type,SO,IT>::begin( size_t i ) const
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
    return begin_[i];
@@ -771,9 +843,10 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // returns an iterator to the first non-zero element of column \a i.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::cbegin( size_t i ) const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::ConstIterator
+   CompressedMatrix<Type,SO,IT>::cbegin( size_t i ) const
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
    return begin_[i];
@@ -793,9 +866,10 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // the function returns an iterator just past the last non-zero element of column \a i.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::end( size_t i )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Iterator
+   CompressedMatrix<Type,SO,IT>::end( size_t i )
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
    return end_[i];
@@ -815,9 +889,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // the function returns an iterator just past the last non-zero element of column \a i.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::end( size_t i ) const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::ConstIterator
+   CompressedMatrix<Type,SO,IT>::end( size_t i ) const
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
    return end_[i];
@@ -837,9 +912,10 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // the function returns an iterator just past the last non-zero element of column \a i.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::cend( size_t i ) const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::ConstIterator
+   CompressedMatrix<Type,SO,IT>::cend( size_t i ) const
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
    return end_[i];
@@ -865,9 +941,10 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // copy of this matrix.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator=( const CompressedMatrix& rhs )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,SO,IT>&
+   CompressedMatrix<Type,SO,IT>::operator=( const CompressedMatrix& rhs )
 {
    if( &rhs == this ) return *this;
 
@@ -886,7 +963,8 @@ inline CompressedMatrix<Type,SO>&
 
       std::swap( begin_, newBegin );
       end_ = newEnd;
-      deallocate( newBegin[0UL] );
+      if( newBegin != NULL )
+         deallocate( newBegin[0UL] );
       delete [] newBegin;
       capacity_ = rhs.m_;
    }
@@ -904,6 +982,48 @@ inline CompressedMatrix<Type,SO>&
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+#if BLAZE_CPP11_MODE
+/*!\brief Move assignment operator for CompressedMatrix.
+//
+// \param rhs The sparse matrix to be moved into this instance.
+// \return Reference to the assigned sparse matrix.
+//
+// The matrix releases its current elements and takes over the dynamically allocated non-zero
+// elements and row/column pointers of the given matrix, which is left as an empty
+// \f$ 0 \times 0 \f$ matrix without any pointer array (see the move constructor). No element
+// is copied and no memory is allocated. This operator is only available in C++11 mode.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,SO,IT>&
+   CompressedMatrix<Type,SO,IT>::operator=( CompressedMatrix&& rhs ) noexcept
+{
+   if( &rhs == this ) return *this;
+
+   if( begin_ != NULL )
+      deallocate( begin_[0UL] );
+   delete [] begin_;
+
+   m_        = rhs.m_;
+   n_        = rhs.n_;
+   capacity_ = rhs.capacity_;
+   begin_    = rhs.begin_;
+   end_      = rhs.end_;
+
+   rhs.m_        = 0UL;
+   rhs.n_        = 0UL;
+   rhs.capacity_ = 0UL;
+   rhs.begin_    = NULL;
+   rhs.end_      = NULL;
+
+   return *this;
+}
+#endif
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Assignment operator for dense matrices.
 //
@@ -914,11 +1034,12 @@ inline CompressedMatrix<Type,SO>&
 // copy of this matrix.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side dense matrix
         , bool SO2 >     // Storage order of the right-hand side dense matrix
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator=( const DenseMatrix<MT,SO2>& rhs )
+inline CompressedMatrix<Type,SO,IT>&
+   CompressedMatrix<Type,SO,IT>::operator=( const DenseMatrix<MT,SO2>& rhs )
 {
    using blaze::assign;
 
@@ -946,14 +1067,13 @@ inline CompressedMatrix<Type,SO>&
 // copy of this matrix.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side sparse matrix
         , bool SO2 >     // Storage order of the right-hand side sparse matrix
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator=( const SparseMatrix<MT,SO2>& rhs )
+inline CompressedMatrix<Type,SO,IT>&
+   CompressedMatrix<Type,SO,IT>::operator=( const SparseMatrix<MT,SO2>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) ||
        (~rhs).rows()     > capacity_ ||
        (~rhs).nonZeros() > capacity() ) {
@@ -963,7 +1083,7 @@ inline CompressedMatrix<Type,SO>&
    else {
       resize( (~rhs).rows(), (~rhs).columns(), false );
       reset();
-      assign( *this, ~rhs );
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
@@ -982,11 +1102,12 @@ inline CompressedMatrix<Type,SO>&
 // is thrown.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side matrix
         , bool SO2 >     // Storage order of the right-hand side matrix
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator+=( const Matrix<MT,SO2>& rhs )
+inline CompressedMatrix<Type,SO,IT>&
+   CompressedMatrix<Type,SO,IT>::operator+=( const Matrix<MT,SO2>& rhs )
 {
    using blaze::addAssign;
 
@@ -1010,10 +1131,11 @@ inline CompressedMatrix<Type,SO>&
 // is thrown.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side matrix
         , bool SO2 >     // Storage order of the right-hand side matrix
-inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::operator-=( const Matrix<MT,SO2>& rhs )
+inline CompressedMatrix<Type,SO,IT>& CompressedMatrix<Type,SO,IT>::operator-=( const Matrix<MT,SO2>& rhs )
 {
    using blaze::subAssign;
 
@@ -1037,11 +1159,12 @@ inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::operator-=( const M
 // is thrown.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side matrix
         , bool SO2 >     // Storage order of the right-hand side matrix
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator*=( const Matrix<MT,SO2>& rhs )
+inline CompressedMatrix<Type,SO,IT>&
+   CompressedMatrix<Type,SO,IT>::operator*=( const Matrix<MT,SO2>& rhs )
 {
    if( (~rhs).rows() != n_ )
       throw std::invalid_argument( "Matrix sizes do not match" );
@@ -1062,10 +1185,11 @@ inline CompressedMatrix<Type,SO>&
 // \return Reference to the sparse matrix.
 */
 template< typename Type     // Data type of the sparse matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the right-hand side scalar
-inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,SO> >::Type&
-   CompressedMatrix<Type,SO>::operator*=( Other rhs )
+inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,SO,IT> >::Type&
+   CompressedMatrix<Type,SO,IT>::operator*=( Other rhs )
 {
    for( size_t i=0UL; i<m_; ++i ) {
       const Iterator last( end(i) );
@@ -1085,10 +1209,11 @@ inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,SO> >::Type&
 // \return Reference to the matrix.
 */
 template< typename Type     // Data type of the sparse matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the right-hand side scalar
-inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,SO> >::Type&
-   CompressedMatrix<Type,SO>::operator/=( Other rhs )
+inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,SO,IT> >::Type&
+   CompressedMatrix<Type,SO,IT>::operator/=( Other rhs )
 {
    BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
 
@@ -1132,8 +1257,9 @@ inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,SO> >::Type&
 // \return The number of rows of the sparse matrix.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::rows() const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,SO,IT>::rows() const
 {
    return m_;
 }
@@ -1146,8 +1272,9 @@ inline size_t CompressedMatrix<Type,SO>::rows() const
 // \return The number of columns of the sparse matrix.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::columns() const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,SO,IT>::columns() const
 {
    return n_;
 }
@@ -1160,9 +1287,11 @@ inline size_t CompressedMatrix<Type,SO>::columns() const
 // \return The capacity of the sparse matrix.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::capacity() const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,SO,IT>::capacity() const
 {
+   if( begin_ == NULL ) return 0UL;
    return end_[m_] - begin_[0UL];
 }
 //*************************************************************************************************
@@ -1180,8 +1309,9 @@ inline size_t CompressedMatrix<Type,SO>::capacity() const
 // of column \a i.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::capacity( size_t i ) const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,SO,IT>::capacity( size_t i ) const
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    return begin_[i+1UL] - begin_[i];
@@ -1195,8 +1325,9 @@ inline size_t CompressedMatrix<Type,SO>::capacity( size_t i ) const
 // \return The number of non-zero elements in the sparse matrix.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::nonZeros() const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,SO,IT>::nonZeros() const
 {
    size_t nonzeros( 0UL );
 
@@ -1220,8 +1351,9 @@ inline size_t CompressedMatrix<Type,SO>::nonZeros() const
 // the number of non-zero elements in column \a i.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::nonZeros( size_t i ) const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,SO,IT>::nonZeros( size_t i ) const
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    return end_[i] - begin_[i];
@@ -1235,8 +1367,9 @@ inline size_t CompressedMatrix<Type,SO>::nonZeros( size_t i ) const
 // \return void
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::reset()
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,SO,IT>::reset()
 {
    for( size_t i=0UL; i<m_; ++i )
       end_[i] = begin_[i];
@@ -1256,8 +1389,9 @@ inline void CompressedMatrix<Type,SO>::reset()
 // Note that the capacity of the row/column remains unchanged.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::reset( size_t i )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,SO,IT>::reset( size_t i )
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    end_[i] = begin_[i];
@@ -1273,10 +1407,12 @@ inline void CompressedMatrix<Type,SO>::reset( size_t i )
 // After the clear() function, the size of the sparse matrix is 0.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::clear()
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,SO,IT>::clear()
 {
-   end_[0UL] = end_[m_];
+   if( begin_ != NULL )
+      end_[0UL] = end_[m_];
    m_ = 0UL;
    n_ = 0UL;
 }
@@ -1296,9 +1432,10 @@ inline void CompressedMatrix<Type,SO>::clear()
 // modified, else a new element with the given \a value is inserted.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::set( size_t i, size_t j, const Type& value )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Iterator
+   CompressedMatrix<Type,SO,IT>::set( size_t i, size_t j, const Type& value )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -1328,9 +1465,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // and column index \a j, a \a std::invalid_argument exception is thrown.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::insert( size_t i, size_t j, const Type& value )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Iterator
+   CompressedMatrix<Type,SO,IT>::insert( size_t i, size_t j, const Type& value )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -1356,9 +1494,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // \exception std::invalid_argument Invalid compressed matrix access index.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::insert( Iterator pos, size_t i, size_t j, const Type& value )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+typename CompressedMatrix<Type,SO,IT>::Iterator
+   CompressedMatrix<Type,SO,IT>::insert( Iterator pos, size_t i, size_t j, const Type& value )
 {
    if( begin_[i+1UL] - end_[i] != 0 ) {
       std::copy_backward( pos, end_[i], end_[i]+1 );
@@ -1432,8 +1571,9 @@ typename CompressedMatrix<Type,SO>::Iterator
 // This function erases an element from the sparse matrix.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::erase( size_t i, size_t j )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,SO,IT>::erase( size_t i, size_t j )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -1457,9 +1597,10 @@ inline void CompressedMatrix<Type,SO>::erase( size_t i, size_t j )
 // \a columnMajor the function erases an element from column \a i.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::erase( size_t i, Iterator pos )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Iterator
+   CompressedMatrix<Type,SO,IT>::erase( size_t i, Iterator pos )
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    BLAZE_USER_ASSERT( pos >= begin_[i] && pos <= end_[i], "Invalid compressed matrix iterator" );
@@ -1485,9 +1626,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // flag is set to \a columnMajor the function erases a range of elements from column \a i.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::erase( size_t i, Iterator first, Iterator last )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Iterator
+   CompressedMatrix<Type,SO,IT>::erase( size_t i, Iterator first, Iterator last )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index" );
    BLAZE_USER_ASSERT( first <= last, "Invalid iterator range"   );
@@ -1518,9 +1660,17 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // \a preserve flag can be set to \a true.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-void CompressedMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+void CompressedMatrix<Type,SO,IT>::resize( size_t m, size_t n, bool preserve )
 {
+   BLAZE_USER_ASSERT( n <= std::numeric_limits<IT>::max(), "Too many columns for index type" );
+
+   if( begin_ == NULL ) {  // Recreating the pointer array of a moved-from matrix
+      CompressedMatrix tmp( m_, n_ );
+      swap( tmp );
+   }
+
    BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
    BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
 
@@ -1602,8 +1752,9 @@ void CompressedMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
 // are preserved.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::reserve( size_t nonzeros )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,SO,IT>::reserve( size_t nonzeros )
 {
    if( nonzeros > capacity() )
       reserveElements( nonzeros );
@@ -1626,8 +1777,9 @@ inline void CompressedMatrix<Type,SO>::reserve( size_t nonzeros )
 // \a i and the index has to be in the range \f$[0..N-1]\f$.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-void CompressedMatrix<Type,SO>::reserve( size_t i, size_t nonzeros )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+void CompressedMatrix<Type,SO,IT>::reserve( size_t i, size_t nonzeros )
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
 
@@ -1696,8 +1848,9 @@ void CompressedMatrix<Type,SO>::reserve( size_t i, size_t nonzeros )
 // remove the overall capacity but only reduces the capacity per row/column.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::trim()
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,SO,IT>::trim()
 {
    for( size_t i=0UL; i<m_; ++i )
       trim( i );
@@ -1717,8 +1870,9 @@ inline void CompressedMatrix<Type,SO>::trim()
 // subsequent row/column.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::trim( size_t i )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,SO,IT>::trim( size_t i )
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
 
@@ -1735,8 +1889,9 @@ inline void CompressedMatrix<Type,SO>::trim( size_t i )
 // \return Reference to the transposed matrix.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::transpose()
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,SO,IT>& CompressedMatrix<Type,SO,IT>::transpose()
 {
    CompressedMatrix tmp( trans( *this ) );
    swap( tmp );
@@ -1752,9 +1907,10 @@ inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::transpose()
 // \return Reference to the sparse matrix.
 */
 template< typename Type     // Data type of the sparse matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the scalar value
-inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::scale( const Other& scalar )
+inline CompressedMatrix<Type,SO,IT>& CompressedMatrix<Type,SO,IT>::scale( const Other& scalar )
 {
    for( size_t i=0UL; i<m_; ++i )
       for( Iterator element=begin_[i]; element!=end_[i]; ++element )
@@ -1772,9 +1928,10 @@ inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::scale( const Other&
 // \return Reference to the sparse matrix.
 */
 template< typename Type     // Data type of the sparse matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the scalar value
-inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::scaleDiagonal( Other scalar )
+inline CompressedMatrix<Type,SO,IT>& CompressedMatrix<Type,SO,IT>::scaleDiagonal( Other scalar )
 {
    const size_t size( blaze::min( m_, n_ ) );
 
@@ -1797,8 +1954,9 @@ inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::scaleDiagonal( Othe
 // \exception no-throw guarantee.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::swap( CompressedMatrix& sm ) /* throw() */
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,SO,IT>::swap( CompressedMatrix& sm ) /* throw() */
 {
    std::swap( m_, sm.m_ );
    std::swap( n_, sm.n_ );
@@ -1818,8 +1976,9 @@ inline void CompressedMatrix<Type,SO>::swap( CompressedMatrix& sm ) /* throw() *
 // matrix. Note that the new capacity is restricted to the interval \f$[7..M \cdot N]\f$.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::extendCapacity() const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,SO,IT>::extendCapacity() const
 {
    size_t nonzeros( 2UL*capacity()+1UL );
    nonzeros = blaze::max( nonzeros, 7UL   );
@@ -1838,8 +1997,9 @@ inline size_t CompressedMatrix<Type,SO>::extendCapacity() const
 // \return void
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-void CompressedMatrix<Type,SO>::reserveElements( size_t nonzeros )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+void CompressedMatrix<Type,SO,IT>::reserveElements( size_t nonzeros )
 {
    Iterator* newBegin = new Iterator[2UL*capacity_+2UL];
    Iterator* newEnd   = newBegin+capacity_+1UL;
@@ -1855,7 +2015,8 @@ void CompressedMatrix<Type,SO>::reserveElements( size_t nonzeros )
    newEnd[m_] = newBegin[0UL]+nonzeros;
 
    std::swap( newBegin, begin_ );
-   deallocate( newBegin[0UL] );
+   if( newBegin != NULL )
+      deallocate( newBegin[0UL] );
    delete [] newBegin;
    end_ = newEnd;
 }
@@ -1886,9 +2047,10 @@ void CompressedMatrix<Type,SO>::reserveElements( size_t nonzeros )
 // function!
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::find( size_t i, size_t j )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Iterator
+   CompressedMatrix<Type,SO,IT>::find( size_t i, size_t j )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).find( i, j ) );
 }
@@ -1911,9 +2073,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // function!
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::find( size_t i, size_t j ) const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::ConstIterator
+   CompressedMatrix<Type,SO,IT>::find( size_t i, size_t j ) const
 {
    const ConstIterator pos( lowerBound( i, j ) );
    if( pos != end_[i] && pos->index_ == j )
@@ -1939,9 +2102,10 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // or the insert() function!
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::lowerBound( size_t i, size_t j )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Iterator
+   CompressedMatrix<Type,SO,IT>::lowerBound( size_t i, size_t j )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).lowerBound( i, j ) );
 }
@@ -1964,9 +2128,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // or the insert() function!
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::lowerBound( size_t i, size_t j ) const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::ConstIterator
+   CompressedMatrix<Type,SO,IT>::lowerBound( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    return std::lower_bound( begin_[i], end_[i], j, FindIndex() );
@@ -1990,9 +2155,10 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // or the insert() function!
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::upperBound( size_t i, size_t j )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Iterator
+   CompressedMatrix<Type,SO,IT>::upperBound( size_t i, size_t j )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).upperBound( i, j ) );
 }
@@ -2015,9 +2181,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // or the insert() function!
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::upperBound( size_t i, size_t j ) const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::ConstIterator
+   CompressedMatrix<Type,SO,IT>::upperBound( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    return std::upper_bound( begin_[i], end_[i], j, FindIndex() );
@@ -2077,8 +2244,9 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // returned by the end() functions!
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::append( size_t i, size_t j, const Type& value, bool check )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,SO,IT>::append( size_t i, size_t j, const Type& value, bool check )
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
@@ -2109,8 +2277,9 @@ inline void CompressedMatrix<Type,SO>::append( size_t i, size_t j, const Type& v
 // returned by the end() functions!
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::finalize( size_t i )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,SO,IT>::finalize( size_t i )
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid row access index" );
 
@@ -2140,9 +2309,10 @@ inline void CompressedMatrix<Type,SO>::finalize( size_t i )
 // to optimize the evaluation.
 */
 template< typename Type     // Data type of the sparse matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the foreign expression
-inline bool CompressedMatrix<Type,SO>::canAlias( const Other* alias ) const
+inline bool CompressedMatrix<Type,SO,IT>::canAlias( const Other* alias ) const
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -2160,9 +2330,10 @@ inline bool CompressedMatrix<Type,SO>::canAlias( const Other* alias ) const
 // to optimize the evaluation.
 */
 template< typename Type     // Data type of the sparse matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the foreign expression
-inline bool CompressedMatrix<Type,SO>::isAliased( const Other* alias ) const
+inline bool CompressedMatrix<Type,SO,IT>::isAliased( const Other* alias ) const
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -2180,8 +2351,9 @@ inline bool CompressedMatrix<Type,SO>::isAliased( const Other* alias ) const
 // rows and/or columns of the matrix).
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline bool CompressedMatrix<Type,SO>::canSMPAssign() const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline bool CompressedMatrix<Type,SO,IT>::canSMPAssign() const
 {
    return false;
 }
@@ -2200,10 +2372,11 @@ inline bool CompressedMatrix<Type,SO>::canSMPAssign() const
 // assignment operator.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side dense matrix
         , bool SO2 >     // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,SO>::assign( const DenseMatrix<MT,SO2>& rhs )
+inline void CompressedMatrix<Type,SO,IT>::assign( const DenseMatrix<MT,SO2>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2259,9 +2432,10 @@ inline void CompressedMatrix<Type,SO>::assign( const DenseMatrix<MT,SO2>& rhs )
 // assignment operator.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT >  // Type of the right-hand side sparse matrix
-inline void CompressedMatrix<Type,SO>::assign( const SparseMatrix<MT,SO>& rhs )
+inline void CompressedMatrix<Type,SO,IT>::assign( const SparseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2290,9 +2464,10 @@ inline void CompressedMatrix<Type,SO>::assign( const SparseMatrix<MT,SO>& rhs )
 // assignment operator.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT >  // Type of the right-hand side sparse matrix
-inline void CompressedMatrix<Type,SO>::assign( const SparseMatrix<MT,!SO>& rhs )
+inline void CompressedMatrix<Type,SO,IT>::assign( const SparseMatrix<MT,!SO>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -2336,10 +2511,11 @@ inline void CompressedMatrix<Type,SO>::assign( const SparseMatrix<MT,!SO>& rhs )
 // assignment operator.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side dense matrix
         , bool SO2 >     // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,SO>::addAssign( const DenseMatrix<MT,SO2>& rhs )
+inline void CompressedMatrix<Type,SO,IT>::addAssign( const DenseMatrix<MT,SO2>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2362,10 +2538,11 @@ inline void CompressedMatrix<Type,SO>::addAssign( const DenseMatrix<MT,SO2>& rhs
 // assignment operator.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side sparse matrix
         , bool SO2 >     // Storage order of the right-hand side sparse matrix
-inline void CompressedMatrix<Type,SO>::addAssign( const SparseMatrix<MT,SO2>& rhs )
+inline void CompressedMatrix<Type,SO,IT>::addAssign( const SparseMatrix<MT,SO2>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2388,10 +2565,11 @@ inline void CompressedMatrix<Type,SO>::addAssign( const SparseMatrix<MT,SO2>& rh
 // assignment operator.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side dense matrix
         , bool SO2 >     // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,SO>::subAssign( const DenseMatrix<MT,SO2>& rhs )
+inline void CompressedMatrix<Type,SO,IT>::subAssign( const DenseMatrix<MT,SO2>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2414,10 +2592,11 @@ inline void CompressedMatrix<Type,SO>::subAssign( const DenseMatrix<MT,SO2>& rhs
 // assignment operator.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side sparse matrix
         , bool SO2 >     // Storage order of the right-hand sparse matrix
-inline void CompressedMatrix<Type,SO>::subAssign( const SparseMatrix<MT,SO2>& rhs )
+inline void CompressedMatrix<Type,SO,IT>::subAssign( const SparseMatrix<MT,SO2>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2448,12 +2627,13 @@ inline void CompressedMatrix<Type,SO>::subAssign( const SparseMatrix<MT,SO2>& rh
 // This specialization of CompressedMatrix adapts the class template to the requirements of
 // column-major matrices.
 */
-template< typename Type >  // Data type of the sparse matrix
-class CompressedMatrix<Type,true> : public SparseMatrix< CompressedMatrix<Type,true>, true >
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+class CompressedMatrix<Type,true,IT> : public SparseMatrix< CompressedMatrix<Type,true,IT>, true >
 {
  private:
    //**Type definitions****************************************************************************
-   typedef ValueIndexPair<Type>  ElementBase;  //!< Base class for the sparse matrix element.
+   typedef ValueIndexPair<Type,IT>  ElementBase;  //!< Base class for the sparse matrix element.
    //**********************************************************************************************
 
    //**Private class Element***********************************************************************
@@ -2497,17 +2677,17 @@ class CompressedMatrix<Type,true> : public SparseMatrix< CompressedMatrix<Type,t
 
  public:
    //**Type definitions****************************************************************************
-   typedef CompressedMatrix<Type,true>   This;            //!< Type of this CompressedMatrix instance.
-   typedef This                          ResultType;      //!< Result type for expression template evaluations.
-   typedef CompressedMatrix<Type,false>  OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
-   typedef CompressedMatrix<Type,false>  TransposeType;   //!< Transpose type for expression template evaluations.
-   typedef Type                          ElementType;     //!< Type of the sparse matrix elements.
-   typedef const Type&                   ReturnType;      //!< Return type for expression template evaluations.
-   typedef const This&                   CompositeType;   //!< Data type for composite expression templates.
-   typedef MatrixAccessProxy<This>       Reference;       //!< Reference to a non-constant matrix value.
-   typedef const Type&                   ConstReference;  //!< Reference to a constant matrix value.
-   typedef Element*                      Iterator;        //!< Iterator over non-constant elements.
-   typedef const Element*                ConstIterator;   //!< Iterator over constant elements.
+   typedef CompressedMatrix<Type,true,IT>   This;            //!< Type of this CompressedMatrix instance.
+   typedef This                             ResultType;      //!< Result type for expression template evaluations.
+   typedef CompressedMatrix<Type,false,IT>  OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef CompressedMatrix<Type,false,IT>  TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                             ElementType;     //!< Type of the sparse matrix elements.
+   typedef const Type&                      ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                      CompositeType;   //!< Data type for composite expression templates.
+   typedef MatrixAccessProxy<This>          Reference;       //!< Reference to a non-constant matrix value.
+   typedef const Type&                      ConstReference;  //!< Reference to a constant matrix value.
+   typedef Element*                         Iterator;        //!< Iterator over non-constant elements.
+   typedef const Element*                   ConstIterator;   //!< Iterator over constant elements.
    //**********************************************************************************************
 
    //**Rebind struct definition********************************************************************
@@ -2515,7 +2695,7 @@ class CompressedMatrix<Type,true> : public SparseMatrix< CompressedMatrix<Type,t
    */
    template< typename ET >  // Data type of the other matrix
    struct Rebind {
-      typedef CompressedMatrix<ET,true>  Other;  //!< The type of the other CompressedMatrix.
+      typedef CompressedMatrix<ET,true,IT>  Other;  //!< The type of the other CompressedMatrix.
    };
    //**********************************************************************************************
 
@@ -2537,6 +2717,10 @@ class CompressedMatrix<Type,true> : public SparseMatrix< CompressedMatrix<Type,t
                                     inline CompressedMatrix( const CompressedMatrix& sm );
    template< typename MT, bool SO > inline CompressedMatrix( const DenseMatrix<MT,SO>&  dm );
    template< typename MT, bool SO > inline CompressedMatrix( const SparseMatrix<MT,SO>& sm );
+
+#if BLAZE_CPP11_MODE
+   inline CompressedMatrix( CompressedMatrix&& sm ) noexcept;
+#endif
    //@}
    //**********************************************************************************************
 
@@ -2578,6 +2762,10 @@ class CompressedMatrix<Type,true> : public SparseMatrix< CompressedMatrix<Type,t
    template< typename Other >
    inline typename EnableIf< IsNumeric<Other>, CompressedMatrix >::Type&
       operator/=( Other rhs );
+
+#if BLAZE_CPP11_MODE
+   inline CompressedMatrix& operator=( CompressedMatrix&& rhs ) noexcept;
+#endif
    //@}
    //**********************************************************************************************
 
@@ -2693,8 +2881,8 @@ class CompressedMatrix<Type,true> : public SparseMatrix< CompressedMatrix<Type,t
 //
 //=================================================================================================
 
-template< typename Type >
-const Type CompressedMatrix<Type,true>::zero_ = Type();
+template< typename Type, typename IT >
+const Type CompressedMatrix<Type,true,IT>::zero_ = Type();
 
 
 
@@ -2709,8 +2897,9 @@ const Type CompressedMatrix<Type,true>::zero_ = Type();
 /*! \cond BLAZE_INTERNAL */
 /*!\brief The default constructor for CompressedMatrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix()
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,true,IT>::CompressedMatrix()
    : m_       ( 0UL )             // The current number of rows of the sparse matrix
    , n_       ( 0UL )             // The current number of columns of the sparse matrix
    , capacity_( 0UL )             // The current capacity of the pointer array
@@ -2732,14 +2921,17 @@ inline CompressedMatrix<Type,true>::CompressedMatrix()
 //
 // The matrix is initialized to the zero matrix and has no free capacity.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n )
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,true,IT>::CompressedMatrix( size_t m, size_t n )
    : m_       ( m )                     // The current number of rows of the sparse matrix
    , n_       ( n )                     // The current number of columns of the sparse matrix
    , capacity_( n )                     // The current capacity of the pointer array
    , begin_( new Iterator[2UL*n+2UL] )  // Pointers to the first non-zero element of each column
    , end_  ( begin_+(n+1UL) )           // Pointers one past the last non-zero element of each column
 {
+   BLAZE_USER_ASSERT( m_ <= std::numeric_limits<IT>::max(), "Too many rows for index type" );
+
    for( size_t j=0UL; j<2UL*n_+2UL; ++j )
       begin_[j] = NULL;
 }
@@ -2757,14 +2949,17 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n )
 //
 // The matrix is initialized to the zero matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, size_t nonzeros )
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,true,IT>::CompressedMatrix( size_t m, size_t n, size_t nonzeros )
    : m_       ( m )                     // The current number of rows of the sparse matrix
    , n_       ( n )                     // The current number of columns of the sparse matrix
    , capacity_( n )                     // The current capacity of the pointer array
    , begin_( new Iterator[2UL*n+2UL] )  // Pointers to the first non-zero element of each column
    , end_  ( begin_+(n+1UL) )           // Pointers one past the last non-zero element of each column
 {
+   BLAZE_USER_ASSERT( m_ <= std::numeric_limits<IT>::max(), "Too many rows for index type" );
+
    begin_[0UL] = allocate<Element>( nonzeros );
    for( size_t j=1UL; j<(2UL*n_+1UL); ++j )
       begin_[j] = begin_[0UL];
@@ -2785,14 +2980,17 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, size_t
 // The matrix is initialized to the zero matrix and will have the specified capacity in each
 // column. Note that the given vector must have at least \a n elements.
 */
-template< typename Type >  // Data type of the sparse matrix
-CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+CompressedMatrix<Type,true,IT>::CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
    : m_       ( m )                      // The current number of rows of the sparse matrix
    , n_       ( n )                      // The current number of columns of the sparse matrix
    , capacity_( n )                      // The current capacity of the pointer array
    , begin_( new Iterator[2UL*n_+2UL] )  // Pointers to the first non-zero element of each column
    , end_  ( begin_+(n_+1UL) )           // Pointers one past the last non-zero element of each column
 {
+   BLAZE_USER_ASSERT( m_ <= std::numeric_limits<IT>::max(), "Too many rows for index type" );
+
    BLAZE_USER_ASSERT( nonzeros.size() == n, "Size of capacity vector and number of columns don't match" );
 
    size_t newCapacity( 0UL );
@@ -2814,8 +3012,9 @@ CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, const std::ve
 //
 // \param sm Sparse matrix to be copied.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( const CompressedMatrix& sm )
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,true,IT>::CompressedMatrix( const CompressedMatrix& sm )
    : m_       ( sm.m_ )                     // The current number of rows of the sparse matrix
    , n_       ( sm.n_ )                     // The current number of columns of the sparse matrix
    , capacity_( sm.n_ )                     // The current capacity of the pointer array
@@ -2839,16 +3038,19 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( const CompressedMatrix& sm
 //
 // \param dm Dense matrix to be copied.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
 template< typename MT      // Type of the foreign dense matrix
         , bool SO >        // Storage order of the foreign dense matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( const DenseMatrix<MT,SO>& dm )
+inline CompressedMatrix<Type,true,IT>::CompressedMatrix( const DenseMatrix<MT,SO>& dm )
    : m_       ( (~dm).rows() )              // The current number of rows of the sparse matrix
    , n_       ( (~dm).columns() )           // The current number of columns of the sparse matrix
    , capacity_( n_ )                        // The current capacity of the pointer array
    , begin_   ( new Iterator[2UL*n_+2UL] )  // Pointers to the first non-zero element of each column
    , end_     ( begin_+(n_+1UL) )           // Pointers one past the last non-zero element of each column
 {
+   BLAZE_USER_ASSERT( m_ <= std::numeric_limits<IT>::max(), "Too many rows for index type" );
+
    using blaze::assign;
 
    for( size_t j=0UL; j<2UL*n_+2UL; ++j )
@@ -2866,17 +3068,18 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( const DenseMatrix<MT,SO>&
 //
 // \param sm Sparse matrix to be copied.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
 template< typename MT      // Type of the foreign sparse matrix
         , bool SO >        // Storage order of the foreign sparse matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( const SparseMatrix<MT,SO>& sm )
+inline CompressedMatrix<Type,true,IT>::CompressedMatrix( const SparseMatrix<MT,SO>& sm )
    : m_       ( (~sm).rows() )              // The current number of rows of the sparse matrix
    , n_       ( (~sm).columns() )           // The current number of columns of the sparse matrix
    , capacity_( n_ )                        // The current capacity of the pointer array
    , begin_   ( new Iterator[2UL*n_+2UL] )  // Pointers to the first non-zero element of each column
    , end_     ( begin_+(n_+1UL) )           // Pointers one past the last non-zero element of each column
 {
-   using blaze::assign;
+   BLAZE_USER_ASSERT( m_ <= std::numeric_limits<IT>::max(), "Too many rows for index type" );
 
    const size_t nonzeros( (~sm).nonZeros() );
 
@@ -2885,9 +3088,42 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( const SparseMatrix<MT,SO>&
       begin_[j+1UL] = end_[j] = begin_[0UL];
    end_[n_] = begin_[0UL]+nonzeros;
 
-   assign( *this, ~sm );
+   smpAssign( *this, ~sm );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+#if BLAZE_CPP11_MODE
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The move constructor for CompressedMatrix.
+//
+// \param sm The sparse matrix to be moved into this instance.
+//
+// The new matrix takes over the dynamically allocated non-zero elements and row/column pointers
+// of the given matrix, which is left as an empty \f$ 0 \times 0 \f$ matrix without any pointer
+// array. No element is copied and no memory is allocated. The moved-from matrix can be destroyed,
+// assigned to, resized or queried for its size and capacity; the pointer array is recreated on
+// demand. This constructor is only available in C++11 mode.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,true,IT>::CompressedMatrix( CompressedMatrix&& sm ) noexcept
+   : m_       ( sm.m_ )         // The current number of rows of the sparse matrix
+   , n_       ( sm.n_ )         // The current number of columns of the sparse matrix
+   , capacity_( sm.capacity_ )  // The current capacity of the pointer array
+   , begin_   ( sm.begin_ )     // Pointers to the first non-zero element of each column
+   , end_     ( sm.end_ )       // Pointers one past the last non-zero element of each column
+{
+   sm.m_        = 0UL;
+   sm.n_        = 0UL;
+   sm.capacity_ = 0UL;
+   sm.begin_    = NULL;
+   sm.end_      = NULL;
 }
 /*! \endcond */
+#endif
 //*************************************************************************************************
 
 
@@ -2903,10 +3139,12 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( const SparseMatrix<MT,SO>&
 /*! \cond BLAZE_INTERNAL */
 /*!\brief The destructor for CompressedMatrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline CompressedMatrix<Type,true>::~CompressedMatrix()
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,true,IT>::~CompressedMatrix()
 {
-   deallocate( begin_[0UL] );
+   if( begin_ != NULL )
+      deallocate( begin_[0UL] );
    delete [] begin_;
 }
 /*! \endcond */
@@ -2929,9 +3167,10 @@ inline CompressedMatrix<Type,true>::~CompressedMatrix()
 // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
 // \return Reference to the accessed value.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::Reference
-   CompressedMatrix<Type,true>::operator()( size_t i, size_t j )
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,true,IT>::Reference
+   CompressedMatrix<Type,true,IT>::operator()( size_t i, size_t j )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -2950,9 +3189,10 @@ inline typename CompressedMatrix<Type,true>::Reference
 // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
 // \return Reference to the accessed value.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::ConstReference
-   CompressedMatrix<Type,true>::operator()( size_t i, size_t j ) const
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,true,IT>::ConstReference
+   CompressedMatrix<Type,true,IT>::operator()( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -2975,9 +3215,10 @@ inline typename CompressedMatrix<Type,true>::ConstReference
 // \param j The column index.
 // \return Iterator to the first non-zero element of column \a j.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::begin( size_t j )
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,true,IT>::Iterator
+   CompressedMatrix<Type,true,IT>::begin( size_t j )
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid sparse matrix column access index" );
    return begin_[j];
@@ -2993,9 +3234,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // \param j The column index.
 // \return Iterator to the first non-zero element of column \a j.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::begin( size_t j ) const
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,true,IT>::ConstIterator
+   CompressedMatrix<Type,true,IT>::begin( size_t j ) const
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid sparse matrix column access index" );
    return begin_[j];
@@ -3011,9 +3253,10 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // \param j The column index.
 // \return Iterator to the first non-zero element of column \a j.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::cbegin( size_t j ) const
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,true,IT>::ConstIterator
+   CompressedMatrix<Type,true,IT>::cbegin( size_t j ) const
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid sparse matrix column access index" );
    return begin_[j];
@@ -3029,9 +3272,10 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // \param j The column index.
 // \return Iterator just past the last non-zero element of column \a j.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::end( size_t j )
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,true,IT>::Iterator
+   CompressedMatrix<Type,true,IT>::end( size_t j )
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid sparse matrix column access index" );
    return end_[j];
@@ -3047,9 +3291,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // \param j The column index.
 // \return Iterator just past the last non-zero element of column \a j.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::end( size_t j ) const
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,true,IT>::ConstIterator
+   CompressedMatrix<Type,true,IT>::end( size_t j ) const
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid sparse matrix column access index" );
    return end_[j];
@@ -3065,9 +3310,10 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // \param j The column index.
 // \return Iterator just past the last non-zero element of column \a j.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::cend( size_t j ) const
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,true,IT>::ConstIterator
+   CompressedMatrix<Type,true,IT>::cend( size_t j ) const
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid sparse matrix column access index" );
    return end_[j];
@@ -3094,9 +3340,10 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // The sparse matrix is resized according to the given sparse matrix and initialized as a
 // copy of this matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline CompressedMatrix<Type,true>&
-   CompressedMatrix<Type,true>::operator=( const CompressedMatrix& rhs )
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,true,IT>&
+   CompressedMatrix<Type,true,IT>::operator=( const CompressedMatrix& rhs )
 {
    if( &rhs == this ) return *this;
 
@@ -3115,7 +3362,8 @@ inline CompressedMatrix<Type,true>&
 
       std::swap( begin_, newBegin );
       end_ = newEnd;
-      deallocate( newBegin[0UL] );
+      if( newBegin != NULL )
+         deallocate( newBegin[0UL] );
       delete [] newBegin;
       capacity_ = rhs.n_;
    }
@@ -3134,6 +3382,49 @@ inline CompressedMatrix<Type,true>&
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+#if BLAZE_CPP11_MODE
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Move assignment operator for CompressedMatrix.
+//
+// \param rhs The sparse matrix to be moved into this instance.
+// \return Reference to the assigned sparse matrix.
+//
+// The matrix releases its current elements and takes over the dynamically allocated non-zero
+// elements and row/column pointers of the given matrix, which is left as an empty
+// \f$ 0 \times 0 \f$ matrix without any pointer array (see the move constructor). No element
+// is copied and no memory is allocated. This operator is only available in C++11 mode.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,true,IT>&
+   CompressedMatrix<Type,true,IT>::operator=( CompressedMatrix&& rhs ) noexcept
+{
+   if( &rhs == this ) return *this;
+
+   if( begin_ != NULL )
+      deallocate( begin_[0UL] );
+   delete [] begin_;
+
+   m_        = rhs.m_;
+   n_        = rhs.n_;
+   capacity_ = rhs.capacity_;
+   begin_    = rhs.begin_;
+   end_      = rhs.end_;
+
+   rhs.m_        = 0UL;
+   rhs.n_        = 0UL;
+   rhs.capacity_ = 0UL;
+   rhs.begin_    = NULL;
+   rhs.end_      = NULL;
+
+   return *this;
+}
+/*! \endcond */
+#endif
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Assignment operator for dense matrices.
@@ -3144,11 +3435,12 @@ inline CompressedMatrix<Type,true>&
 // The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
 // copy of this matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
 template< typename MT      // Type of the right-hand side dense matrix
         , bool SO >        // Storage order of the right-hand side dense matrix
-inline CompressedMatrix<Type,true>&
-   CompressedMatrix<Type,true>::operator=( const DenseMatrix<MT,SO>& rhs )
+inline CompressedMatrix<Type,true,IT>&
+   CompressedMatrix<Type,true,IT>::operator=( const DenseMatrix<MT,SO>& rhs )
 {
    using blaze::assign;
 
@@ -3177,14 +3469,13 @@ inline CompressedMatrix<Type,true>&
 // The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
 // copy of this matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
 template< typename MT      // Type of the right-hand side sparse matrix
         , bool SO >        // Storage order of the right-hand side sparse matrix
-inline CompressedMatrix<Type,true>&
-   CompressedMatrix<Type,true>::operator=( const SparseMatrix<MT,SO>& rhs )
+inline CompressedMatrix<Type,true,IT>&
+   CompressedMatrix<Type,true,IT>::operator=( const SparseMatrix<MT,SO>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) ||
        (~rhs).columns()  > capacity_ ||
        (~rhs).nonZeros() > capacity() ) {
@@ -3194,7 +3485,7 @@ inline CompressedMatrix<Type,true>&
    else {
       resize( (~rhs).rows(), (~rhs).columns(), false );
       reset();
-      assign( *this, ~rhs );
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
@@ -3214,10 +3505,11 @@ inline CompressedMatrix<Type,true>&
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
 template< typename MT      // Type of the right-hand side matrix
         , bool SO >        // Storage order of the right-hand side matrix
-inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::operator+=( const Matrix<MT,SO>& rhs )
+inline CompressedMatrix<Type,true,IT>& CompressedMatrix<Type,true,IT>::operator+=( const Matrix<MT,SO>& rhs )
 {
    using blaze::addAssign;
 
@@ -3242,10 +3534,11 @@ inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::operator+=( con
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
 template< typename MT      // Type of the right-hand side matrix
         , bool SO >        // Storage order of the right-hand side matrix
-inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::operator-=( const Matrix<MT,SO>& rhs )
+inline CompressedMatrix<Type,true,IT>& CompressedMatrix<Type,true,IT>::operator-=( const Matrix<MT,SO>& rhs )
 {
    using blaze::subAssign;
 
@@ -3270,11 +3563,12 @@ inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::operator-=( con
 // In case the current sizes of the two given matrices don't match, a \a std::invalid_argument
 // is thrown.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
 template< typename MT      // Type of the right-hand side matrix
         , bool SO >        // Storage order of the right-hand side matrix
-inline CompressedMatrix<Type,true>&
-   CompressedMatrix<Type,true>::operator*=( const Matrix<MT,SO>& rhs )
+inline CompressedMatrix<Type,true,IT>&
+   CompressedMatrix<Type,true,IT>::operator*=( const Matrix<MT,SO>& rhs )
 {
    if( (~rhs).rows() != n_ )
       throw std::invalid_argument( "Matrix sizes do not match" );
@@ -3296,10 +3590,11 @@ inline CompressedMatrix<Type,true>&
 // \param rhs The right-hand side scalar value for the multiplication.
 // \return Reference to the sparse matrix.
 */
-template< typename Type >   // Data type of the sparse matrix
+template< typename Type     // Data type of the sparse matrix
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the right-hand side scalar
-inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,true> >::Type&
-   CompressedMatrix<Type,true>::operator*=( Other rhs )
+inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,true,IT> >::Type&
+   CompressedMatrix<Type,true,IT>::operator*=( Other rhs )
 {
    for( size_t j=0UL; j<n_; ++j ) {
       const Iterator last( end(j) );
@@ -3320,10 +3615,11 @@ inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,true> >::Type&
 // \param rhs The right-hand side scalar value for the division.
 // \return Reference to the matrix.
 */
-template< typename Type >   // Data type of the sparse matrix
+template< typename Type     // Data type of the sparse matrix
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the right-hand side scalar
-inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,true> >::Type&
-   CompressedMatrix<Type,true>::operator/=( Other rhs )
+inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,true,IT> >::Type&
+   CompressedMatrix<Type,true,IT>::operator/=( Other rhs )
 {
    BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
 
@@ -3368,8 +3664,9 @@ inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,true> >::Type&
 //
 // \return The number of rows of the sparse matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline size_t CompressedMatrix<Type,true>::rows() const
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,true,IT>::rows() const
 {
    return m_;
 }
@@ -3383,8 +3680,9 @@ inline size_t CompressedMatrix<Type,true>::rows() const
 //
 // \return The number of columns of the sparse matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline size_t CompressedMatrix<Type,true>::columns() const
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,true,IT>::columns() const
 {
    return n_;
 }
@@ -3398,9 +3696,11 @@ inline size_t CompressedMatrix<Type,true>::columns() const
 //
 // \return The capacity of the sparse matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline size_t CompressedMatrix<Type,true>::capacity() const
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,true,IT>::capacity() const
 {
+   if( begin_ == NULL ) return 0UL;
    return end_[n_] - begin_[0UL];
 }
 /*! \endcond */
@@ -3414,8 +3714,9 @@ inline size_t CompressedMatrix<Type,true>::capacity() const
 // \param j The index of the column.
 // \return The current capacity of column \a j.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline size_t CompressedMatrix<Type,true>::capacity( size_t j ) const
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,true,IT>::capacity( size_t j ) const
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
    return begin_[j+1UL] - begin_[j];
@@ -3430,8 +3731,9 @@ inline size_t CompressedMatrix<Type,true>::capacity( size_t j ) const
 //
 // \return The number of non-zero elements in the sparse matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline size_t CompressedMatrix<Type,true>::nonZeros() const
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,true,IT>::nonZeros() const
 {
    size_t nonzeros( 0UL );
 
@@ -3451,8 +3753,9 @@ inline size_t CompressedMatrix<Type,true>::nonZeros() const
 // \param j The index of the column.
 // \return The number of non-zero elements of column \a j.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline size_t CompressedMatrix<Type,true>::nonZeros( size_t j ) const
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,true,IT>::nonZeros( size_t j ) const
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
    return end_[j] - begin_[j];
@@ -3467,8 +3770,9 @@ inline size_t CompressedMatrix<Type,true>::nonZeros( size_t j ) const
 //
 // \return void
 */
-template< typename Type >  // Data type of the sparse matrix
-inline void CompressedMatrix<Type,true>::reset()
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,true,IT>::reset()
 {
    for( size_t j=0UL; j<n_; ++j )
       end_[j] = begin_[j];
@@ -3487,8 +3791,9 @@ inline void CompressedMatrix<Type,true>::reset()
 // This function reset the values in the specified column to their default value. Note that
 // the capacity of the column remains unchanged.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline void CompressedMatrix<Type,true>::reset( size_t j )
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,true,IT>::reset( size_t j )
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
    end_[j] = begin_[j];
@@ -3505,10 +3810,12 @@ inline void CompressedMatrix<Type,true>::reset( size_t j )
 //
 // After the clear() function, the size of the sparse matrix is 0.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline void CompressedMatrix<Type,true>::clear()
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,true,IT>::clear()
 {
-   end_[0UL] = end_[n_];
+   if( begin_ != NULL )
+      end_[0UL] = end_[n_];
    m_ = 0UL;
    n_ = 0UL;
 }
@@ -3529,9 +3836,10 @@ inline void CompressedMatrix<Type,true>::clear()
 // matrix already contains an element with row index \a i and column index \a j its value is
 // modified, else a new element with the given \a value is inserted.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::set( size_t i, size_t j, const Type& value )
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,true,IT>::Iterator
+   CompressedMatrix<Type,true,IT>::set( size_t i, size_t j, const Type& value )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -3562,9 +3870,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // are not allowed. In case the compressed matrix already contains an element with row index \a i
 // and column index \a j, a \a std::invalid_argument exception is thrown.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::insert( size_t i, size_t j, const Type& value )
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,true,IT>::Iterator
+   CompressedMatrix<Type,true,IT>::insert( size_t i, size_t j, const Type& value )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -3591,9 +3900,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // \return Iterator to the newly inserted element.
 // \exception std::invalid_argument Invalid compressed matrix access index.
 */
-template< typename Type >  // Data type of the sparse matrix
-typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::insert( Iterator pos, size_t i, size_t j, const Type& value )
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+typename CompressedMatrix<Type,true,IT>::Iterator
+   CompressedMatrix<Type,true,IT>::insert( Iterator pos, size_t i, size_t j, const Type& value )
 {
    if( begin_[j+1UL] - end_[j] != 0 ) {
       std::copy_backward( pos, end_[j], end_[j]+1 );
@@ -3668,8 +3978,9 @@ typename CompressedMatrix<Type,true>::Iterator
 //
 // This function erases an element from the sparse matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline void CompressedMatrix<Type,true>::erase( size_t i, size_t j )
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,true,IT>::erase( size_t i, size_t j )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -3692,9 +4003,10 @@ inline void CompressedMatrix<Type,true>::erase( size_t i, size_t j )
 //
 // This function erases an element from column \a j of the sparse matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::erase( size_t j, Iterator pos )
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,true,IT>::Iterator
+   CompressedMatrix<Type,true,IT>::erase( size_t j, Iterator pos )
 {
    BLAZE_USER_ASSERT( j < columns()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( pos >= begin_[j] && pos <= end_[j], "Invalid compressed matrix iterator" );
@@ -3719,9 +4031,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 //
 // This function erases a range of elements from column \a j of the sparse matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::erase( size_t j, Iterator first, Iterator last )
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,true,IT>::Iterator
+   CompressedMatrix<Type,true,IT>::erase( size_t j, Iterator first, Iterator last )
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid row access index" );
    BLAZE_USER_ASSERT( first <= last, "Invalid iterator range"   );
@@ -3753,9 +4066,17 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // potentially changes all matrix elements. In order to preserve the old matrix values, the
 // \a preserve flag can be set to \a true.
 */
-template< typename Type >  // Data type of the sparse matrix
-void CompressedMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+void CompressedMatrix<Type,true,IT>::resize( size_t m, size_t n, bool preserve )
 {
+   BLAZE_USER_ASSERT( m <= std::numeric_limits<IT>::max(), "Too many rows for index type" );
+
+   if( begin_ == NULL ) {  // Recreating the pointer array of a moved-from matrix
+      CompressedMatrix tmp( m_, n_ );
+      swap( tmp );
+   }
+
    BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
    BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
 
@@ -3838,8 +4159,9 @@ void CompressedMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
 // The current values of the matrix elements and the individual capacities of the matrix rows
 // are preserved.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline void CompressedMatrix<Type,true>::reserve( size_t nonzeros )
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,true,IT>::reserve( size_t nonzeros )
 {
    if( nonzeros > capacity() )
       reserveElements( nonzeros );
@@ -3860,8 +4182,9 @@ inline void CompressedMatrix<Type,true>::reserve( size_t nonzeros )
 // elements. The current values of the sparse matrix and all other individual column capacities are
 // preserved.
 */
-template< typename Type >  // Data type of the sparse matrix
-void CompressedMatrix<Type,true>::reserve( size_t j, size_t nonzeros )
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+void CompressedMatrix<Type,true,IT>::reserve( size_t j, size_t nonzeros )
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
 
@@ -3930,8 +4253,9 @@ void CompressedMatrix<Type,true>::reserve( size_t j, size_t nonzeros )
 // It removes all excessive capacity from all columns. Note that this function does not remove
 // the overall capacity but only reduces the capacity per column.
 */
-template< typename Type >  // Data type of the sparse matrix
-void CompressedMatrix<Type,true>::trim()
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+void CompressedMatrix<Type,true,IT>::trim()
 {
    for( size_t j=0UL; j<n_; ++j )
       trim( j );
@@ -3951,8 +4275,9 @@ void CompressedMatrix<Type,true>::trim()
 // removes all excessive capacity from the specified column. The excessive capacity is assigned
 // to the subsequent column.
 */
-template< typename Type >  // Data type of the sparse matrix
-void CompressedMatrix<Type,true>::trim( size_t j )
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+void CompressedMatrix<Type,true,IT>::trim( size_t j )
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
 
@@ -3970,8 +4295,9 @@ void CompressedMatrix<Type,true>::trim( size_t j )
 //
 // \return Reference to the transposed matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::transpose()
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,true,IT>& CompressedMatrix<Type,true,IT>::transpose()
 {
    CompressedMatrix tmp( trans( *this ) );
    swap( tmp );
@@ -3988,9 +4314,10 @@ inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::transpose()
 // \param scalar The scalar value for the matrix scaling.
 // \return Reference to the sparse matrix.
 */
-template< typename Type >   // Data type of the sparse matrix
+template< typename Type     // Data type of the sparse matrix
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the scalar value
-inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::scale( const Other& scalar )
+inline CompressedMatrix<Type,true,IT>& CompressedMatrix<Type,true,IT>::scale( const Other& scalar )
 {
    for( size_t j=0UL; j<n_; ++j )
       for( Iterator element=begin_[j]; element!=end_[j]; ++element )
@@ -4009,9 +4336,10 @@ inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::scale( const Ot
 // \param scalar The scalar value for the diagonal scaling.
 // \return Reference to the sparse matrix.
 */
-template< typename Type >   // Data type of the sparse matrix
+template< typename Type     // Data type of the sparse matrix
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the scalar value
-inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::scaleDiagonal( Other scalar )
+inline CompressedMatrix<Type,true,IT>& CompressedMatrix<Type,true,IT>::scaleDiagonal( Other scalar )
 {
    const size_t size( blaze::min( m_, n_ ) );
 
@@ -4035,8 +4363,9 @@ inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::scaleDiagonal(
 // \return void
 // \exception no-throw guarantee.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline void CompressedMatrix<Type,true>::swap( CompressedMatrix& sm ) /* throw() */
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,true,IT>::swap( CompressedMatrix& sm ) /* throw() */
 {
    std::swap( m_, sm.m_ );
    std::swap( n_, sm.n_ );
@@ -4057,8 +4386,9 @@ inline void CompressedMatrix<Type,true>::swap( CompressedMatrix& sm ) /* throw()
 // This function calculates a new matrix capacity based on the current capacity of the sparse
 // matrix. Note that the new capacity is restricted to the interval \f$[7..M \cdot N]\f$.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline size_t CompressedMatrix<Type,true>::extendCapacity() const
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,true,IT>::extendCapacity() const
 {
    size_t nonzeros( 2UL*capacity()+1UL );
    nonzeros = blaze::max( nonzeros, 7UL );
@@ -4078,8 +4408,9 @@ inline size_t CompressedMatrix<Type,true>::extendCapacity() const
 // \param nonzeros The number of matrix elements to be reserved.
 // \return void
 */
-template< typename Type >  // Data type of the sparse matrix
-void CompressedMatrix<Type,true>::reserveElements( size_t nonzeros )
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+void CompressedMatrix<Type,true,IT>::reserveElements( size_t nonzeros )
 {
    Iterator* newBegin = new Iterator[2UL*capacity_+2UL];
    Iterator* newEnd   = newBegin+capacity_+1UL;
@@ -4095,7 +4426,8 @@ void CompressedMatrix<Type,true>::reserveElements( size_t nonzeros )
    newEnd[n_] = newBegin[0UL]+nonzeros;
 
    std::swap( newBegin, begin_ );
-   deallocate( newBegin[0UL] );
+   if( newBegin != NULL )
+      deallocate( newBegin[0UL] );
    delete [] newBegin;
    end_ = newEnd;
 }
@@ -4126,9 +4458,10 @@ void CompressedMatrix<Type,true>::reserveElements( size_t nonzeros )
 // Note that the returned sparse matrix iterator is subject to invalidation due to inserting
 // operations via the subscript operator or the insert() function!
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::find( size_t i, size_t j )
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,true,IT>::Iterator
+   CompressedMatrix<Type,true,IT>::find( size_t i, size_t j )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).find( i, j ) );
 }
@@ -4151,9 +4484,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // Note that the returned sparse matrix iterator is subject to invalidation due to inserting
 // operations via the subscript operator or the insert() function!
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::find( size_t i, size_t j ) const
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,true,IT>::ConstIterator
+   CompressedMatrix<Type,true,IT>::find( size_t i, size_t j ) const
 {
    const ConstIterator pos( lowerBound( i, j ) );
    if( pos != end_[j] && pos->index_ == i )
@@ -4178,9 +4512,10 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // matrix iterator is subject to invalidation due to inserting operations via the function call
 // operator or the insert() function!
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::lowerBound( size_t i, size_t j )
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,true,IT>::Iterator
+   CompressedMatrix<Type,true,IT>::lowerBound( size_t i, size_t j )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).lowerBound( i, j ) );
 }
@@ -4202,9 +4537,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // matrix iterator is subject to invalidation due to inserting operations via the function call
 // operator or the insert() function!
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::lowerBound( size_t i, size_t j ) const
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,true,IT>::ConstIterator
+   CompressedMatrix<Type,true,IT>::lowerBound( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
    return std::lower_bound( begin_[j], end_[j], i, FindIndex() );
@@ -4227,9 +4563,10 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // matrix iterator is subject to invalidation due to inserting operations via the function call
 // operator or the insert() function!
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::upperBound( size_t i, size_t j )
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,true,IT>::Iterator
+   CompressedMatrix<Type,true,IT>::upperBound( size_t i, size_t j )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).upperBound( i, j ) );
 }
@@ -4251,9 +4588,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // matrix iterator is subject to invalidation due to inserting operations via the function call
 // operator or the insert() function!
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::upperBound( size_t i, size_t j ) const
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,true,IT>::ConstIterator
+   CompressedMatrix<Type,true,IT>::upperBound( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
    return std::upper_bound( begin_[j], end_[j], i, FindIndex() );
@@ -4311,8 +4649,9 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // \b Note: Although append() does not allocate new memory, it still invalidates all iterators
 // returned by the end() functions!
 */
-template< typename Type >  // Data type of the sparse matrix
-inline void CompressedMatrix<Type,true>::append( size_t i, size_t j, const Type& value, bool check )
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,true,IT>::append( size_t i, size_t j, const Type& value, bool check )
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
@@ -4344,8 +4683,9 @@ inline void CompressedMatrix<Type,true>::append( size_t i, size_t j, const Type&
 // \b Note: Although finalize() does not allocate new memory, it still invalidates all iterators
 // returned by the end() functions!
 */
-template< typename Type >  // Data type of the sparse matrix
-inline void CompressedMatrix<Type,true>::finalize( size_t j )
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,true,IT>::finalize( size_t j )
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid row access index" );
 
@@ -4376,9 +4716,10 @@ inline void CompressedMatrix<Type,true>::finalize( size_t j )
 // to the isAliased() function this function is allowed to use compile time expressions
 // to optimize the evaluation.
 */
-template< typename Type >   // Data type of the sparse matrix
+template< typename Type     // Data type of the sparse matrix
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the foreign expression
-inline bool CompressedMatrix<Type,true>::canAlias( const Other* alias ) const
+inline bool CompressedMatrix<Type,true,IT>::canAlias( const Other* alias ) const
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -4397,9 +4738,10 @@ inline bool CompressedMatrix<Type,true>::canAlias( const Other* alias ) const
 // to the canAlias() function this function is not allowed to use compile time expressions
 // to optimize the evaluation.
 */
-template< typename Type >   // Data type of the sparse matrix
+template< typename Type     // Data type of the sparse matrix
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the foreign expression
-inline bool CompressedMatrix<Type,true>::isAliased( const Other* alias ) const
+inline bool CompressedMatrix<Type,true,IT>::isAliased( const Other* alias ) const
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -4418,8 +4760,9 @@ inline bool CompressedMatrix<Type,true>::isAliased( const Other* alias ) const
 // function additionally provides runtime information (as for instance the current number of
 // rows and/or columns of the matrix).
 */
-template< typename Type >  // Data type of the sparse matrix
-inline bool CompressedMatrix<Type,true>::canSMPAssign() const
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline bool CompressedMatrix<Type,true,IT>::canSMPAssign() const
 {
    return false;
 }
@@ -4439,10 +4782,11 @@ inline bool CompressedMatrix<Type,true>::canSMPAssign() const
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
 template< typename MT      // Type of the right-hand side dense matrix
         , bool SO >        // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,true>::assign( const DenseMatrix<MT,SO>& rhs )
+inline void CompressedMatrix<Type,true,IT>::assign( const DenseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -4499,9 +4843,10 @@ inline void CompressedMatrix<Type,true>::assign( const DenseMatrix<MT,SO>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
 template< typename MT >    // Type of the right-hand side sparse matrix
-inline void CompressedMatrix<Type,true>::assign( const SparseMatrix<MT,true>& rhs )
+inline void CompressedMatrix<Type,true,IT>::assign( const SparseMatrix<MT,true>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -4531,9 +4876,10 @@ inline void CompressedMatrix<Type,true>::assign( const SparseMatrix<MT,true>& rh
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
 template< typename MT >    // Type of the right-hand side sparse matrix
-inline void CompressedMatrix<Type,true>::assign( const SparseMatrix<MT,false>& rhs )
+inline void CompressedMatrix<Type,true,IT>::assign( const SparseMatrix<MT,false>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -4578,10 +4924,11 @@ inline void CompressedMatrix<Type,true>::assign( const SparseMatrix<MT,false>& r
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
 template< typename MT      // Type of the right-hand side dense matrix
         , bool SO >        // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,true>::addAssign( const DenseMatrix<MT,SO>& rhs )
+inline void CompressedMatrix<Type,true,IT>::addAssign( const DenseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -4605,10 +4952,11 @@ inline void CompressedMatrix<Type,true>::addAssign( const DenseMatrix<MT,SO>& rh
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
 template< typename MT      // Type of the right-hand side sparse matrix
         , bool SO >        // Storage order of the right-hand side sparse matrix
-inline void CompressedMatrix<Type,true>::addAssign( const SparseMatrix<MT,SO>& rhs )
+inline void CompressedMatrix<Type,true,IT>::addAssign( const SparseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -4632,10 +4980,11 @@ inline void CompressedMatrix<Type,true>::addAssign( const SparseMatrix<MT,SO>& r
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
 template< typename MT      // Type of the right-hand side dense matrix
         , bool SO >        // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,true>::subAssign( const DenseMatrix<MT,SO>& rhs )
+inline void CompressedMatrix<Type,true,IT>::subAssign( const DenseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -4659,10 +5008,11 @@ inline void CompressedMatrix<Type,true>::subAssign( const DenseMatrix<MT,SO>& rh
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
 template< typename MT      // Type of the right-hand side sparse matrix
         , bool SO >        // Storage order of the right-hand side sparse matrix
-inline void CompressedMatrix<Type,true>::subAssign( const SparseMatrix<MT,SO>& rhs )
+inline void CompressedMatrix<Type,true,IT>::subAssign( const SparseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -4689,23 +5039,23 @@ inline void CompressedMatrix<Type,true>::subAssign( const SparseMatrix<MT,SO>& r
 //*************************************************************************************************
 /*!\name CompressedMatrix operators */
 //@{
-template< typename Type, bool SO >
-inline void reset( CompressedMatrix<Type,SO>& m );
+template< typename Type, bool SO, typename IT >
+inline void reset( CompressedMatrix<Type,SO,IT>& m );
 
-template< typename Type, bool SO >
-inline void reset( CompressedMatrix<Type,SO>& m, size_t i );
+template< typename Type, bool SO, typename IT >
+inline void reset( CompressedMatrix<Type,SO,IT>& m, size_t i );
 
-template< typename Type, bool SO >
-inline void clear( CompressedMatrix<Type,SO>& m );
+template< typename Type, bool SO, typename IT >
+inline void clear( CompressedMatrix<Type,SO,IT>& m );
 
-template< typename Type, bool SO >
-inline bool isDefault( const CompressedMatrix<Type,SO>& m );
+template< typename Type, bool SO, typename IT >
+inline bool isDefault( const CompressedMatrix<Type,SO,IT>& m );
 
-template< typename Type, bool SO >
-inline void swap( CompressedMatrix<Type,SO>& a, CompressedMatrix<Type,SO>& b ) /* throw() */;
+template< typename Type, bool SO, typename IT >
+inline void swap( CompressedMatrix<Type,SO,IT>& a, CompressedMatrix<Type,SO,IT>& b ) /* throw() */;
 
-template< typename Type, bool SO >
-inline void move( CompressedMatrix<Type,SO>& dst, CompressedMatrix<Type,SO>& src ) /* throw() */;
+template< typename Type, bool SO, typename IT >
+inline void move( CompressedMatrix<Type,SO,IT>& dst, CompressedMatrix<Type,SO,IT>& src ) /* throw() */;
 //@}
 //*************************************************************************************************
 
@@ -4718,8 +5068,9 @@ inline void move( CompressedMatrix<Type,SO>& dst, CompressedMatrix<Type,SO>& src
 // \return void
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void reset( CompressedMatrix<Type,SO>& m )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void reset( CompressedMatrix<Type,SO,IT>& m )
 {
    m.reset();
 }
@@ -4740,8 +5091,9 @@ inline void reset( CompressedMatrix<Type,SO>& m )
 // \a i. Note that the capacity of the row/column remains unchanged.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void reset( CompressedMatrix<Type,SO>& m, size_t i )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void reset( CompressedMatrix<Type,SO,IT>& m, size_t i )
 {
    m.reset( i );
 }
@@ -4756,8 +5108,9 @@ inline void reset( CompressedMatrix<Type,SO>& m, size_t i )
 // \return void
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void clear( CompressedMatrix<Type,SO>& m )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void clear( CompressedMatrix<Type,SO,IT>& m )
 {
    m.clear();
 }
@@ -4783,8 +5136,9 @@ inline void clear( CompressedMatrix<Type,SO>& m )
    \endcode
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline bool isDefault( const CompressedMatrix<Type,SO>& m )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline bool isDefault( const CompressedMatrix<Type,SO,IT>& m )
 {
    return ( m.rows() == 0UL && m.columns() == 0UL );
 }
@@ -4801,8 +5155,9 @@ inline bool isDefault( const CompressedMatrix<Type,SO>& m )
 // \exception no-throw guarantee.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void swap( CompressedMatrix<Type,SO>& a, CompressedMatrix<Type,SO>& b ) /* throw() */
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void swap( CompressedMatrix<Type,SO,IT>& a, CompressedMatrix<Type,SO,IT>& b ) /* throw() */
 {
    a.swap( b );
 }
@@ -4819,8 +5174,9 @@ inline void swap( CompressedMatrix<Type,SO>& a, CompressedMatrix<Type,SO>& b ) /
 // \exception no-throw guarantee.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void move( CompressedMatrix<Type,SO>& dst, CompressedMatrix<Type,SO>& src ) /* throw() */
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void move( CompressedMatrix<Type,SO,IT>& dst, CompressedMatrix<Type,SO,IT>& src ) /* throw() */
 {
    dst.swap( src );
 }
@@ -4837,8 +5193,8 @@ inline void move( CompressedMatrix<Type,SO>& dst, CompressedMatrix<Type,SO>& src
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool SO >
-struct IsResizable< CompressedMatrix<T,SO> > : public TrueType
+template< typename T, bool SO, typename IT >
+struct IsResizable< CompressedMatrix<T,SO,IT> > : public TrueType
 {
    enum { value = 1 };
    typedef TrueType  Type;
@@ -4857,88 +5213,96 @@ struct IsResizable< CompressedMatrix<T,SO> > : public TrueType
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO, typename T2, size_t M, size_t N >
-struct AddTrait< CompressedMatrix<T1,SO>, StaticMatrix<T2,M,N,SO> >
+template< typename T1, bool SO, typename T2, size_t M, size_t N, typename IT >
+struct AddTrait< CompressedMatrix<T1,SO,IT>, StaticMatrix<T2,M,N,SO> >
 {
    typedef StaticMatrix< typename AddTrait<T1,T2>::Type, M, N, SO >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
-struct AddTrait< CompressedMatrix<T1,SO1>, StaticMatrix<T2,M,N,SO2> >
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename IT >
+struct AddTrait< CompressedMatrix<T1,SO1,IT>, StaticMatrix<T2,M,N,SO2> >
 {
    typedef StaticMatrix< typename AddTrait<T1,T2>::Type, M, N, SO2 >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO, typename T2 >
-struct AddTrait< StaticMatrix<T1,M,N,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename IT >
+struct AddTrait< StaticMatrix<T1,M,N,SO>, CompressedMatrix<T2,SO,IT> >
 {
    typedef StaticMatrix< typename AddTrait<T1,T2>::Type, M, N, SO >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
-struct AddTrait< StaticMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename IT >
+struct AddTrait< StaticMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2,IT> >
 {
    typedef StaticMatrix< typename AddTrait<T1,T2>::Type, M, N, SO1 >  Type;
 };
 
-template< typename T1, bool SO, typename T2, size_t M, size_t N >
-struct AddTrait< CompressedMatrix<T1,SO>, HybridMatrix<T2,M,N,SO> >
+template< typename T1, bool SO, typename T2, size_t M, size_t N, typename IT >
+struct AddTrait< CompressedMatrix<T1,SO,IT>, HybridMatrix<T2,M,N,SO> >
 {
    typedef HybridMatrix< typename AddTrait<T1,T2>::Type, M, N, SO >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
-struct AddTrait< CompressedMatrix<T1,SO1>, HybridMatrix<T2,M,N,SO2> >
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename IT >
+struct AddTrait< CompressedMatrix<T1,SO1,IT>, HybridMatrix<T2,M,N,SO2> >
 {
    typedef HybridMatrix< typename AddTrait<T1,T2>::Type, M, N, SO2 >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO, typename T2 >
-struct AddTrait< HybridMatrix<T1,M,N,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename IT >
+struct AddTrait< HybridMatrix<T1,M,N,SO>, CompressedMatrix<T2,SO,IT> >
 {
    typedef HybridMatrix< typename AddTrait<T1,T2>::Type, M, N, SO >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
-struct AddTrait< HybridMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename IT >
+struct AddTrait< HybridMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2,IT> >
 {
    typedef HybridMatrix< typename AddTrait<T1,T2>::Type, M, N, SO1 >  Type;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct AddTrait< CompressedMatrix<T1,SO>, DynamicMatrix<T2,SO> >
+template< typename T1, bool SO, typename T2, typename IT >
+struct AddTrait< CompressedMatrix<T1,SO,IT>, DynamicMatrix<T2,SO> >
 {
    typedef DynamicMatrix< typename AddTrait<T1,T2>::Type , SO >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct AddTrait< CompressedMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT >
+struct AddTrait< CompressedMatrix<T1,SO1,IT>, DynamicMatrix<T2,SO2> >
 {
    typedef DynamicMatrix< typename AddTrait<T1,T2>::Type , SO2 >  Type;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct AddTrait< DynamicMatrix<T1,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, bool SO, typename T2, typename IT >
+struct AddTrait< DynamicMatrix<T1,SO>, CompressedMatrix<T2,SO,IT> >
 {
    typedef DynamicMatrix< typename AddTrait<T1,T2>::Type , SO >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct AddTrait< DynamicMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT >
+struct AddTrait< DynamicMatrix<T1,SO1>, CompressedMatrix<T2,SO2,IT> >
 {
    typedef DynamicMatrix< typename AddTrait<T1,T2>::Type , SO1 >  Type;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct AddTrait< CompressedMatrix<T1,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, bool SO, typename T2, typename IT1, typename IT2 >
+struct AddTrait< CompressedMatrix<T1,SO,IT1>, CompressedMatrix<T2,SO,IT2> >
 {
-   typedef CompressedMatrix< typename AddTrait<T1,T2>::Type , SO >  Type;
+ private:
+   typedef typename IndexTrait<IT1,IT2>::Type  IT;
+
+ public:
+   typedef CompressedMatrix< typename AddTrait<T1,T2>::Type , SO, IT >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct AddTrait< CompressedMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT1, typename IT2 >
+struct AddTrait< CompressedMatrix<T1,SO1,IT1>, CompressedMatrix<T2,SO2,IT2> >
 {
-   typedef CompressedMatrix< typename AddTrait<T1,T2>::Type , false >  Type;
+ private:
+   typedef typename IndexTrait<IT1,IT2>::Type  IT;
+
+ public:
+   typedef CompressedMatrix< typename AddTrait<T1,T2>::Type , false, IT >  Type;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -4954,88 +5318,96 @@ struct AddTrait< CompressedMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO, typename T2, size_t M, size_t N >
-struct SubTrait< CompressedMatrix<T1,SO>, StaticMatrix<T2,M,N,SO> >
+template< typename T1, bool SO, typename T2, size_t M, size_t N, typename IT >
+struct SubTrait< CompressedMatrix<T1,SO,IT>, StaticMatrix<T2,M,N,SO> >
 {
    typedef StaticMatrix< typename SubTrait<T1,T2>::Type, M, N, SO >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
-struct SubTrait< CompressedMatrix<T1,SO1>, StaticMatrix<T2,M,N,SO2> >
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename IT >
+struct SubTrait< CompressedMatrix<T1,SO1,IT>, StaticMatrix<T2,M,N,SO2> >
 {
    typedef StaticMatrix< typename SubTrait<T1,T2>::Type, M, N, SO2 >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO, typename T2 >
-struct SubTrait< StaticMatrix<T1,M,N,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename IT >
+struct SubTrait< StaticMatrix<T1,M,N,SO>, CompressedMatrix<T2,SO,IT> >
 {
    typedef StaticMatrix< typename SubTrait<T1,T2>::Type, M, N, SO >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
-struct SubTrait< StaticMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename IT >
+struct SubTrait< StaticMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2,IT> >
 {
    typedef StaticMatrix< typename SubTrait<T1,T2>::Type, M, N, SO1 >  Type;
 };
 
-template< typename T1, bool SO, typename T2, size_t M, size_t N >
-struct SubTrait< CompressedMatrix<T1,SO>, HybridMatrix<T2,M,N,SO> >
+template< typename T1, bool SO, typename T2, size_t M, size_t N, typename IT >
+struct SubTrait< CompressedMatrix<T1,SO,IT>, HybridMatrix<T2,M,N,SO> >
 {
    typedef HybridMatrix< typename SubTrait<T1,T2>::Type, M, N, SO >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
-struct SubTrait< CompressedMatrix<T1,SO1>, HybridMatrix<T2,M,N,SO2> >
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename IT >
+struct SubTrait< CompressedMatrix<T1,SO1,IT>, HybridMatrix<T2,M,N,SO2> >
 {
    typedef HybridMatrix< typename SubTrait<T1,T2>::Type, M, N, SO2 >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO, typename T2 >
-struct SubTrait< HybridMatrix<T1,M,N,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename IT >
+struct SubTrait< HybridMatrix<T1,M,N,SO>, CompressedMatrix<T2,SO,IT> >
 {
    typedef HybridMatrix< typename SubTrait<T1,T2>::Type, M, N, SO >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
-struct SubTrait< HybridMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename IT >
+struct SubTrait< HybridMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2,IT> >
 {
    typedef HybridMatrix< typename SubTrait<T1,T2>::Type, M, N, SO1 >  Type;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct SubTrait< CompressedMatrix<T1,SO>, DynamicMatrix<T2,SO> >
+template< typename T1, bool SO, typename T2, typename IT >
+struct SubTrait< CompressedMatrix<T1,SO,IT>, DynamicMatrix<T2,SO> >
 {
    typedef DynamicMatrix< typename SubTrait<T1,T2>::Type , SO >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct SubTrait< CompressedMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT >
+struct SubTrait< CompressedMatrix<T1,SO1,IT>, DynamicMatrix<T2,SO2> >
 {
    typedef DynamicMatrix< typename SubTrait<T1,T2>::Type , SO2 >  Type;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct SubTrait< DynamicMatrix<T1,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, bool SO, typename T2, typename IT >
+struct SubTrait< DynamicMatrix<T1,SO>, CompressedMatrix<T2,SO,IT> >
 {
    typedef DynamicMatrix< typename SubTrait<T1,T2>::Type , SO >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct SubTrait< DynamicMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT >
+struct SubTrait< DynamicMatrix<T1,SO1>, CompressedMatrix<T2,SO2,IT> >
 {
    typedef DynamicMatrix< typename SubTrait<T1,T2>::Type , SO1 >  Type;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct SubTrait< CompressedMatrix<T1,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, bool SO, typename T2, typename IT1, typename IT2 >
+struct SubTrait< CompressedMatrix<T1,SO,IT1>, CompressedMatrix<T2,SO,IT2> >
 {
-   typedef CompressedMatrix< typename SubTrait<T1,T2>::Type , SO >  Type;
+ private:
+   typedef typename IndexTrait<IT1,IT2>::Type  IT;
+
+ public:
+   typedef CompressedMatrix< typename SubTrait<T1,T2>::Type , SO, IT >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct SubTrait< CompressedMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT1, typename IT2 >
+struct SubTrait< CompressedMatrix<T1,SO1,IT1>, CompressedMatrix<T2,SO2,IT2> >
 {
-   typedef CompressedMatrix< typename SubTrait<T1,T2>::Type , false >  Type;
+ private:
+   typedef typename IndexTrait<IT1,IT2>::Type  IT;
+
+ public:
+   typedef CompressedMatrix< typename SubTrait<T1,T2>::Type , false, IT >  Type;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -5051,108 +5423,120 @@ struct SubTrait< CompressedMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO, typename T2 >
-struct MultTrait< CompressedMatrix<T1,SO>, T2 >
+template< typename T1, bool SO, typename T2, typename IT >
+struct MultTrait< CompressedMatrix<T1,SO,IT>, T2 >
 {
-   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, SO, IT >  Type;
    BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
 };
 
-template< typename T1, typename T2, bool SO >
-struct MultTrait< T1, CompressedMatrix<T2,SO> >
+template< typename T1, typename T2, bool SO, typename IT >
+struct MultTrait< T1, CompressedMatrix<T2,SO,IT> >
 {
-   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, SO, IT >  Type;
    BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T1 );
 };
 
-template< typename T1, bool SO, typename T2, size_t N >
-struct MultTrait< CompressedMatrix<T1,SO>, StaticVector<T2,N,false> >
+template< typename T1, bool SO, typename T2, size_t N, typename IT >
+struct MultTrait< CompressedMatrix<T1,SO,IT>, StaticVector<T2,N,false> >
 {
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
 };
 
-template< typename T1, size_t N, typename T2, bool SO >
-struct MultTrait< StaticVector<T1,N,true>, CompressedMatrix<T2,SO> >
+template< typename T1, size_t N, typename T2, bool SO, typename IT >
+struct MultTrait< StaticVector<T1,N,true>, CompressedMatrix<T2,SO,IT> >
 {
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
 };
 
-template< typename T1, bool SO, typename T2, size_t N >
-struct MultTrait< CompressedMatrix<T1,SO>, HybridVector<T2,N,false> >
+template< typename T1, bool SO, typename T2, size_t N, typename IT >
+struct MultTrait< CompressedMatrix<T1,SO,IT>, HybridVector<T2,N,false> >
 {
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
 };
 
-template< typename T1, size_t N, typename T2, bool SO >
-struct MultTrait< HybridVector<T1,N,true>, CompressedMatrix<T2,SO> >
+template< typename T1, size_t N, typename T2, bool SO, typename IT >
+struct MultTrait< HybridVector<T1,N,true>, CompressedMatrix<T2,SO,IT> >
 {
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct MultTrait< CompressedMatrix<T1,SO>, DynamicVector<T2,false> >
+template< typename T1, bool SO, typename T2, typename IT >
+struct MultTrait< CompressedMatrix<T1,SO,IT>, DynamicVector<T2,false> >
 {
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
 };
 
-template< typename T1, typename T2, bool SO >
-struct MultTrait< DynamicVector<T1,true>, CompressedMatrix<T2,SO> >
+template< typename T1, typename T2, bool SO, typename IT >
+struct MultTrait< DynamicVector<T1,true>, CompressedMatrix<T2,SO,IT> >
 {
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct MultTrait< CompressedMatrix<T1,SO>, CompressedVector<T2,false> >
+template< typename T1, bool SO, typename T2, typename IT1, typename IT2 >
+struct MultTrait< CompressedMatrix<T1,SO,IT1>, CompressedVector<T2,false,IT2> >
 {
-   typedef CompressedVector< typename MultTrait<T1,T2>::Type, false >  Type;
+ private:
+   typedef typename IndexTrait<IT1,IT2>::Type  IT;
+
+ public:
+   typedef CompressedVector< typename MultTrait<T1,T2>::Type, false, IT >  Type;
 };
 
-template< typename T1, typename T2, bool SO >
-struct MultTrait< CompressedVector<T1,true>, CompressedMatrix<T2,SO> >
+template< typename T1, typename T2, bool SO, typename IT1, typename IT2 >
+struct MultTrait< CompressedVector<T1,true,IT1>, CompressedMatrix<T2,SO,IT2> >
 {
-   typedef CompressedVector< typename MultTrait<T1,T2>::Type, true >  Type;
+ private:
+   typedef typename IndexTrait<IT1,IT2>::Type  IT;
+
+ public:
+   typedef CompressedVector< typename MultTrait<T1,T2>::Type, true, IT >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
-struct MultTrait< CompressedMatrix<T1,SO1>, StaticMatrix<T2,M,N,SO2> >
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename IT >
+struct MultTrait< CompressedMatrix<T1,SO1,IT>, StaticMatrix<T2,M,N,SO2> >
 {
    typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
-struct MultTrait< StaticMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename IT >
+struct MultTrait< StaticMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2,IT> >
 {
    typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
-struct MultTrait< CompressedMatrix<T1,SO1>, HybridMatrix<T2,M,N,SO2> >
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename IT >
+struct MultTrait< CompressedMatrix<T1,SO1,IT>, HybridMatrix<T2,M,N,SO2> >
 {
    typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
-struct MultTrait< HybridMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename IT >
+struct MultTrait< HybridMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2,IT> >
 {
    typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct MultTrait< CompressedMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT >
+struct MultTrait< CompressedMatrix<T1,SO1,IT>, DynamicMatrix<T2,SO2> >
 {
    typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct MultTrait< DynamicMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT >
+struct MultTrait< DynamicMatrix<T1,SO1>, CompressedMatrix<T2,SO2,IT> >
 {
    typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct MultTrait< CompressedMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT1, typename IT2 >
+struct MultTrait< CompressedMatrix<T1,SO1,IT1>, CompressedMatrix<T2,SO2,IT2> >
 {
-   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
+ private:
+   typedef typename IndexTrait<IT1,IT2>::Type  IT;
+
+ public:
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, SO1, IT >  Type;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -5168,10 +5552,10 @@ struct MultTrait< CompressedMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO, typename T2 >
-struct DivTrait< CompressedMatrix<T1,SO>, T2 >
+template< typename T1, bool SO, typename T2, typename IT >
+struct DivTrait< CompressedMatrix<T1,SO,IT>, T2 >
 {
-   typedef CompressedMatrix< typename DivTrait<T1,T2>::Type, SO >  Type;
+   typedef CompressedMatrix< typename DivTrait<T1,T2>::Type, SO, IT >  Type;
    BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
 };
 /*! \endcond */
@@ -5188,11 +5572,15 @@ struct DivTrait< CompressedMatrix<T1,SO>, T2 >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO, typename T2 >
-struct MathTrait< CompressedMatrix<T1,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, bool SO, typename T2, typename IT1, typename IT2 >
+struct MathTrait< CompressedMatrix<T1,SO,IT1>, CompressedMatrix<T2,SO,IT2> >
 {
-   typedef CompressedMatrix< typename MathTrait<T1,T2>::HighType, SO >  HighType;
-   typedef CompressedMatrix< typename MathTrait<T1,T2>::LowType , SO >  LowType;
+ private:
+   typedef typename IndexTrait<IT1,IT2>::Type  IT;
+
+ public:
+   typedef CompressedMatrix< typename MathTrait<T1,T2>::HighType, SO, IT >  HighType;
+   typedef CompressedMatrix< typename MathTrait<T1,T2>::LowType , SO, IT >  LowType;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -5208,10 +5596,10 @@ struct MathTrait< CompressedMatrix<T1,SO>, CompressedMatrix<T2,SO> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO >
-struct SubmatrixTrait< CompressedMatrix<T1,SO> >
+template< typename T1, bool SO, typename IT >
+struct SubmatrixTrait< CompressedMatrix<T1,SO,IT> >
 {
-   typedef CompressedMatrix<T1,SO>  Type;
+   typedef CompressedMatrix<T1,SO,IT>  Type;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -5227,10 +5615,10 @@ struct SubmatrixTrait< CompressedMatrix<T1,SO> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO >
-struct RowTrait< CompressedMatrix<T1,SO> >
+template< typename T1, bool SO, typename IT >
+struct RowTrait< CompressedMatrix<T1,SO,IT> >
 {
-   typedef CompressedVector<T1,true>  Type;
+   typedef CompressedVector<T1,true,IT>  Type;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -5246,10 +5634,10 @@ struct RowTrait< CompressedMatrix<T1,SO> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO >
-struct ColumnTrait< CompressedMatrix<T1,SO> >
+template< typename T1, bool SO, typename IT >
+struct ColumnTrait< CompressedMatrix<T1,SO,IT> >
 {
-   typedef CompressedVector<T1,false>  Type;
+   typedef CompressedVector<T1,false,IT>  Type;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -0,0 +1,2462 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/DynamicSparseMatrix.h
+//  \brief Implementation of a sparse matrix with efficient structural modifications
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_DYNAMICSPARSEMATRIX_H_
+#define _BLAZE_MATH_SPARSE_DYNAMICSPARSEMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <blaze/math/constraints/Symmetric.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/SparseMatrix.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/MatrixAccessProxy.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/DivTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/IsStrictlyLower.h>
+#include <blaze/math/typetraits/IsStrictlyUpper.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/system/Standard.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/SameSize.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup dynamic_sparse_matrix DynamicSparseMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Sparse matrix with efficient insertion and erasure of non-zero elements.
+// \ingroup dynamic_sparse_matrix
+//
+// The DynamicSparseMatrix class template is the representation of an arbitrary sized sparse
+// matrix that is optimized for frequent structural modifications. The type of the elements and
+// the storage order of the matrix can be specified via the two template parameters:
+
+   \code
+   template< typename Type, bool SO >
+   class DynamicSparseMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. DynamicSparseMatrix can be used with
+//          any non-cv-qualified, non-reference, non-pointer element type.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::rowMajor.
+//
+// In contrast to CompressedMatrix, which stores the non-zero elements of all rows/columns in a
+// single array, DynamicSparseMatrix manages a separate, individually growing array of non-zero
+// elements per row (in case of a row-major matrix) or per column (in case of a column-major
+// matrix). The elements of each row/column are sorted by index. Therefore a lookup takes
+// \f$ O(\log k) \f$ for a row/column with \a k non-zero elements, and the insertion or erasure
+// of an element only shifts the elements of the affected row/column, never the elements of the
+// remaining matrix. Appending an element at the end of a row/column via append() is amortized
+// \f$ O(1) \f$ and does not require any preceding reserve() call:
+
+   \code
+   using blaze::DynamicSparseMatrix;
+   using blaze::rowMajor;
+
+   DynamicSparseMatrix<double,rowMajor> A( 4UL, 3UL );
+
+   A(1,2) = 2.0;           // Insertion via the function call operator
+   A.set( 2, 0, -1.2 );    // Insertion or modification via set()
+   A.insert( 2, 1, 3.7 );  // Insertion of a new element via insert()
+   A.append( 3, 2, 1.4 );  // Appending an element at the end of row 3
+   A.erase( 2, 0 );        // Erasure of a single element
+   \endcode
+
+// DynamicSparseMatrix can be used in all sparse matrix expressions. Whenever the result of an
+// expression involving a DynamicSparseMatrix has to be evaluated, it is stored in a compressed
+// matrix. For phases in which the sparsity pattern does not change, the matrix can be converted
+// into a CompressedMatrix with contiguous storage via the freeze() function. In case the shared
+// memory parallelization is enabled and the matrix is sufficiently large (see the
+// SMP_SMATFREEZE_THRESHOLD), the rows/columns are copied in parallel:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+
+   DynamicSparseMatrix<double,rowMajor> A( 100000UL, 100000UL );
+   DynamicVector<double> x( 100000UL ), y;
+
+   // ... Structural updates of A
+
+   y = A * x;  // Direct use of the dynamic sparse matrix
+
+   CompressedMatrix<double,rowMajor> C;
+   A.freeze( C );  // Conversion into a compressed matrix for a read-only phase
+   y = C * x;
+   \endcode
+*/
+template< typename Type                    // Data type of the sparse matrix
+        , bool SO = defaultStorageOrder >  // Storage order
+class DynamicSparseMatrix : public SparseMatrix< DynamicSparseMatrix<Type,SO>, SO >
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef ValueIndexPair<Type>  ElementBase;  //!< Base class for the sparse matrix element.
+   //**********************************************************************************************
+
+   //**Private class Element***********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Value-index-pair for the DynamicSparseMatrix class.
+   */
+   struct Element : public ElementBase
+   {
+      inline Element()
+         : ElementBase()
+      {}
+
+      inline Element( const Type& v, size_t i )
+         : ElementBase( v, i )
+      {}
+
+      // This operator is required due to a bug in all versions of the the MSVC compiler.
+      // A simple 'using ElementBase::operator=;' statement results in ambiguity problems.
+      template< typename Other >
+      inline Element& operator=( const Other& rhs )
+      {
+         ElementBase::operator=( rhs );
+         return *this;
+      }
+
+      friend class DynamicSparseMatrix;
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Private class FindIndex*********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Helper class for the lower_bound() function.
+   */
+   struct FindIndex : public std::binary_function<Element,size_t,bool>
+   {
+      inline bool operator()( const Element& element, size_t index ) const {
+         return element.index() < index;
+      }
+      inline bool operator()( size_t index, const Element& element ) const {
+         return index < element.index();
+      }
+      inline bool operator()( const Element& element1, const Element& element2 ) const {
+         return element1.index() < element2.index();
+      }
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef std::vector<Element>  Line;  //!< Type of a single row/column of the sparse matrix.
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef DynamicSparseMatrix<Type,SO>   This;            //!< Type of this DynamicSparseMatrix instance.
+   typedef CompressedMatrix<Type,SO>      ResultType;      //!< Result type for expression template evaluations.
+   typedef CompressedMatrix<Type,!SO>     OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef CompressedMatrix<Type,!SO>     TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                           ElementType;     //!< Type of the sparse matrix elements.
+   typedef const Type&                    ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                    CompositeType;   //!< Data type for composite expression templates.
+   typedef MatrixAccessProxy<This>        Reference;       //!< Reference to a sparse matrix value.
+   typedef const Type&                    ConstReference;  //!< Reference to a constant sparse matrix value.
+   typedef typename Line::iterator        Iterator;        //!< Iterator over non-constant elements.
+   typedef typename Line::const_iterator  ConstIterator;   //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a DynamicSparseMatrix with different data/element type.
+   */
+   template< typename ET >  // Data type of the other matrix
+   struct Rebind {
+      typedef DynamicSparseMatrix<ET,SO>  Other;  //!< The type of the other DynamicSparseMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum { smpAssignable = !IsSMPAssignable<Type>::value };
+   //**********************************************************************************************
+
+ private:
+   //**Private class FreezeKernel******************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Row/column kernel for the conversion into a compressed matrix.
+   //
+   // The FreezeKernel class copies single rows/columns of a dynamic sparse matrix into a
+   // compressed matrix. The nonZeros() function returns the number of non-zero elements of
+   // a row/column, the assign() function appends the non-zero elements of a row/column to
+   // a sparse matrix.
+   */
+   class FreezeKernel
+   {
+    public:
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the FreezeKernel class.
+      //
+      // \param sm The dynamic sparse matrix to be converted.
+      */
+      explicit inline FreezeKernel( const DynamicSparseMatrix& sm )
+         : sm_( sm )  // The dynamic sparse matrix to be converted
+      {}
+      //*******************************************************************************************
+
+      //**NonZeros function************************************************************************
+      /*!\brief Returns the number of non-zero elements in the specified row/column.
+      //
+      // \param i The index of the row/column.
+      // \return The number of non-zero elements in row/column \a i.
+      */
+      inline size_t nonZeros( size_t i ) const
+      {
+         return sm_.nonZeros( i );
+      }
+      //*******************************************************************************************
+
+      //**Assign function**************************************************************************
+      /*!\brief Appends the non-zero elements of the specified row/column to the given matrix.
+      //
+      // \param lhs The target left-hand side sparse matrix.
+      // \param i The index of the row/column.
+      // \return void
+      */
+      template< typename MT >  // Type of the target sparse matrix
+      inline void assign( MT& lhs, size_t i ) const
+      {
+         const ConstIterator last( sm_.end(i) );
+         for( ConstIterator element=sm_.begin(i); element!=last; ++element ) {
+            if( SO ) lhs.append( element->index(), i, element->value() );
+            else     lhs.append( i, element->index(), element->value() );
+         }
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      const DynamicSparseMatrix& sm_;  //!< The dynamic sparse matrix to be converted.
+      //*******************************************************************************************
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+                            explicit inline DynamicSparseMatrix();
+                            explicit inline DynamicSparseMatrix( size_t m, size_t n );
+                            explicit inline DynamicSparseMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros );
+                                     inline DynamicSparseMatrix( const DynamicSparseMatrix& sm );
+   template< typename MT, bool SO2 > inline DynamicSparseMatrix( const DenseMatrix<MT,SO2>&  dm );
+   template< typename MT, bool SO2 > inline DynamicSparseMatrix( const SparseMatrix<MT,SO2>& sm );
+
+#if BLAZE_CPP11_MODE
+   inline DynamicSparseMatrix( DynamicSparseMatrix&& sm ) noexcept;
+#endif
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j );
+   inline ConstReference operator()( size_t i, size_t j ) const;
+   inline Iterator       begin ( size_t i );
+   inline ConstIterator  begin ( size_t i ) const;
+   inline ConstIterator  cbegin( size_t i ) const;
+   inline Iterator       end   ( size_t i );
+   inline ConstIterator  end   ( size_t i ) const;
+   inline ConstIterator  cend  ( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+                                     inline DynamicSparseMatrix& operator= ( const DynamicSparseMatrix& rhs );
+   template< typename MT, bool SO2 > inline DynamicSparseMatrix& operator= ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline DynamicSparseMatrix& operator= ( const SparseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline DynamicSparseMatrix& operator+=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline DynamicSparseMatrix& operator-=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline DynamicSparseMatrix& operator*=( const Matrix<MT,SO2>& rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, DynamicSparseMatrix >::Type&
+      operator*=( Other rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, DynamicSparseMatrix >::Type&
+      operator/=( Other rhs );
+
+#if BLAZE_CPP11_MODE
+   inline DynamicSparseMatrix& operator=( DynamicSparseMatrix&& rhs ) noexcept;
+#endif
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+                              inline size_t               rows() const;
+                              inline size_t               columns() const;
+                              inline size_t               capacity() const;
+                              inline size_t               capacity( size_t i ) const;
+                              inline size_t               nonZeros() const;
+                              inline size_t               nonZeros( size_t i ) const;
+                              inline void                 reset();
+                              inline void                 reset( size_t i );
+                              inline void                 clear();
+                              inline Iterator             set    ( size_t i, size_t j, const Type& value );
+                              inline Iterator             insert ( size_t i, size_t j, const Type& value );
+                              inline void                 erase  ( size_t i, size_t j );
+                              inline Iterator             erase  ( size_t i, Iterator pos );
+                              inline Iterator             erase  ( size_t i, Iterator first, Iterator last );
+                                     void                 resize ( size_t m, size_t n, bool preserve=true );
+                              inline void                 reserve( size_t nonzeros );
+                              inline void                 reserve( size_t i, size_t nonzeros );
+                              inline void                 trim   ();
+                              inline void                 trim   ( size_t i );
+                              inline DynamicSparseMatrix& transpose();
+   template< typename Other > inline DynamicSparseMatrix& scale( const Other& scalar );
+   template< typename Other > inline DynamicSparseMatrix& scaleDiagonal( Other scalar );
+                              inline void                 swap( DynamicSparseMatrix& sm ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+   //**Conversion functions************************************************************************
+   /*!\name Conversion functions */
+   //@{
+   template< typename IT > void freeze( CompressedMatrix<Type,SO,IT>& sm ) const;
+                    inline ResultType freeze() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline Iterator      find      ( size_t i, size_t j );
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline Iterator      lowerBound( size_t i, size_t j );
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline Iterator      upperBound( size_t i, size_t j );
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Low-level utility functions*****************************************************************
+   /*!\name Low-level utility functions */
+   //@{
+   inline void append  ( size_t i, size_t j, const Type& value, bool check=false );
+   inline void finalize( size_t i );
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+
+   inline bool canSMPAssign() const;
+
+   template< typename MT, bool SO2 > inline void assign   ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT >           inline void assign   ( const SparseMatrix<MT,SO>&  rhs );
+   template< typename MT >           inline void assign   ( const SparseMatrix<MT,!SO>& rhs );
+   template< typename MT, bool SO2 > inline void addAssign( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void addAssign( const SparseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline void subAssign( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void subAssign( const SparseMatrix<MT,SO2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;                 //!< The current number of rows of the sparse matrix.
+   size_t n_;                 //!< The current number of columns of the sparse matrix.
+   std::vector<Line> lines_;  //!< The non-zero elements of the individual rows/columns.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_HAVE_SAME_SIZE       ( ElementBase, Element );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type, bool SO >
+const Type DynamicSparseMatrix<Type,SO>::zero_ = Type();
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for DynamicSparseMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline DynamicSparseMatrix<Type,SO>::DynamicSparseMatrix()
+   : m_    ( 0UL )  // The current number of rows of the sparse matrix
+   , n_    ( 0UL )  // The current number of columns of the sparse matrix
+   , lines_()       // The non-zero elements of the individual rows/columns
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+//
+// The matrix is initialized to the zero matrix and has no free capacity.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline DynamicSparseMatrix<Type,SO>::DynamicSparseMatrix( size_t m, size_t n )
+   : m_    ( m )              // The current number of rows of the sparse matrix
+   , n_    ( n )              // The current number of columns of the sparse matrix
+   , lines_( SO ? n : m )     // The non-zero elements of the individual rows/columns
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The expected number of non-zero elements in each row/column.
+//
+// The matrix is initialized to the zero matrix and will have the specified capacity in each
+// row/column. Note that in case of a row-major matrix the given vector must have at least
+// \a m elements, in case of a column-major matrix at least \a n elements.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline DynamicSparseMatrix<Type,SO>::DynamicSparseMatrix( size_t m, size_t n,
+                                                          const std::vector<size_t>& nonzeros )
+   : m_    ( m )              // The current number of rows of the sparse matrix
+   , n_    ( n )              // The current number of columns of the sparse matrix
+   , lines_( SO ? n : m )     // The non-zero elements of the individual rows/columns
+{
+   BLAZE_USER_ASSERT( nonzeros.size() >= lines_.size(), "Size of capacity vector and number of rows/columns don't match" );
+
+   for( size_t i=0UL; i<lines_.size(); ++i )
+      lines_[i].reserve( nonzeros[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for DynamicSparseMatrix.
+//
+// \param sm Sparse matrix to be copied.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline DynamicSparseMatrix<Type,SO>::DynamicSparseMatrix( const DynamicSparseMatrix& sm )
+   : m_    ( sm.m_ )      // The current number of rows of the sparse matrix
+   , n_    ( sm.n_ )      // The current number of columns of the sparse matrix
+   , lines_( sm.lines_ )  // The non-zero elements of the individual rows/columns
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from dense matrices.
+//
+// \param dm Dense matrix to be copied.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the foreign dense matrix
+        , bool SO2 >     // Storage order of the foreign dense matrix
+inline DynamicSparseMatrix<Type,SO>::DynamicSparseMatrix( const DenseMatrix<MT,SO2>& dm )
+   : m_    ( (~dm).rows() )                          // The current number of rows of the sparse matrix
+   , n_    ( (~dm).columns() )                       // The current number of columns of the sparse matrix
+   , lines_( SO ? (~dm).columns() : (~dm).rows() )  // The non-zero elements of the individual rows/columns
+{
+   using blaze::assign;
+
+   assign( *this, ~dm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different sparse matrices.
+//
+// \param sm Sparse matrix to be copied.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the foreign sparse matrix
+        , bool SO2 >     // Storage order of the foreign sparse matrix
+inline DynamicSparseMatrix<Type,SO>::DynamicSparseMatrix( const SparseMatrix<MT,SO2>& sm )
+   : m_    ( (~sm).rows() )                          // The current number of rows of the sparse matrix
+   , n_    ( (~sm).columns() )                       // The current number of columns of the sparse matrix
+   , lines_( SO ? (~sm).columns() : (~sm).rows() )  // The non-zero elements of the individual rows/columns
+{
+   smpAssign( *this, ~sm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+#if BLAZE_CPP11_MODE
+/*!\brief The move constructor for DynamicSparseMatrix.
+//
+// \param sm The sparse matrix to be moved into this instance.
+//
+// The new matrix takes over the rows/columns of the given matrix, which is left as an empty
+// \f$ 0 \times 0 \f$ matrix. No element is copied. This constructor is only available in
+// C++11 mode.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline DynamicSparseMatrix<Type,SO>::DynamicSparseMatrix( DynamicSparseMatrix&& sm ) noexcept
+   : m_    ( sm.m_ )                   // The current number of rows of the sparse matrix
+   , n_    ( sm.n_ )                   // The current number of columns of the sparse matrix
+   , lines_( std::move( sm.lines_ ) )  // The non-zero elements of the individual rows/columns
+{
+   sm.m_ = 0UL;
+   sm.n_ = 0UL;
+   sm.lines_.clear();
+}
+#endif
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename DynamicSparseMatrix<Type,SO>::Reference
+   DynamicSparseMatrix<Type,SO>::operator()( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   return Reference( *this, i, j );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename DynamicSparseMatrix<Type,SO>::ConstReference
+   DynamicSparseMatrix<Type,SO>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const ConstIterator pos( find( i, j ) );
+
+   if( pos == end( SO ? j : i ) )
+      return zero_;
+   else
+      return pos->value_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// This function returns a row/column iterator to the first non-zero element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename DynamicSparseMatrix<Type,SO>::Iterator
+   DynamicSparseMatrix<Type,SO>::begin( size_t i )
+{
+   BLAZE_USER_ASSERT( i < lines_.size(), "Invalid sparse matrix row/column access index" );
+   return lines_[i].begin();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// This function returns a row/column iterator to the first non-zero element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename DynamicSparseMatrix<Type,SO>::ConstIterator
+   DynamicSparseMatrix<Type,SO>::begin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < lines_.size(), "Invalid sparse matrix row/column access index" );
+   return lines_[i].begin();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// This function returns a row/column iterator to the first non-zero element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename DynamicSparseMatrix<Type,SO>::ConstIterator
+   DynamicSparseMatrix<Type,SO>::cbegin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < lines_.size(), "Invalid sparse matrix row/column access index" );
+   return lines_[i].begin();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last non-zero element of row/column
+// \a i. In case the storage order is set to \a rowMajor the function returns an iterator just
+// past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename DynamicSparseMatrix<Type,SO>::Iterator
+   DynamicSparseMatrix<Type,SO>::end( size_t i )
+{
+   BLAZE_USER_ASSERT( i < lines_.size(), "Invalid sparse matrix row/column access index" );
+   return lines_[i].end();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last non-zero element of row/column
+// \a i. In case the storage order is set to \a rowMajor the function returns an iterator just
+// past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename DynamicSparseMatrix<Type,SO>::ConstIterator
+   DynamicSparseMatrix<Type,SO>::end( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < lines_.size(), "Invalid sparse matrix row/column access index" );
+   return lines_[i].end();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last non-zero element of row/column
+// \a i. In case the storage order is set to \a rowMajor the function returns an iterator just
+// past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename DynamicSparseMatrix<Type,SO>::ConstIterator
+   DynamicSparseMatrix<Type,SO>::cend( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < lines_.size(), "Invalid sparse matrix row/column access index" );
+   return lines_[i].end();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for DynamicSparseMatrix.
+//
+// \param rhs Sparse matrix to be copied.
+// \return Reference to the assigned sparse matrix.
+//
+// The sparse matrix is resized according to the given sparse matrix and initialized as a
+// copy of this matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline DynamicSparseMatrix<Type,SO>&
+   DynamicSparseMatrix<Type,SO>::operator=( const DynamicSparseMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   lines_ = rhs.lines_;
+   m_ = rhs.m_;
+   n_ = rhs.n_;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+#if BLAZE_CPP11_MODE
+/*!\brief Move assignment operator for DynamicSparseMatrix.
+//
+// \param rhs The sparse matrix to be moved into this instance.
+// \return Reference to the assigned sparse matrix.
+//
+// The matrix releases its current elements and takes over the rows/columns of the given matrix,
+// which is left as an empty \f$ 0 \times 0 \f$ matrix. No element is copied. This operator
+// is only available in C++11 mode.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline DynamicSparseMatrix<Type,SO>&
+   DynamicSparseMatrix<Type,SO>::operator=( DynamicSparseMatrix&& rhs ) noexcept
+{
+   if( &rhs == this ) return *this;
+
+   lines_ = std::move( rhs.lines_ );
+   m_     = rhs.m_;
+   n_     = rhs.n_;
+
+   rhs.lines_.clear();
+   rhs.m_ = 0UL;
+   rhs.n_ = 0UL;
+
+   return *this;
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for dense matrices.
+//
+// \param rhs Dense matrix to be copied.
+// \return Reference to the assigned matrix.
+//
+// The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
+// copy of this matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline DynamicSparseMatrix<Type,SO>&
+   DynamicSparseMatrix<Type,SO>::operator=( const DenseMatrix<MT,SO2>& rhs )
+{
+   using blaze::assign;
+
+   if( (~rhs).canAlias( this ) ) {
+      DynamicSparseMatrix tmp( ~rhs );
+      swap( tmp );
+   }
+   else {
+      resize( (~rhs).rows(), (~rhs).columns(), false );
+      assign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different sparse matrices.
+//
+// \param rhs Sparse matrix to be copied.
+// \return Reference to the assigned matrix.
+//
+// The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
+// copy of this matrix. The capacities of the individual rows/columns are preserved.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline DynamicSparseMatrix<Type,SO>&
+   DynamicSparseMatrix<Type,SO>::operator=( const SparseMatrix<MT,SO2>& rhs )
+{
+   if( (~rhs).canAlias( this ) ) {
+      DynamicSparseMatrix tmp( ~rhs );
+      swap( tmp );
+   }
+   else {
+      resize( (~rhs).rows(), (~rhs).columns(), false );
+      smpAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline DynamicSparseMatrix<Type,SO>&
+   DynamicSparseMatrix<Type,SO>::operator+=( const Matrix<MT,SO2>& rhs )
+{
+   using blaze::addAssign;
+
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   addAssign( *this, ~rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline DynamicSparseMatrix<Type,SO>&
+   DynamicSparseMatrix<Type,SO>::operator-=( const Matrix<MT,SO2>& rhs )
+{
+   using blaze::subAssign;
+
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   subAssign( *this, ~rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication of a matrix (\f$ A*=B \f$).
+//
+// \param rhs The right-hand side matrix for the multiplication.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two given matrices don't match, a \a std::invalid_argument
+// is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline DynamicSparseMatrix<Type,SO>&
+   DynamicSparseMatrix<Type,SO>::operator*=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != n_ )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   DynamicSparseMatrix tmp( *this * (~rhs) );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication between a sparse matrix and
+//        a scalar value (\f$ A*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the sparse matrix.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, DynamicSparseMatrix<Type,SO> >::Type&
+   DynamicSparseMatrix<Type,SO>::operator*=( Other rhs )
+{
+   for( size_t i=0UL; i<lines_.size(); ++i ) {
+      const Iterator last( end(i) );
+      for( Iterator element=begin(i); element!=last; ++element )
+         element->value_ *= rhs;
+   }
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a sparse matrix by a scalar value
+//        (\f$ A/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the matrix.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, DynamicSparseMatrix<Type,SO> >::Type&
+   DynamicSparseMatrix<Type,SO>::operator/=( Other rhs )
+{
+   BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
+
+   typedef typename DivTrait<Type,Other>::Type  DT;
+   typedef typename If< IsNumeric<DT>, DT, Other >::Type  Tmp;
+
+   // Depending on the two involved data types, an integer division is applied or a
+   // floating point division is selected.
+   if( IsNumeric<DT>::value && IsFloatingPoint<DT>::value ) {
+      const Tmp tmp( Tmp(1)/static_cast<Tmp>( rhs ) );
+      for( size_t i=0UL; i<lines_.size(); ++i ) {
+         const Iterator last( end(i) );
+         for( Iterator element=begin(i); element!=last; ++element )
+            element->value_ *= tmp;
+      }
+   }
+   else {
+      for( size_t i=0UL; i<lines_.size(); ++i ) {
+         const Iterator last( end(i) );
+         for( Iterator element=begin(i); element!=last; ++element )
+            element->value_ /= rhs;
+      }
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline size_t DynamicSparseMatrix<Type,SO>::rows() const
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline size_t DynamicSparseMatrix<Type,SO>::columns() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the sparse matrix.
+//
+// \return The capacity of the sparse matrix.
+//
+// The capacity of a dynamic sparse matrix is the sum of the capacities of its rows/columns.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline size_t DynamicSparseMatrix<Type,SO>::capacity() const
+{
+   size_t capacity( 0UL );
+
+   for( size_t i=0UL; i<lines_.size(); ++i )
+      capacity += lines_[i].capacity();
+
+   return capacity;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The current capacity of row/column \a i.
+//
+// This function returns the current capacity of the specified row/column. In case the
+// storage order is set to \a rowMajor the function returns the capacity of row \a i,
+// in case the storage flag is set to \a columnMajor the function returns the capacity
+// of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline size_t DynamicSparseMatrix<Type,SO>::capacity( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < lines_.size(), "Invalid row/column access index" );
+   return lines_[i].capacity();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the sparse matrix
+//
+// \return The number of non-zero elements in the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline size_t DynamicSparseMatrix<Type,SO>::nonZeros() const
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t i=0UL; i<lines_.size(); ++i )
+      nonzeros += lines_[i].size();
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+//
+// This function returns the current number of non-zero elements in the specified row/column.
+// In case the storage order is set to \a rowMajor the function returns the number of non-zero
+// elements in row \a i, in case the storage flag is set to \a columnMajor the function returns
+// the number of non-zero elements in column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline size_t DynamicSparseMatrix<Type,SO>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < lines_.size(), "Invalid row/column access index" );
+   return lines_[i].size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+//
+// This function resets all elements of the matrix to the default value. The capacities of the
+// individual rows/columns remain unchanged.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void DynamicSparseMatrix<Type,SO>::reset()
+{
+   for( size_t i=0UL; i<lines_.size(); ++i )
+      lines_[i].clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column to the default initial values.
+//
+// \param i The index of the row/column to be resetted.
+// \return void
+//
+// This function resets the values in the specified row/column to their default value. In case
+// the storage order is set to \a rowMajor the function resets the values in row \a i, in case
+// the storage order is set to \a columnMajor the function resets the values in column \a i.
+// Note that the capacity of the row/column remains unchanged.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void DynamicSparseMatrix<Type,SO>::reset( size_t i )
+{
+   BLAZE_USER_ASSERT( i < lines_.size(), "Invalid row/column access index" );
+   lines_[i].clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the sparse matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the sparse matrix is 0.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void DynamicSparseMatrix<Type,SO>::clear()
+{
+   lines_.clear();
+   m_ = 0UL;
+   n_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting an element of the dynamic sparse matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be set.
+// \return Iterator to the set element.
+//
+// This function sets the value of an element of the dynamic sparse matrix. In case the sparse
+// matrix already contains an element with row index \a i and column index \a j its value is
+// modified, else a new element with the given \a value is inserted.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename DynamicSparseMatrix<Type,SO>::Iterator
+   DynamicSparseMatrix<Type,SO>::set( size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   Line& line( lines_[SO ? j : i] );
+   const size_t index( SO ? i : j );
+   const Iterator pos( lowerBound( i, j ) );
+
+   if( pos != line.end() && pos->index_ == index ) {
+      pos->value_ = value;
+      return pos;
+   }
+   else return line.insert( pos, Element( value, index ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting an element into the dynamic sparse matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be inserted.
+// \return Iterator to the newly inserted element.
+// \exception std::invalid_argument Invalid sparse matrix access index.
+//
+// This function inserts a new element into the dynamic sparse matrix. However, duplicate
+// elements are not allowed. In case the sparse matrix already contains an element with row
+// index \a i and column index \a j, a \a std::invalid_argument exception is thrown. Only the
+// elements of the affected row/column are shifted.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename DynamicSparseMatrix<Type,SO>::Iterator
+   DynamicSparseMatrix<Type,SO>::insert( size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   Line& line( lines_[SO ? j : i] );
+   const size_t index( SO ? i : j );
+   const Iterator pos( lowerBound( i, j ) );
+
+   if( pos != line.end() && pos->index_ == index )
+      throw std::invalid_argument( "Bad access index" );
+
+   return line.insert( pos, Element( value, index ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the sparse matrix.
+//
+// \param i The row index of the element to be erased. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the element to be erased. The index has to be in the range \f$[0..N-1]\f$.
+// \return void
+//
+// This function erases an element from the sparse matrix. Only the elements of the affected
+// row/column are shifted.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void DynamicSparseMatrix<Type,SO>::erase( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   Line& line( lines_[SO ? j : i] );
+   const Iterator pos( find( i, j ) );
+
+   if( pos != line.end() )
+      line.erase( pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the sparse matrix.
+//
+// \param i The row/column index of the element to be erased. The index has to be in the range \f$[0..M-1]\f$.
+// \param pos Iterator to the element to be erased.
+// \return Iterator to the element after the erased element.
+//
+// This function erases an element from the sparse matrix. In case the storage order is set to
+// \a rowMajor the function erases an element from row \a i, in case the storage flag is set to
+// \a columnMajor the function erases an element from column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename DynamicSparseMatrix<Type,SO>::Iterator
+   DynamicSparseMatrix<Type,SO>::erase( size_t i, Iterator pos )
+{
+   BLAZE_USER_ASSERT( i < lines_.size(), "Invalid row/column access index" );
+   BLAZE_USER_ASSERT( pos >= begin(i) && pos <= end(i), "Invalid dynamic sparse matrix iterator" );
+
+   if( pos != lines_[i].end() )
+      return lines_[i].erase( pos );
+   else
+      return pos;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing a range of elements from the sparse matrix.
+//
+// \param i The row/column index of the element to be erased. The index has to be in the range \f$[0..M-1]\f$.
+// \param first Iterator to first element to be erased.
+// \param last Iterator just past the last element to be erased.
+// \return Iterator to the element after the erased element.
+//
+// This function erases a range of element from the sparse matrix. In case the storage order is
+// set to \a rowMajor the function erases a range of elements from row \a i, in case the storage
+// flag is set to \a columnMajor the function erases a range of elements from column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename DynamicSparseMatrix<Type,SO>::Iterator
+   DynamicSparseMatrix<Type,SO>::erase( size_t i, Iterator first, Iterator last )
+{
+   BLAZE_USER_ASSERT( i < lines_.size(), "Invalid row/column access index" );
+   BLAZE_USER_ASSERT( first <= last, "Invalid iterator range" );
+   BLAZE_USER_ASSERT( first >= begin(i) && first <= end(i), "Invalid dynamic sparse matrix iterator" );
+   BLAZE_USER_ASSERT( last  >= begin(i) && last  <= end(i), "Invalid dynamic sparse matrix iterator" );
+
+   if( first != last )
+      return lines_[i].erase( first, last );
+   else
+      return first;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the sparse matrix.
+//
+// \param m The new number of rows of the sparse matrix.
+// \param n The new number of columns of the sparse matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the matrix using the given size to \f$ m \times n \f$. Note that this
+// function may invalidate all existing views (submatrices, rows, columns, ...) on the matrix if
+// it is used to shrink the matrix. Additionally, the resize operation potentially changes all
+// matrix elements. In order to preserve the old matrix values, the \a preserve flag can be set
+// to \a true. The capacities of all remaining rows/columns are preserved in both cases.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+void DynamicSparseMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
+{
+   const size_t major( SO ? n : m );
+   const size_t minor( SO ? m : n );
+
+   if( !preserve ) {
+      reset();
+   }
+   else if( minor < ( SO ? m_ : n_ ) ) {
+      for( size_t i=0UL; i<lines_.size() && i<major; ++i )
+         lines_[i].erase( std::lower_bound( lines_[i].begin(), lines_[i].end(), minor, FindIndex() ),
+                          lines_[i].end() );
+   }
+
+   lines_.resize( major );
+
+   m_ = m;
+   n_ = n;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the sparse matrix.
+//
+// \param nonzeros The new minimum capacity of the sparse matrix.
+// \return void
+//
+// This function increases the capacity of the sparse matrix to at least \a nonzeros elements.
+// Since the capacity of a dynamic sparse matrix is managed individually per row/column, the
+// requested capacity is distributed evenly among all rows/columns, i.e. each row/column is
+// given a capacity of at least \f$ \lceil nonzeros / lines \rceil \f$ elements. The current
+// values of the sparse matrix and all larger individual row/column capacities are preserved.
+// In order to reserve capacity for a specific row/column, the reserve( size_t, size_t )
+// function can be used.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void DynamicSparseMatrix<Type,SO>::reserve( size_t nonzeros )
+{
+   if( lines_.empty() || nonzeros <= capacity() )
+      return;
+
+   const size_t share( ( nonzeros + lines_.size() - 1UL ) / lines_.size() );
+
+   for( size_t i=0UL; i<lines_.size(); ++i ) {
+      lines_[i].reserve( share );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of a specific row/column of the sparse matrix.
+//
+// \param i The row/column index of the new element \f$[0..M-1]\f$ or \f$[0..N-1]\f$.
+// \param nonzeros The new minimum capacity of the specified row/column.
+// \return void
+//
+// This function increases the capacity of row/column \a i of the sparse matrix to at least
+// \a nonzeros elements. The current values of the sparse matrix and all other individual
+// row/column capacities are preserved. In case the storage order is set to \a rowMajor, the
+// function reserves capacity for row \a i. In case the storage order is set to \a columnMajor,
+// the function reserves capacity for column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void DynamicSparseMatrix<Type,SO>::reserve( size_t i, size_t nonzeros )
+{
+   BLAZE_USER_ASSERT( i < lines_.size(), "Invalid row/column access index" );
+   lines_[i].reserve( nonzeros );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all excessive capacity from all rows/columns.
+//
+// \return void
+//
+// The trim() function can be used to reverse the effect of all row/column-specific reserve()
+// calls. The function removes all excessive capacity from all rows (in case of a rowMajor
+// matrix) or columns (in case of a columnMajor matrix). Note that this function does not
+// remove the overall capacity but only reduces the capacity per row/column.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void DynamicSparseMatrix<Type,SO>::trim()
+{
+   for( size_t i=0UL; i<lines_.size(); ++i )
+      trim( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all excessive capacity of a specific row/column of the sparse matrix.
+//
+// \param i The index of the row/column to be trimmed (\f$[0..M-1]\f$ or \f$[0..N-1]\f$).
+// \return void
+//
+// This function can be used to reverse the effect of a row/column-specific reserve() call.
+// It removes all excessive capacity from the specified row (in case of a rowMajor matrix)
+// or column (in case of a columnMajor matrix).
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void DynamicSparseMatrix<Type,SO>::trim( size_t i )
+{
+   BLAZE_USER_ASSERT( i < lines_.size(), "Invalid row/column access index" );
+
+   if( lines_[i].capacity() > lines_[i].size() )
+      Line( lines_[i] ).swap( lines_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Transposing the matrix.
+//
+// \return Reference to the transposed matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline DynamicSparseMatrix<Type,SO>& DynamicSparseMatrix<Type,SO>::transpose()
+{
+   DynamicSparseMatrix tmp( trans( *this ) );
+   swap( tmp );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of the sparse matrix by the scalar value \a scalar (\f$ A=B*s \f$).
+//
+// \param scalar The scalar value for the matrix scaling.
+// \return Reference to the sparse matrix.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the scalar value
+inline DynamicSparseMatrix<Type,SO>& DynamicSparseMatrix<Type,SO>::scale( const Other& scalar )
+{
+   for( size_t i=0UL; i<lines_.size(); ++i )
+      for( Iterator element=begin(i); element!=end(i); ++element )
+         element->value_ *= scalar;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling the diagonal of the sparse matrix by the scalar value \a scalar.
+//
+// \param scalar The scalar value for the diagonal scaling.
+// \return Reference to the sparse matrix.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the scalar value
+inline DynamicSparseMatrix<Type,SO>& DynamicSparseMatrix<Type,SO>::scaleDiagonal( Other scalar )
+{
+   const size_t size( blaze::min( m_, n_ ) );
+
+   for( size_t i=0UL; i<size; ++i ) {
+      const Iterator pos( find( i, i ) );
+      if( pos != end(i) )
+         pos->value_ *= scalar;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sparse matrices.
+//
+// \param sm The sparse matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void DynamicSparseMatrix<Type,SO>::swap( DynamicSparseMatrix& sm ) /* throw() */
+{
+   std::swap( m_, sm.m_ );
+   std::swap( n_, sm.n_ );
+   lines_.swap( sm.lines_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONVERSION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Conversion of the dynamic sparse matrix into a compressed matrix.
+//
+// \param sm The target compressed matrix.
+// \return void
+//
+// This function stores the current state of the dynamic sparse matrix in the given compressed
+// matrix. The compressed matrix is resized to the size of the dynamic sparse matrix and all its
+// previous elements are discarded. Afterwards both matrices are independent of each other, i.e.
+// the dynamic sparse matrix can be further modified without affecting the compressed matrix:
+
+   \code
+   blaze::DynamicSparseMatrix<double> A( 1000UL, 1000UL );
+   blaze::CompressedMatrix<double> C;
+
+   // ... Structural updates of A
+
+   A.freeze( C );  // C is a contiguous copy of A
+   \endcode
+
+// In case the shared memory parallelization is enabled and the number of rows/columns of the
+// dynamic sparse matrix is larger or equal to the SMP_SMATFREEZE_THRESHOLD, the rows/columns
+// are copied in parallel directly into the final compressed storage.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename IT >  // Index type of the target compressed matrix
+void DynamicSparseMatrix<Type,SO>::freeze( CompressedMatrix<Type,SO,IT>& sm ) const
+{
+   sm.resize( m_, n_, false );
+   sm.reset();
+   sm.reserve( nonZeros() );
+
+   smpSparseAssign( sm, *this, FreezeKernel( *this ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion of the dynamic sparse matrix into a compressed matrix.
+//
+// \return The compressed matrix containing the current state of the dynamic sparse matrix.
+//
+// This function returns a compressed matrix with the current state of the dynamic sparse
+// matrix. See freeze( CompressedMatrix<Type,SO,IT>& ) for details.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename DynamicSparseMatrix<Type,SO>::ResultType
+   DynamicSparseMatrix<Type,SO>::freeze() const
+{
+   ResultType tmp;
+   freeze( tmp );
+   return tmp;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparse
+// matrix. It specifically searches for the element with row index \a i and column index \a j.
+// In case the element is found, the function returns an row/column iterator to the element.
+// Otherwise an iterator just past the last non-zero element of row \a i or column \a j (the
+// end() iterator) is returned. Note that the returned sparse matrix iterator is subject to
+// invalidation due to inserting operations via the function call operator or the insert()
+// function!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename DynamicSparseMatrix<Type,SO>::Iterator
+   DynamicSparseMatrix<Type,SO>::find( size_t i, size_t j )
+{
+   Line& line( lines_[SO ? j : i] );
+   const Iterator pos( lowerBound( i, j ) );
+
+   if( pos != line.end() && pos->index_ == ( SO ? i : j ) )
+      return pos;
+   else return line.end();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparse
+// matrix. It specifically searches for the element with row index \a i and column index \a j.
+// In case the element is found, the function returns an row/column iterator to the element.
+// Otherwise an iterator just past the last non-zero element of row \a i or column \a j (the
+// end() iterator) is returned. Note that the returned sparse matrix iterator is subject to
+// invalidation due to inserting operations via the function call operator or the insert()
+// function!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename DynamicSparseMatrix<Type,SO>::ConstIterator
+   DynamicSparseMatrix<Type,SO>::find( size_t i, size_t j ) const
+{
+   const Line& line( lines_[SO ? j : i] );
+   const ConstIterator pos( lowerBound( i, j ) );
+
+   if( pos != line.end() && pos->index_ == ( SO ? i : j ) )
+      return pos;
+   else return line.end();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index not less then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index not less then the given row
+// index. In combination with the upperBound() function this function can be used to create
+// a pair of iterators specifying a range of indices. Note that the returned sparse matrix
+// iterator is subject to invalidation due to inserting operations via the function call
+// operator or the insert() function!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename DynamicSparseMatrix<Type,SO>::Iterator
+   DynamicSparseMatrix<Type,SO>::lowerBound( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   Line& line( lines_[SO ? j : i] );
+   return std::lower_bound( line.begin(), line.end(), SO ? i : j, FindIndex() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index not less then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index not less then the given row
+// index. In combination with the upperBound() function this function can be used to create
+// a pair of iterators specifying a range of indices. Note that the returned sparse matrix
+// iterator is subject to invalidation due to inserting operations via the function call
+// operator or the insert() function!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename DynamicSparseMatrix<Type,SO>::ConstIterator
+   DynamicSparseMatrix<Type,SO>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const Line& line( lines_[SO ? j : i] );
+   return std::lower_bound( line.begin(), line.end(), SO ? i : j, FindIndex() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index greater then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index greater then the given row
+// index. In combination with the lowerBound() function this function can be used to create
+// a pair of iterators specifying a range of indices. Note that the returned sparse matrix
+// iterator is subject to invalidation due to inserting operations via the function call
+// operator or the insert() function!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename DynamicSparseMatrix<Type,SO>::Iterator
+   DynamicSparseMatrix<Type,SO>::upperBound( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   Line& line( lines_[SO ? j : i] );
+   return std::upper_bound( line.begin(), line.end(), SO ? i : j, FindIndex() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index greater then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index greater then the given row
+// index. In combination with the lowerBound() function this function can be used to create
+// a pair of iterators specifying a range of indices. Note that the returned sparse matrix
+// iterator is subject to invalidation due to inserting operations via the function call
+// operator or the insert() function!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename DynamicSparseMatrix<Type,SO>::ConstIterator
+   DynamicSparseMatrix<Type,SO>::upperBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const Line& line( lines_[SO ? j : i] );
+   return std::upper_bound( line.begin(), line.end(), SO ? i : j, FindIndex() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOW-LEVEL UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Appending an element to the specified row/column of the sparse matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be appended.
+// \param check \a true if the new value should be checked for default values, \a false if not.
+// \return void
+//
+// This function provides a very efficient way to fill a sparse matrix with elements. It appends
+// a new element to the end of the specified row/column in amortized constant time. The index of
+// the new element must be strictly larger than the largest index of non-zero elements in the
+// specified row/column of the sparse matrix. Ignoring this precondition results in undefined
+// behavior! In contrast to CompressedMatrix, no capacity has to be reserved in advance. The
+// optional \a check parameter specifies whether the new value should be tested for a default
+// value. If the new value is a default value (for instance 0 in case of an integral element
+// type) the value is not appended. Per default the values are not tested.
+//
+// \b Note: append() invalidates all iterators of the specified row/column!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void DynamicSparseMatrix<Type,SO>::append( size_t i, size_t j, const Type& value, bool check )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
+
+   Line& line( lines_[SO ? j : i] );
+   const size_t index( SO ? i : j );
+
+   BLAZE_USER_ASSERT( line.empty() || index > line.back().index_, "Index is not strictly increasing" );
+
+   if( !check || !isDefault( value ) )
+      line.push_back( Element( value, index ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Finalizing the element insertion of a row/column.
+//
+// \param i The index of the row/column to be finalized \f$[0..M-1]\f$.
+// \return void
+//
+// This function is part of the low-level interface to efficiently fill a matrix with elements.
+// Since the rows/columns of a dynamic sparse matrix are independent of each other, the function
+// has no effect. It is provided for interface compatibility with the CompressedMatrix class
+// template.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void DynamicSparseMatrix<Type,SO>::finalize( size_t i )
+{
+   BLAZE_USER_ASSERT( i < lines_.size(), "Invalid row/column access index" );
+
+   UNUSED_PARAMETER( i );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool DynamicSparseMatrix<Type,SO>::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool DynamicSparseMatrix<Type,SO>::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the matrix can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// rows and/or columns of the matrix).
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline bool DynamicSparseMatrix<Type,SO>::canSMPAssign() const
+{
+   return lines_.size() >= getThreshold( smpSMatFreezeThreshold );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void DynamicSparseMatrix<Type,SO>::assign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t i=0UL; i<m_; ++i )
+   {
+      const size_t jbegin( ( IsUpper<MT>::value )
+                           ?( IsStrictlyUpper<MT>::value ? i+1UL : i )
+                           :( 0UL ) );
+      const size_t jend  ( ( IsLower<MT>::value )
+                           ?( IsStrictlyLower<MT>::value ? i : i+1UL )
+                           :( n_ ) );
+
+      for( size_t j=jbegin; j<jend; ++j ) {
+         const Element element( (~rhs)(i,j), SO ? i : j );
+         if( !isDefault( element.value_ ) )
+            lines_[SO ? j : i].push_back( element );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the assignment of a sparse matrix with the same storage order.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side sparse matrix
+inline void DynamicSparseMatrix<Type,SO>::assign( const SparseMatrix<MT,SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
+
+   typedef typename MT::ConstIterator  RhsIterator;
+
+   for( size_t i=0UL; i<lines_.size(); ++i ) {
+      lines_[i].reserve( (~rhs).nonZeros(i) );
+      for( RhsIterator element=(~rhs).begin(i); element!=(~rhs).end(i); ++element )
+         lines_[i].push_back( Element( element->value(), element->index() ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the assignment of a sparse matrix with opposite storage order.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side sparse matrix
+inline void DynamicSparseMatrix<Type,SO>::assign( const SparseMatrix<MT,!SO>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
+
+   typedef typename MT::ConstIterator  RhsIterator;
+
+   const size_t size( SO ? m_ : n_ );
+
+   // Counting the number of elements per row/column
+   std::vector<size_t> lengths( lines_.size(), 0UL );
+   for( size_t j=0UL; j<size; ++j ) {
+      for( RhsIterator element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
+         ++lengths[element->index()];
+   }
+
+   for( size_t i=0UL; i<lines_.size(); ++i )
+      lines_[i].reserve( lengths[i] );
+
+   // Appending the elements to the rows/columns of the sparse matrix
+   for( size_t j=0UL; j<size; ++j ) {
+      for( RhsIterator element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
+         lines_[element->index()].push_back( Element( element->value(), j ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the addition assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void DynamicSparseMatrix<Type,SO>::addAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   DynamicSparseMatrix tmp( serial( *this + (~rhs) ) );
+   swap( tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the addition assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline void DynamicSparseMatrix<Type,SO>::addAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   DynamicSparseMatrix tmp( serial( *this + (~rhs) ) );
+   swap( tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the subtraction assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void DynamicSparseMatrix<Type,SO>::subAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   DynamicSparseMatrix tmp( serial( *this - (~rhs) ) );
+   swap( tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the subtraction assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand sparse matrix
+inline void DynamicSparseMatrix<Type,SO>::subAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   DynamicSparseMatrix tmp( serial( *this - (~rhs) ) );
+   swap( tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DYNAMICSPARSEMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name DynamicSparseMatrix operators */
+//@{
+template< typename Type, bool SO >
+inline void reset( DynamicSparseMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline void reset( DynamicSparseMatrix<Type,SO>& m, size_t i );
+
+template< typename Type, bool SO >
+inline void clear( DynamicSparseMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline bool isDefault( const DynamicSparseMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline void swap( DynamicSparseMatrix<Type,SO>& a, DynamicSparseMatrix<Type,SO>& b ) /* throw() */;
+
+template< typename Type, bool SO >
+inline void move( DynamicSparseMatrix<Type,SO>& dst, DynamicSparseMatrix<Type,SO>& src ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given dynamic sparse matrix.
+// \ingroup dynamic_sparse_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void reset( DynamicSparseMatrix<Type,SO>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column of the given dynamic sparse matrix.
+// \ingroup dynamic_sparse_matrix
+//
+// \param m The matrix to be resetted.
+// \param i The index of the row/column to be resetted.
+// \return void
+//
+// This function resets the values in the specified row/column of the given dynamic sparse matrix
+// to their default value. In case the given matrix is a \a rowMajor matrix the function resets
+// the values in row \a i, if it is a \a columnMajor matrix the function resets the values in
+// column \a i. Note that the capacity of the row/column remains unchanged.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void reset( DynamicSparseMatrix<Type,SO>& m, size_t i )
+{
+   m.reset( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given dynamic sparse matrix.
+// \ingroup dynamic_sparse_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void clear( DynamicSparseMatrix<Type,SO>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given dynamic sparse matrix is in default state.
+// \ingroup dynamic_sparse_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+//
+// This function checks whether the dynamic sparse matrix is in default (constructed) state,
+// i.e. if it's number of rows and columns is 0. In case it is in default state, the function
+// returns \a true, else it will return \a false.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline bool isDefault( const DynamicSparseMatrix<Type,SO>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two dynamic sparse matrices.
+// \ingroup dynamic_sparse_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void swap( DynamicSparseMatrix<Type,SO>& a, DynamicSparseMatrix<Type,SO>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Moving the contents of one dynamic sparse matrix to another.
+// \ingroup dynamic_sparse_matrix
+//
+// \param dst The destination matrix.
+// \param src The source matrix.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void move( DynamicSparseMatrix<Type,SO>& dst, DynamicSparseMatrix<Type,SO>& src ) /* throw() */
+{
+   dst.swap( src );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISRESIZABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct IsResizable< DynamicSparseMatrix<T,SO> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO >
+struct SubmatrixTrait< DynamicSparseMatrix<T1,SO> >
+{
+   typedef CompressedMatrix<T1,SO>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO >
+struct RowTrait< DynamicSparseMatrix<T1,SO> >
+{
+   typedef CompressedVector<T1,true>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO >
+struct ColumnTrait< DynamicSparseMatrix<T1,SO> >
+{
+   typedef CompressedVector<T1,false>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -36,6 +36,13 @@
 #define _BLAZE_MATH_SPARSE_FORWARD_H_
 
 
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/Types.h>
+
+
 namespace blaze {
 
 //=================================================================================================
@@ -44,8 +51,11 @@ namespace blaze {
 //
 //=================================================================================================
 
-template< typename, bool > class CompressedMatrix;
-template< typename, bool > class CompressedVector;
+template< typename, bool, typename > class CompressedMatrix;
+template< typename, bool, typename > class CompressedVector;
+template< typename, bool > class DynamicSparseMatrix;
+template< typename, bool, typename > class MappedCompressedMatrix;
+template< typename, size_t, typename > class SellMatrix;
 
 } // namespace blaze
 
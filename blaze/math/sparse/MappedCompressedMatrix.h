@@ -0,0 +1,1387 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/MappedCompressedMatrix.h
+//  \brief Implementation of a memory-mapped compressed matrix
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_MAPPEDCOMPRESSEDMATRIX_H_
+#define _BLAZE_MATH_SPARSE_MAPPEDCOMPRESSEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/serialization/MappedFormat.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/CompressedVector.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/MappedFile.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup mapped_compressed_matrix MappedCompressedMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Read-only compressed matrix residing in a memory-mapped file.
+// \ingroup mapped_compressed_matrix
+//
+// The MappedCompressedMatrix class template represents a sparse matrix that has been written to
+// a file by the writeMapped() function. Instead of reading the elements from the file, the file
+// is mapped read-only into memory and the matrix directly works on the mapped arrays of offsets
+// and value-index-pairs. Therefore loading a matrix does neither allocate nor copy any elements
+// and takes the same time for all matrix sizes. The type of the elements, the storage order and
+// the type of the stored indices can be specified via the three template parameters:
+
+   \code
+   template< typename Type, bool SO, typename IT >
+   class MappedCompressedMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. MappedCompressedMatrix can be used with
+//          any non-cv-qualified, non-reference, non-pointer numeric element type.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::rowMajor.
+//  - IT  : specifies the type of the stored indices. The default value is \a size_t.
+//
+// All three parameters have to match the matrix written to the file. In case the file does not
+// contain a matching sparse matrix, a \a std::runtime_error exception is thrown. Since the
+// value-index-pairs are stored in the same layout as in a CompressedMatrix, a mapped compressed
+// matrix can be used in all sparse matrix expressions:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+   using blaze::MappedCompressedMatrix;
+   using blaze::rowMajor;
+
+   // Writing the matrix A to the file "A.blaze"
+   {
+      CompressedMatrix<double,rowMajor,uint32_t> A( 1000000UL, 1000000UL );
+      // ... Initialization of the matrix
+
+      blaze::writeMapped( "A.blaze", A );
+   }
+
+   // Mapping the file "A.blaze"
+   {
+      MappedCompressedMatrix<double,rowMajor,uint32_t> A( "A.blaze" );
+
+      DynamicVector<double> x( 1000000UL ), y;
+      // ... Initialization of the vector
+
+      y = A * x;  // Sparse matrix/dense vector multiplication
+   }
+   \endcode
+
+// A mapped compressed matrix is read-only: it is not possible to assign to the matrix or to
+// modify its elements. Furthermore, it cannot be copied, since it owns the mapping of the file.
+// The file is unmapped as soon as the matrix is destroyed.
+*/
+template< typename Type                    // Data type of the sparse matrix
+        , bool SO = defaultStorageOrder    // Storage order
+        , typename IT = size_t >           // Index type
+class MappedCompressedMatrix : public SparseMatrix< MappedCompressedMatrix<Type,SO,IT>, SO >
+                             , private NonCopyable
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef ValueIndexPair<Type,IT>  Element;  //!< Value-index-pair of the compressed matrix.
+   //**********************************************************************************************
+
+   //**Private class FindIndex*********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Helper class for the lower_bound() and upper_bound() functions.
+   */
+   struct FindIndex : public std::binary_function<Element,size_t,bool>
+   {
+      inline bool operator()( const Element& element, size_t index ) const {
+         return element.index() < index;
+      }
+      inline bool operator()( size_t index, const Element& element ) const {
+         return index < element.index();
+      }
+      inline bool operator()( const Element& element1, const Element& element2 ) const {
+         return element1.index() < element2.index();
+      }
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef MappedCompressedMatrix<Type,SO,IT>  This;           //!< Type of this MappedCompressedMatrix instance.
+   typedef CompressedMatrix<Type,SO,IT>        ResultType;     //!< Result type for expression template evaluations.
+   typedef CompressedMatrix<Type,!SO,IT>       OppositeType;   //!< Result type with opposite storage order for expression template evaluations.
+   typedef CompressedMatrix<Type,!SO,IT>       TransposeType;  //!< Transpose type for expression template evaluations.
+   typedef Type                                ElementType;    //!< Type of the sparse matrix elements.
+   typedef const Type&                         ReturnType;     //!< Return type for expression template evaluations.
+   typedef const This&                         CompositeType;  //!< Data type for composite expression templates.
+   typedef const Type&                         Reference;      //!< Reference to a sparse matrix value.
+   typedef const Type&                         ConstReference; //!< Reference to a constant sparse matrix value.
+   typedef const Element*                      Iterator;       //!< Iterator over the sparse matrix elements.
+   typedef const Element*                      ConstIterator;  //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum { smpAssignable = !IsSMPAssignable<Type>::value };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline MappedCompressedMatrix( const std::string& filename );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const;
+   inline ConstIterator  begin ( size_t i ) const;
+   inline ConstIterator  cbegin( size_t i ) const;
+   inline ConstIterator  end   ( size_t i ) const;
+   inline ConstIterator  cend  ( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const;
+   inline size_t columns() const;
+   inline size_t capacity() const;
+   inline size_t capacity( size_t i ) const;
+   inline size_t nonZeros() const;
+   inline size_t nonZeros( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+
+   inline bool canSMPAssign() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MappedFile      file_;      //!< The memory mapping of the file.
+   size_t          m_;         //!< The number of rows of the sparse matrix.
+   size_t          n_;         //!< The number of columns of the sparse matrix.
+   const uint64_t* offset_;    //!< The offsets of the first element of each row/column.
+   const Element*  elements_;  //!< The mapped array of value-index-pairs.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type, bool SO, typename IT >
+const Type MappedCompressedMatrix<Type,SO,IT>::zero_ = Type();
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Maps the given file as a row-major compressed matrix.
+//
+// \param filename The name of the file written by the writeMapped() function.
+// \exception std::runtime_error File could not be mapped as compressed matrix.
+//
+// This constructor maps the given file read-only into memory and checks the header of the file.
+// In case the file cannot be mapped or in case it does not contain a row-major sparse matrix
+// with elements of type \a Type and indices of type \a IT, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline MappedCompressedMatrix<Type,SO,IT>::MappedCompressedMatrix( const std::string& filename )
+   : file_    ( filename )  // The memory mapping of the file
+   , m_       ( 0UL  )      // The number of rows of the sparse matrix
+   , n_       ( 0UL  )      // The number of columns of the sparse matrix
+   , offset_  ( NULL )      // The offsets of the first element of each row
+   , elements_( NULL )      // The mapped array of value-index-pairs
+{
+   const MappedHeader& header( readMappedHeader<Type>( file_, 3U, sizeof( IT ) ) );
+
+   m_ = header.rows_;
+   n_ = header.columns_;
+
+   const size_t begin( sizeof( MappedHeader ) + ( m_+1UL )*sizeof( uint64_t ) );
+
+   if( begin > header.offset_ || header.offset_ > file_.size() ||
+       ( file_.size() - header.offset_ ) / sizeof( Element ) < header.nonZeros_ ) {
+      throw std::runtime_error( "Invalid matrix size detected" );
+   }
+
+   offset_   = reinterpret_cast<const uint64_t*>( file_.data() + sizeof( MappedHeader ) );
+   elements_ = reinterpret_cast<const Element*>( file_.data() + header.offset_ );
+
+   if( offset_[m_] != header.nonZeros_ ) {
+      throw std::runtime_error( "Invalid number of elements detected" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename MappedCompressedMatrix<Type,SO,IT>::ConstReference
+   MappedCompressedMatrix<Type,SO,IT>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const ConstIterator pos( find( i, j ) );
+
+   if( pos == end( i ) )
+      return zero_;
+   else
+      return pos->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename MappedCompressedMatrix<Type,SO,IT>::ConstIterator
+   MappedCompressedMatrix<Type,SO,IT>::begin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   return elements_ + offset_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename MappedCompressedMatrix<Type,SO,IT>::ConstIterator
+   MappedCompressedMatrix<Type,SO,IT>::cbegin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   return elements_ + offset_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename MappedCompressedMatrix<Type,SO,IT>::ConstIterator
+   MappedCompressedMatrix<Type,SO,IT>::end( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   return elements_ + offset_[i+1UL];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename MappedCompressedMatrix<Type,SO,IT>::ConstIterator
+   MappedCompressedMatrix<Type,SO,IT>::cend( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   return elements_ + offset_[i+1UL];
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t MappedCompressedMatrix<Type,SO,IT>::rows() const
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t MappedCompressedMatrix<Type,SO,IT>::columns() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the sparse matrix.
+//
+// \return The capacity of the sparse matrix.
+//
+// Since the sparsity pattern of a mapped matrix is fixed, the capacity is the total number of
+// non-zero elements.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t MappedCompressedMatrix<Type,SO,IT>::capacity() const
+{
+   return nonZeros();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The current capacity of row/column \a i.
+//
+// Since the sparsity pattern of a mapped matrix is fixed, the capacity of a row/column is the
+// number of non-zero elements of the row/column.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t MappedCompressedMatrix<Type,SO,IT>::capacity( size_t i ) const
+{
+   return nonZeros( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the sparse matrix
+//
+// \return The number of non-zero elements in the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t MappedCompressedMatrix<Type,SO,IT>::nonZeros() const
+{
+   return offset_[m_];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+//
+// This function returns the current number of non-zero elements in the specified row/column.
+// In case the storage order is set to \a rowMajor the function returns the number of non-zero
+// elements in row \a i, in case the storage flag is set to \a columnMajor the function returns
+// the number of non-zero elements in column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t MappedCompressedMatrix<Type,SO,IT>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index" );
+   return offset_[i+1UL] - offset_[i];
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparse
+// matrix. It specifically searches for the element with row index \a i and column index \a j.
+// In case the element is found, the function returns an row/column iterator to the element.
+// Otherwise an iterator just past the last non-zero element of row \a i or column \a j (the
+// end() iterator) is returned.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename MappedCompressedMatrix<Type,SO,IT>::ConstIterator
+   MappedCompressedMatrix<Type,SO,IT>::find( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+   if( pos != end( i ) && pos->index() == j )
+      return pos;
+   else return end( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index not less then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index not less then the given row
+// index. In combination with the upperBound() function this function can be used to create a
+// pair of iterators specifying a range of indices.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename MappedCompressedMatrix<Type,SO,IT>::ConstIterator
+   MappedCompressedMatrix<Type,SO,IT>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return std::lower_bound( begin( i ), end( i ), j, FindIndex() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index greater then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index greater then the given row
+// index. In combination with the lowerBound() function this function can be used to create a
+// pair of iterators specifying a range of indices.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename MappedCompressedMatrix<Type,SO,IT>::ConstIterator
+   MappedCompressedMatrix<Type,SO,IT>::upperBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return std::upper_bound( begin( i ), end( i ), j, FindIndex() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the foreign expression
+inline bool MappedCompressedMatrix<Type,SO,IT>::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the foreign expression
+inline bool MappedCompressedMatrix<Type,SO,IT>::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the matrix can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// rows and/or columns of the matrix).
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline bool MappedCompressedMatrix<Type,SO,IT>::canSMPAssign() const
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS TEMPLATE SPECIALIZATION FOR COLUMN-MAJOR MATRICES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of MappedCompressedMatrix for column-major matrices.
+// \ingroup mapped_compressed_matrix
+//
+// This specialization of MappedCompressedMatrix adapts the class template to the requirements
+// of column-major matrices.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+class MappedCompressedMatrix<Type,true,IT> : public SparseMatrix< MappedCompressedMatrix<Type,true,IT>, true >
+                                           , private NonCopyable
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef ValueIndexPair<Type,IT>  Element;  //!< Value-index-pair of the compressed matrix.
+   //**********************************************************************************************
+
+   //**Private class FindIndex*********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Helper class for the lower_bound() and upper_bound() functions.
+   */
+   struct FindIndex : public std::binary_function<Element,size_t,bool>
+   {
+      inline bool operator()( const Element& element, size_t index ) const {
+         return element.index() < index;
+      }
+      inline bool operator()( size_t index, const Element& element ) const {
+         return index < element.index();
+      }
+      inline bool operator()( const Element& element1, const Element& element2 ) const {
+         return element1.index() < element2.index();
+      }
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef MappedCompressedMatrix<Type,true,IT>  This;           //!< Type of this MappedCompressedMatrix instance.
+   typedef CompressedMatrix<Type,true,IT>        ResultType;     //!< Result type for expression template evaluations.
+   typedef CompressedMatrix<Type,false,IT>       OppositeType;   //!< Result type with opposite storage order for expression template evaluations.
+   typedef CompressedMatrix<Type,false,IT>       TransposeType;  //!< Transpose type for expression template evaluations.
+   typedef Type                                  ElementType;    //!< Type of the sparse matrix elements.
+   typedef const Type&                           ReturnType;     //!< Return type for expression template evaluations.
+   typedef const This&                           CompositeType;  //!< Data type for composite expression templates.
+   typedef const Type&                           Reference;      //!< Reference to a sparse matrix value.
+   typedef const Type&                           ConstReference; //!< Reference to a constant sparse matrix value.
+   typedef const Element*                        Iterator;       //!< Iterator over the sparse matrix elements.
+   typedef const Element*                        ConstIterator;  //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum { smpAssignable = !IsSMPAssignable<Type>::value };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline MappedCompressedMatrix( const std::string& filename );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const;
+   inline ConstIterator  begin ( size_t j ) const;
+   inline ConstIterator  cbegin( size_t j ) const;
+   inline ConstIterator  end   ( size_t j ) const;
+   inline ConstIterator  cend  ( size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const;
+   inline size_t columns() const;
+   inline size_t capacity() const;
+   inline size_t capacity( size_t j ) const;
+   inline size_t nonZeros() const;
+   inline size_t nonZeros( size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+
+   inline bool canSMPAssign() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MappedFile      file_;      //!< The memory mapping of the file.
+   size_t          m_;         //!< The number of rows of the sparse matrix.
+   size_t          n_;         //!< The number of columns of the sparse matrix.
+   const uint64_t* offset_;    //!< The offsets of the first element of each column.
+   const Element*  elements_;  //!< The mapped array of value-index-pairs.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( Type );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+/*! \cond BLAZE_INTERNAL */
+template< typename Type, typename IT >
+const Type MappedCompressedMatrix<Type,true,IT>::zero_ = Type();
+/*! \endcond */
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Maps the given file as a column-major compressed matrix.
+//
+// \param filename The name of the file written by the writeMapped() function.
+// \exception std::runtime_error File could not be mapped as compressed matrix.
+//
+// This constructor maps the given file read-only into memory and checks the header of the file.
+// In case the file cannot be mapped or in case it does not contain a column-major sparse matrix
+// with elements of type \a Type and indices of type \a IT, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline MappedCompressedMatrix<Type,true,IT>::MappedCompressedMatrix( const std::string& filename )
+   : file_    ( filename )  // The memory mapping of the file
+   , m_       ( 0UL  )      // The number of rows of the sparse matrix
+   , n_       ( 0UL  )      // The number of columns of the sparse matrix
+   , offset_  ( NULL )      // The offsets of the first element of each column
+   , elements_( NULL )      // The mapped array of value-index-pairs
+{
+   const MappedHeader& header( readMappedHeader<Type>( file_, 7U, sizeof( IT ) ) );
+
+   m_ = header.rows_;
+   n_ = header.columns_;
+
+   const size_t begin( sizeof( MappedHeader ) + ( n_+1UL )*sizeof( uint64_t ) );
+
+   if( begin > header.offset_ || header.offset_ > file_.size() ||
+       ( file_.size() - header.offset_ ) / sizeof( Element ) < header.nonZeros_ ) {
+      throw std::runtime_error( "Invalid matrix size detected" );
+   }
+
+   offset_   = reinterpret_cast<const uint64_t*>( file_.data() + sizeof( MappedHeader ) );
+   elements_ = reinterpret_cast<const Element*>( file_.data() + header.offset_ );
+
+   if( offset_[n_] != header.nonZeros_ ) {
+      throw std::runtime_error( "Invalid number of elements detected" );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename MappedCompressedMatrix<Type,true,IT>::ConstReference
+   MappedCompressedMatrix<Type,true,IT>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const ConstIterator pos( find( i, j ) );
+
+   if( pos == end( j ) )
+      return zero_;
+   else
+      return pos->value();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator to the first element of column \a j.
+//
+// \param j The column index.
+// \return Iterator to the first element of column \a j.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename MappedCompressedMatrix<Type,true,IT>::ConstIterator
+   MappedCompressedMatrix<Type,true,IT>::begin( size_t j ) const
+{
+   BLAZE_USER_ASSERT( j < n_, "Invalid sparse matrix column access index" );
+   return elements_ + offset_[j];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator to the first element of column \a j.
+//
+// \param j The column index.
+// \return Iterator to the first element of column \a j.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename MappedCompressedMatrix<Type,true,IT>::ConstIterator
+   MappedCompressedMatrix<Type,true,IT>::cbegin( size_t j ) const
+{
+   BLAZE_USER_ASSERT( j < n_, "Invalid sparse matrix column access index" );
+   return elements_ + offset_[j];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator just past the last element of column \a j.
+//
+// \param j The column index.
+// \return Iterator just past the last element of column \a j.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename MappedCompressedMatrix<Type,true,IT>::ConstIterator
+   MappedCompressedMatrix<Type,true,IT>::end( size_t j ) const
+{
+   BLAZE_USER_ASSERT( j < n_, "Invalid sparse matrix column access index" );
+   return elements_ + offset_[j+1UL];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator just past the last element of column \a j.
+//
+// \param j The column index.
+// \return Iterator just past the last element of column \a j.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename MappedCompressedMatrix<Type,true,IT>::ConstIterator
+   MappedCompressedMatrix<Type,true,IT>::cend( size_t j ) const
+{
+   BLAZE_USER_ASSERT( j < n_, "Invalid sparse matrix column access index" );
+   return elements_ + offset_[j+1UL];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline size_t MappedCompressedMatrix<Type,true,IT>::rows() const
+{
+   return m_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline size_t MappedCompressedMatrix<Type,true,IT>::columns() const
+{
+   return n_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the maximum capacity of the sparse matrix.
+//
+// \return The capacity of the sparse matrix.
+//
+// Since the sparsity pattern of a mapped matrix is fixed, the capacity is the total number of
+// non-zero elements.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline size_t MappedCompressedMatrix<Type,true,IT>::capacity() const
+{
+   return nonZeros();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the current capacity of the specified column.
+//
+// \param j The index of the column.
+// \return The current capacity of column \a j.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline size_t MappedCompressedMatrix<Type,true,IT>::capacity( size_t j ) const
+{
+   return nonZeros( j );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of non-zero elements in the sparse matrix
+//
+// \return The number of non-zero elements in the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline size_t MappedCompressedMatrix<Type,true,IT>::nonZeros() const
+{
+   return offset_[n_];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of non-zero elements in the specified column.
+//
+// \param j The index of the column.
+// \return The number of non-zero elements of column \a j.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline size_t MappedCompressedMatrix<Type,true,IT>::nonZeros( size_t j ) const
+{
+   BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
+   return offset_[j+1UL] - offset_[j];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparse
+// matrix. It specifically searches for the element with row index \a i and column index \a j.
+// In case the element is found, the function returns an column iterator to the element.
+// Otherwise an iterator just past the last non-zero element of column \a j (the end()
+// iterator) is returned.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename MappedCompressedMatrix<Type,true,IT>::ConstIterator
+   MappedCompressedMatrix<Type,true,IT>::find( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+   if( pos != end( j ) && pos->index() == i )
+      return pos;
+   else return end( j );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// This function returns a column iterator to the first element with an index not less then
+// the given row index. In combination with the upperBound() function this function can be
+// used to create a pair of iterators specifying a range of indices.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename MappedCompressedMatrix<Type,true,IT>::ConstIterator
+   MappedCompressedMatrix<Type,true,IT>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+   return std::lower_bound( begin( j ), end( j ), i, FindIndex() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+//
+// This function returns a column iterator to the first element with an index greater then
+// the given row index. In combination with the lowerBound() function this function can be
+// used to create a pair of iterators specifying a range of indices.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename MappedCompressedMatrix<Type,true,IT>::ConstIterator
+   MappedCompressedMatrix<Type,true,IT>::upperBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+   return std::upper_bound( begin( j ), end( j ), i, FindIndex() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the foreign expression
+inline bool MappedCompressedMatrix<Type,true,IT>::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the foreign expression
+inline bool MappedCompressedMatrix<Type,true,IT>::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the matrix can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// rows and/or columns of the matrix).
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline bool MappedCompressedMatrix<Type,true,IT>::canSMPAssign() const
+{
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAPPEDCOMPRESSEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name MappedCompressedMatrix operators */
+//@{
+template< typename Type, bool SO, typename IT >
+inline bool isDefault( const MappedCompressedMatrix<Type,SO,IT>& m );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given mapped compressed matrix is in default state.
+// \ingroup mapped_compressed_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix is component-wise zero, \a false otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline bool isDefault( const MappedCompressedMatrix<Type,SO,IT>& m )
+{
+   typedef typename MappedCompressedMatrix<Type,SO,IT>::ConstIterator  ConstIterator;
+
+   const size_t iend( ( SO == rowMajor )?( m.rows() ):( m.columns() ) );
+
+   for( size_t i=0UL; i<iend; ++i ) {
+      for( ConstIterator element=m.begin(i); element!=m.end(i); ++element )
+         if( !isDefault( element->value() ) ) return false;
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename IT >
+struct SubmatrixTrait< MappedCompressedMatrix<T1,SO,IT> >
+{
+   typedef CompressedMatrix<T1,SO,IT>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename IT >
+struct RowTrait< MappedCompressedMatrix<T1,SO,IT> >
+{
+   typedef CompressedVector<T1,true,IT>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename IT >
+struct ColumnTrait< MappedCompressedMatrix<T1,SO,IT> >
+{
+   typedef CompressedVector<T1,false,IT>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
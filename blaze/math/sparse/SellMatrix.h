@@ -0,0 +1,1977 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SellMatrix.h
+//  \brief Implementation of a sliced ELLPACK (SELL-C-sigma) sparse matrix
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SELLMATRIX_H_
+#define _BLAZE_MATH_SPARSE_SELLMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsSellMatrix.h>
+#include <blaze/math/typetraits/IsView.h>
+#include <blaze/math/views/Forward.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsDouble.h>
+#include <blaze/util/typetraits/IsFloat.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup sell_matrix SellMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Row-major sparse matrix in the sliced ELLPACK (SELL-C-sigma) format.
+// \ingroup sell_matrix
+//
+// The SellMatrix class template stores a row-major sparse matrix in the sliced ELLPACK format,
+// which is tailored to the SIMD evaluation of sparse matrix/dense vector multiplications. The
+// type of the elements, the number of rows per chunk, and the type of the column indices can be
+// specified via the three template parameters:
+
+   \code
+   template< typename Type, size_t C, typename IT >
+   class SellMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. SellMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer numeric element type.
+//  - C   : specifies the number of rows per chunk. By default this is the number of values of
+//          type \a Type in a SIMD vector of the active instruction set.
+//  - IT  : specifies the unsigned integral type that is used to store the column indices. The
+//          default value is \a size_t. A 32-bit index type (\a unsigned \a int) halves the
+//          memory traffic for the column indices and enables the SIMD kernels to gather the
+//          vector elements by means of 32-bit gather instructions, but restricts the number of
+//          columns to \f$ 2^{31}-1 \f$.
+//
+// The rows of the matrix are grouped into chunks of \a C consecutive rows. The non-zero elements
+// of a chunk are stored column by column, i.e. the k-th elements of the \a C rows of a chunk are
+// contiguous in memory, and each chunk is padded with explicit zeros to the length of its
+// longest row. This layout enables the multiplication kernels to process the \a C rows of a
+// chunk in the lanes of SIMD vectors: the matrix values are loaded with aligned loads and the
+// vector elements with gather instructions (if available). In order to limit the amount of
+// padding, the rows are sorted by decreasing number of non-zero elements within windows of
+// \a sigma rows before they are assigned to chunks (sigma is rounded up to a multiple of \a C
+// and defaults to 32 chunks):
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::SellMatrix;
+   using blaze::DynamicVector;
+
+   CompressedMatrix<double> A( 100000UL, 100000UL );
+   // ... Initialization of the compressed matrix
+
+   SellMatrix<double> S( A );          // Conversion with the default sigma
+   SellMatrix<double> T( A, 1024UL );  // Conversion with a sorting window of 1024 rows
+
+   SellMatrix<double,4UL,unsigned int> U( A );  // Chunks of 4 rows and 32-bit column indices
+
+   DynamicVector<double> x( 100000UL ), y;
+   // ... Initialization of the dense vector
+
+   y = S * x;  // SIMD sparse matrix/dense vector multiplication
+   \endcode
+
+// The sparsity pattern of a SellMatrix is fixed at the time of its construction: the values of
+// the stored elements can be modified via the iterators, but elements can neither be inserted
+// nor erased. For all other operations the matrix behaves like a row-major sparse matrix, i.e.
+// the iterators traverse the stored elements of a row in ascending column order and SellMatrix
+// can be used in all sparse matrix expressions:
+
+   \code
+   CompressedMatrix<double> B( S * A );  // Sparse matrix multiplication
+   B = trans( S ) + A;                   // Addition of a transposed SELL matrix
+   \endcode
+
+// The multiplication of a SellMatrix with a dense vector or a column-major dense matrix is
+// evaluated chunk by chunk. In case the shared memory parallelization is enabled, the chunks
+// are distributed among all available threads.
+*/
+template< typename Type                          // Data type of the sparse matrix
+        , size_t C = IntrinsicTrait<Type>::size  // Number of rows per chunk
+        , typename IT = size_t >                 // Index type
+class SellMatrix : public SparseMatrix< SellMatrix<Type,C,IT>, false >
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef IntrinsicTrait<Type>  ITT;  //!< Intrinsic trait for the matrix element type.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the SIMD multiplication kernels.
+   enum { vectorizedKernel = ( IsFloat<Type>::value || IsDouble<Type>::value ) &&
+                             ITT::size > 1UL && C % ITT::size == 0UL &&
+                             ( IsSame<IT,size_t>::value || IsSame<IT,unsigned int>::value ) };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the SIMD multiplication kernels are available, the right-hand side vector of
+       type \a VT provides low-level data access and both the vector and the target element
+       type \a ET match the element type of the matrix, \a value is set to 1 and the SIMD
+       kernel is selected. Otherwise \a value is set to 0 and the default kernel is selected. */
+   template< typename VT, typename ET >
+   struct UseVectorizedKernel {
+      enum { value = vectorizedKernel &&
+                     HasConstDataAccess<VT>::value && !IsView<VT>::value &&
+                     IsSame<typename VT::ElementType,Type>::value && IsSame<ET,Type>::value };
+   };
+
+   template< typename ET >
+   struct UseVectorizedKernel< const Type*, ET > {
+      enum { value = vectorizedKernel && IsSame<ET,Type>::value };
+   };
+
+   template< typename ET >
+   struct UseVectorizedKernel< Type*, ET > {
+      enum { value = vectorizedKernel && IsSame<ET,Type>::value };
+   };
+
+   template< typename MT, bool SF, typename ET >
+   struct UseVectorizedKernel< DenseColumn<MT,true,SF>, ET > {
+      enum { value = vectorizedKernel && HasConstDataAccess<MT>::value &&
+                     IsSame<typename MT::ElementType,Type>::value && IsSame<ET,Type>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Private class LongerRow*********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Helper class for the sorting of the rows by their number of non-zero elements.
+   */
+   struct LongerRow
+   {
+      explicit inline LongerRow( const size_t* nonZeros )
+         : nonZeros_( nonZeros )  // The number of non-zero elements of all rows
+      {}
+
+      inline bool operator()( size_t i1, size_t i2 ) const {
+         return nonZeros_[i1] > nonZeros_[i2];
+      }
+
+      const size_t* nonZeros_;  //!< The number of non-zero elements of all rows.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Private class SellIterator******************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Iterator over the elements of a single row of the SELL matrix.
+   //
+   // The elements of a row are stored with a stride of \a C elements. Therefore the iterator
+   // holds a pointer to the current value and a pointer to the current column index and
+   // advances both pointers by \a C elements.
+   */
+   template< typename ET >  // Element type of the iterator (Type or const Type)
+   class SellIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      typedef ValueIndexPair<Type>       Element;           //!< Element type of the iterator.
+      typedef std::forward_iterator_tag  IteratorCategory;  //!< The iterator category.
+      typedef Element                    ValueType;         //!< Type of the underlying elements.
+      typedef ValueType*                 PointerType;       //!< Pointer return type.
+      typedef ValueType&                 ReferenceType;     //!< Reference return type.
+      typedef ptrdiff_t                  DifferenceType;    //!< Difference between two iterators.
+
+      // STL iterator requirements
+      typedef IteratorCategory  iterator_category;  //!< The iterator category.
+      typedef ValueType         value_type;         //!< Type of the underlying elements.
+      typedef PointerType       pointer;            //!< Pointer return type.
+      typedef ReferenceType     reference;          //!< Reference return type.
+      typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Default constructor for the SellIterator class.
+      */
+      inline SellIterator()
+         : value_( NULL )  // Pointer to the current value
+         , index_( NULL )  // Pointer to the current column index
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the SellIterator class.
+      //
+      // \param value Pointer to the current value.
+      // \param index Pointer to the current column index.
+      */
+      inline SellIterator( ET* value, const IT* index )
+         : value_( value )  // Pointer to the current value
+         , index_( index )  // Pointer to the current column index
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Conversion constructor from different SellIterator instances.
+      //
+      // \param it The row iterator to be copied.
+      */
+      template< typename ET2 >
+      inline SellIterator( const SellIterator<ET2>& it )
+         : value_( it.value_ )  // Pointer to the current value
+         , index_( it.index_ )  // Pointer to the current column index
+      {}
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline SellIterator& operator++() {
+         value_ += C;
+         index_ += C;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const SellIterator operator++( int ) {
+         const SellIterator tmp( *this );
+         ++(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return The current value-index-pair of the sparse element.
+      */
+      inline const Element operator*() const {
+         return Element( *value_, *index_ );
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return Pointer to the iterator, which provides the value() and index() functions.
+      */
+      inline const SellIterator* operator->() const {
+         return this;
+      }
+      //*******************************************************************************************
+
+      //**Value function***************************************************************************
+      /*!\brief Access to the current value of the sparse element.
+      //
+      // \return Reference to the current value of the sparse element.
+      */
+      inline ET& value() const {
+         return *value_;
+      }
+      //*******************************************************************************************
+
+      //**Index function***************************************************************************
+      /*!\brief Access to the current column index of the sparse element.
+      //
+      // \return The current column index of the sparse element.
+      */
+      inline size_t index() const {
+         return *index_;
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two SellIterator objects.
+      //
+      // \param rhs The right-hand side row iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      template< typename ET2 >
+      inline bool operator==( const SellIterator<ET2>& rhs ) const {
+         return value_ == rhs.value_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two SellIterator objects.
+      //
+      // \param rhs The right-hand side row iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      template< typename ET2 >
+      inline bool operator!=( const SellIterator<ET2>& rhs ) const {
+         return value_ != rhs.value_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two row iterators.
+      //
+      // \param rhs The right-hand side row iterator.
+      // \return The number of elements between the two row iterators.
+      */
+      template< typename ET2 >
+      inline DifferenceType operator-( const SellIterator<ET2>& rhs ) const {
+         return ( value_ - rhs.value_ ) / DifferenceType( C );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      ET*       value_;  //!< Pointer to the current value.
+      const IT* index_;  //!< Pointer to the current column index.
+      //*******************************************************************************************
+
+      //**Friend declarations**********************************************************************
+      template< typename ET2 > friend class SellIterator;
+      //*******************************************************************************************
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef SellMatrix<Type,C,IT>            This;            //!< Type of this SellMatrix instance.
+   typedef CompressedMatrix<Type,false,IT>  ResultType;      //!< Result type for expression template evaluations.
+   typedef CompressedMatrix<Type,true,IT>   OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef CompressedMatrix<Type,true,IT>   TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                             ElementType;     //!< Type of the sparse matrix elements.
+   typedef const Type&                      ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                      CompositeType;   //!< Data type for composite expression templates.
+   typedef const Type&                      Reference;       //!< Reference to a sparse matrix value.
+   typedef const Type&                      ConstReference;  //!< Reference to a constant sparse matrix value.
+   typedef SellIterator<Type>               Iterator;        //!< Iterator over non-constant elements.
+   typedef SellIterator<const Type>         ConstIterator;   //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a SellMatrix with different data/element type.
+   */
+   template< typename ET >  // Data type of the other matrix
+   struct Rebind {
+      typedef SellMatrix<ET,C,IT>  Other;  //!< The type of the other SellMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). Since SellMatrix does not provide submatrix views, it is not used in the
+       block-wise SMP assignments. The multiplications with dense vectors and column-major
+       dense matrices are parallelized chunk-wise instead. */
+   enum { smpAssignable = 0 };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+                                    explicit inline SellMatrix();
+                                    explicit inline SellMatrix( size_t m, size_t n );
+                                             inline SellMatrix( const SellMatrix& sm );
+   template< typename MT, bool SO >          inline SellMatrix( const Matrix<MT,SO>& m );
+   template< typename MT, bool SO > explicit inline SellMatrix( const Matrix<MT,SO>& m, size_t sigma );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~SellMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const;
+   inline Iterator       begin ( size_t i );
+   inline ConstIterator  begin ( size_t i ) const;
+   inline ConstIterator  cbegin( size_t i ) const;
+   inline Iterator       end   ( size_t i );
+   inline ConstIterator  end   ( size_t i ) const;
+   inline ConstIterator  cend  ( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+                                    inline SellMatrix& operator=( const SellMatrix& rhs );
+   template< typename MT, bool SO > inline SellMatrix& operator=( const Matrix<MT,SO>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+                              inline size_t      rows() const;
+                              inline size_t      columns() const;
+                              inline size_t      capacity() const;
+                              inline size_t      capacity( size_t i ) const;
+                              inline size_t      nonZeros() const;
+                              inline size_t      nonZeros( size_t i ) const;
+                              inline size_t      sigma() const;
+                              inline size_t      chunks() const;
+                              inline void        reset();
+                              inline void        clear();
+   template< typename Other > inline SellMatrix& scale( const Other& scalar );
+                              inline void        swap( SellMatrix& sm ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline Iterator      find      ( size_t i, size_t j );
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline Iterator      lowerBound( size_t i, size_t j );
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline Iterator      upperBound( size_t i, size_t j );
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+
+   inline bool canSMPAssign() const;
+
+   template< typename VT1, typename VT2 >
+   inline void assignProduct( VT1& y, const VT2& x, size_t first, size_t last ) const;
+
+   template< typename VT1, typename VT2 >
+   inline void addAssignProduct( VT1& y, const VT2& x, size_t first, size_t last ) const;
+
+   template< typename VT1, typename VT2 >
+   inline void subAssignProduct( VT1& y, const VT2& x, size_t first, size_t last ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Build functions*****************************************************************************
+   /*!\name Build functions */
+   //@{
+   template< typename MT >
+   inline typename EnableIf< IsSame<MT,ResultType> >::Type
+      build( const Matrix<MT,false>& m, size_t sigma );
+
+   template< typename MT, bool SO >
+   inline typename DisableIf< IsSame<MT,ResultType> >::Type
+      build( const Matrix<MT,SO>& m, size_t sigma );
+
+   void buildFrom( const ResultType& A, size_t sigma );
+   //@}
+   //**********************************************************************************************
+
+   //**Multiplication kernels**********************************************************************
+   /*!\name Multiplication kernels */
+   //@{
+   template< typename VT, typename ET >
+   inline typename DisableIf< UseVectorizedKernel<VT,ET> >::Type
+      computeChunk( size_t c, const VT& x, ET* y ) const;
+
+   template< typename VT, typename ET >
+   inline typename EnableIf< UseVectorizedKernel<VT,ET> >::Type
+      computeChunk( size_t c, const VT& x, ET* y ) const;
+
+                          static inline const Type* vectorData( const Type* x );
+                          static inline const Type* vectorData( Type* x );
+   template< typename VT > static inline const Type* vectorData( const VT& x );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t  m_;         //!< The current number of rows of the sparse matrix.
+   size_t  n_;         //!< The current number of columns of the sparse matrix.
+   size_t  sigma_;     //!< The size of the sorting window (a multiple of \a C).
+   size_t  chunks_;    //!< The number of chunks of \a C rows.
+   size_t  nonZeros_;  //!< The number of stored elements (without padding).
+   size_t  capacity_;  //!< The number of allocated elements (including padding).
+   size_t* offset_;    //!< The offsets of the first element of each chunk (chunks_+1 entries).
+   size_t* row_;       //!< The row stored in each chunk lane (chunks_*C entries).
+   size_t* slot_;      //!< The chunk lane of each row (m_ entries).
+   size_t* length_;    //!< The number of elements stored in each chunk lane (chunks_*C entries).
+   Type*   value_;     //!< The values of all chunks, including padding.
+   IT*     index_;     //!< The column indices of all chunks, including padding.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( Type );
+   BLAZE_STATIC_ASSERT( C > 0UL );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type, size_t C, typename IT >
+const Type SellMatrix<Type,C,IT>::zero_ = Type();
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for SellMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+inline SellMatrix<Type,C,IT>::SellMatrix()
+   : m_       ( 0UL )               // The current number of rows of the sparse matrix
+   , n_       ( 0UL )               // The current number of columns of the sparse matrix
+   , sigma_   ( 32UL*C )            // The size of the sorting window
+   , chunks_  ( 0UL )               // The number of chunks of C rows
+   , nonZeros_( 0UL )               // The number of stored elements
+   , capacity_( 0UL )               // The number of allocated elements
+   , offset_  ( new size_t[1UL] )   // The offsets of the first element of each chunk
+   , row_     ( NULL )              // The row stored in each chunk lane
+   , slot_    ( NULL )              // The chunk lane of each row
+   , length_  ( NULL )              // The number of elements stored in each chunk lane
+   , value_   ( NULL )              // The values of all chunks
+   , index_   ( NULL )              // The column indices of all chunks
+{
+   offset_[0] = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for an empty matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+//
+// The matrix is initialized to the zero matrix. Since the sparsity pattern of a SELL matrix
+// is fixed, no elements can be added to the matrix afterwards.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+inline SellMatrix<Type,C,IT>::SellMatrix( size_t m, size_t n )
+   : m_       ( m )                         // The current number of rows of the sparse matrix
+   , n_       ( n )                         // The current number of columns of the sparse matrix
+   , sigma_   ( 32UL*C )                    // The size of the sorting window
+   , chunks_  ( ( m + C - 1UL ) / C )       // The number of chunks of C rows
+   , nonZeros_( 0UL )                       // The number of stored elements
+   , capacity_( 0UL )                       // The number of allocated elements
+   , offset_  ( new size_t[chunks_+1UL] )   // The offsets of the first element of each chunk
+   , row_     ( new size_t[chunks_*C] )     // The row stored in each chunk lane
+   , slot_    ( new size_t[m] )             // The chunk lane of each row
+   , length_  ( new size_t[chunks_*C] )     // The number of elements stored in each chunk lane
+   , value_   ( NULL )                      // The values of all chunks
+   , index_   ( NULL )                      // The column indices of all chunks
+{
+   std::fill( offset_, offset_+chunks_+1UL, 0UL );
+   std::fill( length_, length_+chunks_*C, 0UL );
+
+   for( size_t i=0UL; i<chunks_*C; ++i ) {
+      row_[i] = ( i < m_ )?( i ):( m_ );
+   }
+   for( size_t i=0UL; i<m_; ++i ) {
+      slot_[i] = i;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for SellMatrix.
+//
+// \param sm Sparse matrix to be copied.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+inline SellMatrix<Type,C,IT>::SellMatrix( const SellMatrix& sm )
+   : m_       ( sm.m_ )                     // The current number of rows of the sparse matrix
+   , n_       ( sm.n_ )                     // The current number of columns of the sparse matrix
+   , sigma_   ( sm.sigma_ )                 // The size of the sorting window
+   , chunks_  ( sm.chunks_ )                // The number of chunks of C rows
+   , nonZeros_( sm.nonZeros_ )              // The number of stored elements
+   , capacity_( sm.capacity_ )              // The number of allocated elements
+   , offset_  ( new size_t[chunks_+1UL] )   // The offsets of the first element of each chunk
+   , row_     ( new size_t[chunks_*C] )     // The row stored in each chunk lane
+   , slot_    ( new size_t[m_] )            // The chunk lane of each row
+   , length_  ( new size_t[chunks_*C] )     // The number of elements stored in each chunk lane
+   , value_   ( NULL )                      // The values of all chunks
+   , index_   ( NULL )                      // The column indices of all chunks
+{
+   std::copy( sm.offset_, sm.offset_+chunks_+1UL, offset_ );
+   std::copy( sm.row_   , sm.row_   +chunks_*C  , row_    );
+   std::copy( sm.slot_  , sm.slot_  +m_         , slot_   );
+   std::copy( sm.length_, sm.length_+chunks_*C  , length_ );
+
+   if( capacity_ > 0UL ) {
+      value_ = allocate<Type>( capacity_ );
+      index_ = allocate<IT>( capacity_ );
+      std::copy( sm.value_, sm.value_+capacity_, value_ );
+      std::copy( sm.index_, sm.index_+capacity_, index_ );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m Matrix to be converted into the SELL format.
+//
+// This constructor converts the given matrix into the SELL format with the default size of the
+// sorting window (32 chunks). Matrices other than row-major compressed matrices of the same
+// element type are converted via an intermediate row-major compressed matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+template< typename MT    // Type of the foreign matrix
+        , bool SO >      // Storage order of the foreign matrix
+inline SellMatrix<Type,C,IT>::SellMatrix( const Matrix<MT,SO>& m )
+   : m_       ( 0UL )      // The current number of rows of the sparse matrix
+   , n_       ( 0UL )      // The current number of columns of the sparse matrix
+   , sigma_   ( 32UL*C )   // The size of the sorting window
+   , chunks_  ( 0UL )      // The number of chunks of C rows
+   , nonZeros_( 0UL )      // The number of stored elements
+   , capacity_( 0UL )      // The number of allocated elements
+   , offset_  ( NULL )     // The offsets of the first element of each chunk
+   , row_     ( NULL )     // The row stored in each chunk lane
+   , slot_    ( NULL )     // The chunk lane of each row
+   , length_  ( NULL )     // The number of elements stored in each chunk lane
+   , value_   ( NULL )     // The values of all chunks
+   , index_   ( NULL )     // The column indices of all chunks
+{
+   build( ~m, 32UL*C );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices with a custom sorting window.
+//
+// \param m Matrix to be converted into the SELL format.
+// \param sigma The size of the window within which the rows are sorted by their length.
+//
+// This constructor converts the given matrix into the SELL format. The rows are sorted by their
+// number of non-zero elements within windows of \a sigma rows, which is rounded up to the next
+// multiple of \a C. A window of \a C rows preserves the original order of the rows, a window
+// of at least \f$ M \f$ rows sorts all rows of the matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+template< typename MT    // Type of the foreign matrix
+        , bool SO >      // Storage order of the foreign matrix
+inline SellMatrix<Type,C,IT>::SellMatrix( const Matrix<MT,SO>& m, size_t sigma )
+   : m_       ( 0UL )      // The current number of rows of the sparse matrix
+   , n_       ( 0UL )      // The current number of columns of the sparse matrix
+   , sigma_   ( 32UL*C )   // The size of the sorting window
+   , chunks_  ( 0UL )      // The number of chunks of C rows
+   , nonZeros_( 0UL )      // The number of stored elements
+   , capacity_( 0UL )      // The number of allocated elements
+   , offset_  ( NULL )     // The offsets of the first element of each chunk
+   , row_     ( NULL )     // The row stored in each chunk lane
+   , slot_    ( NULL )     // The chunk lane of each row
+   , length_  ( NULL )     // The number of elements stored in each chunk lane
+   , value_   ( NULL )     // The values of all chunks
+   , index_   ( NULL )     // The column indices of all chunks
+{
+   build( ~m, sigma );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for SellMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+inline SellMatrix<Type,C,IT>::~SellMatrix()
+{
+   delete [] offset_;
+   delete [] row_;
+   delete [] slot_;
+   delete [] length_;
+   deallocate( value_ );
+   deallocate( index_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// The stored elements of row \a i are searched via a binary search.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+inline typename SellMatrix<Type,C,IT>::ConstReference
+   SellMatrix<Type,C,IT>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const ConstIterator pos( find( i, j ) );
+
+   if( pos == end( i ) )
+      return zero_;
+   else
+      return pos->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+inline typename SellMatrix<Type,C,IT>::Iterator SellMatrix<Type,C,IT>::begin( size_t i )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid SELL matrix row access index" );
+   const size_t pos( offset_[slot_[i]/C] + slot_[i]%C );
+   return Iterator( value_+pos, index_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+inline typename SellMatrix<Type,C,IT>::ConstIterator SellMatrix<Type,C,IT>::begin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid SELL matrix row access index" );
+   const size_t pos( offset_[slot_[i]/C] + slot_[i]%C );
+   return ConstIterator( value_+pos, index_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+inline typename SellMatrix<Type,C,IT>::ConstIterator SellMatrix<Type,C,IT>::cbegin( size_t i ) const
+{
+   return begin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+//
+// Note that the padding elements of the chunk are not part of the row.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+inline typename SellMatrix<Type,C,IT>::Iterator SellMatrix<Type,C,IT>::end( size_t i )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid SELL matrix row access index" );
+   const size_t pos( offset_[slot_[i]/C] + slot_[i]%C + length_[slot_[i]]*C );
+   return Iterator( value_+pos, index_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+//
+// Note that the padding elements of the chunk are not part of the row.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+inline typename SellMatrix<Type,C,IT>::ConstIterator SellMatrix<Type,C,IT>::end( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid SELL matrix row access index" );
+   const size_t pos( offset_[slot_[i]/C] + slot_[i]%C + length_[slot_[i]]*C );
+   return ConstIterator( value_+pos, index_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+inline typename SellMatrix<Type,C,IT>::ConstIterator SellMatrix<Type,C,IT>::cend( size_t i ) const
+{
+   return end( i );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for SellMatrix.
+//
+// \param rhs Sparse matrix to be copied.
+// \return Reference to the assigned sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+inline SellMatrix<Type,C,IT>& SellMatrix<Type,C,IT>::operator=( const SellMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   SellMatrix tmp( rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be converted into the SELL format.
+// \return Reference to the assigned sparse matrix.
+//
+// The matrix is rebuilt from the given matrix, using the current size of the sorting window.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO >      // Storage order of the right-hand side matrix
+inline SellMatrix<Type,C,IT>& SellMatrix<Type,C,IT>::operator=( const Matrix<MT,SO>& rhs )
+{
+   SellMatrix tmp( ~rhs, sigma_ );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+inline size_t SellMatrix<Type,C,IT>::rows() const
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+inline size_t SellMatrix<Type,C,IT>::columns() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of allocated elements of the sparse matrix, including padding.
+//
+// \return The capacity of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+inline size_t SellMatrix<Type,C,IT>::capacity() const
+{
+   return capacity_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of allocated elements of the specified row, including padding.
+//
+// \param i The index of the row.
+// \return The capacity of row \a i, i.e. the width of the chunk containing row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+inline size_t SellMatrix<Type,C,IT>::capacity( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   const size_t c( slot_[i] / C );
+   return ( offset_[c+1UL] - offset_[c] ) / C;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored elements in the sparse matrix.
+//
+// \return The number of stored elements in the sparse matrix (without padding).
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+inline size_t SellMatrix<Type,C,IT>::nonZeros() const
+{
+   return nonZeros_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored elements in the specified row.
+//
+// \param i The index of the row.
+// \return The number of stored elements of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+inline size_t SellMatrix<Type,C,IT>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return length_[slot_[i]];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the size of the window within which the rows are sorted by their length.
+//
+// \return The size of the sorting window.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+inline size_t SellMatrix<Type,C,IT>::sigma() const
+{
+   return sigma_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of chunks of the sparse matrix.
+//
+// \return The number of chunks of \a C rows.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+inline size_t SellMatrix<Type,C,IT>::chunks() const
+{
+   return chunks_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+//
+// This function removes all elements from the matrix. The dimensions of the matrix and the
+// size of the sorting window are preserved.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+inline void SellMatrix<Type,C,IT>::reset()
+{
+   SellMatrix tmp( m_, n_ );
+   tmp.sigma_ = sigma_;
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the sparse matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the sparse matrix is 0.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+inline void SellMatrix<Type,C,IT>::clear()
+{
+   SellMatrix tmp;
+   tmp.sigma_ = sigma_;
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of the sparse matrix by the scalar value \a scalar (\f$ A=B*s \f$).
+//
+// \param scalar The scalar value for the matrix scaling.
+// \return Reference to the sparse matrix.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , size_t C          // Number of rows per chunk
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the scalar value
+inline SellMatrix<Type,C,IT>& SellMatrix<Type,C,IT>::scale( const Other& scalar )
+{
+   for( size_t k=0UL; k<capacity_; ++k )
+      value_[k] *= scalar;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sparse matrices.
+//
+// \param sm The sparse matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+inline void SellMatrix<Type,C,IT>::swap( SellMatrix& sm ) /* throw() */
+{
+   std::swap( m_, sm.m_ );
+   std::swap( n_, sm.n_ );
+   std::swap( sigma_, sm.sigma_ );
+   std::swap( chunks_, sm.chunks_ );
+   std::swap( nonZeros_, sm.nonZeros_ );
+   std::swap( capacity_, sm.capacity_ );
+   std::swap( offset_, sm.offset_ );
+   std::swap( row_, sm.row_ );
+   std::swap( slot_, sm.slot_ );
+   std::swap( length_, sm.length_ );
+   std::swap( value_, sm.value_ );
+   std::swap( index_, sm.index_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+inline typename SellMatrix<Type,C,IT>::Iterator SellMatrix<Type,C,IT>::find( size_t i, size_t j )
+{
+   const Iterator pos( lowerBound( i, j ) );
+   const Iterator last( end( i ) );
+
+   if( pos != last && pos->index() == j )
+      return pos;
+   else return last;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+inline typename SellMatrix<Type,C,IT>::ConstIterator
+   SellMatrix<Type,C,IT>::find( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+   const ConstIterator last( end( i ) );
+
+   if( pos != last && pos->index() == j )
+      return pos;
+   else return last;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+inline typename SellMatrix<Type,C,IT>::Iterator
+   SellMatrix<Type,C,IT>::lowerBound( size_t i, size_t j )
+{
+   const ConstIterator pos( const_cast<const This&>( *this ).lowerBound( i, j ) );
+   const size_t k( pos - ConstIterator( value_, index_ ) );
+   return Iterator( value_+k*C, index_+k*C );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+inline typename SellMatrix<Type,C,IT>::ConstIterator
+   SellMatrix<Type,C,IT>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   const size_t  pos  ( offset_[slot_[i]/C] + slot_[i]%C );
+   const IT*     index( index_ + pos );
+
+   size_t first( 0UL );
+   size_t count( length_[slot_[i]] );
+
+   while( count > 0UL ) {
+      const size_t step( count / 2UL );
+      if( index[(first+step)*C] < j ) {
+         first += step + 1UL;
+         count -= step + 1UL;
+      }
+      else count = step;
+   }
+
+   return ConstIterator( value_+pos+first*C, index+first*C );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+inline typename SellMatrix<Type,C,IT>::Iterator
+   SellMatrix<Type,C,IT>::upperBound( size_t i, size_t j )
+{
+   const ConstIterator pos( const_cast<const This&>( *this ).upperBound( i, j ) );
+   const size_t k( pos - ConstIterator( value_, index_ ) );
+   return Iterator( value_+k*C, index_+k*C );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+inline typename SellMatrix<Type,C,IT>::ConstIterator
+   SellMatrix<Type,C,IT>::upperBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   const size_t  pos  ( offset_[slot_[i]/C] + slot_[i]%C );
+   const IT*     index( index_ + pos );
+
+   size_t first( 0UL );
+   size_t count( length_[slot_[i]] );
+
+   while( count > 0UL ) {
+      const size_t step( count / 2UL );
+      if( index[(first+step)*C] <= j ) {
+         first += step + 1UL;
+         count -= step + 1UL;
+      }
+      else count = step;
+   }
+
+   return ConstIterator( value_+pos+first*C, index+first*C );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , size_t C          // Number of rows per chunk
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the foreign expression
+inline bool SellMatrix<Type,C,IT>::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , size_t C          // Number of rows per chunk
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the foreign expression
+inline bool SellMatrix<Type,C,IT>::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+inline bool SellMatrix<Type,C,IT>::canSMPAssign() const
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Assignment of the product of a range of chunks and a dense vector
+//        (\f$ \vec{y}=A*\vec{x} \f$).
+//
+// \param y The target dense vector.
+// \param x The right-hand side dense vector or a pointer to its first element.
+// \param first The index of the first chunk.
+// \param last The index one past the last chunk.
+// \return void
+//
+// This function computes the elements of \a y that correspond to the rows of the chunks in
+// the range \f$[first..last)\f$. The right-hand side operand is either a dense column vector
+// or a pointer to the contiguously stored elements of a dense column vector. In case the SIMD
+// kernels are available and the right-hand side operand provides low-level data access, the
+// \a C rows of a chunk are computed in the lanes of SIMD vectors.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the sparse matrix
+        , size_t C        // Number of rows per chunk
+        , typename IT >   // Index type
+template< typename VT1    // Type of the target dense vector
+        , typename VT2 >  // Type of the right-hand side dense vector
+inline void
+   SellMatrix<Type,C,IT>::assignProduct( VT1& y, const VT2& x, size_t first, size_t last ) const
+{
+   BLAZE_INTERNAL_ASSERT( y.size() == m_     , "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( last     <= chunks_, "Invalid chunk range" );
+
+   typedef typename VT1::ElementType  ET;
+
+   ET tmp[C];
+
+   for( size_t c=first; c<last; ++c )
+   {
+      computeChunk( c, x, tmp );
+
+      const size_t* row( row_ + c*C );
+      const size_t  lanes( min( C, m_ - c*C ) );
+
+      for( size_t l=0UL; l<lanes; ++l )
+         y[row[l]] = tmp[l];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Addition assignment of the product of a range of chunks and a dense vector
+//        (\f$ \vec{y}+=A*\vec{x} \f$).
+//
+// \param y The target dense vector.
+// \param x The right-hand side dense vector or a pointer to its first element.
+// \param first The index of the first chunk.
+// \param last The index one past the last chunk.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the sparse matrix
+        , size_t C        // Number of rows per chunk
+        , typename IT >   // Index type
+template< typename VT1    // Type of the target dense vector
+        , typename VT2 >  // Type of the right-hand side dense vector
+inline void
+   SellMatrix<Type,C,IT>::addAssignProduct( VT1& y, const VT2& x, size_t first, size_t last ) const
+{
+   BLAZE_INTERNAL_ASSERT( y.size() == m_     , "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( last     <= chunks_, "Invalid chunk range" );
+
+   typedef typename VT1::ElementType  ET;
+
+   ET tmp[C];
+
+   for( size_t c=first; c<last; ++c )
+   {
+      computeChunk( c, x, tmp );
+
+      const size_t* row( row_ + c*C );
+      const size_t  lanes( min( C, m_ - c*C ) );
+
+      for( size_t l=0UL; l<lanes; ++l )
+         y[row[l]] += tmp[l];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Subtraction assignment of the product of a range of chunks and a dense vector
+//        (\f$ \vec{y}-=A*\vec{x} \f$).
+//
+// \param y The target dense vector.
+// \param x The right-hand side dense vector or a pointer to its first element.
+// \param first The index of the first chunk.
+// \param last The index one past the last chunk.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the sparse matrix
+        , size_t C        // Number of rows per chunk
+        , typename IT >   // Index type
+template< typename VT1    // Type of the target dense vector
+        , typename VT2 >  // Type of the right-hand side dense vector
+inline void
+   SellMatrix<Type,C,IT>::subAssignProduct( VT1& y, const VT2& x, size_t first, size_t last ) const
+{
+   BLAZE_INTERNAL_ASSERT( y.size() == m_     , "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( last     <= chunks_, "Invalid chunk range" );
+
+   typedef typename VT1::ElementType  ET;
+
+   ET tmp[C];
+
+   for( size_t c=first; c<last; ++c )
+   {
+      computeChunk( c, x, tmp );
+
+      const size_t* row( row_ + c*C );
+      const size_t  lanes( min( C, m_ - c*C ) );
+
+      for( size_t l=0UL; l<lanes; ++l )
+         y[row[l]] -= tmp[l];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BUILD FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Builds the SELL matrix from a row-major compressed matrix of the same element type.
+//
+// \param m The row-major compressed matrix.
+// \param sigma The size of the sorting window.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+template< typename MT >  // Type of the compressed matrix
+inline typename EnableIf< IsSame<MT,typename SellMatrix<Type,C,IT>::ResultType> >::Type
+   SellMatrix<Type,C,IT>::build( const Matrix<MT,false>& m, size_t sigma )
+{
+   buildFrom( ~m, sigma );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Builds the SELL matrix from an arbitrary matrix.
+//
+// \param m The matrix to be converted.
+// \param sigma The size of the sorting window.
+// \return void
+//
+// The matrix is converted via an intermediate row-major compressed matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+template< typename MT    // Type of the matrix
+        , bool SO >      // Storage order of the matrix
+inline typename DisableIf< IsSame<MT,typename SellMatrix<Type,C,IT>::ResultType> >::Type
+   SellMatrix<Type,C,IT>::build( const Matrix<MT,SO>& m, size_t sigma )
+{
+   const ResultType tmp( serial( ~m ) );
+   buildFrom( tmp, sigma );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Builds the SELL matrix from a row-major compressed matrix.
+//
+// \param A The row-major compressed matrix.
+// \param sigma The size of the sorting window.
+// \return void
+//
+// This function sorts the rows of the given matrix by their number of non-zero elements within
+// windows of \a sigma rows, groups the sorted rows into chunks of \a C rows and copies the
+// elements of each chunk in column-wise order. Each chunk is padded with zeros (with column
+// index 0) to the length of its longest row.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+void SellMatrix<Type,C,IT>::buildFrom( const ResultType& A, size_t sigma )
+{
+   typedef typename ResultType::ConstIterator  RowIterator;
+
+   BLAZE_INTERNAL_ASSERT( offset_ == NULL && value_ == NULL, "Matrix has already been built" );
+
+   BLAZE_USER_ASSERT( sizeof( IT ) >= sizeof( size_t ) || A.columns() <= 2147483647UL,
+                      "Too many columns for 32-bit gather instructions" );
+
+   m_      = A.rows();
+   n_      = A.columns();
+   sigma_  = ( sigma > C )?( ( ( sigma + C - 1UL ) / C ) * C ):( C );
+   chunks_ = ( m_ + C - 1UL ) / C;
+
+   offset_ = new size_t[chunks_+1UL];
+   row_    = new size_t[chunks_*C];
+   slot_   = new size_t[m_];
+   length_ = new size_t[chunks_*C];
+
+   // Sorting the rows by decreasing number of non-zero elements within the sigma-windows
+   for( size_t i=0UL; i<m_; ++i ) {
+      slot_[i] = A.nonZeros( i );
+      row_ [i] = i;
+   }
+
+   for( size_t i=0UL; i<m_; i+=sigma_ ) {
+      const size_t iend( min( i+sigma_, m_ ) );
+      std::stable_sort( row_+i, row_+iend, LongerRow( slot_ ) );
+   }
+
+   nonZeros_ = 0UL;
+
+   for( size_t s=0UL; s<chunks_*C; ++s ) {
+      if( s < m_ ) {
+         length_[s] = slot_[row_[s]];
+         nonZeros_ += length_[s];
+      }
+      else {
+         row_   [s] = m_;
+         length_[s] = 0UL;
+      }
+   }
+
+   for( size_t s=0UL; s<m_; ++s ) {
+      slot_[row_[s]] = s;
+   }
+
+   // Computing the chunk offsets
+   offset_[0] = 0UL;
+   for( size_t c=0UL; c<chunks_; ++c ) {
+      const size_t width( *std::max_element( length_+c*C, length_+(c+1UL)*C ) );
+      offset_[c+1UL] = offset_[c] + width*C;
+   }
+
+   capacity_ = offset_[chunks_];
+
+   if( capacity_ == 0UL )
+      return;
+
+   value_ = allocate<Type>( capacity_ );
+   index_ = allocate<IT>( capacity_ );
+
+   // Copying the elements chunk by chunk and padding all rows to the width of their chunk
+   for( size_t s=0UL; s<chunks_*C; ++s )
+   {
+      const size_t c( s / C );
+      const size_t width( ( offset_[c+1UL] - offset_[c] ) / C );
+
+      Type*   value( value_ + offset_[c] + s%C );
+      IT*     index( index_ + offset_[c] + s%C );
+      size_t  k( 0UL );
+
+      if( s < m_ ) {
+         const RowIterator end( A.end( row_[s] ) );
+         for( RowIterator element=A.begin( row_[s] ); element!=end; ++element, ++k ) {
+            value[k*C] = element->value();
+            index[k*C] = element->index();
+         }
+      }
+
+      for( ; k<width; ++k ) {
+         value[k*C] = Type();
+         index[k*C] = 0UL;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Default computation of the product of a single chunk and a dense vector.
+//
+// \param c The index of the chunk.
+// \param x The right-hand side dense vector or a pointer to its first element.
+// \param y The array for the \a C results of the chunk.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+template< typename VT    // Type of the right-hand side dense vector
+        , typename ET >  // Element type of the results
+inline typename DisableIf< typename SellMatrix<Type,C,IT>::template UseVectorizedKernel<VT,ET> >::Type
+   SellMatrix<Type,C,IT>::computeChunk( size_t c, const VT& x, ET* y ) const
+{
+   const size_t  width( ( offset_[c+1UL] - offset_[c] ) / C );
+   const Type*   value( value_ + offset_[c] );
+   const IT*     index( index_ + offset_[c] );
+
+   for( size_t l=0UL; l<C; ++l )
+      y[l] = ET();
+
+   for( size_t k=0UL; k<width; ++k, value+=C, index+=C ) {
+      for( size_t l=0UL; l<C; ++l )
+         y[l] += value[l] * x[index[l]];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SIMD computation of the product of a single chunk and a dense vector.
+//
+// \param c The index of the chunk.
+// \param x The right-hand side dense vector or a pointer to its first element.
+// \param y The array for the \a C results of the chunk.
+// \return void
+//
+// This function computes the \a C rows of a chunk in the lanes of \a C/ITT::size SIMD vectors.
+// The values of the chunk are loaded by aligned loads, the elements of the right-hand side
+// vector are gathered.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+template< typename VT    // Type of the right-hand side dense vector
+        , typename ET >  // Element type of the results
+inline typename EnableIf< typename SellMatrix<Type,C,IT>::template UseVectorizedKernel<VT,ET> >::Type
+   SellMatrix<Type,C,IT>::computeChunk( size_t c, const VT& x, ET* y ) const
+{
+   typedef typename ITT::Type  IntrinsicType;
+
+   enum { vectors = C / ITT::size };
+
+   const size_t  width( ( offset_[c+1UL] - offset_[c] ) / C );
+   const Type*   value( value_ + offset_[c] );
+   const IT*     index( index_ + offset_[c] );
+   const Type*   px( vectorData( x ) );
+
+   IntrinsicType xmm[vectors];
+
+   for( size_t k=0UL; k<width; ++k, value+=C, index+=C ) {
+      for( size_t q=0UL; q<vectors; ++q )
+         xmm[q] = fmadd( load( value+q*ITT::size ), gather( px, index+q*ITT::size ), xmm[q] );
+   }
+
+   for( size_t q=0UL; q<vectors; ++q )
+      storeu( y+q*ITT::size, xmm[q] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the given pointer to the elements of a dense vector.
+//
+// \param x Pointer to the first element of a dense vector.
+// \return Pointer to the first element of the dense vector.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+inline const Type* SellMatrix<Type,C,IT>::vectorData( const Type* x )
+{
+   return x;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the given pointer to the elements of a dense vector.
+//
+// \param x Pointer to the first element of a dense vector.
+// \return Pointer to the first element of the dense vector.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+inline const Type* SellMatrix<Type,C,IT>::vectorData( Type* x )
+{
+   return x;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the elements of the given dense vector.
+//
+// \param x The dense vector.
+// \return Pointer to the first element of the dense vector.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+template< typename VT >  // Type of the dense vector
+inline const Type* SellMatrix<Type,C,IT>::vectorData( const VT& x )
+{
+   return x.data();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SELLMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name SellMatrix operators */
+//@{
+template< typename Type, size_t C, typename IT >
+inline void reset( SellMatrix<Type,C,IT>& m );
+
+template< typename Type, size_t C, typename IT >
+inline void clear( SellMatrix<Type,C,IT>& m );
+
+template< typename Type, size_t C, typename IT >
+inline bool isDefault( const SellMatrix<Type,C,IT>& m );
+
+template< typename Type, size_t C, typename IT >
+inline void swap( SellMatrix<Type,C,IT>& a, SellMatrix<Type,C,IT>& b ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given SELL matrix.
+// \ingroup sell_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+inline void reset( SellMatrix<Type,C,IT>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given SELL matrix.
+// \ingroup sell_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+inline void clear( SellMatrix<Type,C,IT>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given SELL matrix is in default state.
+// \ingroup sell_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix is component-wise zero, \a false otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+inline bool isDefault( const SellMatrix<Type,C,IT>& m )
+{
+   typedef typename SellMatrix<Type,C,IT>::ConstIterator  ConstIterator;
+
+   for( size_t i=0UL; i<m.rows(); ++i ) {
+      for( ConstIterator element=m.begin(i); element!=m.end(i); ++element )
+         if( !isDefault( element->value() ) ) return false;
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two SELL matrices.
+// \ingroup sell_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , typename IT >  // Index type
+inline void swap( SellMatrix<Type,C,IT>& a, SellMatrix<Type,C,IT>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSELLMATRIX SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, size_t C, typename IT >
+struct IsSellMatrix< SellMatrix<T,C,IT> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,762 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/TripletBuilder.h
+//  \brief Implementation of a triplet builder for the bulk assembly of compressed matrices
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_TRIPLETBUILDER_H_
+#define _BLAZE_MATH_SPARSE_TRIPLETBUILDER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/smp/TripletBuilder.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Integral.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Unsigned.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  MERGE OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Merge operation for the summation of duplicate triplets.
+// \ingroup triplet_builder
+//
+// The SumDuplicates merge operation accumulates all triplets with the same row and column index
+// (as for instance required for the assembly of finite element matrices). It is the default
+// merge operation of the TripletBuilder class template.
+*/
+struct SumDuplicates
+{
+   //**Function call operator**********************************************************************
+   /*!\brief Merges two values with the same row and column index.
+   //
+   // \param target The current value of the matrix element.
+   // \param value The value of the subsequent duplicate triplet.
+   // \return The sum of both values.
+   */
+   template< typename T >
+   inline T operator()( const T& target, const T& value ) const {
+      return target + value;
+   }
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Merge operation for the replacement of duplicate triplets.
+// \ingroup triplet_builder
+//
+// The ReplaceDuplicates merge operation replaces the value of a matrix element by the value of
+// any subsequent triplet with the same row and column index, i.e. the last triplet wins.
+*/
+struct ReplaceDuplicates
+{
+   //**Function call operator**********************************************************************
+   /*!\brief Merges two values with the same row and column index.
+   //
+   // \param target The current value of the matrix element.
+   // \param value The value of the subsequent duplicate triplet.
+   // \return The value of the subsequent duplicate triplet.
+   */
+   template< typename T >
+   inline T operator()( const T& target, const T& value ) const {
+      UNUSED_PARAMETER( target );
+      return value;
+   }
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup triplet_builder TripletBuilder
+// \ingroup sparse_matrix
+*/
+/*!\brief Builder for the bulk assembly of compressed matrices from (i,j,v) triplets.
+// \ingroup triplet_builder
+//
+// The TripletBuilder class template collects the non-zero elements of a sparse matrix in
+// coordinate format (i.e. as (row,column,value) triplets in arbitrary order and possibly with
+// duplicates) and assembles a CompressedMatrix from them in a single pass. Filling a compressed
+// matrix out of order via the function call operator or the insert() function requires to shift
+// all subsequent elements on every insertion, which results in a quadratic complexity. In
+// contrast, the assembly via the triplet builder is linear in the number of triplets (plus the
+// sorting of the triplets within each row/column). The type of the elements and the type of
+// the stored indices can be specified via the two template parameters:
+
+   \code
+   template< typename Type, typename IT >
+   class TripletBuilder;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. TripletBuilder can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - IT  : specifies the unsigned integral type of the stored row and column indices. It has
+//          to match the index type of the assembled CompressedMatrix. The default value is
+//          \c size_t.
+//
+// The triplets are stored in one or several buffers. Each buffer may be filled by a different
+// thread without any synchronization, which for instance enables the parallel assembly of
+// finite element matrices:
+
+   \code
+   const size_t threads( omp_get_max_threads() );
+
+   blaze::TripletBuilder<double> builder( N, N, threads );
+
+   #pragma omp parallel for
+   for( int e=0; e<elements; ++e ) {
+      const size_t buffer( omp_get_thread_num() );
+      // ... Computing the element matrix Ke of element e
+      for( size_t a=0UL; a<nodes; ++a )
+         for( size_t b=0UL; b<nodes; ++b )
+            builder.add( buffer, node(e,a), node(e,b), Ke(a,b) );
+   }
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> A;
+   builder.build( A );  // Sums up all triplets with the same row and column index
+   \endcode
+
+// The build() function assembles the compressed matrix in three steps: First, the triplets of
+// all buffers are bucketed by row (or column in case of a column-major matrix). Second, the
+// triplets of each row/column are sorted by column (row) index and duplicate triplets are merged.
+// Third, the compressed matrix is created with the exact capacity of each row/column and filled.
+// The second and third step are executed in parallel in case the number of triplets exceeds the
+// SMP_TRIPLETASSIGN_THRESHOLD. All buckets preserve the order of the buffers and the order of
+// the triplets within each buffer. Therefore duplicate triplets are merged in a deterministic
+// order. Per default the values of duplicate triplets are summed up. Alternatively the values
+// can be replaced (i.e. the last triplet wins) or merged by means of a custom binary operation:
+
+   \code
+   builder.build( A, blaze::ReplaceDuplicates() );  // The last triplet wins
+   builder.build( A, Max() );                       // Custom merge operation: Max()( a, b )
+   \endcode
+
+// Note that merged elements are stored even if their value is zero (for instance since two
+// duplicate values cancel each other out), since the triplets define the sparsity structure of
+// the matrix. The triplets are not consumed by the build() function, i.e. the same triplets can
+// be used to assemble several matrices. The clear() function removes all triplets.
+*/
+template< typename Type           // Data type of the matrix elements
+        , typename IT = size_t >  // Index type
+class TripletBuilder : private NonCopyable
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef ValueIndexPair<Type,IT>  Element;  //!< Value-index-pair of a bucketed triplet.
+   //**********************************************************************************************
+
+   //**IndexLess struct definition*****************************************************************
+   /*!\brief Comparison of two bucketed triplets by their index.
+   */
+   struct IndexLess
+   {
+      inline bool operator()( const Element& a, const Element& b ) const {
+         return a.index() < b.index();
+      }
+   };
+   //**********************************************************************************************
+
+   //**Triplet struct definition*******************************************************************
+   /*!\brief Single (i,j,v) triplet.
+   */
+   struct Triplet
+   {
+      IT   row_;     //!< The row index of the triplet.
+      IT   column_;  //!< The column index of the triplet.
+      Type value_;   //!< The value of the triplet.
+   };
+   //**********************************************************************************************
+
+   //**Buffer struct definition********************************************************************
+   /*!\brief Triplet buffer of a single thread.
+   //
+   // The padding separates the bookkeeping data of the buffers of different threads in order
+   // to prevent false sharing between the threads.
+   */
+   struct Buffer
+   {
+      std::vector<Triplet> triplets_;     //!< The triplets of the buffer.
+      char                 padding_[64];  //!< Padding to the next buffer.
+   };
+   //**********************************************************************************************
+
+   //**SortKernel struct definition****************************************************************
+   /*!\brief Kernel for the sorting and merging of the triplets of a range of rows/columns.
+   //
+   // The merged elements of each row/column are stored at the beginning of its bucket.
+   */
+   template< typename OP >  // Type of the merge operation
+   struct SortKernel
+   {
+      inline SortKernel( Element* elements, const size_t* offsets, size_t* nonzeros,
+                         size_t size, OP op, bool parallel )
+         : elements_( elements )  // The bucketed triplets of all rows/columns
+         , offsets_ ( offsets  )  // The offsets of the first triplet of each row/column
+         , nonzeros_( nonzeros )  // The number of merged elements of each row/column
+         , size_    ( size     )  // The number of rows/columns
+         , op_      ( op       )  // The merge operation for duplicate triplets
+         , parallel_( parallel )  // Flag for the parallel execution of the kernel
+      {}
+
+      inline size_t size        () const { return size_;     }
+      inline bool   canSMPAssign() const { return parallel_; }
+
+      inline void operator()( size_t first, size_t last ) const {
+         for( size_t k=first; k<last; ++k )
+         {
+            Element* const begin( elements_ + offsets_[k]     );
+            Element* const end  ( elements_ + offsets_[k+1UL] );
+
+            if( begin == end ) continue;
+
+            sort( begin, end );
+
+            Element* target( begin );
+
+            for( Element* element=begin+1; element!=end; ++element ) {
+               if( element->index() == target->index() )
+                  target->value() = op_( target->value(), element->value() );
+               else
+                  *(++target) = *element;
+            }
+
+            nonzeros_[k] = target - begin + 1;
+         }
+      }
+
+      Element*      elements_;  //!< The bucketed triplets of all rows/columns.
+      const size_t* offsets_;   //!< The offsets of the first triplet of each row/column.
+      size_t*       nonzeros_;  //!< The number of merged elements of each row/column.
+      size_t        size_;      //!< The number of rows/columns.
+      OP            op_;        //!< The merge operation for duplicate triplets.
+      bool          parallel_;  //!< Flag for the parallel execution of the kernel.
+   };
+   //**********************************************************************************************
+
+   //**AssignKernel struct definition**************************************************************
+   /*!\brief Kernel for the assignment of the merged elements of a range of rows/columns.
+   //
+   // Since the capacity of each row/column of the target matrix exactly matches the number of
+   // merged elements, the rows/columns can be appended independently of each other.
+   */
+   template< bool SO >  // Storage order of the compressed matrix
+   struct AssignKernel
+   {
+      inline AssignKernel( CompressedMatrix<Type,SO,IT>& matrix, const Element* elements,
+                           const size_t* offsets, const size_t* nonzeros, bool parallel )
+         : matrix_  ( &matrix  )  // The target compressed matrix
+         , elements_( elements )  // The merged elements of all rows/columns
+         , offsets_ ( offsets  )  // The offsets of the first element of each row/column
+         , nonzeros_( nonzeros )  // The number of merged elements of each row/column
+         , parallel_( parallel )  // Flag for the parallel execution of the kernel
+      {}
+
+      inline size_t size        () const { return SO ? matrix_->columns() : matrix_->rows(); }
+      inline bool   canSMPAssign() const { return parallel_; }
+
+      inline void operator()( size_t first, size_t last ) const {
+         for( size_t k=first; k<last; ++k )
+         {
+            const Element* const begin( elements_ + offsets_[k] );
+            const Element* const end  ( begin + nonzeros_[k] );
+
+            for( const Element* element=begin; element!=end; ++element ) {
+               if( SO )
+                  matrix_->append( element->index(), k, element->value() );
+               else
+                  matrix_->append( k, element->index(), element->value() );
+            }
+         }
+      }
+
+      CompressedMatrix<Type,SO,IT>* matrix_;    //!< The target compressed matrix.
+      const Element*                elements_;  //!< The merged elements of all rows/columns.
+      const size_t*                 offsets_;   //!< The offset of the first element per row/column.
+      const size_t*                 nonzeros_;  //!< The number of merged elements per row/column.
+      bool                          parallel_;  //!< Flag for the parallel execution of the kernel.
+   };
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef TripletBuilder<Type,IT>  This;         //!< Type of this TripletBuilder instance.
+   typedef Type                     ElementType;  //!< Type of the matrix elements.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit TripletBuilder( size_t m, size_t n, size_t buffers = 1UL );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows   () const;
+   inline size_t columns() const;
+   inline size_t buffers() const;
+   inline size_t size   () const;
+   inline size_t size   ( size_t buffer ) const;
+   inline void   reserve( size_t buffer, size_t triplets );
+   inline void   clear  ();
+   //@}
+   //**********************************************************************************************
+
+   //**Insertion functions*************************************************************************
+   /*!\name Insertion functions */
+   //@{
+   inline void add( size_t i, size_t j, const Type& value );
+   inline void add( size_t buffer, size_t i, size_t j, const Type& value );
+   //@}
+   //**********************************************************************************************
+
+   //**Assembly functions**************************************************************************
+   /*!\name Assembly functions */
+   //@{
+   template< bool SO >
+   inline void build( CompressedMatrix<Type,SO,IT>& A ) const;
+
+   template< bool SO, typename OP >
+   void build( CompressedMatrix<Type,SO,IT>& A, OP op ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   static inline void sort( Element* first, Element* last );
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;                     //!< The number of rows of the assembled matrix.
+   size_t n_;                     //!< The number of columns of the assembled matrix.
+   std::vector<Buffer> buffers_;  //!< The triplet buffers.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_INTEGRAL_TYPE     ( IT );
+   BLAZE_CONSTRAINT_MUST_BE_UNSIGNED_TYPE     ( IT );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the assembly of a \f$ M \times N \f$ matrix.
+//
+// \param m The number of rows of the assembled matrix.
+// \param n The number of columns of the assembled matrix.
+// \param buffers The number of triplet buffers (for instance the number of threads).
+*/
+template< typename Type  // Data type of the matrix elements
+        , typename IT >  // Index type
+TripletBuilder<Type,IT>::TripletBuilder( size_t m, size_t n, size_t buffers )
+   : m_      ( m )        // The number of rows of the assembled matrix
+   , n_      ( n )        // The number of columns of the assembled matrix
+   , buffers_( buffers )  // The triplet buffers
+{
+   BLAZE_USER_ASSERT( m_ <= std::numeric_limits<IT>::max(), "Too many rows for index type"    );
+   BLAZE_USER_ASSERT( n_ <= std::numeric_limits<IT>::max(), "Too many columns for index type" );
+   BLAZE_USER_ASSERT( buffers > 0UL, "Invalid number of triplet buffers" );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows of the assembled matrix.
+//
+// \return The number of rows of the assembled matrix.
+*/
+template< typename Type  // Data type of the matrix elements
+        , typename IT >  // Index type
+inline size_t TripletBuilder<Type,IT>::rows() const
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of columns of the assembled matrix.
+//
+// \return The number of columns of the assembled matrix.
+*/
+template< typename Type  // Data type of the matrix elements
+        , typename IT >  // Index type
+inline size_t TripletBuilder<Type,IT>::columns() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of triplet buffers.
+//
+// \return The number of triplet buffers.
+*/
+template< typename Type  // Data type of the matrix elements
+        , typename IT >  // Index type
+inline size_t TripletBuilder<Type,IT>::buffers() const
+{
+   return buffers_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of triplets in all buffers.
+//
+// \return The total number of triplets.
+*/
+template< typename Type  // Data type of the matrix elements
+        , typename IT >  // Index type
+inline size_t TripletBuilder<Type,IT>::size() const
+{
+   size_t triplets( 0UL );
+   for( size_t b=0UL; b<buffers_.size(); ++b )
+      triplets += buffers_[b].triplets_.size();
+   return triplets;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of triplets in the specified buffer.
+//
+// \param buffer The index of the triplet buffer.
+// \return The number of triplets in the specified buffer.
+*/
+template< typename Type  // Data type of the matrix elements
+        , typename IT >  // Index type
+inline size_t TripletBuilder<Type,IT>::size( size_t buffer ) const
+{
+   BLAZE_USER_ASSERT( buffer < buffers_.size(), "Invalid buffer access index" );
+
+   return buffers_[buffer].triplets_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the specified buffer.
+//
+// \param buffer The index of the triplet buffer.
+// \param triplets The new minimum capacity of the buffer.
+// \return void
+//
+// This function increases the capacity of the specified buffer to at least \a triplets
+// triplets. The current triplets are preserved.
+*/
+template< typename Type  // Data type of the matrix elements
+        , typename IT >  // Index type
+inline void TripletBuilder<Type,IT>::reserve( size_t buffer, size_t triplets )
+{
+   BLAZE_USER_ASSERT( buffer < buffers_.size(), "Invalid buffer access index" );
+
+   buffers_[buffer].triplets_.reserve( triplets );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all triplets from all buffers.
+//
+// \return void
+//
+// This function removes all triplets from all buffers. The size of the assembled matrix and
+// the capacity of the buffers remain unchanged.
+*/
+template< typename Type  // Data type of the matrix elements
+        , typename IT >  // Index type
+inline void TripletBuilder<Type,IT>::clear()
+{
+   for( size_t b=0UL; b<buffers_.size(); ++b )
+      buffers_[b].triplets_.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Stable sorting of a range of bucketed triplets by their index.
+//
+// \param first Pointer to the first triplet of the range.
+// \param last Pointer one past the last triplet of the range.
+// \return void
+//
+// Short ranges are sorted in place by insertion sort in order to avoid the allocation of the
+// temporary buffer of \c std::stable_sort() for every row/column.
+*/
+template< typename Type  // Data type of the matrix elements
+        , typename IT >  // Index type
+inline void TripletBuilder<Type,IT>::sort( Element* first, Element* last )
+{
+   if( last - first > 32 ) {
+      std::stable_sort( first, last, IndexLess() );
+      return;
+   }
+
+   for( Element* element=first+1; element<last; ++element )
+   {
+      if( element->index() >= (element-1)->index() ) continue;
+
+      const Element tmp( *element );
+      Element* pos( element );
+
+      do {
+         *pos = *(pos-1);
+         --pos;
+      }
+      while( pos != first && tmp.index() < (pos-1)->index() );
+
+      *pos = tmp;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INSERTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Adding a triplet to the first buffer.
+//
+// \param i The row index of the triplet. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the triplet. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the triplet.
+// \return void
+*/
+template< typename Type  // Data type of the matrix elements
+        , typename IT >  // Index type
+inline void TripletBuilder<Type,IT>::add( size_t i, size_t j, const Type& value )
+{
+   add( 0UL, i, j, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Adding a triplet to the specified buffer.
+//
+// \param buffer The index of the triplet buffer.
+// \param i The row index of the triplet. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the triplet. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the triplet.
+// \return void
+//
+// This function adds the given triplet to the specified buffer. Different buffers can be
+// filled concurrently by different threads. However, each single buffer must not be filled
+// by several threads at the same time.
+*/
+template< typename Type  // Data type of the matrix elements
+        , typename IT >  // Index type
+inline void TripletBuilder<Type,IT>::add( size_t buffer, size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( buffer < buffers_.size(), "Invalid buffer access index" );
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
+
+   const Triplet triplet = { IT( i ), IT( j ), value };
+   buffers_[buffer].triplets_.push_back( triplet );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSEMBLY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Assembly of a compressed matrix from all triplets.
+//
+// \param A The compressed matrix to be assembled.
+// \return void
+//
+// This function assembles the given compressed matrix from the triplets of all buffers. The
+// matrix is resized to \f$ M \times N \f$ and all previous elements are discarded. The values
+// of all triplets with the same row and column index are summed up.
+*/
+template< typename Type  // Data type of the matrix elements
+        , typename IT >  // Index type
+template< bool SO >      // Storage order of the compressed matrix
+inline void TripletBuilder<Type,IT>::build( CompressedMatrix<Type,SO,IT>& A ) const
+{
+   build( A, SumDuplicates() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assembly of a compressed matrix from all triplets with a custom merge operation.
+//
+// \param A The compressed matrix to be assembled.
+// \param op The merge operation for triplets with the same row and column index.
+// \return void
+//
+// This function assembles the given compressed matrix from the triplets of all buffers. The
+// matrix is resized to \f$ M \times N \f$ and all previous elements are discarded. Triplets
+// with the same row and column index are merged in the order of the buffers and the order of
+// the triplets within each buffer via \a op: The first triplet initializes the element, each
+// subsequent triplet updates the element to \a op( element, value ).
+*/
+template< typename Type  // Data type of the matrix elements
+        , typename IT >  // Index type
+template< bool SO        // Storage order of the compressed matrix
+        , typename OP >  // Type of the merge operation
+void TripletBuilder<Type,IT>::build( CompressedMatrix<Type,SO,IT>& A, OP op ) const
+{
+   const size_t major( SO ? n_ : m_ );
+   const size_t total( size() );
+   const bool parallel( total >= getThreshold( smpTripletAssignThreshold ) );
+
+   // Counting the triplets of each row/column
+   std::vector<size_t> offsets( major+1UL, 0UL );
+
+   for( size_t b=0UL; b<buffers_.size(); ++b ) {
+      const std::vector<Triplet>& triplets( buffers_[b].triplets_ );
+      for( size_t t=0UL; t<triplets.size(); ++t )
+         ++offsets[ ( SO ? triplets[t].column_ : triplets[t].row_ ) + 1UL ];
+   }
+
+   for( size_t k=0UL; k<major; ++k ) {
+      offsets[k+1UL] += offsets[k];
+   }
+
+   // Bucketing the triplets by row/column in the order of the buffers
+   std::vector<Element> elements( total );
+   std::vector<size_t> positions( offsets.begin(), offsets.end()-1 );
+
+   for( size_t b=0UL; b<buffers_.size(); ++b ) {
+      const std::vector<Triplet>& triplets( buffers_[b].triplets_ );
+      for( size_t t=0UL; t<triplets.size(); ++t ) {
+         const Triplet& triplet( triplets[t] );
+         const size_t k( SO ? triplet.column_ : triplet.row_ );
+         elements[positions[k]++] = Element( triplet.value_, SO ? triplet.row_ : triplet.column_ );
+      }
+   }
+
+   // Sorting and merging the triplets of each row/column
+   std::vector<size_t> nonzeros( major, 0UL );
+
+   if( total > 0UL ) {
+      smpTripletAssign( SortKernel<OP>( &elements[0], &offsets[0], &nonzeros[0],
+                                        major, op, parallel ) );
+   }
+
+   // Assembling the compressed matrix with the exact capacity of each row/column
+   CompressedMatrix<Type,SO,IT> tmp( m_, n_, nonzeros );
+
+   if( total > 0UL ) {
+      smpTripletAssign( AssignKernel<SO>( tmp, &elements[0], &offsets[0], &nonzeros[0],
+                                          parallel ) );
+   }
+
+   A.swap( tmp );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
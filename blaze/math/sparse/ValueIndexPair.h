@@ -43,8 +43,10 @@
 #include <blaze/math/sparse/SparseElement.h>
 #include <blaze/math/typetraits/IsSparseElement.h>
 #include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Integral.h>
 #include <blaze/util/constraints/Pointer.h>
 #include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Unsigned.h>
 #include <blaze/util/constraints/Volatile.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
@@ -64,9 +66,13 @@ namespace blaze {
 // \ingroup math
 //
 // The ValueIndexPair class represents a single index-value-pair of a sparse vector or sparse
-// matrix.
+// matrix. The second template parameter specifies the unsigned integral type that is used to
+// store the index. By default the index is stored as \a size_t, but a narrower type (as for
+// instance \a unsigned \a int) can be used to reduce the memory footprint of a sparse element.
+// Independent of the storage type, the index() function always returns a \a size_t value.
 */
-template< typename Type >  // Type of the value element
+template< typename Type             // Type of the value element
+        , typename IT = size_t >    // Type of the index element
 class ValueIndexPair : private SparseElement
 {
  public:
@@ -120,15 +126,15 @@ class ValueIndexPair : private SparseElement
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   Type   value_;  //!< Value of the value-index-pair.
-   size_t index_;  //!< Index of the value-index-pair.
+   Type value_;  //!< Value of the value-index-pair.
+   IT   index_;  //!< Index of the value-index-pair.
    //@}
    //**********************************************************************************************
 
  private:
    //**Friend declarations*************************************************************************
    /*! \cond BLAZE_INTERNAL */
-   template< typename Other > friend class ValueIndexPair;
+   template< typename Other, typename OtherIT > friend class ValueIndexPair;
    /*! \endcond */
    //**********************************************************************************************
 
@@ -138,6 +144,8 @@ class ValueIndexPair : private SparseElement
    BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
    BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_INTEGRAL_TYPE     ( IT );
+   BLAZE_CONSTRAINT_MUST_BE_UNSIGNED_TYPE     ( IT );
    /*! \endcond */
    //**********************************************************************************************
 };
@@ -155,8 +163,9 @@ class ValueIndexPair : private SparseElement
 //*************************************************************************************************
 /*!\brief Default constructor for value-index-pairs.
 */
-template< typename Type >  // Type of the value element
-inline ValueIndexPair<Type>::ValueIndexPair()
+template< typename Type  // Type of the value element
+        , typename IT >  // Type of the index element
+inline ValueIndexPair<Type,IT>::ValueIndexPair()
    : value_()  // Value of the value-index-pair
    , index_()  // Index of the value-index-pair
 {}
@@ -169,8 +178,9 @@ inline ValueIndexPair<Type>::ValueIndexPair()
 // \param v The value of the value-index-pair.
 // \param i The index of the value-index-pair.
 */
-template< typename Type >  // Type of the value element
-inline ValueIndexPair<Type>::ValueIndexPair( const Type& v, size_t i )
+template< typename Type  // Type of the value element
+        , typename IT >  // Type of the index element
+inline ValueIndexPair<Type,IT>::ValueIndexPair( const Type& v, size_t i )
    : value_( v )  // Value of the value-index-pair
    , index_( i )  // Index of the value-index-pair
 {}
@@ -195,10 +205,11 @@ inline ValueIndexPair<Type>::ValueIndexPair( const Type& v, size_t i )
 // \a Other data type qualifies as value-index-pair type in case it provides a value() and an
 // index() member function.
 */
-template< typename Type >   // Type of the value element
+template< typename Type     // Type of the value element
+        , typename IT >     // Type of the index element
 template< typename Other >  // Data type of the right-hand side value-index-pair
-inline typename EnableIf< IsSparseElement<Other>, ValueIndexPair<Type>& >::Type
-   ValueIndexPair<Type>::operator=( const Other& rhs )
+inline typename EnableIf< IsSparseElement<Other>, ValueIndexPair<Type,IT>& >::Type
+   ValueIndexPair<Type,IT>::operator=( const Other& rhs )
 {
    value_ = rhs.value();
    index_ = rhs.index();
@@ -213,10 +224,11 @@ inline typename EnableIf< IsSparseElement<Other>, ValueIndexPair<Type>& >::Type
 // \param v The new value-index-pair value.
 // \return Reference to the assigned value-index-pair.
 */
-template< typename Type >   // Type of the value element
+template< typename Type     // Type of the value element
+        , typename IT >     // Type of the index element
 template< typename Other >  // Data type of the right-hand side value
-inline typename DisableIf< IsSparseElement<Other>, ValueIndexPair<Type>& >::Type
-   ValueIndexPair<Type>::operator=( const Other& v )
+inline typename DisableIf< IsSparseElement<Other>, ValueIndexPair<Type,IT>& >::Type
+   ValueIndexPair<Type,IT>::operator=( const Other& v )
 {
    value_ = v;
    return *this;
@@ -230,9 +242,10 @@ inline typename DisableIf< IsSparseElement<Other>, ValueIndexPair<Type>& >::Type
 // \param v The right-hand side value to be added to the value-index-pair value.
 // \return Reference to the assigned value-index-pair.
 */
-template< typename Type >   // Type of the value element
+template< typename Type     // Type of the value element
+        , typename IT >     // Type of the index element
 template< typename Other >  // Data type of the right-hand side value
-inline ValueIndexPair<Type>& ValueIndexPair<Type>::operator+=( const Other& v )
+inline ValueIndexPair<Type,IT>& ValueIndexPair<Type,IT>::operator+=( const Other& v )
 {
    value_ += v;
    return *this;
@@ -246,9 +259,10 @@ inline ValueIndexPair<Type>& ValueIndexPair<Type>::operator+=( const Other& v )
 // \param v The right-hand side value to be subtracted from the value-index-pair value.
 // \return Reference to the assigned value-index-pair.
 */
-template< typename Type >   // Type of the value element
+template< typename Type     // Type of the value element
+        , typename IT >     // Type of the index element
 template< typename Other >  // Data type of the right-hand side value
-inline ValueIndexPair<Type>& ValueIndexPair<Type>::operator-=( const Other& v )
+inline ValueIndexPair<Type,IT>& ValueIndexPair<Type,IT>::operator-=( const Other& v )
 {
    value_ -= v;
    return *this;
@@ -262,9 +276,10 @@ inline ValueIndexPair<Type>& ValueIndexPair<Type>::operator-=( const Other& v )
 // \param v The right-hand side value for the multiplication.
 // \return Reference to the assigned value-index-pair.
 */
-template< typename Type >   // Type of the value element
+template< typename Type     // Type of the value element
+        , typename IT >     // Type of the index element
 template< typename Other >  // Data type of the right-hand side value
-inline ValueIndexPair<Type>& ValueIndexPair<Type>::operator*=( const Other& v )
+inline ValueIndexPair<Type,IT>& ValueIndexPair<Type,IT>::operator*=( const Other& v )
 {
    value_ *= v;
    return *this;
@@ -278,9 +293,10 @@ inline ValueIndexPair<Type>& ValueIndexPair<Type>::operator*=( const Other& v )
 // \param v The right-hand side value for the division
 // \return Reference to the assigned value-index-pair.
 */
-template< typename Type >   // Type of the value element
+template< typename Type     // Type of the value element
+        , typename IT >     // Type of the index element
 template< typename Other >  // Data type of the right-hand side value
-inline ValueIndexPair<Type>& ValueIndexPair<Type>::operator/=( const Other& v )
+inline ValueIndexPair<Type,IT>& ValueIndexPair<Type,IT>::operator/=( const Other& v )
 {
    value_ /= v;
    return *this;
@@ -301,8 +317,9 @@ inline ValueIndexPair<Type>& ValueIndexPair<Type>::operator/=( const Other& v )
 //
 // \return The current value of the value-index-pair.
 */
-template< typename Type >  // Type of the value element
-inline typename ValueIndexPair<Type>::Reference ValueIndexPair<Type>::value()
+template< typename Type  // Type of the value element
+        , typename IT >  // Type of the index element
+inline typename ValueIndexPair<Type,IT>::Reference ValueIndexPair<Type,IT>::value()
 {
    return value_;
 }
@@ -314,8 +331,9 @@ inline typename ValueIndexPair<Type>::Reference ValueIndexPair<Type>::value()
 //
 // \return The current value of the value-index-pair.
 */
-template< typename Type >  // Type of the value element
-inline typename ValueIndexPair<Type>::ConstReference ValueIndexPair<Type>::value() const
+template< typename Type  // Type of the value element
+        , typename IT >  // Type of the index element
+inline typename ValueIndexPair<Type,IT>::ConstReference ValueIndexPair<Type,IT>::value() const
 {
    return value_;
 }
@@ -327,8 +345,9 @@ inline typename ValueIndexPair<Type>::ConstReference ValueIndexPair<Type>::value
 //
 // \return The current index of the value-index-pair.
 */
-template< typename Type >  // Type of the value element
-inline typename ValueIndexPair<Type>::IndexType ValueIndexPair<Type>::index() const
+template< typename Type  // Type of the value element
+        , typename IT >  // Type of the index element
+inline typename ValueIndexPair<Type,IT>::IndexType ValueIndexPair<Type,IT>::index() const
 {
    return index_;
 }
@@ -0,0 +1,84 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/traits/IndexTrait.h
+//  \brief Header file for the index type trait
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+#ifndef _BLAZE_MATH_TRAITS_INDEXTRAIT_H_
+#define _BLAZE_MATH_TRAITS_INDEXTRAIT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/mpl/Bool.h>
+#include <blaze/util/mpl/If.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Evaluation of the index type of an operation between two sparse data structures.
+// \ingroup math_traits
+//
+// Via this type trait it is possible to evaluate the index type that is used to store the
+// indices of the result of an operation between two sparse vectors or matrices with the index
+// types \a IT1 and \a IT2. The nested type \a Type corresponds to the wider of the two given
+// index types. In case both types have the same size, \a Type is set to \a IT1.
+
+   \code
+   blaze::IndexTrait< unsigned int, unsigned int >::Type  // Results in 'unsigned int'
+   blaze::IndexTrait< unsigned int, size_t       >::Type  // Results in 'size_t'
+   blaze::IndexTrait< size_t      , unsigned int >::Type  // Results in 'size_t'
+   \endcode
+*/
+template< typename IT1    // Index type of the left-hand side operand
+        , typename IT2 >  // Index type of the right-hand side operand
+struct IndexTrait
+{
+ public:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   typedef typename If< Bool< ( sizeof(IT1) < sizeof(IT2) ) >, IT2, IT1 >::Type  Type;
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,113 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/typetraits/BlockSize.h
+//  \brief Header file for the BlockSize type trait
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_TYPETRAITS_BLOCKSIZE_H_
+#define _BLAZE_MATH_TYPETRAITS_BLOCKSIZE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/mpl/SizeT.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compile time evaluation of the number of unknowns per block of a complementarity problem.
+// \ingroup math_type_traits
+//
+// The BlockSize type trait evaluates the number of unknowns that form a block of the given
+// complementarity problem type at compile time. In case of a contact LCP, the normal and the
+// two frictional unknowns of a contact form a block and \a value is set to 3. In all other
+// cases every unknown forms a block of its own and \a value is set to 1.
+
+   \code
+   blaze::BlockSize< blaze::LCP >::value         // Evaluates to 1
+   blaze::BlockSize< blaze::BoxLCP >::value      // Evaluates to 1
+   blaze::BlockSize< blaze::ContactLCP >::value  // Evaluates to 3
+   \endcode
+*/
+template< typename T >
+struct BlockSize : public SizeT<1UL>
+{};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the BlockSize type trait for const types.
+// \ingroup math_type_traits
+*/
+template< typename T >
+struct BlockSize< const T > : public SizeT< BlockSize<T>::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the BlockSize type trait for volatile types.
+// \ingroup math_type_traits
+*/
+template< typename T >
+struct BlockSize< volatile T > : public SizeT< BlockSize<T>::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the BlockSize type trait for cv qualified types.
+// \ingroup math_type_traits
+*/
+template< typename T >
+struct BlockSize< const volatile T > : public SizeT< BlockSize<T>::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
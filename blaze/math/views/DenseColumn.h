@@ -1677,7 +1677,7 @@ template< typename MT  // Type of the dense matrix
         , bool SF >    // Symmetry flag
 inline bool DenseColumn<MT,SO,SF>::canSMPAssign() const
 {
-   return ( size() > SMP_DVECASSIGN_THRESHOLD );
+   return ( size() > getThreshold( smpDVecAssignThreshold ) );
 }
 //*************************************************************************************************
 
@@ -3788,7 +3788,7 @@ inline bool DenseColumn<MT,false,false>::isAligned() const
 template< typename MT >  // Type of the dense matrix
 inline bool DenseColumn<MT,false,false>::canSMPAssign() const
 {
-   return ( size() > SMP_DVECASSIGN_THRESHOLD );
+   return ( size() > getThreshold( smpDVecAssignThreshold ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -5387,7 +5387,7 @@ inline bool DenseColumn<MT,false,true>::isAligned() const
 template< typename MT >  // Type of the dense matrix
 inline bool DenseColumn<MT,false,true>::canSMPAssign() const
 {
-   return ( size() > SMP_DVECASSIGN_THRESHOLD );
+   return ( size() > getThreshold( smpDVecAssignThreshold ) );
 }
 /*! \endcond */
 //*************************************************************************************************
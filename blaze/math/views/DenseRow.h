@@ -1677,7 +1677,7 @@ template< typename MT  // Type of the dense matrix
         , bool SF >    // Symmetry flag
 inline bool DenseRow<MT,SO,SF>::canSMPAssign() const
 {
-   return ( size() > SMP_DVECASSIGN_THRESHOLD );
+   return ( size() > getThreshold( smpDVecAssignThreshold ) );
 }
 //*************************************************************************************************
 
@@ -3778,7 +3778,7 @@ inline bool DenseRow<MT,false,false>::isAligned() const
 template< typename MT >  // Type of the dense matrix
 inline bool DenseRow<MT,false,false>::canSMPAssign() const
 {
-   return ( size() > SMP_DVECASSIGN_THRESHOLD );
+   return ( size() > getThreshold( smpDVecAssignThreshold ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -5373,7 +5373,7 @@ inline bool DenseRow<MT,false,true>::isAligned() const
 template< typename MT >  // Type of the dense matrix
 inline bool DenseRow<MT,false,true>::canSMPAssign() const
 {
-   return ( size() > SMP_DVECASSIGN_THRESHOLD );
+   return ( size() > getThreshold( smpDVecAssignThreshold ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3109,7 +3109,7 @@ template< typename MT  // Type of the dense matrix
         , bool SO >    // Storage order
 inline bool DenseSubmatrix<MT,AF,SO>::canSMPAssign() const
 {
-   return ( rows() > SMP_DMATASSIGN_THRESHOLD );
+   return ( rows() > getThreshold( smpDMatAssignThreshold ) );
 }
 //*************************************************************************************************
 
@@ -6450,7 +6450,7 @@ inline bool DenseSubmatrix<MT,unaligned,true>::isAligned() const
 template< typename MT >  // Type of the dense matrix
 inline bool DenseSubmatrix<MT,unaligned,true>::canSMPAssign() const
 {
-   return ( columns() > SMP_DMATASSIGN_THRESHOLD );
+   return ( columns() > getThreshold( smpDMatAssignThreshold ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -9459,7 +9459,7 @@ inline bool DenseSubmatrix<MT,aligned,false>::isAligned() const
 template< typename MT >  // Type of the dense matrix
 inline bool DenseSubmatrix<MT,aligned,false>::canSMPAssign() const
 {
-   return ( rows() > SMP_DMATASSIGN_THRESHOLD );
+   return ( rows() > getThreshold( smpDMatAssignThreshold ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -12413,7 +12413,7 @@ inline bool DenseSubmatrix<MT,aligned,true>::isAligned() const
 template< typename MT >  // Type of the dense matrix
 inline bool DenseSubmatrix<MT,aligned,true>::canSMPAssign() const
 {
-   return ( columns() > SMP_DMATASSIGN_THRESHOLD );
+   return ( columns() > getThreshold( smpDMatAssignThreshold ) );
 }
 /*! \endcond */
 //*************************************************************************************************
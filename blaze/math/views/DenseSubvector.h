@@ -1745,7 +1745,7 @@ template< typename VT  // Type of the dense vector
         , bool TF >    // Transpose flag
 inline bool DenseSubvector<VT,AF,TF>::canSMPAssign() const
 {
-   return ( size() > SMP_DVECASSIGN_THRESHOLD );
+   return ( size() > getThreshold( smpDVecAssignThreshold ) );
 }
 //*************************************************************************************************
 
@@ -3343,7 +3343,7 @@ template< typename VT  // Type of the dense vector
         , bool TF >    // Transpose flag
 inline bool DenseSubvector<VT,aligned,TF>::canSMPAssign() const
 {
-   return ( size() > SMP_DVECASSIGN_THRESHOLD );
+   return ( size() > getThreshold( smpDVecAssignThreshold ) );
 }
 /*! \endcond */
 //*************************************************************************************************
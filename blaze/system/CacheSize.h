@@ -68,6 +68,8 @@
 namespace {
 
 BLAZE_STATIC_ASSERT( blaze::cacheSize > 100000UL && blaze::cacheSize < 100000000UL );
+BLAZE_STATIC_ASSERT( blaze::l1CacheSize > 1000UL && blaze::l1CacheSize < 10000000UL );
+BLAZE_STATIC_ASSERT( blaze::l2CacheSize > 10000UL && blaze::l2CacheSize < 100000000UL );
 
 }
 /*! \endcond */
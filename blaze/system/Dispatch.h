@@ -0,0 +1,91 @@
+//=================================================================================================
+/*!
+//  \file blaze/system/Dispatch.h
+//  \brief System settings for the runtime instruction set dispatch
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_SYSTEM_DISPATCH_H_
+#define _BLAZE_SYSTEM_DISPATCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/config/Dispatch.h>
+#include <blaze/system/Vectorization.h>
+
+
+
+
+//=================================================================================================
+//
+//  DISPATCH MODE CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the dispatch mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the dispatch mode. In case the dispatch mode is
+// enabled, the performance critical kernels of the Blaze library are additionally compiled for
+// the AVX, AVX2/FMA, and AVX-512 instruction sets and selected at runtime depending on the
+// capabilities of the executing CPU (see blaze::getInstructionSet()). The dispatch mode is
+// enabled in case the runtime dispatch is activated (see the BLAZE_USE_DISPATCH switch in the
+// <tt><blaze/config/Dispatch.h></tt> configuration file), the vectorization is enabled, the
+// target platform is an x86 platform, and the compiler supports function specific instruction
+// set attributes (GCC 5 or newer and Clang). Since there is no more powerful instruction set to
+// dispatch to, the dispatch mode is disabled in case AVX-512 or MIC is selected at compile time.
+*/
+#if BLAZE_USE_DISPATCH && BLAZE_USE_VECTORIZATION && !BLAZE_AVX512F_MODE && !BLAZE_MIC_MODE && \
+    ( defined(__x86_64__) || defined(__i386__) ) && \
+    ( defined(__clang__) || ( defined(__GNUC__) && __GNUC__ >= 5 && !defined(__INTEL_COMPILER) ) )
+#  define BLAZE_DISPATCH_MODE 1
+#else
+#  define BLAZE_DISPATCH_MODE 0
+#endif
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DISPATCH INCLUDE FILE CONFIGURATION
+//
+//=================================================================================================
+
+#if BLAZE_DISPATCH_MODE
+#  include <immintrin.h>
+#endif
+
+#endif
@@ -123,4 +123,32 @@
 #endif
 //*************************************************************************************************
 
+
+
+
+//=================================================================================================
+//
+//  WORK-STEALING PARALLEL MODE CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the work-stealing scheduler of the thread parallelization.
+// \ingroup system
+//
+// This compilation switch enables/disables the work-stealing scheduler for the C++11 and Boost
+// thread-based parallelizations. In case the \c BLAZE_USE_WORK_STEALING command line argument
+// is specified in combination with either \c BLAZE_USE_CPP_THREADS or \c BLAZE_USE_BOOST_THREADS
+// all tasks are scheduled via per-thread, lock-free work-stealing deques instead of a single
+// task queue. Additionally, SMP assignments may be nested in this mode. The switch has no
+// effect in case the OpenMP-based parallelization is active.
+*/
+#if !BLAZE_OPENMP_PARALLEL_MODE && defined(BLAZE_USE_WORK_STEALING) && \
+    ( BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE )
+#define BLAZE_WORK_STEALING_PARALLEL_MODE 1
+#else
+#define BLAZE_WORK_STEALING_PARALLEL_MODE 0
+#endif
+//*************************************************************************************************
+
 #endif
@@ -0,0 +1,63 @@
+//=================================================================================================
+/*!
+//  \file blaze/system/Standard.h
+//  \brief System settings for the supported C++ language standard
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_SYSTEM_STANDARD_H_
+#define _BLAZE_SYSTEM_STANDARD_H_
+
+
+//=================================================================================================
+//
+//  C++11 LANGUAGE MODE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for C++11 language features.
+// \ingroup system
+//
+// This compilation switch indicates whether the compiler supports the C++11 language standard.
+// In case C++11 is available (i.e. in case the \c __cplusplus macro indicates C++11 or in case
+// of Visual Studio 2015 or later), the Blaze library additionally provides C++11 features such
+// as move constructors and move assignment operators for its resizable data structures. Since
+// these are declared \c noexcept, earlier versions of Visual Studio are compiled in C++98 mode.
+// In C++98 mode all data structures behave exactly as before.
+*/
+#if __cplusplus >= 201103L || ( defined(_MSC_VER) && _MSC_VER >= 1900 )
+#define BLAZE_CPP11_MODE 1
+#else
+#define BLAZE_CPP11_MODE 0
+#endif
+//*************************************************************************************************
+
+#endif
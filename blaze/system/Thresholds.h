@@ -40,7 +40,18 @@
 // Includes
 //*************************************************************************************************
 
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/util/Assert.h>
+#include <blaze/util/NonCopyable.h>
 #include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
 
 
 
@@ -118,10 +129,728 @@ BLAZE_STATIC_ASSERT( blaze::SMP_SMATSMATMULT_THRESHOLD   >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_SMATTSMATMULT_THRESHOLD  >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_TSMATSMATMULT_THRESHOLD  >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_TSMATTSMATMULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATSMATADD_THRESHOLD    >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DVECTDVECMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECREDUCTION_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATREDUCTION_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TRIPLETASSIGN_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATFREEZE_THRESHOLD     >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_PGS_THRESHOLD            >= 0UL );
 
 }
 /*! \endcond */
 //*************************************************************************************************
 
+
+
+
+//=================================================================================================
+//
+//  RUNTIME THRESHOLDS
+//
+//=================================================================================================
+
+namespace blaze {
+
+//*************************************************************************************************
+/*!\brief Identifiers of the runtime thresholds.
+// \ingroup system
+//
+// The ThresholdID enumeration identifies all BLAS and SMP thresholds of the Blaze library. The
+// compile time settings in <tt><blaze/config/Thresholds.h></tt> merely provide the defaults for
+// these thresholds. The values that are actually used by the expression templates are managed
+// at runtime and can be queried and adapted via the getThreshold() and setThreshold() functions:
+
+   \code
+   // Executing dense vector assignments only in parallel in case the target vector has more
+   // than 100000 elements
+   blaze::setThreshold( blaze::smpDVecAssignThreshold, 100000UL );
+   \endcode
+
+// Additionally, the defaults can be overridden via the environment. On first use of any
+// threshold, the threshold file named by the \c BLAZE_THRESHOLD_FILE environment variable
+// is loaded (see loadThresholds()). Afterwards each single threshold can be overridden by an
+// environment variable with the name of the according compile time setting and the prefix
+// \c BLAZE_ (as for instance \c BLAZE_SMP_DVECASSIGN_THRESHOLD=100000). Invalid settings in
+// the environment are ignored.
+*/
+enum ThresholdID
+{
+   dmatDVecMultThreshold = 0,      //!< Runtime value of the DMATDVECMULT_THRESHOLD.
+   tdmatDVecMultThreshold,         //!< Runtime value of the TDMATDVECMULT_THRESHOLD.
+   tdvecDMatMultThreshold,         //!< Runtime value of the TDVECDMATMULT_THRESHOLD.
+   tdvecTDMatMultThreshold,        //!< Runtime value of the TDVECTDMATMULT_THRESHOLD.
+   dmatDMatMultThreshold,          //!< Runtime value of the DMATDMATMULT_THRESHOLD.
+   dmatTDMatMultThreshold,         //!< Runtime value of the DMATTDMATMULT_THRESHOLD.
+   tdmatDMatMultThreshold,         //!< Runtime value of the TDMATDMATMULT_THRESHOLD.
+   tdmatTDMatMultThreshold,        //!< Runtime value of the TDMATTDMATMULT_THRESHOLD.
+   smpDVecAssignThreshold,         //!< Runtime value of the SMP_DVECASSIGN_THRESHOLD.
+   smpDVecDVecAddThreshold,        //!< Runtime value of the SMP_DVECDVECADD_THRESHOLD.
+   smpDVecDVecSubThreshold,        //!< Runtime value of the SMP_DVECDVECSUB_THRESHOLD.
+   smpDVecDVecMultThreshold,       //!< Runtime value of the SMP_DVECDVECMULT_THRESHOLD.
+   smpDVecScalarMultThreshold,     //!< Runtime value of the SMP_DVECSCALARMULT_THRESHOLD.
+   smpDMatDVecMultThreshold,       //!< Runtime value of the SMP_DMATDVECMULT_THRESHOLD.
+   smpTDMatDVecMultThreshold,      //!< Runtime value of the SMP_TDMATDVECMULT_THRESHOLD.
+   smpTDVecDMatMultThreshold,      //!< Runtime value of the SMP_TDVECDMATMULT_THRESHOLD.
+   smpTDVecTDMatMultThreshold,     //!< Runtime value of the SMP_TDVECTDMATMULT_THRESHOLD.
+   smpDMatSVecMultThreshold,       //!< Runtime value of the SMP_DMATSVECMULT_THRESHOLD.
+   smpTDMatSVecMultThreshold,      //!< Runtime value of the SMP_TDMATSVECMULT_THRESHOLD.
+   smpTSVecDMatMultThreshold,      //!< Runtime value of the SMP_TSVECDMATMULT_THRESHOLD.
+   smpTSVecTDMatMultThreshold,     //!< Runtime value of the SMP_TSVECTDMATMULT_THRESHOLD.
+   smpSMatDVecMultThreshold,       //!< Runtime value of the SMP_SMATDVECMULT_THRESHOLD.
+   smpTSMatDVecMultThreshold,      //!< Runtime value of the SMP_TSMATDVECMULT_THRESHOLD.
+   smpTDVecSMatMultThreshold,      //!< Runtime value of the SMP_TDVECSMATMULT_THRESHOLD.
+   smpTDVecTSMatMultThreshold,     //!< Runtime value of the SMP_TDVECTSMATMULT_THRESHOLD.
+   smpSMatSVecMultThreshold,       //!< Runtime value of the SMP_SMATSVECMULT_THRESHOLD.
+   smpTSMatSVecMultThreshold,      //!< Runtime value of the SMP_TSMATSVECMULT_THRESHOLD.
+   smpTSVecSMatMultThreshold,      //!< Runtime value of the SMP_TSVECSMATMULT_THRESHOLD.
+   smpTSVecTSMatMultThreshold,     //!< Runtime value of the SMP_TSVECTSMATMULT_THRESHOLD.
+   smpDMatAssignThreshold,         //!< Runtime value of the SMP_DMATASSIGN_THRESHOLD.
+   smpDMatDMatAddThreshold,        //!< Runtime value of the SMP_DMATDMATADD_THRESHOLD.
+   smpDMatTDMatAddThreshold,       //!< Runtime value of the SMP_DMATTDMATADD_THRESHOLD.
+   smpDMatDMatSubThreshold,        //!< Runtime value of the SMP_DMATDMATSUB_THRESHOLD.
+   smpDMatTDMatSubThreshold,       //!< Runtime value of the SMP_DMATTDMATSUB_THRESHOLD.
+   smpDMatScalarMultThreshold,     //!< Runtime value of the SMP_DMATSCALARMULT_THRESHOLD.
+   smpDMatDMatMultThreshold,       //!< Runtime value of the SMP_DMATDMATMULT_THRESHOLD.
+   smpDMatTDMatMultThreshold,      //!< Runtime value of the SMP_DMATTDMATMULT_THRESHOLD.
+   smpTDMatDMatMultThreshold,      //!< Runtime value of the SMP_TDMATDMATMULT_THRESHOLD.
+   smpTDMatTDMatMultThreshold,     //!< Runtime value of the SMP_TDMATTDMATMULT_THRESHOLD.
+   smpDMatSMatMultThreshold,       //!< Runtime value of the SMP_DMATSMATMULT_THRESHOLD.
+   smpDMatTSMatMultThreshold,      //!< Runtime value of the SMP_DMATTSMATMULT_THRESHOLD.
+   smpTDMatSMatMultThreshold,      //!< Runtime value of the SMP_TDMATSMATMULT_THRESHOLD.
+   smpTDMatTSMatMultThreshold,     //!< Runtime value of the SMP_TDMATTSMATMULT_THRESHOLD.
+   smpSMatDMatMultThreshold,       //!< Runtime value of the SMP_SMATDMATMULT_THRESHOLD.
+   smpSMatTDMatMultThreshold,      //!< Runtime value of the SMP_SMATTDMATMULT_THRESHOLD.
+   smpTSMatDMatMultThreshold,      //!< Runtime value of the SMP_TSMATDMATMULT_THRESHOLD.
+   smpTSMatTDMatMultThreshold,     //!< Runtime value of the SMP_TSMATTDMATMULT_THRESHOLD.
+   smpSMatSMatMultThreshold,       //!< Runtime value of the SMP_SMATSMATMULT_THRESHOLD.
+   smpSMatTSMatMultThreshold,      //!< Runtime value of the SMP_SMATTSMATMULT_THRESHOLD.
+   smpTSMatSMatMultThreshold,      //!< Runtime value of the SMP_TSMATSMATMULT_THRESHOLD.
+   smpTSMatTSMatMultThreshold,     //!< Runtime value of the SMP_TSMATTSMATMULT_THRESHOLD.
+   smpSMatSMatAddThreshold,        //!< Runtime value of the SMP_SMATSMATADD_THRESHOLD.
+   smpDVecTDVecMultThreshold,      //!< Runtime value of the SMP_DVECTDVECMULT_THRESHOLD.
+   smpDVecReductionThreshold,      //!< Runtime value of the SMP_DVECREDUCTION_THRESHOLD.
+   smpDMatReductionThreshold,      //!< Runtime value of the SMP_DMATREDUCTION_THRESHOLD.
+   smpTripletAssignThreshold,      //!< Runtime value of the SMP_TRIPLETASSIGN_THRESHOLD.
+   smpSMatFreezeThreshold,         //!< Runtime value of the SMP_SMATFREEZE_THRESHOLD.
+   smpPGSThreshold,                //!< Runtime value of the SMP_PGS_THRESHOLD.
+   thresholdCount                  //!< The total number of runtime thresholds.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS THRESHOLDREGISTRY
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Registry for the current values of all runtime thresholds.
+// \ingroup system
+//
+// The ThresholdRegistry class stores the current values of all BLAS and SMP thresholds. The
+// single instance is created on first use and initialized with the compile time defaults and
+// the settings given via the environment.
+*/
+class ThresholdRegistry : private NonCopyable
+{
+ public:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline ThresholdRegistry& instance();
+
+   inline size_t get  ( ThresholdID id ) const;
+   inline void   set  ( ThresholdID id, size_t value );
+   inline void   reset();
+   inline void   load ( std::istream& is );
+   inline void   save ( std::ostream& os ) const;
+
+   static inline const char* name        ( ThresholdID id );
+   static inline size_t      defaultValue( ThresholdID id );
+   static inline bool        find        ( const std::string& name, ThresholdID& id );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   //! Compile time information about a single threshold.
+   struct Info {
+      const char* name_;      //!< The name of the compile time setting.
+      size_t      default_;   //!< The compile time default of the threshold.
+      bool        positive_;  //!< \a true in case the threshold must not be 0.
+   };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline ThresholdRegistry();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+          inline void        applyEnvironment();
+   static inline const Info& info ( ThresholdID id );
+   static inline size_t      parse( const std::string& value, const std::string& name );
+   static inline std::string trim ( const std::string& str );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t values_[thresholdCount];  //!< The current values of all thresholds.
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The constructor of the ThresholdRegistry class.
+*/
+inline ThresholdRegistry::ThresholdRegistry()
+{
+   reset();
+   applyEnvironment();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the single instance of the threshold registry.
+//
+// \return Reference to the threshold registry.
+*/
+inline ThresholdRegistry& ThresholdRegistry::instance()
+{
+   static ThresholdRegistry registry;
+   return registry;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the current value of the given threshold.
+//
+// \param id The identifier of the threshold.
+// \return The current value of the threshold.
+*/
+inline size_t ThresholdRegistry::get( ThresholdID id ) const
+{
+   BLAZE_INTERNAL_ASSERT( id < thresholdCount, "Invalid threshold identifier" );
+
+   return values_[id];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Setting the value of the given threshold.
+//
+// \param id The identifier of the threshold.
+// \param value The new value of the threshold.
+// \return void
+// \exception std::invalid_argument Invalid threshold value.
+*/
+inline void ThresholdRegistry::set( ThresholdID id, size_t value )
+{
+   BLAZE_INTERNAL_ASSERT( id < thresholdCount, "Invalid threshold identifier" );
+
+   if( value == 0UL && info( id ).positive_ )
+      throw std::invalid_argument( "Invalid threshold value" );
+
+   values_[id] = value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Resetting all thresholds to their compile time defaults.
+//
+// \return void
+*/
+inline void ThresholdRegistry::reset()
+{
+   for( size_t i=0UL; i<thresholdCount; ++i ) {
+      values_[i] = info( static_cast<ThresholdID>( i ) ).default_;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Loading threshold settings from the given input stream.
+//
+// \param is The input stream containing the threshold settings.
+// \return void
+// \exception std::invalid_argument Invalid threshold setting.
+//
+// This function reads all threshold settings of the form <tt>NAME=VALUE</tt> from the given
+// input stream. Empty lines and comments starting with '#' are ignored. In case any setting
+// is invalid, a \a std::invalid_argument exception is thrown and none of the settings of the
+// input stream is applied.
+*/
+inline void ThresholdRegistry::load( std::istream& is )
+{
+   size_t values[thresholdCount];
+   std::copy( values_, values_+thresholdCount, values );
+
+   std::string line;
+
+   while( std::getline( is, line ) )
+   {
+      const std::string::size_type comment( line.find( '#' ) );
+      if( comment != std::string::npos )
+         line.erase( comment );
+
+      line = trim( line );
+      if( line.empty() ) continue;
+
+      const std::string::size_type pos( line.find( '=' ) );
+      if( pos == std::string::npos )
+         throw std::invalid_argument( "Invalid threshold setting '" + line + "'" );
+
+      const std::string name( trim( line.substr( 0UL, pos ) ) );
+
+      ThresholdID id;
+      if( !find( name, id ) )
+         throw std::invalid_argument( "Unknown threshold '" + name + "'" );
+
+      const size_t value( parse( trim( line.substr( pos+1UL ) ), name ) );
+      if( value == 0UL && info( id ).positive_ )
+         throw std::invalid_argument( "Invalid value for threshold '" + name + "'" );
+
+      values[id] = value;
+   }
+
+   std::copy( values, values+thresholdCount, values_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writing the current threshold settings to the given output stream.
+//
+// \param os The output stream.
+// \return void
+//
+// This function writes the current values of all thresholds in the format read by the load()
+// function.
+*/
+inline void ThresholdRegistry::save( std::ostream& os ) const
+{
+   for( size_t i=0UL; i<thresholdCount; ++i ) {
+      os << name( static_cast<ThresholdID>( i ) ) << "=" << values_[i] << "\n";
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the name of the given threshold.
+//
+// \param id The identifier of the threshold.
+// \return The name of the according compile time setting.
+*/
+inline const char* ThresholdRegistry::name( ThresholdID id )
+{
+   return info( id ).name_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the compile time default of the given threshold.
+//
+// \param id The identifier of the threshold.
+// \return The compile time default of the threshold.
+*/
+inline size_t ThresholdRegistry::defaultValue( ThresholdID id )
+{
+   return info( id ).default_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Searching the threshold with the given name.
+//
+// \param name The name of the compile time setting (as for instance "DMATDMATMULT_THRESHOLD").
+// \param id The identifier of the threshold in case the threshold is found.
+// \return \a true in case the threshold is found, \a false if not.
+*/
+inline bool ThresholdRegistry::find( const std::string& name, ThresholdID& id )
+{
+   for( size_t i=0UL; i<thresholdCount; ++i ) {
+      if( name == info( static_cast<ThresholdID>( i ) ).name_ ) {
+         id = static_cast<ThresholdID>( i );
+         return true;
+      }
+   }
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applying the threshold settings given via the environment.
+//
+// \return void
+//
+// This function first loads the threshold file named by the \c BLAZE_THRESHOLD_FILE environment
+// variable and afterwards applies all environment variables of the form \c BLAZE_<NAME>. Invalid
+// settings are ignored.
+*/
+inline void ThresholdRegistry::applyEnvironment()
+{
+   const char* file( std::getenv( "BLAZE_THRESHOLD_FILE" ) );
+
+   if( file != NULL ) {
+      std::ifstream in( file );
+      try {
+         if( in ) load( in );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   for( size_t i=0UL; i<thresholdCount; ++i )
+   {
+      const Info& threshold( info( static_cast<ThresholdID>( i ) ) );
+      const char* value( std::getenv( ( std::string( "BLAZE_" ) + threshold.name_ ).c_str() ) );
+
+      if( value == NULL ) continue;
+
+      try {
+         const size_t tmp( parse( trim( value ), threshold.name_ ) );
+         if( tmp != 0UL || !threshold.positive_ )
+            values_[i] = tmp;
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the compile time information about the given threshold.
+//
+// \param id The identifier of the threshold.
+// \return The compile time information about the threshold.
+*/
+inline const ThresholdRegistry::Info& ThresholdRegistry::info( ThresholdID id )
+{
+   static const Info infos[thresholdCount] = {
+      { "DMATDVECMULT_THRESHOLD",       DMATDVECMULT_THRESHOLD,       true  },
+      { "TDMATDVECMULT_THRESHOLD",      TDMATDVECMULT_THRESHOLD,      true  },
+      { "TDVECDMATMULT_THRESHOLD",      TDVECDMATMULT_THRESHOLD,      true  },
+      { "TDVECTDMATMULT_THRESHOLD",     TDVECTDMATMULT_THRESHOLD,     true  },
+      { "DMATDMATMULT_THRESHOLD",       DMATDMATMULT_THRESHOLD,       true  },
+      { "DMATTDMATMULT_THRESHOLD",      DMATTDMATMULT_THRESHOLD,      true  },
+      { "TDMATDMATMULT_THRESHOLD",      TDMATDMATMULT_THRESHOLD,      true  },
+      { "TDMATTDMATMULT_THRESHOLD",     TDMATTDMATMULT_THRESHOLD,     true  },
+      { "SMP_DVECASSIGN_THRESHOLD",     SMP_DVECASSIGN_THRESHOLD,     false },
+      { "SMP_DVECDVECADD_THRESHOLD",    SMP_DVECDVECADD_THRESHOLD,    false },
+      { "SMP_DVECDVECSUB_THRESHOLD",    SMP_DVECDVECSUB_THRESHOLD,    false },
+      { "SMP_DVECDVECMULT_THRESHOLD",   SMP_DVECDVECMULT_THRESHOLD,   false },
+      { "SMP_DVECSCALARMULT_THRESHOLD", SMP_DVECSCALARMULT_THRESHOLD, false },
+      { "SMP_DMATDVECMULT_THRESHOLD",   SMP_DMATDVECMULT_THRESHOLD,   false },
+      { "SMP_TDMATDVECMULT_THRESHOLD",  SMP_TDMATDVECMULT_THRESHOLD,  false },
+      { "SMP_TDVECDMATMULT_THRESHOLD",  SMP_TDVECDMATMULT_THRESHOLD,  false },
+      { "SMP_TDVECTDMATMULT_THRESHOLD", SMP_TDVECTDMATMULT_THRESHOLD, false },
+      { "SMP_DMATSVECMULT_THRESHOLD",   SMP_DMATSVECMULT_THRESHOLD,   false },
+      { "SMP_TDMATSVECMULT_THRESHOLD",  SMP_TDMATSVECMULT_THRESHOLD,  false },
+      { "SMP_TSVECDMATMULT_THRESHOLD",  SMP_TSVECDMATMULT_THRESHOLD,  false },
+      { "SMP_TSVECTDMATMULT_THRESHOLD", SMP_TSVECTDMATMULT_THRESHOLD, false },
+      { "SMP_SMATDVECMULT_THRESHOLD",   SMP_SMATDVECMULT_THRESHOLD,   false },
+      { "SMP_TSMATDVECMULT_THRESHOLD",  SMP_TSMATDVECMULT_THRESHOLD,  false },
+      { "SMP_TDVECSMATMULT_THRESHOLD",  SMP_TDVECSMATMULT_THRESHOLD,  false },
+      { "SMP_TDVECTSMATMULT_THRESHOLD", SMP_TDVECTSMATMULT_THRESHOLD, false },
+      { "SMP_SMATSVECMULT_THRESHOLD",   SMP_SMATSVECMULT_THRESHOLD,   false },
+      { "SMP_TSMATSVECMULT_THRESHOLD",  SMP_TSMATSVECMULT_THRESHOLD,  false },
+      { "SMP_TSVECSMATMULT_THRESHOLD",  SMP_TSVECSMATMULT_THRESHOLD,  false },
+      { "SMP_TSVECTSMATMULT_THRESHOLD", SMP_TSVECTSMATMULT_THRESHOLD, false },
+      { "SMP_DMATASSIGN_THRESHOLD",     SMP_DMATASSIGN_THRESHOLD,     false },
+      { "SMP_DMATDMATADD_THRESHOLD",    SMP_DMATDMATADD_THRESHOLD,    false },
+      { "SMP_DMATTDMATADD_THRESHOLD",   SMP_DMATTDMATADD_THRESHOLD,   false },
+      { "SMP_DMATDMATSUB_THRESHOLD",    SMP_DMATDMATSUB_THRESHOLD,    false },
+      { "SMP_DMATTDMATSUB_THRESHOLD",   SMP_DMATTDMATSUB_THRESHOLD,   false },
+      { "SMP_DMATSCALARMULT_THRESHOLD", SMP_DMATSCALARMULT_THRESHOLD, false },
+      { "SMP_DMATDMATMULT_THRESHOLD",   SMP_DMATDMATMULT_THRESHOLD,   false },
+      { "SMP_DMATTDMATMULT_THRESHOLD",  SMP_DMATTDMATMULT_THRESHOLD,  false },
+      { "SMP_TDMATDMATMULT_THRESHOLD",  SMP_TDMATDMATMULT_THRESHOLD,  false },
+      { "SMP_TDMATTDMATMULT_THRESHOLD", SMP_TDMATTDMATMULT_THRESHOLD, false },
+      { "SMP_DMATSMATMULT_THRESHOLD",   SMP_DMATSMATMULT_THRESHOLD,   false },
+      { "SMP_DMATTSMATMULT_THRESHOLD",  SMP_DMATTSMATMULT_THRESHOLD,  false },
+      { "SMP_TDMATSMATMULT_THRESHOLD",  SMP_TDMATSMATMULT_THRESHOLD,  false },
+      { "SMP_TDMATTSMATMULT_THRESHOLD", SMP_TDMATTSMATMULT_THRESHOLD, false },
+      { "SMP_SMATDMATMULT_THRESHOLD",   SMP_SMATDMATMULT_THRESHOLD,   false },
+      { "SMP_SMATTDMATMULT_THRESHOLD",  SMP_SMATTDMATMULT_THRESHOLD,  false },
+      { "SMP_TSMATDMATMULT_THRESHOLD",  SMP_TSMATDMATMULT_THRESHOLD,  false },
+      { "SMP_TSMATTDMATMULT_THRESHOLD", SMP_TSMATTDMATMULT_THRESHOLD, false },
+      { "SMP_SMATSMATMULT_THRESHOLD",   SMP_SMATSMATMULT_THRESHOLD,   false },
+      { "SMP_SMATTSMATMULT_THRESHOLD",  SMP_SMATTSMATMULT_THRESHOLD,  false },
+      { "SMP_TSMATSMATMULT_THRESHOLD",  SMP_TSMATSMATMULT_THRESHOLD,  false },
+      { "SMP_TSMATTSMATMULT_THRESHOLD", SMP_TSMATTSMATMULT_THRESHOLD, false },
+      { "SMP_SMATSMATADD_THRESHOLD",    SMP_SMATSMATADD_THRESHOLD,    false },
+      { "SMP_DVECTDVECMULT_THRESHOLD",  SMP_DVECTDVECMULT_THRESHOLD,  false },
+      { "SMP_DVECREDUCTION_THRESHOLD",  SMP_DVECREDUCTION_THRESHOLD,  false },
+      { "SMP_DMATREDUCTION_THRESHOLD",  SMP_DMATREDUCTION_THRESHOLD,  false },
+      { "SMP_TRIPLETASSIGN_THRESHOLD",  SMP_TRIPLETASSIGN_THRESHOLD,  false },
+      { "SMP_SMATFREEZE_THRESHOLD",     SMP_SMATFREEZE_THRESHOLD,     false },
+      { "SMP_PGS_THRESHOLD",            SMP_PGS_THRESHOLD,            false }
+   };
+
+   BLAZE_INTERNAL_ASSERT( id < thresholdCount, "Invalid threshold identifier" );
+
+   return infos[id];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Conversion of a threshold value.
+//
+// \param value The string representation of the threshold value.
+// \param name The name of the threshold.
+// \return The converted threshold value.
+// \exception std::invalid_argument Invalid threshold value.
+*/
+inline size_t ThresholdRegistry::parse( const std::string& value, const std::string& name )
+{
+   std::istringstream iss( value );
+   size_t tmp( 0UL );
+
+   if( value.empty() || value[0] == '-' || !( iss >> tmp ) || !iss.eof() )
+      throw std::invalid_argument( "Invalid value for threshold '" + name + "'" );
+
+   return tmp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Removing leading and trailing whitespaces from the given string.
+//
+// \param str The string to be trimmed.
+// \return The trimmed string.
+*/
+inline std::string ThresholdRegistry::trim( const std::string& str )
+{
+   const std::string::size_type first( str.find_first_not_of( " \t\r\n" ) );
+
+   if( first == std::string::npos )
+      return std::string();
+
+   const std::string::size_type last( str.find_last_not_of( " \t\r\n" ) );
+
+   return str.substr( first, last-first+1UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  RUNTIME THRESHOLD FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Runtime threshold functions */
+//@{
+inline size_t      getThreshold( ThresholdID id );
+inline void        setThreshold( ThresholdID id, size_t value );
+inline void        resetThresholds();
+inline const char* getThresholdName( ThresholdID id );
+inline void        loadThresholds( const std::string& file );
+inline void        saveThresholds( const std::string& file );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current value of the given threshold.
+// \ingroup system
+//
+// \param id The identifier of the threshold.
+// \return The current value of the threshold.
+*/
+inline size_t getThreshold( ThresholdID id )
+{
+   return ThresholdRegistry::instance().get( id );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the value of the given threshold.
+// \ingroup system
+//
+// \param id The identifier of the threshold.
+// \param value The new value of the threshold.
+// \return void
+// \exception std::invalid_argument Invalid threshold value.
+//
+// This function sets the threshold identified by \a id to the given value. For the SMP
+// thresholds a value of 0 results in an unconditional parallel execution of the according
+// operation. The BLAS thresholds must be larger than 0; in case \a value is 0, a
+// \a std::invalid_argument exception is thrown.
+//
+// Note that the thresholds are not synchronized. Therefore thresholds should not be changed
+// while another thread evaluates Blaze expressions.
+*/
+inline void setThreshold( ThresholdID id, size_t value )
+{
+   ThresholdRegistry::instance().set( id, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting all thresholds to their compile time defaults.
+// \ingroup system
+//
+// \return void
+//
+// This function resets all thresholds to the settings in <tt><blaze/config/Thresholds.h></tt>.
+// Note that settings given via the environment are discarded as well.
+*/
+inline void resetThresholds()
+{
+   ThresholdRegistry::instance().reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the name of the given threshold.
+// \ingroup system
+//
+// \param id The identifier of the threshold.
+// \return The name of the according compile time setting.
+*/
+inline const char* getThresholdName( ThresholdID id )
+{
+   return ThresholdRegistry::name( id );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Loading threshold settings from the given file.
+// \ingroup system
+//
+// \param file The name of the threshold file.
+// \return void
+// \exception std::runtime_error The file could not be opened.
+// \exception std::invalid_argument Invalid threshold setting.
+//
+// This function loads the threshold settings from the given file. The file contains one
+// setting of the form <tt>NAME=VALUE</tt> per line, where \c NAME is the name of the according
+// compile time setting. Empty lines and comments starting with '#' are ignored. Thresholds that
+// are not mentioned in the file retain their current value:
+
+   \code
+   # Thresholds for the dense matrix/dense matrix multiplication
+   DMATDMATMULT_THRESHOLD=12100
+   SMP_DMATDMATMULT_THRESHOLD=40
+   \endcode
+
+// In case any setting is invalid, a \a std::invalid_argument exception is thrown and none of
+// the settings of the file is applied.
+*/
+inline void loadThresholds( const std::string& file )
+{
+   std::ifstream in( file.c_str() );
+
+   if( !in )
+      throw std::runtime_error( "Unable to open threshold file '" + file + "'" );
+
+   ThresholdRegistry::instance().load( in );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writing the current threshold settings to the given file.
+// \ingroup system
+//
+// \param file The name of the threshold file.
+// \return void
+// \exception std::runtime_error The file could not be written.
+//
+// This function writes the current values of all thresholds to the given file. The resulting
+// file can be loaded via the loadThresholds() function or the \c BLAZE_THRESHOLD_FILE
+// environment variable.
+*/
+inline void saveThresholds( const std::string& file )
+{
+   std::ofstream out( file.c_str() );
+
+   if( !out )
+      throw std::runtime_error( "Unable to open threshold file '" + file + "'" );
+
+   ThresholdRegistry::instance().save( out );
+
+   if( !out )
+      throw std::runtime_error( "Unable to write threshold file '" + file + "'" );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
 #endif
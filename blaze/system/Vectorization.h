@@ -46,6 +46,34 @@
 
 
 
+//=================================================================================================
+//
+//  AVX-512 ENFORCEMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+#ifdef BLAZE_ENFORCE_AVX512
+#  ifndef BLAZE_ENFORCE_AVX2
+#    define BLAZE_ENFORCE_AVX2
+#  endif
+#  ifndef __AVX512F__
+#    define __AVX512F__
+#  endif
+#  ifndef __AVX512BW__
+#    define __AVX512BW__
+#  endif
+#  ifndef __AVX512DQ__
+#    define __AVX512DQ__
+#  endif
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  AVX2 ENFORCEMENT
@@ -110,7 +138,7 @@
 
 //=================================================================================================
 //
-//  SSE/AVX/MIC MODE CONFIGURATION
+//  SSE/AVX/AVX-512/MIC MODE CONFIGURATION
 //
 //=================================================================================================
 
@@ -233,6 +261,57 @@
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Compilation switch for the AVX-512F mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the AVX-512F mode. In case the AVX-512F mode is
+// enabled (i.e. in case AVX-512 foundation functionality is available) the Blaze library
+// attempts to vectorize the linear algebra operations by 512-bit AVX-512 intrinsics. In case
+// the AVX-512F mode is disabled, the Blaze library falls back to the AVX2/AVX/SSE modes.
+*/
+#if BLAZE_USE_VECTORIZATION && defined(__AVX512F__)
+#  define BLAZE_AVX512F_MODE 1
+#else
+#  define BLAZE_AVX512F_MODE 0
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the AVX-512BW mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the AVX-512BW mode. In case the AVX-512BW mode is
+// enabled (i.e. in case the AVX-512 byte and word instructions are available) the Blaze library
+// attempts to vectorize operations on 1-byte and 2-byte integral data types by 512-bit AVX-512
+// intrinsics. In case the AVX-512BW mode is disabled, these operations use the AVX2/SSE modes.
+*/
+#if BLAZE_USE_VECTORIZATION && defined(__AVX512BW__)
+#  define BLAZE_AVX512BW_MODE 1
+#else
+#  define BLAZE_AVX512BW_MODE 0
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the AVX-512DQ mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the AVX-512DQ mode. In case the AVX-512DQ mode is
+// enabled (i.e. in case the AVX-512 doubleword and quadword instructions are available) the
+// Blaze library additionally vectorizes the multiplication of 8-byte integral data types by
+// 512-bit AVX-512 intrinsics.
+*/
+#if BLAZE_USE_VECTORIZATION && defined(__AVX512DQ__)
+#  define BLAZE_AVX512DQ_MODE 1
+#else
+#  define BLAZE_AVX512DQ_MODE 0
+#endif
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Compilation switch for the MIC mode.
 // \ingroup system
@@ -250,6 +329,24 @@
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Compilation switch for the FMA mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the FMA mode. In case the FMA mode is enabled (i.e.
+// in case fused multiply-add instructions are available, as for instance in case of FMA3, AVX-512
+// or MIC) the Blaze library combines the multiplication and subsequent addition/subtraction of
+// floating point intrinsic values into a single fused multiply-add instruction. In case the FMA
+// mode is disabled, multiplications and additions are performed by separate instructions.
+*/
+#if BLAZE_USE_VECTORIZATION && ( defined(__FMA__) || defined(__AVX512F__) || defined(__MIC__) )
+#  define BLAZE_FMA_MODE 1
+#else
+#  define BLAZE_FMA_MODE 0
+#endif
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -268,6 +365,10 @@ BLAZE_STATIC_ASSERT( !BLAZE_SSSE3_MODE || BLAZE_SSE3_MODE  );
 BLAZE_STATIC_ASSERT( !BLAZE_SSE4_MODE  || BLAZE_SSSE3_MODE );
 BLAZE_STATIC_ASSERT( !BLAZE_AVX_MODE   || BLAZE_SSE4_MODE  );
 BLAZE_STATIC_ASSERT( !BLAZE_AVX2_MODE  || BLAZE_AVX_MODE   );
+BLAZE_STATIC_ASSERT( !BLAZE_AVX512F_MODE  || BLAZE_AVX2_MODE    );
+BLAZE_STATIC_ASSERT( !BLAZE_AVX512BW_MODE || BLAZE_AVX512F_MODE );
+BLAZE_STATIC_ASSERT( !BLAZE_AVX512DQ_MODE || BLAZE_AVX512F_MODE );
+BLAZE_STATIC_ASSERT( !BLAZE_FMA_MODE      || BLAZE_AVX_MODE || BLAZE_MIC_MODE );
 
 }
 /*! \endcond */
@@ -278,11 +379,11 @@ BLAZE_STATIC_ASSERT( !BLAZE_AVX2_MODE  || BLAZE_AVX_MODE   );
 
 //=================================================================================================
 //
-//  SSE/AVX/MIC INCLUDE FILE CONFIGURATION
+//  SSE/AVX/AVX-512/MIC INCLUDE FILE CONFIGURATION
 //
 //=================================================================================================
 
-#if BLAZE_MIC_MODE || BLAZE_AVX_MODE || BLAZE_AVX2_MODE
+#if BLAZE_MIC_MODE || BLAZE_AVX512F_MODE || BLAZE_AVX_MODE || BLAZE_AVX2_MODE
 #  include <immintrin.h>
 #elif BLAZE_SSE4_MODE
 #  include <smmintrin.h>
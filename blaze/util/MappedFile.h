@@ -0,0 +1,269 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/MappedFile.h
+//  \brief Header file for the MappedFile class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_UTIL_MAPPEDFILE_H_
+#define _BLAZE_UTIL_MAPPEDFILE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(_MSC_VER)
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#  endif
+#  include <windows.h>
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+#include <stdexcept>
+#include <string>
+#include <blaze/util/Byte.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Read-only memory mapping of a file.
+// \ingroup util
+//
+// The MappedFile class maps the complete content of a file read-only into the address space of
+// the process. The mapping is established in the constructor and released in the destructor.
+// Since the pages of the file are only loaded on first access, opening a mapped file is
+// independent of the size of the file. The beginning of the mapping is aligned to a page
+// boundary:
+
+   \code
+   blaze::MappedFile file( "data.bin" );
+
+   const blaze::byte* first( file.data() );  // Pointer to the first byte of the file
+   const size_t size( file.size() );         // Total size of the file in bytes
+   \endcode
+
+// Since the mapping is read-only, any attempt to write to the mapped memory results in a
+// segmentation fault. In case the file cannot be opened or mapped, a \a std::runtime_error
+// exception is thrown.
+*/
+class MappedFile : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline MappedFile( const std::string& filename );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~MappedFile();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline const byte* data() const;
+   inline size_t      size() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   const byte* data_;  //!< The first byte of the mapped file.
+   size_t      size_;  //!< The size of the mapped file in bytes.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates a read-only memory mapping of the given file.
+//
+// \param filename The name of the file to be mapped.
+// \exception std::runtime_error File could not be mapped.
+//
+// In case the file is empty no memory is mapped and data() returns a null pointer.
+*/
+inline MappedFile::MappedFile( const std::string& filename )
+   : data_( NULL )  // The first byte of the mapped file
+   , size_( 0UL  )  // The size of the mapped file in bytes
+{
+#if defined(_MSC_VER)
+   const HANDLE file( CreateFileA( filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+                                   OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL ) );
+   if( file == INVALID_HANDLE_VALUE ) {
+      throw std::runtime_error( "File could not be opened" );
+   }
+
+   LARGE_INTEGER size;
+   if( !GetFileSizeEx( file, &size ) ) {
+      CloseHandle( file );
+      throw std::runtime_error( "File size could not be determined" );
+   }
+   size_ = static_cast<size_t>( size.QuadPart );
+
+   if( size_ > 0UL )
+   {
+      const HANDLE mapping( CreateFileMappingA( file, NULL, PAGE_READONLY, 0, 0, NULL ) );
+      CloseHandle( file );
+
+      if( mapping == NULL ) {
+         throw std::runtime_error( "File could not be mapped" );
+      }
+
+      data_ = static_cast<const byte*>( MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 ) );
+      CloseHandle( mapping );
+
+      if( data_ == NULL ) {
+         throw std::runtime_error( "File could not be mapped" );
+      }
+   }
+   else CloseHandle( file );
+#else
+   const int file( open( filename.c_str(), O_RDONLY ) );
+   if( file == -1 ) {
+      throw std::runtime_error( "File could not be opened" );
+   }
+
+   struct stat status;
+   if( fstat( file, &status ) == -1 ) {
+      close( file );
+      throw std::runtime_error( "File size could not be determined" );
+   }
+   size_ = static_cast<size_t>( status.st_size );
+
+   if( size_ > 0UL )
+   {
+      void* const address( mmap( NULL, size_, PROT_READ, MAP_SHARED, file, 0 ) );
+      close( file );
+
+      if( address == MAP_FAILED ) {
+         throw std::runtime_error( "File could not be mapped" );
+      }
+
+      data_ = static_cast<const byte*>( address );
+   }
+   else close( file );
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor of the MappedFile class.
+//
+// The destructor releases the memory mapping of the file.
+*/
+inline MappedFile::~MappedFile()
+{
+   if( data_ == NULL ) return;
+
+#if defined(_MSC_VER)
+   UnmapViewOfFile( data_ );
+#else
+   munmap( const_cast<byte*>( data_ ), size_ );
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the first byte of the mapped file.
+//
+// \return Pointer to the first byte of the mapped file.
+*/
+inline const byte* MappedFile::data() const
+{
+   return data_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the size of the mapped file.
+//
+// \return The size of the mapped file in bytes.
+*/
+inline size_t MappedFile::size() const
+{
+   return size_;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
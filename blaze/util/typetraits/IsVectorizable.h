@@ -86,8 +86,8 @@ struct IsVectorizableHelper
 /*!\brief Compile time check for vectorizable types.
 // \ingroup type_traits
 //
-// Depending on the available instruction set (SSE, SSE2, SSE3, SSE4, AVX, AVX2, MIC, ...),
-// this type trait tests whether or not the given template parameter is a vectorizable type,
+// Depending on the available instruction set (SSE, SSE2, SSE3, SSE4, AVX, AVX2, AVX-512, MIC,
+// ...), this type trait tests whether or not the given template parameter is a vectorizable type,
 // i.e. a type for which intrinsic vector operations and optimizations can be used. Currently,
 // only signed/unsigned short, signed/unsigned int, signed/unsigned long, float, double,
 // complex<float>, and complex<double> are considered to be vectorizable types. In case the
@@ -0,0 +1,570 @@
+//=================================================================================================
+/*!
+//  \file src/main/Calibrate.cpp
+//  \brief Source file for the Blaze threshold calibration
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CompressedVector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/Timing.h>
+#include <blazemark/blaze/init/CompressedMatrix.h>
+#include <blazemark/blaze/init/CompressedVector.h>
+#include <blazemark/blaze/init/DynamicMatrix.h>
+#include <blazemark/blaze/init/DynamicVector.h>
+#include <blazemark/system/Config.h>
+#include <blazemark/system/Types.h>
+
+
+
+
+//=================================================================================================
+//
+//  TYPE DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+typedef blazemark::element_t  Element;  //!< Element type of all operands.
+
+typedef blaze::DynamicVector<Element,blaze::columnVector>    DVec;  //!< Dense column vector.
+typedef blaze::DynamicVector<Element,blaze::rowVector>       TDVec; //!< Dense row vector.
+typedef blaze::CompressedVector<Element,blaze::columnVector> SVec;  //!< Sparse column vector.
+typedef blaze::CompressedVector<Element,blaze::rowVector>    TSVec; //!< Sparse row vector.
+typedef blaze::DynamicMatrix<Element,blaze::rowMajor>        DMat;  //!< Row-major dense matrix.
+typedef blaze::DynamicMatrix<Element,blaze::columnMajor>     TDMat; //!< Column-major dense matrix.
+typedef blaze::CompressedMatrix<Element,blaze::rowMajor>     SMat;  //!< Row-major sparse matrix.
+typedef blaze::CompressedMatrix<Element,blaze::columnMajor>  TSMat; //!< Column-major sparse matrix.
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CALIBRATION SETTINGS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+const double minTime( 0.02 );  //!< Minimum runtime of a single time measurement [s].
+const size_t reps   ( 3UL  );  //!< Number of repetitions of each time measurement.
+const size_t fill   ( 10UL );  //!< Percentage of non-zero elements in sparse operands.
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+//! Problem sizes for the calibration of dense vector operations.
+const size_t vectorSizes[] = { 1000UL, 2000UL, 5000UL, 10000UL, 20000UL, 50000UL, 100000UL,
+                               200000UL, 500000UL, 1000000UL };
+
+//! Problem sizes for the calibration of matrix/vector multiplications.
+const size_t matVecSizes[] = { 50UL, 100UL, 200UL, 300UL, 500UL, 700UL, 1000UL, 1500UL, 2000UL,
+                               3000UL };
+
+//! Problem sizes for the calibration of matrix additions, subtractions and assignments.
+const size_t matAddSizes[] = { 20UL, 50UL, 100UL, 150UL, 200UL, 300UL, 500UL, 700UL, 1000UL };
+
+//! Problem sizes for the calibration of matrix/matrix multiplications.
+const size_t matMultSizes[] = { 10UL, 20UL, 30UL, 40UL, 50UL, 70UL, 100UL, 150UL, 200UL, 300UL };
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OPERAND SETUP
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements per sparse vector or matrix row/column.
+//
+// \param N The size of the sparse vector or the number of rows/columns of the sparse matrix.
+// \return The number of non-zero elements.
+*/
+inline size_t nonzeros( size_t N )
+{
+   return blaze::max( 1UL, ( N * fill ) / 100UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\name Operand setup functions */
+//@{
+inline void setup( Element& s, size_t /*N*/ )
+{
+   s = Element( 2.1 );
+}
+
+template< bool TF >
+inline void setup( blaze::DynamicVector<Element,TF>& v, size_t N )
+{
+   v.resize( N, false );
+   blazemark::blaze::init( v );
+}
+
+template< bool TF >
+inline void setup( blaze::CompressedVector<Element,TF>& v, size_t N )
+{
+   v.resize( N, false );
+   v.reset();
+   blazemark::blaze::init( v, nonzeros( N ) );
+}
+
+template< bool SO >
+inline void setup( blaze::DynamicMatrix<Element,SO>& m, size_t N )
+{
+   m.resize( N, N, false );
+   blazemark::blaze::init( m );
+}
+
+template< bool SO >
+inline void setup( blaze::CompressedMatrix<Element,SO>& m, size_t N )
+{
+   m.resize( N, N, false );
+   m.reset();
+   blazemark::blaze::init( m, nonzeros( N ) );
+}
+//@}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Assignment of the left-hand side operand.
+*/
+struct Assign {
+   template< typename TT, typename T1, typename T2 >
+   static void run( TT& c, const T1& a, const T2& /*b*/ ) { c = a; }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition of the two operands.
+*/
+struct Add {
+   template< typename TT, typename T1, typename T2 >
+   static void run( TT& c, const T1& a, const T2& b ) { c = a + b; }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction of the two operands.
+*/
+struct Sub {
+   template< typename TT, typename T1, typename T2 >
+   static void run( TT& c, const T1& a, const T2& b ) { c = a - b; }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of the two operands.
+*/
+struct Mult {
+   template< typename TT, typename T1, typename T2 >
+   static void run( TT& c, const T1& a, const T2& b ) { c = a * b; }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduction of the left-hand side operand by means of addition.
+*/
+struct Sum {
+   template< typename TT, typename T1, typename T2 >
+   static void run( TT& c, const T1& a, const T2& /*b*/ ) { c = sum( a ); }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief A single calibration operation.
+//
+// The Operation class template represents the operation \a OP with operands of type \a T1 and
+// \a T2, whose result is assigned to a target of type \a TT. All operands are set up for the
+// problem size given to the constructor.
+*/
+template< typename OP    // Type of the operation
+        , typename TT    // Type of the target
+        , typename T1    // Type of the left-hand side operand
+        , typename T2 >  // Type of the right-hand side operand
+class Operation
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor of the Operation class template.
+   //
+   // \param N The problem size.
+   */
+   explicit Operation( size_t N )
+   {
+      setup( a_, N );
+      setup( b_, N );
+   }
+   //**********************************************************************************************
+
+   //**Run function********************************************************************************
+   /*!\brief Executes the operation once.
+   //
+   // \return void
+   */
+   void run()
+   {
+      OP::run( c_, a_, b_ );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   TT c_;  //!< The target of the operation.
+   T1 a_;  //!< The left-hand side operand.
+   T2 b_;  //!< The right-hand side operand.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CALIBRATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The kinds of thresholds.
+*/
+enum Kind {
+   kernel   = 0,  //!< Threshold between the small and the large (BLAS) kernels.
+   parallel = 1   //!< Threshold between the serial and the parallel execution.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Measuring the runtime of a single execution of the given operation.
+//
+// \param op The operation to be measured.
+// \return The minimum runtime of a single execution [s].
+*/
+template< typename OpT >  // Type of the operation
+double measure( OpT& op )
+{
+   blaze::timing::WcTimer timer;
+   size_t steps( 1UL );
+
+   op.run();
+
+   while( true ) {
+      timer.start();
+      for( size_t step=0UL; step<steps; ++step ) {
+         op.run();
+      }
+      timer.end();
+      if( timer.last() >= minTime ) break;
+      steps *= 2UL;
+   }
+
+   double time( timer.last() / steps );
+
+   for( size_t rep=1UL; rep<reps; ++rep ) {
+      timer.start();
+      for( size_t step=0UL; step<steps; ++step ) {
+         op.run();
+      }
+      timer.end();
+      time = blaze::min( time, timer.last() / steps );
+   }
+
+   return time;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calibration of a single threshold.
+//
+// \param id The identifier of the threshold.
+// \param sizes The problem sizes used for the calibration.
+// \return void
+//
+// This function measures the runtime of the operation \a OpT for all given problem sizes, once
+// with the threshold set such that the serial execution (or the small kernel) is selected and
+// once such that the parallel execution (or the large kernel) is selected. The threshold is set
+// in the middle between the last problem size that is faster with the first setting and the
+// first problem size from which on the second setting is faster for all larger problem sizes.
+// In case the second setting is never faster, the threshold is not lowered below the largest
+// problem size. SMP thresholds refer to the number of rows/elements of the target, kernel
+// thresholds to the total number of elements of the matrix operand.
+*/
+template< typename OpT     // Type of the operation
+        , size_t NS >      // Number of problem sizes
+void calibrate( blaze::ThresholdID id, const size_t (&sizes)[NS] )
+{
+   const std::string name( blaze::getThresholdName( id ) );
+   const Kind kind( ( name.compare( 0UL, 4UL, "SMP_" ) == 0 )?( parallel ):( kernel ) );
+
+   const size_t off( std::numeric_limits<size_t>::max() );
+   const size_t on ( ( kind == parallel )?( 0UL ):( 1UL ) );
+
+   std::cout << "   " << name << " (current: "
+             << blaze::getThreshold( id ) << ")\n"
+             << "     " << std::setw(12) << "Size"
+             << std::setw(16) << ( ( kind == parallel )?( "Serial [s]" ):( "Small [s]" ) )
+             << std::setw(16) << ( ( kind == parallel )?( "Parallel [s]" ):( "Large [s]" ) )
+             << std::endl;
+
+   size_t crossover( 0UL );
+   bool found( false );
+
+   for( size_t i=0UL; i<NS; ++i )
+   {
+      const size_t N( sizes[i] );
+
+      OpT op( N );
+
+      blaze::setThreshold( id, off );
+      const double first( measure( op ) );
+
+      blaze::setThreshold( id, on );
+      const double second( measure( op ) );
+
+      std::cout << "     " << std::setw(12) << N
+                << std::setw(16) << first << std::setw(16) << second << std::endl;
+
+      if( second < first ) {
+         if( !found ) {
+            crossover = ( ( i > 0UL )?( sizes[i-1UL] ):( 0UL ) ) + N;
+            crossover /= 2UL;
+            found = true;
+         }
+      }
+      else found = false;
+   }
+
+   if( !found ) {
+      crossover = sizes[NS-1UL];
+   }
+
+   size_t threshold( ( kind == parallel )?( crossover ):( crossover * crossover ) );
+
+   if( !found ) {
+      threshold = blaze::max( threshold, blaze::ThresholdRegistry::defaultValue( id ) );
+   }
+   if( kind == kernel ) {
+      threshold = blaze::max( threshold, 1UL );
+   }
+
+   blaze::setThreshold( id, threshold );
+
+   std::cout << "     -> " << name << "=" << threshold << "\n" << std::endl;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calibration of the thresholds between the small and the large (BLAS) kernels.
+//
+// \return void
+*/
+void calibrateKernels()
+{
+   using namespace blaze;
+
+   std::cout << "\n Calibrating the kernel thresholds:\n\n";
+
+   calibrate< Operation<Mult,DVec ,DMat ,DVec > >( dmatDVecMultThreshold, matVecSizes );
+   calibrate< Operation<Mult,DVec ,TDMat,DVec > >( tdmatDVecMultThreshold, matVecSizes );
+   calibrate< Operation<Mult,TDVec,TDVec,DMat > >( tdvecDMatMultThreshold, matVecSizes );
+   calibrate< Operation<Mult,TDVec,TDVec,TDMat> >( tdvecTDMatMultThreshold, matVecSizes );
+
+   calibrate< Operation<Mult,DMat ,DMat ,DMat > >( dmatDMatMultThreshold, matMultSizes );
+   calibrate< Operation<Mult,DMat ,DMat ,TDMat> >( dmatTDMatMultThreshold, matMultSizes );
+   calibrate< Operation<Mult,TDMat,TDMat,DMat > >( tdmatDMatMultThreshold, matMultSizes );
+   calibrate< Operation<Mult,TDMat,TDMat,TDMat> >( tdmatTDMatMultThreshold, matMultSizes );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calibration of the thresholds between the serial and the parallel execution.
+//
+// \return void
+*/
+void calibrateParallel()
+{
+   using namespace blaze;
+
+   std::cout << "\n Calibrating the SMP thresholds (" << getNumThreads() << " threads):\n\n";
+
+   calibrate< Operation<Assign,DVec,DVec,Element> >( smpDVecAssignThreshold, vectorSizes );
+   calibrate< Operation<Add   ,DVec,DVec,DVec   > >( smpDVecDVecAddThreshold, vectorSizes );
+   calibrate< Operation<Sub   ,DVec,DVec,DVec   > >( smpDVecDVecSubThreshold, vectorSizes );
+   calibrate< Operation<Mult  ,DVec,DVec,DVec   > >( smpDVecDVecMultThreshold, vectorSizes );
+   calibrate< Operation<Mult  ,DVec,DVec,Element> >( smpDVecScalarMultThreshold, vectorSizes );
+   calibrate< Operation<Sum   ,Element,DVec,Element> >( smpDVecReductionThreshold, vectorSizes );
+
+   calibrate< Operation<Mult,DVec ,DMat ,DVec > >( smpDMatDVecMultThreshold, matVecSizes );
+   calibrate< Operation<Mult,DVec ,TDMat,DVec > >( smpTDMatDVecMultThreshold, matVecSizes );
+   calibrate< Operation<Mult,TDVec,TDVec,DMat > >( smpTDVecDMatMultThreshold, matVecSizes );
+   calibrate< Operation<Mult,TDVec,TDVec,TDMat> >( smpTDVecTDMatMultThreshold, matVecSizes );
+   calibrate< Operation<Mult,DVec ,DMat ,SVec > >( smpDMatSVecMultThreshold, matVecSizes );
+   calibrate< Operation<Mult,DVec ,TDMat,SVec > >( smpTDMatSVecMultThreshold, matVecSizes );
+   calibrate< Operation<Mult,TDVec,TSVec,DMat > >( smpTSVecDMatMultThreshold, matVecSizes );
+   calibrate< Operation<Mult,TDVec,TSVec,TDMat> >( smpTSVecTDMatMultThreshold, matVecSizes );
+   calibrate< Operation<Mult,DVec ,SMat ,DVec > >( smpSMatDVecMultThreshold, matVecSizes );
+   calibrate< Operation<Mult,DVec ,TSMat,DVec > >( smpTSMatDVecMultThreshold, matVecSizes );
+   calibrate< Operation<Mult,TDVec,TDVec,SMat > >( smpTDVecSMatMultThreshold, matVecSizes );
+   calibrate< Operation<Mult,TDVec,TDVec,TSMat> >( smpTDVecTSMatMultThreshold, matVecSizes );
+   calibrate< Operation<Mult,DVec ,SMat ,SVec > >( smpSMatSVecMultThreshold, matVecSizes );
+   calibrate< Operation<Mult,DVec ,TSMat,SVec > >( smpTSMatSVecMultThreshold, matVecSizes );
+   calibrate< Operation<Mult,TDVec,TSVec,SMat > >( smpTSVecSMatMultThreshold, matVecSizes );
+   calibrate< Operation<Mult,TDVec,TSVec,TSMat> >( smpTSVecTSMatMultThreshold, matVecSizes );
+
+   calibrate< Operation<Assign,DMat,DMat,Element> >( smpDMatAssignThreshold, matAddSizes );
+   calibrate< Operation<Add   ,DMat,DMat,DMat   > >( smpDMatDMatAddThreshold, matAddSizes );
+   calibrate< Operation<Add   ,DMat,DMat,TDMat  > >( smpDMatTDMatAddThreshold, matAddSizes );
+   calibrate< Operation<Sub   ,DMat,DMat,DMat   > >( smpDMatDMatSubThreshold, matAddSizes );
+   calibrate< Operation<Sub   ,DMat,DMat,TDMat  > >( smpDMatTDMatSubThreshold, matAddSizes );
+   calibrate< Operation<Mult  ,DMat,DMat,Element> >( smpDMatScalarMultThreshold, matAddSizes );
+   calibrate< Operation<Mult  ,DMat,DVec,TDVec  > >( smpDVecTDVecMultThreshold, matAddSizes );
+   calibrate< Operation<Sum   ,Element,DMat,Element> >( smpDMatReductionThreshold, matAddSizes );
+
+   calibrate< Operation<Mult,DMat ,DMat ,DMat > >( smpDMatDMatMultThreshold, matMultSizes );
+   calibrate< Operation<Mult,DMat ,DMat ,TDMat> >( smpDMatTDMatMultThreshold, matMultSizes );
+   calibrate< Operation<Mult,TDMat,TDMat,DMat > >( smpTDMatDMatMultThreshold, matMultSizes );
+   calibrate< Operation<Mult,TDMat,TDMat,TDMat> >( smpTDMatTDMatMultThreshold, matMultSizes );
+   calibrate< Operation<Mult,DMat ,DMat ,SMat > >( smpDMatSMatMultThreshold, matMultSizes );
+   calibrate< Operation<Mult,DMat ,DMat ,TSMat> >( smpDMatTSMatMultThreshold, matMultSizes );
+   calibrate< Operation<Mult,TDMat,TDMat,SMat > >( smpTDMatSMatMultThreshold, matMultSizes );
+   calibrate< Operation<Mult,TDMat,TDMat,TSMat> >( smpTDMatTSMatMultThreshold, matMultSizes );
+   calibrate< Operation<Mult,DMat ,SMat ,DMat > >( smpSMatDMatMultThreshold, matMultSizes );
+   calibrate< Operation<Mult,DMat ,SMat ,TDMat> >( smpSMatTDMatMultThreshold, matMultSizes );
+   calibrate< Operation<Mult,TDMat,TSMat,DMat > >( smpTSMatDMatMultThreshold, matMultSizes );
+   calibrate< Operation<Mult,TDMat,TSMat,TDMat> >( smpTSMatTDMatMultThreshold, matMultSizes );
+   calibrate< Operation<Mult,DMat ,SMat ,SMat > >( smpSMatSMatMultThreshold, matMultSizes );
+   calibrate< Operation<Mult,DMat ,SMat ,TSMat> >( smpSMatTSMatMultThreshold, matMultSizes );
+   calibrate< Operation<Mult,TDMat,TSMat,SMat > >( smpTSMatSMatMultThreshold, matMultSizes );
+   calibrate< Operation<Mult,TDMat,TSMat,TSMat> >( smpTSMatTSMatMultThreshold, matMultSizes );
+
+   calibrate< Operation<Add,SMat,SMat,SMat> >( smpSMatSMatAddThreshold, matVecSizes );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The main function for the Blaze threshold calibration.
+//
+// \param argc Number of command line arguments.
+// \param argv Array of command line arguments.
+// \return Success code for the execution.
+//
+// The threshold calibration measures the crossover points between the small and large kernels
+// and between the serial and parallel execution of all operations on the current machine and
+// writes the resulting thresholds to the given threshold file (default: 'thresholds.cfg'). The
+// file can be loaded via the blaze::loadThresholds() function or by setting the environment
+// variable BLAZE_THRESHOLD_FILE.
+*/
+int main( int argc, char** argv )
+{
+   if( argc > 2 ) {
+      std::cerr << " Invalid use of program 'Calibrate'!\n"
+                << "   Use: ./calibrate [<threshold_file>]\n" << std::endl;
+      return EXIT_FAILURE;
+   }
+
+   const std::string file( ( argc == 2 )?( argv[1] ):( "thresholds.cfg" ) );
+
+   std::cout << "\n Blaze threshold calibration:\n";
+
+   ::blaze::setSeed( ::blazemark::seed );
+   ::blaze::resetThresholds();
+
+   try {
+      calibrateKernels();
+
+      if( ::blaze::getNumThreads() > 1UL ) {
+         calibrateParallel();
+      }
+      else {
+         std::cout << "\n Skipping the SMP thresholds (serial execution or a single thread).\n";
+      }
+
+      ::blaze::saveThresholds( file );
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "   Error during threshold calibration: " << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   std::cout << "\n Thresholds written to '" << file << "'.\n" << std::endl;
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,286 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/customvector/ClassTest.h
+//  \brief Header file for the CustomVector class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_CUSTOMVECTOR_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_CUSTOMVECTOR_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/constraints/DenseVector.h>
+#include <blaze/math/CustomVector.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/policies/Deallocate.h>
+#include <blaze/util/UniqueArray.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace customvector {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the CustomVector class template.
+//
+// This class represents a test suite for the blaze::CustomVector class template. It performs
+// a series of both compile time as well as runtime tests.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testConstructors();
+   void testAssignment  ();
+   void testAddAssign   ();
+   void testSubAssign   ();
+   void testMultAssign  ();
+   void testScaling     ();
+   void testSubscript   ();
+   void testNonZeros    ();
+   void testReset       ();
+   void testClear       ();
+   void testSwap        ();
+   void testIsDefault   ();
+
+   template< typename Type >
+   void checkSize( const Type& vector, size_t expectedSize ) const;
+
+   template< typename Type >
+   void checkCapacity( const Type& vector, size_t minCapacity ) const;
+
+   template< typename Type >
+   void checkNonZeros( const Type& vector, size_t nonzeros ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef blaze::CustomVector<int,blaze::unaligned,blaze::unpadded,blaze::rowVector>  UVT;   //!< Type of the unaligned, unpadded custom vector.
+   typedef blaze::CustomVector<int,blaze::aligned,blaze::padded,blaze::rowVector>      AVT;   //!< Type of the aligned, padded custom vector.
+   typedef UVT::TransposeType                                                          TUVT;  //!< Transpose unaligned, unpadded custom vector type.
+   typedef AVT::TransposeType                                                          TAVT;  //!< Transpose aligned, padded custom vector type.
+   typedef UVT::Rebind<double>::Other                                                  RUVT;  //!< Rebound unaligned, unpadded custom vector type.
+   typedef AVT::Rebind<double>::Other                                                  RAVT;  //!< Rebound aligned, padded custom vector type.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( UVT  );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( AVT  );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( TUVT );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( TAVT );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( RUVT );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( RAVT );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( UVT::ResultType, TUVT::TransposeType );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( AVT::ResultType, TAVT::TransposeType );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( UVT::ElementType, TUVT::ElementType );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( AVT::ElementType, TAVT::ElementType );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( RUVT::ElementType, double );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( RAVT::ElementType, double );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the size of the given custom vector.
+//
+// \param vector The custom vector to be checked.
+// \param expectedSize The expected size of the custom vector.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the size of the given custom vector. In case the actual size
+// does not correspond to the given expected size, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename Type >  // Type of the custom vector
+void ClassTest::checkSize( const Type& vector, size_t expectedSize ) const
+{
+   if( size( vector ) != expectedSize ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid size detected\n"
+          << " Details:\n"
+          << "   Size         : " << size( vector ) << "\n"
+          << "   Expected size: " << expectedSize << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the capacity of the given custom vector.
+//
+// \param vector The custom vector to be checked.
+// \param minCapacity The expected minimum capacity of the custom vector.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the capacity of the given custom vector. In case the actual capacity
+// is smaller than the given expected minimum capacity, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename Type >  // Type of the custom vector
+void ClassTest::checkCapacity( const Type& vector, size_t minCapacity ) const
+{
+   if( capacity( vector ) < minCapacity ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid capacity detected\n"
+          << " Details:\n"
+          << "   Capacity                 : " << capacity( vector ) << "\n"
+          << "   Expected minimum capacity: " << minCapacity << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of non-zero elements of the given custom vector.
+//
+// \param vector The custom vector to be checked.
+// \param expectedNonZeros The expected number of non-zero elements of the custom vector.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of non-zero elements of the given custom vector. In
+// case the actual number of non-zero elements does not correspond to the given expected
+// number, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Type of the custom vector
+void ClassTest::checkNonZeros( const Type& vector, size_t expectedNonZeros ) const
+{
+   if( nonZeros( vector ) != expectedNonZeros ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of non-zero elements\n"
+          << " Details:\n"
+          << "   Number of non-zeros         : " << nonZeros( vector ) << "\n"
+          << "   Expected number of non-zeros: " << expectedNonZeros << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the CustomVector class template.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the CustomVector class test.
+*/
+#define RUN_CUSTOMVECTOR_CLASS_TEST \
+   blazetest::mathtest::customvector::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace customvector
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
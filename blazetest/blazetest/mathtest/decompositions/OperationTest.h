@@ -0,0 +1,288 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/decompositions/OperationTest.h
+//  \brief Header file for the dense matrix decompositions operation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_DECOMPOSITIONS_OPERATIONTEST_H_
+#define _BLAZETEST_MATHTEST_DECOMPOSITIONS_OPERATIONTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/DenseMatrix.h>
+#include <blaze/math/DenseVector.h>
+#include <blaze/util/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace decompositions {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the dense matrix decompositions.
+//
+// This class represents a test suite for the LUDecomposition, CholeskyDecomposition and
+// QRDecomposition class templates. The original matrix is reconstructed from the computed
+// factors and the solutions of linear systems are compared to known solutions for matrix
+// sizes below, at and above the block size of the blocked algorithms. Additionally, the
+// error paths for non-square, singular, non-symmetric and non-positive-definite matrices
+// are tested.
+*/
+class OperationTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit OperationTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testLU();
+   void testCholesky();
+   void testQR();
+
+   template< bool SO >
+   void testLU( size_t n );
+
+   template< bool SO >
+   void testCholesky( size_t n );
+
+   template< bool SO >
+   void testQR( size_t m, size_t n );
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& result, const T2& expected, const char* operation,
+                     size_t n ) const;
+
+   template< typename MT1, typename MT2 >
+   double maxError( const blaze::DenseMatrix<MT1,false>& result,
+                    const blaze::DenseMatrix<MT2,false>& expected ) const;
+
+   template< typename MT1, typename MT2 >
+   double maxError( const blaze::DenseMatrix<MT1,true>& result,
+                    const blaze::DenseMatrix<MT2,true>& expected ) const;
+
+   template< typename VT1, typename VT2 >
+   double maxError( const blaze::DenseVector<VT1,false>& result,
+                    const blaze::DenseVector<VT2,false>& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the result of a decomposition or solve operation.
+//
+// \param result The computed dense matrix or vector.
+// \param expected The expected dense matrix or vector.
+// \param operation The name of the operation.
+// \param n The size of the decomposed matrix.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+//
+// Due to the blocked evaluation the results are not bitwise identical to the expected results.
+// Therefore this function compares the maximum absolute difference to a tolerance relative to
+// the size of the decomposed matrix.
+*/
+template< typename T1    // Type of the result
+        , typename T2 >  // Type of the expected result
+void OperationTest::checkResult( const T1& result, const T2& expected, const char* operation,
+                                 size_t n ) const
+{
+   const double error( maxError( result, expected ) );
+
+   if( !( error <= 1E-10 * double( n + 1UL ) ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Incorrect result of the " << operation << " detected\n"
+          << " Details:\n"
+          << "   Matrix size  : " << n << "\n"
+          << "   Maximum error: " << error << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the maximum absolute difference between two row-major dense matrices.
+//
+// \param result The computed dense matrix.
+// \param expected The expected dense matrix.
+// \return The maximum absolute difference (infinity in case of a size mismatch).
+*/
+template< typename MT1    // Type of the computed matrix
+        , typename MT2 >  // Type of the expected matrix
+double OperationTest::maxError( const blaze::DenseMatrix<MT1,false>& result,
+                                const blaze::DenseMatrix<MT2,false>& expected ) const
+{
+   if( (~result).rows() != (~expected).rows() || (~result).columns() != (~expected).columns() )
+      return HUGE_VAL;
+
+   double error( 0.0 );
+
+   for( size_t i=0UL; i<(~result).rows(); ++i )
+      for( size_t j=0UL; j<(~result).columns(); ++j )
+         error = std::max( error, std::fabs( (~result)(i,j) - (~expected)(i,j) ) );
+
+   return error;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the maximum absolute difference between two column-major dense matrices.
+//
+// \param result The computed dense matrix.
+// \param expected The expected dense matrix.
+// \return The maximum absolute difference (infinity in case of a size mismatch).
+*/
+template< typename MT1    // Type of the computed matrix
+        , typename MT2 >  // Type of the expected matrix
+double OperationTest::maxError( const blaze::DenseMatrix<MT1,true>& result,
+                                const blaze::DenseMatrix<MT2,true>& expected ) const
+{
+   return maxError( trans( ~result ), trans( ~expected ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the maximum absolute difference between two dense column vectors.
+//
+// \param result The computed dense vector.
+// \param expected The expected dense vector.
+// \return The maximum absolute difference (infinity in case of a size mismatch).
+*/
+template< typename VT1    // Type of the computed vector
+        , typename VT2 >  // Type of the expected vector
+double OperationTest::maxError( const blaze::DenseVector<VT1,false>& result,
+                                const blaze::DenseVector<VT2,false>& expected ) const
+{
+   if( (~result).size() != (~expected).size() )
+      return HUGE_VAL;
+
+   double error( 0.0 );
+
+   for( size_t i=0UL; i<(~result).size(); ++i )
+      error = std::max( error, std::fabs( (~result)[i] - (~expected)[i] ) );
+
+   return error;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the dense matrix decompositions.
+//
+// \return void
+*/
+void runTest()
+{
+   OperationTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the dense matrix decompositions operation test.
+*/
+#define RUN_DECOMPOSITIONS_OPERATION_TEST \
+   blazetest::mathtest::decompositions::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace decompositions
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
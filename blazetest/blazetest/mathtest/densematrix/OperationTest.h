@@ -40,9 +40,13 @@
 // Includes
 //*************************************************************************************************
 
+#include <algorithm>
+#include <cmath>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/util/Types.h>
 
 
 namespace blazetest {
@@ -96,6 +100,15 @@ class OperationTest
    void testIsIdentity();
    void testMinimum();
    void testMaximum();
+   void testDeterminant();
+   void testInversion();
+   void testBlockedInversion();
+
+   template< bool SO >
+   void testBlockedInversion( size_t n );
+
+   template< typename MT1, typename MT2 >
+   void checkInverse( const MT1& matrix, const MT2& inverse, const char* operation ) const;
 
    template< typename Type >
    void checkRows( const Type& matrix, size_t expectedRows ) const;
@@ -295,6 +308,46 @@ void OperationTest::checkNonZeros( const Type& matrix, size_t index, size_t expe
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Checking the given inverse of a dense matrix.
+//
+// \param matrix The inverted dense matrix.
+// \param inverse The computed inverse of the dense matrix.
+// \param operation Description of the inversion operation.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the product of the given dense matrix and its inverse is the
+// identity matrix. In case the largest deviation of any element exceeds a size dependent
+// tolerance, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT1    // Type of the inverted dense matrix
+        , typename MT2 >  // Type of the inverse
+void OperationTest::checkInverse( const MT1& matrix, const MT2& inverse, const char* operation ) const
+{
+   const size_t n( matrix.rows() );
+   const blaze::DynamicMatrix<double,blaze::rowMajor> product( matrix * inverse );
+
+   double error( 0.0 );
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         error = std::max( error, std::fabs( product(i,j) - ( i == j ? 1.0 : 0.0 ) ) );
+      }
+   }
+
+   if( error > 1E-12 * double( n ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << operation << " failed\n"
+          << " Details:\n"
+          << "   Matrix size      : " << n << "x" << n << "\n"
+          << "   Maximum deviation: " << error << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
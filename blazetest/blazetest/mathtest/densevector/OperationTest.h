@@ -88,6 +88,7 @@ class OperationTest
    void testNormalize();
    void testMinimum();
    void testMaximum();
+   void testFuse();
 
    template< typename Type >
    void checkSize( const Type& vector, size_t expectedSize ) const;
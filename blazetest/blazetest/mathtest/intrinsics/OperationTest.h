@@ -40,17 +40,23 @@
 // Includes
 //*************************************************************************************************
 
+#include <cmath>
+#include <limits>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <typeinfo>
+#include <vector>
 #include <blaze/math/Intrinsics.h>
 #include <blaze/math/shims/Equal.h>
 #include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/FalseType.h>
 #include <blaze/util/Memory.h>
 #include <blaze/util/NonCopyable.h>
 #include <blaze/util/policies/Deallocate.h>
 #include <blaze/util/Random.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
 #include <blaze/util/UniqueArray.h>
 
 
@@ -104,7 +110,10 @@ class OperationTest : private blaze::NonCopyable
    void testStore    ();
    void testStream   ();
    void testStoreu   ( size_t offset );
+   void testMaskstoreu( size_t n );
    void testReduction();
+   void testFMA      ( blaze::TrueType  );
+   void testFMA      ( blaze::FalseType );
    //@}
    //**********************************************************************************************
 
@@ -112,6 +121,7 @@ class OperationTest : private blaze::NonCopyable
    /*!\name Error detection functions */
    //@{
    void compare( const T* a, const T* b ) const;
+   void compareMultAdd( const T* result, T sign1, T sign2 ) const;
    //@}
    //**********************************************************************************************
 
@@ -127,6 +137,8 @@ class OperationTest : private blaze::NonCopyable
    //@{
    T* a_;  //!< The first aligned array of size NN.
    T* b_;  //!< The second aligned array of size NN.
+   T* c_;  //!< The third aligned array of size NN.
+   T* d_;  //!< The fourth aligned array of size NN.
 
    std::string test_;  //!< Label of the currently performed test.
    //@}
@@ -158,6 +170,8 @@ template< typename T >  // Data type of the intrinsic test
 OperationTest<T>::OperationTest()
    : a_    ( blaze::allocate<T>( NN ) )  // The first aligned array of size NN
    , b_    ( blaze::allocate<T>( NN ) )  // The second aligned array of size NN
+   , c_    ( blaze::allocate<T>( NN ) )  // The third aligned array of size NN
+   , d_    ( blaze::allocate<T>( NN ) )  // The fourth aligned array of size NN
    , test_ ()                            // Label of the currently performed test
 {
    testStore();
@@ -167,7 +181,12 @@ OperationTest<T>::OperationTest()
       testStoreu( offset );
    }
 
+   for( size_t n=0UL; n<=IT::size; ++n ) {
+      testMaskstoreu( n );
+   }
+
    testReduction();
+   testFMA( typename blaze::IsFloatingPoint<T>::Type() );
 }
 //*************************************************************************************************
 
@@ -265,6 +284,55 @@ void OperationTest<T>::testStoreu( size_t offset )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Testing the masked load and store operations.
+//
+// \param n The number of elements to be loaded and stored.
+// \return void
+// \exception std::runtime_error Load/store error detected.
+//
+// This function tests the masked load and store operations by copying the first \a n elements
+// of one array to another via masked, unaligned load and store. In case any of the first \a n
+// elements is not copied or any of the remaining elements is modified, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename T >  // Data type of the intrinsic test
+void OperationTest<T>::testMaskstoreu( size_t n )
+{
+   using blaze::maskloadu;
+   using blaze::maskstoreu;
+
+   test_  = "maskstoreu() operation";
+
+   initialize();
+
+   const std::vector<T> a( a_, a_+NN );
+   const IntrinsicType fill;
+
+   for( size_t i=0UL; i<N; i+=IT::size ) {
+      maskstoreu( a_+i+1UL, n, maskloadu( b_+i+1UL, n, fill ) );
+   }
+
+   for( size_t i=0UL; i<N; i+=IT::size ) {
+      for( size_t j=0UL; j<IT::size; ++j ) {
+         const size_t k( i+j+1UL );
+         if( a_[k] != ( ( j < n )?( b_[k] ):( a[k] ) ) ) {
+            std::ostringstream oss;
+            oss.precision( 20 );
+            oss << " Test : " << test_ << "\n"
+                << " Error: Value mismatch detected at index " << k << "\n"
+                << " Details:\n"
+                << "   Number of stored elements = " << n << "\n"
+                << "   Result   = " << a_[k] << "\n"
+                << "   Expected = " << ( ( j < n )?( b_[k] ):( a[k] ) ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Testing the reduction operation.
 //
@@ -311,6 +379,109 @@ void OperationTest<T>::testReduction()
 }
 //*************************************************************************************************
 
+//*************************************************************************************************
+/*!\brief Testing the fused multiply-add operations.
+//
+// \return void
+// \exception std::runtime_error Multiply-add error detected.
+//
+// This function tests the fmadd(), fmsub(), and fnmadd() operations as well as the fusion of
+// intrinsic multiplication expressions with a subsequent addition or subtraction by comparing
+// the results with the according scalar computations. Since a fused operation rounds only
+// once, the results are compared with a tolerance of a few units in the last place. In case
+// any error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Data type of the intrinsic test
+void OperationTest<T>::testFMA( blaze::TrueType )
+{
+   using blaze::fmadd;
+   using blaze::fmsub;
+   using blaze::fnmadd;
+   using blaze::load;
+   using blaze::store;
+
+   typedef typename blaze::IntrinsicMultTrait<IntrinsicType>::Type  MultType;
+
+   initialize();
+
+   test_ = "fmadd() operation";
+
+   for( size_t i=0UL; i<N; i+=IT::size ) {
+      store( d_+i, fmadd( load( a_+i ), load( b_+i ), load( c_+i ) ) );
+   }
+
+   compareMultAdd( d_, T(1), T(1) );
+
+   test_ = "fmsub() operation";
+
+   for( size_t i=0UL; i<N; i+=IT::size ) {
+      store( d_+i, fmsub( load( a_+i ), load( b_+i ), load( c_+i ) ) );
+   }
+
+   compareMultAdd( d_, T(1), T(-1) );
+
+   test_ = "fnmadd() operation";
+
+   for( size_t i=0UL; i<N; i+=IT::size ) {
+      store( d_+i, fnmadd( load( a_+i ), load( b_+i ), load( c_+i ) ) );
+   }
+
+   compareMultAdd( d_, T(-1), T(1) );
+
+   test_ = "Multiplication expression";
+
+   for( size_t i=0UL; i<N; i+=IT::size ) {
+      const MultType product( load( a_+i ) * load( b_+i ) );
+      store( d_+i, product );
+   }
+
+   compareMultAdd( d_, T(1), T(0) );
+
+   test_ = "Addition of a multiplication expression";
+
+   for( size_t i=0UL; i<N; i+=IT::size ) {
+      store( d_+i, load( a_+i ) * load( b_+i ) + load( c_+i ) );
+   }
+
+   compareMultAdd( d_, T(1), T(1) );
+
+   for( size_t i=0UL; i<N; i+=IT::size ) {
+      store( d_+i, load( c_+i ) + load( a_+i ) * load( b_+i ) );
+   }
+
+   compareMultAdd( d_, T(1), T(1) );
+
+   test_ = "Subtraction of a multiplication expression";
+
+   for( size_t i=0UL; i<N; i+=IT::size ) {
+      store( d_+i, load( a_+i ) * load( b_+i ) - load( c_+i ) );
+   }
+
+   compareMultAdd( d_, T(1), T(-1) );
+
+   for( size_t i=0UL; i<N; i+=IT::size ) {
+      store( d_+i, load( c_+i ) - load( a_+i ) * load( b_+i ) );
+   }
+
+   compareMultAdd( d_, T(-1), T(1) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Skipping the fused multiply-add tests for non-floating point data types.
+//
+// \return void
+//
+// The fused multiply-add operations are only available for single and double precision
+// floating point values. Therefore this function doesn't perform any test.
+*/
+template< typename T >  // Data type of the intrinsic test
+void OperationTest<T>::testFMA( blaze::FalseType )
+{}
+//*************************************************************************************************
+
+
 
 
 
@@ -349,6 +520,49 @@ void OperationTest<T>::compare( const T* a, const T* b ) const
 }
 //*************************************************************************************************
 
+//*************************************************************************************************
+/*!\brief Comparison of the first 256 elements of the given array with a scalar multiply-add.
+//
+// \param result The array containing the results of the vectorized multiply-add.
+// \param sign1 The sign of the product of the first and second member array.
+// \param sign2 The sign of the third member array.
+// \return void
+// \exception std::runtime_error Value mismatch detected.
+//
+// This function compares the first 256 elements of the given array with the scalar results of
+// \f$ sign1*a*b+sign2*c \f$. Since the scalar and the vectorized computation may differ in
+// the number of rounding steps, a difference of a few units in the last place relative to the
+// magnitude of the operands is tolerated. In case any value exceeds this tolerance, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Data type of the intrinsic test
+void OperationTest<T>::compareMultAdd( const T* result, T sign1, T sign2 ) const
+{
+   for( size_t i=0UL; i<N; ++i )
+   {
+      const T product ( a_[i] * b_[i] );
+      const T expected( sign1*product + sign2*c_[i] );
+      const T accuracy( T(4) * std::numeric_limits<T>::epsilon() *
+                        ( std::abs( product ) + std::abs( c_[i] ) ) );
+
+      if( std::abs( result[i] - expected ) > accuracy ) {
+         std::ostringstream oss;
+         oss.precision( 20 );
+         oss << " Test : " << test_ << "\n"
+             << " Error: Value mismatch detected at index " << i << "\n"
+             << " Details:\n"
+             << "   a[" << i << "] = " << a_[i] << "\n"
+             << "   b[" << i << "] = " << b_[i] << "\n"
+             << "   c[" << i << "] = " << c_[i] << "\n"
+             << "   Result   = " << result[i] << "\n"
+             << "   Expected = " << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
 
 
 
@@ -374,6 +588,7 @@ void OperationTest<T>::initialize()
    for( size_t i=0UL; i<NN; ++i ) {
       randomize( a_[i] );
       randomize( b_[i] );
+      randomize( c_[i] );
    }
 }
 //*************************************************************************************************
@@ -49,6 +49,7 @@
 #include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/SparseSubmatrix.h>
 #include <blaze/math/StaticMatrix.h>
+#include <blaze/math/serialization/TypeValueMapping.h>
 #include <blaze/math/typetraits/IsDenseMatrix.h>
 #include <blaze/util/Random.h>
 #include <blaze/util/serialization/Archive.h>
@@ -94,6 +95,7 @@ class ClassTest
    //@{
    void testEmptyMatrices ();
    void testRandomMatrices();
+   void testFormat        ();
    void testFailures      ();
 
    template< size_t M, size_t N, typename MT >
@@ -125,6 +127,8 @@ class ClassTest
 
    template< typename MT1, typename MT2 >
    void compareMatrices( const MT1& src, const MT2& dst );
+
+   void compareStreams( const std::stringstream& result, const std::stringstream& expected );
    //@}
    //**********************************************************************************************
 
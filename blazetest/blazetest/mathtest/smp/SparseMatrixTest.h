@@ -0,0 +1,268 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smp/SparseMatrixTest.h
+//  \brief Header file for the SMP sparse matrix test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMP_SPARSEMATRIXTEST_H_
+#define _BLAZETEST_MATHTEST_SMP_SPARSEMATRIXTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/Types.h>
+#include <blazetest/mathtest/smp/Thresholds.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the SMP assignment of compressed matrices.
+//
+// This class represents a test suite for the parallel symbolic/numeric assignment of sparse
+// matrix/sparse matrix multiplications and additions to compressed matrices. All SMP thresholds
+// are set to zero and the tests use matrix sizes that are not divisible by the number of threads
+// as well as operands with empty rows and columns.
+*/
+class SparseMatrixTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit SparseMatrixTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testMultiplication();
+   void testAddition();
+
+   template< bool SO >
+   void testMultiplication( size_t m, size_t k, size_t n, size_t threads );
+
+   template< bool SO >
+   void testAddition( size_t m, size_t n, size_t threads );
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& result, const T2& expected, size_t threads ) const;
+
+   template< typename Type >
+   void checkStructure( const Type& matrix, size_t expectedNonZeros, size_t threads ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the result of a parallel operation.
+//
+// \param result The result of the parallel operation.
+// \param expected The expected result.
+// \param threads The number of threads used for the operation.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+template< typename T1    // Type of the result
+        , typename T2 >  // Type of the expected result
+void SparseMatrixTest::checkResult( const T1& result, const T2& expected, size_t threads ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Incorrect result detected\n"
+          << " Details:\n"
+          << "   Number of threads: " << threads << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//*************************************************************************************************
+/*!\brief Checking the internal structure of the given compressed matrix.
+//
+// \param matrix The compressed matrix to be checked.
+// \param expectedNonZeros The expected number of non-zero elements of the compressed matrix.
+// \param threads The number of threads used for the operation.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the total number of non-zero elements of the given compressed matrix,
+// the consistency with the number of non-zero elements per row/column and the strictly
+// ascending order of the indices within each row/column. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Type of the compressed matrix
+void SparseMatrixTest::checkStructure( const Type& matrix, size_t expectedNonZeros,
+                                       size_t threads ) const
+{
+   typedef typename Type::ConstIterator  ConstIterator;
+
+   const size_t n( blaze::IsRowMajorMatrix<Type>::value ? matrix.rows() : matrix.columns() );
+
+   size_t nonZeros( 0UL );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      size_t count( 0UL );
+
+      for( ConstIterator element=matrix.begin(i); element!=matrix.end(i); ++element, ++count ) {
+         if( element != matrix.begin(i) && (element-1)->index() >= element->index() ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid order of the non-zero elements detected\n"
+                << " Details:\n"
+                << "   Number of threads: " << threads << "\n"
+                << "   Row/column       : " << i << "\n"
+                << "   Result:\n" << matrix << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      if( count != matrix.nonZeros(i) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of non-zero elements in row/column " << i << "\n"
+             << " Details:\n"
+             << "   Number of threads  : " << threads << "\n"
+             << "   Number of non-zeros: " << matrix.nonZeros(i) << "\n"
+             << "   Number of elements : " << count << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      nonZeros += count;
+   }
+
+   if( nonZeros != expectedNonZeros || matrix.nonZeros() != expectedNonZeros ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of non-zero elements detected\n"
+          << " Details:\n"
+          << "   Number of threads           : " << threads << "\n"
+          << "   Number of non-zeros         : " << matrix.nonZeros() << "\n"
+          << "   Number of stored elements   : " << nonZeros << "\n"
+          << "   Expected number of non-zeros: " << expectedNonZeros << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the SMP assignment of compressed matrices.
+//
+// \return void
+*/
+void runSparseMatrixTest()
+{
+   SparseMatrixTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the SMP sparse matrix test.
+*/
+#define RUN_SMP_SPARSEMATRIX_TEST \
+   blazetest::mathtest::smp::runSparseMatrixTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,356 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/solvers/OperationTest.h
+//  \brief Header file for the iterative solvers operation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SOLVERS_OPERATIONTEST_H_
+#define _BLAZETEST_MATHTEST_SOLVERS_OPERATIONTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DenseVector.h>
+#include <blaze/math/solvers/PGS.h>
+#include <blaze/math/solvers/Solver.h>
+#include <blaze/util/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the iterative solvers.
+//
+// This class represents a test suite for the PCG, PipelinedCG, BiCGSTAB, GMRES, PGS and CPG
+// solvers, for the preconditioners of the linear system solvers and for the warm-starting of
+// complementarity problems. The solutions of the solvers are compared
+// to known reference solutions of symmetric and non-symmetric model problems, the results
+// of the preconditioners are compared to explicitly computed results. Additionally, the
+// error paths for invalid system matrices and parameters are tested.
+*/
+class OperationTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit OperationTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testPCG();
+   void testPipelinedCG();
+   void testBiCGSTAB();
+   void testGMRES();
+   void testPreconditioners();
+   void testPGS();
+   void testStagnation();
+   void testWarmStart();
+
+   template< typename VT1, typename VT2 >
+   void checkSolution( const VT1& result, const VT2& expected, const char* solver,
+                       double tolerance ) const;
+
+   void checkConvergence( bool converged, const blaze::Solver& solver, const char* name ) const;
+   void checkStagnation ( bool converged, const blaze::Solver& solver, const char* name ) const;
+
+   void checkColoring( const blaze::PGS& pgs, const blaze::CompressedMatrix<double>& A,
+                       size_t bs ) const;
+
+   template< typename VT1, typename VT2 >
+   double maxError( const blaze::DenseVector<VT1,false>& result,
+                    const blaze::DenseVector<VT2,false>& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the result of a solver or preconditioner.
+//
+// \param result The computed dense vector.
+// \param expected The expected dense vector.
+// \param solver The name of the solver or preconditioner.
+// \param tolerance The admissible maximum absolute difference.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+template< typename VT1    // Type of the result
+        , typename VT2 >  // Type of the expected result
+void OperationTest::checkSolution( const VT1& result, const VT2& expected, const char* solver,
+                                   double tolerance ) const
+{
+   const double error( maxError( result, expected ) );
+
+   if( !( error <= tolerance ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Incorrect result of the " << solver << " detected\n"
+          << " Details:\n"
+          << "   Tolerance    : " << tolerance << "\n"
+          << "   Maximum error: " << error << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking that a solver reports convergence.
+//
+// \param converged The return value of the solution process.
+// \param solver The solver.
+// \param name The name of the solver.
+// \return void
+// \exception std::runtime_error Missing convergence detected.
+//
+// This function checks that the solver reports convergence and that the reported precision
+// of the solution meets the threshold of the solver.
+*/
+inline void OperationTest::checkConvergence( bool converged, const blaze::Solver& solver,
+                                             const char* name ) const
+{
+   if( !converged || !( solver.getLastPrecision() <= solver.getThreshold() ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: The " << name << " did not converge\n"
+          << " Details:\n"
+          << "   Return value  : " << converged << "\n"
+          << "   Iterations    : " << solver.getLastIterations() << "\n"
+          << "   Last precision: " << solver.getLastPrecision() << "\n"
+          << "   Threshold     : " << solver.getThreshold() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking that a solver reports stagnation.
+//
+// \param converged The return value of the solution process.
+// \param solver The solver.
+// \param name The name of the solver.
+// \return void
+// \exception std::runtime_error Missing stagnation detected.
+//
+// This function checks that a solution process terminated by the relative threshold before
+// reaching the precision threshold of the solver returns \a false and reports the stagnation.
+*/
+inline void OperationTest::checkStagnation( bool converged, const blaze::Solver& solver,
+                                            const char* name ) const
+{
+   if( converged || !solver.isStagnated() ||
+       !( solver.getLastPrecision() >= solver.getThreshold() ) ||
+       solver.getLastIterations() >= solver.getMaxIterations() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: The " << name << " did not report stagnation\n"
+          << " Details:\n"
+          << "   Return value  : " << converged << "\n"
+          << "   Stagnated     : " << solver.isStagnated() << "\n"
+          << "   Iterations    : " << solver.getLastIterations() << "\n"
+          << "   Last precision: " << solver.getLastPrecision() << "\n"
+          << "   Threshold     : " << solver.getThreshold() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the coloring of the PGS solver.
+//
+// \param pgs The PGS solver after a solution process in colored mode.
+// \param A The LCP matrix of the solved problem.
+// \param bs The number of unknowns per block.
+// \return void
+// \exception std::runtime_error Invalid coloring detected.
+//
+// This function checks that every block has a valid color and that no two blocks of the same
+// color are coupled, i.e. that no row of a block has an entry in a column belonging to another
+// block of the same color.
+*/
+inline void OperationTest::checkColoring( const blaze::PGS& pgs,
+                                          const blaze::CompressedMatrix<double>& A,
+                                          size_t bs ) const
+{
+   typedef blaze::CompressedMatrix<double>::ConstIterator  ConstIterator;
+
+   const size_t colors( pgs.getColors() );
+
+   for( size_t i=0UL; i<A.rows(); ++i )
+   {
+      const size_t I( i / bs );
+
+      if( pgs.getColor( I ) >= colors ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid color detected\n"
+             << " Details:\n"
+             << "   Block : " << I << "\n"
+             << "   Color : " << pgs.getColor( I ) << "\n"
+             << "   Colors: " << colors << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( ConstIterator element=A.begin(i); element!=A.end(i); ++element )
+      {
+         const size_t J( element->index() / bs );
+
+         if( J != I && pgs.getColor( J ) == pgs.getColor( I ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Coupled blocks of the same color detected\n"
+                << " Details:\n"
+                << "   Row    : " << i << " (block " << I << ")\n"
+                << "   Column : " << element->index() << " (block " << J << ")\n"
+                << "   Color  : " << pgs.getColor( I ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the maximum absolute difference between two dense column vectors.
+//
+// \param result The computed dense vector.
+// \param expected The expected dense vector.
+// \return The maximum absolute difference (infinity in case of a size mismatch).
+*/
+template< typename VT1    // Type of the computed vector
+        , typename VT2 >  // Type of the expected vector
+double OperationTest::maxError( const blaze::DenseVector<VT1,false>& result,
+                                const blaze::DenseVector<VT2,false>& expected ) const
+{
+   if( (~result).size() != (~expected).size() )
+      return HUGE_VAL;
+
+   double error( 0.0 );
+
+   for( size_t i=0UL; i<(~result).size(); ++i )
+      error = std::max( error, std::fabs( (~result)[i] - (~expected)[i] ) );
+
+   return error;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the iterative solvers.
+//
+// \return void
+*/
+void runTest()
+{
+   OperationTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the iterative solvers operation test.
+*/
+#define RUN_SOLVERS_OPERATION_TEST \
+   blazetest::mathtest::solvers::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
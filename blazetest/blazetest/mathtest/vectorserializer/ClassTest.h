@@ -49,6 +49,7 @@
 #include <blaze/math/DynamicVector.h>
 #include <blaze/math/SparseSubvector.h>
 #include <blaze/math/StaticVector.h>
+#include <blaze/math/serialization/TypeValueMapping.h>
 #include <blaze/math/typetraits/IsDenseVector.h>
 #include <blaze/util/Random.h>
 #include <blaze/util/serialization/Archive.h>
@@ -94,6 +95,7 @@ class ClassTest
    //@{
    void testEmptyVectors ();
    void testRandomVectors();
+   void testFormat       ();
    void testFailures     ();
 
    template< size_t N, typename VT >
@@ -125,6 +127,8 @@ class ClassTest
 
    template< typename VT1, typename VT2 >
    void compareVectors( const VT1& src, const VT2& dst );
+
+   void compareStreams( const std::stringstream& result, const std::stringstream& expected );
    //@}
    //**********************************************************************************************
 
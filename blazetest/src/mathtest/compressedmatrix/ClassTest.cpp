@@ -39,6 +39,7 @@
 
 #include <cstdlib>
 #include <iostream>
+#include <utility>
 #include <blaze/math/DiagonalMatrix.h>
 #include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/DynamicVector.h>
@@ -94,6 +95,7 @@ ClassTest::ClassTest()
    testLowerBound();
    testUpperBound();
    testIsDefault();
+   testIndexType();
 }
 //*************************************************************************************************
 
@@ -362,6 +364,81 @@ void ClassTest::testConstructors()
    }
 
 
+#if BLAZE_CPP11_MODE
+   //=====================================================================================
+   // Row-major move constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompressedMatrix move constructor (2x3)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat1( 2UL, 3UL, 3UL );
+      mat1(0,0) = 1;
+      mat1(0,2) = 2;
+      mat1(1,1) = 3;
+      const blaze::CompressedMatrix<int,blaze::rowMajor>::ConstIterator data( mat1.begin( 1UL ) );
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat2( std::move( mat1 ) );
+
+      checkRows    ( mat1, 0UL );
+      checkColumns ( mat1, 0UL );
+      checkRows    ( mat2, 2UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 3UL );
+
+      if( mat2.begin( 1UL ) != data ||
+          mat2(0,0) != 1 || mat2(0,1) != 0 || mat2(0,2) != 2 ||
+          mat2(1,0) != 0 || mat2(1,1) != 3 || mat2(1,2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 0 2 )\n( 0 3 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkNonZeros( mat1, 0UL );
+
+      if( mat1.capacity() != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid capacity of the moved-from matrix\n"
+             << " Details:\n"
+             << "   Capacity         : " << mat1.capacity() << "\n"
+             << "   Expected capacity: 0\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      mat1.reserve( 4UL );
+      mat1.resize( 2UL, 2UL );
+      mat1(1,0) = 4;
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat3( std::move( mat1 ) );
+      mat1 = mat3;
+      const blaze::CompressedMatrix<int,blaze::rowMajor>::ConstIterator data2( mat2.begin( 1UL ) );
+      mat3 = std::move( mat2 );
+
+      checkRows    ( mat1, 2UL );
+      checkColumns ( mat1, 2UL );
+      checkNonZeros( mat1, 1UL );
+      checkRows    ( mat3, 2UL );
+      checkColumns ( mat3, 3UL );
+      checkNonZeros( mat3, 3UL );
+
+      if( mat1(0,0) != 0 || mat1(0,1) != 0 || mat1(1,0) != 4 || mat1(1,1) != 0 ||
+          mat3.begin( 1UL ) != data2 || mat3(1,1) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reusing a moved-from matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat1 << "\n" << mat3 << "\n"
+             << "   Expected result:\n( 0 0 )\n( 4 0 )\n\n( 1 0 2 )\n( 0 3 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+#endif
+
+
    //=====================================================================================
    // Column-major default constructor
    //=====================================================================================
@@ -607,6 +684,81 @@ void ClassTest::testConstructors()
          throw std::runtime_error( oss.str() );
       }
    }
+
+
+#if BLAZE_CPP11_MODE
+   //=====================================================================================
+   // Column-major move constructor
+   //=====================================================================================
+
+   {
+      test_ = "Column-major CompressedMatrix move constructor (2x3)";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat1( 2UL, 3UL, 3UL );
+      mat1(0,0) = 1;
+      mat1(0,2) = 2;
+      mat1(1,1) = 3;
+      const blaze::CompressedMatrix<int,blaze::columnMajor>::ConstIterator data( mat1.begin( 1UL ) );
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat2( std::move( mat1 ) );
+
+      checkRows    ( mat1, 0UL );
+      checkColumns ( mat1, 0UL );
+      checkRows    ( mat2, 2UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 3UL );
+
+      if( mat2.begin( 1UL ) != data ||
+          mat2(0,0) != 1 || mat2(0,1) != 0 || mat2(0,2) != 2 ||
+          mat2(1,0) != 0 || mat2(1,1) != 3 || mat2(1,2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 0 2 )\n( 0 3 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkNonZeros( mat1, 0UL );
+
+      if( mat1.capacity() != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid capacity of the moved-from matrix\n"
+             << " Details:\n"
+             << "   Capacity         : " << mat1.capacity() << "\n"
+             << "   Expected capacity: 0\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      mat1.reserve( 4UL );
+      mat1.resize( 2UL, 2UL );
+      mat1(1,0) = 4;
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat3( std::move( mat1 ) );
+      mat1 = mat3;
+      const blaze::CompressedMatrix<int,blaze::columnMajor>::ConstIterator data2( mat2.begin( 1UL ) );
+      mat3 = std::move( mat2 );
+
+      checkRows    ( mat1, 2UL );
+      checkColumns ( mat1, 2UL );
+      checkNonZeros( mat1, 1UL );
+      checkRows    ( mat3, 2UL );
+      checkColumns ( mat3, 3UL );
+      checkNonZeros( mat3, 3UL );
+
+      if( mat1(0,0) != 0 || mat1(0,1) != 0 || mat1(1,0) != 4 || mat1(1,1) != 0 ||
+          mat3.begin( 1UL ) != data2 || mat3(1,1) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reusing a moved-from matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat1 << "\n" << mat3 << "\n"
+             << "   Expected result:\n( 0 0 )\n( 4 0 )\n\n( 1 0 2 )\n( 0 3 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+#endif
 }
 //*************************************************************************************************
 
@@ -686,6 +838,45 @@ void ClassTest::testAssignment()
    }
 
 
+#if BLAZE_CPP11_MODE
+   //=====================================================================================
+   // Row-major move assignment
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompressedMatrix move assignment";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat1( 2UL, 3UL, 3UL );
+      mat1(0,0) = 1;
+      mat1(0,2) = 2;
+      mat1(1,1) = 3;
+      const blaze::CompressedMatrix<int,blaze::rowMajor>::ConstIterator data( mat1.begin( 1UL ) );
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat2( 3UL, 3UL );
+      mat2(2,2) = 9;
+      mat2 = std::move( mat1 );
+
+      checkRows    ( mat1, 0UL );
+      checkColumns ( mat1, 0UL );
+      checkRows    ( mat2, 2UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 3UL );
+
+      if( mat2.begin( 1UL ) != data ||
+          mat2(0,0) != 1 || mat2(0,1) != 0 || mat2(0,2) != 2 ||
+          mat2(1,0) != 0 || mat2(1,1) != 3 || mat2(1,2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 0 2 )\n( 0 3 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+#endif
+
+
    //=====================================================================================
    // Row-major dense matrix assignment
    //=====================================================================================
@@ -1267,6 +1458,45 @@ void ClassTest::testAssignment()
    }
 
 
+#if BLAZE_CPP11_MODE
+   //=====================================================================================
+   // Column-major move assignment
+   //=====================================================================================
+
+   {
+      test_ = "Column-major CompressedMatrix move assignment";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat1( 2UL, 3UL, 3UL );
+      mat1(0,0) = 1;
+      mat1(0,2) = 2;
+      mat1(1,1) = 3;
+      const blaze::CompressedMatrix<int,blaze::columnMajor>::ConstIterator data( mat1.begin( 1UL ) );
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat2( 3UL, 3UL );
+      mat2(2,2) = 9;
+      mat2 = std::move( mat1 );
+
+      checkRows    ( mat1, 0UL );
+      checkColumns ( mat1, 0UL );
+      checkRows    ( mat2, 2UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 3UL );
+
+      if( mat2.begin( 1UL ) != data ||
+          mat2(0,0) != 1 || mat2(0,1) != 0 || mat2(0,2) != 2 ||
+          mat2(1,0) != 0 || mat2(1,1) != 3 || mat2(1,2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 0 2 )\n( 0 3 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+#endif
+
+
    //=====================================================================================
    // Column-major dense matrix assignment
    //=====================================================================================
@@ -10079,6 +10309,129 @@ void ClassTest::testIsDefault()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the CompressedMatrix class template with a narrow index type.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the CompressedMatrix class template with \a unsigned \a int
+// as index type. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIndexType()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompressedMatrix with unsigned int indices";
+
+      typedef blaze::CompressedMatrix<int,blaze::rowMajor,unsigned int>     IMT;
+      typedef blaze::CompressedMatrix<int,blaze::columnMajor,unsigned int>  OIMT;
+      typedef blaze::CompressedMatrix<double,blaze::rowMajor,unsigned int>  RIMT;
+
+      BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( IMT::OppositeType         , OIMT );
+      BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( IMT::Rebind<double>::Other, RIMT );
+
+      IMT mat( 3UL, 4UL );
+      mat(0,1) = 1;
+      mat(1,3) = 2;
+      mat(2,0) = 3;
+      mat(2,3) = 4;
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 4UL );
+
+      if( mat.begin(2)->index() != 0UL || ( mat.begin(2)+1UL )->index() != 3UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid index detected\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 1 0 0 )\n( 0 0 0 2 )\n( 3 0 0 4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const blaze::CompressedMatrix<int,blaze::rowMajor> ref( mat );
+      const blaze::CompressedMatrix<int,blaze::columnMajor> tref( trans( ref ) );
+      const IMT sum ( mat + ref );
+      const IMT prod( mat * tref );
+
+      if( sum(0,1) != 2 || sum(1,3) != 4 || sum(2,0) != 6 || sum(2,3) != 8 || sum.nonZeros() != 4UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition failed\n"
+             << " Details:\n"
+             << "   Result:\n" << sum << "\n"
+             << "   Expected result:\n( 0 2 0 0 )\n( 0 0 0 4 )\n( 6 0 0 8 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( prod(0,0) != 1 || prod(1,1) != 4 || prod(1,2) != 8 || prod(2,1) != 8 || prod(2,2) != 25 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << prod << "\n"
+             << "   Expected result:\n( 1 0 0 )\n( 0 4 8 )\n( 0 8 25 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major CompressedMatrix with unsigned int indices";
+
+      typedef blaze::CompressedMatrix<int,blaze::columnMajor,unsigned int>     IMT;
+      typedef blaze::CompressedMatrix<int,blaze::rowMajor,unsigned int>        OIMT;
+      typedef blaze::CompressedMatrix<double,blaze::columnMajor,unsigned int>  RIMT;
+
+      BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( IMT::OppositeType         , OIMT );
+      BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( IMT::Rebind<double>::Other, RIMT );
+
+      IMT mat( 4UL, 3UL );
+      mat(1,0) = 1;
+      mat(3,1) = 2;
+      mat(0,2) = 3;
+      mat(3,2) = 4;
+
+      checkRows    ( mat, 4UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 4UL );
+
+      if( mat.begin(2)->index() != 0UL || ( mat.begin(2)+1UL )->index() != 3UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid index detected\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 3 )\n( 1 0 0 )\n( 0 0 0 )\n( 0 2 4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const blaze::CompressedMatrix<int,blaze::columnMajor> ref( mat );
+      const IMT diff( mat - ref );
+
+      if( diff.rows() != 4UL || diff.columns() != 3UL || diff(1,0) != 0 || diff(3,2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subtraction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << diff << "\n"
+             << "   Expected result:\n( 0 0 0 )\n( 0 0 0 )\n( 0 0 0 )\n( 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
 } // namespace compressedmatrix
 
 } // namespace mathtest
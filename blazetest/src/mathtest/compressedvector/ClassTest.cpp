@@ -39,6 +39,7 @@
 
 #include <cstdlib>
 #include <iostream>
+#include <utility>
 #include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/DynamicVector.h>
 #include <blaze/math/shims/Equal.h>
@@ -90,6 +91,7 @@ ClassTest::ClassTest()
    testLowerBound();
    testUpperBound();
    testIsDefault();
+   testIndexType();
 }
 //*************************************************************************************************
 
@@ -212,6 +214,40 @@ void ClassTest::testConstructors()
          throw std::runtime_error( oss.str() );
       }
    }
+
+
+#if BLAZE_CPP11_MODE
+   //=====================================================================================
+   // Move constructor
+   //=====================================================================================
+
+   {
+      test_ = "CompressedVector move constructor";
+
+      blaze::CompressedVector<int,blaze::rowVector> vec1( 7UL, 3UL );
+      vec1[0] = 1;
+      vec1[1] = 2;
+      vec1[3] = 4;
+      const blaze::CompressedVector<int,blaze::rowVector>::ConstIterator data( vec1.begin() );
+      blaze::CompressedVector<int,blaze::rowVector> vec2( std::move( vec1 ) );
+
+      checkSize    ( vec1, 0UL );
+      checkNonZeros( vec1, 0UL );
+      checkSize    ( vec2, 7UL );
+      checkCapacity( vec2, 3UL );
+      checkNonZeros( vec2, 3UL );
+
+      if( vec2.begin() != data || vec2[0] != 1 || vec2[1] != 2 || vec2[3] != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec2 << "\n"
+             << "   Expected result:\n( 1 2 0 4 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+#endif
 }
 //*************************************************************************************************
 
@@ -285,6 +321,42 @@ void ClassTest::testAssignment()
    }
 
 
+#if BLAZE_CPP11_MODE
+   //=====================================================================================
+   // Move assignment
+   //=====================================================================================
+
+   {
+      test_ = "CompressedVector move assignment";
+
+      blaze::CompressedVector<int,blaze::rowVector> vec1( 7UL, 3UL );
+      vec1[0] = 1;
+      vec1[1] = 2;
+      vec1[3] = 4;
+      const blaze::CompressedVector<int,blaze::rowVector>::ConstIterator data( vec1.begin() );
+      blaze::CompressedVector<int,blaze::rowVector> vec2( 4UL, 2UL );
+      vec2[2] = 9;
+      vec2 = std::move( vec1 );
+
+      checkSize    ( vec1, 0UL );
+      checkNonZeros( vec1, 0UL );
+      checkSize    ( vec2, 7UL );
+      checkCapacity( vec2, 3UL );
+      checkNonZeros( vec2, 3UL );
+
+      if( vec2.begin() != data || vec2[0] != 1 || vec2[1] != 2 || vec2[3] != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec2 << "\n"
+             << "   Expected result:\n( 1 2 0 4 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+#endif
+
+
    //=====================================================================================
    // Dense vector assignment
    //=====================================================================================
@@ -2938,6 +3010,70 @@ void ClassTest::testIsDefault()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the CompressedVector class template with a narrow index type.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the CompressedVector class template with \a unsigned \a int
+// as index type. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIndexType()
+{
+   test_ = "CompressedVector with unsigned int indices";
+
+   typedef blaze::CompressedVector<int,blaze::rowVector,unsigned int>     IVT;
+   typedef blaze::CompressedVector<int,blaze::columnVector,unsigned int>  TIVT;
+   typedef blaze::CompressedVector<double,blaze::rowVector,unsigned int>  RIVT;
+
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( IVT::TransposeType        , TIVT );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( IVT::Rebind<double>::Other, RIVT );
+
+   IVT vec( 7UL );
+   vec[1] = 1;
+   vec[4] = 2;
+   vec[6] = 3;
+
+   checkSize    ( vec, 7UL );
+   checkNonZeros( vec, 3UL );
+
+   if( vec.begin()->index() != 1UL || ( vec.begin()+2UL )->index() != 6UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid index detected\n"
+          << " Details:\n"
+          << "   Result:\n" << vec << "\n"
+          << "   Expected result:\n( 0 1 0 0 2 0 3 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   const blaze::CompressedVector<int,blaze::rowVector> ref( vec );
+   const IVT sum( vec + ref );
+
+   if( sum[1] != 2 || sum[4] != 4 || sum[6] != 6 || sum.nonZeros() != 3UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Addition failed\n"
+          << " Details:\n"
+          << "   Result:\n" << sum << "\n"
+          << "   Expected result:\n( 0 2 0 0 4 0 6 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( vec * trans( ref ) != 14 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Inner product failed\n"
+          << " Details:\n"
+          << "   Result: " << ( vec * trans( ref ) ) << "\n"
+          << "   Expected result: 14\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
 } // namespace compressedvector
 
 } // namespace mathtest
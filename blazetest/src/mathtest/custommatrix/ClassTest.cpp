@@ -0,0 +1,1369 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/custommatrix/ClassTest.cpp
+//  \brief Source file for the CustomMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Memory.h>
+#include <blazetest/mathtest/custommatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace custommatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the CustomMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testAddAssign();
+   testSubAssign();
+   testMultAssign();
+   testScaling();
+   testFunctionCall();
+   testNonZeros();
+   testReset();
+   testClear();
+   testTranspose();
+   testSwap();
+   testIsDefault();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the CustomMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the CustomMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Row-major default constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CustomMatrix default constructor";
+
+      UMT mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Row-major unpadded constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CustomMatrix unpadded constructor";
+
+      blaze::UniqueArray<int> array( new int[7UL] );
+      array[1] = 1; array[2] = 0; array[3] = 2; array[4] = 0; array[5] = 3; array[6] = 4;
+      UMT mat( array.get()+1UL, 2UL, 3UL );
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 6UL );
+      checkNonZeros( mat, 4UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 1UL, 2UL );
+
+      if( mat(0,0) != 1 || mat(0,1) != 0 || mat(0,2) != 2 ||
+          mat(1,0) != 0 || mat(1,1) != 3 || mat(1,2) != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 2 )\n( 0 3 4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major CustomMatrix unpadded constructor (invalid spacing)";
+
+      blaze::UniqueArray<int> array( new int[6UL] );
+
+      try {
+         UMT mat( array.get(), 2UL, 3UL, 2UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup with a too small spacing succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Row-major padded constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CustomMatrix padded constructor";
+
+      blaze::UniqueArray<int,blaze::Deallocate> array( blaze::allocate<int>( 32UL ) );
+      for( size_t i=0UL; i<32UL; ++i ) array[i] = 5;
+      AMT mat( array.get(), 2UL, 3UL, 16UL );
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 32UL );
+      checkNonZeros( mat, 6UL );
+
+      if( mat.spacing() != 16UL || mat(1,0) != 5 || mat.data(1) != array.get()+16UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 5 5 5 )\n( 5 5 5 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( BLAZE_SSE2_MODE && ( array[3] != 0 || array[19] != 0 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Padding elements have not been reset\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major CustomMatrix padded constructor (null pointer)";
+
+      try {
+         AMT mat( NULL, 2UL, 3UL, 16UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup with a null pointer succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+#if BLAZE_SSE2_MODE
+   {
+      test_ = "Row-major CustomMatrix padded constructor (misaligned spacing)";
+
+      blaze::UniqueArray<int,blaze::Deallocate> array( blaze::allocate<int>( 32UL ) );
+
+      try {
+         AMT mat( array.get(), 2UL, 3UL, 5UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup with a misaligned spacing succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+#endif
+
+
+   //=====================================================================================
+   // Row-major copy constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CustomMatrix copy constructor";
+
+      blaze::UniqueArray<int> array( new int[6UL] );
+      UMT mat1( array.get(), 2UL, 3UL );
+      mat1 = 1;
+      UMT mat2( mat1 );
+
+      checkRows    ( mat2, 2UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 6UL );
+
+      if( mat2.data() != mat1.data() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Copy construction did not share the array of elements\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major default constructor
+   //=====================================================================================
+
+   {
+      test_ = "Column-major CustomMatrix default constructor";
+
+      OUMT mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Column-major unpadded constructor
+   //=====================================================================================
+
+   {
+      test_ = "Column-major CustomMatrix unpadded constructor";
+
+      blaze::UniqueArray<int> array( new int[6UL] );
+      array[0] = 1; array[1] = 0; array[2] = 0; array[3] = 3; array[4] = 2; array[5] = 4;
+      OUMT mat( array.get(), 2UL, 3UL );
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 6UL );
+      checkNonZeros( mat, 4UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 2UL );
+
+      if( mat(0,0) != 1 || mat(0,1) != 0 || mat(0,2) != 2 ||
+          mat(1,0) != 0 || mat(1,1) != 3 || mat(1,2) != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 2 )\n( 0 3 4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major padded constructor
+   //=====================================================================================
+
+   {
+      test_ = "Column-major CustomMatrix padded constructor";
+
+      blaze::UniqueArray<int,blaze::Deallocate> array( blaze::allocate<int>( 48UL ) );
+      for( size_t i=0UL; i<48UL; ++i ) array[i] = 5;
+      OAMT mat( array.get(), 2UL, 3UL, 16UL );
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 48UL );
+      checkNonZeros( mat, 6UL );
+
+      if( mat.spacing() != 16UL || mat(0,2) != 5 || mat.data(2) != array.get()+32UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 5 5 5 )\n( 5 5 5 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( BLAZE_SSE2_MODE && ( array[2] != 0 || array[34] != 0 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Padding elements have not been reset\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CustomMatrix padded constructor (insufficient spacing)";
+
+      blaze::UniqueArray<int,blaze::Deallocate> array( blaze::allocate<int>( 48UL ) );
+
+      try {
+         OAMT mat( array.get(), 5UL, 3UL, 4UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup with insufficient spacing succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CustomMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the CustomMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   //=====================================================================================
+   // Row-major homogeneous assignment
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CustomMatrix homogeneous assignment";
+
+      blaze::UniqueArray<int> array( new int[8UL] );
+      array[3] = 7; array[7] = 7;
+      UMT mat( array.get(), 2UL, 3UL, 4UL );
+      mat = 2;
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 6UL );
+
+      if( mat(0,0) != 2 || mat(1,2) != 2 || array[3] != 7 || array[7] != 7 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 2 2 2 )\n( 2 2 2 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Row-major array assignment
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CustomMatrix array assignment";
+
+      blaze::UniqueArray<int> memory( new int[6UL] );
+      UMT mat( memory.get(), 2UL, 3UL );
+      const int array[2][3] = { { 1, 0, 2 }, { 3 } };
+      mat = array;
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+
+      if( mat(0,0) != 1 || mat(0,1) != 0 || mat(0,2) != 2 ||
+          mat(1,0) != 3 || mat(1,1) != 0 || mat(1,2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 2 )\n( 3 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Row-major dense matrix assignment
+   //=====================================================================================
+
+   {
+      test_ = "Row-major/row-major CustomMatrix dense matrix assignment";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> mat1( 2UL, 3UL, 0 );
+      mat1(0,0) = 1; mat1(0,2) = 2; mat1(1,1) = 3;
+
+      blaze::UniqueArray<int,blaze::Deallocate> array( blaze::allocate<int>( 32UL ) );
+      AMT mat2( array.get(), 2UL, 3UL, 16UL );
+      mat2 = mat1;
+
+      checkRows    ( mat2, 2UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 3UL );
+
+      if( mat2 != mat1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 0 2 )\n( 0 3 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major/column-major CustomMatrix dense matrix assignment";
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> mat1( 2UL, 3UL, 0 );
+      mat1(0,0) = 1; mat1(0,2) = 2; mat1(1,1) = 3;
+
+      blaze::UniqueArray<int> array( new int[6UL] );
+      UMT mat2( array.get(), 2UL, 3UL );
+      mat2 = mat1;
+
+      checkNonZeros( mat2, 3UL );
+
+      if( mat2 != mat1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 0 2 )\n( 0 3 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major CustomMatrix dense matrix assignment (size mismatch)";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> mat1( 3UL, 2UL, 0 );
+
+      blaze::UniqueArray<int> array( new int[6UL] );
+      UMT mat2( array.get(), 2UL, 3UL );
+
+      try {
+         mat2 = mat1;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of matrices with different sizes succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Row-major sparse matrix assignment
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CustomMatrix sparse matrix assignment";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat1( 2UL, 3UL );
+      mat1(0,1) = 4;
+      mat1(1,2) = 5;
+
+      blaze::UniqueArray<int> array( new int[6UL] );
+      UMT mat2( array.get(), 2UL, 3UL );
+      mat2 = 9;
+      mat2 = mat1;
+
+      checkNonZeros( mat2, 2UL );
+
+      if( mat2 != mat1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 0 4 0 )\n( 0 0 5 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major dense matrix assignment
+   //=====================================================================================
+
+   {
+      test_ = "Column-major/row-major CustomMatrix dense matrix assignment";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> mat1( 2UL, 3UL, 0 );
+      mat1(0,0) = 1; mat1(0,2) = 2; mat1(1,1) = 3;
+
+      blaze::UniqueArray<int,blaze::Deallocate> array( blaze::allocate<int>( 48UL ) );
+      OAMT mat2( array.get(), 2UL, 3UL, 16UL );
+      mat2 = mat1;
+
+      checkNonZeros( mat2, 3UL );
+
+      if( mat2 != mat1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 0 2 )\n( 0 3 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major/column-major CustomMatrix dense matrix assignment";
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> mat1( 2UL, 3UL, 0 );
+      mat1(0,0) = 1; mat1(0,2) = 2; mat1(1,1) = 3;
+
+      blaze::UniqueArray<int,blaze::Deallocate> array( blaze::allocate<int>( 48UL ) );
+      OAMT mat2( array.get(), 2UL, 3UL, 16UL );
+      mat2 = mat1;
+
+      checkNonZeros( mat2, 3UL );
+
+      if( mat2 != mat1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 0 2 )\n( 0 3 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major sparse matrix assignment
+   //=====================================================================================
+
+   {
+      test_ = "Column-major CustomMatrix sparse matrix assignment";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat1( 2UL, 3UL );
+      mat1(0,1) = 4;
+      mat1(1,2) = 5;
+
+      blaze::UniqueArray<int> array( new int[6UL] );
+      OUMT mat2( array.get(), 2UL, 3UL );
+      mat2 = 9;
+      mat2 = mat1;
+
+      checkNonZeros( mat2, 2UL );
+
+      if( mat2 != mat1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 0 4 0 )\n( 0 0 5 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CustomMatrix addition assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the addition assignment operators of the CustomMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAddAssign()
+{
+   {
+      test_ = "Row-major CustomMatrix dense matrix addition assignment";
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> mat1( 2UL, 3UL, 0 );
+      mat1(0,0) = 1; mat1(0,2) = 2; mat1(1,1) = -1;
+
+      blaze::UniqueArray<int,blaze::Deallocate> array( blaze::allocate<int>( 32UL ) );
+      AMT mat2( array.get(), 2UL, 3UL, 16UL );
+      mat2 = 1;
+      mat2 += mat1;
+
+      checkNonZeros( mat2, 5UL );
+
+      if( mat2(0,0) != 2 || mat2(0,1) != 1 || mat2(0,2) != 3 ||
+          mat2(1,0) != 1 || mat2(1,1) != 0 || mat2(1,2) != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 2 1 3 )\n( 1 0 1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CustomMatrix sparse matrix addition assignment";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat1( 2UL, 3UL );
+      mat1(0,1) = 4;
+      mat1(1,2) = -1;
+
+      blaze::UniqueArray<int> array( new int[6UL] );
+      OUMT mat2( array.get(), 2UL, 3UL );
+      mat2 = 1;
+      mat2 += mat1;
+
+      checkNonZeros( mat2, 5UL );
+
+      if( mat2(0,0) != 1 || mat2(0,1) != 5 || mat2(0,2) != 1 ||
+          mat2(1,0) != 1 || mat2(1,1) != 1 || mat2(1,2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 5 1 )\n( 1 1 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CustomMatrix subtraction assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the subtraction assignment operators of the CustomMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSubAssign()
+{
+   {
+      test_ = "Row-major CustomMatrix sparse matrix subtraction assignment";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat1( 2UL, 3UL );
+      mat1(0,1) = 4;
+      mat1(1,2) = 1;
+
+      blaze::UniqueArray<int> array( new int[6UL] );
+      UMT mat2( array.get(), 2UL, 3UL );
+      mat2 = 1;
+      mat2 -= mat1;
+
+      checkNonZeros( mat2, 5UL );
+
+      if( mat2(0,0) != 1 || mat2(0,1) != -3 || mat2(0,2) != 1 ||
+          mat2(1,0) != 1 || mat2(1,1) !=  1 || mat2(1,2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subtraction assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 -3 1 )\n( 1 1 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CustomMatrix dense matrix subtraction assignment";
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> mat1( 2UL, 3UL, 0 );
+      mat1(0,0) = 1; mat1(0,2) = 2; mat1(1,1) = -1;
+
+      blaze::UniqueArray<int,blaze::Deallocate> array( blaze::allocate<int>( 48UL ) );
+      OAMT mat2( array.get(), 2UL, 3UL, 16UL );
+      mat2 = 1;
+      mat2 -= mat1;
+
+      checkNonZeros( mat2, 5UL );
+
+      if( mat2(0,0) != 0 || mat2(0,1) != 1 || mat2(0,2) != -1 ||
+          mat2(1,0) != 1 || mat2(1,1) != 2 || mat2(1,2) !=  1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subtraction assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 0 1 -1 )\n( 1 2 1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CustomMatrix multiplication assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiplication assignment operators of the CustomMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultAssign()
+{
+   {
+      test_ = "Row-major CustomMatrix dense matrix multiplication assignment";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> mat1( 3UL, 3UL, 0 );
+      mat1(0,1) = 2; mat1(1,0) = 1; mat1(2,2) = 3;
+
+      blaze::UniqueArray<int,blaze::Deallocate> array( blaze::allocate<int>( 32UL ) );
+      AMT mat2( array.get(), 2UL, 3UL, 16UL );
+      mat2(0,0) = 1; mat2(0,1) = 2; mat2(0,2) = 3;
+      mat2(1,0) = 4; mat2(1,1) = 5; mat2(1,2) = 6;
+      mat2 *= mat1;
+
+      if( mat2(0,0) != 2 || mat2(0,1) !=  2 || mat2(0,2) !=  9 ||
+          mat2(1,0) != 5 || mat2(1,1) !=  8 || mat2(1,2) != 18 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 2 2 9 )\n( 5 8 18 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CustomMatrix sparse matrix multiplication assignment";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat1( 3UL, 3UL );
+      mat1(0,1) = 2;
+      mat1(1,0) = 1;
+      mat1(2,2) = 3;
+
+      blaze::UniqueArray<int> array( new int[6UL] );
+      OUMT mat2( array.get(), 2UL, 3UL );
+      mat2(0,0) = 1; mat2(0,1) = 2; mat2(0,2) = 3;
+      mat2(1,0) = 4; mat2(1,1) = 5; mat2(1,2) = 6;
+      mat2 *= mat1;
+
+      if( mat2(0,0) != 2 || mat2(0,1) !=  2 || mat2(0,2) !=  9 ||
+          mat2(1,0) != 5 || mat2(1,1) !=  8 || mat2(1,2) != 18 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 2 2 9 )\n( 5 8 18 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major CustomMatrix multiplication assignment (non-square right-hand side)";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> mat1( 3UL, 2UL, 1 );
+
+      blaze::UniqueArray<int> array( new int[6UL] );
+      UMT mat2( array.get(), 2UL, 3UL );
+
+      try {
+         mat2 *= mat1;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication assignment with a non-square matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of all CustomMatrix (self-)scaling operations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all available ways to scale an instance of the CustomMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testScaling()
+{
+   {
+      test_ = "Row-major self-scaling (M*=s)";
+
+      blaze::UniqueArray<int,blaze::Deallocate> array( blaze::allocate<int>( 32UL ) );
+      AMT mat( array.get(), 2UL, 3UL, 16UL );
+      mat = 0;
+      mat(0,1) = 1;
+      mat(1,2) = -2;
+      mat *= 3;
+
+      checkNonZeros( mat, 2UL );
+
+      if( mat(0,1) != 3 || mat(1,2) != -6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed self-scaling operation\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 3 0 )\n( 0 0 -6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major self-scaling (M/=s)";
+
+      blaze::UniqueArray<int> array( new int[6UL] );
+      OUMT mat( array.get(), 2UL, 3UL );
+      mat = 0;
+      mat(0,1) = 4;
+      mat(1,2) = -8;
+      mat /= 2;
+
+      checkNonZeros( mat, 2UL );
+
+      if( mat(0,1) != 2 || mat(1,2) != -4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed self-scaling operation\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 2 0 )\n( 0 0 -4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CustomMatrix::scale()";
+
+      blaze::UniqueArray<int,blaze::Deallocate> array( blaze::allocate<int>( 48UL ) );
+      OAMT mat( array.get(), 2UL, 3UL, 16UL );
+      mat = 1;
+      mat.scale( 2 );
+
+      if( mat(0,0) != 2 || mat(1,2) != 2 || ( BLAZE_SSE2_MODE && array[2] != 0 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Scale operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 2 2 2 )\n( 2 2 2 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CustomMatrix function call operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of adding and accessing elements via the function call operator
+// of the CustomMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testFunctionCall()
+{
+   {
+      test_ = "Row-major CustomMatrix::operator()";
+
+      blaze::UniqueArray<int> array( new int[8UL] );
+      UMT mat( array.get(), 2UL, 3UL, 4UL );
+      mat = 0;
+
+      mat(0,2) = 1;
+      mat(1,1) = mat(0,2) + 2;
+      mat(1,0) = mat(1,1) * 2;
+
+      checkNonZeros( mat, 3UL );
+
+      if( array[2] != 1 || array[5] != 3 || array[4] != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Function call operator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 1 )\n( 6 3 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CustomMatrix::operator()";
+
+      blaze::UniqueArray<int> array( new int[9UL] );
+      OUMT mat( array.get(), 2UL, 3UL, 3UL );
+      mat = 0;
+
+      mat(0,2) = 1;
+      mat(1,1) = mat(0,2) + 2;
+      mat(1,0) = mat(1,1) * 2;
+
+      checkNonZeros( mat, 3UL );
+
+      if( array[6] != 1 || array[4] != 3 || array[1] != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Function call operator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 1 )\n( 6 3 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the nonZeros() member function of the CustomMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the nonZeros() member function of the CustomMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNonZeros()
+{
+   {
+      test_ = "Row-major CustomMatrix::nonZeros()";
+
+      blaze::UniqueArray<int,blaze::Deallocate> array( blaze::allocate<int>( 32UL ) );
+      for( size_t i=0UL; i<32UL; ++i ) array[i] = 1;
+      AMT mat( array.get(), 2UL, 3UL, 16UL );
+      mat = 0;
+
+      checkNonZeros( mat, 0UL );
+
+      mat(0,1) = 2;
+      mat(1,0) = 3;
+      mat(1,2) = 4;
+
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 2UL );
+   }
+
+   {
+      test_ = "Column-major CustomMatrix::nonZeros()";
+
+      blaze::UniqueArray<int,blaze::Deallocate> array( blaze::allocate<int>( 48UL ) );
+      for( size_t i=0UL; i<48UL; ++i ) array[i] = 1;
+      OAMT mat( array.get(), 2UL, 3UL, 16UL );
+      mat = 0;
+
+      checkNonZeros( mat, 0UL );
+
+      mat(0,1) = 2;
+      mat(1,0) = 3;
+      mat(1,2) = 4;
+
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 1UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the reset() member function of the CustomMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the reset() member function of the CustomMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReset()
+{
+   {
+      test_ = "Row-major CustomMatrix::reset()";
+
+      blaze::UniqueArray<int> array1( new int[6UL] );
+      blaze::UniqueArray<int> array2( new int[4UL] );
+      UMT mat( array1.get(), 2UL, 3UL );
+      mat = 2;
+
+      reset( mat, 1UL );
+
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 3UL );
+      checkNonZeros( mat, 1UL, 0UL );
+
+      reset( mat );
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 0UL );
+
+      array2[0] = 1; array2[1] = 2; array2[2] = 3; array2[3] = 4;
+      mat.reset( array2.get(), 2UL, 2UL );
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 2UL );
+      checkNonZeros( mat, 4UL );
+
+      if( mat.data() != array2.get() || mat(1,0) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reset operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 2 )\n( 3 4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CustomMatrix::reset()";
+
+      blaze::UniqueArray<int> array( new int[6UL] );
+      OUMT mat( array.get(), 2UL, 3UL );
+      mat = 2;
+
+      reset( mat, 1UL );
+
+      checkNonZeros( mat, 4UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 2UL );
+
+      reset( mat );
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 0UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the clear() member function of the CustomMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the clear() member function of the CustomMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testClear()
+{
+   {
+      test_ = "Row-major CustomMatrix::clear()";
+
+      blaze::UniqueArray<int> array( new int[6UL] );
+      UMT mat( array.get(), 2UL, 3UL );
+      mat = 2;
+
+      clear( mat );
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+
+      if( array[0] != 2 || array[5] != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Clear operation modified the array of elements\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CustomMatrix::clear()";
+
+      blaze::UniqueArray<int> array( new int[6UL] );
+      OUMT mat( array.get(), 2UL, 3UL );
+      mat = 2;
+
+      clear( mat );
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the transpose() member function of the CustomMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the transpose() member function of the CustomMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testTranspose()
+{
+   {
+      test_ = "Row-major CustomMatrix::transpose()";
+
+      blaze::UniqueArray<int,blaze::Deallocate> array( blaze::allocate<int>( 48UL ) );
+      AMT mat( array.get(), 3UL, 3UL, 16UL );
+      mat(0,0) = 1; mat(0,1) = 2; mat(0,2) = 3;
+      mat(1,0) = 4; mat(1,1) = 5; mat(1,2) = 6;
+      mat(2,0) = 7; mat(2,1) = 8; mat(2,2) = 9;
+
+      mat.transpose();
+
+      if( mat(0,0) != 1 || mat(0,1) != 4 || mat(0,2) != 7 ||
+          mat(1,0) != 2 || mat(1,1) != 5 || mat(1,2) != 8 ||
+          mat(2,0) != 3 || mat(2,1) != 6 || mat(2,2) != 9 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Transpose operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 4 7 )\n( 2 5 8 )\n( 3 6 9 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CustomMatrix::transpose()";
+
+      blaze::UniqueArray<int> array( new int[9UL] );
+      OUMT mat( array.get(), 3UL, 3UL );
+      mat(0,0) = 1; mat(0,1) = 2; mat(0,2) = 3;
+      mat(1,0) = 4; mat(1,1) = 5; mat(1,2) = 6;
+      mat(2,0) = 7; mat(2,1) = 8; mat(2,2) = 9;
+
+      mat.transpose();
+
+      if( mat(0,0) != 1 || mat(0,1) != 4 || mat(0,2) != 7 ||
+          mat(1,0) != 2 || mat(1,1) != 5 || mat(1,2) != 8 ||
+          mat(2,0) != 3 || mat(2,1) != 6 || mat(2,2) != 9 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Transpose operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 4 7 )\n( 2 5 8 )\n( 3 6 9 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major CustomMatrix::transpose() (non-square matrix)";
+
+      blaze::UniqueArray<int> array( new int[6UL] );
+      UMT mat( array.get(), 2UL, 3UL );
+
+      try {
+         mat.transpose();
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Transposing a non-square custom matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::logic_error& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the swap functionality of the CustomMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the swap function of the CustomMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   {
+      test_ = "Row-major CustomMatrix swap";
+
+      blaze::UniqueArray<int> array1( new int[4UL] );
+      blaze::UniqueArray<int> array2( new int[6UL] );
+      UMT mat1( array1.get(), 2UL, 2UL );
+      UMT mat2( array2.get(), 2UL, 3UL );
+      mat1 = 1;
+      mat2 = 2;
+
+      swap( mat1, mat2 );
+
+      checkRows   ( mat1, 2UL );
+      checkColumns( mat1, 3UL );
+      checkRows   ( mat2, 2UL );
+      checkColumns( mat2, 2UL );
+
+      if( mat1.data() != array2.get() || mat2.data() != array1.get() ||
+          mat1(1,2) != 2 || mat2(1,1) != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Swapping the matrices failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat1 << "\n"
+             << "   Expected result:\n( 2 2 2 )\n( 2 2 2 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CustomMatrix swap";
+
+      blaze::UniqueArray<int> array1( new int[4UL] );
+      blaze::UniqueArray<int> array2( new int[6UL] );
+      OUMT mat1( array1.get(), 2UL, 2UL );
+      OUMT mat2( array2.get(), 3UL, 2UL );
+      mat1 = 1;
+      mat2 = 2;
+
+      swap( mat1, mat2 );
+
+      checkRows   ( mat1, 3UL );
+      checkColumns( mat1, 2UL );
+      checkRows   ( mat2, 2UL );
+      checkColumns( mat2, 2UL );
+
+      if( mat1.data() != array2.get() || mat2.data() != array1.get() ||
+          mat1(2,1) != 2 || mat2(1,1) != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Swapping the matrices failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat1 << "\n"
+             << "   Expected result:\n( 2 2 )\n( 2 2 )\n( 2 2 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the isDefault() function with the CustomMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the isDefault() function with the CustomMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIsDefault()
+{
+   test_ = "isDefault() function";
+
+   // isDefault with default matrix
+   {
+      OAMT mat;
+
+      if( isDefault( mat ) != true ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isDefault evaluation\n"
+             << " Details:\n"
+             << "   Matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // isDefault with non-default matrix
+   {
+      blaze::UniqueArray<int> array( new int[6UL] );
+      UMT mat( array.get(), 2UL, 3UL );
+      mat = 0;
+
+      if( isDefault( mat ) != false ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isDefault evaluation\n"
+             << " Details:\n"
+             << "   Matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace custommatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running CustomMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_CUSTOMMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during CustomMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,1000 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/customvector/ClassTest.cpp
+//  \brief Source file for the CustomVector class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/CompressedVector.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Memory.h>
+#include <blazetest/mathtest/customvector/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace customvector {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the CustomVector class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testAddAssign();
+   testSubAssign();
+   testMultAssign();
+   testScaling();
+   testSubscript();
+   testNonZeros();
+   testReset();
+   testClear();
+   testSwap();
+   testIsDefault();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the CustomVector constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the CustomVector class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "CustomVector default constructor";
+
+      UVT vec;
+
+      checkSize    ( vec, 0UL );
+      checkNonZeros( vec, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Unpadded constructor
+   //=====================================================================================
+
+   {
+      test_ = "CustomVector unpadded constructor (unaligned)";
+
+      blaze::UniqueArray<int> array( new int[6UL] );
+      array[0] = 1; array[1] = 2; array[2] = 0; array[3] = 4; array[4] = 0; array[5] = 6;
+      UVT vec( array.get()+1UL, 5UL );
+
+      checkSize    ( vec, 5UL );
+      checkNonZeros( vec, 3UL );
+
+      if( vec.data() != array.get()+1UL || vec[0] != 2 || vec[2] != 4 || vec[4] != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n( 2 0 4 0 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "CustomVector unpadded constructor (null pointer)";
+
+      try {
+         UVT vec( NULL, 5UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup with a null pointer succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Padded constructor
+   //=====================================================================================
+
+   {
+      test_ = "CustomVector padded constructor (aligned)";
+
+      blaze::UniqueArray<int,blaze::Deallocate> array( blaze::allocate<int>( 16UL ) );
+      for( size_t i=0UL; i<16UL; ++i ) array[i] = 42;
+      AVT vec( array.get(), 5UL, 16UL );
+
+      checkSize    ( vec, 5UL );
+      checkCapacity( vec, 16UL );
+      checkNonZeros( vec, 5UL );
+
+      if( vec[0] != 42 || vec[4] != 42 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n( 42 42 42 42 42 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( BLAZE_SSE2_MODE && array[5] != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Padding elements have not been reset\n"
+             << " Details:\n"
+             << "   First padding element: " << array[5] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "CustomVector padded constructor (insufficient capacity)";
+
+      blaze::UniqueArray<int,blaze::Deallocate> array( blaze::allocate<int>( 16UL ) );
+
+      try {
+         AVT vec( array.get(), 5UL, 4UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup with insufficient capacity succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+#if BLAZE_SSE2_MODE
+   {
+      test_ = "CustomVector padded constructor (misaligned)";
+
+      blaze::UniqueArray<int,blaze::Deallocate> array( blaze::allocate<int>( 32UL ) );
+
+      try {
+         AVT vec( array.get()+1UL, 5UL, 16UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup with a misaligned array succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+#endif
+
+
+   //=====================================================================================
+   // Copy constructor
+   //=====================================================================================
+
+   {
+      test_ = "CustomVector copy constructor";
+
+      blaze::UniqueArray<int> array( new int[5UL] );
+      UVT vec1( array.get(), 5UL );
+      vec1 = 2;
+      UVT vec2( vec1 );
+
+      checkSize    ( vec2, 5UL );
+      checkNonZeros( vec2, 5UL );
+
+      if( vec2.data() != vec1.data() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Copy construction did not share the array of elements\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CustomVector assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the CustomVector class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   //=====================================================================================
+   // Homogeneous assignment
+   //=====================================================================================
+
+   {
+      test_ = "CustomVector homogeneous assignment";
+
+      blaze::UniqueArray<int> array( new int[4UL] );
+      UVT vec( array.get(), 3UL );
+      array[3] = 7;
+      vec = 2;
+
+      checkSize    ( vec, 3UL );
+      checkNonZeros( vec, 3UL );
+
+      if( vec[0] != 2 || vec[1] != 2 || vec[2] != 2 || array[3] != 7 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n( 2 2 2 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Array assignment
+   //=====================================================================================
+
+   {
+      test_ = "CustomVector array assignment";
+
+      blaze::UniqueArray<int> memory( new int[4UL] );
+      UVT vec( memory.get(), 4UL );
+      int array[4] = { 1, 0, 2 };
+      vec = array;
+
+      checkSize    ( vec, 4UL );
+      checkNonZeros( vec, 2UL );
+
+      if( vec[0] != 1 || vec[1] != 0 || vec[2] != 2 || vec[3] != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n( 1 0 2 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Copy assignment
+   //=====================================================================================
+
+   {
+      test_ = "CustomVector copy assignment";
+
+      blaze::UniqueArray<int> array1( new int[5UL] );
+      blaze::UniqueArray<int> array2( new int[5UL] );
+      UVT vec1( array1.get(), 5UL );
+      UVT vec2( array2.get(), 5UL );
+      vec1 = 3;
+      vec2 = vec1;
+
+      checkSize    ( vec2, 5UL );
+      checkNonZeros( vec2, 5UL );
+
+      if( vec2.data() == vec1.data() || vec2[0] != 3 || vec2[4] != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec2 << "\n"
+             << "   Expected result:\n( 3 3 3 3 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "CustomVector copy assignment (size mismatch)";
+
+      blaze::UniqueArray<int> array1( new int[5UL] );
+      blaze::UniqueArray<int> array2( new int[4UL] );
+      UVT vec1( array1.get(), 5UL );
+      UVT vec2( array2.get(), 4UL );
+
+      try {
+         vec2 = vec1;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of vectors with different sizes succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Dense vector assignment
+   //=====================================================================================
+
+   {
+      test_ = "CustomVector dense vector assignment";
+
+      blaze::DynamicVector<int,blaze::rowVector> vec1( 5UL, 0 );
+      vec1[0] = 1; vec1[1] = 2; vec1[3] = -3;
+
+      blaze::UniqueArray<int,blaze::Deallocate> array( blaze::allocate<int>( 16UL ) );
+      AVT vec2( array.get(), 5UL, 16UL );
+      vec2 = vec1;
+
+      checkSize    ( vec2, 5UL );
+      checkNonZeros( vec2, 3UL );
+
+      if( vec2[0] != 1 || vec2[1] != 2 || vec2[2] != 0 || vec2[3] != -3 || vec2[4] != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec2 << "\n"
+             << "   Expected result:\n( 1 2 0 -3 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Sparse vector assignment
+   //=====================================================================================
+
+   {
+      test_ = "CustomVector sparse vector assignment";
+
+      blaze::CompressedVector<int,blaze::rowVector> vec1( 5UL );
+      vec1[0] = 1;
+      vec1[3] = -2;
+
+      blaze::UniqueArray<int> array( new int[5UL] );
+      UVT vec2( array.get(), 5UL );
+      vec2 = 9;
+      vec2 = vec1;
+
+      checkSize    ( vec2, 5UL );
+      checkNonZeros( vec2, 2UL );
+
+      if( vec2[0] != 1 || vec2[1] != 0 || vec2[2] != 0 || vec2[3] != -2 || vec2[4] != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec2 << "\n"
+             << "   Expected result:\n( 1 0 0 -2 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CustomVector addition assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the addition assignment operators of the CustomVector class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAddAssign()
+{
+   //=====================================================================================
+   // Dense vector addition assignment
+   //=====================================================================================
+
+   {
+      test_ = "CustomVector dense vector addition assignment";
+
+      blaze::DynamicVector<int,blaze::rowVector> vec1( 5UL, 0 );
+      vec1[0] = 1; vec1[1] = 2; vec1[3] = -3;
+
+      blaze::UniqueArray<int,blaze::Deallocate> array( blaze::allocate<int>( 16UL ) );
+      AVT vec2( array.get(), 5UL, 16UL );
+      vec2 = 1;
+      vec2 += vec1;
+
+      checkSize    ( vec2, 5UL );
+      checkNonZeros( vec2, 5UL );
+
+      if( vec2[0] != 2 || vec2[1] != 3 || vec2[2] != 1 || vec2[3] != -2 || vec2[4] != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec2 << "\n"
+             << "   Expected result:\n( 2 3 1 -2 1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Sparse vector addition assignment
+   //=====================================================================================
+
+   {
+      test_ = "CustomVector sparse vector addition assignment";
+
+      blaze::CompressedVector<int,blaze::rowVector> vec1( 5UL );
+      vec1[0] = 1;
+      vec1[3] = -1;
+
+      blaze::UniqueArray<int> array( new int[5UL] );
+      UVT vec2( array.get(), 5UL );
+      vec2 = 1;
+      vec2 += vec1;
+
+      checkSize    ( vec2, 5UL );
+      checkNonZeros( vec2, 4UL );
+
+      if( vec2[0] != 2 || vec2[1] != 1 || vec2[2] != 1 || vec2[3] != 0 || vec2[4] != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec2 << "\n"
+             << "   Expected result:\n( 2 1 1 0 1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CustomVector subtraction assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the subtraction assignment operators of the CustomVector
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSubAssign()
+{
+   //=====================================================================================
+   // Dense vector subtraction assignment
+   //=====================================================================================
+
+   {
+      test_ = "CustomVector dense vector subtraction assignment";
+
+      blaze::DynamicVector<int,blaze::rowVector> vec1( 5UL, 0 );
+      vec1[0] = 1; vec1[1] = 2; vec1[3] = -3;
+
+      blaze::UniqueArray<int> array( new int[5UL] );
+      UVT vec2( array.get(), 5UL );
+      vec2 = 1;
+      vec2 -= vec1;
+
+      checkSize    ( vec2, 5UL );
+      checkNonZeros( vec2, 4UL );
+
+      if( vec2[0] != 0 || vec2[1] != -1 || vec2[2] != 1 || vec2[3] != 4 || vec2[4] != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subtraction assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec2 << "\n"
+             << "   Expected result:\n( 0 -1 1 4 1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Sparse vector subtraction assignment
+   //=====================================================================================
+
+   {
+      test_ = "CustomVector sparse vector subtraction assignment";
+
+      blaze::CompressedVector<int,blaze::rowVector> vec1( 5UL );
+      vec1[0] = 1;
+      vec1[3] = -1;
+
+      blaze::UniqueArray<int,blaze::Deallocate> array( blaze::allocate<int>( 16UL ) );
+      AVT vec2( array.get(), 5UL, 16UL );
+      vec2 = 1;
+      vec2 -= vec1;
+
+      checkSize    ( vec2, 5UL );
+      checkNonZeros( vec2, 4UL );
+
+      if( vec2[0] != 0 || vec2[1] != 1 || vec2[2] != 1 || vec2[3] != 2 || vec2[4] != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subtraction assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec2 << "\n"
+             << "   Expected result:\n( 0 1 1 2 1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CustomVector multiplication assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiplication assignment operators of the CustomVector
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultAssign()
+{
+   //=====================================================================================
+   // Dense vector multiplication assignment
+   //=====================================================================================
+
+   {
+      test_ = "CustomVector dense vector multiplication assignment";
+
+      blaze::DynamicVector<int,blaze::rowVector> vec1( 5UL, 0 );
+      vec1[0] = 1; vec1[1] = 2; vec1[3] = -3;
+
+      blaze::UniqueArray<int,blaze::Deallocate> array( blaze::allocate<int>( 16UL ) );
+      AVT vec2( array.get(), 5UL, 16UL );
+      vec2 = 2;
+      vec2 *= vec1;
+
+      checkSize    ( vec2, 5UL );
+      checkNonZeros( vec2, 3UL );
+
+      if( vec2[0] != 2 || vec2[1] != 4 || vec2[2] != 0 || vec2[3] != -6 || vec2[4] != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec2 << "\n"
+             << "   Expected result:\n( 2 4 0 -6 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Sparse vector multiplication assignment
+   //=====================================================================================
+
+   {
+      test_ = "CustomVector sparse vector multiplication assignment";
+
+      blaze::CompressedVector<int,blaze::rowVector> vec1( 5UL );
+      vec1[0] = 1;
+      vec1[3] = -2;
+
+      blaze::UniqueArray<int> array( new int[5UL] );
+      UVT vec2( array.get(), 5UL );
+      vec2 = 3;
+      vec2 *= vec1;
+
+      checkSize    ( vec2, 5UL );
+      checkNonZeros( vec2, 2UL );
+
+      if( vec2[0] != 3 || vec2[1] != 0 || vec2[2] != 0 || vec2[3] != -6 || vec2[4] != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec2 << "\n"
+             << "   Expected result:\n( 3 0 0 -6 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of all CustomVector (self-)scaling operations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all available ways to scale an instance of the CustomVector
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testScaling()
+{
+   //=====================================================================================
+   // Self-scaling (v*=s)
+   //=====================================================================================
+
+   {
+      test_ = "CustomVector self-scaling (v*=s)";
+
+      blaze::UniqueArray<int> array( new int[3UL] );
+      UVT vec( array.get(), 3UL );
+      vec[0] = 1; vec[1] = 0; vec[2] = -2;
+      vec *= 3;
+
+      checkSize    ( vec, 3UL );
+      checkNonZeros( vec, 2UL );
+
+      if( vec[0] != 3 || vec[1] != 0 || vec[2] != -6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed self-scaling operation\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n( 3 0 -6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Self-scaling (v=v/s)
+   //=====================================================================================
+
+   {
+      test_ = "CustomVector self-scaling (v=v/s)";
+
+      blaze::UniqueArray<int,blaze::Deallocate> array( blaze::allocate<int>( 16UL ) );
+      AVT vec( array.get(), 3UL, 16UL );
+      vec[0] = 4; vec[1] = 0; vec[2] = -8;
+      vec = vec / 2;
+
+      checkSize    ( vec, 3UL );
+      checkNonZeros( vec, 2UL );
+
+      if( vec[0] != 2 || vec[1] != 0 || vec[2] != -4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed self-scaling operation\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n( 2 0 -4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // CustomVector::scale()
+   //=====================================================================================
+
+   {
+      test_ = "CustomVector::scale()";
+
+      blaze::UniqueArray<int> array( new int[3UL] );
+      UVT vec( array.get(), 3UL );
+      vec[0] = 1; vec[1] = 2; vec[2] = 3;
+      vec.scale( 2 );
+
+      if( vec[0] != 2 || vec[1] != 4 || vec[2] != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Scale operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n( 2 4 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CustomVector subscript operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of adding and accessing elements via the subscript operator
+// of the CustomVector class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testSubscript()
+{
+   test_ = "CustomVector::operator[]";
+
+   blaze::UniqueArray<int> array( new int[5UL] );
+   UVT vec( array.get(), 5UL );
+   vec = 0;
+
+   vec[2] = 1;
+   vec[4] = vec[2] + 2;
+   vec[0] = vec[4] * 2;
+
+   checkSize    ( vec, 5UL );
+   checkNonZeros( vec, 3UL );
+
+   if( vec[0] != 6 || vec[1] != 0 || vec[2] != 1 || vec[3] != 0 || vec[4] != 3 ||
+       array[0] != 6 || array[4] != 3 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Subscript operator failed\n"
+          << " Details:\n"
+          << "   Result:\n" << vec << "\n"
+          << "   Expected result:\n( 6 0 1 0 3 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the nonZeros() member function of the CustomVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the nonZeros() member function of the CustomVector class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNonZeros()
+{
+   test_ = "CustomVector::nonZeros()";
+
+   blaze::UniqueArray<int,blaze::Deallocate> array( blaze::allocate<int>( 16UL ) );
+   for( size_t i=0UL; i<16UL; ++i ) array[i] = 1;
+   AVT vec( array.get(), 4UL, 16UL );
+   vec = 0;
+
+   checkSize    ( vec, 4UL );
+   checkNonZeros( vec, 0UL );
+
+   vec[1] = 5;
+   vec[3] = 7;
+
+   checkNonZeros( vec, 2UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the reset() member function of the CustomVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the reset() member function of the CustomVector class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReset()
+{
+   test_ = "CustomVector::reset()";
+
+   blaze::UniqueArray<int> array1( new int[4UL] );
+   blaze::UniqueArray<int> array2( new int[2UL] );
+   UVT vec( array1.get(), 4UL );
+   vec = 2;
+
+   reset( vec );
+
+   checkSize    ( vec, 4UL );
+   checkNonZeros( vec, 0UL );
+
+   array2[0] = 1;
+   array2[1] = 3;
+   vec.reset( array2.get(), 2UL );
+
+   checkSize    ( vec, 2UL );
+   checkNonZeros( vec, 2UL );
+
+   if( vec.data() != array2.get() || vec[0] != 1 || vec[1] != 3 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reset operation failed\n"
+          << " Details:\n"
+          << "   Result:\n" << vec << "\n"
+          << "   Expected result:\n( 1 3 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the clear() member function of the CustomVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the clear() member function of the CustomVector class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testClear()
+{
+   test_ = "CustomVector::clear()";
+
+   blaze::UniqueArray<int> array( new int[4UL] );
+   UVT vec( array.get(), 4UL );
+   vec = 2;
+
+   clear( vec );
+
+   checkSize    ( vec, 0UL );
+   checkNonZeros( vec, 0UL );
+
+   if( array[0] != 2 || array[3] != 2 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Clear operation modified the array of elements\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the swap functionality of the CustomVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the swap function of the CustomVector class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   test_ = "CustomVector swap";
+
+   blaze::UniqueArray<int> array1( new int[2UL] );
+   blaze::UniqueArray<int> array2( new int[3UL] );
+   UVT vec1( array1.get(), 2UL );
+   UVT vec2( array2.get(), 3UL );
+   vec1 = 1;
+   vec2 = 2;
+
+   swap( vec1, vec2 );
+
+   checkSize( vec1, 3UL );
+   checkSize( vec2, 2UL );
+
+   if( vec1.data() != array2.get() || vec2.data() != array1.get() ||
+       vec1[0] != 2 || vec2[0] != 1 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Swapping the first vector failed\n"
+          << " Details:\n"
+          << "   Result:\n" << vec1 << "\n"
+          << "   Expected result:\n( 2 2 2 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the isDefault() function with the CustomVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the isDefault() function with the CustomVector class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIsDefault()
+{
+   test_ = "isDefault() function";
+
+   // isDefault with default vector
+   {
+      UVT vec;
+
+      if( isDefault( vec ) != true ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isDefault evaluation\n"
+             << " Details:\n"
+             << "   Vector:\n" << vec << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // isDefault with non-default vector
+   {
+      blaze::UniqueArray<int> array( new int[3UL] );
+      UVT vec( array.get(), 3UL );
+      vec = 0;
+
+      if( isDefault( vec ) != false ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isDefault evaluation\n"
+             << " Details:\n"
+             << "   Vector:\n" << vec << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace customvector
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running CustomVector class test..." << std::endl;
+
+   try
+   {
+      RUN_CUSTOMVECTOR_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during CustomVector class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,546 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/decompositions/OperationTest.cpp
+//  \brief Source file for the dense matrix decompositions operation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <blaze/math/DenseColumn.h>
+#include <blaze/math/DenseRow.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Solvers.h>
+#include <blazetest/mathtest/decompositions/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace decompositions {
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initializing the given dense matrix with reproducible pseudo-random values in [-1..1].
+//
+// \param A The dense matrix to be initialized.
+// \param seed The seed of the pseudo-random sequence.
+// \return void
+*/
+template< typename MT >  // Type of the dense matrix
+void initialize( MT& A, size_t seed )
+{
+   unsigned int state( 2654435761U * static_cast<unsigned int>( seed + 1UL ) );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         state = state * 1664525U + 1013904223U;
+         A(i,j) = double( state >> 8 ) / 8388608.0 - 1.0;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the OperationTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+{
+   testLU();
+   testCholesky();
+   testQR();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the LU decomposition.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the LUDecomposition class template. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testLU()
+{
+   const size_t bs( blaze::LUDecomposition<double>::blockSize );
+   const size_t sizes[] = { 1UL, 2UL, 7UL, bs-1UL, bs, bs+1UL, 2UL*bs+3UL };
+
+   for( size_t s=0UL; s<sizeof(sizes)/sizeof(size_t); ++s ) {
+      testLU<blaze::rowMajor   >( sizes[s] );
+      testLU<blaze::columnMajor>( sizes[s] );
+   }
+
+   test_ = "LU decomposition of invalid matrices";
+
+   // Attempt to decompose a non-square matrix
+   try {
+      const blaze::DynamicMatrix<double> A( 3UL, 4UL, 1.0 );
+      blaze::LUDecomposition<double> lu( A );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Decomposition of a non-square matrix succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   // Attempt to decompose a singular matrix (zero column in the second panel)
+   try {
+      blaze::DynamicMatrix<double> A( bs+5UL, bs+5UL );
+      initialize( A, 3UL );
+      column( A, bs+2UL ) = 0.0;
+      blaze::LUDecomposition<double> lu( A );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Decomposition of a singular matrix succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   // Attempt to solve a system with invalid right-hand side
+   try {
+      blaze::DynamicMatrix<double> A( 5UL, 5UL );
+      initialize( A, 4UL );
+      const blaze::LUDecomposition<double> lu( A );
+      blaze::DynamicVector<double> b( 4UL, 1.0 );
+      lu.solve( b );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Solving with an invalid right-hand side succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the LU decomposition of a matrix of the given size.
+//
+// \param n The number of rows and columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< bool SO >  // Storage order of the decomposed matrix
+void OperationTest::testLU( size_t n )
+{
+   test_ = ( SO == blaze::rowMajor )?( "LU decomposition of a row-major matrix" )
+                                    :( "LU decomposition of a column-major matrix" );
+
+   blaze::DynamicMatrix<double,SO> A( n, n );
+   initialize( A, n );
+
+   const blaze::LUDecomposition<double> lu( A );
+
+   // Reconstructing P*A from the factors
+   {
+      const blaze::DynamicMatrix<double,blaze::columnMajor>& LU( lu.factors() );
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> L( n, n, 0.0 ), U( n, n, 0.0 );
+      for( size_t i=0UL; i<n; ++i ) {
+         for( size_t j=0UL; j<i; ++j )
+            L(i,j) = LU(i,j);
+         L(i,i) = 1.0;
+         for( size_t j=i; j<n; ++j )
+            U(i,j) = LU(i,j);
+      }
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> PA( A );
+      for( size_t i=0UL; i<n; ++i ) {
+         if( lu.pivots()[i] != i ) {
+            const blaze::DynamicVector<double,blaze::rowVector> tmp( row( PA, i ) );
+            row( PA, i ) = row( PA, lu.pivots()[i] );
+            row( PA, lu.pivots()[i] ) = tmp;
+         }
+      }
+
+      const blaze::DynamicMatrix<double,blaze::rowMajor> LxU( L * U );
+      checkResult( LxU, PA, "reconstruction", n );
+   }
+
+   // Solving linear systems with known solution
+   {
+      blaze::DynamicVector<double> x( n );
+      for( size_t i=0UL; i<n; ++i )
+         x[i] = double( i % 7UL ) - 3.0;
+
+      const blaze::DynamicVector<double> b( A * x );
+
+      blaze::DynamicVector<double> y( b );
+      lu.solve( y );
+      checkResult( y, x, "in-place vector solve", n );
+
+      blaze::DynamicVector<double> z;
+      lu.solve( b, z );
+      checkResult( z, x, "out-of-place vector solve", n );
+
+      blaze::DynamicMatrix<double,blaze::columnMajor> X( n, 3UL );
+      initialize( X, 7UL );
+
+      blaze::DynamicMatrix<double,blaze::columnMajor> B( A * X );
+      lu.solve( B );
+      checkResult( B, X, "matrix solve", n );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the Cholesky decomposition.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the CholeskyDecomposition class template. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testCholesky()
+{
+   const size_t bs( blaze::CholeskyDecomposition<double>::blockSize );
+   const size_t sizes[] = { 1UL, 2UL, 7UL, bs-1UL, bs, bs+1UL, 2UL*bs+3UL };
+
+   for( size_t s=0UL; s<sizeof(sizes)/sizeof(size_t); ++s ) {
+      testCholesky<blaze::rowMajor   >( sizes[s] );
+      testCholesky<blaze::columnMajor>( sizes[s] );
+   }
+
+   test_ = "Cholesky decomposition of invalid matrices";
+
+   // Attempt to decompose a non-symmetric matrix
+   try {
+      blaze::DynamicMatrix<double> A( 4UL, 4UL, 0.0 );
+      for( size_t i=0UL; i<4UL; ++i )
+         A(i,i) = 4.0;
+      A(0,3) = 1.0;
+      blaze::CholeskyDecomposition<double> llh( A );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Decomposition of a non-symmetric matrix succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   // Attempt to decompose a symmetric, indefinite matrix (negative pivot in the second panel)
+   try {
+      const size_t n( bs+5UL );
+      blaze::DynamicMatrix<double> A( n, n, 0.0 );
+      for( size_t i=0UL; i<n; ++i ) {
+         A(i,i) = 2.0;
+         if( i > 0UL ) A(i,i-1UL) = A(i-1UL,i) = -1.0;
+      }
+      A(bs+2UL,bs+2UL) = -1.0;
+      blaze::CholeskyDecomposition<double> llh( A );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Decomposition of an indefinite matrix succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   // Attempt to decompose a singular, positive semi-definite matrix
+   try {
+      const blaze::DynamicMatrix<double> A( 6UL, 6UL, 1.0 );
+      blaze::CholeskyDecomposition<double> llh( A );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Decomposition of a semi-definite matrix succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the Cholesky decomposition of a matrix of the given size.
+//
+// \param n The number of rows and columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< bool SO >  // Storage order of the decomposed matrix
+void OperationTest::testCholesky( size_t n )
+{
+   test_ = ( SO == blaze::rowMajor )?( "Cholesky decomposition of a row-major matrix" )
+                                    :( "Cholesky decomposition of a column-major matrix" );
+
+   blaze::DynamicMatrix<double,SO> B( n, n );
+   initialize( B, n );
+
+   blaze::DynamicMatrix<double,SO> A( trans( B ) * B );
+   for( size_t i=0UL; i<n; ++i )
+      A(i,i) += double( n );
+
+   const blaze::CholeskyDecomposition<double> llh( A );
+
+   // Reconstructing A from the factor
+   {
+      const blaze::DynamicMatrix<double,blaze::columnMajor>& L( llh.factor() );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         for( size_t j=i+1UL; j<n; ++j ) {
+            if( L(i,j) != 0.0 ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Non-zero element in the upper part of the Cholesky factor\n"
+                   << " Details:\n"
+                   << "   Matrix size: " << n << "\n"
+                   << "   Element    : (" << i << "," << j << ")\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+
+      const blaze::DynamicMatrix<double,SO> LLH( L * trans( L ) );
+      checkResult( LLH, A, "reconstruction", n );
+   }
+
+   // Solving linear systems with known solution
+   {
+      blaze::DynamicVector<double> x( n );
+      for( size_t i=0UL; i<n; ++i )
+         x[i] = 1.0 - double( i % 5UL );
+
+      const blaze::DynamicVector<double> b( A * x );
+
+      blaze::DynamicVector<double> y( b );
+      llh.solve( y );
+      checkResult( y, x, "in-place vector solve", n );
+
+      blaze::DynamicVector<double> z;
+      llh.solve( b, z );
+      checkResult( z, x, "out-of-place vector solve", n );
+
+      blaze::DynamicMatrix<double,blaze::columnMajor> X( n, 2UL );
+      initialize( X, 11UL );
+
+      blaze::DynamicMatrix<double,blaze::columnMajor> C( A * X );
+      llh.solve( C );
+      checkResult( C, X, "matrix solve", n );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the QR decomposition.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the QRDecomposition class template. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testQR()
+{
+   const size_t bs( blaze::QRDecomposition<double>::blockSize );
+   const size_t sizes[][2] = { { 1UL, 1UL }, { 7UL, 5UL }, { bs-1UL, bs-1UL }, { bs, bs },
+                               { bs+1UL, bs+1UL }, { 2UL*bs+6UL, bs+1UL },
+                               { 3UL*bs, 2UL*bs+1UL } };
+
+   for( size_t s=0UL; s<sizeof(sizes)/sizeof(sizes[0]); ++s ) {
+      testQR<blaze::rowMajor   >( sizes[s][0], sizes[s][1] );
+      testQR<blaze::columnMajor>( sizes[s][0], sizes[s][1] );
+   }
+
+   test_ = "QR decomposition of invalid matrices";
+
+   // Attempt to decompose a matrix with more columns than rows
+   try {
+      const blaze::DynamicMatrix<double> A( 3UL, 4UL, 1.0 );
+      blaze::QRDecomposition<double> qr( A );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Decomposition of a wide matrix succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   // Attempt to solve a system with a rank-deficient matrix
+   try {
+      blaze::DynamicMatrix<double> A( bs+7UL, bs+2UL );
+      initialize( A, 5UL );
+      column( A, bs+1UL ) = 0.0;
+      const blaze::QRDecomposition<double> qr( A );
+
+      const blaze::DynamicVector<double> b( bs+7UL, 1.0 );
+      blaze::DynamicVector<double> x;
+      qr.solve( b, x );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Solving a rank-deficient system succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the QR decomposition of a matrix of the given size.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< bool SO >  // Storage order of the decomposed matrix
+void OperationTest::testQR( size_t m, size_t n )
+{
+   test_ = ( SO == blaze::rowMajor )?( "QR decomposition of a row-major matrix" )
+                                    :( "QR decomposition of a column-major matrix" );
+
+   blaze::DynamicMatrix<double,SO> A( m, n );
+   initialize( A, m+n );
+
+   const blaze::QRDecomposition<double> qr( A );
+
+   const blaze::DynamicMatrix<double,blaze::columnMajor> Q( qr.Q() );
+   const blaze::DynamicMatrix<double,blaze::columnMajor> R( qr.R() );
+
+   // Checking the orthonormality of Q
+   {
+      blaze::DynamicMatrix<double,blaze::columnMajor> I( n, n, 0.0 );
+      for( size_t i=0UL; i<n; ++i )
+         I(i,i) = 1.0;
+
+      const blaze::DynamicMatrix<double,blaze::columnMajor> QHQ( trans( Q ) * Q );
+      checkResult( QHQ, I, "orthonormality check", m );
+   }
+
+   // Reconstructing A from the factors
+   {
+      for( size_t i=0UL; i<R.rows(); ++i ) {
+         for( size_t j=0UL; j<i && j<R.columns(); ++j ) {
+            if( R(i,j) != 0.0 ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Non-zero element in the lower part of R\n"
+                   << " Details:\n"
+                   << "   Matrix size: " << m << "x" << n << "\n"
+                   << "   Element    : (" << i << "," << j << ")\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+
+      const blaze::DynamicMatrix<double,SO> QR( Q * R );
+      checkResult( QR, A, "reconstruction", m );
+   }
+
+   // Solving a consistent least squares problem with known solution
+   {
+      blaze::DynamicVector<double> x( n );
+      for( size_t i=0UL; i<n; ++i )
+         x[i] = double( i % 3UL ) + 0.5;
+
+      const blaze::DynamicVector<double> b( A * x );
+
+      blaze::DynamicVector<double> y;
+      qr.solve( b, y );
+      checkResult( y, x, "least squares solve", m );
+   }
+}
+//*************************************************************************************************
+
+} // namespace decompositions
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running dense matrix decompositions operation test..." << std::endl;
+
+   try
+   {
+      RUN_DECOMPOSITIONS_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during dense matrix decompositions operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
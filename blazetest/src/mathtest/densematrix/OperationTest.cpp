@@ -43,8 +43,10 @@
 #include <blaze/math/DiagonalMatrix.h>
 #include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/LowerMatrix.h>
+#include <blaze/math/StaticMatrix.h>
 #include <blaze/math/StrictlyLowerMatrix.h>
 #include <blaze/math/StrictlyUpperMatrix.h>
+#include <blaze/math/solvers/LUDecomposition.h>
 #include <blaze/math/SymmetricMatrix.h>
 #include <blaze/math/UniLowerMatrix.h>
 #include <blaze/math/UniUpperMatrix.h>
@@ -85,6 +87,9 @@ OperationTest::OperationTest()
    testIsIdentity();
    testMinimum();
    testMaximum();
+   testDeterminant();
+   testInversion();
+   testBlockedInversion();
 }
 //*************************************************************************************************
 
@@ -15401,6 +15406,639 @@ void OperationTest::testMaximum()
 }
 //*************************************************************************************************
 
+//*************************************************************************************************
+/*!\brief Test of the \c det() function for dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c det() function for dense matrices. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testDeterminant()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major det()";
+
+      // Determinant of a 2x2 matrix
+      {
+         const blaze::StaticMatrix<double,2UL,2UL,blaze::rowMajor> mat( 1.0, 2.0,
+                                                                         3.0, 4.0 );
+
+         const double determinant = det( mat );
+
+         if( !blaze::equal( determinant, -2.0 ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: First computation failed\n"
+                << " Details:\n"
+                << "   Result: " << determinant << "\n"
+                << "   Expected result: -2\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Determinant of a 3x3 matrix
+      {
+         const blaze::StaticMatrix<double,3UL,3UL,blaze::rowMajor> mat(  2.0, -1.0,  0.0,
+                                                                         -1.0,  2.0, -1.0,
+                                                                          0.0, -1.0,  2.0 );
+
+         const double determinant = det( mat );
+
+         if( !blaze::equal( determinant, 4.0 ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Second computation failed\n"
+                << " Details:\n"
+                << "   Result: " << determinant << "\n"
+                << "   Expected result: 4\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Determinant of a 5x5 matrix
+      {
+         blaze::DynamicMatrix<double,blaze::rowMajor> mat( 5UL, 5UL, 0.0 );
+         for( size_t i=0UL; i<5UL; ++i ) {
+            mat(i,i) = 2.0;
+            if( i > 0UL ) mat(i,i-1UL) = -1.0;
+            if( i < 4UL ) mat(i,i+1UL) = -1.0;
+         }
+
+         const double determinant = det( mat );
+
+         if( !blaze::equal( determinant, 6.0 ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Third computation failed\n"
+                << " Details:\n"
+                << "   Result: " << determinant << "\n"
+                << "   Expected result: 6\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Determinant of a 100x100 matrix
+      {
+         blaze::DynamicMatrix<double,blaze::rowMajor> mat( 100UL, 100UL, 0.0 );
+         for( size_t i=0UL; i<100UL; ++i ) {
+            mat(i,i) = 2.0;
+            if( i >  0UL ) mat(i,i-1UL) = -1.0;
+            if( i < 99UL ) mat(i,i+1UL) = -1.0;
+         }
+
+         const double determinant = det( mat );
+
+         if( !blaze::equal( determinant, 101.0 ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Fourth computation failed\n"
+                << " Details:\n"
+                << "   Result: " << determinant << "\n"
+                << "   Expected result: 101\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Determinant of a singular matrix
+      {
+         const blaze::DynamicMatrix<double,blaze::rowMajor> mat( 8UL, 8UL, 1.0 );
+
+         const double determinant = det( mat );
+
+         if( !blaze::isDefault( determinant ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Fifth computation failed\n"
+                << " Details:\n"
+                << "   Result: " << determinant << "\n"
+                << "   Expected result: 0\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Determinant of a lower matrix
+      {
+         blaze::LowerMatrix< blaze::DynamicMatrix<double,blaze::rowMajor> > mat( 3UL );
+         mat(0,0) = 2.0;
+         mat(1,0) = 7.0;
+         mat(1,1) = 3.0;
+         mat(2,0) = 8.0;
+         mat(2,1) = 9.0;
+         mat(2,2) = 4.0;
+
+         const double determinant = det( mat );
+
+         if( !blaze::equal( determinant, 24.0 ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Sixth computation failed\n"
+                << " Details:\n"
+                << "   Result: " << determinant << "\n"
+                << "   Expected result: 24\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Attempt to compute the determinant of a non-square matrix
+      try {
+         const blaze::DynamicMatrix<double,blaze::rowMajor> mat( 2UL, 3UL, 1.0 );
+
+         const double determinant = det( mat );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Determinant of a non-square matrix succeeded\n"
+             << " Details:\n"
+             << "   Result: " << determinant << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major det()";
+
+      // Determinant of a 4x4 matrix
+      {
+         blaze::StaticMatrix<double,4UL,4UL,blaze::columnMajor> mat( 0.0 );
+         for( size_t i=0UL; i<4UL; ++i ) {
+            mat(i,i) = 2.0;
+            if( i > 0UL ) mat(i,i-1UL) = -1.0;
+            if( i < 3UL ) mat(i,i+1UL) = -1.0;
+         }
+
+         const double determinant = det( mat );
+
+         if( !blaze::equal( determinant, 5.0 ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: First computation failed\n"
+                << " Details:\n"
+                << "   Result: " << determinant << "\n"
+                << "   Expected result: 5\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Determinant of a 100x100 matrix
+      {
+         blaze::DynamicMatrix<double,blaze::columnMajor> mat( 100UL, 100UL, 0.0 );
+         for( size_t i=0UL; i<100UL; ++i ) {
+            mat(i,i) = 2.0;
+            if( i >  0UL ) mat(i,i-1UL) = -1.0;
+            if( i < 99UL ) mat(i,i+1UL) = -1.0;
+         }
+
+         const double determinant = det( mat );
+
+         if( !blaze::equal( determinant, 101.0 ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Second computation failed\n"
+                << " Details:\n"
+                << "   Result: " << determinant << "\n"
+                << "   Expected result: 101\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Determinant of a uniupper matrix
+      {
+         blaze::UniUpperMatrix< blaze::DynamicMatrix<double,blaze::columnMajor> > mat( 3UL );
+         mat(0,1) = 7.0;
+         mat(0,2) = 8.0;
+         mat(1,2) = 9.0;
+
+         const double determinant = det( mat );
+
+         if( !blaze::equal( determinant, 1.0 ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Third computation failed\n"
+                << " Details:\n"
+                << "   Result: " << determinant << "\n"
+                << "   Expected result: 1\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c invert() and \c inv() functions for dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c invert() and \c inv() functions for dense matrices.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testInversion()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major inversion";
+
+      // Inversion of a 2x2 matrix
+      {
+         blaze::StaticMatrix<double,2UL,2UL,blaze::rowMajor> mat( 2.0, 1.0,
+                                                                  1.0, 1.0 );
+
+         invert( mat );
+
+         if( mat(0,0) != 1.0 || mat(0,1) != -1.0 || mat(1,0) != -1.0 || mat(1,1) != 2.0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Inversion of a 2x2 matrix failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n(  1 -1 )\n( -1  2 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Inversion of a 3x3 matrix
+      {
+         const blaze::StaticMatrix<double,3UL,3UL,blaze::rowMajor> mat( 1.0, 2.0, 3.0,
+                                                                        0.0, 1.0, 4.0,
+                                                                        5.0, 6.0, 0.0 );
+         const blaze::StaticMatrix<double,3UL,3UL,blaze::rowMajor> ref( -24.0,  18.0,  5.0,
+                                                                         20.0, -15.0, -4.0,
+                                                                         -5.0,   4.0,  1.0 );
+
+         const blaze::StaticMatrix<double,3UL,3UL,blaze::rowMajor> res( inv( mat ) );
+
+         if( res != ref ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Inversion of a 3x3 matrix failed\n"
+                << " Details:\n"
+                << "   Result:\n" << res << "\n"
+                << "   Expected result:\n" << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Inversion of a 6x6 matrix
+      {
+         blaze::StaticMatrix<double,6UL,6UL,blaze::rowMajor> mat( 0.0 );
+         for( size_t i=0UL; i<6UL; ++i ) {
+            mat(i,i) = 2.0;
+            if( i > 0UL ) mat(i,i-1UL) = -1.0;
+            if( i < 5UL ) mat(i,i+1UL) = -1.0;
+         }
+
+         const blaze::StaticMatrix<double,6UL,6UL,blaze::rowMajor> res( mat * inv( mat ) );
+
+         blaze::DynamicMatrix<double,blaze::rowMajor> identity( res.rows(), res.columns(), 0.0 );
+         for( size_t i=0UL; i<res.rows(); ++i )
+            identity(i,i) = 1.0;
+
+         if( res != identity ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Inversion of a 6x6 matrix failed\n"
+                << " Details:\n"
+                << "   Result:\n" << res << "\n"
+                << "   Expected result: identity matrix\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Inversion of a 100x100 matrix
+      {
+         blaze::DynamicMatrix<double,blaze::rowMajor> mat( 100UL, 100UL, 0.0 );
+         for( size_t i=0UL; i<100UL; ++i ) {
+            mat(i,i) = 2.0;
+            if( i >  0UL ) mat(i,i-1UL) = -1.0;
+            if( i < 99UL ) mat(i,i+1UL) = -1.0;
+         }
+
+         const blaze::DynamicMatrix<double,blaze::rowMajor> res( mat * inv( mat ) );
+
+         blaze::DynamicMatrix<double,blaze::rowMajor> identity( res.rows(), res.columns(), 0.0 );
+         for( size_t i=0UL; i<res.rows(); ++i )
+            identity(i,i) = 1.0;
+
+         if( res != identity ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Inversion of a 100x100 matrix failed\n"
+                << " Details:\n"
+                << "   Result:\n" << res << "\n"
+                << "   Expected result: identity matrix\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Inversion of a lower matrix
+      {
+         blaze::LowerMatrix< blaze::DynamicMatrix<double,blaze::rowMajor> > mat( 3UL );
+         mat(0,0) =  1.0;
+         mat(1,0) =  2.0;
+         mat(1,1) =  1.0;
+         mat(2,0) = -3.0;
+         mat(2,1) =  4.0;
+         mat(2,2) =  1.0;
+
+         invert( mat );
+
+         if( mat(0,0) != 1.0 || mat(1,0) != -2.0 || mat(1,1) != 1.0 ||
+             mat(2,0) != 11.0 || mat(2,1) != -4.0 || mat(2,2) != 1.0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Inversion of a lower matrix failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n(  1  0  0 )\n( -2  1  0 )\n( 11 -4  1 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Attempt to invert a singular matrix
+      try {
+         blaze::DynamicMatrix<double,blaze::rowMajor> mat( 8UL, 8UL, 1.0 );
+
+         invert( mat );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inversion of a singular matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major inversion";
+
+      // Inversion of a 4x4 matrix
+      {
+         blaze::StaticMatrix<double,4UL,4UL,blaze::columnMajor> mat( 0.0 );
+         for( size_t i=0UL; i<4UL; ++i ) {
+            mat(i,i) = 2.0;
+            if( i > 0UL ) mat(i,i-1UL) = -1.0;
+            if( i < 3UL ) mat(i,i+1UL) = -1.0;
+         }
+
+         const blaze::StaticMatrix<double,4UL,4UL,blaze::columnMajor> res( mat * inv( mat ) );
+
+         blaze::DynamicMatrix<double,blaze::columnMajor> identity( res.rows(), res.columns(), 0.0 );
+         for( size_t i=0UL; i<res.rows(); ++i )
+            identity(i,i) = 1.0;
+
+         if( res != identity ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Inversion of a 4x4 matrix failed\n"
+                << " Details:\n"
+                << "   Result:\n" << res << "\n"
+                << "   Expected result: identity matrix\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Inversion of a 100x100 matrix
+      {
+         blaze::DynamicMatrix<double,blaze::columnMajor> mat( 100UL, 100UL, 0.0 );
+         for( size_t i=0UL; i<100UL; ++i ) {
+            mat(i,i) = 2.0;
+            if( i >  0UL ) mat(i,i-1UL) = -1.0;
+            if( i < 99UL ) mat(i,i+1UL) = -1.0;
+         }
+
+         const blaze::DynamicMatrix<double,blaze::columnMajor> res( mat * inv( mat ) );
+
+         blaze::DynamicMatrix<double,blaze::columnMajor> identity( res.rows(), res.columns(), 0.0 );
+         for( size_t i=0UL; i<res.rows(); ++i )
+            identity(i,i) = 1.0;
+
+         if( res != identity ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Inversion of a 100x100 matrix failed\n"
+                << " Details:\n"
+                << "   Result:\n" << res << "\n"
+                << "   Expected result: identity matrix\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Inversion of a symmetric matrix
+      {
+         blaze::SymmetricMatrix< blaze::DynamicMatrix<double,blaze::columnMajor> > mat( 10UL );
+         for( size_t i=0UL; i<10UL; ++i ) {
+            mat(i,i) = 2.0;
+            if( i > 0UL ) mat(i,i-1UL) = -1.0;
+         }
+
+         const blaze::DynamicMatrix<double,blaze::columnMajor> res( mat * inv( mat ) );
+
+         blaze::DynamicMatrix<double,blaze::columnMajor> identity( res.rows(), res.columns(), 0.0 );
+         for( size_t i=0UL; i<res.rows(); ++i )
+            identity(i,i) = 1.0;
+
+         if( res != identity ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Inversion of a symmetric matrix failed\n"
+                << " Details:\n"
+                << "   Result:\n" << res << "\n"
+                << "   Expected result: identity matrix\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Inversion of a diagonal matrix
+      {
+         blaze::DiagonalMatrix< blaze::DynamicMatrix<double,blaze::columnMajor> > mat( 3UL );
+         mat(0,0) = 2.0;
+         mat(1,1) = 4.0;
+         mat(2,2) = 8.0;
+
+         invert( mat );
+
+         if( mat(0,0) != 0.5 || mat(1,1) != 0.25 || mat(2,2) != 0.125 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Inversion of a diagonal matrix failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n( 0.5 0 0 )\n( 0 0.25 0 )\n( 0 0 0.125 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Attempt to invert a non-square matrix
+      try {
+         blaze::DynamicMatrix<double,blaze::columnMajor> mat( 2UL, 3UL, 1.0 );
+
+         invert( mat );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inversion of a non-square matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the blocked inversion of large dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c invert(), \c inv() and \c det() functions for dense
+// matrices that are large enough to be handled by the blocked LU decomposition. The matrix
+// sizes straddle the block size of the decomposition. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testBlockedInversion()
+{
+   const size_t bs( blaze::LUDecomposition<double>::blockSize );
+   const size_t sizes[] = { 7UL, bs-1UL, bs, bs+1UL, 2UL*bs+3UL };
+
+   for( size_t s=0UL; s<sizeof(sizes)/sizeof(size_t); ++s ) {
+      testBlockedInversion<blaze::rowMajor   >( sizes[s] );
+      testBlockedInversion<blaze::columnMajor>( sizes[s] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the blocked inversion of a dense matrix of the given size.
+//
+// \param n The number of rows and columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< bool SO >  // Storage order of the inverted matrix
+void OperationTest::testBlockedInversion( size_t n )
+{
+   test_ = ( SO == blaze::rowMajor )?( "Row-major blocked inversion" )
+                                    :( "Column-major blocked inversion" );
+
+   // Inversion of a general matrix
+   {
+      blaze::DynamicMatrix<double,SO> mat( n, n );
+      for( size_t i=0UL; i<n; ++i ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            mat(i,j) = ( double( ( 37UL*i + 91UL*j + 11UL ) % 23UL ) - 11.0 ) / ( 11.0*n );
+         }
+         mat(i,i) += 2.0;
+      }
+
+      const blaze::DynamicMatrix<double,SO> res( inv( mat ) );
+      checkInverse( mat, res, "Out-of-place inversion of a general matrix" );
+
+      blaze::DynamicMatrix<double,SO> tmp( mat );
+      invert( tmp );
+      checkInverse( mat, tmp, "In-place inversion of a general matrix" );
+
+      const double product( det( mat ) * det( res ) );
+
+      if( std::fabs( product - 1.0 ) > 1E-10 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Determinant of a general matrix failed\n"
+             << " Details:\n"
+             << "   Matrix size          : " << n << "x" << n << "\n"
+             << "   det(A) * det(inv(A)) : " << product << "\n"
+             << "   Expected result      : 1\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Inversion of a symmetric positive definite and a symmetric indefinite matrix
+   for( size_t k=0UL; k<2UL; ++k )
+   {
+      blaze::SymmetricMatrix< blaze::DynamicMatrix<double,SO> > mat( n );
+      for( size_t i=0UL; i<n; ++i ) {
+         for( size_t j=0UL; j<i; ++j ) {
+            mat(i,j) = ( double( ( 17UL*(i+j) + 5UL ) % 13UL ) - 6.0 ) / ( 6.0*n );
+         }
+         mat(i,i) = ( k == 1UL && i % 2UL == 1UL )?( -2.0 ):( 2.0 );
+      }
+
+      const blaze::DynamicMatrix<double,SO> res( inv( mat ) );
+      checkInverse( mat, res, ( k == 0UL )?( "Inversion of a positive definite matrix" )
+                                          :( "Inversion of an indefinite matrix" ) );
+   }
+
+   // Attempt to invert a singular matrix
+   try {
+      blaze::DynamicMatrix<double,SO> mat( n, n, 0.0 );
+      for( size_t i=0UL; i<n; ++i ) {
+         mat(i,i) = 2.0;
+         if( i > 0UL ) mat(i-1UL,i) = 1.0;
+      }
+      for( size_t i=0UL; i<n; ++i ) {
+         mat(i,n-2UL) = 0.0;
+      }
+
+      invert( mat );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Inversion of a singular matrix succeeded\n"
+          << " Details:\n"
+          << "   Matrix size: " << n << "x" << n << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   // Attempt to invert a singular symmetric matrix
+   try {
+      blaze::SymmetricMatrix< blaze::DynamicMatrix<double,SO> > mat( n );
+      for( size_t i=0UL; i<n; ++i ) {
+         mat(i,i) = ( i == n/2UL )?( 0.0 ):( 4.0 );
+         if( i > 0UL && i != n/2UL && i-1UL != n/2UL ) mat(i,i-1UL) = 1.0;
+      }
+
+      invert( mat );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Inversion of a singular symmetric matrix succeeded\n"
+          << " Details:\n"
+          << "   Matrix size: " << n << "x" << n << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
 } // namespace densematrix
 
 } // namespace mathtest
@@ -40,7 +40,9 @@
 #include <cstdlib>
 #include <iostream>
 #include <blaze/math/dense/DenseVector.h>
+#include <blaze/math/dense/Fusion.h>
 #include <blaze/math/DynamicVector.h>
+#include <blaze/system/Thresholds.h>
 #include <blazetest/mathtest/densevector/OperationTest.h>
 
 
@@ -69,6 +71,7 @@ OperationTest::OperationTest()
    testNormalize();
    testMinimum();
    testMaximum();
+   testFuse();
 }
 //*************************************************************************************************
 
@@ -564,6 +567,130 @@ void OperationTest::testMaximum()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the \c fuse() function for dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the fused evaluation of several dense vector statements
+// via the \c fuse() function. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void OperationTest::testFuse()
+{
+   test_ = "fuse() function";
+
+   {
+      blaze::DynamicVector<int,blaze::columnVector> x( 4UL ), d( 4UL ), r( 4UL ), h( 4UL );
+      x[0] = 1; x[1] =  2; x[2] = 3; x[3] = 4;
+      d[0] = 1; d[1] = -1; d[2] = 0; d[3] = 2;
+      r[0] = 0; r[1] =  1; r[2] = 2; r[3] = 3;
+      h[0] = 1; h[1] =  1; h[2] = 1; h[3] = 1;
+
+      int s( 0 );
+
+      // Fused evaluation of x += 2*d, r += 2*h and s = trans(r)*r
+      fuse( fusedAddAssign( x, 2*d ), fusedAddAssign( r, 2*h ), fusedSum( s, r * r ) );
+
+      checkSize( x, 4UL );
+      checkSize( r, 4UL );
+
+      if( x[0] != 3 || x[1] != 0 || x[2] != 3 || x[3] != 8 ||
+          r[0] != 2 || r[1] != 3 || r[2] != 4 || r[3] != 5 || s != 54 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Fused evaluation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << x << "\n" << r << "\n" << s << "\n"
+             << "   Expected result:\n( 3 0 3 8 )\n( 2 3 4 5 )\n54\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      blaze::DynamicVector<double,blaze::columnVector> a( 1000UL ), b( 1000UL ), c( 1000UL );
+
+      for( size_t i=0UL; i<1000UL; ++i ) {
+         a[i] = 1.0;
+         b[i] = 2.0;
+      }
+
+      double s( 0.0 );
+
+      // Fused evaluation of c = a, a -= 2*b, c *= a and s = sum(c)
+      fuse( fusedAssign( c, a ), fusedSubAssign( a, 2.0*b ), fusedMultAssign( c, a ),
+            fusedSum( s, c ) );
+
+      for( size_t i=0UL; i<1000UL; ++i ) {
+         if( !blaze::equal( a[i], -3.0 ) || !blaze::equal( c[i], -3.0 ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Fused evaluation failed\n"
+                << " Details:\n"
+                << "   Index: " << i << "\n"
+                << "   Result: " << a[i] << " " << c[i] << "\n"
+                << "   Expected result: -3 -3\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      if( !blaze::equal( s, -3000.0 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Fused sum failed\n"
+             << " Details:\n"
+             << "   Result: " << s << "\n"
+             << "   Expected result: -3000\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      blaze::DynamicVector<double,blaze::columnVector> a, b, c;
+      double s( 1.0 );
+
+      // Forcing the SMP evaluation of the fused statements independent of the vector size
+      const size_t threshold( blaze::getThreshold( blaze::smpDVecReductionThreshold ) );
+      blaze::setThreshold( blaze::smpDVecReductionThreshold, 0UL );
+
+      // Fused evaluation of c = a, a -= 2*b and s = sum(c) for empty vectors
+      fuse( fusedAssign( c, a ), fusedSubAssign( a, 2.0*b ), fusedSum( s, c ) );
+
+      blaze::setThreshold( blaze::smpDVecReductionThreshold, threshold );
+
+      checkSize( a, 0UL );
+      checkSize( c, 0UL );
+
+      if( s != 0.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Fused sum of empty vectors failed\n"
+             << " Details:\n"
+             << "   Result: " << s << "\n"
+             << "   Expected result: 0\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      blaze::DynamicVector<double,blaze::columnVector> a( 4UL ), b( 5UL );
+      double s( 0.0 );
+
+      try {
+         fuse( fusedAssign( a, a ), fusedSum( s, b ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Fusing statements of different sizes succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
 } // namespace densevector
 
 } // namespace mathtest
@@ -0,0 +1,376 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/dispatch/OperationTest.cpp
+//  \brief Source file for the dispatch operation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/Dispatch.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blazetest/mathtest/dispatch/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dispatch {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the OperationTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+{
+   testInstructionSet();
+   testKernels();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the instruction set selection.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the query and the selection of the instruction set of the runtime
+// dispatch. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testInstructionSet()
+{
+   using blaze::getAvailableInstructionSet;
+   using blaze::getCompiledInstructionSet;
+   using blaze::getInstructionSet;
+   using blaze::getInstructionSetName;
+
+   // Querying the instruction sets
+   {
+      test_ = "Querying the instruction sets";
+
+      const blaze::InstructionSet current  ( getInstructionSet() );
+      const blaze::InstructionSet available( getAvailableInstructionSet() );
+      const blaze::InstructionSet compiled ( getCompiledInstructionSet() );
+
+      if( current > available || ( BLAZE_DISPATCH_MODE && compiled > available ) ||
+          ( !BLAZE_DISPATCH_MODE && compiled != available ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid instruction sets detected\n"
+             << " Details:\n"
+             << "   Current instruction set  : " << getInstructionSetName( current   ) << "\n"
+             << "   Available instruction set: " << getInstructionSetName( available ) << "\n"
+             << "   Compiled instruction set : " << getInstructionSetName( compiled  ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( std::string( getInstructionSetName( blaze::avx2InstructionSet ) ) != "avx2" ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid instruction set name detected\n"
+             << " Details:\n"
+             << "   Result: " << getInstructionSetName( blaze::avx2InstructionSet ) << "\n"
+             << "   Expected result: avx2\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Selecting the instruction set
+   {
+      test_ = "Selecting the instruction set";
+
+      const blaze::InstructionSet initial( getInstructionSet() );
+
+      blaze::setInstructionSet( blaze::defaultInstructionSet );
+
+      if( getInstructionSet() != blaze::defaultInstructionSet || blaze::isDispatchActive() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Selecting the default instruction set failed\n"
+             << " Details:\n"
+             << "   Result: " << getInstructionSetName( getInstructionSet() ) << "\n"
+             << "   Expected result: default\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      blaze::setInstructionSet( getAvailableInstructionSet() );
+
+      if( getInstructionSet() != getAvailableInstructionSet() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Selecting the available instruction set failed\n"
+             << " Details:\n"
+             << "   Result: " << getInstructionSetName( getInstructionSet() ) << "\n"
+             << "   Expected result: "
+             << getInstructionSetName( getAvailableInstructionSet() ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      blaze::setInstructionSet( initial );
+   }
+
+   // Selecting an unavailable instruction set
+   if( getAvailableInstructionSet() < blaze::avx512InstructionSet )
+   {
+      test_ = "Selecting an unavailable instruction set";
+
+      const blaze::InstructionSet initial( getInstructionSet() );
+
+      try {
+         blaze::setInstructionSet( blaze::avx512InstructionSet );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Selecting an unavailable instruction set succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      if( getInstructionSet() != initial ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid instruction set detected\n"
+             << " Details:\n"
+             << "   Result: " << getInstructionSetName( getInstructionSet() ) << "\n"
+             << "   Expected result: " << getInstructionSetName( initial ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the dispatched kernels for all available instruction sets.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the dispatched kernels for all instruction sets of the executing CPU. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testKernels()
+{
+   const blaze::InstructionSet initial( blaze::getInstructionSet() );
+
+   for( int is=blaze::defaultInstructionSet; is<=blaze::getAvailableInstructionSet(); ++is ) {
+      testKernels( static_cast<blaze::InstructionSet>( is ) );
+   }
+
+   blaze::setInstructionSet( initial );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the dispatched kernels for a specific instruction set.
+//
+// \param is The instruction set to be tested.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the results of the dispatched kernels for the given instruction set
+// with the results of the kernels selected at compile time. Since all operands only contain
+// small integral values, the results of all kernels are exact and can be compared directly.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testKernels( blaze::InstructionSet is )
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+   using blaze::rowVector;
+   using blaze::columnVector;
+
+   typedef blaze::DynamicMatrix<double,rowMajor>     DRM;
+   typedef blaze::DynamicMatrix<double,columnMajor>  DCM;
+   typedef blaze::DynamicVector<double,columnVector>  DCV;
+   typedef blaze::DynamicVector<double,rowVector>     DRV;
+   typedef blaze::DynamicMatrix<float,rowMajor>      FRM;
+   typedef blaze::DynamicVector<float,columnVector>   FCV;
+
+   const size_t M( 67UL );
+   const size_t N( 45UL );
+   const size_t K( 83UL );
+
+   DRM A( M, K ), B( K, N ), C( M, N );
+   FRM fA( M, K );
+   DCV x( K ), y( M );
+   FCV fx( K );
+   DRV xt( M );
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<K; ++j ) {
+         A(i,j) = fA(i,j) = static_cast<int>( ( i*7UL + j*3UL ) % 11UL ) - 5;
+      }
+   }
+   for( size_t i=0UL; i<K; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         B(i,j) = static_cast<int>( ( i*5UL + j ) % 9UL ) - 4;
+      }
+   }
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         C(i,j) = static_cast<int>( ( i + j*2UL ) % 7UL ) - 3;
+      }
+   }
+   for( size_t i=0UL; i<K; ++i ) {
+      x[i] = fx[i] = static_cast<int>( i % 5UL ) - 2;
+   }
+   for( size_t i=0UL; i<M; ++i ) {
+      y[i] = xt[i] = static_cast<int>( i % 3UL ) - 1;
+   }
+
+   const DCM tA( A ), tB( B ), tC( C );
+
+   // Computing the reference results with the kernels selected at compile time
+   blaze::setInstructionSet( blaze::getCompiledInstructionSet() );
+
+   const DRM refAB ( A * B );
+   const DRM refCAB( C - 2.0 * ( A * B ) );
+   const DCM refTAB( tC + tA * tB );
+   const DCV refAx ( A * x );
+   const DCV refTAx( y - tA * x );
+   const FCV refFAx( fA * fx );
+   const DRV refxA ( xt * A );
+   const DRV refxTA( xt * tA );
+   const double refDot( trans( x ) * x );
+   const double refSum( sum( x ) );
+   DCV refAxpy( y ); refAxpy += 3.0 * refAx; refAxpy -= refAx * 0.5;
+
+   // Computing the results with the kernels of the given instruction set
+   test_ = std::string( "Dispatched kernels (" ) + blaze::getInstructionSetName( is ) + ")";
+
+   blaze::setInstructionSet( is );
+
+   {
+      const DRM AB( A * B );
+      checkResult( AB, refAB, "row-major matrix multiplication", is );
+
+      DRM CAB( C );
+      CAB -= 2.0 * ( A * B );
+      checkResult( CAB, refCAB, "scaled row-major matrix multiplication", is );
+
+      DCM TAB( tC );
+      TAB += tA * tB;
+      checkResult( TAB, refTAB, "column-major matrix multiplication", is );
+   }
+
+   {
+      const DCV Ax( A * x );
+      checkResult( Ax, refAx, "row-major matrix/vector multiplication", is );
+
+      DCV TAx( y );
+      TAx -= tA * x;
+      checkResult( TAx, refTAx, "column-major matrix/vector multiplication", is );
+
+      const FCV FAx( fA * fx );
+      checkResult( FAx, refFAx, "single precision matrix/vector multiplication", is );
+
+      const DRV xA( xt * A );
+      checkResult( xA, refxA, "vector/row-major matrix multiplication", is );
+
+      const DRV xTA( xt * tA );
+      checkResult( xTA, refxTA, "vector/column-major matrix multiplication", is );
+   }
+
+   {
+      const double dot( trans( x ) * x );
+      checkResult( dot, refDot, "inner product", is );
+
+      const double total( sum( x ) );
+      checkResult( total, refSum, "sum", is );
+
+      DCV axpy( y );
+      axpy += 3.0 * refAx;
+      axpy -= refAx * 0.5;
+      checkResult( axpy, refAxpy, "scaled vector addition", is );
+   }
+}
+//*************************************************************************************************
+
+} // namespace dispatch
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running dispatch operation test..." << std::endl;
+
+   try
+   {
+      RUN_DISPATCH_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during dispatch operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
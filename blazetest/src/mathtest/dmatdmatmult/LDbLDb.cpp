@@ -79,6 +79,10 @@ int main()
       RUN_DMATDMATMULT_OPERATION_TEST( CLDb( 16UL ), CLDb( 16UL ) );
       RUN_DMATDMATMULT_OPERATION_TEST( CLDb( 32UL ), CLDb( 32UL ) );
       RUN_DMATDMATMULT_OPERATION_TEST( CLDb( 64UL ), CLDb( 64UL ) );
+      RUN_DMATDMATMULT_OPERATION_TEST( CLDb( 127UL ), CLDb( 127UL ) );
+      RUN_DMATDMATMULT_OPERATION_TEST( CLDb( 128UL ), CLDb( 128UL ) );
+      RUN_DMATDMATMULT_OPERATION_TEST( CLDb( 600UL ), CLDb( 600UL ) );
+      RUN_DMATDMATMULT_OPERATION_TEST( CLDb( 601UL ), CLDb( 601UL ) );
    }
    catch( std::exception& ex ) {
       std::cerr << "\n\n ERROR DETECTED during dense matrix/dense matrix multiplication:\n"
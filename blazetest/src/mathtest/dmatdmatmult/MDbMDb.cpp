@@ -86,6 +86,10 @@ int main()
       RUN_DMATDMATMULT_OPERATION_TEST( CMDb( 32UL, 32UL ), CMDb(  32UL, 32UL ) );
       RUN_DMATDMATMULT_OPERATION_TEST( CMDb( 64UL, 32UL ), CMDb(  32UL, 16UL ) );
       RUN_DMATDMATMULT_OPERATION_TEST( CMDb( 64UL, 32UL ), CMDb(  32UL, 64UL ) );
+      RUN_DMATDMATMULT_OPERATION_TEST( CMDb( 127UL, 113UL ), CMDb( 113UL, 131UL ) );
+      RUN_DMATDMATMULT_OPERATION_TEST( CMDb( 128UL, 128UL ), CMDb( 128UL, 128UL ) );
+      RUN_DMATDMATMULT_OPERATION_TEST( CMDb(  97UL, 600UL ), CMDb( 600UL, 131UL ) );
+      RUN_DMATDMATMULT_OPERATION_TEST( CMDb( 600UL, 600UL ), CMDb( 600UL, 601UL ) );
    }
    catch( std::exception& ex ) {
       std::cerr << "\n\n ERROR DETECTED during dense matrix/dense matrix multiplication:\n"
@@ -82,6 +82,10 @@ int main()
       RUN_DMATDMATMULT_OPERATION_TEST( CUDb( 16UL ), CLDb( 16UL ) );
       RUN_DMATDMATMULT_OPERATION_TEST( CUDb( 32UL ), CLDb( 32UL ) );
       RUN_DMATDMATMULT_OPERATION_TEST( CUDb( 64UL ), CLDb( 64UL ) );
+      RUN_DMATDMATMULT_OPERATION_TEST( CUDb( 127UL ), CLDb( 127UL ) );
+      RUN_DMATDMATMULT_OPERATION_TEST( CUDb( 128UL ), CLDb( 128UL ) );
+      RUN_DMATDMATMULT_OPERATION_TEST( CUDb( 600UL ), CLDb( 600UL ) );
+      RUN_DMATDMATMULT_OPERATION_TEST( CUDb( 601UL ), CLDb( 601UL ) );
    }
    catch( std::exception& ex ) {
       std::cerr << "\n\n ERROR DETECTED during dense matrix/dense matrix multiplication:\n"
@@ -79,6 +79,10 @@ int main()
       RUN_DMATDMATMULT_OPERATION_TEST( CUDb( 16UL ), CUDb( 16UL ) );
       RUN_DMATDMATMULT_OPERATION_TEST( CUDb( 32UL ), CUDb( 32UL ) );
       RUN_DMATDMATMULT_OPERATION_TEST( CUDb( 64UL ), CUDb( 64UL ) );
+      RUN_DMATDMATMULT_OPERATION_TEST( CUDb( 127UL ), CUDb( 127UL ) );
+      RUN_DMATDMATMULT_OPERATION_TEST( CUDb( 128UL ), CUDb( 128UL ) );
+      RUN_DMATDMATMULT_OPERATION_TEST( CUDb( 600UL ), CUDb( 600UL ) );
+      RUN_DMATDMATMULT_OPERATION_TEST( CUDb( 601UL ), CUDb( 601UL ) );
    }
    catch( std::exception& ex ) {
       std::cerr << "\n\n ERROR DETECTED during dense matrix/dense matrix multiplication:\n"
@@ -39,6 +39,7 @@
 
 #include <cstdlib>
 #include <iostream>
+#include <utility>
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/DiagonalMatrix.h>
 #include <blaze/math/LowerMatrix.h>
@@ -377,6 +378,46 @@ void ClassTest::testConstructors()
    }
 
 
+#if BLAZE_CPP11_MODE
+   //=====================================================================================
+   // Row-major move constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major DynamicMatrix move constructor (2x3)";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> mat1( 2UL, 3UL );
+      mat1(0,0) = 1;
+      mat1(0,1) = 2;
+      mat1(0,2) = 3;
+      mat1(1,0) = 4;
+      mat1(1,1) = 5;
+      mat1(1,2) = 6;
+      const int* data( mat1.data() );
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> mat2( std::move( mat1 ) );
+
+      checkRows    ( mat1, 0UL );
+      checkColumns ( mat1, 0UL );
+      checkRows    ( mat2, 2UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 6UL );
+
+      if( mat2.data() != data ||
+          mat2(0,0) != 1 || mat2(0,1) != 2 || mat2(0,2) != 3 ||
+          mat2(1,0) != 4 || mat2(1,1) != 5 || mat2(1,2) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 2 3 )\n( 4 5 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+#endif
+
+
    //=====================================================================================
    // Column-major default constructor
    //=====================================================================================
@@ -631,6 +672,46 @@ void ClassTest::testConstructors()
          throw std::runtime_error( oss.str() );
       }
    }
+
+
+#if BLAZE_CPP11_MODE
+   //=====================================================================================
+   // Column-major move constructor
+   //=====================================================================================
+
+   {
+      test_ = "Column-major DynamicMatrix move constructor (2x3)";
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> mat1( 2UL, 3UL );
+      mat1(0,0) = 1;
+      mat1(0,1) = 2;
+      mat1(0,2) = 3;
+      mat1(1,0) = 4;
+      mat1(1,1) = 5;
+      mat1(1,2) = 6;
+      const int* data( mat1.data() );
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> mat2( std::move( mat1 ) );
+
+      checkRows    ( mat1, 0UL );
+      checkColumns ( mat1, 0UL );
+      checkRows    ( mat2, 2UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 6UL );
+
+      if( mat2.data() != data ||
+          mat2(0,0) != 1 || mat2(0,1) != 2 || mat2(0,2) != 3 ||
+          mat2(1,0) != 4 || mat2(1,1) != 5 || mat2(1,2) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 2 3 )\n( 4 5 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+#endif
 }
 //*************************************************************************************************
 
@@ -776,6 +857,48 @@ void ClassTest::testAssignment()
    }
 
 
+#if BLAZE_CPP11_MODE
+   //=====================================================================================
+   // Row-major move assignment
+   //=====================================================================================
+
+   {
+      test_ = "Row-major DynamicMatrix move assignment";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> mat1( 2UL, 3UL );
+      mat1(0,0) = 1;
+      mat1(0,1) = 2;
+      mat1(0,2) = 3;
+      mat1(1,0) = 4;
+      mat1(1,1) = 5;
+      mat1(1,2) = 6;
+      const int* data( mat1.data() );
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> mat2( 3UL, 3UL );
+      mat2(2,2) = 9;
+      mat2 = std::move( mat1 );
+
+      checkRows    ( mat1, 0UL );
+      checkColumns ( mat1, 0UL );
+      checkRows    ( mat2, 2UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 6UL );
+
+      if( mat2.data() != data ||
+          mat2(0,0) != 1 || mat2(0,1) != 2 || mat2(0,2) != 3 ||
+          mat2(1,0) != 4 || mat2(1,1) != 5 || mat2(1,2) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 2 3 )\n( 4 5 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+#endif
+
+
    //=====================================================================================
    // Row-major dense matrix assignment
    //=====================================================================================
@@ -1427,6 +1550,48 @@ void ClassTest::testAssignment()
    }
 
 
+#if BLAZE_CPP11_MODE
+   //=====================================================================================
+   // Column-major move assignment
+   //=====================================================================================
+
+   {
+      test_ = "Column-major DynamicMatrix move assignment";
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> mat1( 2UL, 3UL );
+      mat1(0,0) = 1;
+      mat1(0,1) = 2;
+      mat1(0,2) = 3;
+      mat1(1,0) = 4;
+      mat1(1,1) = 5;
+      mat1(1,2) = 6;
+      const int* data( mat1.data() );
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> mat2( 3UL, 3UL );
+      mat2(2,2) = 9;
+      mat2 = std::move( mat1 );
+
+      checkRows    ( mat1, 0UL );
+      checkColumns ( mat1, 0UL );
+      checkRows    ( mat2, 2UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 6UL );
+
+      if( mat2.data() != data ||
+          mat2(0,0) != 1 || mat2(0,1) != 2 || mat2(0,2) != 3 ||
+          mat2(1,0) != 4 || mat2(1,1) != 5 || mat2(1,2) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 2 3 )\n( 4 5 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+#endif
+
+
    //=====================================================================================
    // Column-major dense matrix assignment
    //=====================================================================================
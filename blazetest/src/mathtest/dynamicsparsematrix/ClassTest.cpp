@@ -0,0 +1,754 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/dynamicsparsematrix/ClassTest.cpp
+//  \brief Source file for the DynamicSparseMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/dynamicsparsematrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dynamicsparsematrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the DynamicSparseMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testFunctionCall();
+   testInsert();
+   testErase();
+   testAppend();
+   testResize();
+   testReserve();
+   testExpressions();
+   testFreeze();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the DynamicSparseMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the DynamicSparseMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   {
+      test_ = "DynamicSparseMatrix default constructor";
+
+      MT mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   {
+      test_ = "DynamicSparseMatrix size constructor (3x4)";
+
+      MT mat( 3UL, 4UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   {
+      test_ = "DynamicSparseMatrix size constructor with capacities (3x4)";
+
+      std::vector<size_t> nonzeros( 3UL );
+      nonzeros[0] = 2UL;
+      nonzeros[1] = 0UL;
+      nonzeros[2] = 4UL;
+
+      MT mat( 3UL, 4UL, nonzeros );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 0UL );
+
+      if( mat.capacity(0) < 2UL || mat.capacity(2) < 4UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid row capacities detected\n"
+             << " Details:\n"
+             << "   Capacity of row 0: " << mat.capacity(0) << "\n"
+             << "   Capacity of row 2: " << mat.capacity(2) << "\n"
+             << "   Expected capacities: at least 2 and 4\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "DynamicSparseMatrix copy and conversion constructors";
+
+      CMT ref( 3UL, 4UL );
+      ref(0,1) = 1;
+      ref(1,3) = 2;
+      ref(2,0) = 3;
+      ref(2,2) = 4;
+
+      MT mat1( ref );
+      MT mat2( mat1 );
+      TMT mat3( mat2 );
+      const blaze::DynamicMatrix<int> dense( ref );
+      MT mat4( dense );
+
+      checkRows    ( mat3, 3UL );
+      checkColumns ( mat3, 4UL );
+      checkNonZeros( mat1, 4UL );
+      checkNonZeros( mat2, 4UL );
+      checkNonZeros( mat3, 4UL );
+      checkNonZeros( mat4, 4UL );
+      checkNonZeros( mat3, 0UL, 1UL );
+      checkNonZeros( mat3, 2UL, 1UL );
+
+      if( mat1 != ref || mat2 != ref || mat3 != ref || mat4 != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the DynamicSparseMatrix function call operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of adding and accessing elements via the function call operator
+// of the DynamicSparseMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testFunctionCall()
+{
+   {
+      test_ = "Row-major DynamicSparseMatrix::operator()";
+
+      MT mat( 3UL, 5UL );
+      mat(1,4) =  2;
+      mat(1,0) =  1;
+      mat(1,2) =  3;
+      mat(2,2) =  4;
+      mat(1,2) += 2;
+      mat(2,2) =  0;
+
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 1UL, 3UL );
+
+      if( mat(1,0) != 1 || mat(1,2) != 5 || mat(1,4) != 2 || mat(2,2) != 0 ||
+          mat.begin(1)->index() != 0UL || (mat.end(1)-1)->index() != 4UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Function call operator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 0 0 0 )\n( 1 0 5 0 2 )\n( 0 0 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major DynamicSparseMatrix::operator()";
+
+      TMT mat( 5UL, 3UL );
+      mat(4,1) = 2;
+      mat(0,1) = 1;
+      mat(2,1) = 3;
+
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 1UL, 3UL );
+
+      if( mat(0,1) != 1 || mat(2,1) != 3 || mat(4,1) != 2 ||
+          mat.begin(1)->index() != 0UL || (mat.end(1)-1)->index() != 4UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Function call operator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 1 0 )\n( 0 0 0 )\n( 0 3 0 )\n( 0 0 0 )\n( 0 2 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the insert() and set() member functions of the DynamicSparseMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the insert() and set() member functions of the
+// DynamicSparseMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testInsert()
+{
+   test_ = "DynamicSparseMatrix::insert()";
+
+   MT mat( 4UL, 6UL );
+   mat.insert( 2UL, 5UL, 1 );
+   mat.insert( 2UL, 1UL, 2 );
+   mat.insert( 2UL, 3UL, 3 );
+   mat.insert( 0UL, 3UL, 4 );
+   mat.set   ( 2UL, 3UL, 5 );
+   mat.set   ( 3UL, 0UL, 6 );
+
+   checkNonZeros( mat, 5UL );
+   checkNonZeros( mat, 2UL, 3UL );
+
+   if( mat(2,1) != 2 || mat(2,3) != 5 || mat(2,5) != 1 || mat(0,3) != 4 || mat(3,0) != 6 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Inserting elements failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   try {
+      mat.insert( 2UL, 1UL, 7 );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Inserting an existing element succeeded\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the erase() member functions of the DynamicSparseMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the erase() member functions of the DynamicSparseMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testErase()
+{
+   test_ = "DynamicSparseMatrix::erase()";
+
+   MT mat( 3UL, 6UL );
+   for( size_t j=0UL; j<6UL; ++j ) {
+      mat(0,j) = static_cast<int>( j+1UL );
+      mat(1,j) = static_cast<int>( j+1UL );
+   }
+
+   // Erasing a single element by index
+   mat.erase( 0UL, 2UL );
+   mat.erase( 0UL, 2UL );
+
+   // Erasing a single element by iterator
+   MT::Iterator pos = mat.erase( 0UL, mat.find( 0UL, 0UL ) );
+
+   // Erasing a range of elements
+   mat.erase( 1UL, mat.lowerBound( 1UL, 1UL ), mat.upperBound( 1UL, 3UL ) );
+
+   checkNonZeros( mat, 7UL );
+   checkNonZeros( mat, 0UL, 4UL );
+   checkNonZeros( mat, 1UL, 3UL );
+   checkNonZeros( mat, 2UL, 0UL );
+
+   if( pos->index() != 1UL || mat(0,0) != 0 || mat(0,2) != 0 || mat(0,1) != 2 ||
+       mat(1,0) != 1 || mat(1,3) != 0 || mat(1,4) != 5 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Erasing elements failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n"
+          << "   Expected result:\n( 0 2 0 4 5 6 )\n( 1 0 0 0 5 6 )\n( 0 0 0 0 0 0 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the append() member function of the DynamicSparseMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the append() member function of the DynamicSparseMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAppend()
+{
+   test_ = "DynamicSparseMatrix::append()";
+
+   TMT mat( 4UL, 3UL );
+   mat.append( 0UL, 2UL, 1 );
+   mat.append( 3UL, 2UL, 2 );
+   mat.append( 1UL, 0UL, 3 );
+   mat.append( 2UL, 0UL, 0, true );
+   mat.append( 3UL, 0UL, 4 );
+   mat.finalize( 0UL );
+
+   checkNonZeros( mat, 4UL );
+   checkNonZeros( mat, 0UL, 2UL );
+   checkNonZeros( mat, 1UL, 0UL );
+   checkNonZeros( mat, 2UL, 2UL );
+
+   if( mat(0,2) != 1 || mat(3,2) != 2 || mat(1,0) != 3 || mat(3,0) != 4 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Appending elements failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n"
+          << "   Expected result:\n( 0 0 1 )\n( 3 0 0 )\n( 0 0 0 )\n( 4 0 2 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the resize() member function of the DynamicSparseMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the resize() member function of the DynamicSparseMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testResize()
+{
+   test_ = "DynamicSparseMatrix::resize()";
+
+   MT mat( 3UL, 4UL );
+   mat(0,0) = 1;
+   mat(0,3) = 2;
+   mat(2,1) = 3;
+   mat(2,2) = 4;
+
+   // Shrinking the matrix while preserving the remaining elements
+   mat.resize( 2UL, 2UL );
+
+   checkRows    ( mat, 2UL );
+   checkColumns ( mat, 2UL );
+   checkNonZeros( mat, 1UL );
+
+   // Growing the matrix while preserving the elements
+   mat.resize( 5UL, 3UL );
+   mat(4,2) = 5;
+
+   checkRows    ( mat, 5UL );
+   checkColumns ( mat, 3UL );
+   checkNonZeros( mat, 2UL );
+
+   if( mat(0,0) != 1 || mat(4,2) != 5 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Resizing the matrix failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   // Resizing the matrix without preserving the elements
+   mat.resize( 4UL, 4UL, false );
+
+   checkRows    ( mat, 4UL );
+   checkColumns ( mat, 4UL );
+   checkNonZeros( mat, 0UL );
+
+   // Clearing the matrix
+   clear( mat );
+
+   checkRows    ( mat, 0UL );
+   checkColumns ( mat, 0UL );
+
+   if( !isDefault( mat ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Clearing the matrix failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the reserve() and trim() member functions of the DynamicSparseMatrix class
+//        template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the reserve() and trim() member functions of the
+// DynamicSparseMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testReserve()
+{
+   test_ = "DynamicSparseMatrix::reserve() and DynamicSparseMatrix::trim()";
+
+   MT mat( 3UL, 20UL );
+   mat.reserve( 1UL, 10UL );
+   mat(1,5) = 1;
+   mat(1,7) = 2;
+
+   if( mat.capacity(1) < 10UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reserving capacity failed\n"
+          << " Details:\n"
+          << "   Capacity         : " << mat.capacity(1) << "\n"
+          << "   Expected capacity: at least 10\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   mat.trim();
+
+   checkNonZeros( mat, 2UL );
+
+   if( mat.capacity(1) != 2UL || mat.capacity() != 2UL || mat(1,5) != 1 || mat(1,7) != 2 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Trimming the matrix failed\n"
+          << " Details:\n"
+          << "   Capacity         : " << mat.capacity(1) << "\n"
+          << "   Expected capacity: 2\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   mat.reserve( 25UL );
+
+   checkNonZeros( mat, 2UL );
+
+   if( mat.capacity() < 25UL || mat.capacity(0) < 9UL || mat.capacity(1) < 9UL ||
+       mat.capacity(2) < 9UL || mat(1,5) != 1 || mat(1,7) != 2 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reserving the total capacity failed\n"
+          << " Details:\n"
+          << "   Capacity         : " << mat.capacity() << " ( " << mat.capacity(0) << ", "
+          << mat.capacity(1) << ", " << mat.capacity(2) << " )\n"
+          << "   Expected capacity: at least 25 ( at least 9 per row )\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   {
+      MT empty;
+      empty.reserve( 10UL );
+
+      if( empty.capacity() != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reserving capacity in an empty matrix failed\n"
+             << " Details:\n"
+             << "   Capacity         : " << empty.capacity() << "\n"
+             << "   Expected capacity: 0\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the DynamicSparseMatrix class template within expressions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the DynamicSparseMatrix class template as operand and as
+// target of expressions. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void ClassTest::testExpressions()
+{
+   CMT ref1( 30UL, 20UL );
+   CMT ref2( 30UL, 20UL );
+
+   for( size_t t=0UL; t<100UL; ++t ) {
+      const size_t i( blaze::rand<size_t>( 0UL, 29UL ) );
+      const size_t j( blaze::rand<size_t>( 0UL, 19UL ) );
+      ref1(i,j) = blaze::rand<int>( 1, 10 );
+      ref2(29UL-i,j) = blaze::rand<int>( 1, 10 );
+   }
+
+   const MT  mat1( ref1 );
+   const TMT mat2( ref2 );
+
+   {
+      test_ = "DynamicSparseMatrix matrix/vector multiplication";
+
+      blaze::DynamicVector<int> vec( 20UL );
+      for( size_t i=0UL; i<20UL; ++i )
+         vec[i] = blaze::rand<int>( -5, 5 );
+
+      const blaze::DynamicVector<int> res( mat1 * vec );
+
+      if( res != ref1 * vec ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << res << "\n"
+             << "   Expected result:\n" << ( ref1 * vec ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "DynamicSparseMatrix addition, subtraction and transpose";
+
+      MT  res1( mat1 + mat2 );
+      TMT res2( trans( mat1 ) );
+      blaze::DynamicMatrix<int> res3( mat1 - mat2 );
+
+      MT res4( mat1 );
+      res4 += mat2;
+      res4 -= 2 * mat2;
+      res4 *= 3;
+
+      MT res5( mat1 );
+      res5.transpose();
+
+      if( res1 != ref1 + ref2 || res2 != trans( ref1 ) || res3 != ref1 - ref2 ||
+          res4 != 3 * ( ref1 - ref2 ) || res5 != trans( ref1 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Evaluation of the expression failed\n"
+             << " Details:\n"
+             << "   Result of the addition:\n" << res1 << "\n"
+             << "   Expected result:\n" << ( ref1 + ref2 ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "DynamicSparseMatrix assignment of expressions";
+
+      const blaze::DynamicMatrix<int,true> tref2( trans( ref2 ) );
+      const blaze::DynamicMatrix<int> ref( ref1 * tref2 );
+
+      MT res1;
+      res1 = mat1 * trans( mat2 );
+
+      TMT res2( 2UL, 2UL );
+      res2 = mat1;
+
+      MT res3( mat1 );
+      res3 = trans( res3 );
+
+      if( res1 != ref || res2 != ref1 || res3 != trans( ref1 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << res1 << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the freeze() member functions of the DynamicSparseMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the conversion of a dynamic sparse matrix into a compressed
+// matrix via the freeze() member functions, both serially and with the shared memory
+// parallelization enabled for all matrix sizes. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFreeze()
+{
+   {
+      test_ = "DynamicSparseMatrix::freeze() of a small matrix";
+
+      MT mat( 3UL, 4UL );
+      mat(0,3) = 1;
+      mat(2,0) = 2;
+      mat(2,1) = 3;
+
+      CMT cmat( 10UL, 10UL );
+      cmat(5,5) = 9;
+      mat.freeze( cmat );
+
+      const CMT res( mat.freeze() );
+
+      mat(1,1) = 4;
+
+      checkRows    ( cmat, 3UL );
+      checkColumns ( cmat, 4UL );
+      checkNonZeros( cmat, 3UL );
+      checkNonZeros( res , 3UL );
+
+      if( cmat(0,3) != 1 || cmat(2,0) != 2 || cmat(2,1) != 3 || res != cmat ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Conversion failed\n"
+             << " Details:\n"
+             << "   Result:\n" << cmat << "\n"
+             << "   Expected result:\n( 0 0 0 1 )\n( 0 0 0 0 )\n( 2 3 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "DynamicSparseMatrix::freeze() of a large random matrix";
+
+      const size_t threshold( blaze::getThreshold( blaze::smpSMatFreezeThreshold ) );
+      blaze::setThreshold( blaze::smpSMatFreezeThreshold, 0UL );
+
+      MT  mat ( 200UL, 150UL );
+      TMT tmat( 200UL, 150UL );
+
+      for( size_t t=0UL; t<5000UL; ++t ) {
+         const size_t i( blaze::rand<size_t>( 0UL, 199UL ) );
+         const size_t j( blaze::rand<size_t>( 0UL, 149UL ) );
+         const int value( blaze::rand<int>( 1, 10 ) );
+         mat (i,j) = value;
+         tmat(i,j) = value;
+      }
+
+      CMT cmat;
+      mat.freeze( cmat );
+
+      TCMT tcmat;
+      tmat.freeze( tcmat );
+
+      CMT copy( mat );
+
+      blaze::setThreshold( blaze::smpSMatFreezeThreshold, threshold );
+
+      checkNonZeros( cmat , mat.nonZeros() );
+      checkNonZeros( tcmat, mat.nonZeros() );
+
+      if( cmat != mat || tcmat != mat || copy != mat ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Conversion failed\n"
+             << " Details:\n"
+             << "   Row-major result:\n" << cmat << "\n"
+             << "   Column-major result:\n" << tcmat << "\n"
+             << "   Expected result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace dynamicsparsematrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running DynamicSparseMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_DYNAMICSPARSEMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during DynamicSparseMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -39,6 +39,7 @@
 
 #include <cstdlib>
 #include <iostream>
+#include <utility>
 #include <blaze/math/CompressedVector.h>
 #include <blaze/math/StaticVector.h>
 #include <blaze/math/shims/Equal.h>
@@ -284,6 +285,42 @@ void ClassTest::testConstructors()
    }
 
 
+#if BLAZE_CPP11_MODE
+   //=====================================================================================
+   // Move constructor
+   //=====================================================================================
+
+   {
+      test_ = "DynamicVector move constructor";
+
+      blaze::DynamicVector<int,blaze::rowVector> vec1( 5UL );
+      vec1[0] = 1;
+      vec1[1] = 2;
+      vec1[2] = 3;
+      vec1[3] = 4;
+      vec1[4] = 5;
+      const int* data( vec1.data() );
+      blaze::DynamicVector<int,blaze::rowVector> vec2( std::move( vec1 ) );
+
+      checkSize    ( vec1, 0UL );
+      checkCapacity( vec1, 0UL );
+      checkSize    ( vec2, 5UL );
+      checkNonZeros( vec2, 5UL );
+
+      if( vec2.data() != data ||
+          vec2[0] != 1 || vec2[1] != 2 || vec2[2] != 3 || vec2[3] != 4 || vec2[4] != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec2 << "\n"
+             << "   Expected result:\n( 1 2 3 4 5 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+#endif
+
+
    //=====================================================================================
    // Dense vector constructor
    //=====================================================================================
@@ -465,6 +502,43 @@ void ClassTest::testAssignment()
    }
 
 
+#if BLAZE_CPP11_MODE
+   //=====================================================================================
+   // Move assignment
+   //=====================================================================================
+
+   {
+      test_ = "DynamicVector move assignment";
+
+      blaze::DynamicVector<int,blaze::rowVector> vec1( 5UL );
+      vec1[0] = 1;
+      vec1[1] = 2;
+      vec1[2] = 3;
+      vec1[3] = 4;
+      vec1[4] = 5;
+      const int* data( vec1.data() );
+      blaze::DynamicVector<int,blaze::rowVector> vec2( 3UL, 7 );
+      vec2 = std::move( vec1 );
+
+      checkSize    ( vec1, 0UL );
+      checkCapacity( vec1, 0UL );
+      checkSize    ( vec2, 5UL );
+      checkNonZeros( vec2, 5UL );
+
+      if( vec2.data() != data ||
+          vec2[0] != 1 || vec2[1] != 2 || vec2[2] != 3 || vec2[3] != 4 || vec2[4] != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec2 << "\n"
+             << "   Expected result:\n( 1 2 3 4 5 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+#endif
+
+
    //=====================================================================================
    // Dense vector assignment
    //=====================================================================================
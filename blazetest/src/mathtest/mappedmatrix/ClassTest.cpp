@@ -0,0 +1,659 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/mappedmatrix/ClassTest.cpp
+//  \brief Source file for the MappedMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DenseColumn.h>
+#include <blaze/math/DenseRow.h>
+#include <blaze/math/DenseSubmatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/serialization/MappedFormat.h>
+#include <blaze/math/SparseRow.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/mappedmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace mappedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the MappedMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testDenseMatrix();
+   testSparseMatrix();
+   testExpressions();
+   testErrors();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the MappedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function writes several dense matrices via the writeMapped() function and maps them
+// via the MappedMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testDenseMatrix()
+{
+   {
+      test_ = "Row-major MappedMatrix of a 5x7 matrix";
+
+      DMT ref( 5UL, 7UL );
+      blaze::randomize( ref );
+
+      blaze::writeMapped( "mappedmatrix.blaze", ref );
+      const MT mat( "mappedmatrix.blaze" );
+
+      checkRows   ( mat, 5UL );
+      checkColumns( mat, 7UL );
+
+      if( mat != ref || mat.spacing() < 7UL || mat.spacing() * sizeof(int) % 64UL != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Mapping failed\n"
+             << " Details:\n"
+             << "   Spacing: " << mat.spacing() << "\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major MappedMatrix of a 5x7 matrix";
+
+      TDMT ref( 5UL, 7UL );
+      blaze::randomize( ref );
+
+      blaze::writeMapped( "mappedmatrix.blaze", ref );
+      const TMT mat( "mappedmatrix.blaze" );
+
+      checkRows   ( mat, 5UL );
+      checkColumns( mat, 7UL );
+
+      if( mat != ref || mat.spacing() < 5UL || mat.spacing() * sizeof(int) % 64UL != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Mapping failed\n"
+             << " Details:\n"
+             << "   Spacing: " << mat.spacing() << "\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major MappedMatrix of a transposed expression";
+
+      TDMT tmp( 3UL, 4UL );
+      blaze::randomize( tmp );
+
+      const DMT ref( trans( tmp ) );
+
+      blaze::writeMapped( "mappedmatrix.blaze", trans( tmp ) );
+      const MT mat( "mappedmatrix.blaze" );
+
+      checkRows   ( mat, 4UL );
+      checkColumns( mat, 3UL );
+
+      if( mat != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Mapping failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major MappedMatrix of an empty matrix";
+
+      blaze::writeMapped( "mappedmatrix.blaze", DMT( 0UL, 3UL ) );
+      const MT mat( "mappedmatrix.blaze" );
+
+      checkRows   ( mat, 0UL );
+      checkColumns( mat, 3UL );
+   }
+
+   std::remove( "mappedmatrix.blaze" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the MappedCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function writes several sparse matrices via the writeMapped() function and maps them
+// via the MappedCompressedMatrix class template. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSparseMatrix()
+{
+   {
+      test_ = "Row-major MappedCompressedMatrix of a 3x4 matrix";
+
+      CMT ref( 3UL, 4UL );
+      ref(0,3) = 1;
+      ref(2,0) = 2;
+      ref(2,1) = 3;
+
+      blaze::writeMapped( "mappedmatrix.blaze", ref );
+      const SMT mat( "mappedmatrix.blaze" );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 2UL );
+
+      if( mat != ref || mat(2,1) != 3 || mat(1,1) != 0 ||
+          mat.find( 2UL, 1UL ) == mat.end( 2UL ) || mat.find( 2UL, 2UL ) != mat.end( 2UL ) ||
+          mat.lowerBound( 0UL, 1UL )->index() != 3UL ||
+          mat.upperBound( 2UL, 0UL )->index() != 1UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Mapping failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 0 1 )\n( 0 0 0 0 )\n( 2 3 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major MappedCompressedMatrix of a 3x4 matrix";
+
+      TCMT ref( 3UL, 4UL );
+      ref(0,3) = 1;
+      ref(2,0) = 2;
+      ref(2,1) = 3;
+
+      blaze::writeMapped( "mappedmatrix.blaze", ref );
+      const TSMT mat( "mappedmatrix.blaze" );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 2UL, 0UL );
+      checkNonZeros( mat, 3UL, 1UL );
+
+      if( mat != ref || mat(2,1) != 3 || mat(1,1) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Mapping failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 0 1 )\n( 0 0 0 0 )\n( 2 3 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major MappedCompressedMatrix with 32-bit indices";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor,uint32_t> ref( 50UL, 40UL );
+      blaze::randomize( ref, 200UL );
+
+      blaze::writeMapped( "mappedmatrix.blaze", ref );
+      typedef blaze::MappedCompressedMatrix<double,blaze::rowMajor,uint32_t>  MappedType;
+      const MappedType mat( "mappedmatrix.blaze" );
+
+      checkRows    ( mat, 50UL );
+      checkColumns ( mat, 40UL );
+      checkNonZeros( mat, ref.nonZeros() );
+
+      if( mat != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Mapping failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major MappedCompressedMatrix of a dense matrix";
+
+      DMT tmp( 4UL, 3UL, 0 );
+      tmp(1,2) = 5;
+      tmp(3,0) = -2;
+
+      blaze::writeMapped( "mappedmatrix.blaze", blaze::CompressedMatrix<int,true>( tmp ) );
+      const TSMT mat( "mappedmatrix.blaze" );
+
+      checkNonZeros( mat, 2UL );
+
+      if( mat != tmp ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Mapping failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << tmp << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major MappedCompressedMatrix of a sparse expression";
+
+      CMT tmp( 3UL, 4UL );
+      tmp(0,1) = 2;
+      tmp(2,3) = 4;
+
+      blaze::writeMapped( "mappedmatrix.blaze", tmp * 2 );
+      const SMT mat( "mappedmatrix.blaze" );
+
+      checkNonZeros( mat, 2UL );
+
+      if( mat(0,1) != 4 || mat(2,3) != 8 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Mapping failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 4 0 0 )\n( 0 0 0 0 )\n( 0 0 0 8 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major MappedCompressedMatrix of an empty matrix";
+
+      blaze::writeMapped( "mappedmatrix.blaze", CMT( 2UL, 3UL ) );
+      const SMT mat( "mappedmatrix.blaze" );
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   std::remove( "mappedmatrix.blaze" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of mapped matrices in expressions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the use of MappedMatrix and MappedCompressedMatrix instances in dense
+// and sparse matrix expressions. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testExpressions()
+{
+   {
+      test_ = "MappedMatrix/dense vector multiplication";
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> A( 37UL, 29UL );
+      blaze::DynamicVector<double,blaze::columnVector> x( 29UL );
+      blaze::randomize( A );
+      blaze::randomize( x );
+
+      blaze::writeMapped( "mappedmatrix.blaze", A );
+      const blaze::MappedMatrix<double,blaze::rowMajor> mat( "mappedmatrix.blaze" );
+
+      const blaze::DynamicVector<double,blaze::columnVector> ref( A * x );
+      const blaze::DynamicVector<double,blaze::columnVector> res( mat * x );
+
+      if( res != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << res << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "MappedMatrix addition and submatrix";
+
+      DMT A( 6UL, 5UL );
+      blaze::randomize( A );
+
+      blaze::writeMapped( "mappedmatrix.blaze", A );
+      const MT mat( "mappedmatrix.blaze" );
+
+      const DMT ref( A + A * trans( A ) * A );
+      const DMT res( mat + mat * trans( mat ) * mat );
+
+      if( res != ref ||
+          submatrix( mat, 1UL, 1UL, 3UL, 2UL ) != submatrix( A, 1UL, 1UL, 3UL, 2UL ) ||
+          row( mat, 2UL ) != row( A, 2UL ) || column( mat, 4UL ) != column( A, 4UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Evaluation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << res << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "MappedCompressedMatrix/dense vector multiplication";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor,uint32_t> A( 37UL, 29UL );
+      blaze::DynamicVector<double,blaze::columnVector> x( 29UL );
+      blaze::randomize( A, 150UL );
+      blaze::randomize( x );
+
+      blaze::writeMapped( "mappedmatrix.blaze", A );
+      typedef blaze::MappedCompressedMatrix<double,blaze::rowMajor,uint32_t>  MappedType;
+      const MappedType mat( "mappedmatrix.blaze" );
+
+      const blaze::DynamicVector<double,blaze::columnVector> ref( A * x );
+      const blaze::DynamicVector<double,blaze::columnVector> res( mat * x );
+
+      if( res != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << res << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "MappedCompressedMatrix/sparse matrix operations";
+
+      CMT A( 6UL, 5UL );
+      blaze::randomize( A, 12UL );
+
+      blaze::writeMapped( "mappedmatrix.blaze", A );
+      const SMT mat( "mappedmatrix.blaze" );
+
+      const CMT ref( trans( A ) + trans( A ) * A * trans( A ) );
+      const CMT res( trans( mat ) + trans( mat ) * mat * trans( mat ) );
+
+      if( res != ref || row( mat, 2UL ) != row( A, 2UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Evaluation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << res << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   std::remove( "mappedmatrix.blaze" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the mapped matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that mapping a file that does not contain a matching matrix results in
+// a \a std::runtime_error exception. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testErrors()
+{
+   DMT dense( 3UL, 4UL, 1 );
+   CMT sparse( 3UL, 4UL );
+   sparse(1,1) = 1;
+
+   {
+      test_ = "Mapping a non-existing file";
+
+      bool failed( false );
+
+      try {
+         const MT mat( "mappedmatrix.missing" );
+      }
+      catch( std::runtime_error& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Mapping a non-existing file succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Mapping a dense matrix with a different storage order";
+
+      blaze::writeMapped( "mappedmatrix.blaze", dense );
+
+      bool failed( false );
+
+      try {
+         const TMT mat( "mappedmatrix.blaze" );
+      }
+      catch( std::runtime_error& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Mapping a row-major matrix as column-major matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Mapping a dense matrix with a different element type";
+
+      blaze::writeMapped( "mappedmatrix.blaze", dense );
+
+      bool failed( false );
+
+      try {
+         const blaze::MappedMatrix<double,blaze::rowMajor> mat( "mappedmatrix.blaze" );
+      }
+      catch( std::runtime_error& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Mapping an integer matrix as double precision matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Mapping a dense matrix as sparse matrix";
+
+      blaze::writeMapped( "mappedmatrix.blaze", dense );
+
+      bool failed( false );
+
+      try {
+         const SMT mat( "mappedmatrix.blaze" );
+      }
+      catch( std::runtime_error& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Mapping a dense matrix as sparse matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Mapping a sparse matrix with a different index type";
+
+      blaze::writeMapped( "mappedmatrix.blaze", sparse );
+
+      bool failed( false );
+
+      try {
+         const blaze::MappedCompressedMatrix<int,blaze::rowMajor,uint32_t> mat( "mappedmatrix.blaze" );
+      }
+      catch( std::runtime_error& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Mapping a matrix with different index type succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Mapping a truncated sparse matrix";
+
+      blaze::writeMapped( "mappedmatrix.blaze", sparse );
+
+      std::ifstream in( "mappedmatrix.blaze", std::ifstream::binary );
+      const std::string content( ( std::istreambuf_iterator<char>( in ) ),
+                                 std::istreambuf_iterator<char>() );
+      in.close();
+
+      std::ofstream out( "mappedmatrix.blaze", std::ofstream::binary | std::ofstream::trunc );
+      out.write( content.data(), content.size() - 1UL );
+      out.close();
+
+      bool failed( false );
+
+      try {
+         const SMT mat( "mappedmatrix.blaze" );
+      }
+      catch( std::runtime_error& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Mapping a truncated file succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   std::remove( "mappedmatrix.blaze" );
+}
+//*************************************************************************************************
+
+} // namespace mappedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running MappedMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_MAPPEDMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during MappedMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
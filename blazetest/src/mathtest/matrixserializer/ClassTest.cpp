@@ -66,6 +66,7 @@ ClassTest::ClassTest()
 {
    testEmptyMatrices();
    testRandomMatrices();
+   testFormat();
    testFailures();
 }
 //*************************************************************************************************
@@ -315,6 +316,109 @@ void ClassTest::testRandomMatrices()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Test of the binary representation of serialized matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the bulk serialization of matrices with numeric elements results
+// in exactly the same binary representation as the element-wise serialization. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFormat()
+{
+   test_ = "Serialization format";
+
+   {
+      blaze::DynamicMatrix<int,blaze::rowMajor> src( 3UL, 5UL );
+      randomize( src );
+
+      std::stringstream result;
+      blaze::Archive<std::stringstream> archive( result );
+      archive << src;
+
+      std::stringstream expected;
+      blaze::Archive<std::stringstream> reference( expected );
+      reference << uint8_t( 1U ) << uint8_t( 1U ) << uint8_t( blaze::TypeValueMapping<int>::value )
+                << uint8_t( sizeof(int) ) << uint64_t( 3UL ) << uint64_t( 5UL ) << uint64_t( 15UL );
+      for( size_t i=0UL; i<3UL; ++i )
+         for( size_t j=0UL; j<5UL; ++j )
+            reference << src(i,j);
+
+      compareStreams( result, expected );
+   }
+
+   {
+      blaze::DynamicMatrix<double,blaze::columnMajor> src( 5UL, 3UL );
+      randomize( src );
+
+      std::stringstream result;
+      blaze::Archive<std::stringstream> archive( result );
+      archive << submatrix( src, 1UL, 1UL, 3UL, 2UL );
+
+      std::stringstream expected;
+      blaze::Archive<std::stringstream> reference( expected );
+      reference << uint8_t( 1U ) << uint8_t( 5U ) << uint8_t( blaze::TypeValueMapping<double>::value )
+                << uint8_t( sizeof(double) ) << uint64_t( 3UL ) << uint64_t( 2UL ) << uint64_t( 6UL );
+      for( size_t j=1UL; j<3UL; ++j )
+         for( size_t i=1UL; i<4UL; ++i )
+            reference << src(i,j);
+
+      compareStreams( result, expected );
+   }
+
+   {
+      blaze::CompressedMatrix<int,blaze::rowMajor> src( 3UL, 4UL );
+      src(0,3) = 1;
+      src(2,0) = 2;
+      src(2,1) = 3;
+
+      std::stringstream result;
+      blaze::Archive<std::stringstream> archive( result );
+      archive << src;
+
+      std::stringstream expected;
+      blaze::Archive<std::stringstream> reference( expected );
+      reference << uint8_t( 1U ) << uint8_t( 3U ) << uint8_t( blaze::TypeValueMapping<int>::value )
+                << uint8_t( sizeof(int) ) << uint64_t( 3UL ) << uint64_t( 4UL ) << uint64_t( 3UL )
+                << uint64_t( 1UL ) << size_t( 3UL ) << 1
+                << uint64_t( 0UL )
+                << uint64_t( 2UL ) << size_t( 0UL ) << 2 << size_t( 1UL ) << 3;
+
+      compareStreams( result, expected );
+   }
+
+   {
+      blaze::CompressedMatrix<double,blaze::columnMajor> src( 3UL, 4UL );
+      src(0,3) = 1.0;
+      src(2,0) = 2.0;
+      src(1,0) = 3.0;
+
+      std::stringstream result;
+      blaze::Archive<std::stringstream> archive( result );
+      archive << src;
+
+      std::stringstream expected;
+      blaze::Archive<std::stringstream> reference( expected );
+      reference << uint8_t( 1U ) << uint8_t( 7U ) << uint8_t( blaze::TypeValueMapping<double>::value )
+                << uint8_t( sizeof(double) ) << uint64_t( 3UL ) << uint64_t( 4UL ) << uint64_t( 3UL )
+                << uint64_t( 2UL ) << size_t( 1UL ) << 3.0 << size_t( 2UL ) << 2.0
+                << uint64_t( 0UL )
+                << uint64_t( 0UL )
+                << uint64_t( 1UL ) << size_t( 0UL ) << 1.0;
+
+      compareStreams( result, expected );
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> dst;
+      archive >> dst;
+
+      compareMatrices( src, dst );
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Test of failing serialization attempts.
 //
@@ -420,6 +524,74 @@ void ClassTest::testFailures()
    }
    catch( std::runtime_error& )
    {}
+
+   try {
+      std::stringstream stream;
+      blaze::Archive<std::stringstream> archive( stream );
+      archive << uint8_t( 1U ) << uint8_t( 3U ) << uint8_t( blaze::TypeValueMapping<int>::value )
+              << uint8_t( sizeof(int) ) << uint64_t( 2UL ) << uint64_t( 4UL ) << uint64_t( 1UL )
+              << uint64_t( 1UL ) << size_t( 7UL ) << 1
+              << uint64_t( 0UL );
+
+      blaze::CompressedMatrix<int> dst;
+      archive >> dst;
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid column index succeeded\n"
+          << " Details:\n"
+          << "   Destination:\n" << dst << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
+
+   try {
+      std::stringstream stream;
+      blaze::Archive<std::stringstream> archive( stream );
+      archive << uint8_t( 1U ) << uint8_t( 3U ) << uint8_t( blaze::TypeValueMapping<int>::value )
+              << uint8_t( sizeof(int) ) << uint64_t( 2UL ) << uint64_t( 4UL ) << uint64_t( 1UL )
+              << uint64_t( 2UL ) << size_t( 0UL ) << 1 << size_t( 2UL ) << 2
+              << uint64_t( 0UL );
+
+      blaze::CompressedMatrix<int> dst;
+      archive >> dst;
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of non-zero elements succeeded\n"
+          << " Details:\n"
+          << "   Destination:\n" << dst << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of the binary representations of two serialized matrices.
+//
+// \param result The binary representation of the serialized matrix.
+// \param expected The expected binary representation.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the contents of the two given streams. In case they differ, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::compareStreams( const std::stringstream& result, const std::stringstream& expected )
+{
+   if( result.str() != expected.str() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid binary representation detected\n"
+          << " Details:\n"
+          << "   Size of the result         : " << result.str().size() << "\n"
+          << "   Size of the expected result: " << expected.str().size() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
 }
 //*************************************************************************************************
 
@@ -0,0 +1,1213 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/packedmatrix/ClassTest.cpp
+//  \brief Source file for the PackedMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DiagonalMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/LowerMatrix.h>
+#include <blaze/math/SymmetricMatrix.h>
+#include <blaze/math/UpperMatrix.h>
+#include <blazetest/mathtest/packedmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace packedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the PackedMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testAddAssign();
+   testSubAssign();
+   testMultAssign();
+   testScaling();
+   testFunctionCall();
+   testIterator();
+   testNonZeros();
+   testReset();
+   testClear();
+   testResize();
+   testSwap();
+   testAdaptors();
+   testIsDefault();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the PackedMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the PackedMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major PackedMatrix default constructor";
+
+      LMT mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Size constructors
+   //=====================================================================================
+
+   {
+      test_ = "Row-major PackedMatrix size constructor (4x4)";
+
+      LMT mat( 4UL );
+
+      checkRows    ( mat, 4UL );
+      checkColumns ( mat, 4UL );
+      checkCapacity( mat, 10UL );
+   }
+
+   {
+      test_ = "Row-major PackedMatrix size constructor (0x0)";
+
+      DMT mat( 0UL, 0UL );
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   {
+      test_ = "Row-major PackedMatrix size constructor (2x3)";
+
+      try {
+         LMT mat( 2UL, 3UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of non-square packed matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Homogeneous initialization
+   //=====================================================================================
+
+   {
+      test_ = "Row-major PackedMatrix homogeneous initialization constructor (3x3)";
+
+      UMT mat( 3UL, 3UL, 2 );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 6UL );
+      checkNonZeros( mat, 6UL );
+      checkNonZeros( mat, 0UL, 3UL );
+      checkNonZeros( mat, 1UL, 2UL );
+      checkNonZeros( mat, 2UL, 1UL );
+
+      if( mat(0,0) != 2 || mat(0,1) != 2 || mat(0,2) != 2 ||
+          mat(1,0) != 0 || mat(1,1) != 2 || mat(1,2) != 2 ||
+          mat(2,0) != 0 || mat(2,1) != 0 || mat(2,2) != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 2 2 2 )\n( 0 2 2 )\n( 0 0 2 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major PackedMatrix homogeneous initialization constructor (3x3)";
+
+      OSMT mat( 3UL, 3UL, 2 );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 6UL );
+      checkNonZeros( mat, 9UL );
+      checkNonZeros( mat, 0UL, 3UL );
+      checkNonZeros( mat, 1UL, 3UL );
+      checkNonZeros( mat, 2UL, 3UL );
+   }
+
+
+   //=====================================================================================
+   // Copy constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major PackedMatrix copy constructor";
+
+      SMT mat1( 3UL, 3UL, 0 );
+      mat1(1,0) = 1;
+      mat1(2,2) = 3;
+      SMT mat2( mat1 );
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 3UL );
+
+      if( mat2(0,0) != 0 || mat2(0,1) != 1 || mat2(0,2) != 0 ||
+          mat2(1,0) != 1 || mat2(1,1) != 0 || mat2(1,2) != 0 ||
+          mat2(2,0) != 0 || mat2(2,1) != 0 || mat2(2,2) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 0 1 0 )\n( 1 0 0 )\n( 0 0 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Conversion constructors
+   //=====================================================================================
+
+   {
+      test_ = "Column-major PackedMatrix dense matrix constructor";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> mat1( 3UL, 3UL, 0 );
+      mat1(0,0) = 1;
+      mat1(2,0) = 2;
+      mat1(2,1) = 3;
+      OLMT mat2( mat1 );
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 3UL );
+      checkNonZeros( mat2, 0UL, 2UL );
+      checkNonZeros( mat2, 1UL, 1UL );
+      checkNonZeros( mat2, 2UL, 0UL );
+
+      if( mat2(0,0) != 1 || mat2(0,1) != 0 || mat2(0,2) != 0 ||
+          mat2(1,0) != 0 || mat2(1,1) != 0 || mat2(1,2) != 0 ||
+          mat2(2,0) != 2 || mat2(2,1) != 3 || mat2(2,2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 0 0 )\n( 0 0 0 )\n( 2 3 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major PackedMatrix dense matrix constructor (non-lower)";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> mat1( 3UL, 3UL, 0 );
+      mat1(0,2) = 1;
+
+      try {
+         LMT mat2( mat1 );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of lower packed matrix with upper element succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the PackedMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the PackedMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   //=====================================================================================
+   // Homogeneous assignment
+   //=====================================================================================
+
+   {
+      test_ = "Row-major PackedMatrix homogeneous assignment";
+
+      DMT mat( 3UL );
+      mat = 2;
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+
+      if( mat(0,0) != 2 || mat(0,1) != 0 || mat(1,1) != 2 || mat(2,1) != 0 || mat(2,2) != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 2 0 0 )\n( 0 2 0 )\n( 0 0 2 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Copy assignment
+   //=====================================================================================
+
+   {
+      test_ = "Row-major PackedMatrix copy assignment";
+
+      LMT mat1( 2UL, 2UL, 1 );
+      LMT mat2;
+      mat2 = mat1;
+
+      checkRows    ( mat2, 2UL );
+      checkColumns ( mat2, 2UL );
+      checkNonZeros( mat2, 3UL );
+
+      if( mat2(0,0) != 1 || mat2(0,1) != 0 || mat2(1,0) != 1 || mat2(1,1) != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 0 )\n( 1 1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Dense matrix assignment
+   //=====================================================================================
+
+   {
+      test_ = "Row-major PackedMatrix dense matrix assignment";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> mat1( 3UL, 3UL, 0 );
+      mat1(0,1) = 1; mat1(1,0) = 1; mat1(2,2) = 4;
+
+      SMT mat2;
+      mat2 = mat1;
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 3UL );
+
+      if( mat2(0,1) != 1 || mat2(1,0) != 1 || mat2(2,2) != 4 || mat2(1,2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 0 1 0 )\n( 1 0 0 )\n( 0 0 4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major PackedMatrix dense matrix assignment (non-symmetric)";
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> mat1( 3UL, 3UL, 0 );
+      mat1(0,1) = 1;
+
+      SMT mat2;
+
+      try {
+         mat2 = mat1;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of non-symmetric matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Sparse matrix assignment
+   //=====================================================================================
+
+   {
+      test_ = "Column-major PackedMatrix sparse matrix assignment";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat1( 3UL, 3UL );
+      mat1(1,1) = 2;
+      mat1(2,0) = 3;
+
+      OLMT mat2( 3UL, 3UL, 5 );
+      mat2 = mat1;
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 2UL );
+
+      if( mat2(0,0) != 0 || mat2(1,1) != 2 || mat2(2,0) != 3 || mat2(2,2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 0 0 0 )\n( 0 2 0 )\n( 3 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the PackedMatrix addition assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the addition assignment operators of the PackedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAddAssign()
+{
+   {
+      test_ = "Row-major PackedMatrix dense matrix addition assignment";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> mat1( 3UL, 3UL, 0 );
+      mat1(1,0) = 2; mat1(2,2) = -1;
+
+      LMT mat2( 3UL, 3UL, 1 );
+      mat2 += mat1;
+
+      checkNonZeros( mat2, 5UL );
+
+      if( mat2(0,0) != 1 || mat2(1,0) != 3 || mat2(1,1) != 1 ||
+          mat2(2,0) != 1 || mat2(2,1) != 1 || mat2(2,2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 0 0 )\n( 3 1 0 )\n( 1 1 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major PackedMatrix dense matrix addition assignment (non-lower)";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> mat1( 3UL, 3UL, 0 );
+      mat1(0,1) = 2;
+
+      LMT mat2( 3UL, 3UL, 1 );
+
+      try {
+         mat2 += mat1;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment of non-lower matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Column-major PackedMatrix sparse matrix addition assignment";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat1( 3UL, 3UL );
+      mat1(0,2) = 4;
+      mat1(2,0) = 4;
+
+      OSMT mat2( 3UL, 3UL, 1 );
+      mat2 += mat1;
+
+      checkNonZeros( mat2, 9UL );
+
+      if( mat2(0,2) != 5 || mat2(2,0) != 5 || mat2(1,2) != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 1 5 )\n( 1 1 1 )\n( 5 1 1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the PackedMatrix subtraction assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the subtraction assignment operators of the PackedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSubAssign()
+{
+   {
+      test_ = "Row-major PackedMatrix dense matrix subtraction assignment";
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> mat1( 3UL, 3UL, 0 );
+      mat1(0,2) = 1; mat1(1,1) = 1;
+
+      UMT mat2( 3UL, 3UL, 1 );
+      mat2 -= mat1;
+
+      checkNonZeros( mat2, 4UL );
+
+      if( mat2(0,0) != 1 || mat2(0,1) != 1 || mat2(0,2) != 0 ||
+          mat2(1,1) != 0 || mat2(1,2) != 1 || mat2(2,2) != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subtraction assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 1 0 )\n( 0 0 1 )\n( 0 0 1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major PackedMatrix diagonal matrix subtraction assignment";
+
+      DMT mat1( 3UL, 3UL, 1 );
+      SMT mat2( 3UL, 3UL, 1 );
+      mat2 -= mat1;
+
+      checkNonZeros( mat2, 6UL );
+
+      if( mat2(0,0) != 0 || mat2(1,1) != 0 || mat2(2,2) != 0 || mat2(0,1) != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subtraction assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 0 1 1 )\n( 1 0 1 )\n( 1 1 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the PackedMatrix multiplication assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiplication assignment operators of the PackedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultAssign()
+{
+   {
+      test_ = "Row-major PackedMatrix packed matrix multiplication assignment";
+
+      LMT mat1( 3UL, 3UL, 1 );
+      LMT mat2( 3UL, 3UL, 1 );
+      mat2 *= mat1;
+
+      checkNonZeros( mat2, 6UL );
+
+      if( mat2(0,0) != 1 || mat2(1,0) != 2 || mat2(1,1) != 1 ||
+          mat2(2,0) != 3 || mat2(2,1) != 2 || mat2(2,2) != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 0 0 )\n( 2 1 0 )\n( 3 2 1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major PackedMatrix dense matrix multiplication assignment (non-lower)";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> mat1( 3UL, 3UL, 1 );
+      LMT mat2( 3UL, 3UL, 1 );
+
+      try {
+         mat2 *= mat1;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication assignment with non-lower result succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of all PackedMatrix (self-)scaling operations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all available ways to scale an instance of the PackedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testScaling()
+{
+   {
+      test_ = "Row-major self-scaling (M*=s)";
+
+      SMT mat( 2UL, 2UL, 1 );
+      mat *= 3;
+
+      if( mat(0,0) != 3 || mat(0,1) != 3 || mat(1,0) != 3 || mat(1,1) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed self-scaling operation\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 3 3 )\n( 3 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major self-scaling (M=M*s)";
+
+      LMT mat( 2UL, 2UL, 1 );
+      mat = mat * 2;
+
+      if( mat(0,0) != 2 || mat(0,1) != 0 || mat(1,0) != 2 || mat(1,1) != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed self-scaling operation\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 2 0 )\n( 2 2 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major self-scaling (M/=s)";
+
+      OLMT mat( 2UL, 2UL, 4 );
+      mat /= 2;
+
+      if( mat(0,0) != 2 || mat(0,1) != 0 || mat(1,0) != 2 || mat(1,1) != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed self-scaling operation\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 2 0 )\n( 2 2 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the PackedMatrix function call operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of adding and accessing elements via the function call operator
+// of the PackedMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testFunctionCall()
+{
+   {
+      test_ = "Row-major PackedMatrix::operator() (lower)";
+
+      LMT mat( 3UL, 3UL, 0 );
+      mat(2,1) = 1;
+      mat(1,1) = 2;
+      mat(0,2) = 3;
+
+      checkNonZeros( mat, 2UL );
+
+      if( mat(2,1) != 1 || mat(1,1) != 2 || mat(0,2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Function call operator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 0 )\n( 0 2 0 )\n( 0 1 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major PackedMatrix::operator() (symmetric)";
+
+      OSMT mat( 3UL, 3UL, 0 );
+      mat(2,0) = 1;
+      mat(0,1) = 2;
+      mat(1,1) += 3;
+
+      checkNonZeros( mat, 5UL );
+
+      if( mat(0,2) != 1 || mat(2,0) != 1 || mat(1,0) != 2 || mat(0,1) != 2 || mat(1,1) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Function call operator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 2 1 )\n( 2 3 0 )\n( 1 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the PackedMatrix iterator implementation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the iterator implementation of the PackedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIterator()
+{
+   {
+      test_ = "Row-major PackedMatrix iterator traversal";
+
+      UMT mat( 3UL, 3UL, 1 );
+
+      const ptrdiff_t number( mat.cend(1UL) - mat.cbegin(1UL) );
+
+      if( number != 3L ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of elements detected\n"
+             << " Details:\n"
+             << "   Number of elements         : " << number << "\n"
+             << "   Expected number of elements: 3\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      int sum( 0 );
+      for( UMT::ConstIterator it=mat.cbegin(1UL); it!=mat.cend(1UL); ++it )
+         sum += *it;
+
+      if( sum != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid sum of elements detected\n"
+             << " Details:\n"
+             << "   Sum         : " << sum << "\n"
+             << "   Expected sum: 2\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major PackedMatrix iterator assignment";
+
+      OSMT mat( 3UL, 3UL, 0 );
+
+      OSMT::Iterator it( mat.begin(2UL) );
+      *it = 4;
+      it += 2UL;
+      *it = 5;
+
+      if( mat(0,2) != 4 || mat(2,0) != 4 || mat(2,2) != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment via iterator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 4 )\n( 0 0 0 )\n( 4 0 5 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c nonZeros() member function of the PackedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c nonZeros() member function of the PackedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNonZeros()
+{
+   {
+      test_ = "Row-major PackedMatrix::nonZeros()";
+
+      SMT mat( 3UL, 3UL, 0 );
+      mat(2,0) = 1;
+      mat(1,1) = 2;
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 6UL );
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 1UL );
+   }
+
+   {
+      test_ = "Column-major PackedMatrix::nonZeros()";
+
+      OLMT mat( 3UL, 3UL, 1 );
+      mat(2,0) = 0;
+
+      checkNonZeros( mat, 5UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 1UL, 2UL );
+      checkNonZeros( mat, 2UL, 1UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reset() member function of the PackedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reset() member function of the PackedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReset()
+{
+   {
+      test_ = "Row-major PackedMatrix::reset( size_t )";
+
+      SMT mat( 3UL, 3UL, 1 );
+      reset( mat, 1UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 4UL );
+
+      if( mat(1,0) != 0 || mat(1,2) != 0 || mat(0,1) != 0 || mat(2,1) != 0 || mat(2,0) != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reset operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 1 )\n( 0 0 0 )\n( 1 0 1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major PackedMatrix::reset()";
+
+      OLMT mat( 3UL, 3UL, 1 );
+      reset( mat );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 0UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c clear() member function of the PackedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c clear() member function of the PackedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testClear()
+{
+   {
+      test_ = "Row-major PackedMatrix::clear()";
+
+      UMT mat( 3UL, 3UL, 1 );
+      clear( mat );
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c resize() member function of the PackedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c resize() member function of the PackedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testResize()
+{
+   {
+      test_ = "Row-major PackedMatrix::resize()";
+
+      UMT mat( 2UL, 2UL, 0 );
+      mat(0,0) = 1;
+      mat(0,1) = 2;
+      mat(1,1) = 3;
+
+      mat.resize( 4UL, 4UL );
+
+      checkRows    ( mat, 4UL );
+      checkColumns ( mat, 4UL );
+      checkCapacity( mat, 10UL );
+
+      if( mat(0,0) != 1 || mat(0,1) != 2 || mat(1,1) != 3 || mat(1,0) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing the matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 2 x x )\n( 0 3 x x )\n( 0 0 x x )\n( 0 0 0 x )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      mat.resize( 1UL, 1UL );
+
+      checkRows    ( mat, 1UL );
+      checkColumns ( mat, 1UL );
+
+      if( mat(0,0) != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing the matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major PackedMatrix::resize() (non-square)";
+
+      LMT mat( 2UL );
+
+      try {
+         mat.resize( 2UL, 3UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing to non-square matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c swap() functionality of the PackedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c swap() function of the PackedMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   {
+      test_ = "Row-major PackedMatrix swap";
+
+      LMT mat1( 2UL, 2UL, 1 );
+      LMT mat2( 3UL, 3UL, 2 );
+
+      swap( mat1, mat2 );
+
+      checkRows    ( mat1, 3UL );
+      checkColumns ( mat1, 3UL );
+      checkNonZeros( mat1, 6UL );
+      checkRows    ( mat2, 2UL );
+      checkColumns ( mat2, 2UL );
+      checkNonZeros( mat2, 3UL );
+
+      if( mat1(2,0) != 2 || mat2(1,0) != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Swapping the first matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat1 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the PackedMatrix class template as underlying storage of matrix adaptors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the PackedMatrix class template as adapted matrix type of the
+// LowerMatrix, UpperMatrix, SymmetricMatrix and DiagonalMatrix adaptors. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAdaptors()
+{
+   {
+      test_ = "LowerMatrix< PackedMatrix > matrix/vector multiplication";
+
+      blaze::LowerMatrix<LMT> lower( 3UL );
+      lower(0,0) = 1;
+      lower(1,0) = 2;
+      lower(2,2) = 3;
+
+      blaze::DynamicVector<int,blaze::columnVector> vec( 3UL, 1 );
+      blaze::DynamicVector<int,blaze::columnVector> res( lower * vec );
+
+      if( res[0] != 1 || res[1] != 2 || res[2] != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << res << "\n"
+             << "   Expected result:\n( 1 2 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      try {
+         lower(0,1) = 5;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment to upper matrix element succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << lower << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "SymmetricMatrix< PackedMatrix > matrix/matrix multiplication";
+
+      blaze::SymmetricMatrix<OSMT> sym( 2UL );
+      sym(0,0) = 1;
+      sym(0,1) = 2;
+
+      blaze::DiagonalMatrix<DMT> diag( 2UL );
+      diag(0,0) = 2;
+      diag(1,1) = 3;
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> res( diag * sym * diag );
+
+      if( res(0,0) != 4 || res(0,1) != 12 || res(1,0) != 12 || res(1,1) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << res << "\n"
+             << "   Expected result:\n( 4 12 )\n( 12 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "UpperMatrix< PackedMatrix > transpose assignment";
+
+      blaze::LowerMatrix<LMT> lower( 2UL );
+      lower(1,0) = 2;
+      lower(1,1) = 3;
+
+      blaze::UpperMatrix<UMT> upper;
+      upper = trans( lower );
+
+      if( upper(0,0) != 0 || upper(0,1) != 2 || upper(1,0) != 0 || upper(1,1) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << upper << "\n"
+             << "   Expected result:\n( 0 2 )\n( 0 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c isDefault() function with the PackedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c isDefault() function with the PackedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIsDefault()
+{
+   test_ = "isDefault() function";
+
+   {
+      LMT mat;
+
+      if( isDefault( mat ) != true ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isDefault evaluation\n"
+             << " Details:\n"
+             << "   Matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      LMT mat( 2UL, 2UL, 0 );
+
+      if( isDefault( mat ) != false ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isDefault evaluation\n"
+             << " Details:\n"
+             << "   Matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace packedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running PackedMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_PACKEDMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during PackedMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
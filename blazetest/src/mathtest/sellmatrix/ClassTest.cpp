@@ -0,0 +1,1144 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/sellmatrix/ClassTest.cpp
+//  \brief Source file for the SellMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/system/Thresholds.h>
+#include <blazetest/mathtest/sellmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace sellmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SellMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testFunctionCall();
+   testIterator();
+   testNonZeros();
+   testScaling();
+   testReset();
+   testClear();
+   testSwap();
+   testFind();
+   testLowerBound();
+   testUpperBound();
+   testMultiplication();
+   testIsDefault();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the SellMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the SellMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "SellMatrix default constructor";
+
+      MT mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Size constructor
+   //=====================================================================================
+
+   {
+      test_ = "SellMatrix size constructor (3x4)";
+
+      MT mat( 3UL, 4UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 0UL );
+      checkNonZeros( mat, 0UL, 0UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Copy constructor
+   //=====================================================================================
+
+   {
+      test_ = "SellMatrix copy constructor";
+
+      CMT ref( 5UL, 6UL );
+      ref(0,1) = 1;
+      ref(0,4) = 2;
+      ref(1,0) = 3;
+      ref(2,2) = 4;
+      ref(2,3) = 5;
+      ref(2,5) = 6;
+      ref(4,0) = 7;
+
+      const MT mat1( ref );
+      const MT mat2( mat1 );
+
+      checkRows    ( mat2, 5UL );
+      checkColumns ( mat2, 6UL );
+      checkCapacity( mat2, 7UL );
+      checkNonZeros( mat2, 7UL );
+
+      if( mat2 != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Conversion constructors
+   //=====================================================================================
+
+   {
+      test_ = "SellMatrix compressed matrix constructor";
+
+      CMT ref( 5UL, 6UL );
+      ref(0,1) = 1;
+      ref(0,4) = 2;
+      ref(1,0) = 3;
+      ref(2,2) = 4;
+      ref(2,3) = 5;
+      ref(2,5) = 6;
+      ref(4,0) = 7;
+
+      const MT mat( ref );
+
+      checkRows    ( mat, 5UL );
+      checkColumns ( mat, 6UL );
+      checkCapacity( mat, 7UL );
+      checkNonZeros( mat, 7UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 3UL );
+      checkNonZeros( mat, 3UL, 0UL );
+      checkNonZeros( mat, 4UL, 1UL );
+
+      if( mat.chunks() != 2UL || mat.sigma() != 128UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid chunk setup detected\n"
+             << " Details:\n"
+             << "   Number of chunks         : " << mat.chunks() << "\n"
+             << "   Expected number of chunks: 2\n"
+             << "   Sorting window           : " << mat.sigma() << "\n"
+             << "   Expected sorting window  : 128\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( mat != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SellMatrix dense matrix constructor with sorting window";
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> ref( 3UL, 3UL, 0 );
+      ref(0,0) =  1;
+      ref(1,1) = -2;
+      ref(1,2) =  3;
+      ref(2,0) =  4;
+
+      const MT mat( ref, 1UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 4UL );
+
+      if( mat.sigma() != 4UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid sorting window detected\n"
+             << " Details:\n"
+             << "   Sorting window         : " << mat.sigma() << "\n"
+             << "   Expected sorting window: 4\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( mat(0,0) != 1 || mat(0,1) != 0 || mat(0,2) != 0 ||
+          mat(1,0) != 0 || mat(1,1) != -2 || mat(1,2) != 3 ||
+          mat(2,0) != 4 || mat(2,1) != 0 || mat(2,2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n(  1  0  0 )\n(  0 -2  3 )\n(  4  0  0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SellMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the SellMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   {
+      test_ = "SellMatrix copy assignment";
+
+      CMT ref( 3UL, 4UL );
+      ref(0,3) = 1;
+      ref(1,0) = 2;
+      ref(1,1) = 3;
+
+      const MT mat1( ref );
+      MT mat2;
+      mat2 = mat1;
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 4UL );
+      checkNonZeros( mat2, 3UL );
+
+      if( mat2 != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SellMatrix matrix assignment";
+
+      CMT ref( 3UL, 4UL );
+      ref(0,3) = 1;
+      ref(1,0) = 2;
+      ref(2,1) = 3;
+      ref(2,2) = 4;
+
+      MT mat( ref, 1UL );
+      mat = ref * 2;
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 4UL );
+
+      if( mat.sigma() != 4UL || mat != ref * 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Sorting window: " << mat.sigma() << "\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << ref * 2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SellMatrix function call operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the function call operator of the SellMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFunctionCall()
+{
+   test_ = "SellMatrix::operator()";
+
+   CMT ref( 7UL, 5UL );
+   ref(0,2) = 1;
+   ref(1,0) = 2;
+   ref(1,4) = 3;
+   ref(3,1) = 4;
+   ref(3,2) = 5;
+   ref(3,3) = 6;
+   ref(6,4) = 7;
+
+   const MT mat( ref );
+
+   for( size_t i=0UL; i<ref.rows(); ++i ) {
+      for( size_t j=0UL; j<ref.columns(); ++j ) {
+         if( mat(i,j) != ref(i,j) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid element access\n"
+                << " Details:\n"
+                << "   Element (" << i << "," << j << "): " << mat(i,j) << "\n"
+                << "   Expected element: " << ref(i,j) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SellMatrix iterator implementation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the iterator implementation of the SellMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIterator()
+{
+   typedef MT::Iterator       Iterator;
+   typedef MT::ConstIterator  ConstIterator;
+
+   CMT ref( 3UL, 3UL );
+   ref(0,1) =  1;
+   ref(1,0) = -2;
+   ref(1,2) = -3;
+   ref(2,1) =  4;
+   ref(2,2) =  5;
+
+   MT mat( ref );
+
+   // Testing the Iterator default constructor
+   {
+      test_ = "Iterator default constructor";
+
+      Iterator it = Iterator();
+
+      if( it != Iterator() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed iterator default constructor\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Testing conversion from Iterator to ConstIterator
+   {
+      test_ = "Iterator/ConstIterator conversion";
+
+      ConstIterator it( mat.begin( 1UL ) );
+
+      if( it == mat.end( 1UL ) || it->value() != -2 || it->index() != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed iterator conversion detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Counting the number of elements in the 1st row via ConstIterator
+   {
+      test_ = "ConstIterator subtraction";
+
+      const size_t number( mat.cend( 1UL ) - mat.cbegin( 1UL ) );
+
+      if( number != 2UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of elements detected\n"
+             << " Details:\n"
+             << "   Number of elements         : " << number << "\n"
+             << "   Expected number of elements: 2\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Testing read-only access via ConstIterator
+   {
+      test_ = "read-only access via ConstIterator";
+
+      ConstIterator it ( mat.cbegin( 2UL ) );
+      ConstIterator end( mat.cend( 2UL ) );
+
+      if( it == end || it->value() != 4 || it->index() != 1UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid initial iterator detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      ++it;
+
+      if( it == end || it->value() != 5 || it->index() != 2UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Iterator pre-increment failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      it++;
+
+      if( it != end ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Iterator post-increment failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Testing value modification via Iterator
+   {
+      test_ = "value modification via Iterator";
+
+      int value = 0;
+
+      for( Iterator it=mat.begin( 1UL ); it!=mat.end( 1UL ); ++it ) {
+         it->value() = value++;
+      }
+
+      if( mat(1,0) != 0 || mat(1,1) != 0 || mat(1,2) != 1 || mat.nonZeros() != 5UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Modification via iterator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 1 0 )\n( 0 0 1 )\n( 0 4 5 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c nonZeros() member function of the SellMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c nonZeros() member function of the SellMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNonZeros()
+{
+   test_ = "SellMatrix::nonZeros()";
+
+   CMT ref( 9UL, 4UL );
+   for( size_t i=0UL; i<ref.rows(); ++i ) {
+      for( size_t j=0UL; j<( i % 5UL ) && j<ref.columns(); ++j ) {
+         ref(i,j) = int( i+j+1UL );
+      }
+   }
+
+   const MT mat( ref, 4UL );
+
+   checkRows    ( mat, 9UL );
+   checkColumns ( mat, 4UL );
+   checkCapacity( mat, ref.nonZeros() );
+   checkNonZeros( mat, ref.nonZeros() );
+
+   for( size_t i=0UL; i<ref.rows(); ++i ) {
+      checkNonZeros( mat, i, ref.nonZeros( i ) );
+      checkCapacity( mat, ref.nonZeros( i ) );
+   }
+
+   if( mat.capacity() % 4UL != 0UL || mat != ref ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid storage detected\n"
+          << " Details:\n"
+          << "   Capacity: " << mat.capacity() << "\n"
+          << "   Result:\n" << mat << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c scale() member function of the SellMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c scale() member function of the SellMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testScaling()
+{
+   test_ = "SellMatrix::scale()";
+
+   CMT ref( 3UL, 3UL );
+   ref(0,0) = 1;
+   ref(1,2) = 2;
+   ref(2,1) = 3;
+
+   MT mat( ref );
+   mat.scale( 3 );
+
+   if( mat(0,0) != 3 || mat(1,2) != 6 || mat(2,1) != 9 || mat.nonZeros() != 3UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Scale operation failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n"
+          << "   Expected result:\n( 3 0 0 )\n( 0 0 6 )\n( 0 9 0 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reset() member function of the SellMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reset() member function of the SellMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReset()
+{
+   test_ = "SellMatrix::reset()";
+
+   CMT ref( 3UL, 4UL );
+   ref(0,0) = 1;
+   ref(1,2) = 2;
+   ref(2,3) = 3;
+
+   MT mat( ref );
+   reset( mat );
+
+   checkRows    ( mat, 3UL );
+   checkColumns ( mat, 4UL );
+   checkNonZeros( mat, 0UL );
+
+   if( mat(0,0) != 0 || mat(1,2) != 0 || mat(2,3) != 0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reset operation failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c clear() member function of the SellMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c clear() member function of the SellMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testClear()
+{
+   test_ = "SellMatrix::clear()";
+
+   CMT ref( 3UL, 4UL );
+   ref(0,0) = 1;
+   ref(2,3) = 3;
+
+   MT mat( ref );
+   clear( mat );
+
+   checkRows    ( mat, 0UL );
+   checkColumns ( mat, 0UL );
+   checkNonZeros( mat, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c swap() functionality of the SellMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c swap() function of the SellMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   test_ = "SellMatrix swap";
+
+   CMT ref1( 2UL, 3UL );
+   ref1(0,1) = 1;
+   ref1(1,2) = 2;
+
+   CMT ref2( 4UL, 2UL );
+   ref2(3,0) = 3;
+
+   MT mat1( ref1 );
+   MT mat2( ref2 );
+
+   swap( mat1, mat2 );
+
+   checkRows    ( mat1, 4UL );
+   checkColumns ( mat1, 2UL );
+   checkNonZeros( mat1, 1UL );
+   checkRows    ( mat2, 2UL );
+   checkColumns ( mat2, 3UL );
+   checkNonZeros( mat2, 2UL );
+
+   if( mat1 != ref2 || mat2 != ref1 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Swapping the first matrix failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat1 << "\n"
+          << "   Expected result:\n" << ref2 << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c find() member function of the SellMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c find() member function of the SellMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFind()
+{
+   typedef MT::ConstIterator  ConstIterator;
+
+   test_ = "SellMatrix::find()";
+
+   CMT ref( 5UL, 8UL );
+   ref(1,2) = 1;
+   ref(1,5) = 2;
+   ref(1,6) = 3;
+   ref(3,0) = 4;
+
+   const MT mat( ref );
+
+   {
+      ConstIterator pos( mat.find( 1UL, 5UL ) );
+
+      if( pos == mat.end( 1UL ) || pos->index() != 5UL || pos->value() != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Element (1,5) could not be found\n"
+             << " Details:\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      ConstIterator pos( mat.find( 1UL, 4UL ) );
+
+      if( pos != mat.end( 1UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Non-existing element could be found\n"
+             << " Details:\n"
+             << "   Required index = 4\n"
+             << "   Found index    = " << pos->index() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      ConstIterator pos( mat.find( 2UL, 0UL ) );
+
+      if( pos != mat.end( 2UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Element in empty row could be found\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c lowerBound() member function of the SellMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c lowerBound() member function of the SellMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testLowerBound()
+{
+   typedef MT::ConstIterator  ConstIterator;
+
+   test_ = "SellMatrix::lowerBound()";
+
+   CMT ref( 3UL, 6UL );
+   ref(1,1) = 1;
+   ref(1,4) = 2;
+
+   const MT mat( ref );
+
+   {
+      ConstIterator pos( mat.lowerBound( 1UL, 1UL ) );
+
+      if( pos == mat.end( 1UL ) || pos->index() != 1UL || pos->value() != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Lower bound for element (1,1) could not be determined\n"
+             << " Details:\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      ConstIterator pos( mat.lowerBound( 1UL, 2UL ) );
+
+      if( pos == mat.end( 1UL ) || pos->index() != 4UL || pos->value() != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Lower bound for element (1,2) could not be determined\n"
+             << " Details:\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      ConstIterator pos( mat.lowerBound( 1UL, 5UL ) );
+
+      if( pos != mat.end( 1UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Lower bound for element (1,5) could not be determined\n"
+             << " Details:\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c upperBound() member function of the SellMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c upperBound() member function of the SellMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testUpperBound()
+{
+   typedef MT::ConstIterator  ConstIterator;
+
+   test_ = "SellMatrix::upperBound()";
+
+   CMT ref( 3UL, 6UL );
+   ref(1,1) = 1;
+   ref(1,4) = 2;
+
+   const MT mat( ref );
+
+   {
+      ConstIterator pos( mat.upperBound( 1UL, 0UL ) );
+
+      if( pos == mat.end( 1UL ) || pos->index() != 1UL || pos->value() != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Upper bound for element (1,0) could not be determined\n"
+             << " Details:\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      ConstIterator pos( mat.upperBound( 1UL, 1UL ) );
+
+      if( pos == mat.end( 1UL ) || pos->index() != 4UL || pos->value() != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Upper bound for element (1,1) could not be determined\n"
+             << " Details:\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      ConstIterator pos( mat.upperBound( 1UL, 4UL ) );
+
+      if( pos != mat.end( 1UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Upper bound for element (1,4) could not be determined\n"
+             << " Details:\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SellMatrix multiplication kernels.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the matrix/vector and matrix/matrix multiplications with
+// a SellMatrix. The results are compared to the results of the according multiplications with
+// a CompressedMatrix. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   //=====================================================================================
+   // Matrix/vector multiplication
+   //=====================================================================================
+
+   {
+      test_ = "SellMatrix matrix/vector multiplication";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 37UL, 29UL );
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         for( size_t j=( i*7UL ) % 5UL; j<A.columns(); j+=1UL+( i % 6UL ) ) {
+            A(i,j) = double( ( i+2UL*j ) % 9UL ) - 4.0;
+         }
+      }
+
+      blaze::DynamicVector<double,blaze::columnVector> x( 29UL );
+      for( size_t j=0UL; j<x.size(); ++j ) {
+         x[j] = double( j % 4UL ) + 0.5;
+      }
+
+      const DMT S( A, 8UL );
+
+      blaze::DynamicVector<double,blaze::columnVector> y1( S * x );
+      blaze::DynamicVector<double,blaze::columnVector> y2( A * x );
+
+      y1 += S * x;
+      y2 += A * x;
+      y1 -= S * ( x + x );
+      y2 -= A * ( x + x );
+      y1 += S * x;
+      y2 += A * x;
+
+      if( y1 != y2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y1 << "\n"
+             << "   Expected result:\n" << y2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Matrix/vector multiplication with 32-bit column indices
+   //=====================================================================================
+
+   {
+      test_ = "SellMatrix matrix/vector multiplication with 32-bit column indices";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 53UL, 41UL );
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         for( size_t j=( i*5UL ) % 7UL; j<A.columns(); j+=1UL+( i % 5UL ) ) {
+            A(i,j) = double( ( 3UL*i+j ) % 7UL ) - 3.0;
+         }
+      }
+
+      blaze::DynamicVector<double,blaze::columnVector> x( 41UL );
+      for( size_t j=0UL; j<x.size(); ++j ) {
+         x[j] = double( j % 5UL ) - 1.5;
+      }
+
+      const IDMT S( A, 16UL );
+      const IFMT T( A, 16UL );
+
+      const blaze::DynamicVector<float,blaze::columnVector> xf( x );
+
+      const blaze::DynamicVector<double,blaze::columnVector> y1( S * x );
+      const blaze::DynamicVector<double,blaze::columnVector> y2( T * xf );
+      const blaze::DynamicVector<double,blaze::columnVector> y3( A * x );
+
+      if( y1 != y3 || y2 != y3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Double precision result:\n" << y1 << "\n"
+             << "   Single precision result:\n" << y2 << "\n"
+             << "   Expected result:\n" << y3 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Parallel matrix/vector multiplication
+   //=====================================================================================
+
+   {
+      test_ = "SellMatrix parallel matrix/vector multiplication";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 203UL, 157UL );
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         for( size_t j=( i*3UL ) % 11UL; j<A.columns(); j+=1UL+( i % 13UL ) ) {
+            A(i,j) = double( ( 5UL*i+j ) % 9UL ) - 4.0;
+         }
+      }
+
+      blaze::DynamicVector<double,blaze::columnVector> x( 157UL );
+      for( size_t j=0UL; j<x.size(); ++j ) {
+         x[j] = double( j % 7UL ) - 2.5;
+      }
+
+      const DMT S( A, 8UL );
+
+      // Forcing the chunk-wise SMP evaluation independent of the matrix size
+      const size_t threshold( blaze::getThreshold( blaze::smpSMatDVecMultThreshold ) );
+      blaze::setThreshold( blaze::smpSMatDVecMultThreshold, 0UL );
+
+      blaze::DynamicVector<double,blaze::columnVector> y1( 203UL, 1.0 ), y2( 203UL, 1.0 );
+      y1 = S * x;
+      y2 = A * x;
+
+      blaze::DynamicVector<double,blaze::columnVector> y3( 203UL, 1.0 ), y4( 203UL, 1.0 );
+      y3 += S * x;
+      y4 += A * x;
+
+      blaze::setThreshold( blaze::smpSMatDVecMultThreshold, threshold );
+
+      if( y1 != y2 || y3 != y4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y1 << "\n" << y3 << "\n"
+             << "   Expected result:\n" << y2 << "\n" << y4 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Matrix/matrix multiplication
+   //=====================================================================================
+
+   {
+      test_ = "SellMatrix matrix/matrix multiplication";
+
+      CMT A( 11UL, 9UL );
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         for( size_t j=i % 3UL; j<A.columns(); j+=2UL+( i % 4UL ) ) {
+            A(i,j) = int( i+j ) - 8;
+         }
+      }
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> B( 9UL, 5UL );
+      for( size_t i=0UL; i<B.rows(); ++i ) {
+         for( size_t j=0UL; j<B.columns(); ++j ) {
+            B(i,j) = int( ( i*j ) % 7UL ) - 3;
+         }
+      }
+
+      const MT S( A );
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> C1( S * B );
+      blaze::DynamicMatrix<int,blaze::rowMajor> C2( A * B );
+
+      C1 += S * B;
+      C2 += A * B;
+      C1 -= S * B;
+      C2 -= A * B;
+
+      if( C1 != C2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << C1 << "\n"
+             << "   Expected result:\n" << C2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c isDefault() function with the SellMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c isDefault() function with the SellMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIsDefault()
+{
+   test_ = "isDefault() function";
+
+   {
+      MT mat;
+
+      if( isDefault( mat ) != true ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isDefault evaluation\n"
+             << " Details:\n"
+             << "   Matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      CMT ref( 2UL, 2UL );
+      ref(1,0) = 1;
+
+      MT mat( ref );
+
+      if( isDefault( mat ) != false ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isDefault evaluation\n"
+             << " Details:\n"
+             << "   Matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace sellmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running SellMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_SELLMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during SellMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,330 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smp/DenseMatrix.cpp
+//  \brief Source file for the SMP dense matrix test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/LowerMatrix.h>
+#include <blaze/math/SMP.h>
+#include <blaze/math/UpperMatrix.h>
+#include <blazetest/mathtest/smp/DenseMatrixTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the DenseMatrixTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+DenseMatrixTest::DenseMatrixTest()
+{
+   forceParallelExecution();
+
+   testGeneral();
+   testTriangular();
+
+   blaze::resetThresholds();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the SMP assignments of general dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the SMP assignments of general dense matrices for all combinations of
+// storage orders. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void DenseMatrixTest::testGeneral()
+{
+   const size_t threads[] = { 1UL, 3UL, 5UL, 7UL };
+   const size_t sizes  [][2] = { {   0UL,   0UL }, {   0UL,   5UL }, {   1UL,   1UL },
+                                 {   7UL,  13UL }, {  33UL,  33UL }, { 101UL,  67UL },
+                                 {  67UL, 101UL }, { 259UL, 131UL } };
+
+   for( size_t t=0UL; t<sizeof(threads)/sizeof(size_t); ++t )
+   {
+      blaze::setNumThreads( threads[t] );
+
+      for( size_t s=0UL; s<sizeof(sizes)/sizeof(sizes[0]); ++s )
+      {
+         testGeneral<blaze::rowMajor   ,blaze::rowMajor   >( sizes[s][0], sizes[s][1], threads[t] );
+         testGeneral<blaze::rowMajor   ,blaze::columnMajor>( sizes[s][0], sizes[s][1], threads[t] );
+         testGeneral<blaze::columnMajor,blaze::rowMajor   >( sizes[s][0], sizes[s][1], threads[t] );
+         testGeneral<blaze::columnMajor,blaze::columnMajor>( sizes[s][0], sizes[s][1], threads[t] );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SMP assignments of general dense matrices of the given size.
+//
+// \param m The number of rows of the matrices.
+// \param n The number of columns of the matrices.
+// \param threads The number of threads.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< bool SO1    // Storage order of the target matrix
+        , bool SO2 >  // Storage order of the operands
+void DenseMatrixTest::testGeneral( size_t m, size_t n, size_t threads )
+{
+   typedef blaze::DynamicMatrix<double,SO1>  TMT;
+   typedef blaze::DynamicMatrix<double,SO2>  OMT;
+
+   OMT A( m, n ), B( m, n );
+   TMT C( m, n );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         A(i,j) = double( ( i*n + j ) % 11UL ) - 5.0;
+         B(i,j) = double( ( i + 2UL*j ) % 7UL ) + 1.0;
+         C(i,j) = double( i ) - double( j );
+      }
+   }
+
+   TMT ref( m, n );
+
+   {
+      test_ = "Parallel assignment of a general dense matrix";
+
+      for( size_t i=0UL; i<m; ++i )
+         for( size_t j=0UL; j<n; ++j )
+            ref(i,j) = A(i,j) + 2.0*B(i,j);
+
+      TMT res( m, n );
+      res = A + 2.0*B;
+      checkResult( res, ref, threads );
+   }
+
+   {
+      test_ = "Parallel addition assignment of a general dense matrix";
+
+      for( size_t i=0UL; i<m; ++i )
+         for( size_t j=0UL; j<n; ++j )
+            ref(i,j) = C(i,j) + ( A(i,j) - B(i,j) );
+
+      TMT res( C );
+      res += A - B;
+      checkResult( res, ref, threads );
+   }
+
+   {
+      test_ = "Parallel subtraction assignment of a general dense matrix";
+
+      for( size_t i=0UL; i<m; ++i )
+         for( size_t j=0UL; j<n; ++j )
+            ref(i,j) = C(i,j) - 3.0*A(i,j);
+
+      TMT res( C );
+      res -= A * 3.0;
+      checkResult( res, ref, threads );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SMP assignments of lower and upper dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the SMP assignments of lower and upper dense matrices, for which the
+// tiles in the zero triangle are reset or skipped instead of evaluated. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void DenseMatrixTest::testTriangular()
+{
+   const size_t threads[] = { 1UL, 3UL, 5UL, 7UL };
+   const size_t sizes  [] = { 0UL, 1UL, 2UL, 15UL, 33UL, 101UL, 259UL };
+
+   for( size_t t=0UL; t<sizeof(threads)/sizeof(size_t); ++t )
+   {
+      blaze::setNumThreads( threads[t] );
+
+      for( size_t s=0UL; s<sizeof(sizes)/sizeof(size_t); ++s )
+      {
+         testTriangular<blaze::rowMajor   ,blaze::rowMajor   >( sizes[s], threads[t] );
+         testTriangular<blaze::rowMajor   ,blaze::columnMajor>( sizes[s], threads[t] );
+         testTriangular<blaze::columnMajor,blaze::rowMajor   >( sizes[s], threads[t] );
+         testTriangular<blaze::columnMajor,blaze::columnMajor>( sizes[s], threads[t] );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SMP assignments of lower and upper dense matrices of the given size.
+//
+// \param n The number of rows and columns of the matrices.
+// \param threads The number of threads.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< bool SO1    // Storage order of the target matrix
+        , bool SO2 >  // Storage order of the operands
+void DenseMatrixTest::testTriangular( size_t n, size_t threads )
+{
+   typedef blaze::DynamicMatrix<double,SO1>  TMT;
+   typedef blaze::LowerMatrix< blaze::DynamicMatrix<double,SO2> >  LMT;
+   typedef blaze::UpperMatrix< blaze::DynamicMatrix<double,SO2> >  UMT;
+
+   LMT L( n );
+   UMT U( n );
+   TMT C( n, n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         if( j <= i ) L(i,j) = double( ( i + j ) % 5UL ) + 1.0;
+         if( j >= i ) U(i,j) = double( ( i*j ) % 3UL ) + 2.0;
+         C(i,j) = 1.0 + double( i ) - double( j );
+      }
+   }
+
+   TMT ref( n, n );
+
+   {
+      test_ = "Parallel assignment of a lower dense matrix";
+
+      for( size_t i=0UL; i<n; ++i )
+         for( size_t j=0UL; j<n; ++j )
+            ref(i,j) = 2.0*L(i,j);
+
+      TMT res( C );
+      res = 2.0 * L;
+      checkResult( res, ref, threads );
+   }
+
+   {
+      test_ = "Parallel assignment of an upper dense matrix";
+
+      for( size_t i=0UL; i<n; ++i )
+         for( size_t j=0UL; j<n; ++j )
+            ref(i,j) = U(i,j);
+
+      TMT res( C );
+      res = U;
+      checkResult( res, ref, threads );
+   }
+
+   {
+      test_ = "Parallel addition assignment of a lower dense matrix";
+
+      for( size_t i=0UL; i<n; ++i )
+         for( size_t j=0UL; j<n; ++j )
+            ref(i,j) = C(i,j) + L(i,j) + L(i,j);
+
+      TMT res( C );
+      res += L + L;
+      checkResult( res, ref, threads );
+   }
+
+   {
+      test_ = "Parallel subtraction assignment of an upper dense matrix";
+
+      for( size_t i=0UL; i<n; ++i )
+         for( size_t j=0UL; j<n; ++j )
+            ref(i,j) = C(i,j) - 0.5*U(i,j);
+
+      TMT res( C );
+      res -= U * 0.5;
+      checkResult( res, ref, threads );
+   }
+}
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running SMP dense matrix test..." << std::endl;
+
+   try
+   {
+      RUN_SMP_DENSEMATRIX_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during SMP dense matrix test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,344 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smp/Reduction.cpp
+//  \brief Source file for the SMP reduction test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/SMP.h>
+#include <blazetest/mathtest/smp/ReductionTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the value of the element with the given linear index.
+//
+// \param index The linear index of the element.
+// \param size The total number of elements.
+// \return The value of the element.
+//
+// All values are small integers. The minimum is stored in the last element, the maximum in the
+// middle, and only few elements differ in magnitude from one, i.e. neither the sum nor the
+// product can overflow.
+*/
+template< typename Type >  // Data type of the element
+Type value( size_t index, size_t size )
+{
+   if( index == size - 1UL ) return Type( -7 );
+   if( index == size / 2UL ) return Type(  9 );
+   if( index % 500UL == 1UL ) return Type( 2 );
+   return ( index % 3UL == 0UL )?( Type( -1 ) ):( Type( 1 ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ReductionTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ReductionTest::ReductionTest()
+{
+   forceParallelExecution();
+
+   testVector();
+   testMatrix();
+
+   blaze::resetThresholds();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the SMP reductions of dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the parallel reductions of dense vectors for vectorizable and scalar
+// element types. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ReductionTest::testVector()
+{
+   const size_t threads[] = { 1UL, 3UL, 5UL, 7UL };
+   const size_t sizes  [] = { 0UL, 1UL, 2UL, 7UL, 33UL, 1001UL, 4099UL };
+
+   for( size_t t=0UL; t<sizeof(threads)/sizeof(size_t); ++t )
+   {
+      blaze::setNumThreads( threads[t] );
+
+      for( size_t s=0UL; s<sizeof(sizes)/sizeof(size_t); ++s ) {
+         testVector<double>( sizes[s], threads[t] );
+         testVector<float >( sizes[s], threads[t] );
+         testVector<int   >( sizes[s], threads[t] );
+         testFloatingPoint<double>( sizes[s], threads[t] );
+         testFloatingPoint<float >( sizes[s], threads[t] );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SMP reductions of a dense vector of the given size.
+//
+// \param n The size of the vector.
+// \param threads The number of threads.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type >  // Data type of the vector elements
+void ReductionTest::testVector( size_t n, size_t threads )
+{
+   test_ = "Parallel reduction of a dense vector";
+
+   blaze::DynamicVector<Type,blaze::columnVector> a( n ), b( n );
+
+   Type refSum( 0 ), refProd( 1 ), refSqrSum( 0 ), refMin( 0 ), refMax( 0 ), refExprSum( 0 );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      a[i] = value<Type>( i, n );
+      b[i] = Type( 1 );
+      refSum     += a[i];
+      refProd    *= a[i];
+      refSqrSum  += a[i]*a[i];
+      refExprSum += Type(2)*a[i] + b[i];
+      if( i == 0UL || a[i] < refMin ) refMin = a[i];
+      if( i == 0UL || a[i] > refMax ) refMax = a[i];
+   }
+
+   checkResult( sum( a ), refSum, "sum()", threads );
+   checkResult( prod( a ), refProd, "prod()", threads );
+   checkResult( min( a ), refMin, "min()", threads );
+   checkResult( max( a ), refMax, "max()", threads );
+   checkResult( sqrLength( a ), refSqrSum, "sqrLength()", threads );
+   checkResult( sum( Type(2)*a + b ), refExprSum, "sum() of an expression", threads );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the floating point specific SMP reductions of a dense vector and matrix.
+//
+// \param n The size of the vector and the number of columns of the matrix.
+// \param threads The number of threads.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the \c length() and \c isnan() functions, which are restricted to
+// floating point element types.
+*/
+template< typename Type >  // Floating point data type of the elements
+void ReductionTest::testFloatingPoint( size_t n, size_t threads )
+{
+   test_ = "Parallel floating point reduction of a dense vector";
+
+   {
+      blaze::DynamicVector<Type,blaze::columnVector> a( n );
+
+      Type refSqrSum( 0 );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         a[i] = value<Type>( i, n );
+         refSqrSum += a[i]*a[i];
+      }
+
+      checkResult( length( a ), std::sqrt( refSqrSum ), "length()", threads );
+      checkResult( isnan( a ), false, "isnan()", threads );
+
+      if( n > 0UL ) {
+         a[n-1UL] = std::numeric_limits<Type>::quiet_NaN();
+         checkResult( isnan( a ), true, "isnan()", threads );
+      }
+   }
+
+   test_ = "Parallel floating point reduction of a dense matrix";
+
+   {
+      blaze::DynamicMatrix<Type,blaze::columnMajor> A( 3UL, n );
+
+      for( size_t i=0UL; i<A.rows(); ++i )
+         for( size_t j=0UL; j<n; ++j )
+            A(i,j) = value<Type>( i*n + j, 3UL*n );
+
+      checkResult( isnan( A ), false, "isnan()", threads );
+
+      if( n > 0UL ) {
+         A(2UL,n/2UL) = std::numeric_limits<Type>::quiet_NaN();
+         checkResult( isnan( A ), true, "isnan()", threads );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SMP reductions of dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the parallel reductions of row-major and column-major dense matrices.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ReductionTest::testMatrix()
+{
+   const size_t threads[] = { 1UL, 3UL, 5UL, 7UL };
+   const size_t sizes  [][2] = { {   0UL,   0UL }, {   0UL,   5UL }, {   1UL,   1UL },
+                                 {   7UL,  13UL }, {  33UL,  33UL }, { 101UL,  67UL },
+                                 {   3UL, 257UL } };
+
+   for( size_t t=0UL; t<sizeof(threads)/sizeof(size_t); ++t )
+   {
+      blaze::setNumThreads( threads[t] );
+
+      for( size_t s=0UL; s<sizeof(sizes)/sizeof(sizes[0]); ++s ) {
+         testMatrix<double,blaze::rowMajor   >( sizes[s][0], sizes[s][1], threads[t] );
+         testMatrix<double,blaze::columnMajor>( sizes[s][0], sizes[s][1], threads[t] );
+         testMatrix<int   ,blaze::rowMajor   >( sizes[s][0], sizes[s][1], threads[t] );
+         testMatrix<int   ,blaze::columnMajor>( sizes[s][0], sizes[s][1], threads[t] );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SMP reductions of a dense matrix of the given size.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param threads The number of threads.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order of the matrix
+void ReductionTest::testMatrix( size_t m, size_t n, size_t threads )
+{
+   test_ = ( SO == blaze::rowMajor )
+           ?( "Parallel reduction of a row-major dense matrix" )
+           :( "Parallel reduction of a column-major dense matrix" );
+
+   blaze::DynamicMatrix<Type,SO> A( m, n );
+
+   Type refSum( 0 ), refProd( 1 ), refMin( 0 ), refMax( 0 ), refExprSum( 0 );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         A(i,j) = value<Type>( i*n + j, m*n );
+         refSum     += A(i,j);
+         refProd    *= A(i,j);
+         refExprSum += A(i,j) * Type(3);
+         if( ( i == 0UL && j == 0UL ) || A(i,j) < refMin ) refMin = A(i,j);
+         if( ( i == 0UL && j == 0UL ) || A(i,j) > refMax ) refMax = A(i,j);
+      }
+   }
+
+   checkResult( sum( A ), refSum, "sum()", threads );
+   checkResult( prod( A ), refProd, "prod()", threads );
+   checkResult( min( A ), refMin, "min()", threads );
+   checkResult( max( A ), refMax, "max()", threads );
+   checkResult( sum( A * Type(3) ), refExprSum, "sum() of an expression", threads );
+}
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running SMP reduction test..." << std::endl;
+
+   try
+   {
+      RUN_SMP_REDUCTION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during SMP reduction test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
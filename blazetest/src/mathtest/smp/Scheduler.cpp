@@ -0,0 +1,334 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smp/Scheduler.cpp
+//  \brief Source file for the SMP scheduler test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/SMP.h>
+#include <blazetest/mathtest/smp/SchedulerTest.h>
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+#  include <blaze/math/smp/threads/ThreadBackend.h>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  UTILITY FUNCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Task incrementing a single element of a vector.
+*/
+struct Increment
+{
+   Increment( std::vector<int>& counters, size_t index )
+      : counters_( &counters )  // The vector of counters
+      , index_   ( index     )  // The index of the incremented counter
+   {}
+
+   void operator()() const { ++(*counters_)[index_]; }
+
+   std::vector<int>* counters_;  //!< The vector of counters.
+   size_t index_;                //!< The index of the incremented counter.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Task performing a (parallel) dense vector addition.
+*/
+struct Addition
+{
+   typedef blaze::DynamicVector<double,blaze::columnVector>  VT;
+
+   Addition( VT& result, const VT& a, const VT& b )
+      : result_( &result )  // The target vector
+      , a_     ( &a      )  // The left-hand side operand
+      , b_     ( &b      )  // The right-hand side operand
+   {}
+
+   void operator()() const { *result_ = *a_ + *b_; }
+
+   VT*       result_;  //!< The target vector.
+   const VT* a_;       //!< The left-hand side operand.
+   const VT* b_;       //!< The right-hand side operand.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SchedulerTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+SchedulerTest::SchedulerTest()
+{
+   forceParallelExecution();
+
+   testSchedule();
+   testNesting();
+   testAssignment();
+
+   blaze::resetThresholds();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the scheduling of individual tasks.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function schedules a large number of independent tasks and checks that each of them
+// is executed exactly once. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void SchedulerTest::testSchedule()
+{
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+   test_ = "Scheduling of individual tasks";
+
+   const size_t threads[] = { 1UL, 3UL, 5UL, 7UL };
+
+   for( size_t t=0UL; t<sizeof(threads)/sizeof(size_t); ++t )
+   {
+      blaze::setNumThreads( threads[t] );
+
+      for( size_t n=0UL; n<=1001UL; n+=143UL )
+      {
+         std::vector<int> counters( n, 0 );
+
+         for( size_t i=0UL; i<n; ++i ) {
+            blaze::TheThreadBackend::schedule( Increment( counters, i ) );
+         }
+         blaze::TheThreadBackend::wait();
+
+         for( size_t i=0UL; i<n; ++i ) {
+            if( counters[i] != 1 ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Task has not been executed exactly once\n"
+                   << " Details:\n"
+                   << "   Number of threads: " << threads[t] << "\n"
+                   << "   Number of tasks  : " << n << "\n"
+                   << "   Task index       : " << i << "\n"
+                   << "   Executions       : " << counters[i] << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of tasks that start parallel operations themselves.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function schedules tasks that perform parallel dense vector additions themselves. Only
+// the work-stealing scheduler allows nested parallel sections, therefore the test is skipped
+// for all other backends. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void SchedulerTest::testNesting()
+{
+#if BLAZE_WORK_STEALING_PARALLEL_MODE
+   test_ = "Nested parallel operations";
+
+   typedef blaze::DynamicVector<double,blaze::columnVector>  VT;
+
+   const size_t threads[] = { 2UL, 3UL, 5UL };
+   const size_t tasks( 11UL );
+
+   for( size_t t=0UL; t<sizeof(threads)/sizeof(size_t); ++t )
+   {
+      blaze::setNumThreads( threads[t] );
+
+      std::vector<VT> a( tasks ), b( tasks ), results( tasks );
+
+      for( size_t k=0UL; k<tasks; ++k ) {
+         a[k].resize( 97UL + 13UL*k );
+         b[k].resize( 97UL + 13UL*k );
+         for( size_t i=0UL; i<a[k].size(); ++i ) {
+            a[k][i] = double( i + k );
+            b[k][i] = double( 2UL*i );
+         }
+      }
+
+      for( size_t k=0UL; k<tasks; ++k ) {
+         blaze::TheThreadBackend::schedule( Addition( results[k], a[k], b[k] ) );
+      }
+      blaze::TheThreadBackend::wait();
+
+      for( size_t k=0UL; k<tasks; ++k )
+      {
+         VT expected( a[k].size() );
+         for( size_t i=0UL; i<a[k].size(); ++i )
+            expected[i] = a[k][i] + b[k][i];
+
+         checkResult( results[k], expected, threads[t] );
+      }
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of parallel dense assignments executed by the scheduler.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs parallel dense vector and matrix assignments for sizes that are not
+// divisible by the number of threads. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void SchedulerTest::testAssignment()
+{
+   test_ = "Parallel dense assignments";
+
+   typedef blaze::DynamicVector<double,blaze::columnVector>  VT;
+   typedef blaze::DynamicMatrix<double,blaze::rowMajor>      MT;
+
+   const size_t threads[] = { 1UL, 3UL, 5UL, 7UL };
+   const size_t sizes  [] = { 0UL, 1UL, 2UL, 17UL, 101UL, 1013UL };
+
+   for( size_t t=0UL; t<sizeof(threads)/sizeof(size_t); ++t )
+   {
+      blaze::setNumThreads( threads[t] );
+
+      for( size_t s=0UL; s<sizeof(sizes)/sizeof(size_t); ++s )
+      {
+         const size_t n( sizes[s] );
+
+         VT a( n ), b( n ), expected( n );
+         for( size_t i=0UL; i<n; ++i ) {
+            a[i] = double( i ) + 1.0;
+            b[i] = double( n - i );
+            expected[i] = 2.0*a[i] - b[i];
+         }
+
+         VT result( n );
+         result = 2.0*a - b;
+         checkResult( result, expected, threads[t] );
+
+         MT A( n, n+3UL ), expectedA( n, n+3UL );
+         for( size_t i=0UL; i<n; ++i ) {
+            for( size_t j=0UL; j<n+3UL; ++j ) {
+               A(i,j) = double( i*j % 7UL );
+               expectedA(i,j) = 3.0*A(i,j);
+            }
+         }
+
+         MT resultA( n, n+3UL );
+         resultA = A * 3.0;
+         checkResult( resultA, expectedA, threads[t] );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running SMP scheduler test..." << std::endl;
+
+   try
+   {
+      RUN_SMP_SCHEDULER_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during SMP scheduler test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,323 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smp/SparseMatrix.cpp
+//  \brief Source file for the SMP sparse matrix test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/SMP.h>
+#include <blazetest/mathtest/smp/SparseMatrixTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initializing the given compressed and dense matrices with the same sparse pattern.
+//
+// \param sparse The compressed matrix to be initialized.
+// \param dense The dense matrix to be initialized.
+// \param seed The offset of the sparse pattern.
+// \return void
+//
+// The pattern leaves every fourth row and every fifth column of the matrices empty. All non-zero
+// elements are positive, i.e. sums and products of the matrices do not cancel out.
+*/
+template< typename MT1    // Type of the compressed matrix
+        , typename MT2 >  // Type of the dense matrix
+void initialize( MT1& sparse, MT2& dense, size_t seed )
+{
+   const size_t m( dense.rows() );
+   const size_t n( dense.columns() );
+
+   sparse.resize( m, n, false );
+   sparse.reset();
+   dense = 0.0;
+
+   for( size_t i=0UL; i<m; ++i ) {
+      if( i % 4UL == 3UL ) continue;
+      for( size_t j=0UL; j<n; ++j ) {
+         if( j % 5UL == 4UL || ( i*7UL + j*3UL + seed ) % 4UL != 0UL ) continue;
+         sparse(i,j) = dense(i,j) = double( ( i + j + seed ) % 9UL ) + 1.0;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Counting the non-zero elements of the given dense matrix.
+//
+// \param dense The dense matrix.
+// \return The number of non-zero elements.
+*/
+template< typename MT >  // Type of the dense matrix
+size_t countNonZeros( const MT& dense )
+{
+   size_t nonZeros( 0UL );
+
+   for( size_t i=0UL; i<dense.rows(); ++i )
+      for( size_t j=0UL; j<dense.columns(); ++j )
+         if( dense(i,j) != 0.0 ) ++nonZeros;
+
+   return nonZeros;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SparseMatrixTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+SparseMatrixTest::SparseMatrixTest()
+{
+   forceParallelExecution();
+
+   testMultiplication();
+   testAddition();
+
+   blaze::resetThresholds();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the SMP assignment of sparse matrix/sparse matrix multiplications.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the parallel assignment of row-major and column-major sparse matrix/
+// sparse matrix multiplications to compressed matrices. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void SparseMatrixTest::testMultiplication()
+{
+   const size_t threads[] = { 1UL, 3UL, 5UL, 7UL };
+   const size_t sizes  [][3] = { {   0UL,   0UL,   0UL }, {   0UL,   3UL,   4UL },
+                                 {   3UL,   0UL,   4UL }, {   1UL,   1UL,   1UL },
+                                 {   2UL,   7UL,   3UL }, {  17UL,  23UL,  19UL },
+                                 { 101UL,  37UL,  67UL }, { 127UL, 131UL, 113UL } };
+
+   for( size_t t=0UL; t<sizeof(threads)/sizeof(size_t); ++t )
+   {
+      blaze::setNumThreads( threads[t] );
+
+      for( size_t s=0UL; s<sizeof(sizes)/sizeof(sizes[0]); ++s ) {
+         testMultiplication<blaze::rowMajor   >( sizes[s][0], sizes[s][1], sizes[s][2], threads[t] );
+         testMultiplication<blaze::columnMajor>( sizes[s][0], sizes[s][1], sizes[s][2], threads[t] );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SMP assignment of a sparse matrix/sparse matrix multiplication.
+//
+// \param m The number of rows of the left-hand side matrix.
+// \param k The number of columns of the left-hand side matrix.
+// \param n The number of columns of the right-hand side matrix.
+// \param threads The number of threads.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< bool SO >  // Storage order of the matrices
+void SparseMatrixTest::testMultiplication( size_t m, size_t k, size_t n, size_t threads )
+{
+   test_ = ( SO == blaze::rowMajor )
+           ?( "Parallel assignment of a row-major sparse matrix multiplication" )
+           :( "Parallel assignment of a column-major sparse matrix multiplication" );
+
+   blaze::CompressedMatrix<double,SO> A, B;
+   blaze::DynamicMatrix<double,SO> dA( m, k ), dB( k, n ), ref( m, n, 0.0 );
+
+   initialize( A, dA, 0UL );
+   initialize( B, dB, 1UL );
+
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         for( size_t l=0UL; l<k; ++l )
+            ref(i,j) += dA(i,l) * dB(l,j);
+
+   blaze::CompressedMatrix<double,SO> C( 2UL, 3UL );
+   C(1,2) = 5.0;
+   C = A * B;
+
+   checkStructure( C, countNonZeros( ref ), threads );
+   checkResult( blaze::DynamicMatrix<double,SO>( C ), ref, threads );
+
+   const blaze::CompressedMatrix<double,SO> D( A * B );
+
+   checkStructure( D, countNonZeros( ref ), threads );
+   checkResult( blaze::DynamicMatrix<double,SO>( D ), ref, threads );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SMP assignment of sparse matrix/sparse matrix additions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the parallel assignment of row-major and column-major sparse matrix/
+// sparse matrix additions to compressed matrices. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void SparseMatrixTest::testAddition()
+{
+   const size_t threads[] = { 1UL, 3UL, 5UL, 7UL };
+   const size_t sizes  [][2] = { {   0UL,   0UL }, {   0UL,   5UL }, {   1UL,   1UL },
+                                 {   7UL,  13UL }, {  33UL,  33UL }, { 101UL,  67UL },
+                                 { 259UL, 131UL } };
+
+   for( size_t t=0UL; t<sizeof(threads)/sizeof(size_t); ++t )
+   {
+      blaze::setNumThreads( threads[t] );
+
+      for( size_t s=0UL; s<sizeof(sizes)/sizeof(sizes[0]); ++s ) {
+         testAddition<blaze::rowMajor   >( sizes[s][0], sizes[s][1], threads[t] );
+         testAddition<blaze::columnMajor>( sizes[s][0], sizes[s][1], threads[t] );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SMP assignment of a sparse matrix/sparse matrix addition.
+//
+// \param m The number of rows of the matrices.
+// \param n The number of columns of the matrices.
+// \param threads The number of threads.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< bool SO >  // Storage order of the matrices
+void SparseMatrixTest::testAddition( size_t m, size_t n, size_t threads )
+{
+   test_ = ( SO == blaze::rowMajor )
+           ?( "Parallel assignment of a row-major sparse matrix addition" )
+           :( "Parallel assignment of a column-major sparse matrix addition" );
+
+   blaze::CompressedMatrix<double,SO> A, B;
+   blaze::DynamicMatrix<double,SO> dA( m, n ), dB( m, n ), ref( m, n );
+
+   initialize( A, dA, 0UL );
+   initialize( B, dB, 2UL );
+
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         ref(i,j) = dA(i,j) + dB(i,j);
+
+   blaze::CompressedMatrix<double,SO> C( 4UL, 1UL );
+   C(3,0) = 1.0;
+   C = A + B;
+
+   checkStructure( C, countNonZeros( ref ), threads );
+   checkResult( blaze::DynamicMatrix<double,SO>( C ), ref, threads );
+
+   const blaze::CompressedMatrix<double,SO> D( A + B );
+
+   checkStructure( D, countNonZeros( ref ), threads );
+   checkResult( blaze::DynamicMatrix<double,SO>( D ), ref, threads );
+}
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running SMP sparse matrix test..." << std::endl;
+
+   try
+   {
+      RUN_SMP_SPARSEMATRIX_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during SMP sparse matrix test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,1218 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/solvers/OperationTest.cpp
+//  \brief Source file for the iterative solvers operation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/dense/FusedKernels.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Solvers.h>
+#include <blaze/system/Thresholds.h>
+#include <blazetest/mathtest/solvers/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Setting up the five-point discretization of a 2D convection-diffusion problem.
+//
+// \param m The number of grid points per dimension.
+// \param c The convection coefficient (0 for the symmetric positive definite Poisson problem).
+// \return The resulting \f$ m^2 \times m^2 \f$ system matrix.
+*/
+blaze::CompressedMatrix<double> convectionDiffusion( size_t m, double c )
+{
+   const size_t n( m*m );
+
+   blaze::CompressedMatrix<double> A( n, n );
+   A.reserve( 5UL*n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( i >= m          ) A.append( i, i-m  , -1.0-c );
+      if( i % m != 0UL    ) A.append( i, i-1UL, -1.0-c );
+      A.append( i, i, 4.0 );
+      if( i % m != m-1UL  ) A.append( i, i+1UL, -1.0+c );
+      if( i+m < n         ) A.append( i, i+m  , -1.0+c );
+      A.finalize( i );
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting up a reproducible reference solution.
+//
+// \param n The size of the reference solution.
+// \return The reference solution with values in the range [-0.5..0.5).
+*/
+blaze::DynamicVector<double> reference( size_t n )
+{
+   blaze::DynamicVector<double> x( n );
+
+   for( size_t i=0UL; i<n; ++i )
+      x[i] = double( ( 7UL*i ) % 11UL ) / 11.0 - 0.5;
+
+   return x;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting up an LCP with a known solution.
+//
+// \param m The number of grid points per dimension of the symmetric Poisson problem.
+// \param xref The resulting reference solution.
+// \return The resulting LCP with zero initial guess.
+//
+// The right-hand side is chosen such that all negative entries of the reference solution are
+// replaced by active constraints, i.e. the LCP has both active and inactive constraints.
+*/
+blaze::LCP referenceLCP( size_t m, blaze::DynamicVector<double>& xref )
+{
+   const blaze::CompressedMatrix<double> A( convectionDiffusion( m, 0.0 ) );
+   const size_t n( A.rows() );
+
+   blaze::DynamicVector<double> w( n, 0.0 );
+   xref = reference( n );
+   for( size_t i=0UL; i<n; ++i ) {
+      if( xref[i] < 0.0 ) {
+         w[i] = -xref[i];
+         xref[i] = 0.0;
+      }
+   }
+
+   blaze::LCP lcp;
+   lcp.A_ = A;
+   lcp.b_ = w - A * xref;
+   lcp.x_ = blaze::DynamicVector<double>( n, 0.0 );
+
+   return lcp;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the OperationTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+{
+   testPCG();
+   testPipelinedCG();
+   testBiCGSTAB();
+   testGMRES();
+   testPreconditioners();
+   testPGS();
+   testStagnation();
+   testWarmStart();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the PCG solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the PCG solver for a symmetric positive definite Poisson
+// problem with all preconditioners for symmetric positive definite matrices. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testPCG()
+{
+   const blaze::CompressedMatrix<double> A( convectionDiffusion( 12UL, 0.0 ) );
+   const blaze::DynamicVector<double> xref( reference( A.rows() ) );
+   const blaze::DynamicVector<double> b( A * xref );
+
+   blaze::PCG pcg;
+   pcg.setThreshold( 1E-12 );
+
+   {
+      test_ = "PCG solver without preconditioner";
+
+      blaze::DynamicVector<double> x;
+      checkConvergence( pcg.solve( A, b, x ), pcg, "PCG solver" );
+      checkSolution( x, xref, "PCG solver", 1E-9 );
+
+      if( pcg.getLastIterations() > A.rows() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Too many iterations\n"
+             << " Details:\n"
+             << "   Iterations: " << pcg.getLastIterations() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "PCG solver for a dense system matrix";
+
+      const blaze::DynamicMatrix<double,blaze::columnMajor> D( A );
+
+      blaze::DynamicVector<double> x;
+      checkConvergence( pcg.solve( D, b, x ), pcg, "PCG solver" );
+      checkSolution( x, xref, "PCG solver", 1E-9 );
+   }
+
+   {
+      test_ = "PCG solver with Jacobi preconditioner";
+
+      blaze::DynamicVector<double> x;
+      checkConvergence( pcg.solve( A, b, x, blaze::JacobiPreconditioner<double>( A ) ),
+                        pcg, "PCG solver" );
+      checkSolution( x, xref, "PCG solver", 1E-9 );
+   }
+
+   {
+      test_ = "PCG solver with SSOR preconditioner";
+
+      blaze::DynamicVector<double> x;
+      checkConvergence( pcg.solve( A, b, x, blaze::SSORPreconditioner<double>( A, 1.5 ) ),
+                        pcg, "PCG solver" );
+      checkSolution( x, xref, "PCG solver", 1E-9 );
+   }
+
+   {
+      test_ = "PCG solver with incomplete Cholesky preconditioner";
+
+      blaze::PCG cg;
+      cg.setThreshold( 1E-12 );
+
+      blaze::DynamicVector<double> x, y;
+      checkConvergence( cg.solve( A, b, x ), cg, "PCG solver" );
+      checkConvergence( pcg.solve( A, b, y, blaze::IncompleteCholesky<double>( A ) ),
+                        pcg, "PCG solver" );
+      checkSolution( y, xref, "PCG solver", 1E-9 );
+
+      if( pcg.getLastIterations() >= cg.getLastIterations() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Preconditioning did not reduce the number of iterations\n"
+             << " Details:\n"
+             << "   Iterations with IC(0)  : " << pcg.getLastIterations() << "\n"
+             << "   Iterations without IC(0): " << cg.getLastIterations() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "PCG solver with exact initial guess";
+
+      blaze::DynamicVector<double> x( xref );
+      checkConvergence( pcg.solve( A, b, x ), pcg, "PCG solver" );
+
+      if( pcg.getLastIterations() != 0UL || x != xref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: The exact initial guess has been modified\n"
+             << " Details:\n"
+             << "   Iterations: " << pcg.getLastIterations() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "PCG solver with zero right-hand side";
+
+      const blaze::DynamicVector<double> zero( A.rows(), 0.0 );
+
+      blaze::DynamicVector<double> x;
+      checkConvergence( pcg.solve( A, zero, x ), pcg, "PCG solver" );
+      checkSolution( x, zero, "PCG solver", 0.0 );
+   }
+
+   {
+      test_ = "PCG solver with invalid arguments";
+
+      blaze::DynamicVector<double> x;
+
+      try {
+         pcg.solve( blaze::CompressedMatrix<double>( 3UL, 4UL ), b, x );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving a system with a non-square matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         pcg.solve( A, blaze::DynamicVector<double>( 3UL, 1.0 ), x );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving a system with a right-hand side of invalid size succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the PipelinedCG solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the PipelinedCG solver for a symmetric positive definite
+// Poisson problem with a sparse and a dense system matrix. Additionally, an empty system is
+// solved and the fused kernels of the solver are executed for empty vectors with the SMP
+// threshold of the fused kernels set to zero, which forces them into their parallel path. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void OperationTest::testPipelinedCG()
+{
+   const blaze::CompressedMatrix<double> A( convectionDiffusion( 12UL, 0.0 ) );
+   const blaze::DynamicVector<double> xref( reference( A.rows() ) );
+   const blaze::DynamicVector<double> b( A * xref );
+
+   blaze::PipelinedCG cg;
+   cg.setThreshold( 1E-12 );
+
+   {
+      test_ = "PipelinedCG solver for a sparse system matrix";
+
+      blaze::DynamicVector<double> x;
+      checkConvergence( cg.solve( A, b, x ), cg, "PipelinedCG solver" );
+      checkSolution( x, xref, "PipelinedCG solver", 1E-9 );
+   }
+
+   {
+      test_ = "PipelinedCG solver for a dense system matrix";
+
+      const blaze::DynamicMatrix<double,blaze::rowMajor> D( A );
+
+      blaze::DynamicVector<double> x;
+      checkConvergence( cg.solve( D, b, x ), cg, "PipelinedCG solver" );
+      checkSolution( x, xref, "PipelinedCG solver", 1E-9 );
+   }
+
+   {
+      test_ = "PipelinedCG solver for an empty system";
+
+      const size_t threshold( blaze::getThreshold( blaze::smpDVecReductionThreshold ) );
+      blaze::setThreshold( blaze::smpDVecReductionThreshold, 0UL );
+
+      const blaze::CompressedMatrix<double> E( 0UL, 0UL );
+      const blaze::DynamicVector<double> e;
+
+      blaze::DynamicVector<double> x, r, p, s, w;
+      const bool converged( cg.solve( E, e, x ) );
+
+      // Direct execution of the fused kernels of the PipelinedCG solver for empty vectors
+      const double rw( blaze::fusedMultDot( w, E, r ) );
+      const double rr( blaze::fusedCGUpdate( x, r, p, s, w, 1.0, 1.0 ) );
+
+      blaze::setThreshold( blaze::smpDVecReductionThreshold, threshold );
+
+      checkConvergence( converged, cg, "PipelinedCG solver" );
+      checkSolution( x, e, "PipelinedCG solver", 0.0 );
+
+      if( rw != 0.0 || rr != 0.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Fused kernels failed for empty vectors\n"
+             << " Details:\n"
+             << "   Result of fusedMultDot() : " << rw << "\n"
+             << "   Result of fusedCGUpdate(): " << rr << "\n"
+             << "   Expected results: 0\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BiCGSTAB solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the BiCGSTAB solver for a non-symmetric convection-diffusion
+// problem. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testBiCGSTAB()
+{
+   const blaze::CompressedMatrix<double> A( convectionDiffusion( 12UL, 0.4 ) );
+   const blaze::DynamicVector<double> xref( reference( A.rows() ) );
+   const blaze::DynamicVector<double> b( A * xref );
+
+   blaze::BiCGSTAB bicgstab;
+   bicgstab.setThreshold( 1E-12 );
+
+   {
+      test_ = "BiCGSTAB solver without preconditioner";
+
+      blaze::DynamicVector<double> x;
+      checkConvergence( bicgstab.solve( A, b, x ), bicgstab, "BiCGSTAB solver" );
+      checkSolution( x, xref, "BiCGSTAB solver", 1E-9 );
+   }
+
+   {
+      test_ = "BiCGSTAB solver for a dense system matrix";
+
+      const blaze::DynamicMatrix<double,blaze::rowMajor> D( A );
+
+      blaze::DynamicVector<double> x;
+      checkConvergence( bicgstab.solve( D, b, x ), bicgstab, "BiCGSTAB solver" );
+      checkSolution( x, xref, "BiCGSTAB solver", 1E-9 );
+   }
+
+   {
+      test_ = "BiCGSTAB solver with Jacobi preconditioner";
+
+      blaze::DynamicVector<double> x;
+      checkConvergence( bicgstab.solve( A, b, x, blaze::JacobiPreconditioner<double>( A ) ),
+                        bicgstab, "BiCGSTAB solver" );
+      checkSolution( x, xref, "BiCGSTAB solver", 1E-9 );
+   }
+
+   {
+      test_ = "BiCGSTAB solver with incomplete LU preconditioner";
+
+      blaze::DynamicVector<double> x;
+      checkConvergence( bicgstab.solve( A, b, x, blaze::IncompleteLU<double>( A ) ),
+                        bicgstab, "BiCGSTAB solver" );
+      checkSolution( x, xref, "BiCGSTAB solver", 1E-9 );
+   }
+
+   {
+      test_ = "BiCGSTAB solver with invalid arguments";
+
+      blaze::DynamicVector<double> x;
+
+      try {
+         bicgstab.solve( blaze::CompressedMatrix<double>( 3UL, 4UL ), b, x );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving a system with a non-square matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the GMRES(m) solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the GMRES(m) solver for a non-symmetric convection-diffusion
+// problem. Besides the accuracy of the solution, the behavior at the restart boundary is tested:
+// For a system of size \a n the unrestarted method has to converge within \a n iterations and
+// in case the iteration limit is reached at or within a restart cycle, the solution has to be
+// updated with the corrections of the last (partial) cycle. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testGMRES()
+{
+   const blaze::CompressedMatrix<double> A( convectionDiffusion( 12UL, 0.4 ) );
+   const blaze::DynamicVector<double> xref( reference( A.rows() ) );
+   const blaze::DynamicVector<double> b( A * xref );
+
+   {
+      test_ = "GMRES(m) solver with and without preconditioner";
+
+      const size_t restarts[] = { 1UL, 10UL, 30UL };
+
+      for( size_t i=0UL; i<sizeof(restarts)/sizeof(size_t); ++i )
+      {
+         blaze::GMRES gmres( restarts[i] );
+         gmres.setThreshold( 1E-12 );
+         gmres.setMaxIterations( 10000UL );
+
+         blaze::DynamicVector<double> x, y, z;
+         checkConvergence( gmres.solve( A, b, x ), gmres, "GMRES solver" );
+         checkSolution( x, xref, "GMRES solver", 1E-9 );
+         checkConvergence( gmres.solve( A, b, y, blaze::JacobiPreconditioner<double>( A ) ),
+                           gmres, "GMRES solver" );
+         checkSolution( y, xref, "GMRES solver", 1E-9 );
+         checkConvergence( gmres.solve( A, b, z, blaze::IncompleteLU<double>( A ) ),
+                           gmres, "GMRES solver" );
+         checkSolution( z, xref, "GMRES solver", 1E-9 );
+      }
+   }
+
+   {
+      test_ = "GMRES(m) solver at the restart boundary";
+
+      const blaze::CompressedMatrix<double> B( convectionDiffusion( 3UL, 0.4 ) );
+      const size_t n( B.rows() );
+      const blaze::DynamicVector<double> yref( reference( n ) );
+      const blaze::DynamicVector<double> c( B * yref );
+
+      // Restart parameters right below, at and above the size of the system
+      for( size_t m=n-1UL; m<=n+1UL; ++m )
+      {
+         blaze::GMRES gmres( m );
+         gmres.setThreshold( 1E-12 );
+
+         blaze::DynamicVector<double> y;
+         checkConvergence( gmres.solve( B, c, y ), gmres, "GMRES solver" );
+         checkSolution( y, yref, "GMRES solver", 1E-9 );
+
+         if( m >= n && gmres.getLastIterations() > n ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: The unrestarted GMRES solver did not converge within n iterations\n"
+                << " Details:\n"
+                << "   System size: " << n << "\n"
+                << "   Restart    : " << m << "\n"
+                << "   Iterations : " << gmres.getLastIterations() << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "GMRES(m) solver with iteration limit at and within a restart cycle";
+
+      // Iteration limits at the end of the first cycle, within the second cycle and at the
+      // end of the second cycle
+      const size_t limits[] = { 5UL, 7UL, 10UL };
+
+      for( size_t i=0UL; i<sizeof(limits)/sizeof(size_t); ++i )
+      {
+         blaze::GMRES gmres( 5UL );
+         gmres.setThreshold( 1E-12 );
+         gmres.setMaxIterations( limits[i] );
+
+         blaze::DynamicVector<double> x;
+         const bool converged( gmres.solve( A, b, x ) );
+
+         const blaze::DynamicVector<double> r( b - A * x );
+         const double precision( std::sqrt( blaze::sum( r * r ) / blaze::sum( b * b ) ) );
+
+         if( converged || gmres.getLastIterations() != limits[i] ||
+             !( std::fabs( precision - gmres.getLastPrecision() ) <= 1E-12 ) ||
+             !( precision < 1.0 ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid state after reaching the iteration limit\n"
+                << " Details:\n"
+                << "   Iteration limit   : " << limits[i] << "\n"
+                << "   Return value      : " << converged << "\n"
+                << "   Iterations        : " << gmres.getLastIterations() << "\n"
+                << "   Reported precision: " << gmres.getLastPrecision() << "\n"
+                << "   Actual precision  : " << precision << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "GMRES(m) solver with invalid restart parameter";
+
+      try {
+         blaze::GMRES gmres( 0UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Creating a GMRES(0) solver succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         blaze::GMRES gmres;
+         gmres.setRestart( 0UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setting a restart parameter of 0 succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the preconditioners.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the JacobiPreconditioner, SSORPreconditioner, IncompleteLU
+// and IncompleteCholesky class templates. The results of the Jacobi and SSOR preconditioners
+// are compared to the results of the explicitly assembled preconditioner matrices. Since the
+// incomplete factorizations of a tridiagonal matrix are exact, the IC(0) and ILU(0) results
+// are compared to the solutions of the according tridiagonal systems. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testPreconditioners()
+{
+   const size_t n( 20UL );
+
+   // Setting up a symmetric positive definite and a non-symmetric tridiagonal matrix
+   blaze::CompressedMatrix<double> S( n, n ), U( n, n );
+   S.reserve( 3UL*n );
+   U.reserve( 3UL*n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( i > 0UL ) {
+         S.append( i, i-1UL, -1.0 );
+         U.append( i, i-1UL, -1.5 );
+      }
+      S.append( i, i, 2.5 + 0.1*double( i % 3UL ) );
+      U.append( i, i, 3.0 + 0.1*double( i % 3UL ) );
+      if( i+1UL < n ) {
+         S.append( i, i+1UL, -1.0 );
+         U.append( i, i+1UL, -0.5 );
+      }
+      S.finalize( i );
+      U.finalize( i );
+   }
+
+   const blaze::DynamicVector<double> r( reference( n ) );
+   blaze::DynamicVector<double> z( n );
+
+   {
+      test_ = "Jacobi preconditioner";
+
+      blaze::JacobiPreconditioner<double> jacobi( U );
+      jacobi.apply( r, z );
+
+      blaze::DynamicVector<double> expected( n );
+      for( size_t i=0UL; i<n; ++i )
+         expected[i] = r[i] / U(i,i);
+
+      checkSolution( z, expected, "Jacobi preconditioner", 1E-15 );
+   }
+
+   {
+      test_ = "SSOR preconditioner";
+
+      const double omega( 1.3 );
+
+      blaze::SSORPreconditioner<double> ssor( U, omega );
+      ssor.apply( r, z );
+
+      // Explicit assembly of M = omega/(2-omega) * (D/omega+L) * (D/omega)^-1 * (D/omega+U)
+      blaze::DynamicMatrix<double> L( n, n, 0.0 ), R( n, n, 0.0 ), Dinv( n, n, 0.0 );
+      for( size_t i=0UL; i<n; ++i ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            if( j < i ) L(i,j) = U(i,j);
+            if( j > i ) R(i,j) = U(i,j);
+         }
+         L(i,i) = R(i,i) = U(i,i) / omega;
+         Dinv(i,i) = omega / U(i,i);
+      }
+      const blaze::DynamicMatrix<double> M( ( omega / ( 2.0 - omega ) ) * ( L * Dinv * R ) );
+
+      checkSolution( M * z, r, "SSOR preconditioner", 1E-12 );
+   }
+
+   {
+      test_ = "Incomplete Cholesky preconditioner";
+
+      blaze::IncompleteCholesky<double> ic( S );
+      ic.apply( r, z );
+
+      checkSolution( S * z, r, "IC(0) preconditioner", 1E-12 );
+   }
+
+   {
+      test_ = "Incomplete LU preconditioner";
+
+      blaze::IncompleteLU<double> ilu( U );
+      ilu.apply( r, z );
+
+      checkSolution( U * z, r, "ILU(0) preconditioner", 1E-12 );
+   }
+
+   {
+      test_ = "Preconditioners for invalid matrices";
+
+      const blaze::CompressedMatrix<double> A( 3UL, 4UL );
+
+      blaze::CompressedMatrix<double> B( U );
+      B(5,5) = 0.0;
+      B.erase( 5UL, 5UL );
+
+      blaze::DynamicMatrix<double> C( 3UL, 3UL, -1.0 );
+      C(0,0) = C(1,1) = C(2,2) = 1.0;
+
+      try {
+         blaze::JacobiPreconditioner<double> jacobi( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Creating a Jacobi preconditioner for a non-square matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         blaze::JacobiPreconditioner<double> jacobi( B );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Creating a Jacobi preconditioner with a zero diagonal succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         blaze::SSORPreconditioner<double> ssor( U, 2.0 );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Creating a SSOR preconditioner with omega=2 succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         blaze::SSORPreconditioner<double> ssor( B );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Creating a SSOR preconditioner with a zero diagonal succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         blaze::IncompleteCholesky<double> ic( B );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Creating an IC(0) preconditioner with a missing diagonal succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         blaze::IncompleteCholesky<double> ic( C );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Creating an IC(0) preconditioner for an indefinite matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         blaze::IncompleteLU<double> ilu( B );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Creating an ILU(0) preconditioner with a missing diagonal succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the PGS solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the PGS solver in all execution modes. The solutions of an
+// LCP with active and inactive constraints are compared to the known reference solution, both
+// with and without forced SMP execution. Additionally, the coloring of the blocks is checked
+// for LCPs and contact LCPs and the solution of empty problems is tested. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testPGS()
+{
+   const blaze::PGS::Mode modes[] = { blaze::PGS::sequential, blaze::PGS::colored, blaze::PGS::blockJacobi };
+   const char* names[] = { "sequential PGS", "colored PGS", "block-Jacobi PGS" };
+
+   const size_t threshold( blaze::getThreshold( blaze::smpPGSThreshold ) );
+
+
+   //=====================================================================================
+   // Solution of an LCP
+   //=====================================================================================
+
+   {
+      test_ = "PGS solution of an LCP";
+
+      blaze::DynamicVector<double> xref;
+
+      for( size_t k=0UL; k<3UL; ++k ) {
+         for( size_t smp=0UL; smp<2UL; ++smp )
+         {
+            blaze::LCP lcp( referenceLCP( 12UL, xref ) );
+
+            blaze::PGS pgs( modes[k] );
+            pgs.setPartitions( 8UL );
+            pgs.setThreshold( 1E-12 );
+            pgs.setMaxIterations( 10000UL );
+
+            blaze::setThreshold( blaze::smpPGSThreshold, ( smp )?( 0UL ):( threshold ) );
+            const bool converged( pgs.solve( lcp ) );
+            blaze::setThreshold( blaze::smpPGSThreshold, threshold );
+
+            checkConvergence( converged, pgs, names[k] );
+            checkSolution( lcp.x_, xref, names[k], 1E-8 );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Coloring of the blocks
+   //=====================================================================================
+
+   {
+      test_ = "PGS coloring of an LCP with unsymmetric sparsity pattern";
+
+      const size_t n( 97UL );
+
+      blaze::LCP lcp;
+      lcp.A_.resize( n, n );
+      lcp.A_.reserve( 3UL*n );
+      for( size_t i=0UL; i<n; ++i ) {
+         const size_t j1( ( 3UL*i+1UL ) % n ), j2( ( 5UL*i+2UL ) % n );
+         lcp.A_(i,i) = 10.0;
+         if( j1 != i ) lcp.A_(i,j1) = -1.0;
+         if( j2 != i ) lcp.A_(i,j2) = -1.0;
+      }
+      lcp.b_ = reference( n );
+      lcp.x_ = blaze::DynamicVector<double>( n, 0.0 );
+
+      blaze::PGS pgs( blaze::PGS::colored );
+      pgs.setMaxIterations( 1UL );
+      pgs.solve( lcp );
+
+      checkColoring( pgs, lcp.A_, 1UL );
+   }
+
+   {
+      test_ = "PGS coloring of a contact LCP";
+
+      const size_t contacts( 48UL );
+
+      blaze::ContactLCP lcp;
+      lcp.A_ = convectionDiffusion( 12UL, 0.0 );
+      lcp.b_ = reference( 3UL*contacts );
+      lcp.x_ = blaze::DynamicVector<double>( 3UL*contacts, 0.0 );
+      lcp.cof_ = blaze::DynamicVector<double>( contacts, 0.5 );
+
+      blaze::PGS pgs( blaze::PGS::colored );
+      pgs.setMaxIterations( 1UL );
+      pgs.solve( lcp );
+
+      checkColoring( pgs, lcp.A_, 3UL );
+   }
+
+
+   //=====================================================================================
+   // Solution of empty problems
+   //=====================================================================================
+
+   {
+      test_ = "PGS solution of an empty LCP";
+
+      blaze::setThreshold( blaze::smpPGSThreshold, 0UL );
+
+      for( size_t k=0UL; k<3UL; ++k )
+      {
+         blaze::LCP lcp;
+         blaze::ContactLCP contact;
+
+         blaze::PGS pgs( modes[k] );
+         const bool converged( pgs.solve( lcp ) );
+
+         // Forcing sweeps over the empty problems
+         pgs.setThreshold( 0.0 );
+         pgs.setMaxIterations( 3UL );
+         pgs.solve( lcp );
+         const size_t iterations( pgs.getLastIterations() );
+         pgs.solve( contact );
+
+         if( !converged || iterations != 3UL || pgs.getLastIterations() != 3UL ||
+             pgs.getLastPrecision() != 0.0 || pgs.getColors() != 0UL ||
+             lcp.x_.size() != 0UL || contact.x_.size() != 0UL ) {
+            blaze::setThreshold( blaze::smpPGSThreshold, threshold );
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Solving an empty problem with the " << names[k] << " failed\n"
+                << " Details:\n"
+                << "   Return value  : " << converged << "\n"
+                << "   Iterations    : " << iterations << ", " << pgs.getLastIterations() << "\n"
+                << "   Last precision: " << pgs.getLastPrecision() << "\n"
+                << "   Colors        : " << pgs.getColors() << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      blaze::setThreshold( blaze::smpPGSThreshold, threshold );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the relative stopping criterion of the PGS and CPG solvers.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that a solution process terminated by the relative threshold (see
+// Solver::setRelativeThreshold()) before reaching the precision threshold returns \a false
+// and reports the stagnation, while a solution process reaching the precision threshold
+// returns \a true. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testStagnation()
+{
+   blaze::DynamicVector<double> xref;
+
+   {
+      test_ = "PGS stagnation";
+
+      blaze::PGS pgs;
+      pgs.setThreshold( 1E-12 );
+      pgs.setMaxIterations( 10000UL );
+
+      pgs.setRelativeThreshold( 0.9 );
+      blaze::LCP lcp1( referenceLCP( 12UL, xref ) );
+      const bool stagnated( pgs.solve( lcp1 ) );
+      checkStagnation( stagnated, pgs, "PGS" );
+
+      pgs.setRelativeThreshold( 0.0 );
+      blaze::LCP lcp2( referenceLCP( 12UL, xref ) );
+      const bool converged( pgs.solve( lcp2 ) );
+      checkConvergence( converged && !pgs.isStagnated(), pgs, "PGS" );
+      checkSolution( lcp2.x_, xref, "PGS", 1E-8 );
+   }
+
+   {
+      test_ = "CPG stagnation";
+
+      blaze::CPG cpg;
+      cpg.setThreshold( 1E-10 );
+      cpg.setMaxIterations( 10000UL );
+
+      cpg.setRelativeThreshold( 0.999 );
+      blaze::LCP lcp1( referenceLCP( 12UL, xref ) );
+      const bool stagnated( cpg.solve( lcp1 ) );
+      checkStagnation( stagnated, cpg, "CPG" );
+
+      cpg.setRelativeThreshold( 0.0 );
+      blaze::LCP lcp2( referenceLCP( 12UL, xref ) );
+      const bool converged( cpg.solve( lcp2 ) );
+      checkConvergence( converged && !cpg.isStagnated(), cpg, "CPG" );
+      checkSolution( lcp2.x_, xref, "CPG", 1E-8 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the WarmStart class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the store() and apply() functions of the WarmStart class
+// for contact LCPs whose contacts appear and disappear between two time steps and for LCPs.
+// Additionally, the reduced number of PGS iterations of a warm-started solution process and
+// the error paths for invalid identifiers are tested. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testWarmStart()
+{
+   //=====================================================================================
+   // Appearing and disappearing contacts
+   //=====================================================================================
+
+   {
+      test_ = "WarmStart with appearing and disappearing contacts";
+
+      blaze::ContactLCP lcp1;
+      lcp1.A_.resize( 12UL, 12UL );
+      lcp1.x_.resize( 12UL );
+      for( size_t i=0UL; i<12UL; ++i )
+         lcp1.x_[i] = double( i+1UL );
+
+      std::vector<size_t> ids1( 4UL );
+      ids1[0] = 10UL; ids1[1] = 20UL; ids1[2] = 30UL; ids1[3] = 40UL;
+
+      blaze::WarmStart warmstart;
+      warmstart.store( lcp1, ids1 );
+
+      // Contact 30 disappears, the contacts 50 and 60 appear
+      blaze::ContactLCP lcp2;
+      lcp2.A_.resize( 15UL, 15UL );
+
+      std::vector<size_t> ids2( 5UL );
+      ids2[0] = 40UL; ids2[1] = 50UL; ids2[2] = 20UL; ids2[3] = 60UL; ids2[4] = 10UL;
+
+      const size_t matches( warmstart.apply( lcp2, ids2 ) );
+
+      const double expected[] = { 10.0, 11.0, 12.0, 0.0, 0.0, 0.0, 4.0, 5.0, 6.0,
+                                   0.0,  0.0,  0.0, 1.0, 2.0, 3.0 };
+
+      bool equal( lcp2.x_.size() == 15UL );
+      for( size_t i=0UL; equal && i<15UL; ++i )
+         equal = ( lcp2.x_[i] == expected[i] );
+
+      if( warmstart.size() != 4UL || matches != 3UL || !equal ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Warm-starting the contact LCP failed\n"
+             << " Details:\n"
+             << "   Stored blocks : " << warmstart.size() << "\n"
+             << "   Matches       : " << matches << "\n"
+             << "   Result:\n" << lcp2.x_ << "\n"
+             << "   Expected result:\n( 10 11 12 0 0 0 4 5 6 0 0 0 1 2 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // All contacts disappear
+      blaze::ContactLCP lcp3;
+      const size_t none( warmstart.apply( lcp3, std::vector<size_t>() ) );
+
+      if( none != 0UL || lcp3.x_.size() != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Warm-starting an empty contact LCP failed\n"
+             << " Details:\n"
+             << "   Matches : " << none << "\n"
+             << "   Unknowns: " << lcp3.x_.size() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Warm-started PGS solution
+   //=====================================================================================
+
+   {
+      test_ = "WarmStart of a PGS solution process";
+
+      blaze::DynamicVector<double> xref;
+
+      blaze::PGS pgs;
+      pgs.setThreshold( 1E-12 );
+      pgs.setMaxIterations( 10000UL );
+
+      std::vector<size_t> ids( 144UL );
+      for( size_t i=0UL; i<ids.size(); ++i )
+         ids[i] = 1000UL - 3UL*i;
+
+      blaze::LCP lcp1( referenceLCP( 12UL, xref ) );
+      checkConvergence( pgs.solve( lcp1 ), pgs, "PGS" );
+      const size_t cold( pgs.getLastIterations() );
+
+      blaze::WarmStart warmstart;
+      warmstart.store( lcp1, ids );
+
+      blaze::LCP lcp2( referenceLCP( 12UL, xref ) );
+      const size_t matches( warmstart.apply( lcp2, ids ) );
+      checkConvergence( pgs.solve( lcp2 ), pgs, "PGS" );
+      checkSolution( lcp2.x_, xref, "warm-started PGS", 1E-8 );
+
+      if( matches != 144UL || pgs.getLastIterations() > 1UL || pgs.getLastIterations() >= cold ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Warm-starting the PGS solver failed\n"
+             << " Details:\n"
+             << "   Matches                  : " << matches << "\n"
+             << "   Cold-started iterations  : " << cold << "\n"
+             << "   Warm-started iterations  : " << pgs.getLastIterations() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Invalid identifiers
+   //=====================================================================================
+
+   {
+      test_ = "WarmStart with invalid identifiers";
+
+      blaze::ContactLCP contact;
+      contact.A_.resize( 6UL, 6UL );
+      contact.x_ = blaze::DynamicVector<double>( 6UL, 1.0 );
+
+      blaze::LCP lcp;
+      lcp.A_.resize( 2UL, 2UL );
+      lcp.x_ = blaze::DynamicVector<double>( 2UL, 1.0 );
+
+      std::vector<size_t> ids( 2UL );
+      ids[0] = 7UL; ids[1] = 7UL;
+
+      blaze::WarmStart warmstart;
+
+      try {
+         warmstart.store( contact, ids );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Storing duplicate identifiers succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      ids[1] = 8UL;
+      warmstart.store( contact, ids );
+
+      try {
+         warmstart.apply( lcp, ids );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Applying a contact LCP solution to an LCP succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      ids.push_back( 9UL );
+
+      try {
+         warmstart.store( contact, ids );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Storing a contact LCP with too many identifiers succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         warmstart.apply( contact, ids );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Applying to a contact LCP with too many identifiers succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         std::vector<size_t> six( 6UL );
+         for( size_t i=0UL; i<6UL; ++i )
+            six[i] = i;
+         warmstart.store( contact, six );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Storing a contact LCP with one identifier per unknown succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running iterative solvers operation test..." << std::endl;
+
+   try
+   {
+      RUN_SOLVERS_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during iterative solvers operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,581 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/tripletbuilder/ClassTest.cpp
+//  \brief Source file for the TripletBuilder class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/tripletbuilder/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace tripletbuilder {
+
+//=================================================================================================
+//
+//  AUXILIARY DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Custom merge operation selecting the maximum of duplicate triplets.
+*/
+struct MaxDuplicates
+{
+   template< typename T >
+   inline T operator()( const T& target, const T& value ) const {
+      return ( target < value )?( value ):( target );
+   }
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the TripletBuilder class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAdd();
+   testBuild();
+   testMerge();
+   testClear();
+   testIndexType();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the TripletBuilder constructor.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the constructor of the TripletBuilder class template. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   {
+      test_ = "TripletBuilder constructor (3x4)";
+
+      TB builder( 3UL, 4UL );
+
+      checkRows   ( builder, 3UL );
+      checkColumns( builder, 4UL );
+      checkSize   ( builder, 0UL );
+
+      if( builder.buffers() != 1UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of buffers detected\n"
+             << " Details:\n"
+             << "   Number of buffers         : " << builder.buffers() << "\n"
+             << "   Expected number of buffers: 1\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "TripletBuilder constructor (5x2, 4 buffers)";
+
+      TB builder( 5UL, 2UL, 4UL );
+
+      checkRows   ( builder, 5UL );
+      checkColumns( builder, 2UL );
+      checkSize   ( builder, 0UL );
+
+      if( builder.buffers() != 4UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of buffers detected\n"
+             << " Details:\n"
+             << "   Number of buffers         : " << builder.buffers() << "\n"
+             << "   Expected number of buffers: 4\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the add() functions of the TripletBuilder class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the add() functions of the TripletBuilder class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAdd()
+{
+   test_ = "TripletBuilder::add()";
+
+   TB builder( 3UL, 3UL, 3UL );
+   builder.reserve( 2UL, 10UL );
+
+   builder.add( 0UL, 1UL, 1 );
+   builder.add( 2UL, 2UL, 2 );
+   builder.add( 2UL, 1UL, 0UL, 3 );
+   builder.add( 2UL, 1UL, 1UL, 4 );
+   builder.add( 2UL, 1UL, 0UL, 5 );
+
+   checkSize( builder, 5UL );
+
+   if( builder.size( 0UL ) != 2UL || builder.size( 1UL ) != 0UL || builder.size( 2UL ) != 3UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of triplets per buffer detected\n"
+          << " Details:\n"
+          << "   Number of triplets         : ( " << builder.size( 0UL ) << " "
+          << builder.size( 1UL ) << " " << builder.size( 2UL ) << " )\n"
+          << "   Expected number of triplets: ( 2 0 3 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the build() function of the TripletBuilder class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the assembly of row-major and column-major compressed
+// matrices via the build() function of the TripletBuilder class template. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testBuild()
+{
+   //=====================================================================================
+   // Row-major matrix assembly
+   //=====================================================================================
+
+   {
+      test_ = "Row-major TripletBuilder::build()";
+
+      TB builder( 4UL, 5UL, 2UL );
+      builder.add( 0UL, 2UL, 4UL, 6 );
+      builder.add( 1UL, 0UL, 3UL, 2 );
+      builder.add( 0UL, 0UL, 1UL, 1 );
+      builder.add( 1UL, 2UL, 0UL, 4 );
+      builder.add( 0UL, 3UL, 2UL, 7 );
+      builder.add( 1UL, 2UL, 2UL, 5 );
+      builder.add( 0UL, 0UL, 0UL, 3 );
+
+      MT mat( 2UL, 2UL );
+      mat(1,1) = 9;
+
+      builder.build( mat );
+
+      checkRows    ( mat, 4UL );
+      checkColumns ( mat, 5UL );
+      checkNonZeros( mat, 7UL );
+      checkNonZeros( mat, 0UL, 3UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 3UL );
+      checkNonZeros( mat, 3UL, 1UL );
+
+      if( mat(0,0) != 3 || mat(0,1) != 1 || mat(0,3) != 2 ||
+          mat(2,0) != 4 || mat(2,2) != 5 || mat(2,4) != 6 || mat(3,2) != 7 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assembly failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 3 1 0 2 0 )\n( 0 0 0 0 0 )\n( 4 0 5 0 6 )\n( 0 0 7 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t i=0UL; i<mat.rows(); ++i ) {
+         for( MT::ConstIterator element=mat.begin(i); element!=mat.end(i); ++element ) {
+            if( element+1 != mat.end(i) && element->index() >= (element+1)->index() ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Unsorted elements in row " << i << "\n"
+                   << " Details:\n"
+                   << "   Result:\n" << mat << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix assembly
+   //=====================================================================================
+
+   {
+      test_ = "Column-major TripletBuilder::build()";
+
+      TB builder( 4UL, 5UL, 2UL );
+      builder.add( 0UL, 2UL, 4UL, 6 );
+      builder.add( 1UL, 0UL, 3UL, 2 );
+      builder.add( 0UL, 0UL, 1UL, 1 );
+      builder.add( 1UL, 2UL, 0UL, 4 );
+      builder.add( 0UL, 3UL, 2UL, 7 );
+      builder.add( 1UL, 2UL, 2UL, 5 );
+      builder.add( 0UL, 0UL, 0UL, 3 );
+
+      TMT mat;
+      builder.build( mat );
+
+      checkRows    ( mat, 4UL );
+      checkColumns ( mat, 5UL );
+      checkNonZeros( mat, 7UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 2UL );
+      checkNonZeros( mat, 3UL, 1UL );
+      checkNonZeros( mat, 4UL, 1UL );
+
+      if( mat(0,0) != 3 || mat(0,1) != 1 || mat(0,3) != 2 ||
+          mat(2,0) != 4 || mat(2,2) != 5 || mat(2,4) != 6 || mat(3,2) != 7 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assembly failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 3 1 0 2 0 )\n( 0 0 0 0 0 )\n( 4 0 5 0 6 )\n( 0 0 7 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Empty assembly
+   //=====================================================================================
+
+   {
+      test_ = "TripletBuilder::build() without triplets";
+
+      TB builder( 3UL, 2UL, 2UL );
+
+      MT mat( 2UL, 2UL );
+      mat(0,0) = 1;
+
+      builder.build( mat );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 2UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Large assembly
+   //=====================================================================================
+
+   {
+      test_ = "TripletBuilder::build() of a large random matrix";
+
+      const size_t threshold( blaze::getThreshold( blaze::smpTripletAssignThreshold ) );
+      blaze::setThreshold( blaze::smpTripletAssignThreshold, 0UL );
+
+      TB builder( 200UL, 150UL, 4UL );
+      MT ref( 200UL, 150UL );
+
+      for( size_t t=0UL; t<5000UL; ++t ) {
+         const size_t i( blaze::rand<size_t>( 0UL, 199UL ) );
+         const size_t j( blaze::rand<size_t>( 0UL, 149UL ) );
+         const int value( blaze::rand<int>( 1, 10 ) );
+         builder.add( t % 4UL, i, j, value );
+         ref(i,j) += value;
+      }
+
+      MT mat;
+      builder.build( mat );
+
+      TMT tmat;
+      builder.build( tmat );
+
+      blaze::setThreshold( blaze::smpTripletAssignThreshold, threshold );
+
+      checkNonZeros( mat , ref.nonZeros() );
+      checkNonZeros( tmat, ref.nonZeros() );
+
+      if( mat != ref || tmat != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assembly failed\n"
+             << " Details:\n"
+             << "   Row-major result:\n" << mat << "\n"
+             << "   Column-major result:\n" << tmat << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the merging of duplicate triplets.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the merge operations for duplicate triplets of the
+// TripletBuilder class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testMerge()
+{
+   TB builder( 2UL, 3UL, 2UL );
+   builder.add( 1UL, 0UL, 1UL, 4 );
+   builder.add( 0UL, 0UL, 1UL, 2 );
+   builder.add( 0UL, 1UL, 2UL, 5 );
+   builder.add( 1UL, 0UL, 1UL, 3 );
+   builder.add( 0UL, 1UL, 2UL, -5 );
+   builder.add( 0UL, 0UL, 1UL, 1 );
+
+
+   //=====================================================================================
+   // Summation of duplicates
+   //=====================================================================================
+
+   {
+      test_ = "TripletBuilder::build() with SumDuplicates";
+
+      MT mat;
+      builder.build( mat );
+
+      checkNonZeros( mat, 2UL );
+
+      if( mat(0,1) != 10 || mat(1,2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Merging of duplicates failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 10 0 )\n( 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Replacement of duplicates
+   //=====================================================================================
+
+   {
+      test_ = "TripletBuilder::build() with ReplaceDuplicates";
+
+      MT mat;
+      builder.build( mat, blaze::ReplaceDuplicates() );
+
+      checkNonZeros( mat, 2UL );
+
+      if( mat(0,1) != 3 || mat(1,2) != -5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Merging of duplicates failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 3 0 )\n( 0 0 -5 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Custom merge operation
+   //=====================================================================================
+
+   {
+      test_ = "TripletBuilder::build() with custom merge operation";
+
+      TMT mat;
+      builder.build( mat, MaxDuplicates() );
+
+      checkNonZeros( mat, 2UL );
+
+      if( mat(0,1) != 4 || mat(1,2) != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Merging of duplicates failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 4 0 )\n( 0 0 5 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the clear() function of the TripletBuilder class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the clear() function of the TripletBuilder class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testClear()
+{
+   test_ = "TripletBuilder::clear()";
+
+   TB builder( 3UL, 3UL, 2UL );
+   builder.add( 0UL, 0UL, 0UL, 1 );
+   builder.add( 1UL, 2UL, 1UL, 2 );
+
+   builder.clear();
+
+   checkRows   ( builder, 3UL );
+   checkColumns( builder, 3UL );
+   checkSize   ( builder, 0UL );
+
+   builder.add( 1UL, 1UL, 2UL, 3 );
+
+   MT mat;
+   builder.build( mat );
+
+   checkNonZeros( mat, 1UL );
+
+   if( mat(1,2) != 3 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Assembly after clear operation failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n"
+          << "   Expected result:\n( 0 0 0 )\n( 0 0 3 )\n( 0 0 0 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the TripletBuilder class template with a custom index type.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the assembly of a compressed matrix with 16-bit indices.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIndexType()
+{
+   test_ = "TripletBuilder with 16-bit indices";
+
+   STB builder( 65535UL, 300UL );
+   builder.add( 65534UL, 299UL, 2 );
+   builder.add(     0UL, 299UL, 1 );
+   builder.add( 65534UL,   0UL, 3 );
+   builder.add( 65534UL, 299UL, 4 );
+
+   SMT mat;
+   builder.build( mat );
+
+   checkRows    ( mat, 65535UL );
+   checkColumns ( mat, 300UL );
+   checkNonZeros( mat, 3UL );
+
+   if( mat(0,299) != 1 || mat(65534,0) != 3 || mat(65534,299) != 6 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Assembly failed\n"
+          << " Details:\n"
+          << "   Result: ( " << mat(0,299) << " " << mat(65534,0) << " " << mat(65534,299) << " )\n"
+          << "   Expected result: ( 1 3 6 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace tripletbuilder
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running TripletBuilder class test..." << std::endl;
+
+   try
+   {
+      RUN_TRIPLETBUILDER_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during TripletBuilder class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
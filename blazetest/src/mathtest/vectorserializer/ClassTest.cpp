@@ -67,6 +67,7 @@ ClassTest::ClassTest()
 {
    testEmptyVectors();
    testRandomVectors();
+   testFormat();
    testFailures();
 }
 //*************************************************************************************************
@@ -229,6 +230,65 @@ void ClassTest::testRandomVectors()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Test of the binary representation of serialized vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the bulk serialization of vectors with numeric elements results
+// in exactly the same binary representation as the element-wise serialization. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFormat()
+{
+   test_ = "Serialization format";
+
+   {
+      blaze::DynamicVector<int,blaze::columnVector> src( 7UL );
+      randomize( src );
+
+      std::stringstream result;
+      blaze::Archive<std::stringstream> archive( result );
+      archive << subvector( src, 2UL, 4UL );
+
+      std::stringstream expected;
+      blaze::Archive<std::stringstream> reference( expected );
+      reference << uint8_t( 1U ) << uint8_t( 0U ) << uint8_t( blaze::TypeValueMapping<int>::value )
+                << uint8_t( sizeof(int) ) << uint64_t( 4UL ) << uint64_t( 4UL );
+      for( size_t i=2UL; i<6UL; ++i )
+         reference << src[i];
+
+      compareStreams( result, expected );
+   }
+
+   {
+      blaze::CompressedVector<double,blaze::rowVector> src( 9UL );
+      src[1] = 1.0;
+      src[4] = 2.0;
+      src[8] = 3.0;
+
+      std::stringstream result;
+      blaze::Archive<std::stringstream> archive( result );
+      archive << src;
+
+      std::stringstream expected;
+      blaze::Archive<std::stringstream> reference( expected );
+      reference << uint8_t( 1U ) << uint8_t( 2U ) << uint8_t( blaze::TypeValueMapping<double>::value )
+                << uint8_t( sizeof(double) ) << uint64_t( 9UL ) << uint64_t( 3UL )
+                << size_t( 1UL ) << 1.0 << size_t( 4UL ) << 2.0 << size_t( 8UL ) << 3.0;
+
+      compareStreams( result, expected );
+
+      blaze::DynamicVector<double,blaze::rowVector> dst;
+      archive >> dst;
+
+      compareVectors( src, dst );
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Test of failing serialization attempts.
 //
@@ -316,6 +376,51 @@ void ClassTest::testFailures()
    }
    catch( std::runtime_error& )
    {}
+   try {
+      std::stringstream stream;
+      blaze::Archive<std::stringstream> archive( stream );
+      archive << uint8_t( 1U ) << uint8_t( 2U ) << uint8_t( blaze::TypeValueMapping<int>::value )
+              << uint8_t( sizeof(int) ) << uint64_t( 5UL ) << uint64_t( 1UL )
+              << size_t( 5UL ) << 1;
+
+      blaze::CompressedVector<int> dst;
+      archive >> dst;
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid index succeeded\n"
+          << " Details:\n"
+          << "   Destination:\n" << dst << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of the binary representations of two serialized vectors.
+//
+// \param result The binary representation of the serialized vector.
+// \param expected The expected binary representation.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the contents of the two given streams. In case they differ, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::compareStreams( const std::stringstream& result, const std::stringstream& expected )
+{
+   if( result.str() != expected.str() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid binary representation detected\n"
+          << " Details:\n"
+          << "   Size of the result         : " << result.str().size() << "\n"
+          << "   Size of the expected result: " << expected.str().size() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
 }
 //*************************************************************************************************
 
@@ -0,0 +1,420 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/thresholds/OperationTest.cpp
+//  \brief Source file for the threshold operation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/system/Thresholds.h>
+#include <blazetest/utiltest/thresholds/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace thresholds {
+
+//*************************************************************************************************
+//! The name of the temporary threshold file used in the tests.
+const char* const filename( "blazetest_thresholds.tmp" );
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the OperationTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+{
+   testDefaults();
+   testSetThreshold();
+   testLoadThresholds();
+   testSaveThresholds();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the default values of the runtime thresholds.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that after a reset all runtime thresholds are equal to the according
+// compile time settings. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void OperationTest::testDefaults()
+{
+   test_ = "Default threshold values";
+
+   blaze::resetThresholds();
+
+   using blaze::getThreshold;
+
+   if( getThreshold( blaze::dmatDVecMultThreshold     ) != blaze::DMATDVECMULT_THRESHOLD       ||
+       getThreshold( blaze::dmatDMatMultThreshold     ) != blaze::DMATDMATMULT_THRESHOLD       ||
+       getThreshold( blaze::smpDVecAssignThreshold    ) != blaze::SMP_DVECASSIGN_THRESHOLD     ||
+       getThreshold( blaze::smpDMatDMatMultThreshold  ) != blaze::SMP_DMATDMATMULT_THRESHOLD   ||
+       getThreshold( blaze::smpDVecTDVecMultThreshold ) != blaze::SMP_DVECTDVECMULT_THRESHOLD ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid default threshold detected\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   const std::string name( blaze::getThresholdName( blaze::smpTSMatTSMatMultThreshold ) );
+
+   if( name != "SMP_TSMATTSMATMULT_THRESHOLD" ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid threshold name detected\n"
+          << " Details:\n"
+          << "   Result: " << name << "\n"
+          << "   Expected result: SMP_TSMATTSMATMULT_THRESHOLD\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the setThreshold() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of setting runtime thresholds via the setThreshold() function.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testSetThreshold()
+{
+   // Setting an SMP threshold
+   {
+      test_ = "Setting an SMP threshold";
+
+      blaze::resetThresholds();
+
+      const blaze::DynamicVector<int> vec( 10UL );
+
+      blaze::setThreshold( blaze::smpDVecAssignThreshold, 9UL );
+
+      if( blaze::getThreshold( blaze::smpDVecAssignThreshold ) != 9UL || !vec.canSMPAssign() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setting the threshold failed\n"
+             << " Details:\n"
+             << "   Result: " << blaze::getThreshold( blaze::smpDVecAssignThreshold ) << "\n"
+             << "   Expected result: 9\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      blaze::setThreshold( blaze::smpDVecAssignThreshold, 10UL );
+
+      if( blaze::getThreshold( blaze::smpDVecAssignThreshold ) != 10UL || vec.canSMPAssign() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setting the threshold failed\n"
+             << " Details:\n"
+             << "   Result: " << blaze::getThreshold( blaze::smpDVecAssignThreshold ) << "\n"
+             << "   Expected result: 10\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      blaze::setThreshold( blaze::smpDVecAssignThreshold, 0UL );
+
+      if( blaze::getThreshold( blaze::smpDVecAssignThreshold ) != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setting the threshold failed\n"
+             << " Details:\n"
+             << "   Result: " << blaze::getThreshold( blaze::smpDVecAssignThreshold ) << "\n"
+             << "   Expected result: 0\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Setting a BLAS threshold to zero
+   {
+      test_ = "Setting a BLAS threshold to zero";
+
+      blaze::resetThresholds();
+
+      try {
+         blaze::setThreshold( blaze::dmatDMatMultThreshold, 0UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setting a BLAS threshold to zero succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      if( blaze::getThreshold( blaze::dmatDMatMultThreshold ) != blaze::DMATDMATMULT_THRESHOLD ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid threshold value detected\n"
+             << " Details:\n"
+             << "   Result: " << blaze::getThreshold( blaze::dmatDMatMultThreshold ) << "\n"
+             << "   Expected result: " << blaze::DMATDMATMULT_THRESHOLD << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the loadThresholds() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of loading runtime thresholds from a threshold file. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testLoadThresholds()
+{
+   // Loading a valid threshold file
+   {
+      test_ = "Loading a valid threshold file";
+
+      blaze::resetThresholds();
+
+      {
+         std::ofstream out( filename );
+         out << "# Test thresholds\n"
+             << "\n"
+             << "DMATDMATMULT_THRESHOLD = 12100\n"
+             << "  SMP_DVECASSIGN_THRESHOLD=1000  # Comment\n";
+      }
+
+      blaze::loadThresholds( filename );
+      std::remove( filename );
+
+      if( blaze::getThreshold( blaze::dmatDMatMultThreshold ) != 12100UL ||
+          blaze::getThreshold( blaze::smpDVecAssignThreshold ) != 1000UL ||
+          blaze::getThreshold( blaze::dmatDVecMultThreshold ) != blaze::DMATDVECMULT_THRESHOLD ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Loading the threshold file failed\n"
+             << " Details:\n"
+             << "   Result: " << blaze::getThreshold( blaze::dmatDMatMultThreshold )
+             << " / " << blaze::getThreshold( blaze::smpDVecAssignThreshold )
+             << " / " << blaze::getThreshold( blaze::dmatDVecMultThreshold ) << "\n"
+             << "   Expected result: 12100 / 1000 / " << blaze::DMATDVECMULT_THRESHOLD << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Loading an invalid threshold file
+   {
+      test_ = "Loading an invalid threshold file";
+
+      blaze::resetThresholds();
+
+      {
+         std::ofstream out( filename );
+         out << "DMATDMATMULT_THRESHOLD=12100\n"
+             << "SMP_DVECASSIGN_THRESHOLD=-1\n";
+      }
+
+      try {
+         blaze::loadThresholds( filename );
+         std::remove( filename );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Loading an invalid threshold file succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {
+         std::remove( filename );
+      }
+
+      if( blaze::getThreshold( blaze::dmatDMatMultThreshold ) != blaze::DMATDMATMULT_THRESHOLD ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Partial threshold file applied\n"
+             << " Details:\n"
+             << "   Result: " << blaze::getThreshold( blaze::dmatDMatMultThreshold ) << "\n"
+             << "   Expected result: " << blaze::DMATDMATMULT_THRESHOLD << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Loading a threshold file with an unknown threshold
+   {
+      test_ = "Loading a threshold file with an unknown threshold";
+
+      {
+         std::ofstream out( filename );
+         out << "UNKNOWN_THRESHOLD=100\n";
+      }
+
+      try {
+         blaze::loadThresholds( filename );
+         std::remove( filename );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Loading an unknown threshold succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {
+         std::remove( filename );
+      }
+   }
+
+   // Loading a non-existing threshold file
+   {
+      test_ = "Loading a non-existing threshold file";
+
+      try {
+         blaze::loadThresholds( "non-existing-threshold-file" );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Loading a non-existing threshold file succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ).find( " Test: " ) != std::string::npos )
+            throw;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the saveThresholds() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of writing the runtime thresholds to a threshold file. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testSaveThresholds()
+{
+   test_ = "Saving and restoring thresholds";
+
+   blaze::resetThresholds();
+   blaze::setThreshold( blaze::tdmatTDMatMultThreshold, 4900UL );
+   blaze::setThreshold( blaze::smpTSMatDVecMultThreshold, 0UL );
+
+   blaze::saveThresholds( filename );
+   blaze::resetThresholds();
+   blaze::loadThresholds( filename );
+   std::remove( filename );
+
+   if( blaze::getThreshold( blaze::tdmatTDMatMultThreshold ) != 4900UL ||
+       blaze::getThreshold( blaze::smpTSMatDVecMultThreshold ) != 0UL ||
+       blaze::getThreshold( blaze::smpDVecAssignThreshold ) != blaze::SMP_DVECASSIGN_THRESHOLD ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Restoring the thresholds failed\n"
+          << " Details:\n"
+          << "   Result: " << blaze::getThreshold( blaze::tdmatTDMatMultThreshold )
+          << " / " << blaze::getThreshold( blaze::smpTSMatDVecMultThreshold )
+          << " / " << blaze::getThreshold( blaze::smpDVecAssignThreshold ) << "\n"
+          << "   Expected result: 4900 / 0 / " << blaze::SMP_DVECASSIGN_THRESHOLD << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::resetThresholds();
+}
+//*************************************************************************************************
+
+} // namespace thresholds
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running threshold operation test..." << std::endl;
+
+   try
+   {
+      RUN_THRESHOLDS_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during threshold operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
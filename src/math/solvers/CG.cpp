@@ -39,6 +39,7 @@
 
 #include <cmath>
 #include <stdexcept>
+#include <blaze/math/dense/FusedKernels.h>
 #include <blaze/math/Functions.h>
 #include <blaze/math/solvers/CG.h>
 #include <blaze/util/Assert.h>
@@ -133,25 +134,17 @@ bool CG::solve( const CMatMxN& A, const VecN& b, VecN& x )
 
    for( ; !converged && it<maxIterations_; ++it )
    {
-      h_ = A * d_;
+      // Computing h = A*d and d^T*h in a single sweep
+      alpha = delta / fusedMultDot( h_, A, d_ );
 
-      alpha = delta / ( trans(d_) * h_ );
-
-      x  += alpha * d_;
-      r_ += alpha * h_;
-
-      lastPrecision_ = 0;
-      for( size_t i=0; i<n; ++i ) {
-         lastPrecision_ = max( lastPrecision_, std::fabs( r_[i] ) );
-      }
+      // Updating x and r and computing both r^T*r and the maximum norm of r in a single sweep
+      fusedAxpyAxpy( x, alpha, d_, r_, alpha, h_, beta, lastPrecision_ );
 
       if( lastPrecision_ < threshold_ ) {
          converged = true;
          break;
       }
 
-      beta = trans(r_) * r_;
-
       d_ = ( beta / delta ) * d_ - r_;
 
       delta = beta;
@@ -50,15 +50,95 @@ namespace blaze {
 
 //*************************************************************************************************
 /*!\brief The default constructor for the PGS class.
+//
+// \param mode The execution mode of the solver.
 */
-PGS::PGS()
-   : diagonal_()  // Vector for the diagonal entries of the LCP matrix
+PGS::PGS( Mode mode )
+   : Solver       ()        // Initialization of the base class
+   , mode_        ( mode )  // The execution mode of the solver
+   , partitions_  ( 64UL )  // The number of partitions in block-Jacobi mode
+   , diagonal_    ()        // Vector for the diagonal entries of the LCP matrix
+   , xprev_       ()        // The solution of the previous sweep
+   , colors_      ()        // The colors of the blocks
+   , order_       ()        // The blocks sorted by color
+   , colorOffsets_()        // The offsets of the colors within the block order
 {}
 //*************************************************************************************************
 
 
 
 
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Colors the blocks of the given LCP matrix.
+//
+// \param A The LCP matrix.
+// \param bs The number of unknowns per block.
+// \return void
+//
+// This function assigns a color to every block of unknowns such that no two blocks coupled by
+// the LCP matrix share the same color. The blocks are colored greedily in ascending order,
+// each block receives the smallest color not used by any of its previously colored neighbors.
+// Therefore the coloring only depends on the sparsity pattern of the LCP matrix. The color of
+// each block is stored in \a colors_, the blocks are stored in \a order_ sorted by color and
+// the offset of each color is stored in \a colorOffsets_.
+*/
+void PGS::color( const CMatMxN& A, size_t bs )
+{
+   const size_t N( A.rows() / bs );
+
+   // Setting up the symmetric coupling graph of the blocks
+   std::vector< std::vector<size_t> > neighbors( N );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      const size_t I( i / bs );
+      for( CMatMxN::ConstIterator element=A.begin(i); element!=A.end(i); ++element ) {
+         const size_t K( element->index() / bs );
+         if( K == I ) continue;
+         neighbors[I].push_back( K );
+         neighbors[K].push_back( I );
+      }
+   }
+
+   // Greedy coloring of the blocks
+   std::vector<size_t> marker( N+1UL, N );
+   colors_.assign( N, 0UL );
+   size_t count( 0UL );
+
+   for( size_t I=0UL; I<N; ++I ) {
+      const std::vector<size_t>& adjacent( neighbors[I] );
+      for( size_t k=0UL; k<adjacent.size(); ++k ) {
+         if( adjacent[k] < I )
+            marker[colors_[adjacent[k]]] = I;
+      }
+      size_t c( 0UL );
+      while( c < count && marker[c] == I ) ++c;
+      colors_[I] = c;
+      if( c == count ) ++count;
+   }
+
+   // Sorting the blocks by color
+   colorOffsets_.assign( count+1UL, 0UL );
+   for( size_t I=0UL; I<N; ++I )
+      ++colorOffsets_[colors_[I]+1UL];
+   for( size_t c=0UL; c<count; ++c )
+      colorOffsets_[c+1UL] += colorOffsets_[c];
+
+   std::vector<size_t> position( colorOffsets_.begin(), colorOffsets_.end()-1 );
+   order_.resize( N );
+   for( size_t I=0UL; I<N; ++I )
+      order_[position[colors_[I]]++] = I;
+}
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  EXPLICIT TEMPLATE INSTANTIATIONS